@@ -1311,9 +1311,10 @@ namespace blaze {}
 //
 //
 // The \b Blaze library currently offers three dense matrix types (\ref matrix_types_static_matrix,
-// \ref matrix_types_hybrid_matrix and \ref matrix_types_dynamic_matrix) and one sparse matrix type
-// (\ref matrix_types_compressed_matrix). All matrices can either be stored as row-major matrices
-// or column-major matrices. Per default, all matrices in \b Blaze are row-major matrices.
+// \ref matrix_types_hybrid_matrix and \ref matrix_types_dynamic_matrix) and two sparse matrix types
+// (\ref matrix_types_compressed_matrix and \ref matrix_types_compressed_soa_matrix). All matrices
+// can either be stored as row-major matrices or column-major matrices. Per default, all matrices
+// in \b Blaze are row-major matrices.
 //
 //
 // \n \section matrix_types_static_matrix StaticMatrix
@@ -1424,6 +1425,126 @@ namespace blaze {}
 //             The default value is blaze::rowMajor.
 //
 //
+// \n \section matrix_types_compressed_soa_matrix CompressedSoAMatrix
+// <hr>
+//
+// The blaze::CompressedSoAMatrix class template offers the same functionality as CompressedMatrix,
+// but stores the values and the indices of the non-zero elements in two separate arrays (the
+// classic CSR/CSC format) and uses 32-bit indices. This reduces the memory traffic of bandwidth
+// bound operations as for instance the sparse matrix/dense vector multiplication, but limits
+// the number of columns of a row-major matrix (or the number of rows of a column-major matrix)
+// to \f$ 2^{32} \f$. It can be included via the header file
+
+   \code
+   #include <blaze/math/CompressedSoAMatrix.h>
+   \endcode
+
+// The type of the elements and the storage order of the matrix can be specified via the two
+// template parameters:
+
+   \code
+   template< typename Type, bool SO >
+   class CompressedSoAMatrix;
+   \endcode
+
+//  - \c Type: specifies the type of the matrix elements. CompressedSoAMatrix can be used with
+//             any non-cv-qualified, non-reference, non-pointer element type.
+//  - \c SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//             The default value is blaze::rowMajor.
+//
+//
+// \n \section matrix_types_compressed_block_matrix CompressedBlockMatrix
+// <hr>
+//
+// The blaze::CompressedBlockMatrix class template implements a row-major sparse matrix whose
+// non-zero elements are grouped into dense \f$ B \times B \f$ blocks (the BCSR format). Only a
+// single 32-bit column index is stored per block and the sparse matrix/dense vector product works
+// on complete blocks, which pays off for matrices with a natural block structure as for instance
+// the matrices of finite element discretizations with several degrees of freedom per node. The
+// number of rows and columns of the matrix must be a multiple of \c B. It can be included via
+// the header file
+
+   \code
+   #include <blaze/math/CompressedBlockMatrix.h>
+   \endcode
+
+// The type of the elements and the size of the blocks can be specified via the two template
+// parameters:
+
+   \code
+   template< typename Type, size_t B >
+   class CompressedBlockMatrix;
+   \endcode
+
+//  - \c Type: specifies the type of the matrix elements. CompressedBlockMatrix can be used with
+//             any non-cv-qualified, non-reference, non-pointer element type.
+//  - \c B   : specifies the number of rows and columns of the dense blocks.
+//
+// A CompressedBlockMatrix is filled block by block via the \c appendBlock() and \c finalize()
+// functions or converted from any other dense or sparse matrix:
+
+   \code
+   blaze::StaticMatrix<double,3UL,3UL> block;
+   // ... Initialization of the block
+
+   blaze::CompressedBlockMatrix<double,3UL> A( 6UL, 9UL, 2UL );
+   A.appendBlock( 0UL, 2UL, block );  // Appending a block to the 0th block row
+   A.finalize( 0UL );                 // Finalizing the 0th block row
+   A.appendBlock( 1UL, 0UL, block );  // Appending a block to the 1st block row
+   A.finalize( 1UL );                 // Finalizing the 1st block row
+
+   blaze::CompressedMatrix<double> B( 6UL, 9UL );
+   blaze::CompressedBlockMatrix<double,3UL> C( B );  // Conversion from a compressed matrix
+   \endcode
+
+//
+// \n \section matrix_types_sliced_ellpack_matrix SlicedEllpackMatrix
+// <hr>
+//
+// The blaze::SlicedEllpackMatrix class template implements a read-only row-major sparse matrix
+// in the sliced ELLPACK format (SELL-C-sigma). The rows are grouped into chunks of \c C rows,
+// which are padded to the length of their longest row and stored column by column. Therefore
+// the sparse matrix/dense vector multiplication processes the \c C rows of a chunk at once by
+// means of vector instructions, independent of the length of the individual rows. In order to
+// reduce the amount of padding, the rows are sorted by their number of non-zero elements within
+// windows of \c sigma rows. This pays off for matrices with irregular row lengths as for instance
+// the adjacency matrices of power-law graphs. It can be included via the header file
+
+   \code
+   #include <blaze/math/SlicedEllpackMatrix.h>
+   \endcode
+
+// The type of the elements and the chunk height can be specified via the two template parameters:
+
+   \code
+   template< typename Type, size_t C >
+   class SlicedEllpackMatrix;
+   \endcode
+
+//  - \c Type: specifies the type of the matrix elements. SlicedEllpackMatrix can be used with
+//             any non-cv-qualified, non-reference, non-pointer element type.
+//  - \c C   : specifies the number of rows per chunk. The default value is 8, which corresponds
+//             to the number of double precision values of two AVX2 or one AVX-512 register.
+//
+// A SlicedEllpackMatrix is converted from any other dense or sparse matrix. The sorting scope
+// can be specified as second constructor argument (the default is given by the configuration
+// value blaze::SLICEDELLPACK_SORTING_SCOPE):
+
+   \code
+   blaze::CompressedMatrix<double> A( 1000UL, 1000UL );
+   // ... Initialization of the compressed matrix
+
+   blaze::SlicedEllpackMatrix<double> B( A );            // Conversion with the default sorting scope
+   blaze::SlicedEllpackMatrix<double,8UL> S( A, 64UL );  // Sorting within windows of 64 rows
+
+   blaze::DynamicVector<double,blaze::columnVector> x( 1000UL ), y;
+   blaze::DynamicVector<double,blaze::rowVector> z;
+   y = S * x;           // Vectorized sparse matrix/dense vector multiplication
+   z = trans( x ) * S;  // Transpose dense vector/sparse matrix multiplication
+
+   blaze::CompressedMatrix<double> D( S );  // Conversion back to a compressed matrix
+   \endcode
+
 // \n <center> Previous: \ref vector_operations &nbsp; &nbsp; Next: \ref matrix_operations </center>
 */
 //*************************************************************************************************
@@ -5907,7 +6028,7 @@ namespace blaze {}
 // In this example, two threads are used to compute two distinct matrix/vector multiplications
 // concurrently. Thereby each of the \c sections is executed by exactly one thread.
 //
-// Unfortunately \b Blaze does not support concurrent parallel computations and therefore this
+// Unfortunately \b Blaze does not support nested parallel computations and therefore this
 // approach does not work with any of the \b Blaze parallelization techniques. All techniques
 // (including the C++11 and Boost thread parallelizations; see \ref cpp_threads_parallelization
 // and \ref boost_threads_parallelization) are optimized for the parallel computation of an
@@ -5938,8 +6059,9 @@ namespace blaze {}
    }
    \endcode
 
-// Please note that the use of the \c BLAZE_SERIAL_SECTION (see also \ref serial_execution) does
-// NOT work in this context!
+// Since the state of a \c BLAZE_SERIAL_SECTION is local to the thread of execution, it is also
+// possible to serialize all operations within a single \c section via a serial section (see also
+// \ref serial_execution).
 //
 // \n <center> Previous: \ref matrix_matrix_multiplication &nbsp; &nbsp; Next: \ref cpp_threads_parallelization </center>
 */
@@ -6022,6 +6144,33 @@ namespace blaze {}
 // the C++11 thread parallelization.
 //
 //
+// \n \section cpp_threads_coroutines C++20 Coroutines
+// <hr>
+//
+// In case the code is compiled with C++20 coroutine support, the C++11 thread parallelization
+// can optionally be executed via coroutines. For that purpose the \c BLAZE_USE_COROUTINES switch
+// in the configuration file <em>./blaze/config/SMP.h</em> has to be set to 1:
+
+   \code
+   #define BLAZE_USE_COROUTINES 1
+   \endcode
+
+// In this mode, the chunks of a parallel operation are executed as coroutines whose frames are
+// reused by the calling thread, which avoids a dynamic memory allocation per chunk. Additionally,
+// the handles of asynchronous assignments can be awaited by coroutines via \c co_await. Instead
+// of blocking its thread, the awaiting coroutine is suspended until the assignment has been
+// completed and is then resumed by the \b Blaze thread that completed the assignment:
+
+   \code
+   blaze::DynamicMatrix<double> A, B, C;
+   // ... Resizing and initialization
+
+   co_await blaze::asyncAssign( C, A * B );
+   \endcode
+
+// Without C++20 coroutine support the setting is ignored.
+//
+//
 // \n \section cpp_threads_known_issues Known Issues
 // <hr>
 //
@@ -6133,9 +6282,10 @@ namespace blaze {}
 // <center> Previous: \ref cpp_threads_parallelization &nbsp; &nbsp; Next: \ref vector_serialization </center> \n
 //
 // Sometimes it may be necessary to enforce the serial execution of specific operations. For this
-// purpose, the \b Blaze library offers three possible options: the serialization of a single
+// purpose, the \b Blaze library offers four possible options: the serialization of a single
 // expression via the \c serial() function, the serialization of a block of expressions via the
-// \c BLAZE_SERIAL_SECTION, and the general deactivation of the parallel execution.
+// \c BLAZE_SERIAL_SECTION, the restriction of the number of threads via the \c BLAZE_THREAD_BUDGET,
+// and the general deactivation of the parallel execution.
 //
 //
 // \n \section serial_execution_serial_expression Option 1: Serialization of a Single Expression
@@ -6189,14 +6339,43 @@ namespace blaze {}
 // Outside the scope of the serial section, all operations are run in parallel (if beneficial for
 // the performance).
 //
-// Note that the \c BLAZE_SERIAL_SECTION must only be used within a single thread of execution.
-// The use of the serial section within several concurrent threads will result undefined behavior!
+// Note that the \c BLAZE_SERIAL_SECTION only affects the thread of execution it is used in. Other
+// threads that concurrently execute \b Blaze operations are not serialized by the serial section.
+//
+//
+// \n \section serial_execution_thread_budget Option 3: Restriction of the Number of Threads
+// <hr>
+//
+// The third option is the temporary and local restriction of the number of threads that are used
+// for the parallel execution of operations via the \c BLAZE_THREAD_BUDGET:
+
+   \code
+   blaze::DynamicMatrix<double> A, B;
+   blaze::DynamicVector<double> b, x;
+
+   // ... Resizing and initialization
+
+   // Parallel execution with at most two threads
+   BLAZE_THREAD_BUDGET( 2UL )
+   {
+      x = A * b;
+      B = A * A;
+   }
+   \endcode
+
+// Within the scope of the \c BLAZE_THREAD_BUDGET, all operations are executed by at most the
+// given number of threads. Nested thread budgets can only further restrict the number of threads,
+// and a thread budget of 0 results in a \a std::invalid_argument exception. In contrast to the
+// serial section, the thread budget is intended for applications that execute \b Blaze operations
+// from several threads concurrently: In case several threads are within a thread budget at the
+// same time, the available threads are evenly split among them and their operations are executed
+// concurrently instead of one after another.
 //
 //
-// \n \section serial_execution_deactivate_parallelism Option 3: Deactivation of Parallel Execution
+// \n \section serial_execution_deactivate_parallelism Option 4: Deactivation of Parallel Execution
 // <hr>
 //
-// The third option is the general deactivation of the parallel execution (even in case OpenMP is
+// The fourth option is the general deactivation of the parallel execution (even in case OpenMP is
 // enabled on the command line). This can be achieved via the \c BLAZE_USE_SHARED_MEMORY_PARALLELIZATION
 // switch in the <em>./blaze/config/SMP.h</em> configuration file:
 
@@ -6584,6 +6763,18 @@ namespace blaze {}
 // the operations. Note that deactivating the vectorization may pose a severe performance
 // limitation for a large number of operations!
 //
+// The vectorization via the 64-byte AVX-512 intrinsics has to be requested explicitly by a
+// second compile time switch in the same configuration file:
+
+   \code
+   #define BLAZE_USE_AVX512 0
+   \endcode
+
+// In case the switch is set to 1 and the AVX-512 instructions are available, all vectorizable
+// data types require an alignment of 64 bytes. Note that containers using the default allocator
+// (as for instance \c std::vector) don't guarantee this alignment for vectors and matrices with
+// static memory (i.e. StaticVector, StaticMatrix, HybridVector, and HybridMatrix).
+//
 //
 // \n \section thresholds Thresholds
 //
@@ -42,7 +42,9 @@
 
 #include <blaze/math/Accuracy.h>
 #include <blaze/math/BLAS.h>
+#include <blaze/math/CompressedBlockMatrix.h>
 #include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedSoAMatrix.h>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/Constants.h>
 #include <blaze/math/Constraints.h>
@@ -57,6 +59,7 @@
 #include <blaze/math/LowerMatrix.h>
 #include <blaze/math/Serialization.h>
 #include <blaze/math/Shims.h>
+#include <blaze/math/SlicedEllpackMatrix.h>
 #include <blaze/math/SMP.h>
 #include <blaze/math/StaticMatrix.h>
 #include <blaze/math/StaticVector.h>
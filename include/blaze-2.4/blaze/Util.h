@@ -90,5 +90,6 @@
 #include <blaze/util/UniquePtr.h>
 #include <blaze/util/UnsignedValue.h>
 #include <blaze/util/ValueTraits.h>
+#include <blaze/util/WorkStealingPool.h>
 
 #endif
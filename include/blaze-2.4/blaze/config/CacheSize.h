@@ -48,4 +48,57 @@ namespace blaze {
 const size_t cacheSize = 3145728UL;
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Size of the level 1 data cache of the target architecture.
+// \ingroup config
+//
+// This setting specifies the size in Byte of the level 1 data cache of a single core of the
+// used target architecture. Together with the sizes of the level 2 and level 3 cache it
+// determines the block sizes of the dense matrix multiplication kernels. In case the setting
+// is 0, the size of the cache is detected at runtime (see the getCacheSize() function).
+// Any other value overrides the detection. For instance, a 32 KiByte cache must therefore
+// be specified as 32768.
+*/
+const size_t l1CacheSize = 0UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Size of the level 2 cache of the target architecture.
+// \ingroup config
+//
+// This setting specifies the size in Byte of the level 2 cache of a single core of the used
+// target architecture. In case the setting is 0, the size of the cache is detected at runtime
+// (see the getCacheSize() function). Any other value overrides the detection. For instance,
+// a 1 MiByte cache must therefore be specified as 1048576.
+*/
+const size_t l2CacheSize = 0UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Size of the level 3 cache of the target architecture.
+// \ingroup config
+//
+// This setting specifies the size in Byte of the level 3 cache of the used target architecture.
+// In case the setting is 0, the size of the cache is detected at runtime (see the getCacheSize()
+// function). Any other value overrides the detection. For instance, a 8 MiByte cache must
+// therefore be specified as 8388608.
+*/
+const size_t l3CacheSize = 0UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Size of a cache line of the target architecture.
+// \ingroup config
+//
+// This setting specifies the size in Byte of a single cache line of the used target architecture.
+// The shared-memory parallelization aligns the boundaries of the work chunks of dense targets to
+// cache lines in order to avoid false sharing between threads. The size must be a power of two.
+*/
+const size_t cacheLineSize = 64UL;
+//*************************************************************************************************
+
 } // namespace blaze
@@ -51,4 +51,76 @@ namespace blaze {
 #define BLAZE_USE_SHARED_MEMORY_PARALLELIZATION 1
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the coroutine-based execution of the C++11 thread parallelization.
+// \ingroup config
+//
+// This compilation switch enables/disables the coroutine-based execution of the C++11 thread
+// parallelization. In case the switch is set to 1, the chunks of a parallel assignment are not
+// stored as type-erased function objects, but as C++20 coroutines whose frames are recycled by
+// the calling thread. Additionally, the handles of asynchronous assignments (see the SMPFuture
+// class) can be awaited via \c co_await, which suspends the awaiting coroutine until the
+// assignment has been completed instead of blocking its thread. The switch only takes effect in
+// case the C++11 thread parallelization is active (see the \c BLAZE_USE_CPP_THREADS command line
+// argument) and the compiler supports C++20 coroutines; otherwise it is ignored.
+//
+// Possible settings for the coroutine switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+*/
+#define BLAZE_USE_COROUTINES 0
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Number of work chunks per thread of the shared-memory parallelization.
+// \ingroup config
+//
+// This setting specifies into how many chunks per thread a parallel assignment is decomposed.
+// The chunks are distributed dynamically among the threads, i.e. a thread that finishes its
+// chunk early claims the next pending one. A value of 1 results in exactly one chunk per thread,
+// larger values compensate for imbalanced work (as for instance caused by sparse or triangular
+// operands or by threads that are interrupted by the operating system) at the cost of a little
+// more scheduling overhead per assignment.
+*/
+const size_t smpChunksPerThread = 4UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Number of elements per block of the parallel reductions.
+// \ingroup config
+//
+// This setting specifies the size of the blocks into which the elements of a reduction (as for
+// instance the inner product of two dense vectors or the length of a dense vector) are split.
+// The partial results of all blocks are combined by a pairwise summation in a fixed order.
+// Since the blocks do not depend on the number of threads, the result of a reduction is the
+// same for serial and parallel execution and for any number of threads. Vectors with at most
+// one block are reduced serially. The setting must be a multiple of 64.
+*/
+const size_t smpReductionBlockSize = 4096UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Number of spin iterations of idle threads of the C++11/Boost thread parallelization.
+// \ingroup config
+//
+// This setting specifies for how many iterations an idle thread of the C++11 or Boost thread
+// parallelization actively polls for new work before it goes to sleep. Waking up a sleeping
+// thread takes in the order of tens of microseconds, which dominates the runtime of parallel
+// operations on small and mid-sized vectors and matrices. Spinning threads avoid this latency,
+// such that series of such operations can profit from the parallelization (possibly in
+// combination with smaller SMP thresholds, see <tt><blaze/config/Thresholds.h></tt>). On the
+// other hand, spinning threads occupy their cores. Therefore spinning is only enabled in case
+// the number of threads is smaller than the number of hardware threads (i.e. in case the
+// calling thread and all worker threads have a core of their own), and a value of 0 disables
+// spinning entirely. At runtime the setting can be overridden via the \c BLAZE_SPIN_COUNT
+// environment variable and via the setSpinCount() function. Every iteration takes in the order
+// of 10 to 100 processor cycles.
+*/
+const size_t smpSpinCount = 4000UL;
+//*************************************************************************************************
+
 } // namespace blaze
@@ -126,6 +126,33 @@ const size_t DMATDMATMULT_THRESHOLD = 10000UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Row-major dense matrix/row-major dense matrix Strassen-Winograd threshold.
+// \ingroup config
+//
+// This setting specifies the crossover of the Strassen-Winograd algorithm for the multiplication
+// of row-major dense matrices. In case all three dimensions of the multiplication (the number of
+// rows and columns of the target matrix and the inner dimension) are equal or higher than this
+// value, the multiplication is recursively split into seven half-size multiplications instead
+// of eight. The recursion stops as soon as one of the dimensions falls below this value, the
+// remaining multiplications are computed by the packed Blaze kernel. In case the threshold is
+// set to 0, the Strassen-Winograd algorithm is disabled.
+//
+// Please note that the Strassen-Winograd algorithm is only stable in a normwise sense: The error
+// bound of the result is proportional to the product of the norms of the two operands and grows
+// with approximately \f$ (N/N_0)^{\log_2 18} \f$ instead of \f$ N \f$ (where \f$ N_0 \f$ is
+// the crossover), whereas the error of each element of the conventional multiplication is only
+// bounded by the magnitudes of the according row and column. Therefore the algorithm should not
+// be used for badly scaled matrices, i.e. in case the magnitudes of the elements vary strongly.
+//
+// The default setting for this threshold is 0, i.e. the Strassen-Winograd algorithm is disabled.
+// A reasonable crossover is typically in the range of 1024 to 2048 (which for instance leads to
+// one or two levels of recursion for a matrix size of \f$ 4096 \times 4096 \f$).
+*/
+const size_t DMATDMATMULT_STRASSEN_THRESHOLD = 0UL;
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Row-major dense matrix/column-major dense matrix multiplication threshold.
 // \ingroup config
@@ -177,6 +204,96 @@ const size_t TDMATTDMATMULT_THRESHOLD = 10000UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Row-major sparse matrix/row-major sparse matrix multiplication merge threshold.
+// \ingroup config
+//
+// This setting specifies the threshold between the merge-based and the hash-based accumulation
+// of a row of a row-major sparse matrix/row-major sparse matrix multiplication. In case the
+// according row of the left-hand side sparse matrix contains this number of non-zero elements
+// or less, the rows of the right-hand side sparse matrix are merged via a heap, which directly
+// produces the sorted result row. In case the row contains more non-zero elements, the row is
+// accumulated in a hash table, which is sorted afterwards.
+//
+// The default setting for this threshold is 16.
+*/
+const size_t SMATSMATMULT_MERGE_THRESHOLD = 16UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Row-major sparse matrix/row-major sparse matrix multiplication dense threshold.
+// \ingroup config
+//
+// This setting specifies the threshold for the dense accumulation of a row of a row-major sparse
+// matrix/row-major sparse matrix multiplication. In case the number of scalar multiplications of
+// a row multiplied by this value is equal or higher than the number of columns of the resulting
+// matrix, the row is accumulated in a dense array of the size of a row. Otherwise the row is
+// accumulated in a merge heap or in a hash table (see blaze::SMATSMATMULT_MERGE_THRESHOLD). The
+// dense array is only allocated in case at least one row qualifies for the dense accumulation.
+//
+// The default setting for this threshold is 16 (which for instance corresponds to a row with
+// 62500 scalar multiplications for a matrix with 1000000 columns).
+*/
+const size_t SMATSMATMULT_DENSE_THRESHOLD = 16UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Row-major sparse matrix/dense vector multiplication short row threshold.
+// \ingroup config
+//
+// This setting specifies the threshold for the grouping of short rows in a row-major sparse
+// matrix/dense vector multiplication. In case four consecutive rows of the sparse matrix contain
+// this number of non-zero elements or less, the four rows are processed simultaneously in order
+// to overlap the latencies of the indirect accesses to the dense vector. Longer rows are processed
+// one after another (and vectorized by means of gather instructions, if available).
+//
+// The default setting for this threshold is 16.
+*/
+const size_t SMATDVECMULT_SHORTROW_THRESHOLD = 16UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Row-major sparse matrix/dense vector multiplication prefetch distance.
+// \ingroup config
+//
+// This setting specifies the number of non-zero elements the vectorized row-major sparse
+// matrix/dense vector multiplication prefetches ahead of the current element. The elements of the
+// sparse matrix are prefetched with a non-temporal hint in order to keep the dense vector in the
+// cache. A setting of 0 disables the software prefetching.
+//
+// The default setting for this threshold is 0, since the hardware prefetchers of current x86
+// processors reliably detect the consecutive accesses to the non-zero elements and the additional
+// prefetch instructions slow down multiplications with matrices that fit into the cache. For
+// matrices that by far exceed the cache a setting of 64 (i.e. 1 KiB of double precision non-zero
+// elements ahead) can be beneficial on some architectures.
+*/
+const size_t SMATDVECMULT_PREFETCH_DISTANCE = 0UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default sorting scope of sliced ELLPACK matrices.
+// \ingroup config
+//
+// This setting specifies the default number of consecutive rows of a sliced ELLPACK matrix
+// (see blaze::SlicedEllpackMatrix) that are sorted by decreasing number of non-zero elements.
+// Sorting the rows reduces the amount of padding within the chunks of a matrix with irregular
+// row lengths, but only rows within the same window of this number of rows are exchanged in
+// order to preserve the locality of the accesses to the result vector. The setting is rounded
+// down to a multiple of the chunk height of the matrix.
+//
+// The default setting for this threshold is 4096, which limits the reordering of the result
+// vector to 32 KiB of double precision values. Matrices with heavy-tailed row lengths (as for
+// instance the adjacency matrices of power-law graphs) can profit from sorting all rows (i.e.
+// from specifying the number of rows as sorting scope).
+*/
+const size_t SLICEDELLPACK_SORTING_SCOPE = 4096UL;
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -300,6 +417,31 @@ const size_t SMP_DVECSCALARMULT_THRESHOLD = 51000UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP dense vector reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when a reduction of a dense vector (i.e. the inner product of two
+// dense vectors or the computation of the length or square length of a dense vector) can be
+// executed in parallel. In case the number of elements of the vectors is larger or equal to
+// this threshold and the vectors consist of more than a single reduction block (see the
+// blaze::smpReductionBlockSize setting), the reduction is executed in parallel. If the number
+// of elements is below this threshold the reduction is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization.
+//
+// The default setting for this threshold is 38000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+const size_t SMP_DVECREDUCTION_THRESHOLD = 38000UL;
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief SMP row-major dense matrix/dense vector multiplication threshold.
 // \ingroup config
@@ -52,3 +52,25 @@
 */
 #define BLAZE_USE_VECTORIZATION 1
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for (de-)activation of the AVX-512 vectorization.
+// \ingroup config
+//
+// This compilation switch enables/disables the vectorization via the 64-byte AVX-512
+// intrinsics. In case the switch is set to 1 and the AVX-512 foundation instructions are
+// available on the target platform, the Blaze library vectorizes the linear algebra
+// operations by AVX-512 intrinsics. In case the switch is set to 0, the Blaze library
+// uses the AVX/AVX2 or SSE intrinsics even on AVX-512 capable platforms. Note that in
+// AVX-512 mode all vectorizable data types require an alignment of 64 bytes. Whereas
+// the Blaze allocation functions and the class specific operators \c new provide this
+// alignment, containers using the default allocator (as for instance \c std::vector)
+// only guarantee the alignment chosen by the compiler!
+//
+// Possible settings for the AVX-512 switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+*/
+#define BLAZE_USE_AVX512 0
+//*************************************************************************************************
@@ -0,0 +1,373 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/CompressedBlockMatrix.h
+//  \brief Header file for the complete CompressedBlockMatrix implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_COMPRESSEDBLOCKMATRIX_H_
+#define _BLAZE_MATH_COMPRESSEDBLOCKMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <stdexcept>
+#include <blaze/math/sparse/CompressedBlockMatrix.h>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/SparseMatrix.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/util/Random.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  RAND SPECIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the Rand class template for CompressedBlockMatrix.
+// \ingroup random
+//
+// This specialization of the Rand class creates random instances of CompressedBlockMatrix.
+// In contrast to the other sparse matrices, the number of non-zero elements is specified in
+// terms of non-zero blocks. All elements of a non-zero block are randomized.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Number of rows and columns of the blocks
+class Rand< CompressedBlockMatrix<Type,B> >
+{
+ public:
+   //**Generate functions**************************************************************************
+   /*!\name Generate functions */
+   //@{
+   inline const CompressedBlockMatrix<Type,B> generate( size_t m, size_t n ) const;
+   inline const CompressedBlockMatrix<Type,B> generate( size_t m, size_t n, size_t nonzeroBlocks ) const;
+
+   template< typename Arg >
+   inline const CompressedBlockMatrix<Type,B> generate( size_t m, size_t n, const Arg& min, const Arg& max ) const;
+
+   template< typename Arg >
+   inline const CompressedBlockMatrix<Type,B> generate( size_t m, size_t n, size_t nonzeroBlocks,
+                                                        const Arg& min, const Arg& max ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Randomize functions*************************************************************************
+   /*!\name Randomize functions */
+   //@{
+   inline void randomize( CompressedBlockMatrix<Type,B>& matrix ) const;
+   inline void randomize( CompressedBlockMatrix<Type,B>& matrix, size_t nonzeroBlocks ) const;
+
+   template< typename Arg >
+   inline void randomize( CompressedBlockMatrix<Type,B>& matrix, const Arg& min, const Arg& max ) const;
+
+   template< typename Arg >
+   inline void randomize( CompressedBlockMatrix<Type,B>& matrix, size_t nonzeroBlocks,
+                          const Arg& min, const Arg& max ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline const CompressedMatrix<int,rowMajor> pattern( size_t mb, size_t nb, size_t nonzeroBlocks ) const;
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random CompressedBlockMatrix.
+//
+// \param m The number of rows of the random matrix.
+// \param n The number of columns of the random matrix.
+// \return The generated random matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline const CompressedBlockMatrix<Type,B>
+   Rand< CompressedBlockMatrix<Type,B> >::generate( size_t m, size_t n ) const
+{
+   CompressedBlockMatrix<Type,B> matrix( m, n );
+
+   randomize( matrix );
+
+   return matrix;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random CompressedBlockMatrix.
+//
+// \param m The number of rows of the random matrix.
+// \param n The number of columns of the random matrix.
+// \param nonzeroBlocks The number of non-zero blocks of the random matrix.
+// \return The generated random matrix.
+// \exception std::invalid_argument Invalid number of non-zero blocks.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline const CompressedBlockMatrix<Type,B>
+   Rand< CompressedBlockMatrix<Type,B> >::generate( size_t m, size_t n, size_t nonzeroBlocks ) const
+{
+   CompressedBlockMatrix<Type,B> matrix( m, n );
+
+   randomize( matrix, nonzeroBlocks );
+
+   return matrix;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random CompressedBlockMatrix.
+//
+// \param m The number of rows of the random matrix.
+// \param n The number of columns of the random matrix.
+// \param min The smallest possible value for a matrix element.
+// \param max The largest possible value for a matrix element.
+// \return The generated random matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , size_t B >      // Number of rows and columns of the blocks
+template< typename Arg >  // Min/max argument type
+inline const CompressedBlockMatrix<Type,B>
+   Rand< CompressedBlockMatrix<Type,B> >::generate( size_t m, size_t n, const Arg& min, const Arg& max ) const
+{
+   CompressedBlockMatrix<Type,B> matrix( m, n );
+
+   randomize( matrix, min, max );
+
+   return matrix;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random CompressedBlockMatrix.
+//
+// \param m The number of rows of the random matrix.
+// \param n The number of columns of the random matrix.
+// \param nonzeroBlocks The number of non-zero blocks of the random matrix.
+// \param min The smallest possible value for a matrix element.
+// \param max The largest possible value for a matrix element.
+// \return The generated random matrix.
+// \exception std::invalid_argument Invalid number of non-zero blocks.
+*/
+template< typename Type   // Data type of the matrix
+        , size_t B >      // Number of rows and columns of the blocks
+template< typename Arg >  // Min/max argument type
+inline const CompressedBlockMatrix<Type,B>
+   Rand< CompressedBlockMatrix<Type,B> >::generate( size_t m, size_t n, size_t nonzeroBlocks,
+                                                    const Arg& min, const Arg& max ) const
+{
+   CompressedBlockMatrix<Type,B> matrix( m, n );
+
+   randomize( matrix, nonzeroBlocks, min, max );
+
+   return matrix;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a CompressedBlockMatrix.
+//
+// \param matrix The matrix to be randomized.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline void Rand< CompressedBlockMatrix<Type,B> >::randomize( CompressedBlockMatrix<Type,B>& matrix ) const
+{
+   const size_t mb( matrix.blockRows()    );
+   const size_t nb( matrix.blockColumns() );
+
+   if( mb == 0UL || nb == 0UL ) return;
+
+   randomize( matrix, rand<size_t>( 1UL, std::ceil( 0.5*mb*nb ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a CompressedBlockMatrix.
+//
+// \param matrix The matrix to be randomized.
+// \param nonzeroBlocks The number of non-zero blocks of the random matrix.
+// \return void
+// \exception std::invalid_argument Invalid number of non-zero blocks.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline void Rand< CompressedBlockMatrix<Type,B> >::randomize( CompressedBlockMatrix<Type,B>& matrix,
+                                                              size_t nonzeroBlocks ) const
+{
+   typedef typename CompressedMatrix<int,rowMajor>::ConstIterator  ConstIterator;
+
+   const size_t mb( matrix.blockRows()    );
+   const size_t nb( matrix.blockColumns() );
+
+   const CompressedMatrix<int,rowMajor> blocks( pattern( mb, nb, nonzeroBlocks ) );
+
+   CompressedBlockMatrix<Type,B> tmp( matrix.rows(), matrix.columns(), nonzeroBlocks );
+
+   for( size_t ib=0UL; ib<mb; ++ib ) {
+      for( ConstIterator element=blocks.begin(ib); element!=blocks.end(ib); ++element )
+         tmp.appendBlock( ib, element->index(), rand< StaticMatrix<Type,B,B,rowMajor> >() );
+      tmp.finalize( ib );
+   }
+
+   matrix.swap( tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a CompressedBlockMatrix.
+//
+// \param matrix The matrix to be randomized.
+// \param min The smallest possible value for a matrix element.
+// \param max The largest possible value for a matrix element.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , size_t B >      // Number of rows and columns of the blocks
+template< typename Arg >  // Min/max argument type
+inline void Rand< CompressedBlockMatrix<Type,B> >::randomize( CompressedBlockMatrix<Type,B>& matrix,
+                                                              const Arg& min, const Arg& max ) const
+{
+   const size_t mb( matrix.blockRows()    );
+   const size_t nb( matrix.blockColumns() );
+
+   if( mb == 0UL || nb == 0UL ) return;
+
+   randomize( matrix, rand<size_t>( 1UL, std::ceil( 0.5*mb*nb ) ), min, max );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a CompressedBlockMatrix.
+//
+// \param matrix The matrix to be randomized.
+// \param nonzeroBlocks The number of non-zero blocks of the random matrix.
+// \param min The smallest possible value for a matrix element.
+// \param max The largest possible value for a matrix element.
+// \return void
+// \exception std::invalid_argument Invalid number of non-zero blocks.
+*/
+template< typename Type   // Data type of the matrix
+        , size_t B >      // Number of rows and columns of the blocks
+template< typename Arg >  // Min/max argument type
+inline void Rand< CompressedBlockMatrix<Type,B> >::randomize( CompressedBlockMatrix<Type,B>& matrix,
+                                                              size_t nonzeroBlocks,
+                                                              const Arg& min, const Arg& max ) const
+{
+   typedef typename CompressedMatrix<int,rowMajor>::ConstIterator  ConstIterator;
+
+   const size_t mb( matrix.blockRows()    );
+   const size_t nb( matrix.blockColumns() );
+
+   const CompressedMatrix<int,rowMajor> blocks( pattern( mb, nb, nonzeroBlocks ) );
+
+   CompressedBlockMatrix<Type,B> tmp( matrix.rows(), matrix.columns(), nonzeroBlocks );
+
+   for( size_t ib=0UL; ib<mb; ++ib ) {
+      for( ConstIterator element=blocks.begin(ib); element!=blocks.end(ib); ++element )
+         tmp.appendBlock( ib, element->index(), rand< StaticMatrix<Type,B,B,rowMajor> >( min, max ) );
+      tmp.finalize( ib );
+   }
+
+   matrix.swap( tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random block pattern.
+//
+// \param mb The number of block rows.
+// \param nb The number of block columns.
+// \param nonzeroBlocks The number of non-zero blocks.
+// \return The random block pattern.
+// \exception std::invalid_argument Invalid number of non-zero blocks.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline const CompressedMatrix<int,rowMajor>
+   Rand< CompressedBlockMatrix<Type,B> >::pattern( size_t mb, size_t nb, size_t nonzeroBlocks ) const
+{
+   if( nonzeroBlocks > mb*nb )
+      throw std::invalid_argument( "Invalid number of non-zero blocks" );
+
+   CompressedMatrix<int,rowMajor> blocks( mb, nb, nonzeroBlocks );
+
+   while( blocks.nonZeros() < nonzeroBlocks ) {
+      blocks( rand<size_t>( 0UL, mb-1UL ), rand<size_t>( 0UL, nb-1UL ) ) = 1;
+   }
+
+   return blocks;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
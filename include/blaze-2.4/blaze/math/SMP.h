@@ -40,11 +40,14 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/smp/AsyncAssign.h>
 #include <blaze/math/smp/DenseMatrix.h>
 #include <blaze/math/smp/DenseVector.h>
 #include <blaze/math/smp/Functions.h>
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/smp/SparseMatrix.h>
 #include <blaze/math/smp/SparseVector.h>
+#include <blaze/math/smp/TaskGraph.h>
+#include <blaze/math/smp/ThreadBudget.h>
 
 #endif
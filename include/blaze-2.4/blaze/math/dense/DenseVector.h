@@ -44,10 +44,12 @@
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
 #include <blaze/math/shims/Equal.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/IsNaN.h>
 #include <blaze/math/shims/Square.h>
+#include <blaze/math/smp/Reduction.h>
 #include <blaze/math/traits/CMathTrait.h>
 #include <blaze/math/TransposeFlag.h>
 #include <blaze/util/Assert.h>
@@ -55,6 +57,7 @@
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
 
@@ -362,6 +365,152 @@ inline typename EnableIf< IsNumeric<T1>, bool >::Type
 
 
 
+//=================================================================================================
+//
+//  REDUCTION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the square length of a dense vector.
+// \ingroup dense_vector
+*/
+template< typename VT    // Type of the dense vector
+        , typename RT >  // Result type of the square length
+struct DVecSqrLengthKernelHelper
+{
+   //**********************************************************************************************
+   enum { value = VT::vectorizable &&
+                  IsSame< typename VT::ElementType, RT >::value &&
+                  IntrinsicTrait<RT>::addition &&
+                  IntrinsicTrait<RT>::multiplication };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default reduction kernel for the square length of a dense vector.
+// \ingroup dense_vector
+//
+// The DVecSqrLengthKernel class template computes the sum of the squares of a range of elements
+// of a dense vector (see the smpReduce() functions).
+*/
+template< typename VT                                       // Type of the dense vector
+        , typename RT                                       // Result type of the square length
+        , bool = DVecSqrLengthKernelHelper<VT,RT>::value >  // Vectorization flag
+struct DVecSqrLengthKernel
+{
+   //**Type definitions****************************************************************************
+   typedef RT  ResultType;  //!< Result type of the square length.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DVecSqrLengthKernel class template.
+   //
+   // \param dv The dense vector.
+   */
+   explicit inline DVecSqrLengthKernel( const VT& dv )
+      : dv_( dv )  // The dense vector
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the sum of the squares of the given range of elements.
+   //
+   // \param begin The index of the first element.
+   // \param end The index one past the last element.
+   // \return The sum of the squares of the range of elements.
+   */
+   inline ResultType operator()( size_t begin, size_t end ) const {
+      ResultType sum( sq( dv_[begin] ) );
+      for( size_t i=begin+1UL; i<end; ++i )
+         sum += sq( dv_[i] );
+      return sum;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const VT& dv_;  //!< The dense vector.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic reduction kernel for the square length of a dense vector.
+// \ingroup dense_vector
+//
+// This specialization of the DVecSqrLengthKernel class template computes the sum of the squares
+// of a range of elements of a dense vector by means of intrinsics. The first index of the range
+// must be a multiple of the number of elements per intrinsic vector.
+*/
+template< typename VT    // Type of the dense vector
+        , typename RT >  // Result type of the square length
+struct DVecSqrLengthKernel<VT,RT,true>
+{
+   //**Type definitions****************************************************************************
+   typedef RT                  ResultType;  //!< Result type of the square length.
+   typedef IntrinsicTrait<RT>  IT;          //!< Intrinsic trait for the result type.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DVecSqrLengthKernel class template.
+   //
+   // \param dv The dense vector.
+   */
+   explicit inline DVecSqrLengthKernel( const VT& dv )
+      : dv_( dv )  // The dense vector
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the sum of the squares of the given range of elements.
+   //
+   // \param begin The index of the first element.
+   // \param end The index one past the last element.
+   // \return The sum of the squares of the range of elements.
+   */
+   inline ResultType operator()( size_t begin, size_t end ) const {
+      typename IT::Type xmm1, xmm2, xmm3, xmm4;
+
+      const size_t iend( end - ( end - begin ) % (IT::size*4UL) );
+
+      for( size_t i=begin; i<iend; i+=IT::size*4UL ) {
+         const typename IT::Type x1( dv_.load(i             ) );
+         const typename IT::Type x2( dv_.load(i+IT::size    ) );
+         const typename IT::Type x3( dv_.load(i+IT::size*2UL) );
+         const typename IT::Type x4( dv_.load(i+IT::size*3UL) );
+         xmm1 = fmadd( x1, x1, xmm1 );
+         xmm2 = fmadd( x2, x2, xmm2 );
+         xmm3 = fmadd( x3, x3, xmm3 );
+         xmm4 = fmadd( x4, x4, xmm4 );
+      }
+
+      ResultType sum( blaze::sum( xmm1 + xmm2 + xmm3 + xmm4 ) );
+
+      for( size_t i=iend; i<end; ++i )
+         sum += sq( dv_[i] );
+
+      return sum;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const VT& dv_;  //!< The dense vector.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  GLOBAL FUNCTIONS
@@ -507,6 +656,9 @@ bool isUniform( const DenseVector<VT,TF>& dv )
 //    </tr>
 // </table>
 //
+// For large vectors the length is computed in parallel (see the smpReduce() functions). The
+// result is independent of the number of threads.
+//
 // \b Note: This operation is only defined for numeric data types. In case the element type is
 // not a numeric data type (i.e. a user defined data type or boolean) the attempt to use the
 // length() function results in a compile time error!
@@ -517,13 +669,17 @@ typename CMathTrait<typename VT::ElementType>::Type length( const DenseVector<VT
 {
    typedef typename VT::ElementType                ElementType;
    typedef typename CMathTrait<ElementType>::Type  LengthType;
+   typedef typename VT::CompositeType              CT;
 
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ElementType );
 
-   LengthType sum( 0 );
-   for( size_t i=0UL; i<(~dv).size(); ++i )
-      sum += sq( (~dv)[i] );
-   return std::sqrt( sum );
+   CT a( ~dv );  // Evaluation of the dense vector operand
+
+   if( a.size() == 0UL ) return LengthType( 0 );
+
+   typedef DVecSqrLengthKernel< typename RemoveReference<CT>::Type, LengthType >  Kernel;
+
+   return std::sqrt( smpReduce( a.size(), Kernel( a ) ) );
 }
 //*************************************************************************************************
 
@@ -535,7 +691,9 @@ typename CMathTrait<typename VT::ElementType>::Type length( const DenseVector<VT
 // \param dv The given dense vector.
 // \return The square length of the dense vector.
 //
-// This function calculates the actual square length of the dense vector.
+// This function calculates the actual square length of the dense vector. For large vectors the
+// square length is computed in parallel (see the smpReduce() functions). The result is
+// independent of the number of threads.
 //
 // \b Note: This operation is only defined for numeric data types. In case the element type is
 // not a numeric data type (i.e. a user defined data type or boolean) the attempt to use the
@@ -545,14 +703,18 @@ template< typename VT  // Type of the dense vector
         , bool TF >    // Transpose flag
 const typename VT::ElementType sqrLength( const DenseVector<VT,TF>& dv )
 {
-   typedef typename VT::ElementType  ElementType;
+   typedef typename VT::ElementType    ElementType;
+   typedef typename VT::CompositeType  CT;
 
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ElementType );
 
-   ElementType sum( 0 );
-   for( size_t i=0UL; i<(~dv).size(); ++i )
-      sum += sq( (~dv)[i] );
-   return sum;
+   CT a( ~dv );  // Evaluation of the dense vector operand
+
+   if( a.size() == 0UL ) return ElementType( 0 );
+
+   typedef DVecSqrLengthKernel< typename RemoveReference<CT>::Type, ElementType >  Kernel;
+
+   return smpReduce( a.size(), Kernel( a ) );
 }
 //*************************************************************************************************
 
@@ -52,6 +52,8 @@
 #include <blaze/math/Intrinsics.h>
 #include <blaze/math/shims/Clear.h>
 #include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/smp/FirstTouch.h>
+#include <blaze/math/smp/Partition.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/ColumnTrait.h>
 #include <blaze/math/traits/DivTrait.h>
@@ -413,6 +415,61 @@ class DynamicMatrix : public DenseMatrix< DynamicMatrix<Type,SO>, SO >
    //**********************************************************************************************
 
  private:
+   //**Initializer class definition****************************************************************
+   /*!\brief Auxiliary functor for the (parallel) first-touch initialization of the matrix elements.
+   //
+   // The Initializer functor initializes a range of rows of the matrix with a given value,
+   // including the padding elements at the end of each row.
+   */
+   class Initializer
+   {
+    public:
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Initializer functor.
+      //
+      // \param v The matrix elements.
+      // \param n The number of columns of the matrix.
+      // \param nn The alignment adjusted number of columns of the matrix.
+      // \param init The initial value of the matrix elements.
+      */
+      explicit inline Initializer( Type* v, size_t n, size_t nn, const Type& init )
+         : v_   ( v     )  // The matrix elements
+         , n_   ( n     )  // The number of columns of the matrix
+         , nn_  ( nn    )  // The alignment adjusted number of columns
+         , init_( &init )  // The initial value of the matrix elements
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Initializes the rows in the range \f$ [begin..end) \f$.
+      //
+      // \param begin The index of the first row to be initialized.
+      // \param end The index one past the last row to be initialized.
+      // \return void
+      */
+      inline void operator()( size_t begin, size_t end ) const {
+         for( size_t i=begin; i<end; ++i ) {
+            for( size_t j=0UL; j<n_; ++j )
+               v_[i*nn_+j] = *init_;
+
+            if( IsVectorizable<Type>::value ) {
+               for( size_t j=n_; j<nn_; ++j )
+                  v_[i*nn_+j] = Type();
+            }
+         }
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      Type*       v_;     //!< The matrix elements.
+      size_t      n_;     //!< The number of columns of the matrix.
+      size_t      nn_;    //!< The alignment adjusted number of columns of the matrix.
+      const Type* init_;  //!< The initial value of the matrix elements.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
@@ -482,7 +539,9 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix()
 // \param n The number of columns of the matrix.
 //
 // \b Note: This constructor is only responsible to allocate the required dynamic memory. No
-//          element initialization is performed!
+//          element initialization is performed! Only in case the matrix is large enough to be
+//          assigned in parallel, the elements are default initialized by the same threads that
+//          will later be assigned the corresponding parts of the matrix (see smpFirstTouch()).
 */
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
@@ -493,7 +552,11 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
    , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
-   if( IsVectorizable<Type>::value ) {
+   if( IsVectorizable<Type>::value && canSMPAssign() ) {
+      const Type zero = Type();
+      smpFirstTouch( m_, smpGranularity<Type>( true, false ), Initializer( v_, n_, nn_, zero ) );
+   }
+   else if( IsVectorizable<Type>::value ) {
       for( size_t i=0UL; i<m_; ++i ) {
          for( size_t j=n_; j<nn_; ++j )
             v_[i*nn_+j] = Type();
@@ -510,7 +573,9 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
 // \param n The number of columns of the matrix.
 // \param init The initial value of the matrix elements.
 //
-// All matrix elements are initialized with the specified value.
+// All matrix elements are initialized with the specified value. In case the matrix is large
+// enough to be assigned in parallel, the elements are initialized by the same threads that will
+// later be assigned the corresponding parts of the matrix (see smpFirstTouch()).
 */
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
@@ -521,15 +586,12 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Type& in
    , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
-   for( size_t i=0UL; i<m; ++i ) {
-      for( size_t j=0UL; j<n_; ++j )
-         v_[i*nn_+j] = init;
+   const Initializer initializer( v_, n_, nn_, init );
 
-      if( IsVectorizable<Type>::value ) {
-         for( size_t j=n_; j<nn_; ++j )
-            v_[i*nn_+j] = Type();
-      }
-   }
+   if( canSMPAssign() )
+      smpFirstTouch( m_, smpGranularity<Type>( IsVectorizable<Type>::value, false ), initializer );
+   else
+      initializer( 0UL, m_ );
 }
 //*************************************************************************************************
 
@@ -2711,6 +2773,61 @@ class DynamicMatrix<Type,true> : public DenseMatrix< DynamicMatrix<Type,true>, t
    //**********************************************************************************************
 
  private:
+   //**Initializer class definition****************************************************************
+   /*!\brief Auxiliary functor for the (parallel) first-touch initialization of the matrix elements.
+   //
+   // The Initializer functor initializes a range of columns of the matrix with a given value,
+   // including the padding elements at the end of each column.
+   */
+   class Initializer
+   {
+    public:
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Initializer functor.
+      //
+      // \param v The matrix elements.
+      // \param n The number of rows of the matrix.
+      // \param nn The alignment adjusted number of rows of the matrix.
+      // \param init The initial value of the matrix elements.
+      */
+      explicit inline Initializer( Type* v, size_t n, size_t nn, const Type& init )
+         : v_   ( v     )  // The matrix elements
+         , n_   ( n     )  // The number of rows of the matrix
+         , nn_  ( nn    )  // The alignment adjusted number of rows
+         , init_( &init )  // The initial value of the matrix elements
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Initializes the columns in the range \f$ [begin..end) \f$.
+      //
+      // \param begin The index of the first column to be initialized.
+      // \param end The index one past the last column to be initialized.
+      // \return void
+      */
+      inline void operator()( size_t begin, size_t end ) const {
+         for( size_t j=begin; j<end; ++j ) {
+            for( size_t i=0UL; i<n_; ++i )
+               v_[j*nn_+i] = *init_;
+
+            if( IsVectorizable<Type>::value ) {
+               for( size_t i=n_; i<nn_; ++i )
+                  v_[j*nn_+i] = Type();
+            }
+         }
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      Type*       v_;     //!< The matrix elements.
+      size_t      n_;     //!< The number of rows of the matrix.
+      size_t      nn_;    //!< The alignment adjusted number of rows of the matrix.
+      const Type* init_;  //!< The initial value of the matrix elements.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
@@ -2781,7 +2898,9 @@ inline DynamicMatrix<Type,true>::DynamicMatrix()
 // \param n The number of columns of the matrix.
 //
 // \b Note: This constructor is only responsible to allocate the required dynamic memory. No
-//          element initialization is performed!
+//          element initialization is performed! Only in case the matrix is large enough to be
+//          assigned in parallel, the elements are default initialized by the same threads that
+//          will later be assigned the corresponding parts of the matrix (see smpFirstTouch()).
 */
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
@@ -2791,7 +2910,11 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
    , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
-   if( IsVectorizable<Type>::value ) {
+   if( IsVectorizable<Type>::value && canSMPAssign() ) {
+      const Type zero = Type();
+      smpFirstTouch( n_, smpGranularity<Type>( true, false ), Initializer( v_, m_, mm_, zero ) );
+   }
+   else if( IsVectorizable<Type>::value ) {
       for( size_t j=0UL; j<n_; ++j )
          for( size_t i=m_; i<mm_; ++i ) {
             v_[i+j*mm_] = Type();
@@ -2810,7 +2933,9 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
 // \param n The number of columns of the matrix.
 // \param init The initial value of the matrix elements.
 //
-// All matrix elements are initialized with the specified value.
+// All matrix elements are initialized with the specified value. In case the matrix is large
+// enough to be assigned in parallel, the elements are initialized by the same threads that will
+// later be assigned the corresponding parts of the matrix (see smpFirstTouch()).
 */
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Type& init )
@@ -2820,15 +2945,12 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Type&
    , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( size_t i=0UL; i<m_; ++i )
-         v_[i+j*mm_] = init;
+   const Initializer initializer( v_, m_, mm_, init );
 
-      if( IsVectorizable<Type>::value ) {
-         for( size_t i=m_; i<mm_; ++i )
-            v_[i+j*mm_] = Type();
-      }
-   }
+   if( canSMPAssign() )
+      smpFirstTouch( n_, smpGranularity<Type>( IsVectorizable<Type>::value, false ), initializer );
+   else
+      initializer( 0UL, n_ );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -50,6 +50,8 @@
 #include <blaze/math/shims/Clear.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/FirstTouch.h>
+#include <blaze/math/smp/Partition.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/CrossTrait.h>
 #include <blaze/math/traits/DivTrait.h>
@@ -394,6 +396,59 @@ class DynamicVector : public DenseVector< DynamicVector<Type,TF>, TF >
    //**********************************************************************************************
 
  private:
+   //**Initializer class definition****************************************************************
+   /*!\brief Auxiliary functor for the (parallel) first-touch initialization of the vector elements.
+   //
+   // The Initializer functor initializes a range of vector elements with a given value. The
+   // chunk containing the last element additionally initializes the padding elements.
+   */
+   class Initializer
+   {
+    public:
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Initializer functor.
+      //
+      // \param v The vector elements.
+      // \param size The size of the vector.
+      // \param capacity The capacity of the vector.
+      // \param init The initial value of the vector elements.
+      */
+      explicit inline Initializer( Type* v, size_t size, size_t capacity, const Type& init )
+         : v_       ( v        )  // The vector elements
+         , size_    ( size     )  // The size of the vector
+         , capacity_( capacity )  // The capacity of the vector
+         , init_    ( &init    )  // The initial value of the vector elements
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Initializes the vector elements in the range \f$ [begin..end) \f$.
+      //
+      // \param begin The index of the first element to be initialized.
+      // \param end The index one past the last element to be initialized.
+      // \return void
+      */
+      inline void operator()( size_t begin, size_t end ) const {
+         for( size_t i=begin; i<end; ++i )
+            v_[i] = *init_;
+
+         if( IsVectorizable<Type>::value && end == size_ ) {
+            for( size_t i=size_; i<capacity_; ++i )
+               v_[i] = Type();
+         }
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      Type*       v_;         //!< The vector elements.
+      size_t      size_;      //!< The size of the vector.
+      size_t      capacity_;  //!< The capacity of the vector.
+      const Type* init_;      //!< The initial value of the vector elements.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
@@ -477,7 +532,9 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n )
 // \param n The size of the vector.
 // \param init The initial value of the vector elements.
 //
-// All vector elements are initialized with the specified value.
+// All vector elements are initialized with the specified value. In case the vector is large
+// enough to be assigned in parallel, the elements are initialized by the same threads that will
+// later be assigned the corresponding parts of the vector (see smpFirstTouch()).
 */
 template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
@@ -486,13 +543,12 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n, const Type& init )
    , capacity_( adjustCapacity( n ) )          // The maximum capacity of the vector
    , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
 {
-   for( size_t i=0UL; i<size_; ++i )
-      v_[i] = init;
+   const Initializer initializer( v_, size_, capacity_, init );
 
-   if( IsVectorizable<Type>::value ) {
-      for( size_t i=size_; i<capacity_; ++i )
-         v_[i] = Type();
-   }
+   if( canSMPAssign() )
+      smpFirstTouch( size_, smpGranularity<Type>( IsVectorizable<Type>::value, true ), initializer );
+   else
+      initializer( 0UL, size_ );
 }
 //*************************************************************************************************
 
@@ -0,0 +1,674 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/MMM.h
+//  \brief Header file for the packed dense matrix/dense matrix multiplication kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_MMM_H_
+#define _BLAZE_MATH_DENSE_MMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DMatTransExpr.h>
+#include <blaze/math/expressions/DMatTransposer.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/IsOne.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/util/AlignedArray.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/policies/Deallocate.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/UniqueArray.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS MMMTRAIT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocking parameters of the dense matrix/dense matrix multiplication kernels.
+// \ingroup dense_matrix
+//
+// The MMMTrait class template defines the register and cache blocking of the dense matrix
+// multiplication kernels for the given element type \a T. The register blocking is fixed at
+// compile time: The packed micro-kernel keeps a block of \a mr rows and \a nr columns of the
+// target matrix in registers, which amounts to 12 live intrinsic accumulators (6 rows times 2
+// intrinsic vectors). \a nr scales automatically with the width of the active instruction set
+// (SSE, AVX, MIC).
+//
+// The cache blocking is derived at runtime from the cache sizes of the target architecture
+// (see the getCacheSize() function). For the packed kernel, \a kc() is chosen such that a
+// single \a kc x \a nr panel of the right-hand side operand fills half of the L1 cache, \a mc()
+// such that the packed \a mc x \a kc block of the left-hand side operand fills half of the L2
+// cache, and \a nc() such that the packed \a kc x \a nc block of the right-hand side operand
+// fills half of the L3 cache. For the unpacked, tiled kernels, \a vblock() and \a kblock() are
+// chosen such that a \a kblock x \a vblock tile of the streamed operand fills half of the L2
+// cache. \a vblock() is used for the vectorized dimension of the target matrix, \a sblock() for
+// the scalar dimension. \a vblock() is always a multiple of four intrinsic vectors such that
+// the vectorized loops of the tiled kernels never cross tile boundaries.
+*/
+template< typename T >  // Type of the matrix elements
+struct MMMTrait
+{
+   enum { mr = 6UL                              //!< Number of rows of a micro-tile.
+        , nr = 2UL * IntrinsicTrait<T>::size }; //!< Number of columns of a micro-tile.
+
+   //**********************************************************************************************
+   /*!\brief Returns the number of rows of a packed block of the left-hand side operand.
+   //
+   // \return The number of rows of a packed block of A (multiple of \a mr).
+   */
+   static inline size_t mc() { return blocking().mc; }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the depth of the packed blocks of both operands.
+   //
+   // \return The number of columns/rows of the packed blocks of A and B.
+   */
+   static inline size_t kc() { return blocking().kc; }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the number of columns of a packed block of the right-hand side operand.
+   //
+   // \return The number of columns of a packed block of B (multiple of \a nr).
+   */
+   static inline size_t nc() { return blocking().nc; }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the tile size of the tiled kernels in the vectorized dimension.
+   //
+   // \return The tile size in the vectorized dimension (multiple of four intrinsic vectors).
+   */
+   static inline size_t vblock() { return blocking().vblock; }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the tile size of the tiled kernels in the scalar dimension.
+   //
+   // \return The tile size in the scalar dimension.
+   */
+   static inline size_t sblock() { return blocking().sblock; }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the tile size of the tiled kernels in the inner dimension.
+   //
+   // \return The tile size in the inner dimension.
+   */
+   static inline size_t kblock() { return blocking().kblock; }
+   //**********************************************************************************************
+
+ private:
+   //**Blocking struct definition******************************************************************
+   /*!\brief Cache blocking derived from the cache sizes of the target architecture.
+   */
+   struct Blocking
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Derives the block sizes from the L1, L2, and L3 cache sizes.
+      */
+      Blocking()
+      {
+         const size_t size( sizeof(T) );
+         const size_t vsize( 4UL * IntrinsicTrait<T>::size );
+
+         kc = clamp( getCacheSize( 1UL ) / ( 2UL * nr * size ), 8UL, 64UL, 1024UL );
+         mc = clamp( getCacheSize( 2UL ) / ( 2UL * kc * size ), mr, 2UL*mr, 1020UL );
+         nc = clamp( getCacheSize( 3UL ) / ( 2UL * kc * size ), nr, 4UL*nr, 8192UL );
+
+         size_t tile( 1UL );
+         while( ( 2UL*tile ) * ( 2UL*tile ) * size <= getCacheSize( 2UL ) / 2UL )
+            tile *= 2UL;
+
+         vblock = clamp( tile, vsize, max( 64UL, vsize ), 512UL );
+         sblock = max( vblock / 2UL, 16UL );
+         kblock = vblock;
+      }
+      //*******************************************************************************************
+
+      //**Clamp function***************************************************************************
+      /*!\brief Rounds the given value down to a multiple of \a step and restricts it to a range.
+      //
+      // \param value The value to be rounded and clamped.
+      // \param step The rounding granularity.
+      // \param lower The lower bound (a multiple of \a step).
+      // \param upper The upper bound.
+      // \return The rounded and clamped value.
+      */
+      static inline size_t clamp( size_t value, size_t step, size_t lower, size_t upper ) {
+         value = min( value, upper );
+         value = value - ( value % step );
+         return max( value, lower );
+      }
+      //*******************************************************************************************
+
+      size_t mc;      //!< Number of rows of a packed block of A.
+      size_t kc;      //!< Depth of the packed blocks of A and B.
+      size_t nc;      //!< Number of columns of a packed block of B.
+      size_t vblock;  //!< Tile size of the tiled kernels in the vectorized dimension.
+      size_t sblock;  //!< Tile size of the tiled kernels in the scalar dimension.
+      size_t kblock;  //!< Tile size of the tiled kernels in the inner dimension.
+   };
+   //**********************************************************************************************
+
+   //**Blocking function***************************************************************************
+   /*!\brief Returns the cache blocking for the element type \a T.
+   //
+   // \return Reference to the cache blocking.
+   */
+   static inline const Blocking& blocking() {
+      static const Blocking b;
+      return b;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packs a block of the left-hand side operand of a matrix multiplication.
+// \ingroup dense_matrix
+//
+// \param A The left-hand side multiplication operand.
+// \param Ap Pointer to the first element of the packed block.
+// \param ibegin The index of the first row of the block.
+// \param m The number of rows of the block.
+// \param kbegin The index of the first column of the block.
+// \param kc The number of columns of the block.
+// \return void
+//
+// This function copies the \a m x \a kc block of \a A starting at (\a ibegin,\a kbegin) into
+// consecutive micro-panels of \a mr rows. Within a micro-panel the elements are stored column
+// by column, such that the micro-kernel can stream through the panel with unit stride. The
+// last micro-panel is padded with zeros.
+*/
+template< typename MT >  // Type of the left-hand side matrix operand
+void packLeftBlock( const MT& A, typename MT::ElementType* Ap,
+                    size_t ibegin, size_t m, size_t kbegin, size_t kc )
+{
+   typedef typename MT::ElementType  ET;
+
+   const size_t MR( MMMTrait<ET>::mr );
+
+   for( size_t ii=0UL; ii<m; ii+=MR )
+   {
+      const size_t mr( min( MR, m-ii ) );
+
+      for( size_t k=0UL; k<kc; ++k ) {
+         size_t i( 0UL );
+         for( ; i<mr; ++i )
+            *Ap++ = A(ibegin+ii+i,kbegin+k);
+         for( ; i<MR; ++i )
+            reset( *Ap++ );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packs a block of the right-hand side operand of a matrix multiplication.
+// \ingroup dense_matrix
+//
+// \param B The right-hand side multiplication operand.
+// \param Bp Pointer to the first element of the packed block.
+// \param kbegin The index of the first row of the block.
+// \param kc The number of rows of the block.
+// \param jbegin The index of the first column of the block.
+// \param n The number of columns of the block.
+// \return void
+//
+// This function copies the \a kc x \a n block of \a B starting at (\a kbegin,\a jbegin) into
+// consecutive, properly aligned micro-panels of \a nr columns. Within a micro-panel the elements
+// are stored row by row. The last micro-panel is padded with zeros.
+*/
+template< typename MT >  // Type of the right-hand side matrix operand
+void packRightBlock( const MT& B, typename MT::ElementType* Bp,
+                     size_t kbegin, size_t kc, size_t jbegin, size_t n )
+{
+   typedef typename MT::ElementType  ET;
+   typedef IntrinsicTrait<ET>        IT;
+
+   const size_t NR( MMMTrait<ET>::nr );
+
+   for( size_t jj=0UL; jj<n; jj+=NR )
+   {
+      const size_t nr( min( NR, n-jj ) );
+
+      if( nr == NR && IsRowMajorMatrix<MT>::value ) {
+         for( size_t k=0UL; k<kc; ++k ) {
+            store( Bp         , B.load( kbegin+k, jbegin+jj          ) );
+            store( Bp+IT::size, B.load( kbegin+k, jbegin+jj+IT::size ) );
+            Bp += NR;
+         }
+      }
+      else {
+         for( size_t k=0UL; k<kc; ++k ) {
+            size_t j( 0UL );
+            for( ; j<nr; ++j )
+               *Bp++ = B(kbegin+k,jbegin+jj+j);
+            for( ; j<NR; ++j )
+               reset( *Bp++ );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MICRO-KERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Register-blocked micro-kernel of the packed matrix multiplication
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target row-major dense matrix.
+// \param i The row index of the first element of the micro-tile.
+// \param j The column index of the first element of the micro-tile.
+// \param m The number of valid rows of the micro-tile.
+// \param n The number of valid columns of the micro-tile.
+// \param kc The depth of the packed micro-panels.
+// \param Ap Pointer to the packed micro-panel of the left-hand side operand.
+// \param Bp Pointer to the packed micro-panel of the right-hand side operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function computes the product of an \a mr x \a kc micro-panel of \a A and a \a kc x
+// \a nr micro-panel of \a B in 12 intrinsic accumulators and merges the result into the
+// \a m x \a n micro-tile of \a C starting at (\a i,\a j). Full micro-tiles are written back
+// by means of intrinsic loads and stores, partial micro-tiles at the bottom and right border
+// of \a C element by element. In case \a beta is 0, \a C is not read.
+*/
+template< typename MT >  // Type of the target dense matrix
+inline void mmmMicroKernel( MT& C, size_t i, size_t j, size_t m, size_t n, size_t kc,
+                            const typename MT::ElementType* Ap, const typename MT::ElementType* Bp,
+                            typename MT::ElementType alpha, typename MT::ElementType beta )
+{
+   typedef typename MT::ElementType  ET;
+   typedef IntrinsicTrait<ET>        IT;
+   typedef typename IT::Type         IntrinsicType;
+
+   const size_t MR( MMMTrait<ET>::mr );
+   const size_t NR( MMMTrait<ET>::nr );
+
+   BLAZE_STATIC_ASSERT( MMMTrait<ET>::mr == 6UL && MMMTrait<ET>::nr == 2UL*IT::size );
+
+   IntrinsicType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8, xmm9, xmm10, xmm11, xmm12;
+
+   for( size_t k=0UL; k<kc; ++k ) {
+      const IntrinsicType b1( load( Bp          ) );
+      const IntrinsicType b2( load( Bp+IT::size ) );
+      const IntrinsicType a1( set( Ap[0] ) );
+      const IntrinsicType a2( set( Ap[1] ) );
+      const IntrinsicType a3( set( Ap[2] ) );
+      const IntrinsicType a4( set( Ap[3] ) );
+      const IntrinsicType a5( set( Ap[4] ) );
+      const IntrinsicType a6( set( Ap[5] ) );
+      xmm1  = fmadd( a1, b1, xmm1  );
+      xmm2  = fmadd( a1, b2, xmm2  );
+      xmm3  = fmadd( a2, b1, xmm3  );
+      xmm4  = fmadd( a2, b2, xmm4  );
+      xmm5  = fmadd( a3, b1, xmm5  );
+      xmm6  = fmadd( a3, b2, xmm6  );
+      xmm7  = fmadd( a4, b1, xmm7  );
+      xmm8  = fmadd( a4, b2, xmm8  );
+      xmm9  = fmadd( a5, b1, xmm9  );
+      xmm10 = fmadd( a5, b2, xmm10 );
+      xmm11 = fmadd( a6, b1, xmm11 );
+      xmm12 = fmadd( a6, b2, xmm12 );
+      Ap += MR;
+      Bp += NR;
+   }
+
+   AlignedArray<ET,MMMTrait<ET>::mr*MMMTrait<ET>::nr> tmp;
+
+   store( &tmp[ 0UL*IT::size], xmm1  );
+   store( &tmp[ 1UL*IT::size], xmm2  );
+   store( &tmp[ 2UL*IT::size], xmm3  );
+   store( &tmp[ 3UL*IT::size], xmm4  );
+   store( &tmp[ 4UL*IT::size], xmm5  );
+   store( &tmp[ 5UL*IT::size], xmm6  );
+   store( &tmp[ 6UL*IT::size], xmm7  );
+   store( &tmp[ 7UL*IT::size], xmm8  );
+   store( &tmp[ 8UL*IT::size], xmm9  );
+   store( &tmp[ 9UL*IT::size], xmm10 );
+   store( &tmp[10UL*IT::size], xmm11 );
+   store( &tmp[11UL*IT::size], xmm12 );
+
+   if( n == NR )
+   {
+      const IntrinsicType factor( set( alpha ) );
+
+      for( size_t ii=0UL; ii<m; ++ii )
+      {
+         const IntrinsicType c1( factor * load( &tmp[ii*NR         ] ) );
+         const IntrinsicType c2( factor * load( &tmp[ii*NR+IT::size] ) );
+
+         if( isDefault( beta ) ) {
+            C.store( i+ii, j         , c1 );
+            C.store( i+ii, j+IT::size, c2 );
+         }
+         else if( isOne( beta ) ) {
+            C.store( i+ii, j         , C.load( i+ii, j          ) + c1 );
+            C.store( i+ii, j+IT::size, C.load( i+ii, j+IT::size ) + c2 );
+         }
+         else {
+            const IntrinsicType scale( set( beta ) );
+            C.store( i+ii, j         , scale * C.load( i+ii, j          ) + c1 );
+            C.store( i+ii, j+IT::size, scale * C.load( i+ii, j+IT::size ) + c2 );
+         }
+      }
+   }
+   else
+   {
+      for( size_t ii=0UL; ii<m; ++ii ) {
+         for( size_t jj=0UL; jj<n; ++jj ) {
+            if( isDefault( beta ) )
+               C(i+ii,j+jj) = alpha * tmp[ii*NR+jj];
+            else
+               C(i+ii,j+jj) = beta * C(i+ii,j+jj) + alpha * tmp[ii*NR+jj];
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKED MATRIX MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of a range of rows of the left-hand side operand with a packed block of
+//        the right-hand side operand.
+// \ingroup dense_matrix
+//
+// \param C The target row-major dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param Ap Pointer to the packing buffer for blocks of \a A (at least \a mc x \a kc elements).
+// \param Bp Pointer to the packed \a kc x \a nc block of \a B.
+// \param ibegin The index of the first row of \a C to be computed.
+// \param iend The index one past the last row of \a C to be computed.
+// \param jj The column index of the first column of the packed block of \a B.
+// \param jbegin The first column to be computed, relative to \a jj (multiple of \a nr).
+// \param jend The column one past the last column to be computed, relative to \a jj.
+// \param kk The index of the first row of the packed block of \a B.
+// \param kb The number of rows of the packed block of \a B.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function packs the rows \a ibegin to \a iend of \a A block by block into the given buffer
+// and multiplies each packed block with the micro-panels \a jbegin to \a jend of the packed block
+// of \a B. Since the packed block of \a B is only read, several threads can work concurrently on
+// disjoint ranges of rows and columns of the same packed block.
+*/
+template< typename MT1  // Type of the target dense matrix
+        , typename MT2  // Type of the left-hand side matrix operand
+        , typename ET > // Type of the matrix elements
+void mmmBlock( MT1& C, const MT2& A, ET* Ap, const ET* Bp, size_t ibegin, size_t iend,
+               size_t jj, size_t jbegin, size_t jend, size_t kk, size_t kb, ET alpha, ET beta )
+{
+   typedef MMMTrait<ET>  MMMT;
+
+   const size_t MR( MMMT::mr );
+   const size_t NR( MMMT::nr );
+   const size_t mc( MMMT::mc() );
+
+   BLAZE_INTERNAL_ASSERT( jbegin % NR == 0UL, "Invalid column index detected" );
+
+   for( size_t ii=ibegin; ii<iend; ii+=mc )
+   {
+      const size_t mb( min( mc, iend-ii ) );
+
+      packLeftBlock( A, Ap, ii, mb, kk, kb );
+
+      for( size_t j=jbegin; j<jend; j+=NR ) {
+         for( size_t i=0UL; i<mb; i+=MR ) {
+            mmmMicroKernel( C, ii+i, jj+j, min( MR, mb-i ), min( NR, jend-j ), kb,
+                            Ap+i*kb, Bp+j*kb, alpha, beta );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the thread grid of a parallel packed matrix multiplication.
+// \ingroup dense_matrix
+//
+// \param threads The total number of threads.
+// \param m The number of rows of the target matrix.
+// \param n The number of columns of the current packed block of the right-hand side operand.
+// \param rows Returns the number of thread rows of the grid.
+// \param columns Returns the number of thread columns of the grid.
+// \return void
+//
+// In a parallel packed matrix multiplication the threads are arranged in a \a rows x \a columns
+// grid over the \a m x \a n block of the target matrix. Each thread multiplies its range of rows
+// of the left-hand side operand with its range of micro-panels of the shared, packed block of the
+// right-hand side operand. This function selects the factorization of \a threads that minimizes
+// the largest share of work per thread and, among equally balanced grids, the amount of data each
+// thread has to read per packed block (i.e. the sum of its numbers of rows and columns).
+*/
+template< typename ET >  // Type of the matrix elements
+void mmmPartition( size_t threads, size_t m, size_t n, size_t& rows, size_t& columns )
+{
+   const size_t MR( MMMTrait<ET>::mr );
+   const size_t NR( MMMTrait<ET>::nr );
+
+   BLAZE_INTERNAL_ASSERT( threads > 0UL, "Invalid number of threads" );
+
+   size_t work   ( 0UL );
+   size_t traffic( 0UL );
+
+   rows    = threads;
+   columns = 1UL;
+
+   for( size_t tc=1UL; tc<=threads; ++tc )
+   {
+      if( threads % tc != 0UL ) continue;
+
+      const size_t tr( threads / tc );
+      const size_t mb( ( ( m + tr - 1UL ) / tr + MR - 1UL ) / MR * MR );
+      const size_t nb( ( ( n + tc - 1UL ) / tc + NR - 1UL ) / NR * NR );
+
+      if( tc == 1UL || mb*nb < work || ( mb*nb == work && mb+nb < traffic ) ) {
+         rows    = tr;
+         columns = tc;
+         work    = mb*nb;
+         traffic = mb+nb;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packed dense matrix/dense matrix multiplication (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target row-major dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function implements a GotoBLAS-style matrix multiplication: The columns of \a B are
+// processed in blocks of \a nc columns, the inner dimension in blocks of \a kc. Each \a kc x
+// \a nc block of \a B is copied once into contiguous, aligned micro-panels, each \a mc x \a kc
+// block of \a A into micro-panels of \a mr rows. The register-blocked micro-kernel then runs
+// over the packed panels with unit stride. In case \a beta is 0, the initial values of \a C
+// are not read. The function requires that all three matrices have the same, vectorizable
+// element type.
+*/
+template< typename MT1  // Type of the target dense matrix
+        , typename MT2  // Type of the left-hand side matrix operand
+        , typename MT3  // Type of the right-hand side matrix operand
+        , typename ST > // Type of the scaling factors
+void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   typedef typename MT1::ElementType  ET;
+   typedef MMMTrait<ET>               MMMT;
+
+   BLAZE_INTERNAL_ASSERT( (~C).rows()    == A.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~C).columns() == B.columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( A.columns()    == B.rows()   , "Invalid matrix sizes"      );
+
+   const size_t M( A.rows()    );
+   const size_t N( B.columns() );
+   const size_t K( A.columns() );
+
+   if( M == 0UL || N == 0UL ) {
+      return;
+   }
+   else if( K == 0UL ) {
+      for( size_t i=0UL; i<M; ++i ) {
+         for( size_t j=0UL; j<N; ++j ) {
+            if( isDefault( beta ) )
+               reset( (~C)(i,j) );
+            else
+               (~C)(i,j) *= beta;
+         }
+      }
+      return;
+   }
+
+   const size_t MR( MMMT::mr );
+   const size_t NR( MMMT::nr );
+
+   const size_t mc( min( MMMT::mc(), ( ( M + MR - 1UL ) / MR ) * MR ) );
+   const size_t kc( min( MMMT::kc(), K ) );
+   const size_t nc( min( MMMT::nc(), ( ( N + NR - 1UL ) / NR ) * NR ) );
+
+   UniqueArray<ET,Deallocate> Ap( allocate<ET>( mc*kc ) );
+   UniqueArray<ET,Deallocate> Bp( allocate<ET>( kc*nc ) );
+
+   for( size_t jj=0UL; jj<N; jj+=nc )
+   {
+      const size_t nb( min( nc, N-jj ) );
+
+      for( size_t kk=0UL; kk<K; kk+=kc )
+      {
+         const size_t kb( min( kc, K-kk ) );
+         const ET factor( kk == 0UL ? ET( beta ) : ET( 1 ) );
+
+         packRightBlock( B, Bp.get(), kk, kb, jj, nb );
+         mmmBlock( ~C, A, Ap.get(), Bp.get(), 0UL, M, jj, 0UL, nb, kk, kb, ET( alpha ), factor );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packed dense matrix/dense matrix multiplication (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target column-major dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function computes the multiplication for a column-major target matrix as the transpose
+// multiplication \f$ C^T=\alpha*B^T*A^T+\beta*C^T \f$ into the row-major view on \a C.
+*/
+template< typename MT1  // Type of the target dense matrix
+        , typename MT2  // Type of the left-hand side matrix operand
+        , typename MT3  // Type of the right-hand side matrix operand
+        , typename ST > // Type of the scaling factors
+void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   DMatTransposer<MT1,false> tmp( ~C );
+   mmm( tmp, trans( B ), trans( A ), alpha, beta );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
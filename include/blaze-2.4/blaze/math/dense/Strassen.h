@@ -0,0 +1,317 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Strassen.h
+//  \brief Header file for the Strassen-Winograd dense matrix multiplication
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_DENSE_STRASSEN_H_
+#define _BLAZE_MATH_DENSE_STRASSEN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/MMM.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/SubmatrixExprTrait.h>
+#include <blaze/math/views/DenseSubmatrix.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS MMMKERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial leaf kernel of the Strassen-Winograd matrix multiplication.
+// \ingroup dense_matrix
+//
+// The MMMKernel class relays the products at the leaves of the Strassen-Winograd recursion to
+// the serial packed matrix multiplication kernel (see the mmm() function).
+*/
+struct MMMKernel
+{
+   //**********************************************************************************************
+   /*!\brief Computes \f$ C=\alpha*A*B+\beta*C \f$ by means of the packed kernel.
+   //
+   // \param C The target row-major dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param alpha The scaling factor for \f$ A*B \f$.
+   // \param beta The scaling factor for \f$ C \f$.
+   // \return void
+   */
+   template< typename MT1  // Type of the target dense matrix
+           , typename MT2  // Type of the left-hand side matrix operand
+           , typename MT3  // Type of the right-hand side matrix operand
+           , typename ST >  // Type of the scaling factors
+   inline void operator()( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B,
+                           ST alpha, ST beta ) const
+   {
+      mmm( ~C, A, B, alpha, beta );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  STRASSEN-WINOGRAD MATRIX MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether a multiplication of the given size is split by the Strassen-Winograd
+//        algorithm.
+// \ingroup dense_matrix
+//
+// \param m The number of rows of the target matrix.
+// \param n The number of columns of the target matrix.
+// \param k The inner dimension of the multiplication.
+// \return \a true in case the multiplication is split, \a false if not.
+//
+// The multiplication is split in case the Strassen-Winograd algorithm is enabled (see the
+// blaze::DMATDMATMULT_STRASSEN_THRESHOLD setting) and all three dimensions reach the crossover.
+*/
+inline bool useStrassen( size_t m, size_t n, size_t k )
+{
+   return DMATDMATMULT_STRASSEN_THRESHOLD > 0UL &&
+          min( min( m, n ), k ) >= DMATDMATMULT_STRASSEN_THRESHOLD;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Single recursion step of the Strassen-Winograd multiplication (\f$ C=A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target row-major dense submatrix.
+// \param A The left-hand side dense submatrix operand.
+// \param B The right-hand side dense submatrix operand.
+// \param W The workspace of the complete recursion.
+// \param offset The first row of the workspace available to this recursion step.
+// \param kernel The kernel for the products at the leaves of the recursion.
+// \return void
+//
+// This function splits the even-sized core of the multiplication into 2x2 blocks and computes
+// it by means of the seven block products of the Winograd variant of Strassen's algorithm. The
+// schedule only requires two temporaries, an \f$ m \times max(k,n) \f$ block \a X and a
+// \f$ k \times n \f$ block \a Y, which are taken from the rows of \a W starting at \a offset.
+// The remaining products and all temporaries are accumulated in the four blocks of \a C. Odd
+// trailing rows, columns and inner dimensions are handled by the given leaf kernel. All block
+// additions are performed via the serial assign functions.
+*/
+template< typename MT1  // Type of the target submatrix
+        , typename MT2  // Type of the left-hand side submatrix operand
+        , typename MT3  // Type of the right-hand side submatrix operand
+        , typename MT4  // Type of the workspace
+        , typename KT >  // Type of the leaf kernel
+void strassenStep( MT1& C, const MT2& A, const MT3& B, MT4& W, size_t offset, const KT& kernel )
+{
+   typedef typename MT1::ElementType  ET;
+
+   typedef typename SubmatrixExprTrait<MT1,unaligned>::Type        CT;
+   typedef typename SubmatrixExprTrait<const MT2,unaligned>::Type  AT;
+   typedef typename SubmatrixExprTrait<const MT3,unaligned>::Type  BT;
+   typedef typename SubmatrixExprTrait<MT4,unaligned>::Type        WT;
+
+   const size_t M( A.rows()    );
+   const size_t N( B.columns() );
+   const size_t K( A.columns() );
+
+   if( !useStrassen( M, N, K ) ) {
+      kernel( C, A, B, ET(1), ET(0) );
+      return;
+   }
+
+   const size_t m( M / 2UL );
+   const size_t n( N / 2UL );
+   const size_t k( K / 2UL );
+
+   BLAZE_INTERNAL_ASSERT( offset + m + k <= W.rows(), "Invalid workspace size" );
+   BLAZE_INTERNAL_ASSERT( max( k, n ) <= W.columns(), "Invalid workspace size" );
+
+   const AT A11( submatrix( A, 0UL, 0UL, m, k ) );
+   const AT A12( submatrix( A, 0UL, k  , m, k ) );
+   const AT A21( submatrix( A, m  , 0UL, m, k ) );
+   const AT A22( submatrix( A, m  , k  , m, k ) );
+
+   const BT B11( submatrix( B, 0UL, 0UL, k, n ) );
+   const BT B12( submatrix( B, 0UL, n  , k, n ) );
+   const BT B21( submatrix( B, k  , 0UL, k, n ) );
+   const BT B22( submatrix( B, k  , n  , k, n ) );
+
+   CT C11( submatrix( C, 0UL, 0UL, m, n ) );
+   CT C12( submatrix( C, 0UL, n  , m, n ) );
+   CT C21( submatrix( C, m  , 0UL, m, n ) );
+   CT C22( submatrix( C, m  , n  , m, n ) );
+
+   WT X( submatrix( W, offset  , 0UL, m, k ) );
+   WT P( submatrix( W, offset  , 0UL, m, n ) );
+   WT Y( submatrix( W, offset+m, 0UL, k, n ) );
+
+   const size_t next( offset + m + k );
+
+   assign( X, A11 - A21 );                           // S3 = A11 - A21
+   assign( Y, B22 - B12 );                           // T3 = B22 - B12
+   strassenStep( C21, X, Y, W, next, kernel );       // C21 = P7 = S3*T3
+
+   assign( X, A21 + A22 );                           // S1 = A21 + A22
+   assign( Y, B12 - B11 );                           // T1 = B12 - B11
+   strassenStep( C22, X, Y, W, next, kernel );       // C22 = P5 = S1*T1
+
+   subAssign( X, A11 );                              // S2 = S1 - A11
+   assign( Y, B22 - B12 + B11 );                     // T2 = B22 - T1
+   strassenStep( C12, X, Y, W, next, kernel );       // C12 = P6 = S2*T2
+
+   subAssign( X, A12 );                              // X = -S4 = S2 - A12
+   strassenStep( C11, X, B22, W, next, kernel );     // C11 = -P3 = -S4*B22
+
+   strassenStep( P, A11, B11, W, next, kernel );     // P = P1 = A11*B11
+
+   addAssign( C21, C12 + P );                        // C21 = U3 = P7 + P6 + P1
+   addAssign( C12, P + C22 - C11 );                  // C12 = U5 = P6 + P1 + P5 + P3
+   addAssign( C22, C21 );                            // C22 = U7 = U3 + P5
+
+   subAssign( Y, B21 );                              // T4 = T2 - B21
+   strassenStep( C11, A22, Y, W, next, kernel );     // C11 = P4 = A22*T4
+   subAssign( C21, C11 );                            // C21 = U6 = U3 - P4
+
+   strassenStep( C11, A12, B21, W, next, kernel );   // C11 = P2 = A12*B21
+   addAssign( C11, P );                              // C11 = U1 = P1 + P2
+
+   if( K > 2UL*k ) {
+      CT C0( submatrix( C, 0UL, 0UL, 2UL*m, 2UL*n ) );
+      const AT A0( submatrix( A, 0UL, 2UL*k, 2UL*m, K-2UL*k ) );
+      const BT B0( submatrix( B, 2UL*k, 0UL, K-2UL*k, 2UL*n ) );
+      kernel( C0, A0, B0, ET(1), ET(1) );
+   }
+
+   if( N > 2UL*n ) {
+      CT C0( submatrix( C, 0UL, 2UL*n, 2UL*m, N-2UL*n ) );
+      const AT A0( submatrix( A, 0UL, 0UL, 2UL*m, K ) );
+      const BT B0( submatrix( B, 0UL, 2UL*n, K, N-2UL*n ) );
+      kernel( C0, A0, B0, ET(1), ET(0) );
+   }
+
+   if( M > 2UL*m ) {
+      CT C0( submatrix( C, 2UL*m, 0UL, M-2UL*m, N ) );
+      const AT A0( submatrix( A, 2UL*m, 0UL, M-2UL*m, K ) );
+      kernel( C0, A0, B, ET(1), ET(0) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Strassen-Winograd dense matrix/dense matrix multiplication (\f$ C=A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target row-major dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param kernel The kernel for the products at the leaves of the recursion.
+// \return void
+//
+// This function computes the multiplication by means of the recursive Strassen-Winograd
+// algorithm. The recursion stops as soon as one of the dimensions falls below the crossover
+// given by blaze::DMATDMATMULT_STRASSEN_THRESHOLD, the leaves are computed by the given
+// kernel (for instance the serial MMMKernel). The temporaries of all recursion levels are
+// taken from a single workspace that is allocated once up front: Since every level only
+// requires an \f$ m/2 \times max(k/2,n/2) \f$ and a \f$ k/2 \times n/2 \f$ block and the
+// sizes halve from level to level, the workspace is smaller than the two operands. Note that
+// the algorithm is only normwise stable (see the blaze::DMATDMATMULT_STRASSEN_THRESHOLD setting).
+*/
+template< typename MT1  // Type of the target dense matrix
+        , typename MT2  // Type of the left-hand side matrix operand
+        , typename MT3  // Type of the right-hand side matrix operand
+        , typename KT >  // Type of the leaf kernel
+void strassenMmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, const KT& kernel )
+{
+   typedef typename MT1::ElementType  ET;
+
+   typedef typename SubmatrixExprTrait<const MT2,unaligned>::Type  AT;
+   typedef typename SubmatrixExprTrait<const MT3,unaligned>::Type  BT;
+
+   BLAZE_INTERNAL_ASSERT( (~C).rows()    == A.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~C).columns() == B.columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( A.columns()    == B.rows()   , "Invalid matrix sizes"      );
+
+   const size_t M( A.rows()    );
+   const size_t N( B.columns() );
+   const size_t K( A.columns() );
+
+   if( !useStrassen( M, N, K ) ) {
+      kernel( ~C, A, B, ET(1), ET(0) );
+      return;
+   }
+
+   size_t rows( 0UL );
+   for( size_t m=M, n=N, k=K; useStrassen( m, n, k ); m/=2UL, n/=2UL, k/=2UL ) {
+      rows += m/2UL + k/2UL;
+   }
+
+   DynamicMatrix<ET,rowMajor> W( rows, max( K/2UL, N/2UL ) );
+
+   typename SubmatrixExprTrait<MT1,unaligned>::Type Cv( submatrix( ~C, 0UL, 0UL, M, N ) );
+   const AT Av( submatrix( A, 0UL, 0UL, M, K ) );
+   const BT Bv( submatrix( B, 0UL, 0UL, K, N ) );
+
+   strassenStep( Cv, Av, Bv, W, 0UL, kernel );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
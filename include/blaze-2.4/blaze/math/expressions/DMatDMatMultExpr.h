@@ -46,6 +46,8 @@
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/StorageOrder.h>
 #include <blaze/math/constraints/Symmetric.h>
+#include <blaze/math/dense/MMM.h>
+#include <blaze/math/dense/Strassen.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DenseVector.h>
@@ -57,6 +59,9 @@
 #include <blaze/math/Intrinsics.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/MMM.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/traits/ColumnExprTrait.h>
 #include <blaze/math/traits/DMatDVecMultExprTrait.h>
 #include <blaze/math/traits/DMatSVecMultExprTrait.h>
@@ -69,6 +74,7 @@
 #include <blaze/math/typetraits/Columns.h>
 #include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsAdaptor.h>
 #include <blaze/math/typetraits/IsColumnMajorMatrix.h>
 #include <blaze/math/typetraits/IsColumnVector.h>
 #include <blaze/math/typetraits/IsComputation.h>
@@ -80,6 +86,7 @@
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/math/typetraits/IsRowVector.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/IsSparseVector.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
 #include <blaze/math/typetraits/IsStrictlyTriangular.h>
@@ -185,6 +192,23 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The UseTaskGraph struct is a helper struct for the selection of the parallel evaluation
+       strategy. In case both matrix operands require an intermediate evaluation into resizable
+       dense matrices, the two operands are evaluated concurrently and the nested \a value will
+       be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseTaskGraph {
+      enum { value = evaluateLeft && evaluateRight &&
+                     IsEvaluationRequired<T1,T2,T3>::value &&
+                     IsResizable<RT1>::value && !IsAdaptor<RT1>::value &&
+                     IsResizable<RT2>::value && !IsAdaptor<RT2>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper structure for the explicit application of the SFINAE principle.
@@ -302,6 +326,71 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the vectorized default kernel can be used, the target matrix is row-major and
+       neither of the two matrix operands is triangular, the nested \value will be set to 1 and
+       the packed matrix multiplication kernel is selected for large matrices. Otherwise it
+       will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UsePackedKernel {
+      enum { value = UseVectorizedDefaultKernel<T1,T2,T3>::value &&
+                     IsRowMajorMatrix<T1>::value &&
+                     !IsTriangular<T2>::value && !IsTriangular<T3>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the Strassen-Winograd algorithm is enabled (see the DMATDMATMULT_STRASSEN_THRESHOLD
+       setting), the packed matrix multiplication kernel can be used and all three matrices are
+       random access matrices with direct memory access, the nested \value will be set to 1 and
+       the Strassen-Winograd kernel is selected for large matrices. Otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseStrassenKernel {
+      enum { value = DMATDMATMULT_STRASSEN_THRESHOLD > 0UL &&
+                     UsePackedKernel<T1,T2,T3>::value &&
+                     HasMutableDataAccess<T1>::value &&
+                     HasConstDataAccess<T2>::value && HasConstDataAccess<T3>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Leaf kernel of the Strassen-Winograd multiplication within SMP assignments.
+   /*! The SMPKernel relays the products at the leaves of the Strassen-Winograd recursion to the
+       parallel packed matrix multiplication kernel (see the smpMmm() function). */
+   struct SMPKernel {
+      template< typename MT3, typename MT4, typename MT5, typename ST >
+      inline void operator()( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B,
+                              ST alpha, ST beta ) const {
+         smpMmm( ~C, A, B, alpha, beta );
+      }
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case none of the two matrix operands requires an intermediate evaluation, both the
+       target matrix and the expression are SMP-assignable and the packed matrix multiplication
+       kernel can be used, the nested \value will be set to 1 and the parallel packed kernel is
+       selected for the SMP assignment. Otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseSMPPackedKernel {
+      enum { value = !evaluateLeft  && MT1::smpAssignable &&
+                     !evaluateRight && MT2::smpAssignable &&
+                     IsSMPAssignable<T1>::value &&
+                     UsePackedKernel<T1,T2,T3>::value && UseDefaultKernel<T1,T2,T3>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef DMatDMatMultExpr<MT1,MT2>                   This;           //!< Type of this DMatDMatMultExpr instance.
@@ -872,14 +961,14 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 + a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 + a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 + a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 + a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -919,14 +1008,14 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C).store( i    , j             , xmm1 );
@@ -952,10 +1041,10 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -989,10 +1078,10 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i    , j         , xmm1 );
@@ -1014,8 +1103,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j         );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size);
+               xmm1 = fmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
             (~C).store( i, j         , xmm1 );
@@ -1042,8 +1131,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 + set( A(i+1UL,k) ) * b1;
+               xmm1 = fmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
             (~C).store( i    , j, xmm1 );
@@ -1061,7 +1150,7 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + set( A(i,k) ) * B.load(k,j);
+               xmm1 = fmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -1141,6 +1230,58 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Packed assignment to row-major dense matrices (large matrices)******************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Packed assignment of a large dense matrix-dense matrix multiplication
+   //        (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays to the packed, register-blocked matrix multiplication kernel for
+   // large row-major dense matrices (see the mmm() function).
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< And< UsePackedKernel<MT3,MT4,MT5>
+                                       , Not< UseStrassenKernel<MT3,MT4,MT5> > > >::Type
+      selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
+   {
+      mmm( ~C, A, B, ElementType(1), ElementType(0) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Strassen-Winograd assignment to row-major dense matrices (large matrices)*******************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Strassen-Winograd assignment of a large dense matrix-dense matrix multiplication
+   //        (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays to the recursive Strassen-Winograd matrix multiplication for large
+   // row-major dense matrices (see the strassenMmm() function). In case any dimension of the
+   // multiplication is below the DMATDMATMULT_STRASSEN_THRESHOLD, the packed kernel is used.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseStrassenKernel<MT3,MT4,MT5> >::Type
+      selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
+   {
+      strassenMmm( ~C, A, B, MMMKernel() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Vectorized default assignment to row-major dense matrices (large matrices)******************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Vectorized default assignment of a large dense matrix-dense matrix multiplication
@@ -1159,18 +1300,20 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
+   static inline typename EnableIf< And< UseVectorizedDefaultKernel<MT3,MT4,MT5>
+                                       , Not< UsePackedKernel<MT3,MT4,MT5> > > >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
       typedef IntrinsicTrait<ElementType>  IT;
+      typedef MMMTrait<ElementType>        MMMT;
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
       const size_t K( A.columns() );
 
-      const size_t iblock(  64UL );
-      const size_t jblock( 128UL );
-      const size_t kblock( 128UL );
+      const size_t iblock( MMMT::sblock() );
+      const size_t jblock( MMMT::vblock() );
+      const size_t kblock( MMMT::kblock() );
 
       for( size_t jj=0UL; jj<N; jj+=jblock )
       {
@@ -1223,14 +1366,14 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
                         const IntrinsicType b2( B.load(k,j1) );
                         const IntrinsicType b3( B.load(k,j2) );
                         const IntrinsicType b4( B.load(k,j3) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a1 * b2;
-                        xmm3 = xmm3 + a1 * b3;
-                        xmm4 = xmm4 + a1 * b4;
-                        xmm5 = xmm5 + a2 * b1;
-                        xmm6 = xmm6 + a2 * b2;
-                        xmm7 = xmm7 + a2 * b3;
-                        xmm8 = xmm8 + a2 * b4;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a1, b2, xmm2 );
+                        xmm3 = fmadd( a1, b3, xmm3 );
+                        xmm4 = fmadd( a1, b4, xmm4 );
+                        xmm5 = fmadd( a2, b1, xmm5 );
+                        xmm6 = fmadd( a2, b2, xmm6 );
+                        xmm7 = fmadd( a2, b3, xmm7 );
+                        xmm8 = fmadd( a2, b4, xmm8 );
                      }
 
                      (~C).store( i    , j , xmm1 );
@@ -1257,10 +1400,10 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 + a1 * B.load(k,j );
-                        xmm2 = xmm2 + a1 * B.load(k,j1);
-                        xmm3 = xmm3 + a1 * B.load(k,j2);
-                        xmm4 = xmm4 + a1 * B.load(k,j3);
+                        xmm1 = fmadd( a1, B.load(k,j ), xmm1 );
+                        xmm2 = fmadd( a1, B.load(k,j1), xmm2 );
+                        xmm3 = fmadd( a1, B.load(k,j2), xmm3 );
+                        xmm4 = fmadd( a1, B.load(k,j3), xmm4 );
                      }
 
                      (~C).store( i, j , xmm1 );
@@ -1299,14 +1442,14 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
                         const IntrinsicType a4( set( A(i+3UL,k) ) );
                         const IntrinsicType b1( B.load(k,j ) );
                         const IntrinsicType b2( B.load(k,j1) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a1 * b2;
-                        xmm3 = xmm3 + a2 * b1;
-                        xmm4 = xmm4 + a2 * b2;
-                        xmm5 = xmm5 + a3 * b1;
-                        xmm6 = xmm6 + a3 * b2;
-                        xmm7 = xmm7 + a4 * b1;
-                        xmm8 = xmm8 + a4 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a1, b2, xmm2 );
+                        xmm3 = fmadd( a2, b1, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
+                        xmm5 = fmadd( a3, b1, xmm5 );
+                        xmm6 = fmadd( a3, b2, xmm6 );
+                        xmm7 = fmadd( a4, b1, xmm7 );
+                        xmm8 = fmadd( a4, b2, xmm8 );
                      }
 
                      (~C).store( i    , j , xmm1 );
@@ -1336,10 +1479,10 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
                         const IntrinsicType a2( set( A(i+1UL,k) ) );
                         const IntrinsicType b1( B.load(k,j ) );
                         const IntrinsicType b2( B.load(k,j1) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a1 * b2;
-                        xmm3 = xmm3 + a2 * b1;
-                        xmm4 = xmm4 + a2 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a1, b2, xmm2 );
+                        xmm3 = fmadd( a2, b1, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
                      }
 
                      (~C).store( i    , j , xmm1 );
@@ -1360,8 +1503,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 + a1 * B.load(k,j );
-                        xmm2 = xmm2 + a1 * B.load(k,j1);
+                        xmm1 = fmadd( a1, B.load(k,j ), xmm1 );
+                        xmm2 = fmadd( a1, B.load(k,j1), xmm2 );
                      }
 
                      (~C).store( i, j , xmm1 );
@@ -1382,7 +1525,7 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 + a1 * B.load(k,j);
+                        xmm1 = fmadd( a1, B.load(k,j), xmm1 );
                      }
 
                      (~C).store( i, j, xmm1 );
@@ -2009,14 +2152,14 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 + a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 + a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 + a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 + a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -2063,14 +2206,14 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C).store( i    , j             , xmm1 );
@@ -2099,10 +2242,10 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -2139,10 +2282,10 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i    , j         , xmm1 );
@@ -2165,8 +2308,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j         );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size);
+               xmm1 = fmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
             (~C).store( i, j         , xmm1 );
@@ -2194,8 +2337,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 + set( A(i+1UL,k) ) * b1;
+               xmm1 = fmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
             (~C).store( i    , j, xmm1 );
@@ -2213,7 +2356,7 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
             IntrinsicType xmm1( (~C).load(i,j) );
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + set( A(i,k) ) * B.load(k,j);
+               xmm1 = fmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -2294,6 +2437,31 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Packed addition assignment to row-major dense matrices (large matrices)*********************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Packed addition assignment of a large dense matrix-dense matrix multiplication
+   //        (\f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays to the packed, register-blocked matrix multiplication kernel for
+   // large row-major dense matrices (see the mmm() function).
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UsePackedKernel<MT3,MT4,MT5> >::Type
+      selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
+   {
+      mmm( ~C, A, B, ElementType(1), ElementType(1) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Vectorized default addition assignment to row-major dense matrices (large matrices)*********
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Vectorized default addition assignment of a large dense matrix-dense matrix
@@ -2312,18 +2480,20 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
+   static inline typename EnableIf< And< UseVectorizedDefaultKernel<MT3,MT4,MT5>
+                                       , Not< UsePackedKernel<MT3,MT4,MT5> > > >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
       typedef IntrinsicTrait<ElementType>  IT;
+      typedef MMMTrait<ElementType>        MMMT;
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
       const size_t K( A.columns() );
 
-      const size_t iblock(  64UL );
-      const size_t jblock( 128UL );
-      const size_t kblock( 128UL );
+      const size_t iblock( MMMT::sblock() );
+      const size_t jblock( MMMT::vblock() );
+      const size_t kblock( MMMT::kblock() );
 
       for( size_t jj=0UL; jj<N; jj+=jblock )
       {
@@ -2370,14 +2540,14 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
                         const IntrinsicType b2( B.load(k,j1) );
                         const IntrinsicType b3( B.load(k,j2) );
                         const IntrinsicType b4( B.load(k,j3) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a1 * b2;
-                        xmm3 = xmm3 + a1 * b3;
-                        xmm4 = xmm4 + a1 * b4;
-                        xmm5 = xmm5 + a2 * b1;
-                        xmm6 = xmm6 + a2 * b2;
-                        xmm7 = xmm7 + a2 * b3;
-                        xmm8 = xmm8 + a2 * b4;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a1, b2, xmm2 );
+                        xmm3 = fmadd( a1, b3, xmm3 );
+                        xmm4 = fmadd( a1, b4, xmm4 );
+                        xmm5 = fmadd( a2, b1, xmm5 );
+                        xmm6 = fmadd( a2, b2, xmm6 );
+                        xmm7 = fmadd( a2, b3, xmm7 );
+                        xmm8 = fmadd( a2, b4, xmm8 );
                      }
 
                      (~C).store( i    , j , xmm1 );
@@ -2404,10 +2574,10 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 + a1 * B.load(k,j );
-                        xmm2 = xmm2 + a1 * B.load(k,j1);
-                        xmm3 = xmm3 + a1 * B.load(k,j2);
-                        xmm4 = xmm4 + a1 * B.load(k,j3);
+                        xmm1 = fmadd( a1, B.load(k,j ), xmm1 );
+                        xmm2 = fmadd( a1, B.load(k,j1), xmm2 );
+                        xmm3 = fmadd( a1, B.load(k,j2), xmm3 );
+                        xmm4 = fmadd( a1, B.load(k,j3), xmm4 );
                      }
 
                      (~C).store( i, j , xmm1 );
@@ -2446,14 +2616,14 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
                         const IntrinsicType a4( set( A(i+3UL,k) ) );
                         const IntrinsicType b1( B.load(k,j ) );
                         const IntrinsicType b2( B.load(k,j1) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a1 * b2;
-                        xmm3 = xmm3 + a2 * b1;
-                        xmm4 = xmm4 + a2 * b2;
-                        xmm5 = xmm5 + a3 * b1;
-                        xmm6 = xmm6 + a3 * b2;
-                        xmm7 = xmm7 + a4 * b1;
-                        xmm8 = xmm8 + a4 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a1, b2, xmm2 );
+                        xmm3 = fmadd( a2, b1, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
+                        xmm5 = fmadd( a3, b1, xmm5 );
+                        xmm6 = fmadd( a3, b2, xmm6 );
+                        xmm7 = fmadd( a4, b1, xmm7 );
+                        xmm8 = fmadd( a4, b2, xmm8 );
                      }
 
                      (~C).store( i    , j , xmm1 );
@@ -2483,10 +2653,10 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
                         const IntrinsicType a2( set( A(i+1UL,k) ) );
                         const IntrinsicType b1( B.load(k,j ) );
                         const IntrinsicType b2( B.load(k,j1) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a1 * b2;
-                        xmm3 = xmm3 + a2 * b1;
-                        xmm4 = xmm4 + a2 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a1, b2, xmm2 );
+                        xmm3 = fmadd( a2, b1, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
                      }
 
                      (~C).store( i    , j , xmm1 );
@@ -2507,8 +2677,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 + a1 * B.load(k,j );
-                        xmm2 = xmm2 + a1 * B.load(k,j1);
+                        xmm1 = fmadd( a1, B.load(k,j ), xmm1 );
+                        xmm2 = fmadd( a1, B.load(k,j1), xmm2 );
                      }
 
                      (~C).store( i, j , xmm1 );
@@ -2529,7 +2699,7 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 + a1 * B.load(k,j);
+                        xmm1 = fmadd( a1, B.load(k,j), xmm1 );
                      }
 
                      (~C).store( i, j, xmm1 );
@@ -3131,14 +3301,14 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 - a1 * B.load(k,j             );
-               xmm2 = xmm2 - a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 - a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 - a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 - a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 - a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 - a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 - a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fnmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fnmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fnmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fnmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fnmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fnmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fnmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fnmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -3185,14 +3355,14 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 - a1 * b1;
-               xmm2 = xmm2 - a1 * b2;
-               xmm3 = xmm3 - a1 * b3;
-               xmm4 = xmm4 - a1 * b4;
-               xmm5 = xmm5 - a2 * b1;
-               xmm6 = xmm6 - a2 * b2;
-               xmm7 = xmm7 - a2 * b3;
-               xmm8 = xmm8 - a2 * b4;
+               xmm1 = fnmadd( a1, b1, xmm1 );
+               xmm2 = fnmadd( a1, b2, xmm2 );
+               xmm3 = fnmadd( a1, b3, xmm3 );
+               xmm4 = fnmadd( a1, b4, xmm4 );
+               xmm5 = fnmadd( a2, b1, xmm5 );
+               xmm6 = fnmadd( a2, b2, xmm6 );
+               xmm7 = fnmadd( a2, b3, xmm7 );
+               xmm8 = fnmadd( a2, b4, xmm8 );
             }
 
             (~C).store( i    , j             , xmm1 );
@@ -3221,10 +3391,10 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 - a1 * B.load(k,j             );
-               xmm2 = xmm2 - a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 - a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 - a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fnmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fnmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fnmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fnmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -3261,10 +3431,10 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 - a1 * b1;
-               xmm2 = xmm2 - a1 * b2;
-               xmm3 = xmm3 - a2 * b1;
-               xmm4 = xmm4 - a2 * b2;
+               xmm1 = fnmadd( a1, b1, xmm1 );
+               xmm2 = fnmadd( a1, b2, xmm2 );
+               xmm3 = fnmadd( a2, b1, xmm3 );
+               xmm4 = fnmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i    , j         , xmm1 );
@@ -3287,8 +3457,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 - a1 * B.load(k,j         );
-               xmm2 = xmm2 - a1 * B.load(k,j+IT::size);
+               xmm1 = fnmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fnmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
             (~C).store( i, j         , xmm1 );
@@ -3316,8 +3486,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 - set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 - set( A(i+1UL,k) ) * b1;
+               xmm1 = fnmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fnmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
             (~C).store( i    , j, xmm1 );
@@ -3335,7 +3505,7 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
             IntrinsicType xmm1( (~C).load(i,j) );
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 - set( A(i,k) ) * B.load(k,j);
+               xmm1 = fnmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -3416,6 +3586,31 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Packed subtraction assignment to row-major dense matrices (large matrices)******************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Packed subtraction assignment of a large dense matrix-dense matrix multiplication
+   //        (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays to the packed, register-blocked matrix multiplication kernel for
+   // large row-major dense matrices (see the mmm() function).
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UsePackedKernel<MT3,MT4,MT5> >::Type
+      selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
+   {
+      mmm( ~C, A, B, ElementType(-1), ElementType(1) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Vectorized default subtraction assignment to row-major dense matrices (large matrices)******
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Vectorized default subtraction assignment of a large dense matrix-dense matrix
@@ -3434,18 +3629,20 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
+   static inline typename EnableIf< And< UseVectorizedDefaultKernel<MT3,MT4,MT5>
+                                       , Not< UsePackedKernel<MT3,MT4,MT5> > > >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
       typedef IntrinsicTrait<ElementType>  IT;
+      typedef MMMTrait<ElementType>        MMMT;
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
       const size_t K( A.columns() );
 
-      const size_t iblock(  64UL );
-      const size_t jblock( 128UL );
-      const size_t kblock( 128UL );
+      const size_t iblock( MMMT::sblock() );
+      const size_t jblock( MMMT::vblock() );
+      const size_t kblock( MMMT::kblock() );
 
       for( size_t jj=0UL; jj<N; jj+=jblock )
       {
@@ -3492,14 +3689,14 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
                         const IntrinsicType b2( B.load(k,j1) );
                         const IntrinsicType b3( B.load(k,j2) );
                         const IntrinsicType b4( B.load(k,j3) );
-                        xmm1 = xmm1 - a1 * b1;
-                        xmm2 = xmm2 - a1 * b2;
-                        xmm3 = xmm3 - a1 * b3;
-                        xmm4 = xmm4 - a1 * b4;
-                        xmm5 = xmm5 - a2 * b1;
-                        xmm6 = xmm6 - a2 * b2;
-                        xmm7 = xmm7 - a2 * b3;
-                        xmm8 = xmm8 - a2 * b4;
+                        xmm1 = fnmadd( a1, b1, xmm1 );
+                        xmm2 = fnmadd( a1, b2, xmm2 );
+                        xmm3 = fnmadd( a1, b3, xmm3 );
+                        xmm4 = fnmadd( a1, b4, xmm4 );
+                        xmm5 = fnmadd( a2, b1, xmm5 );
+                        xmm6 = fnmadd( a2, b2, xmm6 );
+                        xmm7 = fnmadd( a2, b3, xmm7 );
+                        xmm8 = fnmadd( a2, b4, xmm8 );
                      }
 
                      (~C).store( i    , j , xmm1 );
@@ -3526,10 +3723,10 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 - a1 * B.load(k,j );
-                        xmm2 = xmm2 - a1 * B.load(k,j1);
-                        xmm3 = xmm3 - a1 * B.load(k,j2);
-                        xmm4 = xmm4 - a1 * B.load(k,j3);
+                        xmm1 = fnmadd( a1, B.load(k,j ), xmm1 );
+                        xmm2 = fnmadd( a1, B.load(k,j1), xmm2 );
+                        xmm3 = fnmadd( a1, B.load(k,j2), xmm3 );
+                        xmm4 = fnmadd( a1, B.load(k,j3), xmm4 );
                      }
 
                      (~C).store( i, j , xmm1 );
@@ -3568,14 +3765,14 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
                         const IntrinsicType a4( set( A(i+3UL,k) ) );
                         const IntrinsicType b1( B.load(k,j ) );
                         const IntrinsicType b2( B.load(k,j1) );
-                        xmm1 = xmm1 - a1 * b1;
-                        xmm2 = xmm2 - a1 * b2;
-                        xmm3 = xmm3 - a2 * b1;
-                        xmm4 = xmm4 - a2 * b2;
-                        xmm5 = xmm5 - a3 * b1;
-                        xmm6 = xmm6 - a3 * b2;
-                        xmm7 = xmm7 - a4 * b1;
-                        xmm8 = xmm8 - a4 * b2;
+                        xmm1 = fnmadd( a1, b1, xmm1 );
+                        xmm2 = fnmadd( a1, b2, xmm2 );
+                        xmm3 = fnmadd( a2, b1, xmm3 );
+                        xmm4 = fnmadd( a2, b2, xmm4 );
+                        xmm5 = fnmadd( a3, b1, xmm5 );
+                        xmm6 = fnmadd( a3, b2, xmm6 );
+                        xmm7 = fnmadd( a4, b1, xmm7 );
+                        xmm8 = fnmadd( a4, b2, xmm8 );
                      }
 
                      (~C).store( i    , j , xmm1 );
@@ -3605,10 +3802,10 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
                         const IntrinsicType a2( set( A(i+1UL,k) ) );
                         const IntrinsicType b1( B.load(k,j ) );
                         const IntrinsicType b2( B.load(k,j1) );
-                        xmm1 = xmm1 - a1 * b1;
-                        xmm2 = xmm2 - a1 * b2;
-                        xmm3 = xmm3 - a2 * b1;
-                        xmm4 = xmm4 - a2 * b2;
+                        xmm1 = fnmadd( a1, b1, xmm1 );
+                        xmm2 = fnmadd( a1, b2, xmm2 );
+                        xmm3 = fnmadd( a2, b1, xmm3 );
+                        xmm4 = fnmadd( a2, b2, xmm4 );
                      }
 
                      (~C).store( i    , j , xmm1 );
@@ -3629,8 +3826,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 - a1 * B.load(k,j );
-                        xmm2 = xmm2 - a1 * B.load(k,j1);
+                        xmm1 = fnmadd( a1, B.load(k,j ), xmm1 );
+                        xmm2 = fnmadd( a1, B.load(k,j1), xmm2 );
                      }
 
                      (~C).store( i, j , xmm1 );
@@ -3651,7 +3848,7 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 - a1 * B.load(k,j);
+                        xmm1 = fnmadd( a1, B.load(k,j), xmm1 );
                      }
 
                      (~C).store( i, j, xmm1 );
@@ -3943,7 +4140,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    */
    template< typename MT  // Type of the target dense matrix
            , bool SO >    // Storage order of the target dense matrix
-   friend inline typename EnableIf< IsEvaluationRequired<MT,MT1,MT2> >::Type
+   friend inline typename EnableIf< And< IsEvaluationRequired<MT,MT1,MT2>
+                                       , Not< UseTaskGraph<MT,MT1,MT2> > > >::Type
       smpAssign( DenseMatrix<MT,SO>& lhs, const DMatDMatMultExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
@@ -3974,6 +4172,141 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP assignment to dense matrices (task graph)***********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a dense matrix-dense matrix multiplication with evaluated operands to
+   //        a dense matrix (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a dense matrix-dense matrix
+   // multiplication expression to a dense matrix in case both matrix operands require an
+   // intermediate evaluation. The two operands are evaluated concurrently (see the
+   // smpConcurrentAssign() function) before the multiplication of the two temporaries is
+   // computed by the parallel multiplication kernel.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline typename EnableIf< UseTaskGraph<MT,MT1,MT2> >::Type
+      smpAssign( DenseMatrix<MT,SO>& lhs, const DMatDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( (~lhs).rows() == 0UL || (~lhs).columns() == 0UL ) {
+         return;
+      }
+      else if( rhs.lhs_.columns() == 0UL ) {
+         reset( ~lhs );
+         return;
+      }
+
+      RT1 A( rhs.lhs_.rows(), rhs.lhs_.columns() );  // Evaluation of the left-hand side dense matrix operand
+      RT2 B( rhs.rhs_.rows(), rhs.rhs_.columns() );  // Evaluation of the right-hand side dense matrix operand
+
+      smpConcurrentAssign( A, rhs.lhs_, B, rhs.rhs_ );
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns(), "Invalid number of columns" );
+
+      smpAssign( ~lhs, A * B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to dense matrices (packed kernel)*********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a large dense matrix-dense matrix multiplication to a dense
+   //        matrix (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the SMP assignment of a dense matrix-dense matrix multiplication
+   // expression to a row-major dense matrix by means of the parallel packed matrix multiplication
+   // kernel (see the smpMmm() function), in which all threads share the packed blocks of the
+   // right-hand side operand. Due to the explicit application of the SFINAE principle this
+   // function can only be selected by the compiler in case the packed kernel can be used and
+   // none of the two matrix operands requires an intermediate evaluation.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline typename EnableIf< UseSMPPackedKernel<MT,MT1,MT2> >::Type
+      smpAssign( DenseMatrix<MT,SO>& lhs, const DMatDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      BLAZE_PARALLEL_SECTION
+      {
+         if( isSerialSectionActive() || !rhs.canSMPAssign() ||
+             (~lhs).rows() * (~lhs).columns() < DMATDMATMULT_THRESHOLD ) {
+            assign( ~lhs, rhs );
+         }
+         else {
+            selectSMPPackedAssignKernel( ~lhs, rhs.lhs_, rhs.rhs_ );
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP packed assignment to dense matrices (kernel selection)**********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Selection of the parallel packed kernel for an SMP assignment of a large dense
+   //        matrix-dense matrix multiplication to a dense matrix (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename DisableIf< UseStrassenKernel<MT3,MT4,MT5> >::Type
+      selectSMPPackedAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      smpMmm( C, A, B, ElementType(1), ElementType(0) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP Strassen-Winograd assignment to dense matrices******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Selection of the Strassen-Winograd kernel for an SMP assignment of a large dense
+   //        matrix-dense matrix multiplication to a dense matrix (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays to the Strassen-Winograd matrix multiplication, whose leaves are
+   // computed by the parallel packed kernel (see the strassenMmm() and smpMmm() functions).
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseStrassenKernel<MT3,MT4,MT5> >::Type
+      selectSMPPackedAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      strassenMmm( C, A, B, SMPKernel() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to sparse matrices***********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP assignment of a dense matrix-dense matrix multiplication to a sparse matrix
@@ -4095,6 +4428,47 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP addition assignment to dense matrices (packed kernel)************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a large dense matrix-dense matrix multiplication to a dense
+   //        matrix (\f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the SMP addition assignment of a dense matrix-dense matrix multiplication
+   // expression to a row-major dense matrix by means of the parallel packed matrix multiplication
+   // kernel (see the smpMmm() function), in which all threads share the packed blocks of the
+   // right-hand side operand. Due to the explicit application of the SFINAE principle this
+   // function can only be selected by the compiler in case the packed kernel can be used and
+   // none of the two matrix operands requires an intermediate evaluation.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline typename EnableIf< UseSMPPackedKernel<MT,MT1,MT2> >::Type
+      smpAddAssign( DenseMatrix<MT,SO>& lhs, const DMatDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      BLAZE_PARALLEL_SECTION
+      {
+         if( isSerialSectionActive() || !rhs.canSMPAssign() ||
+             (~lhs).rows() * (~lhs).columns() < DMATDMATMULT_THRESHOLD ) {
+            addAssign( ~lhs, rhs );
+         }
+         else {
+            smpMmm( ~lhs, rhs.lhs_, rhs.rhs_, ElementType(1), ElementType(1) );
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Restructuring SMP addition assignment to column-major matrices******************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Restructuring SMP addition assignment of a dense matrix-dense matrix multiplication
@@ -4180,6 +4554,47 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP subtraction assignment to dense matrices (packed kernel)*********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a large dense matrix-dense matrix multiplication to a dense
+   //        matrix (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the SMP subtraction assignment of a dense matrix-dense matrix multiplication
+   // expression to a row-major dense matrix by means of the parallel packed matrix multiplication
+   // kernel (see the smpMmm() function), in which all threads share the packed blocks of the
+   // right-hand side operand. Due to the explicit application of the SFINAE principle this
+   // function can only be selected by the compiler in case the packed kernel can be used and
+   // none of the two matrix operands requires an intermediate evaluation.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline typename EnableIf< UseSMPPackedKernel<MT,MT1,MT2> >::Type
+      smpSubAssign( DenseMatrix<MT,SO>& lhs, const DMatDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      BLAZE_PARALLEL_SECTION
+      {
+         if( isSerialSectionActive() || !rhs.canSMPAssign() ||
+             (~lhs).rows() * (~lhs).columns() < DMATDMATMULT_THRESHOLD ) {
+            subAssign( ~lhs, rhs );
+         }
+         else {
+            smpMmm( ~lhs, rhs.lhs_, rhs.rhs_, ElementType(-1), ElementType(1) );
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Restructuring SMP subtraction assignment to column-major matrices***************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Restructuring SMP subtraction assignment of a dense matrix-dense matrix multiplication
@@ -4423,6 +4838,35 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the vectorized default kernel can be used, the target matrix is row-major and
+       neither of the two matrix operands is triangular, the nested \value will be set to 1 and
+       the packed matrix multiplication kernel is selected for large matrices. Otherwise it
+       will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   struct UsePackedKernel {
+      enum { value = UseVectorizedDefaultKernel<T1,T2,T3,T4>::value &&
+                     IsRowMajorMatrix<T1>::value &&
+                     !IsTriangular<T2>::value && !IsTriangular<T3>::value };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case none of the two matrix operands requires an intermediate evaluation, both the
+       target matrix and the expression are SMP-assignable and the packed matrix multiplication
+       kernel can be used, the nested \value will be set to 1 and the parallel packed kernel is
+       selected for the SMP assignment. Otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   struct UseSMPPackedKernel {
+      enum { value = !evaluateLeft  && MT1::smpAssignable &&
+                     !evaluateRight && MT2::smpAssignable &&
+                     IsSMPAssignable<T1>::value &&
+                     UsePackedKernel<T1,T2,T3,T4>::value && UseDefaultKernel<T1,T2,T3,T4>::value };
+   };
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef DMatScalarMultExpr<MMM,ST,false>            This;           //!< Type of this DMatScalarMultExpr instance.
@@ -4971,14 +5415,14 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 + a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 + a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 + a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 + a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
             (~C).store( i, j             , xmm1 * factor );
@@ -5018,14 +5462,14 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C).store( i    , j             , xmm1 * factor );
@@ -5051,10 +5495,10 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
             (~C).store( i, j             , xmm1 * factor );
@@ -5088,10 +5532,10 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i    , j         , xmm1 * factor );
@@ -5113,8 +5557,8 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j         );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size);
+               xmm1 = fmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
             (~C).store( i, j         , xmm1 * factor );
@@ -5141,8 +5585,8 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 + set( A(i+1UL,k) ) * b1;
+               xmm1 = fmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
             (~C).store( i    , j, xmm1 * factor );
@@ -5160,7 +5604,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + set( A(i,k) ) * B.load(k,j);
+               xmm1 = fmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
             (~C).store( i, j, xmm1 * factor );
@@ -5240,6 +5684,31 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    }
    //**********************************************************************************************
 
+   //**Packed assignment to row-major dense matrices (large matrices)******************************
+   /*!\brief Packed assignment of a large scaled dense matrix-dense matrix multiplication
+   //        (\f$ C=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function relays to the packed, register-blocked matrix multiplication kernel for
+   // large row-major dense matrices (see the mmm() function).
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline typename EnableIf< UsePackedKernel<MT3,MT4,MT5,ST2> >::Type
+      selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
+   {
+      mmm( ~C, A, B, scalar, ElementType(0) );
+   }
+   //**********************************************************************************************
+
    //**Vectorized default assignment to row-major dense matrices (large matrices)******************
    /*!\brief Vectorized default assignment of a large scaled dense matrix-dense matrix
    //        multiplication (\f$ C=s*A*B \f$).
@@ -5259,18 +5728,20 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5    // Type of the right-hand side matrix operand
            , typename ST2 >  // Type of the scalar value
-   static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
+   static inline typename EnableIf< And< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2>
+                                       , Not< UsePackedKernel<MT3,MT4,MT5,ST2> > > >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       typedef IntrinsicTrait<ElementType>  IT;
+      typedef MMMTrait<ElementType>        MMMT;
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
       const size_t K( A.columns() );
 
-      const size_t iblock(  64UL );
-      const size_t jblock( 128UL );
-      const size_t kblock( 128UL );
+      const size_t iblock( MMMT::sblock() );
+      const size_t jblock( MMMT::vblock() );
+      const size_t kblock( MMMT::kblock() );
 
       const IntrinsicType factor( set( scalar ) );
 
@@ -5325,14 +5796,14 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
                         const IntrinsicType b2( B.load(k,j1) );
                         const IntrinsicType b3( B.load(k,j2) );
                         const IntrinsicType b4( B.load(k,j3) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a1 * b2;
-                        xmm3 = xmm3 + a1 * b3;
-                        xmm4 = xmm4 + a1 * b4;
-                        xmm5 = xmm5 + a2 * b1;
-                        xmm6 = xmm6 + a2 * b2;
-                        xmm7 = xmm7 + a2 * b3;
-                        xmm8 = xmm8 + a2 * b4;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a1, b2, xmm2 );
+                        xmm3 = fmadd( a1, b3, xmm3 );
+                        xmm4 = fmadd( a1, b4, xmm4 );
+                        xmm5 = fmadd( a2, b1, xmm5 );
+                        xmm6 = fmadd( a2, b2, xmm6 );
+                        xmm7 = fmadd( a2, b3, xmm7 );
+                        xmm8 = fmadd( a2, b4, xmm8 );
                      }
 
                      (~C).store( i    , j , xmm1 * factor );
@@ -5359,10 +5830,10 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 + a1 * B.load(k,j );
-                        xmm2 = xmm2 + a1 * B.load(k,j1);
-                        xmm3 = xmm3 + a1 * B.load(k,j2);
-                        xmm4 = xmm4 + a1 * B.load(k,j3);
+                        xmm1 = fmadd( a1, B.load(k,j ), xmm1 );
+                        xmm2 = fmadd( a1, B.load(k,j1), xmm2 );
+                        xmm3 = fmadd( a1, B.load(k,j2), xmm3 );
+                        xmm4 = fmadd( a1, B.load(k,j3), xmm4 );
                      }
 
                      (~C).store( i, j , xmm1 * factor );
@@ -5401,14 +5872,14 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
                         const IntrinsicType a4( set( A(i+3UL,k) ) );
                         const IntrinsicType b1( B.load(k,j ) );
                         const IntrinsicType b2( B.load(k,j1) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a1 * b2;
-                        xmm3 = xmm3 + a2 * b1;
-                        xmm4 = xmm4 + a2 * b2;
-                        xmm5 = xmm5 + a3 * b1;
-                        xmm6 = xmm6 + a3 * b2;
-                        xmm7 = xmm7 + a4 * b1;
-                        xmm8 = xmm8 + a4 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a1, b2, xmm2 );
+                        xmm3 = fmadd( a2, b1, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
+                        xmm5 = fmadd( a3, b1, xmm5 );
+                        xmm6 = fmadd( a3, b2, xmm6 );
+                        xmm7 = fmadd( a4, b1, xmm7 );
+                        xmm8 = fmadd( a4, b2, xmm8 );
                      }
 
                      (~C).store( i    , j , xmm1 * factor );
@@ -5438,10 +5909,10 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
                         const IntrinsicType a2( set( A(i+1UL,k) ) );
                         const IntrinsicType b1( B.load(k,j ) );
                         const IntrinsicType b2( B.load(k,j1) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a1 * b2;
-                        xmm3 = xmm3 + a2 * b1;
-                        xmm4 = xmm4 + a2 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a1, b2, xmm2 );
+                        xmm3 = fmadd( a2, b1, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
                      }
 
                      (~C).store( i    , j , xmm1 * factor );
@@ -5462,8 +5933,8 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 + a1 * B.load(k,j );
-                        xmm2 = xmm2 + a1 * B.load(k,j1);
+                        xmm1 = fmadd( a1, B.load(k,j ), xmm1 );
+                        xmm2 = fmadd( a1, B.load(k,j1), xmm2 );
                      }
 
                      (~C).store( i, j , xmm1 * factor );
@@ -5484,7 +5955,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 + a1 * B.load(k,j);
+                        xmm1 = fmadd( a1, B.load(k,j), xmm1 );
                      }
 
                      (~C).store( i, j, xmm1 * factor );
@@ -6073,24 +6544,24 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 + a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 + a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 + a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 + a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
-            (~C).store( i, j             , (~C).load(i,j             ) + xmm1 * factor );
-            (~C).store( i, j+IT::size    , (~C).load(i,j+IT::size    ) + xmm2 * factor );
-            (~C).store( i, j+IT::size*2UL, (~C).load(i,j+IT::size*2UL) + xmm3 * factor );
-            (~C).store( i, j+IT::size*3UL, (~C).load(i,j+IT::size*3UL) + xmm4 * factor );
-            (~C).store( i, j+IT::size*4UL, (~C).load(i,j+IT::size*4UL) + xmm5 * factor );
-            (~C).store( i, j+IT::size*5UL, (~C).load(i,j+IT::size*5UL) + xmm6 * factor );
-            (~C).store( i, j+IT::size*6UL, (~C).load(i,j+IT::size*6UL) + xmm7 * factor );
-            (~C).store( i, j+IT::size*7UL, (~C).load(i,j+IT::size*7UL) + xmm8 * factor );
+            (~C).store( i, j             , fmadd( xmm1, factor, (~C).load(i,j             ) ) );
+            (~C).store( i, j+IT::size    , fmadd( xmm2, factor, (~C).load(i,j+IT::size    ) ) );
+            (~C).store( i, j+IT::size*2UL, fmadd( xmm3, factor, (~C).load(i,j+IT::size*2UL) ) );
+            (~C).store( i, j+IT::size*3UL, fmadd( xmm4, factor, (~C).load(i,j+IT::size*3UL) ) );
+            (~C).store( i, j+IT::size*4UL, fmadd( xmm5, factor, (~C).load(i,j+IT::size*4UL) ) );
+            (~C).store( i, j+IT::size*5UL, fmadd( xmm6, factor, (~C).load(i,j+IT::size*5UL) ) );
+            (~C).store( i, j+IT::size*6UL, fmadd( xmm7, factor, (~C).load(i,j+IT::size*6UL) ) );
+            (~C).store( i, j+IT::size*7UL, fmadd( xmm8, factor, (~C).load(i,j+IT::size*7UL) ) );
          }
       }
 
@@ -6120,24 +6591,24 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
-            (~C).store( i    , j             , (~C).load(i    ,j             ) + xmm1 * factor );
-            (~C).store( i    , j+IT::size    , (~C).load(i    ,j+IT::size    ) + xmm2 * factor );
-            (~C).store( i    , j+IT::size*2UL, (~C).load(i    ,j+IT::size*2UL) + xmm3 * factor );
-            (~C).store( i    , j+IT::size*3UL, (~C).load(i    ,j+IT::size*3UL) + xmm4 * factor );
-            (~C).store( i+1UL, j             , (~C).load(i+1UL,j             ) + xmm5 * factor );
-            (~C).store( i+1UL, j+IT::size    , (~C).load(i+1UL,j+IT::size    ) + xmm6 * factor );
-            (~C).store( i+1UL, j+IT::size*2UL, (~C).load(i+1UL,j+IT::size*2UL) + xmm7 * factor );
-            (~C).store( i+1UL, j+IT::size*3UL, (~C).load(i+1UL,j+IT::size*3UL) + xmm8 * factor );
+            (~C).store( i    , j             , fmadd( xmm1, factor, (~C).load(i    ,j             ) ) );
+            (~C).store( i    , j+IT::size    , fmadd( xmm2, factor, (~C).load(i    ,j+IT::size    ) ) );
+            (~C).store( i    , j+IT::size*2UL, fmadd( xmm3, factor, (~C).load(i    ,j+IT::size*2UL) ) );
+            (~C).store( i    , j+IT::size*3UL, fmadd( xmm4, factor, (~C).load(i    ,j+IT::size*3UL) ) );
+            (~C).store( i+1UL, j             , fmadd( xmm5, factor, (~C).load(i+1UL,j             ) ) );
+            (~C).store( i+1UL, j+IT::size    , fmadd( xmm6, factor, (~C).load(i+1UL,j+IT::size    ) ) );
+            (~C).store( i+1UL, j+IT::size*2UL, fmadd( xmm7, factor, (~C).load(i+1UL,j+IT::size*2UL) ) );
+            (~C).store( i+1UL, j+IT::size*3UL, fmadd( xmm8, factor, (~C).load(i+1UL,j+IT::size*3UL) ) );
          }
 
          if( i < M )
@@ -6153,16 +6624,16 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
-            (~C).store( i, j             , (~C).load(i,j             ) + xmm1 * factor );
-            (~C).store( i, j+IT::size    , (~C).load(i,j+IT::size    ) + xmm2 * factor );
-            (~C).store( i, j+IT::size*2UL, (~C).load(i,j+IT::size*2UL) + xmm3 * factor );
-            (~C).store( i, j+IT::size*3UL, (~C).load(i,j+IT::size*3UL) + xmm4 * factor );
+            (~C).store( i, j             , fmadd( xmm1, factor, (~C).load(i,j             ) ) );
+            (~C).store( i, j+IT::size    , fmadd( xmm2, factor, (~C).load(i,j+IT::size    ) ) );
+            (~C).store( i, j+IT::size*2UL, fmadd( xmm3, factor, (~C).load(i,j+IT::size*2UL) ) );
+            (~C).store( i, j+IT::size*3UL, fmadd( xmm4, factor, (~C).load(i,j+IT::size*3UL) ) );
          }
       }
 
@@ -6190,16 +6661,16 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
-            (~C).store( i    , j         , (~C).load(i    ,j         ) + xmm1 * factor );
-            (~C).store( i    , j+IT::size, (~C).load(i    ,j+IT::size) + xmm2 * factor );
-            (~C).store( i+1UL, j         , (~C).load(i+1UL,j         ) + xmm3 * factor );
-            (~C).store( i+1UL, j+IT::size, (~C).load(i+1UL,j+IT::size) + xmm4 * factor );
+            (~C).store( i    , j         , fmadd( xmm1, factor, (~C).load(i    ,j         ) ) );
+            (~C).store( i    , j+IT::size, fmadd( xmm2, factor, (~C).load(i    ,j+IT::size) ) );
+            (~C).store( i+1UL, j         , fmadd( xmm3, factor, (~C).load(i+1UL,j         ) ) );
+            (~C).store( i+1UL, j+IT::size, fmadd( xmm4, factor, (~C).load(i+1UL,j+IT::size) ) );
          }
 
          if( i < M )
@@ -6215,12 +6686,12 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j         );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size);
+               xmm1 = fmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
-            (~C).store( i, j         , (~C).load(i,j         ) + xmm1 * factor );
-            (~C).store( i, j+IT::size, (~C).load(i,j+IT::size) + xmm2 * factor );
+            (~C).store( i, j         , fmadd( xmm1, factor, (~C).load(i,j         ) ) );
+            (~C).store( i, j+IT::size, fmadd( xmm2, factor, (~C).load(i,j+IT::size) ) );
          }
       }
 
@@ -6243,12 +6714,12 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 + set( A(i+1UL,k) ) * b1;
+               xmm1 = fmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
-            (~C).store( i    , j, (~C).load(i    ,j) + xmm1 * factor );
-            (~C).store( i+1UL, j, (~C).load(i+1UL,j) + xmm2 * factor );
+            (~C).store( i    , j, fmadd( xmm1, factor, (~C).load(i    ,j) ) );
+            (~C).store( i+1UL, j, fmadd( xmm2, factor, (~C).load(i+1UL,j) ) );
          }
 
          if( i < M )
@@ -6262,10 +6733,10 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + set( A(i,k) ) * B.load(k,j);
+               xmm1 = fmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
-            (~C).store( i, j, (~C).load(i,j) + xmm1 * factor );
+            (~C).store( i, j, fmadd( xmm1, factor, (~C).load(i,j) ) );
          }
       }
    }
@@ -6342,6 +6813,31 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    }
    //**********************************************************************************************
 
+   //**Packed addition assignment to row-major dense matrices (large matrices)*********************
+   /*!\brief Packed addition assignment of a large scaled dense matrix-dense matrix multiplication
+   //        (\f$ C+=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function relays to the packed, register-blocked matrix multiplication kernel for
+   // large row-major dense matrices (see the mmm() function).
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline typename EnableIf< UsePackedKernel<MT3,MT4,MT5,ST2> >::Type
+      selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
+   {
+      mmm( ~C, A, B, scalar, ElementType(1) );
+   }
+   //**********************************************************************************************
+
    //**Vectorized default addition assignment to row-major dense matrices (large matrices)*********
    /*!\brief Vectorized default addition assignment of a large scaled dense matrix-dense matrix
    //        multiplication (\f$ C+=s*A*B \f$).
@@ -6361,18 +6857,20 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5    // Type of the right-hand side matrix operand
            , typename ST2 >  // Type of the scalar value
-   static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
+   static inline typename EnableIf< And< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2>
+                                       , Not< UsePackedKernel<MT3,MT4,MT5,ST2> > > >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       typedef IntrinsicTrait<ElementType>  IT;
+      typedef MMMTrait<ElementType>        MMMT;
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
       const size_t K( A.columns() );
 
-      const size_t iblock(  64UL );
-      const size_t jblock( 128UL );
-      const size_t kblock( 128UL );
+      const size_t iblock( MMMT::sblock() );
+      const size_t jblock( MMMT::vblock() );
+      const size_t kblock( MMMT::kblock() );
 
       const IntrinsicType factor( set( scalar ) );
 
@@ -6414,24 +6912,24 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
                         const IntrinsicType b2( B.load(k,j1) );
                         const IntrinsicType b3( B.load(k,j2) );
                         const IntrinsicType b4( B.load(k,j3) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a1 * b2;
-                        xmm3 = xmm3 + a1 * b3;
-                        xmm4 = xmm4 + a1 * b4;
-                        xmm5 = xmm5 + a2 * b1;
-                        xmm6 = xmm6 + a2 * b2;
-                        xmm7 = xmm7 + a2 * b3;
-                        xmm8 = xmm8 + a2 * b4;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a1, b2, xmm2 );
+                        xmm3 = fmadd( a1, b3, xmm3 );
+                        xmm4 = fmadd( a1, b4, xmm4 );
+                        xmm5 = fmadd( a2, b1, xmm5 );
+                        xmm6 = fmadd( a2, b2, xmm6 );
+                        xmm7 = fmadd( a2, b3, xmm7 );
+                        xmm8 = fmadd( a2, b4, xmm8 );
                      }
 
-                     (~C).store( i    , j , (~C).load(i    ,j ) + xmm1 * factor );
-                     (~C).store( i    , j1, (~C).load(i    ,j1) + xmm2 * factor );
-                     (~C).store( i    , j2, (~C).load(i    ,j2) + xmm3 * factor );
-                     (~C).store( i    , j3, (~C).load(i    ,j3) + xmm4 * factor );
-                     (~C).store( i+1UL, j , (~C).load(i+1UL,j ) + xmm5 * factor );
-                     (~C).store( i+1UL, j1, (~C).load(i+1UL,j1) + xmm6 * factor );
-                     (~C).store( i+1UL, j2, (~C).load(i+1UL,j2) + xmm7 * factor );
-                     (~C).store( i+1UL, j3, (~C).load(i+1UL,j3) + xmm8 * factor );
+                     (~C).store( i    , j , fmadd( xmm1, factor, (~C).load(i    ,j ) ) );
+                     (~C).store( i    , j1, fmadd( xmm2, factor, (~C).load(i    ,j1) ) );
+                     (~C).store( i    , j2, fmadd( xmm3, factor, (~C).load(i    ,j2) ) );
+                     (~C).store( i    , j3, fmadd( xmm4, factor, (~C).load(i    ,j3) ) );
+                     (~C).store( i+1UL, j , fmadd( xmm5, factor, (~C).load(i+1UL,j ) ) );
+                     (~C).store( i+1UL, j1, fmadd( xmm6, factor, (~C).load(i+1UL,j1) ) );
+                     (~C).store( i+1UL, j2, fmadd( xmm7, factor, (~C).load(i+1UL,j2) ) );
+                     (~C).store( i+1UL, j3, fmadd( xmm8, factor, (~C).load(i+1UL,j3) ) );
                   }
 
                   if( i < iend )
@@ -6445,16 +6943,16 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 + a1 * B.load(k,j );
-                        xmm2 = xmm2 + a1 * B.load(k,j1);
-                        xmm3 = xmm3 + a1 * B.load(k,j2);
-                        xmm4 = xmm4 + a1 * B.load(k,j3);
+                        xmm1 = fmadd( a1, B.load(k,j ), xmm1 );
+                        xmm2 = fmadd( a1, B.load(k,j1), xmm2 );
+                        xmm3 = fmadd( a1, B.load(k,j2), xmm3 );
+                        xmm4 = fmadd( a1, B.load(k,j3), xmm4 );
                      }
 
-                     (~C).store( i, j , (~C).load(i,j ) + xmm1 * factor );
-                     (~C).store( i, j1, (~C).load(i,j1) + xmm2 * factor );
-                     (~C).store( i, j2, (~C).load(i,j2) + xmm3 * factor );
-                     (~C).store( i, j3, (~C).load(i,j3) + xmm4 * factor );
+                     (~C).store( i, j , fmadd( xmm1, factor, (~C).load(i,j ) ) );
+                     (~C).store( i, j1, fmadd( xmm2, factor, (~C).load(i,j1) ) );
+                     (~C).store( i, j2, fmadd( xmm3, factor, (~C).load(i,j2) ) );
+                     (~C).store( i, j3, fmadd( xmm4, factor, (~C).load(i,j3) ) );
                   }
                }
 
@@ -6480,24 +6978,24 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
                         const IntrinsicType a4( set( A(i+3UL,k) ) );
                         const IntrinsicType b1( B.load(k,j ) );
                         const IntrinsicType b2( B.load(k,j1) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a1 * b2;
-                        xmm3 = xmm3 + a2 * b1;
-                        xmm4 = xmm4 + a2 * b2;
-                        xmm5 = xmm5 + a3 * b1;
-                        xmm6 = xmm6 + a3 * b2;
-                        xmm7 = xmm7 + a4 * b1;
-                        xmm8 = xmm8 + a4 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a1, b2, xmm2 );
+                        xmm3 = fmadd( a2, b1, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
+                        xmm5 = fmadd( a3, b1, xmm5 );
+                        xmm6 = fmadd( a3, b2, xmm6 );
+                        xmm7 = fmadd( a4, b1, xmm7 );
+                        xmm8 = fmadd( a4, b2, xmm8 );
                      }
 
-                     (~C).store( i    , j , (~C).load(i    ,j ) + xmm1 * factor );
-                     (~C).store( i    , j1, (~C).load(i    ,j1) + xmm2 * factor );
-                     (~C).store( i+1UL, j , (~C).load(i+1UL,j ) + xmm3 * factor );
-                     (~C).store( i+1UL, j1, (~C).load(i+1UL,j1) + xmm4 * factor );
-                     (~C).store( i+2UL, j , (~C).load(i+2UL,j ) + xmm5 * factor );
-                     (~C).store( i+2UL, j1, (~C).load(i+2UL,j1) + xmm6 * factor );
-                     (~C).store( i+3UL, j , (~C).load(i+3UL,j ) + xmm7 * factor );
-                     (~C).store( i+3UL, j1, (~C).load(i+3UL,j1) + xmm8 * factor );
+                     (~C).store( i    , j , fmadd( xmm1, factor, (~C).load(i    ,j ) ) );
+                     (~C).store( i    , j1, fmadd( xmm2, factor, (~C).load(i    ,j1) ) );
+                     (~C).store( i+1UL, j , fmadd( xmm3, factor, (~C).load(i+1UL,j ) ) );
+                     (~C).store( i+1UL, j1, fmadd( xmm4, factor, (~C).load(i+1UL,j1) ) );
+                     (~C).store( i+2UL, j , fmadd( xmm5, factor, (~C).load(i+2UL,j ) ) );
+                     (~C).store( i+2UL, j1, fmadd( xmm6, factor, (~C).load(i+2UL,j1) ) );
+                     (~C).store( i+3UL, j , fmadd( xmm7, factor, (~C).load(i+3UL,j ) ) );
+                     (~C).store( i+3UL, j1, fmadd( xmm8, factor, (~C).load(i+3UL,j1) ) );
                   }
 
                   for( ; (i+2UL) <= iend; i+=2UL )
@@ -6514,16 +7012,16 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
                         const IntrinsicType a2( set( A(i+1UL,k) ) );
                         const IntrinsicType b1( B.load(k,j ) );
                         const IntrinsicType b2( B.load(k,j1) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a1 * b2;
-                        xmm3 = xmm3 + a2 * b1;
-                        xmm4 = xmm4 + a2 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a1, b2, xmm2 );
+                        xmm3 = fmadd( a2, b1, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
                      }
 
-                     (~C).store( i    , j , (~C).load(i    ,j ) + xmm1 * factor );
-                     (~C).store( i    , j1, (~C).load(i    ,j1) + xmm2 * factor );
-                     (~C).store( i+1UL, j , (~C).load(i+1UL,j ) + xmm3 * factor );
-                     (~C).store( i+1UL, j1, (~C).load(i+1UL,j1) + xmm4 * factor );
+                     (~C).store( i    , j , fmadd( xmm1, factor, (~C).load(i    ,j ) ) );
+                     (~C).store( i    , j1, fmadd( xmm2, factor, (~C).load(i    ,j1) ) );
+                     (~C).store( i+1UL, j , fmadd( xmm3, factor, (~C).load(i+1UL,j ) ) );
+                     (~C).store( i+1UL, j1, fmadd( xmm4, factor, (~C).load(i+1UL,j1) ) );
                   }
 
                   if( i < iend )
@@ -6537,12 +7035,12 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 + a1 * B.load(k,j );
-                        xmm2 = xmm2 + a1 * B.load(k,j1);
+                        xmm1 = fmadd( a1, B.load(k,j ), xmm1 );
+                        xmm2 = fmadd( a1, B.load(k,j1), xmm2 );
                      }
 
-                     (~C).store( i, j , (~C).load(i,j ) + xmm1 * factor );
-                     (~C).store( i, j1, (~C).load(i,j1) + xmm2 * factor );
+                     (~C).store( i, j , fmadd( xmm1, factor, (~C).load(i,j ) ) );
+                     (~C).store( i, j1, fmadd( xmm2, factor, (~C).load(i,j1) ) );
                   }
                }
 
@@ -6559,10 +7057,10 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 + a1 * B.load(k,j);
+                        xmm1 = fmadd( a1, B.load(k,j), xmm1 );
                      }
 
-                     (~C).store( i, j, (~C).load(i,j) + xmm1 * factor );
+                     (~C).store( i, j, fmadd( xmm1, factor, (~C).load(i,j) ) );
                   }
                }
             }
@@ -7124,24 +7622,24 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 + a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 + a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 + a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 + a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
-            (~C).store( i, j             , (~C).load(i,j             ) - xmm1 * factor );
-            (~C).store( i, j+IT::size    , (~C).load(i,j+IT::size    ) - xmm2 * factor );
-            (~C).store( i, j+IT::size*2UL, (~C).load(i,j+IT::size*2UL) - xmm3 * factor );
-            (~C).store( i, j+IT::size*3UL, (~C).load(i,j+IT::size*3UL) - xmm4 * factor );
-            (~C).store( i, j+IT::size*4UL, (~C).load(i,j+IT::size*4UL) - xmm5 * factor );
-            (~C).store( i, j+IT::size*5UL, (~C).load(i,j+IT::size*5UL) - xmm6 * factor );
-            (~C).store( i, j+IT::size*6UL, (~C).load(i,j+IT::size*6UL) - xmm7 * factor );
-            (~C).store( i, j+IT::size*7UL, (~C).load(i,j+IT::size*7UL) - xmm8 * factor );
+            (~C).store( i, j             , fnmadd( xmm1, factor, (~C).load(i,j             ) ) );
+            (~C).store( i, j+IT::size    , fnmadd( xmm2, factor, (~C).load(i,j+IT::size    ) ) );
+            (~C).store( i, j+IT::size*2UL, fnmadd( xmm3, factor, (~C).load(i,j+IT::size*2UL) ) );
+            (~C).store( i, j+IT::size*3UL, fnmadd( xmm4, factor, (~C).load(i,j+IT::size*3UL) ) );
+            (~C).store( i, j+IT::size*4UL, fnmadd( xmm5, factor, (~C).load(i,j+IT::size*4UL) ) );
+            (~C).store( i, j+IT::size*5UL, fnmadd( xmm6, factor, (~C).load(i,j+IT::size*5UL) ) );
+            (~C).store( i, j+IT::size*6UL, fnmadd( xmm7, factor, (~C).load(i,j+IT::size*6UL) ) );
+            (~C).store( i, j+IT::size*7UL, fnmadd( xmm8, factor, (~C).load(i,j+IT::size*7UL) ) );
          }
       }
 
@@ -7171,24 +7669,24 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
-            (~C).store( i    , j             , (~C).load(i    ,j             ) - xmm1 * factor );
-            (~C).store( i    , j+IT::size    , (~C).load(i    ,j+IT::size    ) - xmm2 * factor );
-            (~C).store( i    , j+IT::size*2UL, (~C).load(i    ,j+IT::size*2UL) - xmm3 * factor );
-            (~C).store( i    , j+IT::size*3UL, (~C).load(i    ,j+IT::size*3UL) - xmm4 * factor );
-            (~C).store( i+1UL, j             , (~C).load(i+1UL,j             ) - xmm5 * factor );
-            (~C).store( i+1UL, j+IT::size    , (~C).load(i+1UL,j+IT::size    ) - xmm6 * factor );
-            (~C).store( i+1UL, j+IT::size*2UL, (~C).load(i+1UL,j+IT::size*2UL) - xmm7 * factor );
-            (~C).store( i+1UL, j+IT::size*3UL, (~C).load(i+1UL,j+IT::size*3UL) - xmm8 * factor );
+            (~C).store( i    , j             , fnmadd( xmm1, factor, (~C).load(i    ,j             ) ) );
+            (~C).store( i    , j+IT::size    , fnmadd( xmm2, factor, (~C).load(i    ,j+IT::size    ) ) );
+            (~C).store( i    , j+IT::size*2UL, fnmadd( xmm3, factor, (~C).load(i    ,j+IT::size*2UL) ) );
+            (~C).store( i    , j+IT::size*3UL, fnmadd( xmm4, factor, (~C).load(i    ,j+IT::size*3UL) ) );
+            (~C).store( i+1UL, j             , fnmadd( xmm5, factor, (~C).load(i+1UL,j             ) ) );
+            (~C).store( i+1UL, j+IT::size    , fnmadd( xmm6, factor, (~C).load(i+1UL,j+IT::size    ) ) );
+            (~C).store( i+1UL, j+IT::size*2UL, fnmadd( xmm7, factor, (~C).load(i+1UL,j+IT::size*2UL) ) );
+            (~C).store( i+1UL, j+IT::size*3UL, fnmadd( xmm8, factor, (~C).load(i+1UL,j+IT::size*3UL) ) );
          }
 
          if( i < M )
@@ -7204,16 +7702,16 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
-            (~C).store( i, j             , (~C).load(i,j             ) - xmm1 * factor );
-            (~C).store( i, j+IT::size    , (~C).load(i,j+IT::size    ) - xmm2 * factor );
-            (~C).store( i, j+IT::size*2UL, (~C).load(i,j+IT::size*2UL) - xmm3 * factor );
-            (~C).store( i, j+IT::size*3UL, (~C).load(i,j+IT::size*3UL) - xmm4 * factor );
+            (~C).store( i, j             , fnmadd( xmm1, factor, (~C).load(i,j             ) ) );
+            (~C).store( i, j+IT::size    , fnmadd( xmm2, factor, (~C).load(i,j+IT::size    ) ) );
+            (~C).store( i, j+IT::size*2UL, fnmadd( xmm3, factor, (~C).load(i,j+IT::size*2UL) ) );
+            (~C).store( i, j+IT::size*3UL, fnmadd( xmm4, factor, (~C).load(i,j+IT::size*3UL) ) );
          }
       }
 
@@ -7241,16 +7739,16 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
-            (~C).store( i    , j         , (~C).load(i    ,j         ) - xmm1 * factor );
-            (~C).store( i    , j+IT::size, (~C).load(i    ,j+IT::size) - xmm2 * factor );
-            (~C).store( i+1UL, j         , (~C).load(i+1UL,j         ) - xmm3 * factor );
-            (~C).store( i+1UL, j+IT::size, (~C).load(i+1UL,j+IT::size) - xmm4 * factor );
+            (~C).store( i    , j         , fnmadd( xmm1, factor, (~C).load(i    ,j         ) ) );
+            (~C).store( i    , j+IT::size, fnmadd( xmm2, factor, (~C).load(i    ,j+IT::size) ) );
+            (~C).store( i+1UL, j         , fnmadd( xmm3, factor, (~C).load(i+1UL,j         ) ) );
+            (~C).store( i+1UL, j+IT::size, fnmadd( xmm4, factor, (~C).load(i+1UL,j+IT::size) ) );
          }
 
          if( i < M )
@@ -7266,12 +7764,12 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j         );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size);
+               xmm1 = fmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
-            (~C).store( i, j         , (~C).load(i,j         ) - xmm1 * factor );
-            (~C).store( i, j+IT::size, (~C).load(i,j+IT::size) - xmm2 * factor );
+            (~C).store( i, j         , fnmadd( xmm1, factor, (~C).load(i,j         ) ) );
+            (~C).store( i, j+IT::size, fnmadd( xmm2, factor, (~C).load(i,j+IT::size) ) );
          }
       }
 
@@ -7294,12 +7792,12 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 + set( A(i+1UL,k) ) * b1;
+               xmm1 = fmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
-            (~C).store( i    , j, (~C).load(i    ,j) - xmm1 * factor );
-            (~C).store( i+1UL, j, (~C).load(i+1UL,j) - xmm2 * factor );
+            (~C).store( i    , j, fnmadd( xmm1, factor, (~C).load(i    ,j) ) );
+            (~C).store( i+1UL, j, fnmadd( xmm2, factor, (~C).load(i+1UL,j) ) );
          }
 
          if( i < M )
@@ -7313,10 +7811,10 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + set( A(i,k) ) * B.load(k,j);
+               xmm1 = fmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
-            (~C).store( i, j, (~C).load(i,j) - xmm1 * factor );
+            (~C).store( i, j, fnmadd( xmm1, factor, (~C).load(i,j) ) );
          }
       }
    }
@@ -7392,6 +7890,31 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    }
    //**********************************************************************************************
 
+   //**Packed subtraction assignment to row-major dense matrices (large matrices)******************
+   /*!\brief Packed subtraction assignment of a large scaled dense matrix-dense matrix multiplication
+   //        (\f$ C-=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function relays to the packed, register-blocked matrix multiplication kernel for
+   // large row-major dense matrices (see the mmm() function).
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline typename EnableIf< UsePackedKernel<MT3,MT4,MT5,ST2> >::Type
+      selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
+   {
+      mmm( ~C, A, B, ElementType( -scalar ), ElementType(1) );
+   }
+   //**********************************************************************************************
+
    //**Vectorized default subtraction assignment to row-major dense matrices (large matrices)******
    /*!\brief Vectorized default subtraction assignment of a large scaled dense matrix-dense matrix
    //        multiplication (\f$ C-=s*A*B \f$).
@@ -7411,18 +7934,20 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5    // Type of the right-hand side matrix operand
            , typename ST2 >  // Type of the scalar value
-   static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
+   static inline typename EnableIf< And< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2>
+                                       , Not< UsePackedKernel<MT3,MT4,MT5,ST2> > > >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       typedef IntrinsicTrait<ElementType>  IT;
+      typedef MMMTrait<ElementType>        MMMT;
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
       const size_t K( A.columns() );
 
-      const size_t iblock(  64UL );
-      const size_t jblock( 128UL );
-      const size_t kblock( 128UL );
+      const size_t iblock( MMMT::sblock() );
+      const size_t jblock( MMMT::vblock() );
+      const size_t kblock( MMMT::kblock() );
 
       const IntrinsicType factor( set( scalar ) );
 
@@ -7464,24 +7989,24 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
                         const IntrinsicType b2( B.load(k,j1) );
                         const IntrinsicType b3( B.load(k,j2) );
                         const IntrinsicType b4( B.load(k,j3) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a1 * b2;
-                        xmm3 = xmm3 + a1 * b3;
-                        xmm4 = xmm4 + a1 * b4;
-                        xmm5 = xmm5 + a2 * b1;
-                        xmm6 = xmm6 + a2 * b2;
-                        xmm7 = xmm7 + a2 * b3;
-                        xmm8 = xmm8 + a2 * b4;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a1, b2, xmm2 );
+                        xmm3 = fmadd( a1, b3, xmm3 );
+                        xmm4 = fmadd( a1, b4, xmm4 );
+                        xmm5 = fmadd( a2, b1, xmm5 );
+                        xmm6 = fmadd( a2, b2, xmm6 );
+                        xmm7 = fmadd( a2, b3, xmm7 );
+                        xmm8 = fmadd( a2, b4, xmm8 );
                      }
 
-                     (~C).store( i    , j , (~C).load(i    ,j ) - xmm1 * factor );
-                     (~C).store( i    , j1, (~C).load(i    ,j1) - xmm2 * factor );
-                     (~C).store( i    , j2, (~C).load(i    ,j2) - xmm3 * factor );
-                     (~C).store( i    , j3, (~C).load(i    ,j3) - xmm4 * factor );
-                     (~C).store( i+1UL, j , (~C).load(i+1UL,j ) - xmm5 * factor );
-                     (~C).store( i+1UL, j1, (~C).load(i+1UL,j1) - xmm6 * factor );
-                     (~C).store( i+1UL, j2, (~C).load(i+1UL,j2) - xmm7 * factor );
-                     (~C).store( i+1UL, j3, (~C).load(i+1UL,j3) - xmm8 * factor );
+                     (~C).store( i    , j , fnmadd( xmm1, factor, (~C).load(i    ,j ) ) );
+                     (~C).store( i    , j1, fnmadd( xmm2, factor, (~C).load(i    ,j1) ) );
+                     (~C).store( i    , j2, fnmadd( xmm3, factor, (~C).load(i    ,j2) ) );
+                     (~C).store( i    , j3, fnmadd( xmm4, factor, (~C).load(i    ,j3) ) );
+                     (~C).store( i+1UL, j , fnmadd( xmm5, factor, (~C).load(i+1UL,j ) ) );
+                     (~C).store( i+1UL, j1, fnmadd( xmm6, factor, (~C).load(i+1UL,j1) ) );
+                     (~C).store( i+1UL, j2, fnmadd( xmm7, factor, (~C).load(i+1UL,j2) ) );
+                     (~C).store( i+1UL, j3, fnmadd( xmm8, factor, (~C).load(i+1UL,j3) ) );
                   }
 
                   if( i < iend )
@@ -7495,16 +8020,16 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 + a1 * B.load(k,j );
-                        xmm2 = xmm2 + a1 * B.load(k,j1);
-                        xmm3 = xmm3 + a1 * B.load(k,j2);
-                        xmm4 = xmm4 + a1 * B.load(k,j3);
+                        xmm1 = fmadd( a1, B.load(k,j ), xmm1 );
+                        xmm2 = fmadd( a1, B.load(k,j1), xmm2 );
+                        xmm3 = fmadd( a1, B.load(k,j2), xmm3 );
+                        xmm4 = fmadd( a1, B.load(k,j3), xmm4 );
                      }
 
-                     (~C).store( i, j , (~C).load(i,j ) - xmm1 * factor );
-                     (~C).store( i, j1, (~C).load(i,j1) - xmm2 * factor );
-                     (~C).store( i, j2, (~C).load(i,j2) - xmm3 * factor );
-                     (~C).store( i, j3, (~C).load(i,j3) - xmm4 * factor );
+                     (~C).store( i, j , fnmadd( xmm1, factor, (~C).load(i,j ) ) );
+                     (~C).store( i, j1, fnmadd( xmm2, factor, (~C).load(i,j1) ) );
+                     (~C).store( i, j2, fnmadd( xmm3, factor, (~C).load(i,j2) ) );
+                     (~C).store( i, j3, fnmadd( xmm4, factor, (~C).load(i,j3) ) );
                   }
                }
 
@@ -7530,24 +8055,24 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
                         const IntrinsicType a4( set( A(i+3UL,k) ) );
                         const IntrinsicType b1( B.load(k,j ) );
                         const IntrinsicType b2( B.load(k,j1) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a1 * b2;
-                        xmm3 = xmm3 + a2 * b1;
-                        xmm4 = xmm4 + a2 * b2;
-                        xmm5 = xmm5 + a3 * b1;
-                        xmm6 = xmm6 + a3 * b2;
-                        xmm7 = xmm7 + a4 * b1;
-                        xmm8 = xmm8 + a4 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a1, b2, xmm2 );
+                        xmm3 = fmadd( a2, b1, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
+                        xmm5 = fmadd( a3, b1, xmm5 );
+                        xmm6 = fmadd( a3, b2, xmm6 );
+                        xmm7 = fmadd( a4, b1, xmm7 );
+                        xmm8 = fmadd( a4, b2, xmm8 );
                      }
 
-                     (~C).store( i    , j , (~C).load(i    ,j ) - xmm1 * factor );
-                     (~C).store( i    , j1, (~C).load(i    ,j1) - xmm2 * factor );
-                     (~C).store( i+1UL, j , (~C).load(i+1UL,j ) - xmm3 * factor );
-                     (~C).store( i+1UL, j1, (~C).load(i+1UL,j1) - xmm4 * factor );
-                     (~C).store( i+2UL, j , (~C).load(i+2UL,j ) - xmm5 * factor );
-                     (~C).store( i+2UL, j1, (~C).load(i+2UL,j1) - xmm6 * factor );
-                     (~C).store( i+3UL, j , (~C).load(i+3UL,j ) - xmm7 * factor );
-                     (~C).store( i+3UL, j1, (~C).load(i+3UL,j1) - xmm8 * factor );
+                     (~C).store( i    , j , fnmadd( xmm1, factor, (~C).load(i    ,j ) ) );
+                     (~C).store( i    , j1, fnmadd( xmm2, factor, (~C).load(i    ,j1) ) );
+                     (~C).store( i+1UL, j , fnmadd( xmm3, factor, (~C).load(i+1UL,j ) ) );
+                     (~C).store( i+1UL, j1, fnmadd( xmm4, factor, (~C).load(i+1UL,j1) ) );
+                     (~C).store( i+2UL, j , fnmadd( xmm5, factor, (~C).load(i+2UL,j ) ) );
+                     (~C).store( i+2UL, j1, fnmadd( xmm6, factor, (~C).load(i+2UL,j1) ) );
+                     (~C).store( i+3UL, j , fnmadd( xmm7, factor, (~C).load(i+3UL,j ) ) );
+                     (~C).store( i+3UL, j1, fnmadd( xmm8, factor, (~C).load(i+3UL,j1) ) );
                   }
 
                   for( ; (i+2UL) <= iend; i+=2UL )
@@ -7564,16 +8089,16 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
                         const IntrinsicType a2( set( A(i+1UL,k) ) );
                         const IntrinsicType b1( B.load(k,j ) );
                         const IntrinsicType b2( B.load(k,j1) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a1 * b2;
-                        xmm3 = xmm3 + a2 * b1;
-                        xmm4 = xmm4 + a2 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a1, b2, xmm2 );
+                        xmm3 = fmadd( a2, b1, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
                      }
 
-                     (~C).store( i    , j , (~C).load(i    ,j ) - xmm1 * factor );
-                     (~C).store( i    , j1, (~C).load(i    ,j1) - xmm2 * factor );
-                     (~C).store( i+1UL, j , (~C).load(i+1UL,j ) - xmm3 * factor );
-                     (~C).store( i+1UL, j1, (~C).load(i+1UL,j1) - xmm4 * factor );
+                     (~C).store( i    , j , fnmadd( xmm1, factor, (~C).load(i    ,j ) ) );
+                     (~C).store( i    , j1, fnmadd( xmm2, factor, (~C).load(i    ,j1) ) );
+                     (~C).store( i+1UL, j , fnmadd( xmm3, factor, (~C).load(i+1UL,j ) ) );
+                     (~C).store( i+1UL, j1, fnmadd( xmm4, factor, (~C).load(i+1UL,j1) ) );
                   }
 
                   if( i < iend )
@@ -7587,12 +8112,12 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 + a1 * B.load(k,j );
-                        xmm2 = xmm2 + a1 * B.load(k,j1);
+                        xmm1 = fmadd( a1, B.load(k,j ), xmm1 );
+                        xmm2 = fmadd( a1, B.load(k,j1), xmm2 );
                      }
 
-                     (~C).store( i, j , (~C).load(i,j ) - xmm1 * factor );
-                     (~C).store( i, j1, (~C).load(i,j1) - xmm2 * factor );
+                     (~C).store( i, j , fnmadd( xmm1, factor, (~C).load(i,j ) ) );
+                     (~C).store( i, j1, fnmadd( xmm2, factor, (~C).load(i,j1) ) );
                   }
                }
 
@@ -7609,10 +8134,10 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 + a1 * B.load(k,j);
+                        xmm1 = fmadd( a1, B.load(k,j), xmm1 );
                      }
 
-                     (~C).store( i, j, (~C).load(i,j) - xmm1 * factor );
+                     (~C).store( i, j, fnmadd( xmm1, factor, (~C).load(i,j) ) );
                   }
                }
             }
@@ -7934,6 +8459,45 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    }
    //**********************************************************************************************
 
+   //**SMP assignment to dense matrices (packed kernel)*********************************************
+   /*!\brief SMP assignment of a large scaled dense matrix-dense matrix multiplication to a
+   //        dense matrix (\f$ C=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side scaled multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the SMP assignment of a scaled dense matrix-dense matrix
+   // multiplication expression to a row-major dense matrix by means of the parallel packed
+   // matrix multiplication kernel (see the smpMmm() function). Due to the explicit application
+   // of the SFINAE principle this function can only be selected by the compiler in case the
+   // packed kernel can be used and none of the two matrix operands requires an intermediate
+   // evaluation.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline typename EnableIf< UseSMPPackedKernel<MT,MT1,MT2,ST> >::Type
+      smpAssign( DenseMatrix<MT,SO>& lhs, const DMatScalarMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      BLAZE_PARALLEL_SECTION
+      {
+         if( isSerialSectionActive() || !rhs.canSMPAssign() ||
+             (~lhs).rows() * (~lhs).columns() < DMATDMATMULT_THRESHOLD ) {
+            assign( ~lhs, rhs );
+         }
+         else {
+            smpMmm( ~lhs, rhs.matrix_.leftOperand(), rhs.matrix_.rightOperand(), rhs.scalar_, ElementType(0) );
+         }
+      }
+   }
+   //**********************************************************************************************
+
    //**SMP assignment to sparse matrices***********************************************************
    /*!\brief SMP assignment of a scaled dense matrix-dense matrix multiplication to a sparse matrix
    //        (\f$ C=s*A*B \f$).
@@ -8056,6 +8620,45 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    }
    //**********************************************************************************************
 
+   //**SMP addition assignment to dense matrices (packed kernel)************************************
+   /*!\brief SMP addition assignment of a large scaled dense matrix-dense matrix multiplication to a
+   //        dense matrix (\f$ C+=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side scaled multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the SMP addition assignment of a scaled dense matrix-dense matrix
+   // multiplication expression to a row-major dense matrix by means of the parallel packed
+   // matrix multiplication kernel (see the smpMmm() function). Due to the explicit application
+   // of the SFINAE principle this function can only be selected by the compiler in case the
+   // packed kernel can be used and none of the two matrix operands requires an intermediate
+   // evaluation.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline typename EnableIf< UseSMPPackedKernel<MT,MT1,MT2,ST> >::Type
+      smpAddAssign( DenseMatrix<MT,SO>& lhs, const DMatScalarMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      BLAZE_PARALLEL_SECTION
+      {
+         if( isSerialSectionActive() || !rhs.canSMPAssign() ||
+             (~lhs).rows() * (~lhs).columns() < DMATDMATMULT_THRESHOLD ) {
+            addAssign( ~lhs, rhs );
+         }
+         else {
+            smpMmm( ~lhs, rhs.matrix_.leftOperand(), rhs.matrix_.rightOperand(), rhs.scalar_, ElementType(1) );
+         }
+      }
+   }
+   //**********************************************************************************************
+
    //**Restructuring SMP addition assignment to column-major matrices******************************
    /*!\brief Restructuring SMP addition assignment of a scaled dense matrix-dense matrix
    //        multiplication to a column-major matrix (\f$ C+=s*A*B \f$).
@@ -8143,6 +8746,45 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    }
    //**********************************************************************************************
 
+   //**SMP subtraction assignment to dense matrices (packed kernel)*********************************
+   /*!\brief SMP subtraction assignment of a large scaled dense matrix-dense matrix multiplication to a
+   //        dense matrix (\f$ C-=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side scaled multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the SMP subtraction assignment of a scaled dense matrix-dense matrix
+   // multiplication expression to a row-major dense matrix by means of the parallel packed
+   // matrix multiplication kernel (see the smpMmm() function). Due to the explicit application
+   // of the SFINAE principle this function can only be selected by the compiler in case the
+   // packed kernel can be used and none of the two matrix operands requires an intermediate
+   // evaluation.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline typename EnableIf< UseSMPPackedKernel<MT,MT1,MT2,ST> >::Type
+      smpSubAssign( DenseMatrix<MT,SO>& lhs, const DMatScalarMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      BLAZE_PARALLEL_SECTION
+      {
+         if( isSerialSectionActive() || !rhs.canSMPAssign() ||
+             (~lhs).rows() * (~lhs).columns() < DMATDMATMULT_THRESHOLD ) {
+            subAssign( ~lhs, rhs );
+         }
+         else {
+            smpMmm( ~lhs, rhs.matrix_.leftOperand(), rhs.matrix_.rightOperand(), ElementType( -rhs.scalar_ ), ElementType(1) );
+         }
+      }
+   }
+   //**********************************************************************************************
+
    //**Restructuring SMP subtraction assignment to column-major matrices***************************
    /*!\brief Restructuring SMP subtraction assignment of a scaled dense matrix-dense matrix
    //        multiplication to a column-major matrix (\f$ C-=s*A*B \f$).
@@ -598,14 +598,14 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+7UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+7UL,j), x1, xmm8 );
          }
 
          y[i    ] = sum( xmm1 );
@@ -632,10 +632,10 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
          }
 
          y[i    ] = sum( xmm1 );
@@ -658,9 +658,9 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
          }
 
          y[i    ] = sum( xmm1 );
@@ -682,8 +682,8 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
          }
 
          y[i    ] = sum( xmm1 );
@@ -703,7 +703,7 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(j);
+            xmm1 = fmadd( A.load(i,j), x.load(j), xmm1 );
          }
 
          y[i] = sum( xmm1 );
@@ -1286,14 +1286,14 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+7UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+7UL,j), x1, xmm8 );
          }
 
          y[i    ] += sum( xmm1 );
@@ -1320,10 +1320,10 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
          }
 
          y[i    ] += sum( xmm1 );
@@ -1346,9 +1346,9 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
          }
 
          y[i    ] += sum( xmm1 );
@@ -1370,8 +1370,8 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
          }
 
          y[i    ] += sum( xmm1 );
@@ -1391,7 +1391,7 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(j);
+            xmm1 = fmadd( A.load(i,j), x.load(j), xmm1 );
          }
 
          y[i] += sum( xmm1 );
@@ -1950,14 +1950,14 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+7UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+7UL,j), x1, xmm8 );
          }
 
          y[i    ] -= sum( xmm1 );
@@ -1984,10 +1984,10 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
          }
 
          y[i    ] -= sum( xmm1 );
@@ -2010,9 +2010,9 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
          }
 
          y[i    ] -= sum( xmm1 );
@@ -2034,8 +2034,8 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
          }
 
          y[i    ] -= sum( xmm1 );
@@ -2055,7 +2055,7 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(j);
+            xmm1 = fmadd( A.load(i,j), x.load(j), xmm1 );
          }
 
          y[i] -= sum( xmm1 );
@@ -3183,14 +3183,14 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+7UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+7UL,j), x1, xmm8 );
          }
 
          y[i    ] = sum( xmm1 ) * scalar;
@@ -3217,10 +3217,10 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
          }
 
          y[i    ] = sum( xmm1 ) * scalar;
@@ -3243,9 +3243,9 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
          }
 
          y[i    ] = sum( xmm1 ) * scalar;
@@ -3267,8 +3267,8 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
          }
 
          y[i    ] = sum( xmm1 ) * scalar;
@@ -3288,7 +3288,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(j);
+            xmm1 = fmadd( A.load(i,j), x.load(j), xmm1 );
          }
 
          y[i] = sum( xmm1 ) * scalar;
@@ -3889,14 +3889,14 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+7UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+7UL,j), x1, xmm8 );
          }
 
          y[i    ] += sum( xmm1 ) * scalar;
@@ -3923,10 +3923,10 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
          }
 
          y[i    ] += sum( xmm1 ) * scalar;
@@ -3949,9 +3949,9 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
          }
 
          y[i    ] += sum( xmm1 ) * scalar;
@@ -3973,8 +3973,8 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
          }
 
          y[i    ] += sum( xmm1 ) * scalar;
@@ -3994,7 +3994,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(j);
+            xmm1 = fmadd( A.load(i,j), x.load(j), xmm1 );
          }
 
          y[i] += sum( xmm1 ) * scalar;
@@ -4554,14 +4554,14 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+7UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+7UL,j), x1, xmm8 );
          }
 
          y[i    ] -= sum( xmm1 ) * scalar;
@@ -4588,10 +4588,10 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
          }
 
          y[i    ] -= sum( xmm1 ) * scalar;
@@ -4614,9 +4614,9 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
          }
 
          y[i    ] -= sum( xmm1 ) * scalar;
@@ -4638,8 +4638,8 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
          }
 
          y[i    ] -= sum( xmm1 ) * scalar;
@@ -4659,7 +4659,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(j);
+            xmm1 = fmadd( A.load(i,j), x.load(j), xmm1 );
          }
 
          y[i] -= sum( xmm1 ) * scalar;
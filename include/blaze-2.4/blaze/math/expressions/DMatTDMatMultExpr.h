@@ -45,6 +45,7 @@
 #include <blaze/math/constraints/DenseMatrix.h>
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/dense/MMM.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Forward.h>
@@ -69,6 +70,7 @@
 #include <blaze/math/typetraits/Columns.h>
 #include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsAdaptor.h>
 #include <blaze/math/typetraits/IsColumnMajorMatrix.h>
 #include <blaze/math/typetraits/IsColumnVector.h>
 #include <blaze/math/typetraits/IsComputation.h>
@@ -77,6 +79,7 @@
 #include <blaze/math/typetraits/IsDiagonal.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/math/typetraits/IsRowVector.h>
 #include <blaze/math/typetraits/IsSparseVector.h>
@@ -166,6 +169,23 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The UseTaskGraph struct is a helper struct for the selection of the parallel evaluation
+       strategy. In case both matrix operands require an intermediate evaluation into resizable
+       dense matrices, the two operands are evaluated concurrently and the nested \a value will
+       be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseTaskGraph {
+      enum { value = evaluateLeft && evaluateRight &&
+                     IsEvaluationRequired<T1,T2,T3>::value &&
+                     IsResizable<RT1>::value && !IsAdaptor<RT1>::value &&
+                     IsResizable<RT2>::value && !IsAdaptor<RT2>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper structure for the explicit application of the SFINAE principle.
@@ -282,6 +302,20 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the vectorized default kernel can be used and neither of the two matrix operands
+       is triangular, the nested \value will be set to 1 and the packed matrix multiplication
+       kernel is selected for large matrices. Otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UsePackedKernel {
+      enum { value = UseVectorizedDefaultKernel<T1,T2,T3>::value &&
+                     !IsTriangular<T2>::value && !IsTriangular<T3>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef DMatTDMatMultExpr<MT1,MT2>                  This;           //!< Type of this DMatTDMatMultExpr instance.
@@ -1057,14 +1091,14 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType b2( B.load(k,j+1UL) );
                const IntrinsicType b3( B.load(k,j+2UL) );
                const IntrinsicType b4( B.load(k,j+3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C)(i    ,j    ) = sum( xmm1 );
@@ -1093,10 +1127,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) = sum( xmm1 );
@@ -1116,8 +1150,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) = sum( xmm1 );
@@ -1140,10 +1174,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
-               xmm3 = xmm3 + a1 * B.load(k,j+2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+3UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+3UL), xmm4 );
             }
 
             (~C)(i,j    ) = sum( xmm1 );
@@ -1163,8 +1197,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) = sum( xmm1 );
@@ -1180,7 +1214,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) = sum( xmm1 );
@@ -1241,14 +1275,14 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a4( A.load(i+3UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
-               xmm5 = xmm5 + a3 * b1;
-               xmm6 = xmm6 + a3 * b2;
-               xmm7 = xmm7 + a4 * b1;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
+               xmm5 = fmadd( a3, b1, xmm5 );
+               xmm6 = fmadd( a3, b2, xmm6 );
+               xmm7 = fmadd( a4, b1, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C)(i    ,j    ) = sum( xmm1 );
@@ -1272,10 +1306,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
-               xmm3 = xmm3 + A.load(i+2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+3UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+3UL,k), b1, xmm4 );
             }
 
             (~C)(i    ,j) = sum( xmm1 );
@@ -1305,10 +1339,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) = sum( xmm1 );
@@ -1328,8 +1362,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) = sum( xmm1 );
@@ -1352,8 +1386,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) = sum( xmm1 );
@@ -1369,7 +1403,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) = sum( xmm1 );
@@ -1404,6 +1438,31 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Packed assignment to dense matrices (large matrices)****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Packed assignment of a large dense matrix-transpose dense matrix
+   //        multiplication (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays to the packed, register-blocked matrix multiplication kernel for
+   // large dense matrices (see the mmm() function).
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UsePackedKernel<MT3,MT4,MT5> >::Type
+      selectLargeAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      mmm( C, A, B, ElementType(1), ElementType(0) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Vectorized default assignment to row-major dense matrices (large matrices)******************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Vectorized default assignment of a large dense matrix-transpose dense matrix
@@ -1422,7 +1481,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
+   static inline typename EnableIf< And< UseVectorizedDefaultKernel<MT3,MT4,MT5>
+                                       , Not< UsePackedKernel<MT3,MT4,MT5> > > >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
       // TODO
@@ -1449,7 +1509,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
+   static inline typename EnableIf< And< UseVectorizedDefaultKernel<MT3,MT4,MT5>
+                                       , Not< UsePackedKernel<MT3,MT4,MT5> > > >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
       // TODO
@@ -2201,14 +2262,14 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType b2( B.load(k,j+1UL) );
                const IntrinsicType b3( B.load(k,j+2UL) );
                const IntrinsicType b4( B.load(k,j+3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C)(i    ,j    ) += sum( xmm1 );
@@ -2237,10 +2298,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) += sum( xmm1 );
@@ -2260,8 +2321,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) += sum( xmm1 );
@@ -2283,10 +2344,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
-               xmm3 = xmm3 + a1 * B.load(k,j+2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+3UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+3UL), xmm4 );
             }
 
             (~C)(i,j    ) += sum( xmm1 );
@@ -2306,8 +2367,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) += sum( xmm1 );
@@ -2323,7 +2384,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) += sum( xmm1 );
@@ -2384,14 +2445,14 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a4( A.load(i+3UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
-               xmm5 = xmm5 + a3 * b1;
-               xmm6 = xmm6 + a3 * b2;
-               xmm7 = xmm7 + a4 * b1;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
+               xmm5 = fmadd( a3, b1, xmm5 );
+               xmm6 = fmadd( a3, b2, xmm6 );
+               xmm7 = fmadd( a4, b1, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C)(i    ,j    ) += sum( xmm1 );
@@ -2415,10 +2476,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
-               xmm3 = xmm3 + A.load(i+2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+3UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+3UL,k), b1, xmm4 );
             }
 
             (~C)(i    ,j) += sum( xmm1 );
@@ -2448,10 +2509,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) += sum( xmm1 );
@@ -2471,8 +2532,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) += sum( xmm1 );
@@ -2495,8 +2556,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) += sum( xmm1 );
@@ -2512,7 +2573,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) += sum( xmm1 );
@@ -2547,6 +2608,31 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Packed addition assignment to dense matrices (large matrices)*******************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Packed addition assignment of a large dense matrix-transpose dense matrix
+   //        multiplication (\f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays to the packed, register-blocked matrix multiplication kernel for
+   // large dense matrices (see the mmm() function).
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UsePackedKernel<MT3,MT4,MT5> >::Type
+      selectLargeAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      mmm( C, A, B, ElementType(1), ElementType(1) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Vectorized default addition assignment to row-major dense matrices (large matrices)*********
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Vectorized default addition assignment of a large dense matrix-transpose dense matrix
@@ -2565,7 +2651,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
+   static inline typename EnableIf< And< UseVectorizedDefaultKernel<MT3,MT4,MT5>
+                                       , Not< UsePackedKernel<MT3,MT4,MT5> > > >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
       // TODO
@@ -2592,7 +2679,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
+   static inline typename EnableIf< And< UseVectorizedDefaultKernel<MT3,MT4,MT5>
+                                       , Not< UsePackedKernel<MT3,MT4,MT5> > > >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
       // TODO
@@ -3319,14 +3407,14 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType b2( B.load(k,j+1UL) );
                const IntrinsicType b3( B.load(k,j+2UL) );
                const IntrinsicType b4( B.load(k,j+3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C)(i    ,j    ) -= sum( xmm1 );
@@ -3355,10 +3443,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) -= sum( xmm1 );
@@ -3378,8 +3466,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) -= sum( xmm1 );
@@ -3402,10 +3490,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
-               xmm3 = xmm3 + a1 * B.load(k,j+2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+3UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+3UL), xmm4 );
             }
 
             (~C)(i,j    ) -= sum( xmm1 );
@@ -3425,8 +3513,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) -= sum( xmm1 );
@@ -3442,7 +3530,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) -= sum( xmm1 );
@@ -3503,14 +3591,14 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a4( A.load(i+3UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
-               xmm5 = xmm5 + a3 * b1;
-               xmm6 = xmm6 + a3 * b2;
-               xmm7 = xmm7 + a4 * b1;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
+               xmm5 = fmadd( a3, b1, xmm5 );
+               xmm6 = fmadd( a3, b2, xmm6 );
+               xmm7 = fmadd( a4, b1, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C)(i    ,j    ) -= sum( xmm1 );
@@ -3534,10 +3622,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
-               xmm3 = xmm3 + A.load(i+2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+3UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+3UL,k), b1, xmm4 );
             }
 
             (~C)(i    ,j) -= sum( xmm1 );
@@ -3567,10 +3655,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) -= sum( xmm1 );
@@ -3590,8 +3678,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) -= sum( xmm1 );
@@ -3613,8 +3701,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) -= sum( xmm1 );
@@ -3630,7 +3718,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) -= sum( xmm1 );
@@ -3665,6 +3753,31 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Packed subtraction assignment to dense matrices (large matrices)****************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Packed subtraction assignment of a large dense matrix-transpose dense matrix
+   //        multiplication (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays to the packed, register-blocked matrix multiplication kernel for
+   // large dense matrices (see the mmm() function).
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UsePackedKernel<MT3,MT4,MT5> >::Type
+      selectLargeSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      mmm( C, A, B, ElementType(-1), ElementType(1) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default subtraction assignment to row-major dense matrices (large matrices)*****************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default subtraction assignment of a large dense matrix-transpose dense matrix
@@ -3683,7 +3796,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
+   static inline typename EnableIf< And< UseVectorizedDefaultKernel<MT3,MT4,MT5>
+                                       , Not< UsePackedKernel<MT3,MT4,MT5> > > >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
       // TODO
@@ -3710,7 +3824,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
+   static inline typename EnableIf< And< UseVectorizedDefaultKernel<MT3,MT4,MT5>
+                                       , Not< UsePackedKernel<MT3,MT4,MT5> > > >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
       // TODO
@@ -3937,7 +4052,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    */
    template< typename MT  // Type of the target dense matrix
            , bool SO >    // Storage order of the target dense matrix
-   friend inline typename EnableIf< IsEvaluationRequired<MT,MT1,MT2> >::Type
+   friend inline typename EnableIf< And< IsEvaluationRequired<MT,MT1,MT2>
+                                       , Not< UseTaskGraph<MT,MT1,MT2> > > >::Type
       smpAssign( DenseMatrix<MT,SO>& lhs, const DMatTDMatMultExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
@@ -3968,6 +4084,53 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP assignment to dense matrices (task graph)***********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a dense matrix-transpose dense matrix multiplication with evaluated
+   //        operands to a dense matrix (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a dense matrix-transpose
+   // dense matrix multiplication expression to a dense matrix in case both matrix operands require
+   // an intermediate evaluation. The two operands are evaluated concurrently (see the
+   // smpConcurrentAssign() function) before the multiplication of the two temporaries is computed
+   // by the parallel multiplication kernel.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline typename EnableIf< UseTaskGraph<MT,MT1,MT2> >::Type
+      smpAssign( DenseMatrix<MT,SO>& lhs, const DMatTDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( (~lhs).rows() == 0UL || (~lhs).columns() == 0UL ) {
+         return;
+      }
+      else if( rhs.lhs_.columns() == 0UL ) {
+         reset( ~lhs );
+         return;
+      }
+
+      RT1 A( rhs.lhs_.rows(), rhs.lhs_.columns() );  // Evaluation of the left-hand side dense matrix operand
+      RT2 B( rhs.rhs_.rows(), rhs.rhs_.columns() );  // Evaluation of the right-hand side dense matrix operand
+
+      smpConcurrentAssign( A, rhs.lhs_, B, rhs.rhs_ );
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns(), "Invalid number of columns" );
+
+      smpAssign( ~lhs, A * B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to sparse matrices***********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP assignment of a dense matrix-transpose dense matrix multiplication to a sparse
@@ -4293,6 +4456,18 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the vectorized default kernel can be used and neither of the two matrix operands
+       is triangular, the nested \value will be set to 1 and the packed matrix multiplication
+       kernel is selected for large matrices. Otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   struct UsePackedKernel {
+      enum { value = UseVectorizedDefaultKernel<T1,T2,T3,T4>::value &&
+                     !IsTriangular<T2>::value && !IsTriangular<T3>::value };
+   };
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef DMatScalarMultExpr<MMM,ST,false>            This;           //!< Type of this DMatScalarMultExpr instance.
@@ -5031,14 +5206,14 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType b2( B.load(k,j+1UL) );
                const IntrinsicType b3( B.load(k,j+2UL) );
                const IntrinsicType b4( B.load(k,j+3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C)(i    ,j    ) = sum( xmm1 ) * scalar;
@@ -5067,10 +5242,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) = sum( xmm1 ) * scalar;
@@ -5090,8 +5265,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) = sum( xmm1 ) * scalar;
@@ -5114,10 +5289,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
-               xmm3 = xmm3 + a1 * B.load(k,j+2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+3UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+3UL), xmm4 );
             }
 
             (~C)(i,j    ) = sum( xmm1 ) * scalar;
@@ -5137,8 +5312,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) = sum( xmm1 ) * scalar;
@@ -5154,7 +5329,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) = sum( xmm1 ) * scalar;
@@ -5215,14 +5390,14 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a4( A.load(i+3UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
-               xmm5 = xmm5 + a3 * b1;
-               xmm6 = xmm6 + a3 * b2;
-               xmm7 = xmm7 + a4 * b1;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
+               xmm5 = fmadd( a3, b1, xmm5 );
+               xmm6 = fmadd( a3, b2, xmm6 );
+               xmm7 = fmadd( a4, b1, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C)(i    ,j    ) = sum( xmm1 ) * scalar;
@@ -5246,10 +5421,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
-               xmm3 = xmm3 + A.load(i+2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+3UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+3UL,k), b1, xmm4 );
             }
 
             (~C)(i    ,j) = sum( xmm1 ) * scalar;
@@ -5279,10 +5454,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) = sum( xmm1 ) * scalar;
@@ -5302,8 +5477,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) = sum( xmm1 ) * scalar;
@@ -5326,8 +5501,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) = sum( xmm1 ) * scalar;
@@ -5343,7 +5518,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) = sum( xmm1 ) * scalar;
@@ -5377,6 +5552,31 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    }
    //**********************************************************************************************
 
+   //**Packed assignment to dense matrices (large matrices)****************************************
+   /*!\brief Packed assignment of a large scaled dense matrix-transpose dense matrix
+   //        multiplication (\f$ C=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function relays to the packed, register-blocked matrix multiplication kernel for
+   // large dense matrices (see the mmm() function).
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline typename EnableIf< UsePackedKernel<MT3,MT4,MT5,ST2> >::Type
+      selectLargeAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
+   {
+      mmm( C, A, B, scalar, ElementType(0) );
+   }
+   //**********************************************************************************************
+
    //**Vectorized default assignment to row-major dense matrices (large matrices)******************
    /*!\brief Vectorized default assignment of a large scaled dense matrix-transpose dense matrix
    //        multiplication (\f$ C=s*A*B \f$).
@@ -5396,7 +5596,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5    // Type of the right-hand side matrix operand
            , typename ST2 >  // Type of the scalar value
-   static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
+   static inline typename EnableIf< And< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2>
+                                       , Not< UsePackedKernel<MT3,MT4,MT5,ST2> > > >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       // TODO
@@ -5423,7 +5624,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5    // Type of the right-hand side matrix operand
            , typename ST2 >  // Type of the scalar value
-   static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
+   static inline typename EnableIf< And< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2>
+                                       , Not< UsePackedKernel<MT3,MT4,MT5,ST2> > > >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       // TODO
@@ -6036,14 +6238,14 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType b2( B.load(k,j+1UL) );
                const IntrinsicType b3( B.load(k,j+2UL) );
                const IntrinsicType b4( B.load(k,j+3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C)(i    ,j    ) += sum( xmm1 ) * scalar;
@@ -6072,10 +6274,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) += sum( xmm1 ) * scalar;
@@ -6095,8 +6297,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) += sum( xmm1 ) * scalar;
@@ -6119,10 +6321,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
-               xmm3 = xmm3 + a1 * B.load(k,j+2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+3UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+3UL), xmm4 );
             }
 
             (~C)(i,j    ) += sum( xmm1 ) * scalar;
@@ -6142,8 +6344,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) += sum( xmm1 ) * scalar;
@@ -6159,7 +6361,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) += sum( xmm1 ) * scalar;
@@ -6220,14 +6422,14 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a4( A.load(i+3UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
-               xmm5 = xmm5 + a3 * b1;
-               xmm6 = xmm6 + a3 * b2;
-               xmm7 = xmm7 + a4 * b1;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
+               xmm5 = fmadd( a3, b1, xmm5 );
+               xmm6 = fmadd( a3, b2, xmm6 );
+               xmm7 = fmadd( a4, b1, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C)(i    ,j    ) += sum( xmm1 ) * scalar;
@@ -6251,10 +6453,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
-               xmm3 = xmm3 + A.load(i+2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+3UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+3UL,k), b1, xmm4 );
             }
 
             (~C)(i    ,j) += sum( xmm1 ) * scalar;
@@ -6284,10 +6486,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) += sum( xmm1 ) * scalar;
@@ -6307,8 +6509,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) += sum( xmm1 ) * scalar;
@@ -6331,8 +6533,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) += sum( xmm1 ) * scalar;
@@ -6348,7 +6550,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) += sum( xmm1 ) * scalar;
@@ -6382,6 +6584,31 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    }
    //**********************************************************************************************
 
+   //**Packed addition assignment to dense matrices (large matrices)*******************************
+   /*!\brief Packed addition assignment of a large scaled dense matrix-transpose dense matrix
+   //        multiplication (\f$ C+=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function relays to the packed, register-blocked matrix multiplication kernel for
+   // large dense matrices (see the mmm() function).
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline typename EnableIf< UsePackedKernel<MT3,MT4,MT5,ST2> >::Type
+      selectLargeAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
+   {
+      mmm( C, A, B, scalar, ElementType(1) );
+   }
+   //**********************************************************************************************
+
    //**Vectorized default addition assignment to row-major dense matrices (large matrices)*********
    /*!\brief Vectorized default addition assignment of a large scaled dense matrix-transpose dense
    //        matrix multiplication (\f$ C+=s*A*B \f$).
@@ -6401,7 +6628,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5    // Type of the right-hand side matrix operand
            , typename ST2 >  // Type of the scalar value
-   static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
+   static inline typename EnableIf< And< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2>
+                                       , Not< UsePackedKernel<MT3,MT4,MT5,ST2> > > >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       // TODO
@@ -6428,7 +6656,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5    // Type of the right-hand side matrix operand
            , typename ST2 >  // Type of the scalar value
-   static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
+   static inline typename EnableIf< And< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2>
+                                       , Not< UsePackedKernel<MT3,MT4,MT5,ST2> > > >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       // TODO
@@ -7020,14 +7249,14 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType b2( B.load(k,j+1UL) );
                const IntrinsicType b3( B.load(k,j+2UL) );
                const IntrinsicType b4( B.load(k,j+3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C)(i    ,j    ) -= sum( xmm1 ) * scalar;
@@ -7056,10 +7285,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) -= sum( xmm1 ) * scalar;
@@ -7079,8 +7308,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) -= sum( xmm1 ) * scalar;
@@ -7103,10 +7332,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
-               xmm3 = xmm3 + a1 * B.load(k,j+2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+3UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+3UL), xmm4 );
             }
 
             (~C)(i,j    ) -= sum( xmm1 ) * scalar;
@@ -7126,8 +7355,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) -= sum( xmm1 ) * scalar;
@@ -7143,7 +7372,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) -= sum( xmm1 ) * scalar;
@@ -7205,14 +7434,14 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a4( A.load(i+3UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
-               xmm5 = xmm5 + a3 * b1;
-               xmm6 = xmm6 + a3 * b2;
-               xmm7 = xmm7 + a4 * b1;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
+               xmm5 = fmadd( a3, b1, xmm5 );
+               xmm6 = fmadd( a3, b2, xmm6 );
+               xmm7 = fmadd( a4, b1, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C)(i    ,j    ) -= sum( xmm1 ) * scalar;
@@ -7236,10 +7465,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
-               xmm3 = xmm3 + A.load(i+2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+3UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+3UL,k), b1, xmm4 );
             }
 
             (~C)(i    ,j) -= sum( xmm1 ) * scalar;
@@ -7269,10 +7498,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) -= sum( xmm1 ) * scalar;
@@ -7292,8 +7521,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) -= sum( xmm1 ) * scalar;
@@ -7316,8 +7545,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) -= sum( xmm1 ) * scalar;
@@ -7333,7 +7562,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) -= sum( xmm1 ) * scalar;
@@ -7367,6 +7596,31 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    }
    //**********************************************************************************************
 
+   //**Packed subtraction assignment to dense matrices (large matrices)****************************
+   /*!\brief Packed subtraction assignment of a large scaled dense matrix-transpose dense matrix
+   //        multiplication (\f$ C-=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function relays to the packed, register-blocked matrix multiplication kernel for
+   // large dense matrices (see the mmm() function).
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline typename EnableIf< UsePackedKernel<MT3,MT4,MT5,ST2> >::Type
+      selectLargeSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
+   {
+      mmm( C, A, B, ElementType( -scalar ), ElementType(1) );
+   }
+   //**********************************************************************************************
+
    //**Vectorized default subtraction assignment to row-major dense matrices (large matrices)******
    /*!\brief Vectorized default subtraction assignment of a large scaled dense matrix-transpose
    //        dense matrix multiplication (\f$ C-=s*A*B \f$).
@@ -7386,7 +7640,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5    // Type of the right-hand side matrix operand
            , typename ST2 >  // Type of the scalar value
-   static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
+   static inline typename EnableIf< And< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2>
+                                       , Not< UsePackedKernel<MT3,MT4,MT5,ST2> > > >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       // TODO
@@ -7413,7 +7668,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5    // Type of the right-hand side matrix operand
            , typename ST2 >  // Type of the scalar value
-   static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
+   static inline typename EnableIf< And< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2>
+                                       , Not< UsePackedKernel<MT3,MT4,MT5,ST2> > > >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       // TODO
@@ -574,6 +574,25 @@ class DVecScalarMultExpr : public DenseVector< DVecScalarMultExpr<VT,ST,TF>, TF
    //**********************************************************************************************
 
  private:
+   //**Fused evaluation strategy*******************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The UseFusedAssign struct is a helper struct for the selection of the fused addition and
+       subtraction assignment kernels. In case the dense vector operand does not require an
+       intermediate evaluation and both the target vector and the expression are vectorizable
+       for the same element type, \a value is set to 1 and the scaled vector is accumulated into
+       the target via fused multiply-add operations (\f$ \vec{y} += \alpha \cdot \vec{x} \f$).
+       Otherwise \a value is set to 0 and the default strategy is chosen. */
+   template< typename VT2 >
+   struct UseFusedAssign {
+      enum { value = !useAssign && vectorizable && VT2::vectorizable &&
+                     IsSame<typename VT2::ElementType,ElementType>::value &&
+                     IntrinsicTrait<ElementType>::addition &&
+                     IntrinsicTrait<ElementType>::subtraction };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    LeftOperand  vector_;  //!< Left-hand side dense vector of the multiplication expression.
    RightOperand scalar_;  //!< Right-hand side scalar of the multiplication expression.
@@ -667,6 +686,54 @@ class DVecScalarMultExpr : public DenseVector< DVecScalarMultExpr<VT,ST,TF>, TF
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Fused addition assignment to dense vectors**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Fused addition assignment of a dense vector-scalar multiplication to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the fused addition assignment of a dense vector-scalar
+   // multiplication expression to a dense vector (i.e. the \c axpy operation). Instead of
+   // forming the scaled vector first, each intrinsic element of the vector operand is combined
+   // with the scalar and the target in a single fmadd() operation. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler
+   // in case the vector operand does not require an intermediate evaluation and both operands
+   // are vectorizable.
+   */
+   template< typename VT2 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseFusedAssign<VT2> >::Type
+      addAssign( DenseVector<VT2,TF>& lhs, const DVecScalarMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      typedef IntrinsicTrait<ElementType>  IT;
+
+      const size_t n( (~lhs).size() );
+      const size_t ipos( n & size_t(-IT::size*4) );
+      BLAZE_INTERNAL_ASSERT( ( n - ( n % (IT::size*4UL) ) ) == ipos, "Invalid end calculation" );
+
+      const IntrinsicType factor( set( rhs.scalar_ ) );
+
+      size_t i( 0UL );
+
+      for( ; i<ipos; i+=IT::size*4UL ) {
+         (~lhs).store( i             , fmadd( rhs.vector_.load(i             ), factor, (~lhs).load(i             ) ) );
+         (~lhs).store( i+IT::size    , fmadd( rhs.vector_.load(i+IT::size    ), factor, (~lhs).load(i+IT::size    ) ) );
+         (~lhs).store( i+IT::size*2UL, fmadd( rhs.vector_.load(i+IT::size*2UL), factor, (~lhs).load(i+IT::size*2UL) ) );
+         (~lhs).store( i+IT::size*3UL, fmadd( rhs.vector_.load(i+IT::size*3UL), factor, (~lhs).load(i+IT::size*3UL) ) );
+      }
+      for( ; i<n; i+=IT::size ) {
+         (~lhs).store( i, fmadd( rhs.vector_.load(i), factor, (~lhs).load(i) ) );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Addition assignment to sparse vectors*******************************************************
    // No special implementation for the addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -703,6 +770,54 @@ class DVecScalarMultExpr : public DenseVector< DVecScalarMultExpr<VT,ST,TF>, TF
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Fused subtraction assignment to dense vectors***********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Fused subtraction assignment of a dense vector-scalar multiplication to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the fused subtraction assignment of a dense vector-scalar
+   // multiplication expression to a dense vector (i.e. the \c axpy operation). Instead of
+   // forming the scaled vector first, each intrinsic element of the vector operand is combined
+   // with the scalar and the target in a single fnmadd() operation. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler
+   // in case the vector operand does not require an intermediate evaluation and both operands
+   // are vectorizable.
+   */
+   template< typename VT2 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseFusedAssign<VT2> >::Type
+      subAssign( DenseVector<VT2,TF>& lhs, const DVecScalarMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      typedef IntrinsicTrait<ElementType>  IT;
+
+      const size_t n( (~lhs).size() );
+      const size_t ipos( n & size_t(-IT::size*4) );
+      BLAZE_INTERNAL_ASSERT( ( n - ( n % (IT::size*4UL) ) ) == ipos, "Invalid end calculation" );
+
+      const IntrinsicType factor( set( rhs.scalar_ ) );
+
+      size_t i( 0UL );
+
+      for( ; i<ipos; i+=IT::size*4UL ) {
+         (~lhs).store( i             , fnmadd( rhs.vector_.load(i             ), factor, (~lhs).load(i             ) ) );
+         (~lhs).store( i+IT::size    , fnmadd( rhs.vector_.load(i+IT::size    ), factor, (~lhs).load(i+IT::size    ) ) );
+         (~lhs).store( i+IT::size*2UL, fnmadd( rhs.vector_.load(i+IT::size*2UL), factor, (~lhs).load(i+IT::size*2UL) ) );
+         (~lhs).store( i+IT::size*3UL, fnmadd( rhs.vector_.load(i+IT::size*3UL), factor, (~lhs).load(i+IT::size*3UL) ) );
+      }
+      for( ; i<n; i+=IT::size ) {
+         (~lhs).store( i, fnmadd( rhs.vector_.load(i), factor, (~lhs).load(i) ) );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse vectors****************************************************
    // No special implementation for the subtraction assignment to sparse vectors.
    //**********************************************************************************************
@@ -53,10 +53,12 @@
 #include <blaze/math/expressions/MatVecMultExpr.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/SpMV.h>
 #include <blaze/math/traits/MultExprTrait.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/traits/SubmatrixExprTrait.h>
 #include <blaze/math/traits/SubvectorExprTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsMatMatMultExpr.h>
@@ -71,6 +73,7 @@
 #include <blaze/util/logging/FunctionTrace.h>
 #include <blaze/util/SelectType.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
 
@@ -147,6 +150,23 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case neither operand requires an intermediate evaluation, the rows of the sparse matrix
+       operand can be accessed directly (see SpMVTrait), the dense vector operand provides
+       low-level data access, and the element types of both operands are numeric data types, the
+       nested \value will be set to 1 and the direct row kernels will be used. Otherwise it will
+       be 0 and the expression will be evaluated via the subscript operator. */
+   template< typename T1 >
+   struct UseSpMVKernel {
+      enum { value = !useAssign && SpMVTrait<MT>::value && HasConstDataAccess<VT>::value &&
+                     IsNumeric<typename MT::ElementType>::value &&
+                     IsNumeric<typename VT::ElementType>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef SMatDVecMultExpr<MT,VT>             This;           //!< Type of this SMatDVecMultExpr instance.
@@ -393,6 +413,36 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Assignment to dense vectors (direct kernel)*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a sparse matrix-dense vector multiplication to a dense vector
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the assignment of a row-major compressed matrix-dense vector
+   // multiplication expression to a dense vector by means of the direct row kernels (see the
+   // spmv() function). Due to the explicit application of the SFINAE principle, this function
+   // can only be selected by the compiler in case neither operand requires an intermediate
+   // evaluation, the rows of the sparse matrix can be accessed directly, and the dense vector
+   // provides low-level data access.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseSpMVKernel<VT1> >::Type
+      assign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      spmv<ElementType>( ~lhs, rhs.mat_, rhs.vec_.data(), SpMVAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse vectors****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a sparse matrix-dense vector multiplication to a sparse vector
@@ -470,6 +520,36 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Addition assignment to dense vectors (direct kernel)****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a sparse matrix-dense vector multiplication to a dense vector
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the addition assignment of a row-major compressed matrix-dense vector
+   // multiplication expression to a dense vector by means of the direct row kernels (see the
+   // spmv() function). Due to the explicit application of the SFINAE principle, this function
+   // can only be selected by the compiler in case neither operand requires an intermediate
+   // evaluation, the rows of the sparse matrix can be accessed directly, and the dense vector
+   // provides low-level data access.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseSpMVKernel<VT1> >::Type
+      addAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      spmv<ElementType>( ~lhs, rhs.mat_, rhs.vec_.data(), SpMVAddAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Addition assignment to sparse vectors*******************************************************
    // No special implementation for the addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -517,6 +597,36 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Subtraction assignment to dense vectors (direct kernel)*************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a sparse matrix-dense vector multiplication to a dense vector
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the subtraction assignment of a row-major compressed matrix-dense vector
+   // multiplication expression to a dense vector by means of the direct row kernels (see the
+   // spmv() function). Due to the explicit application of the SFINAE principle, this function
+   // can only be selected by the compiler in case neither operand requires an intermediate
+   // evaluation, the rows of the sparse matrix can be accessed directly, and the dense vector
+   // provides low-level data access.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseSpMVKernel<VT1> >::Type
+      subAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      spmv<ElementType>( ~lhs, rhs.mat_, rhs.vec_.data(), SpMVSubAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse vectors****************************************************
    // No special implementation for the subtraction assignment to sparse vectors.
    //**********************************************************************************************
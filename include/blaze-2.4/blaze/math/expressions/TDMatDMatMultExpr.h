@@ -45,6 +45,7 @@
 #include <blaze/math/constraints/DenseMatrix.h>
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/dense/MMM.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Forward.h>
@@ -69,6 +70,7 @@
 #include <blaze/math/typetraits/Columns.h>
 #include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsAdaptor.h>
 #include <blaze/math/typetraits/IsColumnMajorMatrix.h>
 #include <blaze/math/typetraits/IsColumnVector.h>
 #include <blaze/math/typetraits/IsComputation.h>
@@ -77,6 +79,7 @@
 #include <blaze/math/typetraits/IsDiagonal.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/math/typetraits/IsRowVector.h>
 #include <blaze/math/typetraits/IsSparseVector.h>
@@ -167,6 +170,23 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The UseTaskGraph struct is a helper struct for the selection of the parallel evaluation
+       strategy. In case both matrix operands require an intermediate evaluation into resizable
+       dense matrices, the two operands are evaluated concurrently and the nested \a value will
+       be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseTaskGraph {
+      enum { value = evaluateLeft && evaluateRight &&
+                     IsEvaluationRequired<T1,T2,T3>::value &&
+                     IsResizable<RT1>::value && !IsAdaptor<RT1>::value &&
+                     IsResizable<RT2>::value && !IsAdaptor<RT2>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper structure for the explicit application of the SFINAE principle.
@@ -1059,14 +1079,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 + a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 + a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 + a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 + a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -1106,14 +1126,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C).store( i    , j             , xmm1 );
@@ -1139,10 +1159,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -1176,10 +1196,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i    , j         , xmm1 );
@@ -1201,8 +1221,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j         );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size);
+               xmm1 = fmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
             (~C).store( i, j         , xmm1 );
@@ -1229,8 +1249,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 + set( A(i+1UL,k) ) * b1;
+               xmm1 = fmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
             (~C).store( i    , j, xmm1 );
@@ -1248,7 +1268,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + set( A(i,k) ) * B.load(k,j);
+               xmm1 = fmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -1305,14 +1325,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 + A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 + A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 + A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 + A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -1352,14 +1372,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a3 * b1;
-               xmm4 = xmm4 + a4 * b1;
-               xmm5 = xmm5 + a1 * b2;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a3 * b2;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a3, b1, xmm3 );
+               xmm4 = fmadd( a4, b1, xmm4 );
+               xmm5 = fmadd( a1, b2, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a3, b2, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C).store( i             , j    , xmm1 );
@@ -1385,10 +1405,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -1422,10 +1442,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a1 * b2;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a1, b2, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i         , j    , xmm1 );
@@ -1447,8 +1467,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i         ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size,k) * b1;
+               xmm1 = fmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
             (~C).store( i         , j, xmm1 );
@@ -1475,8 +1495,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * set( B(k,j    ) );
-               xmm2 = xmm2 + a1 * set( B(k,j+1UL) );
+               xmm1 = fmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
             (~C).store( i, j    , xmm1 );
@@ -1494,7 +1514,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + A.load(i,k) * set( B(k,j) );
+               xmm1 = fmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -1551,14 +1571,15 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
       typedef IntrinsicTrait<ElementType>  IT;
+      typedef MMMTrait<ElementType>        MMMT;
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
       const size_t K( A.columns() );
 
-      const size_t iblock(  64UL );
-      const size_t jblock( 128UL );
-      const size_t kblock( 128UL );
+      const size_t iblock( MMMT::sblock() );
+      const size_t jblock( MMMT::vblock() );
+      const size_t kblock( MMMT::kblock() );
 
       for( size_t jj=0UL; jj<N; jj+=jblock )
       {
@@ -1611,14 +1632,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                         const IntrinsicType b2( B.load(k,j1) );
                         const IntrinsicType b3( B.load(k,j2) );
                         const IntrinsicType b4( B.load(k,j3) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a1 * b2;
-                        xmm3 = xmm3 + a1 * b3;
-                        xmm4 = xmm4 + a1 * b4;
-                        xmm5 = xmm5 + a2 * b1;
-                        xmm6 = xmm6 + a2 * b2;
-                        xmm7 = xmm7 + a2 * b3;
-                        xmm8 = xmm8 + a2 * b4;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a1, b2, xmm2 );
+                        xmm3 = fmadd( a1, b3, xmm3 );
+                        xmm4 = fmadd( a1, b4, xmm4 );
+                        xmm5 = fmadd( a2, b1, xmm5 );
+                        xmm6 = fmadd( a2, b2, xmm6 );
+                        xmm7 = fmadd( a2, b3, xmm7 );
+                        xmm8 = fmadd( a2, b4, xmm8 );
                      }
 
                      (~C).store( i    , j , xmm1 );
@@ -1645,10 +1666,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 + a1 * B.load(k,j );
-                        xmm2 = xmm2 + a1 * B.load(k,j1);
-                        xmm3 = xmm3 + a1 * B.load(k,j2);
-                        xmm4 = xmm4 + a1 * B.load(k,j3);
+                        xmm1 = fmadd( a1, B.load(k,j ), xmm1 );
+                        xmm2 = fmadd( a1, B.load(k,j1), xmm2 );
+                        xmm3 = fmadd( a1, B.load(k,j2), xmm3 );
+                        xmm4 = fmadd( a1, B.load(k,j3), xmm4 );
                      }
 
                      (~C).store( i, j , xmm1 );
@@ -1687,14 +1708,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                         const IntrinsicType a4( set( A(i+3UL,k) ) );
                         const IntrinsicType b1( B.load(k,j ) );
                         const IntrinsicType b2( B.load(k,j1) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a1 * b2;
-                        xmm3 = xmm3 + a2 * b1;
-                        xmm4 = xmm4 + a2 * b2;
-                        xmm5 = xmm5 + a3 * b1;
-                        xmm6 = xmm6 + a3 * b2;
-                        xmm7 = xmm7 + a4 * b1;
-                        xmm8 = xmm8 + a4 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a1, b2, xmm2 );
+                        xmm3 = fmadd( a2, b1, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
+                        xmm5 = fmadd( a3, b1, xmm5 );
+                        xmm6 = fmadd( a3, b2, xmm6 );
+                        xmm7 = fmadd( a4, b1, xmm7 );
+                        xmm8 = fmadd( a4, b2, xmm8 );
                      }
 
                      (~C).store( i    , j , xmm1 );
@@ -1724,10 +1745,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                         const IntrinsicType a2( set( A(i+1UL,k) ) );
                         const IntrinsicType b1( B.load(k,j ) );
                         const IntrinsicType b2( B.load(k,j1) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a1 * b2;
-                        xmm3 = xmm3 + a2 * b1;
-                        xmm4 = xmm4 + a2 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a1, b2, xmm2 );
+                        xmm3 = fmadd( a2, b1, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
                      }
 
                      (~C).store( i    , j , xmm1 );
@@ -1748,8 +1769,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 + a1 * B.load(k,j );
-                        xmm2 = xmm2 + a1 * B.load(k,j1);
+                        xmm1 = fmadd( a1, B.load(k,j ), xmm1 );
+                        xmm2 = fmadd( a1, B.load(k,j1), xmm2 );
                      }
 
                      (~C).store( i, j , xmm1 );
@@ -1770,7 +1791,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 + a1 * B.load(k,j);
+                        xmm1 = fmadd( a1, B.load(k,j), xmm1 );
                      }
 
                      (~C).store( i, j, xmm1 );
@@ -1805,14 +1826,15 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
       typedef IntrinsicTrait<ElementType>  IT;
+      typedef MMMTrait<ElementType>        MMMT;
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
       const size_t K( A.columns() );
 
-      const size_t iblock( 128UL );
-      const size_t jblock(  64UL );
-      const size_t kblock( 128UL );
+      const size_t iblock( MMMT::vblock() );
+      const size_t jblock( MMMT::sblock() );
+      const size_t kblock( MMMT::kblock() );
 
       for( size_t ii=0UL; ii<M; ii+=iblock )
       {
@@ -1865,14 +1887,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                         const IntrinsicType a4( A.load(i3,k) );
                         const IntrinsicType b1( set( B(k,j    ) ) );
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a2 * b1;
-                        xmm3 = xmm3 + a3 * b1;
-                        xmm4 = xmm4 + a4 * b1;
-                        xmm5 = xmm5 + a1 * b2;
-                        xmm6 = xmm6 + a2 * b2;
-                        xmm7 = xmm7 + a3 * b2;
-                        xmm8 = xmm8 + a4 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a2, b1, xmm2 );
+                        xmm3 = fmadd( a3, b1, xmm3 );
+                        xmm4 = fmadd( a4, b1, xmm4 );
+                        xmm5 = fmadd( a1, b2, xmm5 );
+                        xmm6 = fmadd( a2, b2, xmm6 );
+                        xmm7 = fmadd( a3, b2, xmm7 );
+                        xmm8 = fmadd( a4, b2, xmm8 );
                      }
 
                      (~C).store( i , j    , xmm1 );
@@ -1899,10 +1921,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 + A.load(i ,k) * b1;
-                        xmm2 = xmm2 + A.load(i1,k) * b1;
-                        xmm3 = xmm3 + A.load(i2,k) * b1;
-                        xmm4 = xmm4 + A.load(i3,k) * b1;
+                        xmm1 = fmadd( A.load(i ,k), b1, xmm1 );
+                        xmm2 = fmadd( A.load(i1,k), b1, xmm2 );
+                        xmm3 = fmadd( A.load(i2,k), b1, xmm3 );
+                        xmm4 = fmadd( A.load(i3,k), b1, xmm4 );
                      }
 
                      (~C).store( i , j, xmm1 );
@@ -1941,14 +1963,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
                         const IntrinsicType b3( set( B(k,j+2UL) ) );
                         const IntrinsicType b4( set( B(k,j+3UL) ) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a2 * b1;
-                        xmm3 = xmm3 + a1 * b2;
-                        xmm4 = xmm4 + a2 * b2;
-                        xmm5 = xmm5 + a1 * b3;
-                        xmm6 = xmm6 + a2 * b3;
-                        xmm7 = xmm7 + a1 * b4;
-                        xmm8 = xmm8 + a2 * b4;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a2, b1, xmm2 );
+                        xmm3 = fmadd( a1, b2, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
+                        xmm5 = fmadd( a1, b3, xmm5 );
+                        xmm6 = fmadd( a2, b3, xmm6 );
+                        xmm7 = fmadd( a1, b4, xmm7 );
+                        xmm8 = fmadd( a2, b4, xmm8 );
                      }
 
                      (~C).store( i , j    , xmm1 );
@@ -1978,10 +2000,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                         const IntrinsicType a2( A.load(i1,k) );
                         const IntrinsicType b1( set( B(k,j    ) ) );
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a2 * b1;
-                        xmm3 = xmm3 + a1 * b2;
-                        xmm4 = xmm4 + a2 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a2, b1, xmm2 );
+                        xmm3 = fmadd( a1, b2, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
                      }
 
                      (~C).store( i , j    , xmm1 );
@@ -2002,8 +2024,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 + A.load(i ,k) * b1;
-                        xmm2 = xmm2 + A.load(i1,k) * b1;
+                        xmm1 = fmadd( A.load(i ,k), b1, xmm1 );
+                        xmm2 = fmadd( A.load(i1,k), b1, xmm2 );
                      }
 
                      (~C).store( i , j, xmm1 );
@@ -2024,7 +2046,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 + A.load(i,k) * b1;
+                        xmm1 = fmadd( A.load(i,k), b1, xmm1 );
                      }
 
                      (~C).store( i, j, xmm1 );
@@ -2739,14 +2761,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 + a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 + a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 + a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 + a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -2793,14 +2815,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C).store( i    , j             , xmm1 );
@@ -2829,10 +2851,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -2869,10 +2891,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i    , j         , xmm1 );
@@ -2895,8 +2917,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j         );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size);
+               xmm1 = fmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
             (~C).store( i, j         , xmm1 );
@@ -2924,8 +2946,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 + set( A(i+1UL,k) ) * b1;
+               xmm1 = fmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
             (~C).store( i    , j, xmm1 );
@@ -2943,7 +2965,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
             IntrinsicType xmm1( (~C).load(i,j) );
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + set( A(i,k) ) * B.load(k,j);
+               xmm1 = fmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -3007,14 +3029,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 + A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 + A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 + A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 + A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -3061,14 +3083,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a3 * b1;
-               xmm4 = xmm4 + a4 * b1;
-               xmm5 = xmm5 + a1 * b2;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a3 * b2;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a3, b1, xmm3 );
+               xmm4 = fmadd( a4, b1, xmm4 );
+               xmm5 = fmadd( a1, b2, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a3, b2, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C).store( i             , j    , xmm1 );
@@ -3097,10 +3119,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -3137,10 +3159,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a1 * b2;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a1, b2, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i         , j    , xmm1 );
@@ -3163,8 +3185,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i         ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size,k) * b1;
+               xmm1 = fmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
             (~C).store( i         , j, xmm1 );
@@ -3192,8 +3214,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * set( B(k,j    ) );
-               xmm2 = xmm2 + a1 * set( B(k,j+1UL) );
+               xmm1 = fmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
             (~C).store( i, j    , xmm1 );
@@ -3211,7 +3233,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
             IntrinsicType xmm1( (~C).load(i,j) );
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + A.load(i,k) * set( B(k,j) );
+               xmm1 = fmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -3268,14 +3290,15 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
       typedef IntrinsicTrait<ElementType>  IT;
+      typedef MMMTrait<ElementType>        MMMT;
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
       const size_t K( A.columns() );
 
-      const size_t iblock(  64UL );
-      const size_t jblock( 128UL );
-      const size_t kblock( 128UL );
+      const size_t iblock( MMMT::sblock() );
+      const size_t jblock( MMMT::vblock() );
+      const size_t kblock( MMMT::kblock() );
 
       for( size_t jj=0UL; jj<N; jj+=jblock )
       {
@@ -3322,14 +3345,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                         const IntrinsicType b2( B.load(k,j1) );
                         const IntrinsicType b3( B.load(k,j2) );
                         const IntrinsicType b4( B.load(k,j3) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a1 * b2;
-                        xmm3 = xmm3 + a1 * b3;
-                        xmm4 = xmm4 + a1 * b4;
-                        xmm5 = xmm5 + a2 * b1;
-                        xmm6 = xmm6 + a2 * b2;
-                        xmm7 = xmm7 + a2 * b3;
-                        xmm8 = xmm8 + a2 * b4;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a1, b2, xmm2 );
+                        xmm3 = fmadd( a1, b3, xmm3 );
+                        xmm4 = fmadd( a1, b4, xmm4 );
+                        xmm5 = fmadd( a2, b1, xmm5 );
+                        xmm6 = fmadd( a2, b2, xmm6 );
+                        xmm7 = fmadd( a2, b3, xmm7 );
+                        xmm8 = fmadd( a2, b4, xmm8 );
                      }
 
                      (~C).store( i    , j , xmm1 );
@@ -3356,10 +3379,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 + a1 * B.load(k,j );
-                        xmm2 = xmm2 + a1 * B.load(k,j1);
-                        xmm3 = xmm3 + a1 * B.load(k,j2);
-                        xmm4 = xmm4 + a1 * B.load(k,j3);
+                        xmm1 = fmadd( a1, B.load(k,j ), xmm1 );
+                        xmm2 = fmadd( a1, B.load(k,j1), xmm2 );
+                        xmm3 = fmadd( a1, B.load(k,j2), xmm3 );
+                        xmm4 = fmadd( a1, B.load(k,j3), xmm4 );
                      }
 
                      (~C).store( i, j , xmm1 );
@@ -3398,14 +3421,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                         const IntrinsicType a4( set( A(i+3UL,k) ) );
                         const IntrinsicType b1( B.load(k,j ) );
                         const IntrinsicType b2( B.load(k,j1) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a1 * b2;
-                        xmm3 = xmm3 + a2 * b1;
-                        xmm4 = xmm4 + a2 * b2;
-                        xmm5 = xmm5 + a3 * b1;
-                        xmm6 = xmm6 + a3 * b2;
-                        xmm7 = xmm7 + a4 * b1;
-                        xmm8 = xmm8 + a4 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a1, b2, xmm2 );
+                        xmm3 = fmadd( a2, b1, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
+                        xmm5 = fmadd( a3, b1, xmm5 );
+                        xmm6 = fmadd( a3, b2, xmm6 );
+                        xmm7 = fmadd( a4, b1, xmm7 );
+                        xmm8 = fmadd( a4, b2, xmm8 );
                      }
 
                      (~C).store( i    , j , xmm1 );
@@ -3435,10 +3458,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                         const IntrinsicType a2( set( A(i+1UL,k) ) );
                         const IntrinsicType b1( B.load(k,j ) );
                         const IntrinsicType b2( B.load(k,j1) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a1 * b2;
-                        xmm3 = xmm3 + a2 * b1;
-                        xmm4 = xmm4 + a2 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a1, b2, xmm2 );
+                        xmm3 = fmadd( a2, b1, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
                      }
 
                      (~C).store( i    , j , xmm1 );
@@ -3459,8 +3482,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 + a1 * B.load(k,j );
-                        xmm2 = xmm2 + a1 * B.load(k,j1);
+                        xmm1 = fmadd( a1, B.load(k,j ), xmm1 );
+                        xmm2 = fmadd( a1, B.load(k,j1), xmm2 );
                      }
 
                      (~C).store( i, j , xmm1 );
@@ -3481,7 +3504,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 + a1 * B.load(k,j);
+                        xmm1 = fmadd( a1, B.load(k,j), xmm1 );
                      }
 
                      (~C).store( i, j, xmm1 );
@@ -3516,14 +3539,15 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
       typedef IntrinsicTrait<ElementType>  IT;
+      typedef MMMTrait<ElementType>        MMMT;
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
       const size_t K( A.columns() );
 
-      const size_t iblock( 128UL );
-      const size_t jblock(  64UL );
-      const size_t kblock( 128UL );
+      const size_t iblock( MMMT::vblock() );
+      const size_t jblock( MMMT::sblock() );
+      const size_t kblock( MMMT::kblock() );
 
       for( size_t ii=0UL; ii<M; ii+=iblock )
       {
@@ -3570,14 +3594,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                         const IntrinsicType a4( A.load(i3,k) );
                         const IntrinsicType b1( set( B(k,j    ) ) );
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a2 * b1;
-                        xmm3 = xmm3 + a3 * b1;
-                        xmm4 = xmm4 + a4 * b1;
-                        xmm5 = xmm5 + a1 * b2;
-                        xmm6 = xmm6 + a2 * b2;
-                        xmm7 = xmm7 + a3 * b2;
-                        xmm8 = xmm8 + a4 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a2, b1, xmm2 );
+                        xmm3 = fmadd( a3, b1, xmm3 );
+                        xmm4 = fmadd( a4, b1, xmm4 );
+                        xmm5 = fmadd( a1, b2, xmm5 );
+                        xmm6 = fmadd( a2, b2, xmm6 );
+                        xmm7 = fmadd( a3, b2, xmm7 );
+                        xmm8 = fmadd( a4, b2, xmm8 );
                      }
 
                      (~C).store( i , j    , xmm1 );
@@ -3604,10 +3628,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 + A.load(i ,k) * b1;
-                        xmm2 = xmm2 + A.load(i1,k) * b1;
-                        xmm3 = xmm3 + A.load(i2,k) * b1;
-                        xmm4 = xmm4 + A.load(i3,k) * b1;
+                        xmm1 = fmadd( A.load(i ,k), b1, xmm1 );
+                        xmm2 = fmadd( A.load(i1,k), b1, xmm2 );
+                        xmm3 = fmadd( A.load(i2,k), b1, xmm3 );
+                        xmm4 = fmadd( A.load(i3,k), b1, xmm4 );
                      }
 
                      (~C).store( i , j, xmm1 );
@@ -3646,14 +3670,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
                         const IntrinsicType b3( set( B(k,j+2UL) ) );
                         const IntrinsicType b4( set( B(k,j+3UL) ) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a2 * b1;
-                        xmm3 = xmm3 + a1 * b2;
-                        xmm4 = xmm4 + a2 * b2;
-                        xmm5 = xmm5 + a1 * b3;
-                        xmm6 = xmm6 + a2 * b3;
-                        xmm7 = xmm7 + a1 * b4;
-                        xmm8 = xmm8 + a2 * b4;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a2, b1, xmm2 );
+                        xmm3 = fmadd( a1, b2, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
+                        xmm5 = fmadd( a1, b3, xmm5 );
+                        xmm6 = fmadd( a2, b3, xmm6 );
+                        xmm7 = fmadd( a1, b4, xmm7 );
+                        xmm8 = fmadd( a2, b4, xmm8 );
                      }
 
                      (~C).store( i , j    , xmm1 );
@@ -3683,10 +3707,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                         const IntrinsicType a2( A.load(i1,k) );
                         const IntrinsicType b1( set( B(k,j    ) ) );
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a2 * b1;
-                        xmm3 = xmm3 + a1 * b2;
-                        xmm4 = xmm4 + a2 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a2, b1, xmm2 );
+                        xmm3 = fmadd( a1, b2, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
                      }
 
                      (~C).store( i , j    , xmm1 );
@@ -3707,8 +3731,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 + A.load(i ,k) * b1;
-                        xmm2 = xmm2 + A.load(i1,k) * b1;
+                        xmm1 = fmadd( A.load(i ,k), b1, xmm1 );
+                        xmm2 = fmadd( A.load(i1,k), b1, xmm2 );
                      }
 
                      (~C).store( i , j, xmm1 );
@@ -3729,7 +3753,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 + A.load(i,k) * b1;
+                        xmm1 = fmadd( A.load(i,k), b1, xmm1 );
                      }
 
                      (~C).store( i, j, xmm1 );
@@ -4419,14 +4443,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 - a1 * B.load(k,j             );
-               xmm2 = xmm2 - a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 - a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 - a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 - a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 - a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 - a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 - a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fnmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fnmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fnmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fnmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fnmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fnmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fnmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fnmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -4473,14 +4497,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 - a1 * b1;
-               xmm2 = xmm2 - a1 * b2;
-               xmm3 = xmm3 - a1 * b3;
-               xmm4 = xmm4 - a1 * b4;
-               xmm5 = xmm5 - a2 * b1;
-               xmm6 = xmm6 - a2 * b2;
-               xmm7 = xmm7 - a2 * b3;
-               xmm8 = xmm8 - a2 * b4;
+               xmm1 = fnmadd( a1, b1, xmm1 );
+               xmm2 = fnmadd( a1, b2, xmm2 );
+               xmm3 = fnmadd( a1, b3, xmm3 );
+               xmm4 = fnmadd( a1, b4, xmm4 );
+               xmm5 = fnmadd( a2, b1, xmm5 );
+               xmm6 = fnmadd( a2, b2, xmm6 );
+               xmm7 = fnmadd( a2, b3, xmm7 );
+               xmm8 = fnmadd( a2, b4, xmm8 );
             }
 
             (~C).store( i    , j             , xmm1 );
@@ -4509,10 +4533,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 - a1 * B.load(k,j             );
-               xmm2 = xmm2 - a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 - a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 - a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fnmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fnmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fnmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fnmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -4549,10 +4573,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 - a1 * b1;
-               xmm2 = xmm2 - a1 * b2;
-               xmm3 = xmm3 - a2 * b1;
-               xmm4 = xmm4 - a2 * b2;
+               xmm1 = fnmadd( a1, b1, xmm1 );
+               xmm2 = fnmadd( a1, b2, xmm2 );
+               xmm3 = fnmadd( a2, b1, xmm3 );
+               xmm4 = fnmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i    , j         , xmm1 );
@@ -4575,8 +4599,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 - a1 * B.load(k,j         );
-               xmm2 = xmm2 - a1 * B.load(k,j+IT::size);
+               xmm1 = fnmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fnmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
             (~C).store( i, j         , xmm1 );
@@ -4604,8 +4628,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 - set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 - set( A(i+1UL,k) ) * b1;
+               xmm1 = fnmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fnmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
             (~C).store( i    , j, xmm1 );
@@ -4623,7 +4647,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
             IntrinsicType xmm1( (~C).load(i,j) );
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 - set( A(i,k) ) * B.load(k,j);
+               xmm1 = fnmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -4687,14 +4711,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 - A.load(i             ,k) * b1;
-               xmm2 = xmm2 - A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 - A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 - A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 - A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 - A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 - A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 - A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fnmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fnmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fnmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fnmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fnmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fnmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fnmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fnmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -4741,14 +4765,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 - a1 * b1;
-               xmm2 = xmm2 - a2 * b1;
-               xmm3 = xmm3 - a3 * b1;
-               xmm4 = xmm4 - a4 * b1;
-               xmm5 = xmm5 - a1 * b2;
-               xmm6 = xmm6 - a2 * b2;
-               xmm7 = xmm7 - a3 * b2;
-               xmm8 = xmm8 - a4 * b2;
+               xmm1 = fnmadd( a1, b1, xmm1 );
+               xmm2 = fnmadd( a2, b1, xmm2 );
+               xmm3 = fnmadd( a3, b1, xmm3 );
+               xmm4 = fnmadd( a4, b1, xmm4 );
+               xmm5 = fnmadd( a1, b2, xmm5 );
+               xmm6 = fnmadd( a2, b2, xmm6 );
+               xmm7 = fnmadd( a3, b2, xmm7 );
+               xmm8 = fnmadd( a4, b2, xmm8 );
             }
 
             (~C).store( i             , j    , xmm1 );
@@ -4777,10 +4801,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 - A.load(i             ,k) * b1;
-               xmm2 = xmm2 - A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 - A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 - A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fnmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fnmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fnmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fnmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -4817,10 +4841,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 - a1 * b1;
-               xmm2 = xmm2 - a2 * b1;
-               xmm3 = xmm3 - a1 * b2;
-               xmm4 = xmm4 - a2 * b2;
+               xmm1 = fnmadd( a1, b1, xmm1 );
+               xmm2 = fnmadd( a2, b1, xmm2 );
+               xmm3 = fnmadd( a1, b2, xmm3 );
+               xmm4 = fnmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i         , j    , xmm1 );
@@ -4843,8 +4867,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 - A.load(i         ,k) * b1;
-               xmm2 = xmm2 - A.load(i+IT::size,k) * b1;
+               xmm1 = fnmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fnmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
             (~C).store( i         , j, xmm1 );
@@ -4872,8 +4896,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 - a1 * set( B(k,j    ) );
-               xmm2 = xmm2 - a1 * set( B(k,j+1UL) );
+               xmm1 = fnmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fnmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
             (~C).store( i, j    , xmm1 );
@@ -4891,7 +4915,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
             IntrinsicType xmm1( (~C).load(i,j) );
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 - A.load(i,k) * set( B(k,j) );
+               xmm1 = fnmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -4948,14 +4972,15 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
       typedef IntrinsicTrait<ElementType>  IT;
+      typedef MMMTrait<ElementType>        MMMT;
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
       const size_t K( A.columns() );
 
-      const size_t iblock(  64UL );
-      const size_t jblock( 128UL );
-      const size_t kblock( 128UL );
+      const size_t iblock( MMMT::sblock() );
+      const size_t jblock( MMMT::vblock() );
+      const size_t kblock( MMMT::kblock() );
 
       for( size_t jj=0UL; jj<N; jj+=jblock )
       {
@@ -5002,14 +5027,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                         const IntrinsicType b2( B.load(k,j1) );
                         const IntrinsicType b3( B.load(k,j2) );
                         const IntrinsicType b4( B.load(k,j3) );
-                        xmm1 = xmm1 - a1 * b1;
-                        xmm2 = xmm2 - a1 * b2;
-                        xmm3 = xmm3 - a1 * b3;
-                        xmm4 = xmm4 - a1 * b4;
-                        xmm5 = xmm5 - a2 * b1;
-                        xmm6 = xmm6 - a2 * b2;
-                        xmm7 = xmm7 - a2 * b3;
-                        xmm8 = xmm8 - a2 * b4;
+                        xmm1 = fnmadd( a1, b1, xmm1 );
+                        xmm2 = fnmadd( a1, b2, xmm2 );
+                        xmm3 = fnmadd( a1, b3, xmm3 );
+                        xmm4 = fnmadd( a1, b4, xmm4 );
+                        xmm5 = fnmadd( a2, b1, xmm5 );
+                        xmm6 = fnmadd( a2, b2, xmm6 );
+                        xmm7 = fnmadd( a2, b3, xmm7 );
+                        xmm8 = fnmadd( a2, b4, xmm8 );
                      }
 
                      (~C).store( i    , j , xmm1 );
@@ -5036,10 +5061,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 - a1 * B.load(k,j );
-                        xmm2 = xmm2 - a1 * B.load(k,j1);
-                        xmm3 = xmm3 - a1 * B.load(k,j2);
-                        xmm4 = xmm4 - a1 * B.load(k,j3);
+                        xmm1 = fnmadd( a1, B.load(k,j ), xmm1 );
+                        xmm2 = fnmadd( a1, B.load(k,j1), xmm2 );
+                        xmm3 = fnmadd( a1, B.load(k,j2), xmm3 );
+                        xmm4 = fnmadd( a1, B.load(k,j3), xmm4 );
                      }
 
                      (~C).store( i, j , xmm1 );
@@ -5078,14 +5103,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                         const IntrinsicType a4( set( A(i+3UL,k) ) );
                         const IntrinsicType b1( B.load(k,j ) );
                         const IntrinsicType b2( B.load(k,j1) );
-                        xmm1 = xmm1 - a1 * b1;
-                        xmm2 = xmm2 - a1 * b2;
-                        xmm3 = xmm3 - a2 * b1;
-                        xmm4 = xmm4 - a2 * b2;
-                        xmm5 = xmm5 - a3 * b1;
-                        xmm6 = xmm6 - a3 * b2;
-                        xmm7 = xmm7 - a4 * b1;
-                        xmm8 = xmm8 - a4 * b2;
+                        xmm1 = fnmadd( a1, b1, xmm1 );
+                        xmm2 = fnmadd( a1, b2, xmm2 );
+                        xmm3 = fnmadd( a2, b1, xmm3 );
+                        xmm4 = fnmadd( a2, b2, xmm4 );
+                        xmm5 = fnmadd( a3, b1, xmm5 );
+                        xmm6 = fnmadd( a3, b2, xmm6 );
+                        xmm7 = fnmadd( a4, b1, xmm7 );
+                        xmm8 = fnmadd( a4, b2, xmm8 );
                      }
 
                      (~C).store( i    , j , xmm1 );
@@ -5115,10 +5140,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                         const IntrinsicType a2( set( A(i+1UL,k) ) );
                         const IntrinsicType b1( B.load(k,j ) );
                         const IntrinsicType b2( B.load(k,j1) );
-                        xmm1 = xmm1 - a1 * b1;
-                        xmm2 = xmm2 - a1 * b2;
-                        xmm3 = xmm3 - a2 * b1;
-                        xmm4 = xmm4 - a2 * b2;
+                        xmm1 = fnmadd( a1, b1, xmm1 );
+                        xmm2 = fnmadd( a1, b2, xmm2 );
+                        xmm3 = fnmadd( a2, b1, xmm3 );
+                        xmm4 = fnmadd( a2, b2, xmm4 );
                      }
 
                      (~C).store( i    , j , xmm1 );
@@ -5139,8 +5164,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 - a1 * B.load(k,j );
-                        xmm2 = xmm2 - a1 * B.load(k,j1);
+                        xmm1 = fnmadd( a1, B.load(k,j ), xmm1 );
+                        xmm2 = fnmadd( a1, B.load(k,j1), xmm2 );
                      }
 
                      (~C).store( i, j , xmm1 );
@@ -5161,7 +5186,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 - a1 * B.load(k,j);
+                        xmm1 = fnmadd( a1, B.load(k,j), xmm1 );
                      }
 
                      (~C).store( i, j, xmm1 );
@@ -5196,14 +5221,15 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
       typedef IntrinsicTrait<ElementType>  IT;
+      typedef MMMTrait<ElementType>        MMMT;
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
       const size_t K( A.columns() );
 
-      const size_t iblock( 128UL );
-      const size_t jblock(  64UL );
-      const size_t kblock( 128UL );
+      const size_t iblock( MMMT::vblock() );
+      const size_t jblock( MMMT::sblock() );
+      const size_t kblock( MMMT::kblock() );
 
       for( size_t ii=0UL; ii<M; ii+=iblock )
       {
@@ -5250,14 +5276,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                         const IntrinsicType a4( A.load(i3,k) );
                         const IntrinsicType b1( set( B(k,j    ) ) );
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
-                        xmm1 = xmm1 - a1 * b1;
-                        xmm2 = xmm2 - a2 * b1;
-                        xmm3 = xmm3 - a3 * b1;
-                        xmm4 = xmm4 - a4 * b1;
-                        xmm5 = xmm5 - a1 * b2;
-                        xmm6 = xmm6 - a2 * b2;
-                        xmm7 = xmm7 - a3 * b2;
-                        xmm8 = xmm8 - a4 * b2;
+                        xmm1 = fnmadd( a1, b1, xmm1 );
+                        xmm2 = fnmadd( a2, b1, xmm2 );
+                        xmm3 = fnmadd( a3, b1, xmm3 );
+                        xmm4 = fnmadd( a4, b1, xmm4 );
+                        xmm5 = fnmadd( a1, b2, xmm5 );
+                        xmm6 = fnmadd( a2, b2, xmm6 );
+                        xmm7 = fnmadd( a3, b2, xmm7 );
+                        xmm8 = fnmadd( a4, b2, xmm8 );
                      }
 
                      (~C).store( i , j    , xmm1 );
@@ -5284,10 +5310,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 - A.load(i ,k) * b1;
-                        xmm2 = xmm2 - A.load(i1,k) * b1;
-                        xmm3 = xmm3 - A.load(i2,k) * b1;
-                        xmm4 = xmm4 - A.load(i3,k) * b1;
+                        xmm1 = fnmadd( A.load(i ,k), b1, xmm1 );
+                        xmm2 = fnmadd( A.load(i1,k), b1, xmm2 );
+                        xmm3 = fnmadd( A.load(i2,k), b1, xmm3 );
+                        xmm4 = fnmadd( A.load(i3,k), b1, xmm4 );
                      }
 
                      (~C).store( i , j, xmm1 );
@@ -5326,14 +5352,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
                         const IntrinsicType b3( set( B(k,j+2UL) ) );
                         const IntrinsicType b4( set( B(k,j+3UL) ) );
-                        xmm1 = xmm1 - a1 * b1;
-                        xmm2 = xmm2 - a2 * b1;
-                        xmm3 = xmm3 - a1 * b2;
-                        xmm4 = xmm4 - a2 * b2;
-                        xmm5 = xmm5 - a1 * b3;
-                        xmm6 = xmm6 - a2 * b3;
-                        xmm7 = xmm7 - a1 * b4;
-                        xmm8 = xmm8 - a2 * b4;
+                        xmm1 = fnmadd( a1, b1, xmm1 );
+                        xmm2 = fnmadd( a2, b1, xmm2 );
+                        xmm3 = fnmadd( a1, b2, xmm3 );
+                        xmm4 = fnmadd( a2, b2, xmm4 );
+                        xmm5 = fnmadd( a1, b3, xmm5 );
+                        xmm6 = fnmadd( a2, b3, xmm6 );
+                        xmm7 = fnmadd( a1, b4, xmm7 );
+                        xmm8 = fnmadd( a2, b4, xmm8 );
                      }
 
                      (~C).store( i , j    , xmm1 );
@@ -5363,10 +5389,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                         const IntrinsicType a2( A.load(i1,k) );
                         const IntrinsicType b1( set( B(k,j    ) ) );
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
-                        xmm1 = xmm1 - a1 * b1;
-                        xmm2 = xmm2 - a2 * b1;
-                        xmm3 = xmm3 - a1 * b2;
-                        xmm4 = xmm4 - a2 * b2;
+                        xmm1 = fnmadd( a1, b1, xmm1 );
+                        xmm2 = fnmadd( a2, b1, xmm2 );
+                        xmm3 = fnmadd( a1, b2, xmm3 );
+                        xmm4 = fnmadd( a2, b2, xmm4 );
                      }
 
                      (~C).store( i , j    , xmm1 );
@@ -5387,8 +5413,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 - A.load(i ,k) * b1;
-                        xmm2 = xmm2 - A.load(i1,k) * b1;
+                        xmm1 = fnmadd( A.load(i ,k), b1, xmm1 );
+                        xmm2 = fnmadd( A.load(i1,k), b1, xmm2 );
                      }
 
                      (~C).store( i , j, xmm1 );
@@ -5409,7 +5435,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 - A.load(i,k) * b1;
+                        xmm1 = fnmadd( A.load(i,k), b1, xmm1 );
                      }
 
                      (~C).store( i, j, xmm1 );
@@ -5641,7 +5667,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    */
    template< typename MT  // Type of the target dense matrix
            , bool SO >    // Storage order of the target dense matrix
-   friend inline typename EnableIf< IsEvaluationRequired<MT,MT1,MT2> >::Type
+   friend inline typename EnableIf< And< IsEvaluationRequired<MT,MT1,MT2>
+                                       , Not< UseTaskGraph<MT,MT1,MT2> > > >::Type
       smpAssign( DenseMatrix<MT,SO>& lhs, const TDMatDMatMultExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
@@ -5672,6 +5699,53 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP assignment to dense matrices (task graph)***********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a transpose dense matrix-dense matrix multiplication with evaluated
+   //        operands to a dense matrix (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a transpose dense
+   // matrix-dense matrix multiplication expression to a dense matrix in case both matrix operands
+   // require an intermediate evaluation. The two operands are evaluated concurrently (see the
+   // smpConcurrentAssign() function) before the multiplication of the two temporaries is computed
+   // by the parallel multiplication kernel.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline typename EnableIf< UseTaskGraph<MT,MT1,MT2> >::Type
+      smpAssign( DenseMatrix<MT,SO>& lhs, const TDMatDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( (~lhs).rows() == 0UL || (~lhs).columns() == 0UL ) {
+         return;
+      }
+      else if( rhs.lhs_.columns() == 0UL ) {
+         reset( ~lhs );
+         return;
+      }
+
+      RT1 A( rhs.lhs_.rows(), rhs.lhs_.columns() );  // Evaluation of the left-hand side dense matrix operand
+      RT2 B( rhs.rhs_.rows(), rhs.rhs_.columns() );  // Evaluation of the right-hand side dense matrix operand
+
+      smpConcurrentAssign( A, rhs.lhs_, B, rhs.rhs_ );
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns(), "Invalid number of columns" );
+
+      smpAssign( ~lhs, A * B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to sparse matrices***********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP assignment of a transpose dense matrix-dense matrix multiplication to a sparse
@@ -6765,14 +6839,14 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 + a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 + a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 + a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 + a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
             (~C).store( i, j             , xmm1 * factor );
@@ -6812,14 +6886,14 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C).store( i    , j             , xmm1 * factor );
@@ -6845,10 +6919,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
             (~C).store( i, j             , xmm1 * factor );
@@ -6882,10 +6956,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i    , j         , xmm1 * factor );
@@ -6907,8 +6981,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j         );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size);
+               xmm1 = fmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
             (~C).store( i, j         , xmm1 * factor );
@@ -6935,8 +7009,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 + set( A(i+1UL,k) ) * b1;
+               xmm1 = fmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
             (~C).store( i    , j, xmm1 * factor );
@@ -6954,7 +7028,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + set( A(i,k) ) * B.load(k,j);
+               xmm1 = fmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
             (~C).store( i, j, xmm1 * factor );
@@ -7013,14 +7087,14 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 + A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 + A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 + A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 + A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
             (~C).store( i             , j, xmm1 * factor );
@@ -7060,14 +7134,14 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a3 * b1;
-               xmm4 = xmm4 + a4 * b1;
-               xmm5 = xmm5 + a1 * b2;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a3 * b2;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a3, b1, xmm3 );
+               xmm4 = fmadd( a4, b1, xmm4 );
+               xmm5 = fmadd( a1, b2, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a3, b2, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C).store( i             , j    , xmm1 * factor );
@@ -7093,10 +7167,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
             (~C).store( i             , j, xmm1 * factor );
@@ -7130,10 +7204,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a1 * b2;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a1, b2, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i         , j    , xmm1 * factor );
@@ -7155,8 +7229,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i         ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size,k) * b1;
+               xmm1 = fmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
             (~C).store( i         , j, xmm1 * factor );
@@ -7183,8 +7257,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * set( B(k,j    ) );
-               xmm2 = xmm2 + a1 * set( B(k,j+1UL) );
+               xmm1 = fmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
             (~C).store( i, j    , xmm1 * factor );
@@ -7202,7 +7276,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + A.load(i,k) * set( B(k,j) );
+               xmm1 = fmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
             (~C).store( i, j, xmm1 * factor );
@@ -7259,14 +7333,15 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       typedef IntrinsicTrait<ElementType>  IT;
+      typedef MMMTrait<ElementType>        MMMT;
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
       const size_t K( A.columns() );
 
-      const size_t iblock(  64UL );
-      const size_t jblock( 128UL );
-      const size_t kblock( 128UL );
+      const size_t iblock( MMMT::sblock() );
+      const size_t jblock( MMMT::vblock() );
+      const size_t kblock( MMMT::kblock() );
 
       const IntrinsicType factor( set( scalar ) );
 
@@ -7321,14 +7396,14 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                         const IntrinsicType b2( B.load(k,j1) );
                         const IntrinsicType b3( B.load(k,j2) );
                         const IntrinsicType b4( B.load(k,j3) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a1 * b2;
-                        xmm3 = xmm3 + a1 * b3;
-                        xmm4 = xmm4 + a1 * b4;
-                        xmm5 = xmm5 + a2 * b1;
-                        xmm6 = xmm6 + a2 * b2;
-                        xmm7 = xmm7 + a2 * b3;
-                        xmm8 = xmm8 + a2 * b4;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a1, b2, xmm2 );
+                        xmm3 = fmadd( a1, b3, xmm3 );
+                        xmm4 = fmadd( a1, b4, xmm4 );
+                        xmm5 = fmadd( a2, b1, xmm5 );
+                        xmm6 = fmadd( a2, b2, xmm6 );
+                        xmm7 = fmadd( a2, b3, xmm7 );
+                        xmm8 = fmadd( a2, b4, xmm8 );
                      }
 
                      (~C).store( i    , j , xmm1 * factor );
@@ -7355,10 +7430,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 + a1 * B.load(k,j );
-                        xmm2 = xmm2 + a1 * B.load(k,j1);
-                        xmm3 = xmm3 + a1 * B.load(k,j2);
-                        xmm4 = xmm4 + a1 * B.load(k,j3);
+                        xmm1 = fmadd( a1, B.load(k,j ), xmm1 );
+                        xmm2 = fmadd( a1, B.load(k,j1), xmm2 );
+                        xmm3 = fmadd( a1, B.load(k,j2), xmm3 );
+                        xmm4 = fmadd( a1, B.load(k,j3), xmm4 );
                      }
 
                      (~C).store( i, j , xmm1 * factor );
@@ -7397,14 +7472,14 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                         const IntrinsicType a4( set( A(i+3UL,k) ) );
                         const IntrinsicType b1( B.load(k,j ) );
                         const IntrinsicType b2( B.load(k,j1) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a1 * b2;
-                        xmm3 = xmm3 + a2 * b1;
-                        xmm4 = xmm4 + a2 * b2;
-                        xmm5 = xmm5 + a3 * b1;
-                        xmm6 = xmm6 + a3 * b2;
-                        xmm7 = xmm7 + a4 * b1;
-                        xmm8 = xmm8 + a4 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a1, b2, xmm2 );
+                        xmm3 = fmadd( a2, b1, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
+                        xmm5 = fmadd( a3, b1, xmm5 );
+                        xmm6 = fmadd( a3, b2, xmm6 );
+                        xmm7 = fmadd( a4, b1, xmm7 );
+                        xmm8 = fmadd( a4, b2, xmm8 );
                      }
 
                      (~C).store( i    , j , xmm1 * factor );
@@ -7434,10 +7509,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                         const IntrinsicType a2( set( A(i+1UL,k) ) );
                         const IntrinsicType b1( B.load(k,j ) );
                         const IntrinsicType b2( B.load(k,j1) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a1 * b2;
-                        xmm3 = xmm3 + a2 * b1;
-                        xmm4 = xmm4 + a2 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a1, b2, xmm2 );
+                        xmm3 = fmadd( a2, b1, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
                      }
 
                      (~C).store( i    , j , xmm1 * factor );
@@ -7458,8 +7533,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 + a1 * B.load(k,j );
-                        xmm2 = xmm2 + a1 * B.load(k,j1);
+                        xmm1 = fmadd( a1, B.load(k,j ), xmm1 );
+                        xmm2 = fmadd( a1, B.load(k,j1), xmm2 );
                      }
 
                      (~C).store( i, j , xmm1 * factor );
@@ -7480,7 +7555,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 + a1 * B.load(k,j);
+                        xmm1 = fmadd( a1, B.load(k,j), xmm1 );
                      }
 
                      (~C).store( i, j, xmm1 * factor );
@@ -7515,14 +7590,15 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       typedef IntrinsicTrait<ElementType>  IT;
+      typedef MMMTrait<ElementType>        MMMT;
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
       const size_t K( A.columns() );
 
-      const size_t iblock( 128UL );
-      const size_t jblock(  64UL );
-      const size_t kblock( 128UL );
+      const size_t iblock( MMMT::vblock() );
+      const size_t jblock( MMMT::sblock() );
+      const size_t kblock( MMMT::kblock() );
 
       const IntrinsicType factor( set( scalar ) );
 
@@ -7577,14 +7653,14 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                         const IntrinsicType a4( A.load(i3,k) );
                         const IntrinsicType b1( set( B(k,j    ) ) );
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a2 * b1;
-                        xmm3 = xmm3 + a3 * b1;
-                        xmm4 = xmm4 + a4 * b1;
-                        xmm5 = xmm5 + a1 * b2;
-                        xmm6 = xmm6 + a2 * b2;
-                        xmm7 = xmm7 + a3 * b2;
-                        xmm8 = xmm8 + a4 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a2, b1, xmm2 );
+                        xmm3 = fmadd( a3, b1, xmm3 );
+                        xmm4 = fmadd( a4, b1, xmm4 );
+                        xmm5 = fmadd( a1, b2, xmm5 );
+                        xmm6 = fmadd( a2, b2, xmm6 );
+                        xmm7 = fmadd( a3, b2, xmm7 );
+                        xmm8 = fmadd( a4, b2, xmm8 );
                      }
 
                      (~C).store( i , j    , xmm1 * factor );
@@ -7611,10 +7687,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 + A.load(i ,k) * b1;
-                        xmm2 = xmm2 + A.load(i1,k) * b1;
-                        xmm3 = xmm3 + A.load(i2,k) * b1;
-                        xmm4 = xmm4 + A.load(i3,k) * b1;
+                        xmm1 = fmadd( A.load(i ,k), b1, xmm1 );
+                        xmm2 = fmadd( A.load(i1,k), b1, xmm2 );
+                        xmm3 = fmadd( A.load(i2,k), b1, xmm3 );
+                        xmm4 = fmadd( A.load(i3,k), b1, xmm4 );
                      }
 
                      (~C).store( i , j, xmm1 * factor );
@@ -7653,14 +7729,14 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
                         const IntrinsicType b3( set( B(k,j+2UL) ) );
                         const IntrinsicType b4( set( B(k,j+3UL) ) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a2 * b1;
-                        xmm3 = xmm3 + a1 * b2;
-                        xmm4 = xmm4 + a2 * b2;
-                        xmm5 = xmm5 + a1 * b3;
-                        xmm6 = xmm6 + a2 * b3;
-                        xmm7 = xmm7 + a1 * b4;
-                        xmm8 = xmm8 + a2 * b4;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a2, b1, xmm2 );
+                        xmm3 = fmadd( a1, b2, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
+                        xmm5 = fmadd( a1, b3, xmm5 );
+                        xmm6 = fmadd( a2, b3, xmm6 );
+                        xmm7 = fmadd( a1, b4, xmm7 );
+                        xmm8 = fmadd( a2, b4, xmm8 );
                      }
 
                      (~C).store( i , j    , xmm1 * factor );
@@ -7690,10 +7766,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                         const IntrinsicType a2( A.load(i1,k) );
                         const IntrinsicType b1( set( B(k,j    ) ) );
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a2 * b1;
-                        xmm3 = xmm3 + a1 * b2;
-                        xmm4 = xmm4 + a2 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a2, b1, xmm2 );
+                        xmm3 = fmadd( a1, b2, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
                      }
 
                      (~C).store( i , j    , xmm1 * factor );
@@ -7714,8 +7790,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 + A.load(i ,k) * b1;
-                        xmm2 = xmm2 + A.load(i1,k) * b1;
+                        xmm1 = fmadd( A.load(i ,k), b1, xmm1 );
+                        xmm2 = fmadd( A.load(i1,k), b1, xmm2 );
                      }
 
                      (~C).store( i , j, xmm1 * factor );
@@ -7736,7 +7812,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 + A.load(i,k) * b1;
+                        xmm1 = fmadd( A.load(i,k), b1, xmm1 );
                      }
 
                      (~C).store( i, j, xmm1 * factor );
@@ -8351,24 +8427,24 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 + a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 + a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 + a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 + a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
-            (~C).store( i, j             , (~C).load(i,j             ) + xmm1 * factor );
-            (~C).store( i, j+IT::size    , (~C).load(i,j+IT::size    ) + xmm2 * factor );
-            (~C).store( i, j+IT::size*2UL, (~C).load(i,j+IT::size*2UL) + xmm3 * factor );
-            (~C).store( i, j+IT::size*3UL, (~C).load(i,j+IT::size*3UL) + xmm4 * factor );
-            (~C).store( i, j+IT::size*4UL, (~C).load(i,j+IT::size*4UL) + xmm5 * factor );
-            (~C).store( i, j+IT::size*5UL, (~C).load(i,j+IT::size*5UL) + xmm6 * factor );
-            (~C).store( i, j+IT::size*6UL, (~C).load(i,j+IT::size*6UL) + xmm7 * factor );
-            (~C).store( i, j+IT::size*7UL, (~C).load(i,j+IT::size*7UL) + xmm8 * factor );
+            (~C).store( i, j             , fmadd( xmm1, factor, (~C).load(i,j             ) ) );
+            (~C).store( i, j+IT::size    , fmadd( xmm2, factor, (~C).load(i,j+IT::size    ) ) );
+            (~C).store( i, j+IT::size*2UL, fmadd( xmm3, factor, (~C).load(i,j+IT::size*2UL) ) );
+            (~C).store( i, j+IT::size*3UL, fmadd( xmm4, factor, (~C).load(i,j+IT::size*3UL) ) );
+            (~C).store( i, j+IT::size*4UL, fmadd( xmm5, factor, (~C).load(i,j+IT::size*4UL) ) );
+            (~C).store( i, j+IT::size*5UL, fmadd( xmm6, factor, (~C).load(i,j+IT::size*5UL) ) );
+            (~C).store( i, j+IT::size*6UL, fmadd( xmm7, factor, (~C).load(i,j+IT::size*6UL) ) );
+            (~C).store( i, j+IT::size*7UL, fmadd( xmm8, factor, (~C).load(i,j+IT::size*7UL) ) );
          }
       }
 
@@ -8398,24 +8474,24 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
-            }
-
-            (~C).store( i    , j             , (~C).load(i    ,j             ) + xmm1 * factor );
-            (~C).store( i    , j+IT::size    , (~C).load(i    ,j+IT::size    ) + xmm2 * factor );
-            (~C).store( i    , j+IT::size*2UL, (~C).load(i    ,j+IT::size*2UL) + xmm3 * factor );
-            (~C).store( i    , j+IT::size*3UL, (~C).load(i    ,j+IT::size*3UL) + xmm4 * factor );
-            (~C).store( i+1UL, j             , (~C).load(i+1UL,j             ) + xmm5 * factor );
-            (~C).store( i+1UL, j+IT::size    , (~C).load(i+1UL,j+IT::size    ) + xmm6 * factor );
-            (~C).store( i+1UL, j+IT::size*2UL, (~C).load(i+1UL,j+IT::size*2UL) + xmm7 * factor );
-            (~C).store( i+1UL, j+IT::size*3UL, (~C).load(i+1UL,j+IT::size*3UL) + xmm8 * factor );
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
+            }
+
+            (~C).store( i    , j             , fmadd( xmm1, factor, (~C).load(i    ,j             ) ) );
+            (~C).store( i    , j+IT::size    , fmadd( xmm2, factor, (~C).load(i    ,j+IT::size    ) ) );
+            (~C).store( i    , j+IT::size*2UL, fmadd( xmm3, factor, (~C).load(i    ,j+IT::size*2UL) ) );
+            (~C).store( i    , j+IT::size*3UL, fmadd( xmm4, factor, (~C).load(i    ,j+IT::size*3UL) ) );
+            (~C).store( i+1UL, j             , fmadd( xmm5, factor, (~C).load(i+1UL,j             ) ) );
+            (~C).store( i+1UL, j+IT::size    , fmadd( xmm6, factor, (~C).load(i+1UL,j+IT::size    ) ) );
+            (~C).store( i+1UL, j+IT::size*2UL, fmadd( xmm7, factor, (~C).load(i+1UL,j+IT::size*2UL) ) );
+            (~C).store( i+1UL, j+IT::size*3UL, fmadd( xmm8, factor, (~C).load(i+1UL,j+IT::size*3UL) ) );
          }
 
          if( i < M )
@@ -8431,16 +8507,16 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
-            (~C).store( i, j             , (~C).load(i,j             ) + xmm1 * factor );
-            (~C).store( i, j+IT::size    , (~C).load(i,j+IT::size    ) + xmm2 * factor );
-            (~C).store( i, j+IT::size*2UL, (~C).load(i,j+IT::size*2UL) + xmm3 * factor );
-            (~C).store( i, j+IT::size*3UL, (~C).load(i,j+IT::size*3UL) + xmm4 * factor );
+            (~C).store( i, j             , fmadd( xmm1, factor, (~C).load(i,j             ) ) );
+            (~C).store( i, j+IT::size    , fmadd( xmm2, factor, (~C).load(i,j+IT::size    ) ) );
+            (~C).store( i, j+IT::size*2UL, fmadd( xmm3, factor, (~C).load(i,j+IT::size*2UL) ) );
+            (~C).store( i, j+IT::size*3UL, fmadd( xmm4, factor, (~C).load(i,j+IT::size*3UL) ) );
          }
       }
 
@@ -8468,16 +8544,16 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
-            (~C).store( i    , j         , (~C).load(i    ,j         ) + xmm1 * factor );
-            (~C).store( i    , j+IT::size, (~C).load(i    ,j+IT::size) + xmm2 * factor );
-            (~C).store( i+1UL, j         , (~C).load(i+1UL,j         ) + xmm3 * factor );
-            (~C).store( i+1UL, j+IT::size, (~C).load(i+1UL,j+IT::size) + xmm4 * factor );
+            (~C).store( i    , j         , fmadd( xmm1, factor, (~C).load(i    ,j         ) ) );
+            (~C).store( i    , j+IT::size, fmadd( xmm2, factor, (~C).load(i    ,j+IT::size) ) );
+            (~C).store( i+1UL, j         , fmadd( xmm3, factor, (~C).load(i+1UL,j         ) ) );
+            (~C).store( i+1UL, j+IT::size, fmadd( xmm4, factor, (~C).load(i+1UL,j+IT::size) ) );
          }
 
          if( i < M )
@@ -8493,12 +8569,12 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j         );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size);
+               xmm1 = fmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
-            (~C).store( i, j         , (~C).load(i,j         ) + xmm1 * factor );
-            (~C).store( i, j+IT::size, (~C).load(i,j+IT::size) + xmm2 * factor );
+            (~C).store( i, j         , fmadd( xmm1, factor, (~C).load(i,j         ) ) );
+            (~C).store( i, j+IT::size, fmadd( xmm2, factor, (~C).load(i,j+IT::size) ) );
          }
       }
 
@@ -8521,12 +8597,12 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 + set( A(i+1UL,k) ) * b1;
+               xmm1 = fmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
-            (~C).store( i    , j, (~C).load(i    ,j) + xmm1 * factor );
-            (~C).store( i+1UL, j, (~C).load(i+1UL,j) + xmm2 * factor );
+            (~C).store( i    , j, fmadd( xmm1, factor, (~C).load(i    ,j) ) );
+            (~C).store( i+1UL, j, fmadd( xmm2, factor, (~C).load(i+1UL,j) ) );
          }
 
          if( i < M )
@@ -8540,10 +8616,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + set( A(i,k) ) * B.load(k,j);
+               xmm1 = fmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
-            (~C).store( i, j, (~C).load(i,j) + xmm1 * factor );
+            (~C).store( i, j, fmadd( xmm1, factor, (~C).load(i,j) ) );
          }
       }
    }
@@ -8599,24 +8675,24 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 + A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 + A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 + A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 + A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
-            (~C).store( i             , j, (~C).load(i             ,j) + xmm1 * factor );
-            (~C).store( i+IT::size    , j, (~C).load(i+IT::size    ,j) + xmm2 * factor );
-            (~C).store( i+IT::size*2UL, j, (~C).load(i+IT::size*2UL,j) + xmm3 * factor );
-            (~C).store( i+IT::size*3UL, j, (~C).load(i+IT::size*3UL,j) + xmm4 * factor );
-            (~C).store( i+IT::size*4UL, j, (~C).load(i+IT::size*4UL,j) + xmm5 * factor );
-            (~C).store( i+IT::size*5UL, j, (~C).load(i+IT::size*5UL,j) + xmm6 * factor );
-            (~C).store( i+IT::size*6UL, j, (~C).load(i+IT::size*6UL,j) + xmm7 * factor );
-            (~C).store( i+IT::size*7UL, j, (~C).load(i+IT::size*7UL,j) + xmm8 * factor );
+            (~C).store( i             , j, fmadd( xmm1, factor, (~C).load(i             ,j) ) );
+            (~C).store( i+IT::size    , j, fmadd( xmm2, factor, (~C).load(i+IT::size    ,j) ) );
+            (~C).store( i+IT::size*2UL, j, fmadd( xmm3, factor, (~C).load(i+IT::size*2UL,j) ) );
+            (~C).store( i+IT::size*3UL, j, fmadd( xmm4, factor, (~C).load(i+IT::size*3UL,j) ) );
+            (~C).store( i+IT::size*4UL, j, fmadd( xmm5, factor, (~C).load(i+IT::size*4UL,j) ) );
+            (~C).store( i+IT::size*5UL, j, fmadd( xmm6, factor, (~C).load(i+IT::size*5UL,j) ) );
+            (~C).store( i+IT::size*6UL, j, fmadd( xmm7, factor, (~C).load(i+IT::size*6UL,j) ) );
+            (~C).store( i+IT::size*7UL, j, fmadd( xmm8, factor, (~C).load(i+IT::size*7UL,j) ) );
          }
       }
 
@@ -8646,24 +8722,24 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a3 * b1;
-               xmm4 = xmm4 + a4 * b1;
-               xmm5 = xmm5 + a1 * b2;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a3 * b2;
-               xmm8 = xmm8 + a4 * b2;
-            }
-
-            (~C).store( i             , j    , (~C).load(i             ,j    ) + xmm1 * factor );
-            (~C).store( i+IT::size    , j    , (~C).load(i+IT::size    ,j    ) + xmm2 * factor );
-            (~C).store( i+IT::size*2UL, j    , (~C).load(i+IT::size*2UL,j    ) + xmm3 * factor );
-            (~C).store( i+IT::size*3UL, j    , (~C).load(i+IT::size*3UL,j    ) + xmm4 * factor );
-            (~C).store( i             , j+1UL, (~C).load(i             ,j+1UL) + xmm5 * factor );
-            (~C).store( i+IT::size    , j+1UL, (~C).load(i+IT::size    ,j+1UL) + xmm6 * factor );
-            (~C).store( i+IT::size*2UL, j+1UL, (~C).load(i+IT::size*2UL,j+1UL) + xmm7 * factor );
-            (~C).store( i+IT::size*3UL, j+1UL, (~C).load(i+IT::size*3UL,j+1UL) + xmm8 * factor );
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a3, b1, xmm3 );
+               xmm4 = fmadd( a4, b1, xmm4 );
+               xmm5 = fmadd( a1, b2, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a3, b2, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
+            }
+
+            (~C).store( i             , j    , fmadd( xmm1, factor, (~C).load(i             ,j    ) ) );
+            (~C).store( i+IT::size    , j    , fmadd( xmm2, factor, (~C).load(i+IT::size    ,j    ) ) );
+            (~C).store( i+IT::size*2UL, j    , fmadd( xmm3, factor, (~C).load(i+IT::size*2UL,j    ) ) );
+            (~C).store( i+IT::size*3UL, j    , fmadd( xmm4, factor, (~C).load(i+IT::size*3UL,j    ) ) );
+            (~C).store( i             , j+1UL, fmadd( xmm5, factor, (~C).load(i             ,j+1UL) ) );
+            (~C).store( i+IT::size    , j+1UL, fmadd( xmm6, factor, (~C).load(i+IT::size    ,j+1UL) ) );
+            (~C).store( i+IT::size*2UL, j+1UL, fmadd( xmm7, factor, (~C).load(i+IT::size*2UL,j+1UL) ) );
+            (~C).store( i+IT::size*3UL, j+1UL, fmadd( xmm8, factor, (~C).load(i+IT::size*3UL,j+1UL) ) );
          }
 
          if( j < N )
@@ -8679,16 +8755,16 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
-            (~C).store( i             , j, (~C).load(i             ,j) + xmm1 * factor );
-            (~C).store( i+IT::size    , j, (~C).load(i+IT::size    ,j) + xmm2 * factor );
-            (~C).store( i+IT::size*2UL, j, (~C).load(i+IT::size*2UL,j) + xmm3 * factor );
-            (~C).store( i+IT::size*3UL, j, (~C).load(i+IT::size*3UL,j) + xmm4 * factor );
+            (~C).store( i             , j, fmadd( xmm1, factor, (~C).load(i             ,j) ) );
+            (~C).store( i+IT::size    , j, fmadd( xmm2, factor, (~C).load(i+IT::size    ,j) ) );
+            (~C).store( i+IT::size*2UL, j, fmadd( xmm3, factor, (~C).load(i+IT::size*2UL,j) ) );
+            (~C).store( i+IT::size*3UL, j, fmadd( xmm4, factor, (~C).load(i+IT::size*3UL,j) ) );
          }
       }
 
@@ -8716,16 +8792,16 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a1 * b2;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a1, b2, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
-            (~C).store( i         , j    , (~C).load(i         ,j    ) + xmm1 * factor );
-            (~C).store( i+IT::size, j    , (~C).load(i+IT::size,j    ) + xmm2 * factor );
-            (~C).store( i         , j+1UL, (~C).load(i         ,j+1UL) + xmm3 * factor );
-            (~C).store( i+IT::size, j+1UL, (~C).load(i+IT::size,j+1UL) + xmm4 * factor );
+            (~C).store( i         , j    , fmadd( xmm1, factor, (~C).load(i         ,j    ) ) );
+            (~C).store( i+IT::size, j    , fmadd( xmm2, factor, (~C).load(i+IT::size,j    ) ) );
+            (~C).store( i         , j+1UL, fmadd( xmm3, factor, (~C).load(i         ,j+1UL) ) );
+            (~C).store( i+IT::size, j+1UL, fmadd( xmm4, factor, (~C).load(i+IT::size,j+1UL) ) );
          }
 
          if( j < N )
@@ -8741,12 +8817,12 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i         ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size,k) * b1;
+               xmm1 = fmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
-            (~C).store( i         , j, (~C).load(i         ,j) + xmm1 * factor );
-            (~C).store( i+IT::size, j, (~C).load(i+IT::size,j) + xmm2 * factor );
+            (~C).store( i         , j, fmadd( xmm1, factor, (~C).load(i         ,j) ) );
+            (~C).store( i+IT::size, j, fmadd( xmm2, factor, (~C).load(i+IT::size,j) ) );
          }
       }
 
@@ -8769,12 +8845,12 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * set( B(k,j    ) );
-               xmm2 = xmm2 + a1 * set( B(k,j+1UL) );
+               xmm1 = fmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
-            (~C).store( i, j    , (~C).load(i,j    ) + xmm1 * factor );
-            (~C).store( i, j+1UL, (~C).load(i,j+1UL) + xmm2 * factor );
+            (~C).store( i, j    , fmadd( xmm1, factor, (~C).load(i,j    ) ) );
+            (~C).store( i, j+1UL, fmadd( xmm2, factor, (~C).load(i,j+1UL) ) );
          }
 
          if( j < N )
@@ -8788,10 +8864,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + A.load(i,k) * set( B(k,j) );
+               xmm1 = fmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
-            (~C).store( i, j, (~C).load(i,j) + xmm1 * factor );
+            (~C).store( i, j, fmadd( xmm1, factor, (~C).load(i,j) ) );
          }
       }
    }
@@ -8845,14 +8921,15 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       typedef IntrinsicTrait<ElementType>  IT;
+      typedef MMMTrait<ElementType>        MMMT;
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
       const size_t K( A.columns() );
 
-      const size_t iblock(  64UL );
-      const size_t jblock( 128UL );
-      const size_t kblock( 128UL );
+      const size_t iblock( MMMT::sblock() );
+      const size_t jblock( MMMT::vblock() );
+      const size_t kblock( MMMT::kblock() );
 
       const IntrinsicType factor( set( scalar ) );
 
@@ -8894,24 +8971,24 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                         const IntrinsicType b2( B.load(k,j1) );
                         const IntrinsicType b3( B.load(k,j2) );
                         const IntrinsicType b4( B.load(k,j3) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a1 * b2;
-                        xmm3 = xmm3 + a1 * b3;
-                        xmm4 = xmm4 + a1 * b4;
-                        xmm5 = xmm5 + a2 * b1;
-                        xmm6 = xmm6 + a2 * b2;
-                        xmm7 = xmm7 + a2 * b3;
-                        xmm8 = xmm8 + a2 * b4;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a1, b2, xmm2 );
+                        xmm3 = fmadd( a1, b3, xmm3 );
+                        xmm4 = fmadd( a1, b4, xmm4 );
+                        xmm5 = fmadd( a2, b1, xmm5 );
+                        xmm6 = fmadd( a2, b2, xmm6 );
+                        xmm7 = fmadd( a2, b3, xmm7 );
+                        xmm8 = fmadd( a2, b4, xmm8 );
                      }
 
-                     (~C).store( i    , j , (~C).load(i    ,j ) + xmm1 * factor );
-                     (~C).store( i    , j1, (~C).load(i    ,j1) + xmm2 * factor );
-                     (~C).store( i    , j2, (~C).load(i    ,j2) + xmm3 * factor );
-                     (~C).store( i    , j3, (~C).load(i    ,j3) + xmm4 * factor );
-                     (~C).store( i+1UL, j , (~C).load(i+1UL,j ) + xmm5 * factor );
-                     (~C).store( i+1UL, j1, (~C).load(i+1UL,j1) + xmm6 * factor );
-                     (~C).store( i+1UL, j2, (~C).load(i+1UL,j2) + xmm7 * factor );
-                     (~C).store( i+1UL, j3, (~C).load(i+1UL,j3) + xmm8 * factor );
+                     (~C).store( i    , j , fmadd( xmm1, factor, (~C).load(i    ,j ) ) );
+                     (~C).store( i    , j1, fmadd( xmm2, factor, (~C).load(i    ,j1) ) );
+                     (~C).store( i    , j2, fmadd( xmm3, factor, (~C).load(i    ,j2) ) );
+                     (~C).store( i    , j3, fmadd( xmm4, factor, (~C).load(i    ,j3) ) );
+                     (~C).store( i+1UL, j , fmadd( xmm5, factor, (~C).load(i+1UL,j ) ) );
+                     (~C).store( i+1UL, j1, fmadd( xmm6, factor, (~C).load(i+1UL,j1) ) );
+                     (~C).store( i+1UL, j2, fmadd( xmm7, factor, (~C).load(i+1UL,j2) ) );
+                     (~C).store( i+1UL, j3, fmadd( xmm8, factor, (~C).load(i+1UL,j3) ) );
                   }
 
                   if( i < iend )
@@ -8925,16 +9002,16 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 + a1 * B.load(k,j );
-                        xmm2 = xmm2 + a1 * B.load(k,j1);
-                        xmm3 = xmm3 + a1 * B.load(k,j2);
-                        xmm4 = xmm4 + a1 * B.load(k,j3);
+                        xmm1 = fmadd( a1, B.load(k,j ), xmm1 );
+                        xmm2 = fmadd( a1, B.load(k,j1), xmm2 );
+                        xmm3 = fmadd( a1, B.load(k,j2), xmm3 );
+                        xmm4 = fmadd( a1, B.load(k,j3), xmm4 );
                      }
 
-                     (~C).store( i, j , (~C).load(i,j ) + xmm1 * factor );
-                     (~C).store( i, j1, (~C).load(i,j1) + xmm2 * factor );
-                     (~C).store( i, j2, (~C).load(i,j2) + xmm3 * factor );
-                     (~C).store( i, j3, (~C).load(i,j3) + xmm4 * factor );
+                     (~C).store( i, j , fmadd( xmm1, factor, (~C).load(i,j ) ) );
+                     (~C).store( i, j1, fmadd( xmm2, factor, (~C).load(i,j1) ) );
+                     (~C).store( i, j2, fmadd( xmm3, factor, (~C).load(i,j2) ) );
+                     (~C).store( i, j3, fmadd( xmm4, factor, (~C).load(i,j3) ) );
                   }
                }
 
@@ -8960,24 +9037,24 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                         const IntrinsicType a4( set( A(i+3UL,k) ) );
                         const IntrinsicType b1( B.load(k,j ) );
                         const IntrinsicType b2( B.load(k,j1) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a1 * b2;
-                        xmm3 = xmm3 + a2 * b1;
-                        xmm4 = xmm4 + a2 * b2;
-                        xmm5 = xmm5 + a3 * b1;
-                        xmm6 = xmm6 + a3 * b2;
-                        xmm7 = xmm7 + a4 * b1;
-                        xmm8 = xmm8 + a4 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a1, b2, xmm2 );
+                        xmm3 = fmadd( a2, b1, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
+                        xmm5 = fmadd( a3, b1, xmm5 );
+                        xmm6 = fmadd( a3, b2, xmm6 );
+                        xmm7 = fmadd( a4, b1, xmm7 );
+                        xmm8 = fmadd( a4, b2, xmm8 );
                      }
 
-                     (~C).store( i    , j , (~C).load(i    ,j ) + xmm1 * factor );
-                     (~C).store( i    , j1, (~C).load(i    ,j1) + xmm2 * factor );
-                     (~C).store( i+1UL, j , (~C).load(i+1UL,j ) + xmm3 * factor );
-                     (~C).store( i+1UL, j1, (~C).load(i+1UL,j1) + xmm4 * factor );
-                     (~C).store( i+2UL, j , (~C).load(i+2UL,j ) + xmm5 * factor );
-                     (~C).store( i+2UL, j1, (~C).load(i+2UL,j1) + xmm6 * factor );
-                     (~C).store( i+3UL, j , (~C).load(i+3UL,j ) + xmm7 * factor );
-                     (~C).store( i+3UL, j1, (~C).load(i+3UL,j1) + xmm8 * factor );
+                     (~C).store( i    , j , fmadd( xmm1, factor, (~C).load(i    ,j ) ) );
+                     (~C).store( i    , j1, fmadd( xmm2, factor, (~C).load(i    ,j1) ) );
+                     (~C).store( i+1UL, j , fmadd( xmm3, factor, (~C).load(i+1UL,j ) ) );
+                     (~C).store( i+1UL, j1, fmadd( xmm4, factor, (~C).load(i+1UL,j1) ) );
+                     (~C).store( i+2UL, j , fmadd( xmm5, factor, (~C).load(i+2UL,j ) ) );
+                     (~C).store( i+2UL, j1, fmadd( xmm6, factor, (~C).load(i+2UL,j1) ) );
+                     (~C).store( i+3UL, j , fmadd( xmm7, factor, (~C).load(i+3UL,j ) ) );
+                     (~C).store( i+3UL, j1, fmadd( xmm8, factor, (~C).load(i+3UL,j1) ) );
                   }
 
                   for( ; (i+2UL) <= iend; i+=2UL )
@@ -8994,16 +9071,16 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                         const IntrinsicType a2( set( A(i+1UL,k) ) );
                         const IntrinsicType b1( B.load(k,j ) );
                         const IntrinsicType b2( B.load(k,j1) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a1 * b2;
-                        xmm3 = xmm3 + a2 * b1;
-                        xmm4 = xmm4 + a2 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a1, b2, xmm2 );
+                        xmm3 = fmadd( a2, b1, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
                      }
 
-                     (~C).store( i    , j , (~C).load(i    ,j ) + xmm1 * factor );
-                     (~C).store( i    , j1, (~C).load(i    ,j1) + xmm2 * factor );
-                     (~C).store( i+1UL, j , (~C).load(i+1UL,j ) + xmm3 * factor );
-                     (~C).store( i+1UL, j1, (~C).load(i+1UL,j1) + xmm4 * factor );
+                     (~C).store( i    , j , fmadd( xmm1, factor, (~C).load(i    ,j ) ) );
+                     (~C).store( i    , j1, fmadd( xmm2, factor, (~C).load(i    ,j1) ) );
+                     (~C).store( i+1UL, j , fmadd( xmm3, factor, (~C).load(i+1UL,j ) ) );
+                     (~C).store( i+1UL, j1, fmadd( xmm4, factor, (~C).load(i+1UL,j1) ) );
                   }
 
                   if( i < iend )
@@ -9017,12 +9094,12 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 + a1 * B.load(k,j );
-                        xmm2 = xmm2 + a1 * B.load(k,j1);
+                        xmm1 = fmadd( a1, B.load(k,j ), xmm1 );
+                        xmm2 = fmadd( a1, B.load(k,j1), xmm2 );
                      }
 
-                     (~C).store( i, j , (~C).load(i,j ) + xmm1 * factor );
-                     (~C).store( i, j1, (~C).load(i,j1) + xmm2 * factor );
+                     (~C).store( i, j , fmadd( xmm1, factor, (~C).load(i,j ) ) );
+                     (~C).store( i, j1, fmadd( xmm2, factor, (~C).load(i,j1) ) );
                   }
                }
 
@@ -9039,10 +9116,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 + a1 * B.load(k,j);
+                        xmm1 = fmadd( a1, B.load(k,j), xmm1 );
                      }
 
-                     (~C).store( i, j, (~C).load(i,j) + xmm1 * factor );
+                     (~C).store( i, j, fmadd( xmm1, factor, (~C).load(i,j) ) );
                   }
                }
             }
@@ -9074,14 +9151,15 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       typedef IntrinsicTrait<ElementType>  IT;
+      typedef MMMTrait<ElementType>        MMMT;
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
       const size_t K( A.columns() );
 
-      const size_t iblock( 128UL );
-      const size_t jblock(  64UL );
-      const size_t kblock( 128UL );
+      const size_t iblock( MMMT::vblock() );
+      const size_t jblock( MMMT::sblock() );
+      const size_t kblock( MMMT::kblock() );
 
       const IntrinsicType factor( set( scalar ) );
 
@@ -9130,14 +9208,14 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                         const IntrinsicType a4( A.load(i3,k) );
                         const IntrinsicType b1( set( B(k,j    ) ) );
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a2 * b1;
-                        xmm3 = xmm3 + a3 * b1;
-                        xmm4 = xmm4 + a4 * b1;
-                        xmm5 = xmm5 + a1 * b2;
-                        xmm6 = xmm6 + a2 * b2;
-                        xmm7 = xmm7 + a3 * b2;
-                        xmm8 = xmm8 + a4 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a2, b1, xmm2 );
+                        xmm3 = fmadd( a3, b1, xmm3 );
+                        xmm4 = fmadd( a4, b1, xmm4 );
+                        xmm5 = fmadd( a1, b2, xmm5 );
+                        xmm6 = fmadd( a2, b2, xmm6 );
+                        xmm7 = fmadd( a3, b2, xmm7 );
+                        xmm8 = fmadd( a4, b2, xmm8 );
                      }
 
                      (~C).store( i , j    , xmm1 * factor );
@@ -9164,10 +9242,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 + A.load(i ,k) * b1;
-                        xmm2 = xmm2 + A.load(i1,k) * b1;
-                        xmm3 = xmm3 + A.load(i2,k) * b1;
-                        xmm4 = xmm4 + A.load(i3,k) * b1;
+                        xmm1 = fmadd( A.load(i ,k), b1, xmm1 );
+                        xmm2 = fmadd( A.load(i1,k), b1, xmm2 );
+                        xmm3 = fmadd( A.load(i2,k), b1, xmm3 );
+                        xmm4 = fmadd( A.load(i3,k), b1, xmm4 );
                      }
 
                      (~C).store( i , j, xmm1 * factor );
@@ -9206,14 +9284,14 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
                         const IntrinsicType b3( set( B(k,j+2UL) ) );
                         const IntrinsicType b4( set( B(k,j+3UL) ) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a2 * b1;
-                        xmm3 = xmm3 + a1 * b2;
-                        xmm4 = xmm4 + a2 * b2;
-                        xmm5 = xmm5 + a1 * b3;
-                        xmm6 = xmm6 + a2 * b3;
-                        xmm7 = xmm7 + a1 * b4;
-                        xmm8 = xmm8 + a2 * b4;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a2, b1, xmm2 );
+                        xmm3 = fmadd( a1, b2, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
+                        xmm5 = fmadd( a1, b3, xmm5 );
+                        xmm6 = fmadd( a2, b3, xmm6 );
+                        xmm7 = fmadd( a1, b4, xmm7 );
+                        xmm8 = fmadd( a2, b4, xmm8 );
                      }
 
                      (~C).store( i , j    , xmm1 * factor );
@@ -9243,10 +9321,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                         const IntrinsicType a2( A.load(i1,k) );
                         const IntrinsicType b1( set( B(k,j    ) ) );
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a2 * b1;
-                        xmm3 = xmm3 + a1 * b2;
-                        xmm4 = xmm4 + a2 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a2, b1, xmm2 );
+                        xmm3 = fmadd( a1, b2, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
                      }
 
                      (~C).store( i , j    , xmm1 * factor );
@@ -9267,8 +9345,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 + A.load(i ,k) * b1;
-                        xmm2 = xmm2 + A.load(i1,k) * b1;
+                        xmm1 = fmadd( A.load(i ,k), b1, xmm1 );
+                        xmm2 = fmadd( A.load(i1,k), b1, xmm2 );
                      }
 
                      (~C).store( i , j, xmm1 * factor );
@@ -9289,7 +9367,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 + A.load(i,k) * b1;
+                        xmm1 = fmadd( A.load(i,k), b1, xmm1 );
                      }
 
                      (~C).store( i, j, xmm1 * factor );
@@ -9881,24 +9959,24 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 + a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 + a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 + a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 + a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
-            (~C).store( i, j             , (~C).load(i,j             ) - xmm1 * factor );
-            (~C).store( i, j+IT::size    , (~C).load(i,j+IT::size    ) - xmm2 * factor );
-            (~C).store( i, j+IT::size*2UL, (~C).load(i,j+IT::size*2UL) - xmm3 * factor );
-            (~C).store( i, j+IT::size*3UL, (~C).load(i,j+IT::size*3UL) - xmm4 * factor );
-            (~C).store( i, j+IT::size*4UL, (~C).load(i,j+IT::size*4UL) - xmm5 * factor );
-            (~C).store( i, j+IT::size*5UL, (~C).load(i,j+IT::size*5UL) - xmm6 * factor );
-            (~C).store( i, j+IT::size*6UL, (~C).load(i,j+IT::size*6UL) - xmm7 * factor );
-            (~C).store( i, j+IT::size*7UL, (~C).load(i,j+IT::size*7UL) - xmm8 * factor );
+            (~C).store( i, j             , fnmadd( xmm1, factor, (~C).load(i,j             ) ) );
+            (~C).store( i, j+IT::size    , fnmadd( xmm2, factor, (~C).load(i,j+IT::size    ) ) );
+            (~C).store( i, j+IT::size*2UL, fnmadd( xmm3, factor, (~C).load(i,j+IT::size*2UL) ) );
+            (~C).store( i, j+IT::size*3UL, fnmadd( xmm4, factor, (~C).load(i,j+IT::size*3UL) ) );
+            (~C).store( i, j+IT::size*4UL, fnmadd( xmm5, factor, (~C).load(i,j+IT::size*4UL) ) );
+            (~C).store( i, j+IT::size*5UL, fnmadd( xmm6, factor, (~C).load(i,j+IT::size*5UL) ) );
+            (~C).store( i, j+IT::size*6UL, fnmadd( xmm7, factor, (~C).load(i,j+IT::size*6UL) ) );
+            (~C).store( i, j+IT::size*7UL, fnmadd( xmm8, factor, (~C).load(i,j+IT::size*7UL) ) );
          }
       }
 
@@ -9928,24 +10006,24 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
-            }
-
-            (~C).store( i    , j             , (~C).load(i    ,j             ) - xmm1 * factor );
-            (~C).store( i    , j+IT::size    , (~C).load(i    ,j+IT::size    ) - xmm2 * factor );
-            (~C).store( i    , j+IT::size*2UL, (~C).load(i    ,j+IT::size*2UL) - xmm3 * factor );
-            (~C).store( i    , j+IT::size*3UL, (~C).load(i    ,j+IT::size*3UL) - xmm4 * factor );
-            (~C).store( i+1UL, j             , (~C).load(i+1UL,j             ) - xmm5 * factor );
-            (~C).store( i+1UL, j+IT::size    , (~C).load(i+1UL,j+IT::size    ) - xmm6 * factor );
-            (~C).store( i+1UL, j+IT::size*2UL, (~C).load(i+1UL,j+IT::size*2UL) - xmm7 * factor );
-            (~C).store( i+1UL, j+IT::size*3UL, (~C).load(i+1UL,j+IT::size*3UL) - xmm8 * factor );
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
+            }
+
+            (~C).store( i    , j             , fnmadd( xmm1, factor, (~C).load(i    ,j             ) ) );
+            (~C).store( i    , j+IT::size    , fnmadd( xmm2, factor, (~C).load(i    ,j+IT::size    ) ) );
+            (~C).store( i    , j+IT::size*2UL, fnmadd( xmm3, factor, (~C).load(i    ,j+IT::size*2UL) ) );
+            (~C).store( i    , j+IT::size*3UL, fnmadd( xmm4, factor, (~C).load(i    ,j+IT::size*3UL) ) );
+            (~C).store( i+1UL, j             , fnmadd( xmm5, factor, (~C).load(i+1UL,j             ) ) );
+            (~C).store( i+1UL, j+IT::size    , fnmadd( xmm6, factor, (~C).load(i+1UL,j+IT::size    ) ) );
+            (~C).store( i+1UL, j+IT::size*2UL, fnmadd( xmm7, factor, (~C).load(i+1UL,j+IT::size*2UL) ) );
+            (~C).store( i+1UL, j+IT::size*3UL, fnmadd( xmm8, factor, (~C).load(i+1UL,j+IT::size*3UL) ) );
          }
 
          if( i < M )
@@ -9961,16 +10039,16 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
-            (~C).store( i, j             , (~C).load(i,j             ) - xmm1 * factor );
-            (~C).store( i, j+IT::size    , (~C).load(i,j+IT::size    ) - xmm2 * factor );
-            (~C).store( i, j+IT::size*2UL, (~C).load(i,j+IT::size*2UL) - xmm3 * factor );
-            (~C).store( i, j+IT::size*3UL, (~C).load(i,j+IT::size*3UL) - xmm4 * factor );
+            (~C).store( i, j             , fnmadd( xmm1, factor, (~C).load(i,j             ) ) );
+            (~C).store( i, j+IT::size    , fnmadd( xmm2, factor, (~C).load(i,j+IT::size    ) ) );
+            (~C).store( i, j+IT::size*2UL, fnmadd( xmm3, factor, (~C).load(i,j+IT::size*2UL) ) );
+            (~C).store( i, j+IT::size*3UL, fnmadd( xmm4, factor, (~C).load(i,j+IT::size*3UL) ) );
          }
       }
 
@@ -9998,16 +10076,16 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
-            (~C).store( i    , j         , (~C).load(i    ,j         ) - xmm1 * factor );
-            (~C).store( i    , j+IT::size, (~C).load(i    ,j+IT::size) - xmm2 * factor );
-            (~C).store( i+1UL, j         , (~C).load(i+1UL,j         ) - xmm3 * factor );
-            (~C).store( i+1UL, j+IT::size, (~C).load(i+1UL,j+IT::size) - xmm4 * factor );
+            (~C).store( i    , j         , fnmadd( xmm1, factor, (~C).load(i    ,j         ) ) );
+            (~C).store( i    , j+IT::size, fnmadd( xmm2, factor, (~C).load(i    ,j+IT::size) ) );
+            (~C).store( i+1UL, j         , fnmadd( xmm3, factor, (~C).load(i+1UL,j         ) ) );
+            (~C).store( i+1UL, j+IT::size, fnmadd( xmm4, factor, (~C).load(i+1UL,j+IT::size) ) );
          }
 
          if( i < M )
@@ -10023,12 +10101,12 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j         );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size);
+               xmm1 = fmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
-            (~C).store( i, j         , (~C).load(i,j         ) - xmm1 * factor );
-            (~C).store( i, j+IT::size, (~C).load(i,j+IT::size) - xmm2 * factor );
+            (~C).store( i, j         , fnmadd( xmm1, factor, (~C).load(i,j         ) ) );
+            (~C).store( i, j+IT::size, fnmadd( xmm2, factor, (~C).load(i,j+IT::size) ) );
          }
       }
 
@@ -10051,12 +10129,12 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 + set( A(i+1UL,k) ) * b1;
+               xmm1 = fmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
-            (~C).store( i    , j, (~C).load(i    ,j) - xmm1 * factor );
-            (~C).store( i+1UL, j, (~C).load(i+1UL,j) - xmm2 * factor );
+            (~C).store( i    , j, fnmadd( xmm1, factor, (~C).load(i    ,j) ) );
+            (~C).store( i+1UL, j, fnmadd( xmm2, factor, (~C).load(i+1UL,j) ) );
          }
 
          if( i < M )
@@ -10070,10 +10148,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + set( A(i,k) ) * B.load(k,j);
+               xmm1 = fmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
-            (~C).store( i, j, (~C).load(i,j) - xmm1 * factor );
+            (~C).store( i, j, fnmadd( xmm1, factor, (~C).load(i,j) ) );
          }
       }
    }
@@ -10129,24 +10207,24 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 + A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 + A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 + A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 + A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
-            (~C).store( i             , j, (~C).load(i             ,j) - xmm1 * factor );
-            (~C).store( i+IT::size    , j, (~C).load(i+IT::size    ,j) - xmm2 * factor );
-            (~C).store( i+IT::size*2UL, j, (~C).load(i+IT::size*2UL,j) - xmm3 * factor );
-            (~C).store( i+IT::size*3UL, j, (~C).load(i+IT::size*3UL,j) - xmm4 * factor );
-            (~C).store( i+IT::size*4UL, j, (~C).load(i+IT::size*4UL,j) - xmm5 * factor );
-            (~C).store( i+IT::size*5UL, j, (~C).load(i+IT::size*5UL,j) - xmm6 * factor );
-            (~C).store( i+IT::size*6UL, j, (~C).load(i+IT::size*6UL,j) - xmm7 * factor );
-            (~C).store( i+IT::size*7UL, j, (~C).load(i+IT::size*7UL,j) - xmm8 * factor );
+            (~C).store( i             , j, fnmadd( xmm1, factor, (~C).load(i             ,j) ) );
+            (~C).store( i+IT::size    , j, fnmadd( xmm2, factor, (~C).load(i+IT::size    ,j) ) );
+            (~C).store( i+IT::size*2UL, j, fnmadd( xmm3, factor, (~C).load(i+IT::size*2UL,j) ) );
+            (~C).store( i+IT::size*3UL, j, fnmadd( xmm4, factor, (~C).load(i+IT::size*3UL,j) ) );
+            (~C).store( i+IT::size*4UL, j, fnmadd( xmm5, factor, (~C).load(i+IT::size*4UL,j) ) );
+            (~C).store( i+IT::size*5UL, j, fnmadd( xmm6, factor, (~C).load(i+IT::size*5UL,j) ) );
+            (~C).store( i+IT::size*6UL, j, fnmadd( xmm7, factor, (~C).load(i+IT::size*6UL,j) ) );
+            (~C).store( i+IT::size*7UL, j, fnmadd( xmm8, factor, (~C).load(i+IT::size*7UL,j) ) );
          }
       }
 
@@ -10176,24 +10254,24 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a3 * b1;
-               xmm4 = xmm4 + a4 * b1;
-               xmm5 = xmm5 + a1 * b2;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a3 * b2;
-               xmm8 = xmm8 + a4 * b2;
-            }
-
-            (~C).store( i             , j    , (~C).load(i             ,j    ) - xmm1 * factor );
-            (~C).store( i+IT::size    , j    , (~C).load(i+IT::size    ,j    ) - xmm2 * factor );
-            (~C).store( i+IT::size*2UL, j    , (~C).load(i+IT::size*2UL,j    ) - xmm3 * factor );
-            (~C).store( i+IT::size*3UL, j    , (~C).load(i+IT::size*3UL,j    ) - xmm4 * factor );
-            (~C).store( i             , j+1UL, (~C).load(i             ,j+1UL) - xmm5 * factor );
-            (~C).store( i+IT::size    , j+1UL, (~C).load(i+IT::size    ,j+1UL) - xmm6 * factor );
-            (~C).store( i+IT::size*2UL, j+1UL, (~C).load(i+IT::size*2UL,j+1UL) - xmm7 * factor );
-            (~C).store( i+IT::size*3UL, j+1UL, (~C).load(i+IT::size*3UL,j+1UL) - xmm8 * factor );
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a3, b1, xmm3 );
+               xmm4 = fmadd( a4, b1, xmm4 );
+               xmm5 = fmadd( a1, b2, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a3, b2, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
+            }
+
+            (~C).store( i             , j    , fnmadd( xmm1, factor, (~C).load(i             ,j    ) ) );
+            (~C).store( i+IT::size    , j    , fnmadd( xmm2, factor, (~C).load(i+IT::size    ,j    ) ) );
+            (~C).store( i+IT::size*2UL, j    , fnmadd( xmm3, factor, (~C).load(i+IT::size*2UL,j    ) ) );
+            (~C).store( i+IT::size*3UL, j    , fnmadd( xmm4, factor, (~C).load(i+IT::size*3UL,j    ) ) );
+            (~C).store( i             , j+1UL, fnmadd( xmm5, factor, (~C).load(i             ,j+1UL) ) );
+            (~C).store( i+IT::size    , j+1UL, fnmadd( xmm6, factor, (~C).load(i+IT::size    ,j+1UL) ) );
+            (~C).store( i+IT::size*2UL, j+1UL, fnmadd( xmm7, factor, (~C).load(i+IT::size*2UL,j+1UL) ) );
+            (~C).store( i+IT::size*3UL, j+1UL, fnmadd( xmm8, factor, (~C).load(i+IT::size*3UL,j+1UL) ) );
          }
 
          if( j < N )
@@ -10209,16 +10287,16 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
-            (~C).store( i             , j, (~C).load(i             ,j) - xmm1 * factor );
-            (~C).store( i+IT::size    , j, (~C).load(i+IT::size    ,j) - xmm2 * factor );
-            (~C).store( i+IT::size*2UL, j, (~C).load(i+IT::size*2UL,j) - xmm3 * factor );
-            (~C).store( i+IT::size*3UL, j, (~C).load(i+IT::size*3UL,j) - xmm4 * factor );
+            (~C).store( i             , j, fnmadd( xmm1, factor, (~C).load(i             ,j) ) );
+            (~C).store( i+IT::size    , j, fnmadd( xmm2, factor, (~C).load(i+IT::size    ,j) ) );
+            (~C).store( i+IT::size*2UL, j, fnmadd( xmm3, factor, (~C).load(i+IT::size*2UL,j) ) );
+            (~C).store( i+IT::size*3UL, j, fnmadd( xmm4, factor, (~C).load(i+IT::size*3UL,j) ) );
          }
       }
 
@@ -10246,16 +10324,16 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a1 * b2;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a1, b2, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
-            (~C).store( i         , j    , (~C).load(i         ,j    ) - xmm1 * factor );
-            (~C).store( i+IT::size, j    , (~C).load(i+IT::size,j    ) - xmm2 * factor );
-            (~C).store( i         , j+1UL, (~C).load(i         ,j+1UL) - xmm3 * factor );
-            (~C).store( i+IT::size, j+1UL, (~C).load(i+IT::size,j+1UL) - xmm4 * factor );
+            (~C).store( i         , j    , fnmadd( xmm1, factor, (~C).load(i         ,j    ) ) );
+            (~C).store( i+IT::size, j    , fnmadd( xmm2, factor, (~C).load(i+IT::size,j    ) ) );
+            (~C).store( i         , j+1UL, fnmadd( xmm3, factor, (~C).load(i         ,j+1UL) ) );
+            (~C).store( i+IT::size, j+1UL, fnmadd( xmm4, factor, (~C).load(i+IT::size,j+1UL) ) );
          }
 
          if( j < N )
@@ -10271,12 +10349,12 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i         ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size,k) * b1;
+               xmm1 = fmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
-            (~C).store( i         , j, (~C).load(i         ,j) - xmm1 * factor );
-            (~C).store( i+IT::size, j, (~C).load(i+IT::size,j) - xmm2 * factor );
+            (~C).store( i         , j, fnmadd( xmm1, factor, (~C).load(i         ,j) ) );
+            (~C).store( i+IT::size, j, fnmadd( xmm2, factor, (~C).load(i+IT::size,j) ) );
          }
       }
 
@@ -10299,12 +10377,12 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * set( B(k,j    ) );
-               xmm2 = xmm2 + a1 * set( B(k,j+1UL) );
+               xmm1 = fmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
-            (~C).store( i, j    , (~C).load(i,j    ) - xmm1 * factor );
-            (~C).store( i, j+1UL, (~C).load(i,j+1UL) - xmm2 * factor );
+            (~C).store( i, j    , fnmadd( xmm1, factor, (~C).load(i,j    ) ) );
+            (~C).store( i, j+1UL, fnmadd( xmm2, factor, (~C).load(i,j+1UL) ) );
          }
 
          if( j < N )
@@ -10318,10 +10396,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + A.load(i,k) * set( B(k,j) );
+               xmm1 = fmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
-            (~C).store( i, j, (~C).load(i,j) - xmm1 * factor );
+            (~C).store( i, j, fnmadd( xmm1, factor, (~C).load(i,j) ) );
          }
       }
    }
@@ -10375,14 +10453,15 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       typedef IntrinsicTrait<ElementType>  IT;
+      typedef MMMTrait<ElementType>        MMMT;
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
       const size_t K( A.columns() );
 
-      const size_t iblock(  64UL );
-      const size_t jblock( 128UL );
-      const size_t kblock( 128UL );
+      const size_t iblock( MMMT::sblock() );
+      const size_t jblock( MMMT::vblock() );
+      const size_t kblock( MMMT::kblock() );
 
       const IntrinsicType factor( set( scalar ) );
 
@@ -10424,24 +10503,24 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                         const IntrinsicType b2( B.load(k,j1) );
                         const IntrinsicType b3( B.load(k,j2) );
                         const IntrinsicType b4( B.load(k,j3) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a1 * b2;
-                        xmm3 = xmm3 + a1 * b3;
-                        xmm4 = xmm4 + a1 * b4;
-                        xmm5 = xmm5 + a2 * b1;
-                        xmm6 = xmm6 + a2 * b2;
-                        xmm7 = xmm7 + a2 * b3;
-                        xmm8 = xmm8 + a2 * b4;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a1, b2, xmm2 );
+                        xmm3 = fmadd( a1, b3, xmm3 );
+                        xmm4 = fmadd( a1, b4, xmm4 );
+                        xmm5 = fmadd( a2, b1, xmm5 );
+                        xmm6 = fmadd( a2, b2, xmm6 );
+                        xmm7 = fmadd( a2, b3, xmm7 );
+                        xmm8 = fmadd( a2, b4, xmm8 );
                      }
 
-                     (~C).store( i    , j , (~C).load(i    ,j ) - xmm1 * factor );
-                     (~C).store( i    , j1, (~C).load(i    ,j1) - xmm2 * factor );
-                     (~C).store( i    , j2, (~C).load(i    ,j2) - xmm3 * factor );
-                     (~C).store( i    , j3, (~C).load(i    ,j3) - xmm4 * factor );
-                     (~C).store( i+1UL, j , (~C).load(i+1UL,j ) - xmm5 * factor );
-                     (~C).store( i+1UL, j1, (~C).load(i+1UL,j1) - xmm6 * factor );
-                     (~C).store( i+1UL, j2, (~C).load(i+1UL,j2) - xmm7 * factor );
-                     (~C).store( i+1UL, j3, (~C).load(i+1UL,j3) - xmm8 * factor );
+                     (~C).store( i    , j , fnmadd( xmm1, factor, (~C).load(i    ,j ) ) );
+                     (~C).store( i    , j1, fnmadd( xmm2, factor, (~C).load(i    ,j1) ) );
+                     (~C).store( i    , j2, fnmadd( xmm3, factor, (~C).load(i    ,j2) ) );
+                     (~C).store( i    , j3, fnmadd( xmm4, factor, (~C).load(i    ,j3) ) );
+                     (~C).store( i+1UL, j , fnmadd( xmm5, factor, (~C).load(i+1UL,j ) ) );
+                     (~C).store( i+1UL, j1, fnmadd( xmm6, factor, (~C).load(i+1UL,j1) ) );
+                     (~C).store( i+1UL, j2, fnmadd( xmm7, factor, (~C).load(i+1UL,j2) ) );
+                     (~C).store( i+1UL, j3, fnmadd( xmm8, factor, (~C).load(i+1UL,j3) ) );
                   }
 
                   if( i < iend )
@@ -10455,16 +10534,16 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 + a1 * B.load(k,j );
-                        xmm2 = xmm2 + a1 * B.load(k,j1);
-                        xmm3 = xmm3 + a1 * B.load(k,j2);
-                        xmm4 = xmm4 + a1 * B.load(k,j3);
+                        xmm1 = fmadd( a1, B.load(k,j ), xmm1 );
+                        xmm2 = fmadd( a1, B.load(k,j1), xmm2 );
+                        xmm3 = fmadd( a1, B.load(k,j2), xmm3 );
+                        xmm4 = fmadd( a1, B.load(k,j3), xmm4 );
                      }
 
-                     (~C).store( i, j , (~C).load(i,j ) - xmm1 * factor );
-                     (~C).store( i, j1, (~C).load(i,j1) - xmm2 * factor );
-                     (~C).store( i, j2, (~C).load(i,j2) - xmm3 * factor );
-                     (~C).store( i, j3, (~C).load(i,j3) - xmm4 * factor );
+                     (~C).store( i, j , fnmadd( xmm1, factor, (~C).load(i,j ) ) );
+                     (~C).store( i, j1, fnmadd( xmm2, factor, (~C).load(i,j1) ) );
+                     (~C).store( i, j2, fnmadd( xmm3, factor, (~C).load(i,j2) ) );
+                     (~C).store( i, j3, fnmadd( xmm4, factor, (~C).load(i,j3) ) );
                   }
                }
 
@@ -10490,24 +10569,24 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                         const IntrinsicType a4( set( A(i+3UL,k) ) );
                         const IntrinsicType b1( B.load(k,j ) );
                         const IntrinsicType b2( B.load(k,j1) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a1 * b2;
-                        xmm3 = xmm3 + a2 * b1;
-                        xmm4 = xmm4 + a2 * b2;
-                        xmm5 = xmm5 + a3 * b1;
-                        xmm6 = xmm6 + a3 * b2;
-                        xmm7 = xmm7 + a4 * b1;
-                        xmm8 = xmm8 + a4 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a1, b2, xmm2 );
+                        xmm3 = fmadd( a2, b1, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
+                        xmm5 = fmadd( a3, b1, xmm5 );
+                        xmm6 = fmadd( a3, b2, xmm6 );
+                        xmm7 = fmadd( a4, b1, xmm7 );
+                        xmm8 = fmadd( a4, b2, xmm8 );
                      }
 
-                     (~C).store( i    , j , (~C).load(i    ,j ) - xmm1 * factor );
-                     (~C).store( i    , j1, (~C).load(i    ,j1) - xmm2 * factor );
-                     (~C).store( i+1UL, j , (~C).load(i+1UL,j ) - xmm3 * factor );
-                     (~C).store( i+1UL, j1, (~C).load(i+1UL,j1) - xmm4 * factor );
-                     (~C).store( i+2UL, j , (~C).load(i+2UL,j ) - xmm5 * factor );
-                     (~C).store( i+2UL, j1, (~C).load(i+2UL,j1) - xmm6 * factor );
-                     (~C).store( i+3UL, j , (~C).load(i+3UL,j ) - xmm7 * factor );
-                     (~C).store( i+3UL, j1, (~C).load(i+3UL,j1) - xmm8 * factor );
+                     (~C).store( i    , j , fnmadd( xmm1, factor, (~C).load(i    ,j ) ) );
+                     (~C).store( i    , j1, fnmadd( xmm2, factor, (~C).load(i    ,j1) ) );
+                     (~C).store( i+1UL, j , fnmadd( xmm3, factor, (~C).load(i+1UL,j ) ) );
+                     (~C).store( i+1UL, j1, fnmadd( xmm4, factor, (~C).load(i+1UL,j1) ) );
+                     (~C).store( i+2UL, j , fnmadd( xmm5, factor, (~C).load(i+2UL,j ) ) );
+                     (~C).store( i+2UL, j1, fnmadd( xmm6, factor, (~C).load(i+2UL,j1) ) );
+                     (~C).store( i+3UL, j , fnmadd( xmm7, factor, (~C).load(i+3UL,j ) ) );
+                     (~C).store( i+3UL, j1, fnmadd( xmm8, factor, (~C).load(i+3UL,j1) ) );
                   }
 
                   for( ; (i+2UL) <= iend; i+=2UL )
@@ -10524,16 +10603,16 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                         const IntrinsicType a2( set( A(i+1UL,k) ) );
                         const IntrinsicType b1( B.load(k,j ) );
                         const IntrinsicType b2( B.load(k,j1) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a1 * b2;
-                        xmm3 = xmm3 + a2 * b1;
-                        xmm4 = xmm4 + a2 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a1, b2, xmm2 );
+                        xmm3 = fmadd( a2, b1, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
                      }
 
-                     (~C).store( i    , j , (~C).load(i    ,j ) - xmm1 * factor );
-                     (~C).store( i    , j1, (~C).load(i    ,j1) - xmm2 * factor );
-                     (~C).store( i+1UL, j , (~C).load(i+1UL,j ) - xmm3 * factor );
-                     (~C).store( i+1UL, j1, (~C).load(i+1UL,j1) - xmm4 * factor );
+                     (~C).store( i    , j , fnmadd( xmm1, factor, (~C).load(i    ,j ) ) );
+                     (~C).store( i    , j1, fnmadd( xmm2, factor, (~C).load(i    ,j1) ) );
+                     (~C).store( i+1UL, j , fnmadd( xmm3, factor, (~C).load(i+1UL,j ) ) );
+                     (~C).store( i+1UL, j1, fnmadd( xmm4, factor, (~C).load(i+1UL,j1) ) );
                   }
 
                   if( i < iend )
@@ -10547,12 +10626,12 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 + a1 * B.load(k,j );
-                        xmm2 = xmm2 + a1 * B.load(k,j1);
+                        xmm1 = fmadd( a1, B.load(k,j ), xmm1 );
+                        xmm2 = fmadd( a1, B.load(k,j1), xmm2 );
                      }
 
-                     (~C).store( i, j , (~C).load(i,j ) - xmm1 * factor );
-                     (~C).store( i, j1, (~C).load(i,j1) - xmm2 * factor );
+                     (~C).store( i, j , fnmadd( xmm1, factor, (~C).load(i,j ) ) );
+                     (~C).store( i, j1, fnmadd( xmm2, factor, (~C).load(i,j1) ) );
                   }
                }
 
@@ -10569,10 +10648,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType a1( set( A(i,k) ) );
-                        xmm1 = xmm1 + a1 * B.load(k,j);
+                        xmm1 = fmadd( a1, B.load(k,j), xmm1 );
                      }
 
-                     (~C).store( i, j, (~C).load(i,j) - xmm1 * factor );
+                     (~C).store( i, j, fnmadd( xmm1, factor, (~C).load(i,j) ) );
                   }
                }
             }
@@ -10604,14 +10683,15 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       typedef IntrinsicTrait<ElementType>  IT;
+      typedef MMMTrait<ElementType>        MMMT;
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
       const size_t K( A.columns() );
 
-      const size_t iblock( 128UL );
-      const size_t jblock(  64UL );
-      const size_t kblock( 128UL );
+      const size_t iblock( MMMT::vblock() );
+      const size_t jblock( MMMT::sblock() );
+      const size_t kblock( MMMT::kblock() );
 
       const IntrinsicType factor( set( scalar ) );
 
@@ -10660,14 +10740,14 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                         const IntrinsicType a4( A.load(i3,k) );
                         const IntrinsicType b1( set( B(k,j    ) ) );
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
-                        xmm1 = xmm1 - a1 * b1;
-                        xmm2 = xmm2 - a2 * b1;
-                        xmm3 = xmm3 - a3 * b1;
-                        xmm4 = xmm4 - a4 * b1;
-                        xmm5 = xmm5 - a1 * b2;
-                        xmm6 = xmm6 - a2 * b2;
-                        xmm7 = xmm7 - a3 * b2;
-                        xmm8 = xmm8 - a4 * b2;
+                        xmm1 = fnmadd( a1, b1, xmm1 );
+                        xmm2 = fnmadd( a2, b1, xmm2 );
+                        xmm3 = fnmadd( a3, b1, xmm3 );
+                        xmm4 = fnmadd( a4, b1, xmm4 );
+                        xmm5 = fnmadd( a1, b2, xmm5 );
+                        xmm6 = fnmadd( a2, b2, xmm6 );
+                        xmm7 = fnmadd( a3, b2, xmm7 );
+                        xmm8 = fnmadd( a4, b2, xmm8 );
                      }
 
                      (~C).store( i , j    , xmm1 * factor );
@@ -10694,10 +10774,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 - A.load(i ,k) * b1;
-                        xmm2 = xmm2 - A.load(i1,k) * b1;
-                        xmm3 = xmm3 - A.load(i2,k) * b1;
-                        xmm4 = xmm4 - A.load(i3,k) * b1;
+                        xmm1 = fnmadd( A.load(i ,k), b1, xmm1 );
+                        xmm2 = fnmadd( A.load(i1,k), b1, xmm2 );
+                        xmm3 = fnmadd( A.load(i2,k), b1, xmm3 );
+                        xmm4 = fnmadd( A.load(i3,k), b1, xmm4 );
                      }
 
                      (~C).store( i , j, xmm1 * factor );
@@ -10736,14 +10816,14 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
                         const IntrinsicType b3( set( B(k,j+2UL) ) );
                         const IntrinsicType b4( set( B(k,j+3UL) ) );
-                        xmm1 = xmm1 - a1 * b1;
-                        xmm2 = xmm2 - a2 * b1;
-                        xmm3 = xmm3 - a1 * b2;
-                        xmm4 = xmm4 - a2 * b2;
-                        xmm5 = xmm5 - a1 * b3;
-                        xmm6 = xmm6 - a2 * b3;
-                        xmm7 = xmm7 - a1 * b4;
-                        xmm8 = xmm8 - a2 * b4;
+                        xmm1 = fnmadd( a1, b1, xmm1 );
+                        xmm2 = fnmadd( a2, b1, xmm2 );
+                        xmm3 = fnmadd( a1, b2, xmm3 );
+                        xmm4 = fnmadd( a2, b2, xmm4 );
+                        xmm5 = fnmadd( a1, b3, xmm5 );
+                        xmm6 = fnmadd( a2, b3, xmm6 );
+                        xmm7 = fnmadd( a1, b4, xmm7 );
+                        xmm8 = fnmadd( a2, b4, xmm8 );
                      }
 
                      (~C).store( i , j    , xmm1 * factor );
@@ -10773,10 +10853,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                         const IntrinsicType a2( A.load(i1,k) );
                         const IntrinsicType b1( set( B(k,j    ) ) );
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
-                        xmm1 = xmm1 - a1 * b1;
-                        xmm2 = xmm2 - a2 * b1;
-                        xmm3 = xmm3 - a1 * b2;
-                        xmm4 = xmm4 - a2 * b2;
+                        xmm1 = fnmadd( a1, b1, xmm1 );
+                        xmm2 = fnmadd( a2, b1, xmm2 );
+                        xmm3 = fnmadd( a1, b2, xmm3 );
+                        xmm4 = fnmadd( a2, b2, xmm4 );
                      }
 
                      (~C).store( i , j    , xmm1 * factor );
@@ -10797,8 +10877,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 - A.load(i ,k) * b1;
-                        xmm2 = xmm2 - A.load(i1,k) * b1;
+                        xmm1 = fnmadd( A.load(i ,k), b1, xmm1 );
+                        xmm2 = fnmadd( A.load(i1,k), b1, xmm2 );
                      }
 
                      (~C).store( i , j, xmm1 * factor );
@@ -10819,7 +10899,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 - A.load(i,k) * b1;
+                        xmm1 = fnmadd( A.load(i,k), b1, xmm1 );
                      }
 
                      (~C).store( i, j, xmm1 * factor );
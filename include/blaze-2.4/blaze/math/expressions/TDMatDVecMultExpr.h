@@ -646,14 +646,14 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
          }
 
          y.store( i             , xmm1 );
@@ -680,10 +680,10 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
          }
 
          y.store( i             , xmm1 );
@@ -706,9 +706,9 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
          }
 
          y.store( i             , xmm1 );
@@ -730,8 +730,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i         ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+            xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
          }
 
          y.store( i         , xmm1 );
@@ -751,7 +751,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; ++j ) {
-            xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+            xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
          }
 
          y.store( i, xmm1 );
@@ -836,14 +836,14 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-                  xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-                  xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-                  xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-                  xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+                  xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+                  xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+                  xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+                  xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
                }
 
                y.store( i             , y.load(i             ) + xmm1 );
@@ -862,10 +862,10 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
                }
 
                y.store( i             , y.load(i             ) + xmm1 );
@@ -880,9 +880,9 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
                }
 
                y.store( i             , y.load(i             ) + xmm1 );
@@ -896,8 +896,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i         ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+                  xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
                }
 
                y.store( i         , y.load(i         ) + xmm1 );
@@ -909,7 +909,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
                IntrinsicType xmm1;
 
                for( size_t j=jj; j<jend; ++j ) {
-                  xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+                  xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
                }
 
                y.store( i, y.load(i) + xmm1 );
@@ -1297,14 +1297,14 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
          }
 
          y.store( i             , xmm1 );
@@ -1334,10 +1334,10 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
          }
 
          y.store( i             , xmm1 );
@@ -1362,9 +1362,9 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
          }
 
          y.store( i             , xmm1 );
@@ -1387,8 +1387,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i         ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+            xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
          }
 
          y.store( i         , xmm1 );
@@ -1408,7 +1408,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
          IntrinsicType xmm1( y.load(i) );
 
          for( size_t j=jbegin; j<jend; ++j ) {
-            xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+            xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
          }
 
          y.store( i, xmm1 );
@@ -1491,14 +1491,14 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-                  xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-                  xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-                  xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-                  xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+                  xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+                  xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+                  xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+                  xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
                }
 
                y.store( i             , y.load(i             ) + xmm1 );
@@ -1517,10 +1517,10 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
                }
 
                y.store( i             , y.load(i             ) + xmm1 );
@@ -1535,9 +1535,9 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
                }
 
                y.store( i             , y.load(i             ) + xmm1 );
@@ -1551,8 +1551,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i         ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+                  xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
                }
 
                y.store( i         , y.load(i         ) + xmm1 );
@@ -1564,7 +1564,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
                IntrinsicType xmm1;
 
                for( size_t j=jj; j<jend; ++j ) {
-                  xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+                  xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
                }
 
                y.store( i, y.load(i) + xmm1 );
@@ -1931,14 +1931,14 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 - A.load(i             ,j) * x1;
-            xmm2 = xmm2 - A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 - A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 - A.load(i+IT::size*3UL,j) * x1;
-            xmm5 = xmm5 - A.load(i+IT::size*4UL,j) * x1;
-            xmm6 = xmm6 - A.load(i+IT::size*5UL,j) * x1;
-            xmm7 = xmm7 - A.load(i+IT::size*6UL,j) * x1;
-            xmm8 = xmm8 - A.load(i+IT::size*7UL,j) * x1;
+            xmm1 = fnmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fnmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fnmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fnmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+            xmm5 = fnmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+            xmm6 = fnmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+            xmm7 = fnmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+            xmm8 = fnmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
          }
 
          y.store( i             , xmm1 );
@@ -1968,10 +1968,10 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 - A.load(i             ,j) * x1;
-            xmm2 = xmm2 - A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 - A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 - A.load(i+IT::size*3UL,j) * x1;
+            xmm1 = fnmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fnmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fnmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fnmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
          }
 
          y.store( i             , xmm1 );
@@ -1996,9 +1996,9 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 - A.load(i             ,j) * x1;
-            xmm2 = xmm2 - A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 - A.load(i+IT::size*2UL,j) * x1;
+            xmm1 = fnmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fnmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fnmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
          }
 
          y.store( i             , xmm1 );
@@ -2021,8 +2021,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 - A.load(i         ,j) * x1;
-            xmm2 = xmm2 - A.load(i+IT::size,j) * x1;
+            xmm1 = fnmadd( A.load(i         ,j), x1, xmm1 );
+            xmm2 = fnmadd( A.load(i+IT::size,j), x1, xmm2 );
          }
 
          y.store( i         , xmm1 );
@@ -2042,7 +2042,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
          IntrinsicType xmm1( y.load(i) );
 
          for( size_t j=jbegin; j<jend; ++j ) {
-            xmm1 = xmm1 - A.load(i,j) * set( x[j] );
+            xmm1 = fnmadd( A.load(i,j), set( x[j] ), xmm1 );
          }
 
          y.store( i, xmm1 );
@@ -2126,14 +2126,14 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-                  xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-                  xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-                  xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-                  xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+                  xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+                  xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+                  xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+                  xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
                }
 
                y.store( i             , y.load(i             ) - xmm1 );
@@ -2152,10 +2152,10 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
                }
 
                y.store( i             , y.load(i             ) - xmm1 );
@@ -2170,9 +2170,9 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
                }
 
                y.store( i             , y.load(i             ) - xmm1 );
@@ -2186,8 +2186,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i         ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+                  xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
                }
 
                y.store( i         , y.load(i         ) - xmm1 );
@@ -2199,7 +2199,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
                IntrinsicType xmm1;
 
                for( size_t j=jj; j<jend; ++j ) {
-                  xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+                  xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
                }
 
                y.store( i, y.load(i) - xmm1 );
@@ -3155,14 +3155,14 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
          }
 
          y.store( i             , xmm1*factor );
@@ -3189,10 +3189,10 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
          }
 
          y.store( i             , xmm1*factor );
@@ -3215,9 +3215,9 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
          }
 
          y.store( i             , xmm1*factor );
@@ -3239,8 +3239,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i         ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+            xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
          }
 
          y.store( i         , xmm1*factor );
@@ -3261,7 +3261,7 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i,j) * x1;
+            xmm1 = fmadd( A.load(i,j), x1, xmm1 );
          }
 
          y.store( i, xmm1*factor );
@@ -3348,14 +3348,14 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-                  xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-                  xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-                  xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-                  xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+                  xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+                  xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+                  xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+                  xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
                }
 
                y.store( i             , y.load(i             ) + xmm1*factor );
@@ -3374,10 +3374,10 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
                }
 
                y.store( i             , y.load(i             ) + xmm1*factor );
@@ -3392,9 +3392,9 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
                }
 
                y.store( i             , y.load(i             ) + xmm1*factor );
@@ -3408,8 +3408,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i         ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+                  xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
                }
 
                y.store( i         , y.load(i         ) + xmm1*factor );
@@ -3421,7 +3421,7 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
                IntrinsicType xmm1;
 
                for( size_t j=jj; j<jend; ++j ) {
-                  xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+                  xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
                }
 
                y.store( i, y.load(i) + xmm1*factor );
@@ -3774,14 +3774,14 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
          }
 
          y.store( i             , y.load(i             ) + xmm1*factor );
@@ -3808,10 +3808,10 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
          }
 
          y.store( i             , y.load(i             ) + xmm1*factor );
@@ -3834,9 +3834,9 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
          }
 
          y.store( i             , y.load(i             ) + xmm1*factor );
@@ -3858,8 +3858,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i         ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+            xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
          }
 
          y.store( i         , y.load(i         ) + xmm1*factor );
@@ -3879,7 +3879,7 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; ++j ) {
-            xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+            xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
          }
 
          y.store( i, y.load(i) + xmm1*factor );
@@ -3965,14 +3965,14 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-                  xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-                  xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-                  xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-                  xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+                  xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+                  xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+                  xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+                  xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
                }
 
                y.store( i             , y.load(i             ) + xmm1*factor );
@@ -3991,10 +3991,10 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
                }
 
                y.store( i             , y.load(i             ) + xmm1*factor );
@@ -4009,9 +4009,9 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
                }
 
                y.store( i             , y.load(i             ) + xmm1*factor );
@@ -4025,8 +4025,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i         ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+                  xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
                }
 
                y.store( i         , y.load(i         ) + xmm1*factor );
@@ -4038,7 +4038,7 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
                IntrinsicType xmm1;
 
                for( size_t j=jj; j<jend; ++j ) {
-                  xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+                  xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
                }
 
                y.store( i, y.load(i) + xmm1*factor );
@@ -4371,14 +4371,14 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
          }
 
          y.store( i             , y.load(i             ) - xmm1*factor );
@@ -4405,10 +4405,10 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
          }
 
          y.store( i             , y.load(i             ) - xmm1*factor );
@@ -4431,9 +4431,9 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
          }
 
          y.store( i             , y.load(i             ) - xmm1*factor );
@@ -4455,8 +4455,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i         ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+            xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
          }
 
          y.store( i         , y.load(i         ) - xmm1*factor );
@@ -4475,7 +4475,7 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; ++j ) {
-            xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+            xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
          }
 
          y.store( i, y.load(i) - xmm1*factor );
@@ -4561,14 +4561,14 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-                  xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-                  xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-                  xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-                  xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+                  xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+                  xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+                  xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+                  xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
                }
 
                y.store( i             , y.load(i             ) - xmm1*factor );
@@ -4587,10 +4587,10 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
                }
 
                y.store( i             , y.load(i             ) - xmm1*factor );
@@ -4605,9 +4605,9 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
                }
 
                y.store( i             , y.load(i             ) - xmm1*factor );
@@ -4621,8 +4621,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i         ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+                  xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
                }
 
                y.store( i         , y.load(i         ) - xmm1*factor );
@@ -4634,7 +4634,7 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
                IntrinsicType xmm1;
 
                for( size_t j=jj; j<jend; ++j ) {
-                  xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+                  xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
                }
 
                y.store( i, y.load(i) - xmm1*factor );
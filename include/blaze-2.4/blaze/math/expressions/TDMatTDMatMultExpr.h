@@ -46,6 +46,7 @@
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/StorageOrder.h>
 #include <blaze/math/constraints/Symmetric.h>
+#include <blaze/math/dense/MMM.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Forward.h>
@@ -67,6 +68,7 @@
 #include <blaze/math/typetraits/Columns.h>
 #include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsAdaptor.h>
 #include <blaze/math/typetraits/IsColumnMajorMatrix.h>
 #include <blaze/math/typetraits/IsColumnVector.h>
 #include <blaze/math/typetraits/IsComputation.h>
@@ -178,7 +180,24 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    template< typename T1, typename T2, typename T3 >
    struct IsEvaluationRequired {
       enum { value = ( evaluateLeft || evaluateRight ) &&
-                     CanExploitSymmetry<T1,T2,T3>::value };
+                     !CanExploitSymmetry<T1,T2,T3>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The UseTaskGraph struct is a helper struct for the selection of the parallel evaluation
+       strategy. In case both matrix operands require an intermediate evaluation into resizable
+       dense matrices, the two operands are evaluated concurrently and the nested \a value will
+       be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseTaskGraph {
+      enum { value = evaluateLeft && evaluateRight &&
+                     IsEvaluationRequired<T1,T2,T3>::value &&
+                     IsResizable<RT1>::value && !IsAdaptor<RT1>::value &&
+                     IsResizable<RT2>::value && !IsAdaptor<RT2>::value };
    };
    /*! \endcond */
    //**********************************************************************************************
@@ -917,14 +936,14 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 + A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 + A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 + A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 + A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -964,14 +983,14 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a3 * b1;
-               xmm4 = xmm4 + a4 * b1;
-               xmm5 = xmm5 + a1 * b2;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a3 * b2;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a3, b1, xmm3 );
+               xmm4 = fmadd( a4, b1, xmm4 );
+               xmm5 = fmadd( a1, b2, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a3, b2, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C).store( i             , j    , xmm1 );
@@ -997,10 +1016,10 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -1034,10 +1053,10 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a1 * b2;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a1, b2, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i         , j    , xmm1 );
@@ -1059,8 +1078,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i         ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size,k) * b1;
+               xmm1 = fmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
             (~C).store( i         , j, xmm1 );
@@ -1087,8 +1106,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * set( B(k,j    ) );
-               xmm2 = xmm2 + a1 * set( B(k,j+1UL) );
+               xmm1 = fmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
             (~C).store( i, j    , xmm1 );
@@ -1106,7 +1125,7 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + A.load(i,k) * set( B(k,j) );
+               xmm1 = fmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -1189,14 +1208,15 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
       typedef IntrinsicTrait<ElementType>  IT;
+      typedef MMMTrait<ElementType>        MMMT;
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
       const size_t K( A.columns() );
 
-      const size_t iblock( 128UL );
-      const size_t jblock(  64UL );
-      const size_t kblock( 128UL );
+      const size_t iblock( MMMT::vblock() );
+      const size_t jblock( MMMT::sblock() );
+      const size_t kblock( MMMT::kblock() );
 
       for( size_t ii=0UL; ii<M; ii+=iblock )
       {
@@ -1249,14 +1269,14 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
                         const IntrinsicType a4( A.load(i3,k) );
                         const IntrinsicType b1( set( B(k,j    ) ) );
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a2 * b1;
-                        xmm3 = xmm3 + a3 * b1;
-                        xmm4 = xmm4 + a4 * b1;
-                        xmm5 = xmm5 + a1 * b2;
-                        xmm6 = xmm6 + a2 * b2;
-                        xmm7 = xmm7 + a3 * b2;
-                        xmm8 = xmm8 + a4 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a2, b1, xmm2 );
+                        xmm3 = fmadd( a3, b1, xmm3 );
+                        xmm4 = fmadd( a4, b1, xmm4 );
+                        xmm5 = fmadd( a1, b2, xmm5 );
+                        xmm6 = fmadd( a2, b2, xmm6 );
+                        xmm7 = fmadd( a3, b2, xmm7 );
+                        xmm8 = fmadd( a4, b2, xmm8 );
                      }
 
                      (~C).store( i , j    , xmm1 );
@@ -1283,10 +1303,10 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 + A.load(i ,k) * b1;
-                        xmm2 = xmm2 + A.load(i1,k) * b1;
-                        xmm3 = xmm3 + A.load(i2,k) * b1;
-                        xmm4 = xmm4 + A.load(i3,k) * b1;
+                        xmm1 = fmadd( A.load(i ,k), b1, xmm1 );
+                        xmm2 = fmadd( A.load(i1,k), b1, xmm2 );
+                        xmm3 = fmadd( A.load(i2,k), b1, xmm3 );
+                        xmm4 = fmadd( A.load(i3,k), b1, xmm4 );
                      }
 
                      (~C).store( i , j, xmm1 );
@@ -1325,14 +1345,14 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
                         const IntrinsicType b3( set( B(k,j+2UL) ) );
                         const IntrinsicType b4( set( B(k,j+3UL) ) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a2 * b1;
-                        xmm3 = xmm3 + a1 * b2;
-                        xmm4 = xmm4 + a2 * b2;
-                        xmm5 = xmm5 + a1 * b3;
-                        xmm6 = xmm6 + a2 * b3;
-                        xmm7 = xmm7 + a1 * b4;
-                        xmm8 = xmm8 + a2 * b4;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a2, b1, xmm2 );
+                        xmm3 = fmadd( a1, b2, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
+                        xmm5 = fmadd( a1, b3, xmm5 );
+                        xmm6 = fmadd( a2, b3, xmm6 );
+                        xmm7 = fmadd( a1, b4, xmm7 );
+                        xmm8 = fmadd( a2, b4, xmm8 );
                      }
 
                      (~C).store( i , j    , xmm1 );
@@ -1362,10 +1382,10 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
                         const IntrinsicType a2( A.load(i1,k) );
                         const IntrinsicType b1( set( B(k,j    ) ) );
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a2 * b1;
-                        xmm3 = xmm3 + a1 * b2;
-                        xmm4 = xmm4 + a2 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a2, b1, xmm2 );
+                        xmm3 = fmadd( a1, b2, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
                      }
 
                      (~C).store( i , j    , xmm1 );
@@ -1386,8 +1406,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 + A.load(i ,k) * b1;
-                        xmm2 = xmm2 + A.load(i1,k) * b1;
+                        xmm1 = fmadd( A.load(i ,k), b1, xmm1 );
+                        xmm2 = fmadd( A.load(i1,k), b1, xmm2 );
                      }
 
                      (~C).store( i , j, xmm1 );
@@ -1408,7 +1428,7 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 + A.load(i,k) * b1;
+                        xmm1 = fmadd( A.load(i,k), b1, xmm1 );
                      }
 
                      (~C).store( i, j, xmm1 );
@@ -2057,14 +2077,14 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 + A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 + A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 + A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 + A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -2111,14 +2131,14 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a3 * b1;
-               xmm4 = xmm4 + a4 * b1;
-               xmm5 = xmm5 + a1 * b2;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a3 * b2;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a3, b1, xmm3 );
+               xmm4 = fmadd( a4, b1, xmm4 );
+               xmm5 = fmadd( a1, b2, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a3, b2, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C).store( i             , j    , xmm1 );
@@ -2147,10 +2167,10 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -2187,10 +2207,10 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a1 * b2;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a1, b2, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i         , j    , xmm1 );
@@ -2213,8 +2233,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i         ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size,k) * b1;
+               xmm1 = fmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
             (~C).store( i         , j, xmm1 );
@@ -2242,8 +2262,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * set( B(k,j    ) );
-               xmm2 = xmm2 + a1 * set( B(k,j+1UL) );
+               xmm1 = fmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
             (~C).store( i, j    , xmm1 );
@@ -2261,7 +2281,7 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
             IntrinsicType xmm1( (~C).load(i,j) );
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + A.load(i,k) * set( B(k,j) );
+               xmm1 = fmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -2344,14 +2364,15 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
       typedef IntrinsicTrait<ElementType>  IT;
+      typedef MMMTrait<ElementType>        MMMT;
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
       const size_t K( A.columns() );
 
-      const size_t iblock( 128UL );
-      const size_t jblock(  64UL );
-      const size_t kblock( 128UL );
+      const size_t iblock( MMMT::vblock() );
+      const size_t jblock( MMMT::sblock() );
+      const size_t kblock( MMMT::kblock() );
 
       for( size_t ii=0UL; ii<M; ii+=iblock )
       {
@@ -2398,14 +2419,14 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
                         const IntrinsicType a4( A.load(i3,k) );
                         const IntrinsicType b1( set( B(k,j    ) ) );
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a2 * b1;
-                        xmm3 = xmm3 + a3 * b1;
-                        xmm4 = xmm4 + a4 * b1;
-                        xmm5 = xmm5 + a1 * b2;
-                        xmm6 = xmm6 + a2 * b2;
-                        xmm7 = xmm7 + a3 * b2;
-                        xmm8 = xmm8 + a4 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a2, b1, xmm2 );
+                        xmm3 = fmadd( a3, b1, xmm3 );
+                        xmm4 = fmadd( a4, b1, xmm4 );
+                        xmm5 = fmadd( a1, b2, xmm5 );
+                        xmm6 = fmadd( a2, b2, xmm6 );
+                        xmm7 = fmadd( a3, b2, xmm7 );
+                        xmm8 = fmadd( a4, b2, xmm8 );
                      }
 
                      (~C).store( i , j    , xmm1 );
@@ -2432,10 +2453,10 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 + A.load(i ,k) * b1;
-                        xmm2 = xmm2 + A.load(i1,k) * b1;
-                        xmm3 = xmm3 + A.load(i2,k) * b1;
-                        xmm4 = xmm4 + A.load(i3,k) * b1;
+                        xmm1 = fmadd( A.load(i ,k), b1, xmm1 );
+                        xmm2 = fmadd( A.load(i1,k), b1, xmm2 );
+                        xmm3 = fmadd( A.load(i2,k), b1, xmm3 );
+                        xmm4 = fmadd( A.load(i3,k), b1, xmm4 );
                      }
 
                      (~C).store( i , j, xmm1 );
@@ -2474,14 +2495,14 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
                         const IntrinsicType b3( set( B(k,j+2UL) ) );
                         const IntrinsicType b4( set( B(k,j+3UL) ) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a2 * b1;
-                        xmm3 = xmm3 + a1 * b2;
-                        xmm4 = xmm4 + a2 * b2;
-                        xmm5 = xmm5 + a1 * b3;
-                        xmm6 = xmm6 + a2 * b3;
-                        xmm7 = xmm7 + a1 * b4;
-                        xmm8 = xmm8 + a2 * b4;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a2, b1, xmm2 );
+                        xmm3 = fmadd( a1, b2, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
+                        xmm5 = fmadd( a1, b3, xmm5 );
+                        xmm6 = fmadd( a2, b3, xmm6 );
+                        xmm7 = fmadd( a1, b4, xmm7 );
+                        xmm8 = fmadd( a2, b4, xmm8 );
                      }
 
                      (~C).store( i , j    , xmm1 );
@@ -2511,10 +2532,10 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
                         const IntrinsicType a2( A.load(i1,k) );
                         const IntrinsicType b1( set( B(k,j    ) ) );
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a2 * b1;
-                        xmm3 = xmm3 + a1 * b2;
-                        xmm4 = xmm4 + a2 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a2, b1, xmm2 );
+                        xmm3 = fmadd( a1, b2, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
                      }
 
                      (~C).store( i , j    , xmm1 );
@@ -2535,8 +2556,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 + A.load(i ,k) * b1;
-                        xmm2 = xmm2 + A.load(i1,k) * b1;
+                        xmm1 = fmadd( A.load(i ,k), b1, xmm1 );
+                        xmm2 = fmadd( A.load(i1,k), b1, xmm2 );
                      }
 
                      (~C).store( i , j, xmm1 );
@@ -2557,7 +2578,7 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 + A.load(i,k) * b1;
+                        xmm1 = fmadd( A.load(i,k), b1, xmm1 );
                      }
 
                      (~C).store( i, j, xmm1 );
@@ -3180,14 +3201,14 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 - A.load(i             ,k) * b1;
-               xmm2 = xmm2 - A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 - A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 - A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 - A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 - A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 - A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 - A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fnmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fnmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fnmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fnmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fnmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fnmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fnmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fnmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -3234,14 +3255,14 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 - a1 * b1;
-               xmm2 = xmm2 - a2 * b1;
-               xmm3 = xmm3 - a3 * b1;
-               xmm4 = xmm4 - a4 * b1;
-               xmm5 = xmm5 - a1 * b2;
-               xmm6 = xmm6 - a2 * b2;
-               xmm7 = xmm7 - a3 * b2;
-               xmm8 = xmm8 - a4 * b2;
+               xmm1 = fnmadd( a1, b1, xmm1 );
+               xmm2 = fnmadd( a2, b1, xmm2 );
+               xmm3 = fnmadd( a3, b1, xmm3 );
+               xmm4 = fnmadd( a4, b1, xmm4 );
+               xmm5 = fnmadd( a1, b2, xmm5 );
+               xmm6 = fnmadd( a2, b2, xmm6 );
+               xmm7 = fnmadd( a3, b2, xmm7 );
+               xmm8 = fnmadd( a4, b2, xmm8 );
             }
 
             (~C).store( i             , j    , xmm1 );
@@ -3270,10 +3291,10 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 - A.load(i             ,k) * b1;
-               xmm2 = xmm2 - A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 - A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 - A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fnmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fnmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fnmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fnmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -3310,10 +3331,10 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 - a1 * b1;
-               xmm2 = xmm2 - a2 * b1;
-               xmm3 = xmm3 - a1 * b2;
-               xmm4 = xmm4 - a2 * b2;
+               xmm1 = fnmadd( a1, b1, xmm1 );
+               xmm2 = fnmadd( a2, b1, xmm2 );
+               xmm3 = fnmadd( a1, b2, xmm3 );
+               xmm4 = fnmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i         , j    , xmm1 );
@@ -3336,8 +3357,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 - A.load(i         ,k) * b1;
-               xmm2 = xmm2 - A.load(i+IT::size,k) * b1;
+               xmm1 = fnmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fnmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
             (~C).store( i         , j, xmm1 );
@@ -3365,8 +3386,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 - a1 * set( B(k,j    ) );
-               xmm2 = xmm2 - a1 * set( B(k,j+1UL) );
+               xmm1 = fnmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fnmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
             (~C).store( i, j    , xmm1 );
@@ -3384,7 +3405,7 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
             IntrinsicType xmm1( (~C).load(i,j) );
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 - A.load(i,k) * set( B(k,j) );
+               xmm1 = fnmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -3467,14 +3488,15 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
       typedef IntrinsicTrait<ElementType>  IT;
+      typedef MMMTrait<ElementType>        MMMT;
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
       const size_t K( A.columns() );
 
-      const size_t iblock( 128UL );
-      const size_t jblock(  64UL );
-      const size_t kblock( 128UL );
+      const size_t iblock( MMMT::vblock() );
+      const size_t jblock( MMMT::sblock() );
+      const size_t kblock( MMMT::kblock() );
 
       for( size_t ii=0UL; ii<M; ii+=iblock )
       {
@@ -3521,14 +3543,14 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
                         const IntrinsicType a4( A.load(i3,k) );
                         const IntrinsicType b1( set( B(k,j    ) ) );
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
-                        xmm1 = xmm1 - a1 * b1;
-                        xmm2 = xmm2 - a2 * b1;
-                        xmm3 = xmm3 - a3 * b1;
-                        xmm4 = xmm4 - a4 * b1;
-                        xmm5 = xmm5 - a1 * b2;
-                        xmm6 = xmm6 - a2 * b2;
-                        xmm7 = xmm7 - a3 * b2;
-                        xmm8 = xmm8 - a4 * b2;
+                        xmm1 = fnmadd( a1, b1, xmm1 );
+                        xmm2 = fnmadd( a2, b1, xmm2 );
+                        xmm3 = fnmadd( a3, b1, xmm3 );
+                        xmm4 = fnmadd( a4, b1, xmm4 );
+                        xmm5 = fnmadd( a1, b2, xmm5 );
+                        xmm6 = fnmadd( a2, b2, xmm6 );
+                        xmm7 = fnmadd( a3, b2, xmm7 );
+                        xmm8 = fnmadd( a4, b2, xmm8 );
                      }
 
                      (~C).store( i , j    , xmm1 );
@@ -3555,10 +3577,10 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 - A.load(i ,k) * b1;
-                        xmm2 = xmm2 - A.load(i1,k) * b1;
-                        xmm3 = xmm3 - A.load(i2,k) * b1;
-                        xmm4 = xmm4 - A.load(i3,k) * b1;
+                        xmm1 = fnmadd( A.load(i ,k), b1, xmm1 );
+                        xmm2 = fnmadd( A.load(i1,k), b1, xmm2 );
+                        xmm3 = fnmadd( A.load(i2,k), b1, xmm3 );
+                        xmm4 = fnmadd( A.load(i3,k), b1, xmm4 );
                      }
 
                      (~C).store( i , j, xmm1 );
@@ -3597,14 +3619,14 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
                         const IntrinsicType b3( set( B(k,j+2UL) ) );
                         const IntrinsicType b4( set( B(k,j+3UL) ) );
-                        xmm1 = xmm1 - a1 * b1;
-                        xmm2 = xmm2 - a2 * b1;
-                        xmm3 = xmm3 - a1 * b2;
-                        xmm4 = xmm4 - a2 * b2;
-                        xmm5 = xmm5 - a1 * b3;
-                        xmm6 = xmm6 - a2 * b3;
-                        xmm7 = xmm7 - a1 * b4;
-                        xmm8 = xmm8 - a2 * b4;
+                        xmm1 = fnmadd( a1, b1, xmm1 );
+                        xmm2 = fnmadd( a2, b1, xmm2 );
+                        xmm3 = fnmadd( a1, b2, xmm3 );
+                        xmm4 = fnmadd( a2, b2, xmm4 );
+                        xmm5 = fnmadd( a1, b3, xmm5 );
+                        xmm6 = fnmadd( a2, b3, xmm6 );
+                        xmm7 = fnmadd( a1, b4, xmm7 );
+                        xmm8 = fnmadd( a2, b4, xmm8 );
                      }
 
                      (~C).store( i , j    , xmm1 );
@@ -3634,10 +3656,10 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
                         const IntrinsicType a2( A.load(i1,k) );
                         const IntrinsicType b1( set( B(k,j    ) ) );
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
-                        xmm1 = xmm1 - a1 * b1;
-                        xmm2 = xmm2 - a2 * b1;
-                        xmm3 = xmm3 - a1 * b2;
-                        xmm4 = xmm4 - a2 * b2;
+                        xmm1 = fnmadd( a1, b1, xmm1 );
+                        xmm2 = fnmadd( a2, b1, xmm2 );
+                        xmm3 = fnmadd( a1, b2, xmm3 );
+                        xmm4 = fnmadd( a2, b2, xmm4 );
                      }
 
                      (~C).store( i , j    , xmm1 );
@@ -3658,8 +3680,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 - A.load(i ,k) * b1;
-                        xmm2 = xmm2 - A.load(i1,k) * b1;
+                        xmm1 = fnmadd( A.load(i ,k), b1, xmm1 );
+                        xmm2 = fnmadd( A.load(i1,k), b1, xmm2 );
                      }
 
                      (~C).store( i , j, xmm1 );
@@ -3680,7 +3702,7 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 - A.load(i,k) * b1;
+                        xmm1 = fnmadd( A.load(i,k), b1, xmm1 );
                      }
 
                      (~C).store( i, j, xmm1 );
@@ -3949,7 +3971,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    */
    template< typename MT  // Type of the target dense matrix
            , bool SO >    // Storage order of the target dense matrix
-   friend inline typename EnableIf< IsEvaluationRequired<MT,MT1,MT2> >::Type
+   friend inline typename EnableIf< And< IsEvaluationRequired<MT,MT1,MT2>
+                                       , Not< UseTaskGraph<MT,MT1,MT2> > > >::Type
       smpAssign( DenseMatrix<MT,SO>& lhs, const TDMatTDMatMultExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
@@ -3980,6 +4003,53 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP assignment to dense matrices (task graph)***********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a transpose dense matrix-transpose dense matrix multiplication with
+   //        evaluated operands to a dense matrix (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a transpose dense
+   // matrix-transpose dense matrix multiplication expression to a dense matrix in case both matrix
+   // operands require an intermediate evaluation. The two operands are evaluated concurrently (see
+   // the smpConcurrentAssign() function) before the multiplication of the two temporaries is
+   // computed by the parallel multiplication kernel.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline typename EnableIf< UseTaskGraph<MT,MT1,MT2> >::Type
+      smpAssign( DenseMatrix<MT,SO>& lhs, const TDMatTDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( (~lhs).rows() == 0UL || (~lhs).columns() == 0UL ) {
+         return;
+      }
+      else if( rhs.lhs_.columns() == 0UL ) {
+         reset( ~lhs );
+         return;
+      }
+
+      RT1 A( rhs.lhs_.rows(), rhs.lhs_.columns() );  // Evaluation of the left-hand side dense matrix operand
+      RT2 B( rhs.rhs_.rows(), rhs.rhs_.columns() );  // Evaluation of the right-hand side dense matrix operand
+
+      smpConcurrentAssign( A, rhs.lhs_, B, rhs.rhs_ );
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns(), "Invalid number of columns" );
+
+      smpAssign( ~lhs, A * B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to sparse matrices***********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP assignment of a transpose dense matrix-transpose dense matrix multiplication
@@ -5026,14 +5096,14 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 + A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 + A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 + A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 + A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
             (~C).store( i             , j, xmm1 * factor );
@@ -5073,14 +5143,14 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a3 * b1;
-               xmm4 = xmm4 + a4 * b1;
-               xmm5 = xmm5 + a1 * b2;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a3 * b2;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a3, b1, xmm3 );
+               xmm4 = fmadd( a4, b1, xmm4 );
+               xmm5 = fmadd( a1, b2, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a3, b2, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C).store( i             , j    , xmm1 * factor );
@@ -5106,10 +5176,10 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
             (~C).store( i             , j, xmm1 * factor );
@@ -5143,10 +5213,10 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a1 * b2;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a1, b2, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i         , j    , xmm1 * factor );
@@ -5168,8 +5238,8 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i         ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size,k) * b1;
+               xmm1 = fmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
             (~C).store( i         , j, xmm1 * factor );
@@ -5196,8 +5266,8 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * set( B(k,j    ) );
-               xmm2 = xmm2 + a1 * set( B(k,j+1UL) );
+               xmm1 = fmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
             (~C).store( i, j    , xmm1 * factor );
@@ -5215,7 +5285,7 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + A.load(i,k) * set( B(k,j) );
+               xmm1 = fmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
             (~C).store( i, j, xmm1 * factor );
@@ -5298,14 +5368,15 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       typedef IntrinsicTrait<ElementType>  IT;
+      typedef MMMTrait<ElementType>        MMMT;
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
       const size_t K( A.columns() );
 
-      const size_t iblock( 128UL );
-      const size_t jblock(  64UL );
-      const size_t kblock( 128UL );
+      const size_t iblock( MMMT::vblock() );
+      const size_t jblock( MMMT::sblock() );
+      const size_t kblock( MMMT::kblock() );
 
       const IntrinsicType factor( set( scalar ) );
 
@@ -5360,14 +5431,14 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
                         const IntrinsicType a4( A.load(i3,k) );
                         const IntrinsicType b1( set( B(k,j    ) ) );
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a2 * b1;
-                        xmm3 = xmm3 + a3 * b1;
-                        xmm4 = xmm4 + a4 * b1;
-                        xmm5 = xmm5 + a1 * b2;
-                        xmm6 = xmm6 + a2 * b2;
-                        xmm7 = xmm7 + a3 * b2;
-                        xmm8 = xmm8 + a4 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a2, b1, xmm2 );
+                        xmm3 = fmadd( a3, b1, xmm3 );
+                        xmm4 = fmadd( a4, b1, xmm4 );
+                        xmm5 = fmadd( a1, b2, xmm5 );
+                        xmm6 = fmadd( a2, b2, xmm6 );
+                        xmm7 = fmadd( a3, b2, xmm7 );
+                        xmm8 = fmadd( a4, b2, xmm8 );
                      }
 
                      (~C).store( i , j    , xmm1 * factor );
@@ -5394,10 +5465,10 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 + A.load(i ,k) * b1;
-                        xmm2 = xmm2 + A.load(i1,k) * b1;
-                        xmm3 = xmm3 + A.load(i2,k) * b1;
-                        xmm4 = xmm4 + A.load(i3,k) * b1;
+                        xmm1 = fmadd( A.load(i ,k), b1, xmm1 );
+                        xmm2 = fmadd( A.load(i1,k), b1, xmm2 );
+                        xmm3 = fmadd( A.load(i2,k), b1, xmm3 );
+                        xmm4 = fmadd( A.load(i3,k), b1, xmm4 );
                      }
 
                      (~C).store( i , j, xmm1 * factor );
@@ -5436,14 +5507,14 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
                         const IntrinsicType b3( set( B(k,j+2UL) ) );
                         const IntrinsicType b4( set( B(k,j+3UL) ) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a2 * b1;
-                        xmm3 = xmm3 + a1 * b2;
-                        xmm4 = xmm4 + a2 * b2;
-                        xmm5 = xmm5 + a1 * b3;
-                        xmm6 = xmm6 + a2 * b3;
-                        xmm7 = xmm7 + a1 * b4;
-                        xmm8 = xmm8 + a2 * b4;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a2, b1, xmm2 );
+                        xmm3 = fmadd( a1, b2, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
+                        xmm5 = fmadd( a1, b3, xmm5 );
+                        xmm6 = fmadd( a2, b3, xmm6 );
+                        xmm7 = fmadd( a1, b4, xmm7 );
+                        xmm8 = fmadd( a2, b4, xmm8 );
                      }
 
                      (~C).store( i , j    , xmm1 * factor );
@@ -5473,10 +5544,10 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
                         const IntrinsicType a2( A.load(i1,k) );
                         const IntrinsicType b1( set( B(k,j    ) ) );
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a2 * b1;
-                        xmm3 = xmm3 + a1 * b2;
-                        xmm4 = xmm4 + a2 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a2, b1, xmm2 );
+                        xmm3 = fmadd( a1, b2, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
                      }
 
                      (~C).store( i , j    , xmm1 * factor );
@@ -5497,8 +5568,8 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 + A.load(i ,k) * b1;
-                        xmm2 = xmm2 + A.load(i1,k) * b1;
+                        xmm1 = fmadd( A.load(i ,k), b1, xmm1 );
+                        xmm2 = fmadd( A.load(i1,k), b1, xmm2 );
                      }
 
                      (~C).store( i , j, xmm1 * factor );
@@ -5519,7 +5590,7 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 + A.load(i,k) * b1;
+                        xmm1 = fmadd( A.load(i,k), b1, xmm1 );
                      }
 
                      (~C).store( i, j, xmm1 * factor );
@@ -6129,24 +6200,24 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 + A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 + A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 + A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 + A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
-            (~C).store( i             , j, (~C).load(i             ,j) + xmm1 * factor );
-            (~C).store( i+IT::size    , j, (~C).load(i+IT::size    ,j) + xmm2 * factor );
-            (~C).store( i+IT::size*2UL, j, (~C).load(i+IT::size*2UL,j) + xmm3 * factor );
-            (~C).store( i+IT::size*3UL, j, (~C).load(i+IT::size*3UL,j) + xmm4 * factor );
-            (~C).store( i+IT::size*4UL, j, (~C).load(i+IT::size*4UL,j) + xmm5 * factor );
-            (~C).store( i+IT::size*5UL, j, (~C).load(i+IT::size*5UL,j) + xmm6 * factor );
-            (~C).store( i+IT::size*6UL, j, (~C).load(i+IT::size*6UL,j) + xmm7 * factor );
-            (~C).store( i+IT::size*7UL, j, (~C).load(i+IT::size*7UL,j) + xmm8 * factor );
+            (~C).store( i             , j, fmadd( xmm1, factor, (~C).load(i             ,j) ) );
+            (~C).store( i+IT::size    , j, fmadd( xmm2, factor, (~C).load(i+IT::size    ,j) ) );
+            (~C).store( i+IT::size*2UL, j, fmadd( xmm3, factor, (~C).load(i+IT::size*2UL,j) ) );
+            (~C).store( i+IT::size*3UL, j, fmadd( xmm4, factor, (~C).load(i+IT::size*3UL,j) ) );
+            (~C).store( i+IT::size*4UL, j, fmadd( xmm5, factor, (~C).load(i+IT::size*4UL,j) ) );
+            (~C).store( i+IT::size*5UL, j, fmadd( xmm6, factor, (~C).load(i+IT::size*5UL,j) ) );
+            (~C).store( i+IT::size*6UL, j, fmadd( xmm7, factor, (~C).load(i+IT::size*6UL,j) ) );
+            (~C).store( i+IT::size*7UL, j, fmadd( xmm8, factor, (~C).load(i+IT::size*7UL,j) ) );
          }
       }
 
@@ -6176,24 +6247,24 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a3 * b1;
-               xmm4 = xmm4 + a4 * b1;
-               xmm5 = xmm5 + a1 * b2;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a3 * b2;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a3, b1, xmm3 );
+               xmm4 = fmadd( a4, b1, xmm4 );
+               xmm5 = fmadd( a1, b2, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a3, b2, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
-            (~C).store( i             , j    , (~C).load(i             ,j    ) + xmm1 * factor );
-            (~C).store( i+IT::size    , j    , (~C).load(i+IT::size    ,j    ) + xmm2 * factor );
-            (~C).store( i+IT::size*2UL, j    , (~C).load(i+IT::size*2UL,j    ) + xmm3 * factor );
-            (~C).store( i+IT::size*3UL, j    , (~C).load(i+IT::size*3UL,j    ) + xmm4 * factor );
-            (~C).store( i             , j+1UL, (~C).load(i             ,j+1UL) + xmm5 * factor );
-            (~C).store( i+IT::size    , j+1UL, (~C).load(i+IT::size    ,j+1UL) + xmm6 * factor );
-            (~C).store( i+IT::size*2UL, j+1UL, (~C).load(i+IT::size*2UL,j+1UL) + xmm7 * factor );
-            (~C).store( i+IT::size*3UL, j+1UL, (~C).load(i+IT::size*3UL,j+1UL) + xmm8 * factor );
+            (~C).store( i             , j    , fmadd( xmm1, factor, (~C).load(i             ,j    ) ) );
+            (~C).store( i+IT::size    , j    , fmadd( xmm2, factor, (~C).load(i+IT::size    ,j    ) ) );
+            (~C).store( i+IT::size*2UL, j    , fmadd( xmm3, factor, (~C).load(i+IT::size*2UL,j    ) ) );
+            (~C).store( i+IT::size*3UL, j    , fmadd( xmm4, factor, (~C).load(i+IT::size*3UL,j    ) ) );
+            (~C).store( i             , j+1UL, fmadd( xmm5, factor, (~C).load(i             ,j+1UL) ) );
+            (~C).store( i+IT::size    , j+1UL, fmadd( xmm6, factor, (~C).load(i+IT::size    ,j+1UL) ) );
+            (~C).store( i+IT::size*2UL, j+1UL, fmadd( xmm7, factor, (~C).load(i+IT::size*2UL,j+1UL) ) );
+            (~C).store( i+IT::size*3UL, j+1UL, fmadd( xmm8, factor, (~C).load(i+IT::size*3UL,j+1UL) ) );
          }
 
          if( j < N )
@@ -6209,16 +6280,16 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
-            (~C).store( i             , j, (~C).load(i             ,j) + xmm1 * factor );
-            (~C).store( i+IT::size    , j, (~C).load(i+IT::size    ,j) + xmm2 * factor );
-            (~C).store( i+IT::size*2UL, j, (~C).load(i+IT::size*2UL,j) + xmm3 * factor );
-            (~C).store( i+IT::size*3UL, j, (~C).load(i+IT::size*3UL,j) + xmm4 * factor );
+            (~C).store( i             , j, fmadd( xmm1, factor, (~C).load(i             ,j) ) );
+            (~C).store( i+IT::size    , j, fmadd( xmm2, factor, (~C).load(i+IT::size    ,j) ) );
+            (~C).store( i+IT::size*2UL, j, fmadd( xmm3, factor, (~C).load(i+IT::size*2UL,j) ) );
+            (~C).store( i+IT::size*3UL, j, fmadd( xmm4, factor, (~C).load(i+IT::size*3UL,j) ) );
          }
       }
 
@@ -6246,16 +6317,16 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a1 * b2;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a1, b2, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
-            (~C).store( i         , j    , (~C).load(i         ,j    ) + xmm1 * factor );
-            (~C).store( i+IT::size, j    , (~C).load(i+IT::size,j    ) + xmm2 * factor );
-            (~C).store( i         , j+1UL, (~C).load(i         ,j+1UL) + xmm3 * factor );
-            (~C).store( i+IT::size, j+1UL, (~C).load(i+IT::size,j+1UL) + xmm4 * factor );
+            (~C).store( i         , j    , fmadd( xmm1, factor, (~C).load(i         ,j    ) ) );
+            (~C).store( i+IT::size, j    , fmadd( xmm2, factor, (~C).load(i+IT::size,j    ) ) );
+            (~C).store( i         , j+1UL, fmadd( xmm3, factor, (~C).load(i         ,j+1UL) ) );
+            (~C).store( i+IT::size, j+1UL, fmadd( xmm4, factor, (~C).load(i+IT::size,j+1UL) ) );
          }
 
          if( j < N )
@@ -6271,12 +6342,12 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i         ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size,k) * b1;
+               xmm1 = fmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
-            (~C).store( i         , j, (~C).load(i         ,j) + xmm1 * factor );
-            (~C).store( i+IT::size, j, (~C).load(i+IT::size,j) + xmm2 * factor );
+            (~C).store( i         , j, fmadd( xmm1, factor, (~C).load(i         ,j) ) );
+            (~C).store( i+IT::size, j, fmadd( xmm2, factor, (~C).load(i+IT::size,j) ) );
          }
       }
 
@@ -6299,12 +6370,12 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * set( B(k,j    ) );
-               xmm2 = xmm2 + a1 * set( B(k,j+1UL) );
+               xmm1 = fmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
-            (~C).store( i, j    , (~C).load(i,j    ) + xmm1 * factor );
-            (~C).store( i, j+1UL, (~C).load(i,j+1UL) + xmm2 * factor );
+            (~C).store( i, j    , fmadd( xmm1, factor, (~C).load(i,j    ) ) );
+            (~C).store( i, j+1UL, fmadd( xmm2, factor, (~C).load(i,j+1UL) ) );
          }
 
          if( j < N )
@@ -6318,10 +6389,10 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + A.load(i,k) * set( B(k,j) );
+               xmm1 = fmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
-            (~C).store( i, j, (~C).load(i,j) + xmm1 * factor );
+            (~C).store( i, j, fmadd( xmm1, factor, (~C).load(i,j) ) );
          }
       }
    }
@@ -6401,14 +6472,15 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       typedef IntrinsicTrait<ElementType>  IT;
+      typedef MMMTrait<ElementType>        MMMT;
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
       const size_t K( A.columns() );
 
-      const size_t iblock( 128UL );
-      const size_t jblock(  64UL );
-      const size_t kblock( 128UL );
+      const size_t iblock( MMMT::vblock() );
+      const size_t jblock( MMMT::sblock() );
+      const size_t kblock( MMMT::kblock() );
 
       const IntrinsicType factor( set( scalar ) );
 
@@ -6457,14 +6529,14 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
                         const IntrinsicType a4( A.load(i3,k) );
                         const IntrinsicType b1( set( B(k,j    ) ) );
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a2 * b1;
-                        xmm3 = xmm3 + a3 * b1;
-                        xmm4 = xmm4 + a4 * b1;
-                        xmm5 = xmm5 + a1 * b2;
-                        xmm6 = xmm6 + a2 * b2;
-                        xmm7 = xmm7 + a3 * b2;
-                        xmm8 = xmm8 + a4 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a2, b1, xmm2 );
+                        xmm3 = fmadd( a3, b1, xmm3 );
+                        xmm4 = fmadd( a4, b1, xmm4 );
+                        xmm5 = fmadd( a1, b2, xmm5 );
+                        xmm6 = fmadd( a2, b2, xmm6 );
+                        xmm7 = fmadd( a3, b2, xmm7 );
+                        xmm8 = fmadd( a4, b2, xmm8 );
                      }
 
                      (~C).store( i , j    , xmm1 * factor );
@@ -6491,10 +6563,10 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 + A.load(i ,k) * b1;
-                        xmm2 = xmm2 + A.load(i1,k) * b1;
-                        xmm3 = xmm3 + A.load(i2,k) * b1;
-                        xmm4 = xmm4 + A.load(i3,k) * b1;
+                        xmm1 = fmadd( A.load(i ,k), b1, xmm1 );
+                        xmm2 = fmadd( A.load(i1,k), b1, xmm2 );
+                        xmm3 = fmadd( A.load(i2,k), b1, xmm3 );
+                        xmm4 = fmadd( A.load(i3,k), b1, xmm4 );
                      }
 
                      (~C).store( i , j, xmm1 * factor );
@@ -6533,14 +6605,14 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
                         const IntrinsicType b3( set( B(k,j+2UL) ) );
                         const IntrinsicType b4( set( B(k,j+3UL) ) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a2 * b1;
-                        xmm3 = xmm3 + a1 * b2;
-                        xmm4 = xmm4 + a2 * b2;
-                        xmm5 = xmm5 + a1 * b3;
-                        xmm6 = xmm6 + a2 * b3;
-                        xmm7 = xmm7 + a1 * b4;
-                        xmm8 = xmm8 + a2 * b4;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a2, b1, xmm2 );
+                        xmm3 = fmadd( a1, b2, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
+                        xmm5 = fmadd( a1, b3, xmm5 );
+                        xmm6 = fmadd( a2, b3, xmm6 );
+                        xmm7 = fmadd( a1, b4, xmm7 );
+                        xmm8 = fmadd( a2, b4, xmm8 );
                      }
 
                      (~C).store( i , j    , xmm1 * factor );
@@ -6570,10 +6642,10 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
                         const IntrinsicType a2( A.load(i1,k) );
                         const IntrinsicType b1( set( B(k,j    ) ) );
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
-                        xmm1 = xmm1 + a1 * b1;
-                        xmm2 = xmm2 + a2 * b1;
-                        xmm3 = xmm3 + a1 * b2;
-                        xmm4 = xmm4 + a2 * b2;
+                        xmm1 = fmadd( a1, b1, xmm1 );
+                        xmm2 = fmadd( a2, b1, xmm2 );
+                        xmm3 = fmadd( a1, b2, xmm3 );
+                        xmm4 = fmadd( a2, b2, xmm4 );
                      }
 
                      (~C).store( i , j    , xmm1 * factor );
@@ -6594,8 +6666,8 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 + A.load(i ,k) * b1;
-                        xmm2 = xmm2 + A.load(i1,k) * b1;
+                        xmm1 = fmadd( A.load(i ,k), b1, xmm1 );
+                        xmm2 = fmadd( A.load(i1,k), b1, xmm2 );
                      }
 
                      (~C).store( i , j, xmm1 * factor );
@@ -6616,7 +6688,7 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 + A.load(i,k) * b1;
+                        xmm1 = fmadd( A.load(i,k), b1, xmm1 );
                      }
 
                      (~C).store( i, j, xmm1 * factor );
@@ -7204,24 +7276,24 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 + A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 + A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 + A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 + A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
-            (~C).store( i             , j, (~C).load(i             ,j) - xmm1 * factor );
-            (~C).store( i+IT::size    , j, (~C).load(i+IT::size    ,j) - xmm2 * factor );
-            (~C).store( i+IT::size*2UL, j, (~C).load(i+IT::size*2UL,j) - xmm3 * factor );
-            (~C).store( i+IT::size*3UL, j, (~C).load(i+IT::size*3UL,j) - xmm4 * factor );
-            (~C).store( i+IT::size*4UL, j, (~C).load(i+IT::size*4UL,j) - xmm5 * factor );
-            (~C).store( i+IT::size*5UL, j, (~C).load(i+IT::size*5UL,j) - xmm6 * factor );
-            (~C).store( i+IT::size*6UL, j, (~C).load(i+IT::size*6UL,j) - xmm7 * factor );
-            (~C).store( i+IT::size*7UL, j, (~C).load(i+IT::size*7UL,j) - xmm8 * factor );
+            (~C).store( i             , j, fnmadd( xmm1, factor, (~C).load(i             ,j) ) );
+            (~C).store( i+IT::size    , j, fnmadd( xmm2, factor, (~C).load(i+IT::size    ,j) ) );
+            (~C).store( i+IT::size*2UL, j, fnmadd( xmm3, factor, (~C).load(i+IT::size*2UL,j) ) );
+            (~C).store( i+IT::size*3UL, j, fnmadd( xmm4, factor, (~C).load(i+IT::size*3UL,j) ) );
+            (~C).store( i+IT::size*4UL, j, fnmadd( xmm5, factor, (~C).load(i+IT::size*4UL,j) ) );
+            (~C).store( i+IT::size*5UL, j, fnmadd( xmm6, factor, (~C).load(i+IT::size*5UL,j) ) );
+            (~C).store( i+IT::size*6UL, j, fnmadd( xmm7, factor, (~C).load(i+IT::size*6UL,j) ) );
+            (~C).store( i+IT::size*7UL, j, fnmadd( xmm8, factor, (~C).load(i+IT::size*7UL,j) ) );
          }
       }
 
@@ -7251,24 +7323,24 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a3 * b1;
-               xmm4 = xmm4 + a4 * b1;
-               xmm5 = xmm5 + a1 * b2;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a3 * b2;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a3, b1, xmm3 );
+               xmm4 = fmadd( a4, b1, xmm4 );
+               xmm5 = fmadd( a1, b2, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a3, b2, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
-            (~C).store( i             , j    , (~C).load(i             ,j    ) - xmm1 * factor );
-            (~C).store( i+IT::size    , j    , (~C).load(i+IT::size    ,j    ) - xmm2 * factor );
-            (~C).store( i+IT::size*2UL, j    , (~C).load(i+IT::size*2UL,j    ) - xmm3 * factor );
-            (~C).store( i+IT::size*3UL, j    , (~C).load(i+IT::size*3UL,j    ) - xmm4 * factor );
-            (~C).store( i             , j+1UL, (~C).load(i             ,j+1UL) - xmm5 * factor );
-            (~C).store( i+IT::size    , j+1UL, (~C).load(i+IT::size    ,j+1UL) - xmm6 * factor );
-            (~C).store( i+IT::size*2UL, j+1UL, (~C).load(i+IT::size*2UL,j+1UL) - xmm7 * factor );
-            (~C).store( i+IT::size*3UL, j+1UL, (~C).load(i+IT::size*3UL,j+1UL) - xmm8 * factor );
+            (~C).store( i             , j    , fnmadd( xmm1, factor, (~C).load(i             ,j    ) ) );
+            (~C).store( i+IT::size    , j    , fnmadd( xmm2, factor, (~C).load(i+IT::size    ,j    ) ) );
+            (~C).store( i+IT::size*2UL, j    , fnmadd( xmm3, factor, (~C).load(i+IT::size*2UL,j    ) ) );
+            (~C).store( i+IT::size*3UL, j    , fnmadd( xmm4, factor, (~C).load(i+IT::size*3UL,j    ) ) );
+            (~C).store( i             , j+1UL, fnmadd( xmm5, factor, (~C).load(i             ,j+1UL) ) );
+            (~C).store( i+IT::size    , j+1UL, fnmadd( xmm6, factor, (~C).load(i+IT::size    ,j+1UL) ) );
+            (~C).store( i+IT::size*2UL, j+1UL, fnmadd( xmm7, factor, (~C).load(i+IT::size*2UL,j+1UL) ) );
+            (~C).store( i+IT::size*3UL, j+1UL, fnmadd( xmm8, factor, (~C).load(i+IT::size*3UL,j+1UL) ) );
          }
 
          if( j < N )
@@ -7284,16 +7356,16 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
-            (~C).store( i             , j, (~C).load(i             ,j) - xmm1 * factor );
-            (~C).store( i+IT::size    , j, (~C).load(i+IT::size    ,j) - xmm2 * factor );
-            (~C).store( i+IT::size*2UL, j, (~C).load(i+IT::size*2UL,j) - xmm3 * factor );
-            (~C).store( i+IT::size*3UL, j, (~C).load(i+IT::size*3UL,j) - xmm4 * factor );
+            (~C).store( i             , j, fnmadd( xmm1, factor, (~C).load(i             ,j) ) );
+            (~C).store( i+IT::size    , j, fnmadd( xmm2, factor, (~C).load(i+IT::size    ,j) ) );
+            (~C).store( i+IT::size*2UL, j, fnmadd( xmm3, factor, (~C).load(i+IT::size*2UL,j) ) );
+            (~C).store( i+IT::size*3UL, j, fnmadd( xmm4, factor, (~C).load(i+IT::size*3UL,j) ) );
          }
       }
 
@@ -7321,16 +7393,16 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a1 * b2;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a1, b2, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
-            (~C).store( i         , j    , (~C).load(i         ,j    ) - xmm1 * factor );
-            (~C).store( i+IT::size, j    , (~C).load(i+IT::size,j    ) - xmm2 * factor );
-            (~C).store( i         , j+1UL, (~C).load(i         ,j+1UL) - xmm3 * factor );
-            (~C).store( i+IT::size, j+1UL, (~C).load(i+IT::size,j+1UL) - xmm4 * factor );
+            (~C).store( i         , j    , fnmadd( xmm1, factor, (~C).load(i         ,j    ) ) );
+            (~C).store( i+IT::size, j    , fnmadd( xmm2, factor, (~C).load(i+IT::size,j    ) ) );
+            (~C).store( i         , j+1UL, fnmadd( xmm3, factor, (~C).load(i         ,j+1UL) ) );
+            (~C).store( i+IT::size, j+1UL, fnmadd( xmm4, factor, (~C).load(i+IT::size,j+1UL) ) );
          }
 
          if( j < N )
@@ -7346,12 +7418,12 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i         ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size,k) * b1;
+               xmm1 = fmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
-            (~C).store( i         , j, (~C).load(i         ,j) - xmm1 * factor );
-            (~C).store( i+IT::size, j, (~C).load(i+IT::size,j) - xmm2 * factor );
+            (~C).store( i         , j, fnmadd( xmm1, factor, (~C).load(i         ,j) ) );
+            (~C).store( i+IT::size, j, fnmadd( xmm2, factor, (~C).load(i+IT::size,j) ) );
          }
       }
 
@@ -7374,12 +7446,12 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * set( B(k,j    ) );
-               xmm2 = xmm2 + a1 * set( B(k,j+1UL) );
+               xmm1 = fmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
-            (~C).store( i, j    , (~C).load(i,j    ) - xmm1 * factor );
-            (~C).store( i, j+1UL, (~C).load(i,j+1UL) - xmm2 * factor );
+            (~C).store( i, j    , fnmadd( xmm1, factor, (~C).load(i,j    ) ) );
+            (~C).store( i, j+1UL, fnmadd( xmm2, factor, (~C).load(i,j+1UL) ) );
          }
 
          if( j < N )
@@ -7393,10 +7465,10 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + A.load(i,k) * set( B(k,j) );
+               xmm1 = fmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
-            (~C).store( i, j, (~C).load(i,j) - xmm1 * factor );
+            (~C).store( i, j, fnmadd( xmm1, factor, (~C).load(i,j) ) );
          }
       }
    }
@@ -7476,14 +7548,15 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       typedef IntrinsicTrait<ElementType>  IT;
+      typedef MMMTrait<ElementType>        MMMT;
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
       const size_t K( A.columns() );
 
-      const size_t iblock( 128UL );
-      const size_t jblock(  64UL );
-      const size_t kblock( 128UL );
+      const size_t iblock( MMMT::vblock() );
+      const size_t jblock( MMMT::sblock() );
+      const size_t kblock( MMMT::kblock() );
 
       const IntrinsicType factor( set( scalar ) );
 
@@ -7532,14 +7605,14 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
                         const IntrinsicType a4( A.load(i3,k) );
                         const IntrinsicType b1( set( B(k,j    ) ) );
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
-                        xmm1 = xmm1 - a1 * b1;
-                        xmm2 = xmm2 - a2 * b1;
-                        xmm3 = xmm3 - a3 * b1;
-                        xmm4 = xmm4 - a4 * b1;
-                        xmm5 = xmm5 - a1 * b2;
-                        xmm6 = xmm6 - a2 * b2;
-                        xmm7 = xmm7 - a3 * b2;
-                        xmm8 = xmm8 - a4 * b2;
+                        xmm1 = fnmadd( a1, b1, xmm1 );
+                        xmm2 = fnmadd( a2, b1, xmm2 );
+                        xmm3 = fnmadd( a3, b1, xmm3 );
+                        xmm4 = fnmadd( a4, b1, xmm4 );
+                        xmm5 = fnmadd( a1, b2, xmm5 );
+                        xmm6 = fnmadd( a2, b2, xmm6 );
+                        xmm7 = fnmadd( a3, b2, xmm7 );
+                        xmm8 = fnmadd( a4, b2, xmm8 );
                      }
 
                      (~C).store( i , j    , xmm1 * factor );
@@ -7566,10 +7639,10 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 - A.load(i ,k) * b1;
-                        xmm2 = xmm2 - A.load(i1,k) * b1;
-                        xmm3 = xmm3 - A.load(i2,k) * b1;
-                        xmm4 = xmm4 - A.load(i3,k) * b1;
+                        xmm1 = fnmadd( A.load(i ,k), b1, xmm1 );
+                        xmm2 = fnmadd( A.load(i1,k), b1, xmm2 );
+                        xmm3 = fnmadd( A.load(i2,k), b1, xmm3 );
+                        xmm4 = fnmadd( A.load(i3,k), b1, xmm4 );
                      }
 
                      (~C).store( i , j, xmm1 * factor );
@@ -7608,14 +7681,14 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
                         const IntrinsicType b3( set( B(k,j+2UL) ) );
                         const IntrinsicType b4( set( B(k,j+3UL) ) );
-                        xmm1 = xmm1 - a1 * b1;
-                        xmm2 = xmm2 - a2 * b1;
-                        xmm3 = xmm3 - a1 * b2;
-                        xmm4 = xmm4 - a2 * b2;
-                        xmm5 = xmm5 - a1 * b3;
-                        xmm6 = xmm6 - a2 * b3;
-                        xmm7 = xmm7 - a1 * b4;
-                        xmm8 = xmm8 - a2 * b4;
+                        xmm1 = fnmadd( a1, b1, xmm1 );
+                        xmm2 = fnmadd( a2, b1, xmm2 );
+                        xmm3 = fnmadd( a1, b2, xmm3 );
+                        xmm4 = fnmadd( a2, b2, xmm4 );
+                        xmm5 = fnmadd( a1, b3, xmm5 );
+                        xmm6 = fnmadd( a2, b3, xmm6 );
+                        xmm7 = fnmadd( a1, b4, xmm7 );
+                        xmm8 = fnmadd( a2, b4, xmm8 );
                      }
 
                      (~C).store( i , j    , xmm1 * factor );
@@ -7645,10 +7718,10 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
                         const IntrinsicType a2( A.load(i1,k) );
                         const IntrinsicType b1( set( B(k,j    ) ) );
                         const IntrinsicType b2( set( B(k,j+1UL) ) );
-                        xmm1 = xmm1 - a1 * b1;
-                        xmm2 = xmm2 - a2 * b1;
-                        xmm3 = xmm3 - a1 * b2;
-                        xmm4 = xmm4 - a2 * b2;
+                        xmm1 = fnmadd( a1, b1, xmm1 );
+                        xmm2 = fnmadd( a2, b1, xmm2 );
+                        xmm3 = fnmadd( a1, b2, xmm3 );
+                        xmm4 = fnmadd( a2, b2, xmm4 );
                      }
 
                      (~C).store( i , j    , xmm1 * factor );
@@ -7669,8 +7742,8 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 - A.load(i ,k) * b1;
-                        xmm2 = xmm2 - A.load(i1,k) * b1;
+                        xmm1 = fnmadd( A.load(i ,k), b1, xmm1 );
+                        xmm2 = fnmadd( A.load(i1,k), b1, xmm2 );
                      }
 
                      (~C).store( i , j, xmm1 * factor );
@@ -7691,7 +7764,7 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
                      for( size_t k=kbegin; k<kend; ++k ) {
                         const IntrinsicType b1( set( B(k,j) ) );
-                        xmm1 = xmm1 - A.load(i,k) * b1;
+                        xmm1 = fnmadd( A.load(i,k), b1, xmm1 );
                      }
 
                      (~C).store( i, j, xmm1 * factor );
@@ -648,14 +648,14 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
          }
 
          y.store( j             , xmm1 );
@@ -682,10 +682,10 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
          }
 
          y.store( j             , xmm1 );
@@ -708,9 +708,9 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
          }
 
          y.store( j             , xmm1 );
@@ -732,8 +732,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j         );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+            xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
          }
 
          y.store( j         , xmm1 );
@@ -753,7 +753,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; ++i ) {
-            xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+            xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
          }
 
          y.store( j, xmm1 );
@@ -838,14 +838,14 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-                  xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-                  xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-                  xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-                  xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+                  xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+                  xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+                  xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+                  xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
                }
 
                y.store( j             , y.load(j             ) + xmm1 );
@@ -864,10 +864,10 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
                }
 
                y.store( j             , y.load(j             ) + xmm1 );
@@ -882,9 +882,9 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
                }
 
                y.store( j             , y.load(j             ) + xmm1 );
@@ -898,8 +898,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j         );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+                  xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
                }
 
                y.store( j         , y.load(j         ) + xmm1 );
@@ -911,7 +911,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
                IntrinsicType xmm1;
 
                for( size_t i=ii; i<iend; ++i ) {
-                  xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+                  xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
                }
 
                y.store( j, y.load(j) + xmm1 );
@@ -1299,14 +1299,14 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
          }
 
          y.store( j             , xmm1 );
@@ -1336,10 +1336,10 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
          }
 
          y.store( j             , xmm1 );
@@ -1364,9 +1364,9 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
          }
 
          y.store( j             , xmm1 );
@@ -1389,8 +1389,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j         );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+            xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
          }
 
          y.store( j         , xmm1 );
@@ -1410,7 +1410,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
          IntrinsicType xmm1( y.load(j) );
 
          for( size_t i=ibegin; i<iend; ++i ) {
-            xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+            xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
          }
 
          y.store( j, xmm1 );
@@ -1493,14 +1493,14 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-                  xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-                  xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-                  xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-                  xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+                  xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+                  xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+                  xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+                  xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
                }
 
                y.store( j             , y.load(j             ) + xmm1 );
@@ -1519,10 +1519,10 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
                }
 
                y.store( j             , y.load(j             ) + xmm1 );
@@ -1537,9 +1537,9 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
                }
 
                y.store( j             , y.load(j             ) + xmm1 );
@@ -1553,8 +1553,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j         );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+                  xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
                }
 
                y.store( j         , y.load(j         ) + xmm1 );
@@ -1566,7 +1566,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
                IntrinsicType xmm1;
 
                for( size_t i=ii; i<iend; ++i ) {
-                  xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+                  xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
                }
 
                y.store( j, y.load(j) + xmm1 );
@@ -1933,14 +1933,14 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 - x1 * A.load(i,j             );
-            xmm2 = xmm2 - x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 - x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 - x1 * A.load(i,j+IT::size*3UL);
-            xmm5 = xmm5 - x1 * A.load(i,j+IT::size*4UL);
-            xmm6 = xmm6 - x1 * A.load(i,j+IT::size*5UL);
-            xmm7 = xmm7 - x1 * A.load(i,j+IT::size*6UL);
-            xmm8 = xmm8 - x1 * A.load(i,j+IT::size*7UL);
+            xmm1 = fnmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fnmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fnmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fnmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+            xmm5 = fnmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+            xmm6 = fnmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+            xmm7 = fnmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+            xmm8 = fnmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
          }
 
          y.store( j             , xmm1 );
@@ -1970,10 +1970,10 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 - x1 * A.load(i,j             );
-            xmm2 = xmm2 - x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 - x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 - x1 * A.load(i,j+IT::size*3UL);
+            xmm1 = fnmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fnmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fnmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fnmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
          }
 
          y.store( j             , xmm1 );
@@ -1998,9 +1998,9 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 - x1 * A.load(i,j             );
-            xmm2 = xmm2 - x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 - x1 * A.load(i,j+IT::size*2UL);
+            xmm1 = fnmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fnmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fnmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
          }
 
          y.store( j             , xmm1 );
@@ -2023,8 +2023,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 - x1 * A.load(i,j         );
-            xmm2 = xmm2 - x1 * A.load(i,j+IT::size);
+            xmm1 = fnmadd( x1, A.load(i,j         ), xmm1 );
+            xmm2 = fnmadd( x1, A.load(i,j+IT::size), xmm2 );
          }
 
          y.store( j         , xmm1 );
@@ -2044,7 +2044,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
          IntrinsicType xmm1( y.load(j) );
 
          for( size_t i=ibegin; i<iend; ++i ) {
-            xmm1 = xmm1 - set( x[i] ) * A.load(i,j);
+            xmm1 = fnmadd( set( x[i] ), A.load(i,j), xmm1 );
          }
 
          y.store( j, xmm1 );
@@ -2128,14 +2128,14 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-                  xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-                  xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-                  xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-                  xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+                  xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+                  xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+                  xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+                  xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
                }
 
                y.store( j             , y.load(j             ) - xmm1 );
@@ -2154,10 +2154,10 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
                }
 
                y.store( j             , y.load(j             ) - xmm1 );
@@ -2172,9 +2172,9 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
                }
 
                y.store( j             , y.load(j             ) - xmm1 );
@@ -2188,8 +2188,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j         );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+                  xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
                }
 
                y.store( j         , y.load(j         ) - xmm1 );
@@ -2201,7 +2201,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
                IntrinsicType xmm1;
 
                for( size_t i=ii; i<iend; ++i ) {
-                  xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+                  xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
                }
 
                y.store( j, y.load(j) - xmm1 );
@@ -3156,14 +3156,14 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
          }
 
          y.store( j             , xmm1*factor );
@@ -3190,10 +3190,10 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
          }
 
          y.store( j             , xmm1*factor );
@@ -3216,9 +3216,9 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
          }
 
          y.store( j             , xmm1*factor );
@@ -3240,8 +3240,8 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j         );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+            xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
          }
 
          y.store( j         , xmm1*factor );
@@ -3261,7 +3261,7 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; ++i ) {
-            xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+            xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
          }
 
          y.store( j, xmm1*factor );
@@ -3348,14 +3348,14 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-                  xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-                  xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-                  xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-                  xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+                  xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+                  xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+                  xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+                  xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
                }
 
                y.store( j             , y.load(j             ) + xmm1*factor );
@@ -3374,10 +3374,10 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
                }
 
                y.store( j             , y.load(j             ) + xmm1*factor );
@@ -3392,9 +3392,9 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
                }
 
                y.store( j             , y.load(j             ) + xmm1*factor );
@@ -3408,8 +3408,8 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j         );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+                  xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
                }
 
                y.store( j         , y.load(j         ) + xmm1*factor );
@@ -3421,7 +3421,7 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
                IntrinsicType xmm1;
 
                for( size_t i=ii; i<iend; ++i ) {
-                  xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+                  xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
                }
 
                y.store( j, y.load(j) + xmm1*factor );
@@ -3773,14 +3773,14 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
          }
 
          y.store( j             , y.load(j             ) + xmm1*factor );
@@ -3807,10 +3807,10 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
          }
 
          y.store( j             , y.load(j             ) + xmm1*factor );
@@ -3833,9 +3833,9 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
          }
 
          y.store( j             , y.load(j             ) + xmm1*factor );
@@ -3857,8 +3857,8 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j         );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+            xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
          }
 
          y.store( j         , y.load(j         ) + xmm1*factor );
@@ -3878,7 +3878,7 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; ++i ) {
-            xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+            xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
          }
 
          y.store( j, y.load(j) + xmm1*factor );
@@ -3964,14 +3964,14 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-                  xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-                  xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-                  xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-                  xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+                  xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+                  xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+                  xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+                  xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
                }
 
                y.store( j             , y.load(j             ) + xmm1*factor );
@@ -3990,10 +3990,10 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
                }
 
                y.store( j             , y.load(j             ) + xmm1*factor );
@@ -4008,9 +4008,9 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
                }
 
                y.store( j             , y.load(j             ) + xmm1*factor );
@@ -4024,8 +4024,8 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j         );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+                  xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
                }
 
                y.store( j         , y.load(j         ) + xmm1*factor );
@@ -4037,7 +4037,7 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
                IntrinsicType xmm1;
 
                for( size_t i=ii; i<iend; ++i ) {
-                  xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+                  xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
                }
 
                y.store( j, y.load(j) + xmm1*factor );
@@ -4370,14 +4370,14 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
          }
 
          y.store( j             , y.load(j             ) - xmm1*factor );
@@ -4404,10 +4404,10 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
          }
 
          y.store( j             , y.load(j             ) - xmm1*factor );
@@ -4430,9 +4430,9 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
          }
 
          y.store( j             , y.load(j             ) - xmm1*factor );
@@ -4454,8 +4454,8 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j         );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+            xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
          }
 
          y.store( j         , y.load(j         ) - xmm1*factor );
@@ -4475,7 +4475,7 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; ++i ) {
-            xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+            xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
          }
 
          y.store( j, y.load(j) - xmm1*factor );
@@ -4561,14 +4561,14 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-                  xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-                  xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-                  xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-                  xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+                  xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+                  xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+                  xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+                  xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
                }
 
                y.store( j             , y.load(j             ) - xmm1*factor );
@@ -4587,10 +4587,10 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
                }
 
                y.store( j             , y.load(j             ) - xmm1*factor );
@@ -4605,9 +4605,9 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
                }
 
                y.store( j             , y.load(j             ) - xmm1*factor );
@@ -4621,8 +4621,8 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j         );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+                  xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
                }
 
                y.store( j         , y.load(j         ) - xmm1*factor );
@@ -4634,7 +4634,7 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
                IntrinsicType xmm1;
 
                for( size_t i=ii; i<iend; ++i ) {
-                  xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+                  xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
                }
 
                y.store( j, y.load(j) - xmm1*factor );
@@ -43,6 +43,7 @@
 #include <stdexcept>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/Intrinsics.h>
+#include <blaze/math/smp/Reduction.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
@@ -89,6 +90,127 @@ struct TDVecDVecMultExprHelper
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default reduction kernel for the dense vector/dense vector scalar multiplication.
+// \ingroup dense_vector
+//
+// The TDVecDVecMultKernel class template computes the scalar product of a range of elements of
+// two dense vectors (see the smpReduce() functions).
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename VT2    // Type of the right-hand side dense vector
+        , typename RT >   // Result type of the scalar product
+struct TDVecDVecMultKernel
+{
+   //**Type definitions****************************************************************************
+   typedef RT  ResultType;  //!< Result type of the scalar product.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the TDVecDVecMultKernel class template.
+   //
+   // \param left The left-hand side dense vector.
+   // \param right The right-hand side dense vector.
+   */
+   explicit inline TDVecDVecMultKernel( const VT1& left, const VT2& right )
+      : left_ ( left  )  // The left-hand side dense vector
+      , right_( right )  // The right-hand side dense vector
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the scalar product of the given range of elements.
+   //
+   // \param begin The index of the first element.
+   // \param end The index one past the last element.
+   // \return The scalar product of the range of elements.
+   */
+   inline ResultType operator()( size_t begin, size_t end ) const {
+      ResultType sp( left_[begin] * right_[begin] );
+      for( size_t i=begin+1UL; i<end; ++i )
+         sp += left_[i] * right_[i];
+      return sp;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const VT1& left_;   //!< The left-hand side dense vector.
+   const VT2& right_;  //!< The right-hand side dense vector.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic reduction kernel for the dense vector/dense vector scalar multiplication.
+// \ingroup dense_vector
+//
+// The TDVecDVecMultIntrinsicKernel class template computes the scalar product of a range of
+// elements of two dense vectors by means of intrinsics (see the smpReduce() functions). The
+// first index of the range must be a multiple of the number of elements per intrinsic vector.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename VT2    // Type of the right-hand side dense vector
+        , typename RT >   // Result type of the scalar product
+struct TDVecDVecMultIntrinsicKernel
+{
+   //**Type definitions****************************************************************************
+   typedef RT                  ResultType;  //!< Result type of the scalar product.
+   typedef IntrinsicTrait<RT>  IT;          //!< Intrinsic trait for the result type.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the TDVecDVecMultIntrinsicKernel class template.
+   //
+   // \param left The left-hand side dense vector.
+   // \param right The right-hand side dense vector.
+   */
+   explicit inline TDVecDVecMultIntrinsicKernel( const VT1& left, const VT2& right )
+      : left_ ( left  )  // The left-hand side dense vector
+      , right_( right )  // The right-hand side dense vector
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the scalar product of the given range of elements.
+   //
+   // \param begin The index of the first element.
+   // \param end The index one past the last element.
+   // \return The scalar product of the range of elements.
+   */
+   inline ResultType operator()( size_t begin, size_t end ) const {
+      typename IT::Type xmm1, xmm2, xmm3, xmm4;
+
+      const size_t iend( end - ( end - begin ) % (IT::size*4UL) );
+
+      for( size_t i=begin; i<iend; i+=IT::size*4UL ) {
+         xmm1 = fmadd( left_.load(i             ), right_.load(i             ), xmm1 );
+         xmm2 = fmadd( left_.load(i+IT::size    ), right_.load(i+IT::size    ), xmm2 );
+         xmm3 = fmadd( left_.load(i+IT::size*2UL), right_.load(i+IT::size*2UL), xmm3 );
+         xmm4 = fmadd( left_.load(i+IT::size*3UL), right_.load(i+IT::size*3UL), xmm4 );
+      }
+
+      ResultType sp( sum( xmm1 + xmm2 + xmm3 + xmm4 ) );
+
+      for( size_t i=iend; i<end; ++i )
+         sp += left_[i] * right_[i];
+
+      return sp;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const VT1& left_;   //!< The left-hand side dense vector.
+   const VT2& right_;  //!< The right-hand side dense vector.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -121,7 +243,8 @@ struct TDVecDVecMultExprHelper
 // and \a T2 as well as the two element types \a T1::ElementType and \a T2::ElementType have
 // to be supported by the MultTrait class template.\n
 // In case the current sizes of the two given vectors don't match, a \a std::invalid_argument
-// is thrown.
+// is thrown. Large scalar products are computed in parallel (see the smpReduce() functions).
+// The result is independent of the number of threads.
 */
 template< typename T1    // Type of the left-hand side dense vector
         , typename T2 >  // Type of the right-hand side dense vector
@@ -145,12 +268,10 @@ inline typename DisableIf< TDVecDVecMultExprHelper<T1,T2>,
    Lhs left ( ~lhs );
    Rhs right( ~rhs );
 
-   MultType sp( left[0UL] * right[0UL] );
+   typedef TDVecDVecMultKernel< typename RemoveReference<Lhs>::Type
+                              , typename RemoveReference<Rhs>::Type, MultType >  Kernel;
 
-   for( size_t i=1UL; i<left.size(); ++i )
-      sp += left[i] * right[i];
-
-   return sp;
+   return smpReduce( left.size(), Kernel( left, right ) );
 }
 //*************************************************************************************************
 
@@ -181,7 +302,8 @@ inline typename DisableIf< TDVecDVecMultExprHelper<T1,T2>,
 // and \a T2 as well as the two element types \a T1::ElementType and \a T2::ElementType have
 // to be supported by the MultTrait class template.\n
 // In case the current sizes of the two given vectors don't match, a \a std::invalid_argument
-// is thrown.
+// is thrown. Large scalar products are computed in parallel (see the smpReduce() functions).
+// The result is independent of the number of threads.
 */
 template< typename T1    // Type of the left-hand side dense vector
         , typename T2 >  // Type of the right-hand side dense vector
@@ -199,31 +321,16 @@ inline typename EnableIf< TDVecDVecMultExprHelper<T1,T2>,
    typedef typename T1::ElementType           ET1;
    typedef typename T2::ElementType           ET2;
    typedef typename MultTrait<ET1,ET2>::Type  MultType;
-   typedef IntrinsicTrait<MultType>           IT;
 
    if( (~lhs).size() == 0UL ) return MultType();
 
    Lhs left ( ~lhs );
    Rhs right( ~rhs );
 
-   typename IT::Type xmm1, xmm2, xmm3, xmm4;
-
-   const size_t N  ( left.size() );
-   const size_t end( N - N % (IT::size*4UL) );
-
-   for( size_t i=0UL; i<end; i+=IT::size*4UL ) {
-      xmm1 = xmm1 + ( left.load(i             ) * right.load(i             ) );
-      xmm2 = xmm2 + ( left.load(i+IT::size    ) * right.load(i+IT::size    ) );
-      xmm3 = xmm3 + ( left.load(i+IT::size*2UL) * right.load(i+IT::size*2UL) );
-      xmm4 = xmm4 + ( left.load(i+IT::size*3UL) * right.load(i+IT::size*3UL) );
-   }
-
-   MultType sp( sum( xmm1 + xmm2 + xmm3 + xmm4 ) );
-
-   for( size_t i=end; i<N; ++i )
-      sp += left[i] * right[i];
+   typedef TDVecDVecMultIntrinsicKernel< typename RemoveReference<Lhs>::Type
+                                       , typename RemoveReference<Rhs>::Type, MultType >  Kernel;
 
-   return sp;
+   return smpReduce( left.size(), Kernel( left, right ) );
 }
 //*************************************************************************************************
 
@@ -597,14 +597,14 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+7UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+7UL), xmm8 );
          }
 
          y[j    ] = sum( xmm1 );
@@ -631,10 +631,10 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
          }
 
          y[j    ] = sum( xmm1 );
@@ -657,9 +657,9 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
          }
 
          y[j    ] = sum( xmm1 );
@@ -681,8 +681,8 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
          }
 
          y[j    ] = sum( xmm1 );
@@ -702,7 +702,7 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
-            xmm1 = xmm1 + x.load(i) * A.load(i,j);
+            xmm1 = fmadd( x.load(i), A.load(i,j), xmm1 );
          }
 
          y[j] = sum( xmm1 );
@@ -1286,14 +1286,14 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+7UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+7UL), xmm8 );
          }
 
          y[j    ] += sum( xmm1 );
@@ -1320,10 +1320,10 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
          }
 
          y[j    ] += sum( xmm1 );
@@ -1346,9 +1346,9 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
          }
 
          y[j    ] += sum( xmm1 );
@@ -1370,8 +1370,8 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
          }
 
          y[j    ] += sum( xmm1 );
@@ -1391,7 +1391,7 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(i);
+            xmm1 = fmadd( A.load(i,j), x.load(i), xmm1 );
          }
 
          y[j] += sum( xmm1 );
@@ -1952,14 +1952,14 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+7UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+7UL), xmm8 );
          }
 
          y[j    ] -= sum( xmm1 );
@@ -1986,10 +1986,10 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
          }
 
          y[j    ] -= sum( xmm1 );
@@ -2012,9 +2012,9 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
          }
 
          y[j    ] -= sum( xmm1 );
@@ -2036,8 +2036,8 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
          }
 
          y[j    ] -= sum( xmm1 );
@@ -2057,7 +2057,7 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(i);
+            xmm1 = fmadd( A.load(i,j), x.load(i), xmm1 );
          }
 
          y[j] -= sum( xmm1 );
@@ -3187,14 +3187,14 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+7UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+7UL), xmm8 );
          }
 
          y[j    ] = sum( xmm1 ) * scalar;
@@ -3221,10 +3221,10 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
          }
 
          y[j    ] = sum( xmm1 ) * scalar;
@@ -3247,9 +3247,9 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
          }
 
          y[j    ] = sum( xmm1 ) * scalar;
@@ -3271,8 +3271,8 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
          }
 
          y[j    ] = sum( xmm1 ) * scalar;
@@ -3292,7 +3292,7 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(i);
+            xmm1 = fmadd( A.load(i,j), x.load(i), xmm1 );
          }
 
          y[j] = sum( xmm1 ) * scalar;
@@ -3898,14 +3898,14 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+7UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+7UL), xmm8 );
          }
 
          y[j    ] += sum( xmm1 ) * scalar;
@@ -3932,10 +3932,10 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
          }
 
          y[j    ] += sum( xmm1 ) * scalar;
@@ -3958,9 +3958,9 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
          }
 
          y[j    ] += sum( xmm1 ) * scalar;
@@ -3982,8 +3982,8 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
          }
 
          y[j    ] += sum( xmm1 ) * scalar;
@@ -4003,7 +4003,7 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(i);
+            xmm1 = fmadd( A.load(i,j), x.load(i), xmm1 );
          }
 
          y[j] += sum( xmm1 ) * scalar;
@@ -4569,14 +4569,14 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+7UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+7UL), xmm8 );
          }
 
          y[j    ] -= sum( xmm1 ) * scalar;
@@ -4603,10 +4603,10 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
          }
 
          y[j    ] -= sum( xmm1 ) * scalar;
@@ -4629,9 +4629,9 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
          }
 
          y[j    ] -= sum( xmm1 ) * scalar;
@@ -4653,8 +4653,8 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
          }
 
          y[j    ] -= sum( xmm1 ) * scalar;
@@ -4674,7 +4674,7 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(i);
+            xmm1 = fmadd( A.load(i,j), x.load(i), xmm1 );
          }
 
          y[j] -= sum( xmm1 ) * scalar;
@@ -0,0 +1,270 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/FMA.h
+//  \brief Header file for the intrinsic fused multiply-add functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_FMA_H_
+#define _BLAZE_MATH_INTRINSICS_FMA_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/intrinsics/Addition.h>
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/math/intrinsics/Multiplication.h>
+#include <blaze/math/intrinsics/Subtraction.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC FUSED MULTIPLY-ADD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiply-add of three intrinsic vectors (\f$ a*b+c \f$).
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The addend.
+// \return The result of the multiply-add.
+//
+// This function provides the default multiply-add for all intrinsic data types, which is
+// computed by a separate multiplication and addition. For single and double precision floating
+// point values, fused multiply-add instructions with a single rounding step are used in case
+// the FMA mode is enabled (see the BLAZE_FMA_MODE compilation switch).
+*/
+template< typename T >  // Type of the intrinsic operands
+BLAZE_ALWAYS_INLINE T fmadd( const T& a, const T& b, const T& c )
+{
+   return a * b + c;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiply-subtract of three intrinsic vectors (\f$ a*b-c \f$).
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The subtrahend.
+// \return The result of the multiply-subtract.
+//
+// This function provides the default multiply-subtract for all intrinsic data types, which is
+// computed by a separate multiplication and subtraction. For single and double precision
+// floating point values, fused multiply-subtract instructions are used in case the FMA mode
+// is enabled (see the BLAZE_FMA_MODE compilation switch).
+*/
+template< typename T >  // Type of the intrinsic operands
+BLAZE_ALWAYS_INLINE T fmsub( const T& a, const T& b, const T& c )
+{
+   return a * b - c;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Negated multiply-add of three intrinsic vectors (\f$ c-a*b \f$).
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The minuend.
+// \return The result of the negated multiply-add.
+//
+// This function provides the default negated multiply-add for all intrinsic data types, which
+// is computed by a separate multiplication and subtraction. For single and double precision
+// floating point values, fused negated multiply-add instructions are used in case the FMA mode
+// is enabled (see the BLAZE_FMA_MODE compilation switch).
+*/
+template< typename T >  // Type of the intrinsic operands
+BLAZE_ALWAYS_INLINE T fnmadd( const T& a, const T& b, const T& c )
+{
+   return c - a * b;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_float_t fmadd( const sse_float_t&, const sse_float_t&, const sse_float_t& )
+// \brief Fused multiply-add of three vectors of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The addend.
+// \return The result of \f$ a*b+c \f$.
+*/
+#if BLAZE_FMA_MODE && ( BLAZE_MIC_MODE || BLAZE_AVX512F_MODE )
+BLAZE_ALWAYS_INLINE sse_float_t fmadd( const sse_float_t& a, const sse_float_t& b, const sse_float_t& c )
+{
+   return _mm512_fmadd_ps( a.value, b.value, c.value );
+}
+#elif BLAZE_FMA_MODE && BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_float_t fmadd( const sse_float_t& a, const sse_float_t& b, const sse_float_t& c )
+{
+   return _mm256_fmadd_ps( a.value, b.value, c.value );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t fmadd( const sse_double_t&, const sse_double_t&, const sse_double_t& )
+// \brief Fused multiply-add of three vectors of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The addend.
+// \return The result of \f$ a*b+c \f$.
+*/
+#if BLAZE_FMA_MODE && ( BLAZE_MIC_MODE || BLAZE_AVX512F_MODE )
+BLAZE_ALWAYS_INLINE sse_double_t fmadd( const sse_double_t& a, const sse_double_t& b, const sse_double_t& c )
+{
+   return _mm512_fmadd_pd( a.value, b.value, c.value );
+}
+#elif BLAZE_FMA_MODE && BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_double_t fmadd( const sse_double_t& a, const sse_double_t& b, const sse_double_t& c )
+{
+   return _mm256_fmadd_pd( a.value, b.value, c.value );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_float_t fmsub( const sse_float_t&, const sse_float_t&, const sse_float_t& )
+// \brief Fused multiply-subtract of three vectors of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The subtrahend.
+// \return The result of \f$ a*b-c \f$.
+*/
+#if BLAZE_FMA_MODE && ( BLAZE_MIC_MODE || BLAZE_AVX512F_MODE )
+BLAZE_ALWAYS_INLINE sse_float_t fmsub( const sse_float_t& a, const sse_float_t& b, const sse_float_t& c )
+{
+   return _mm512_fmsub_ps( a.value, b.value, c.value );
+}
+#elif BLAZE_FMA_MODE && BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_float_t fmsub( const sse_float_t& a, const sse_float_t& b, const sse_float_t& c )
+{
+   return _mm256_fmsub_ps( a.value, b.value, c.value );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t fmsub( const sse_double_t&, const sse_double_t&, const sse_double_t& )
+// \brief Fused multiply-subtract of three vectors of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The subtrahend.
+// \return The result of \f$ a*b-c \f$.
+*/
+#if BLAZE_FMA_MODE && ( BLAZE_MIC_MODE || BLAZE_AVX512F_MODE )
+BLAZE_ALWAYS_INLINE sse_double_t fmsub( const sse_double_t& a, const sse_double_t& b, const sse_double_t& c )
+{
+   return _mm512_fmsub_pd( a.value, b.value, c.value );
+}
+#elif BLAZE_FMA_MODE && BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_double_t fmsub( const sse_double_t& a, const sse_double_t& b, const sse_double_t& c )
+{
+   return _mm256_fmsub_pd( a.value, b.value, c.value );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_float_t fnmadd( const sse_float_t&, const sse_float_t&, const sse_float_t& )
+// \brief Fused negated multiply-add of three vectors of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The minuend.
+// \return The result of \f$ c-a*b \f$.
+*/
+#if BLAZE_FMA_MODE && ( BLAZE_MIC_MODE || BLAZE_AVX512F_MODE )
+BLAZE_ALWAYS_INLINE sse_float_t fnmadd( const sse_float_t& a, const sse_float_t& b, const sse_float_t& c )
+{
+   return _mm512_fnmadd_ps( a.value, b.value, c.value );
+}
+#elif BLAZE_FMA_MODE && BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_float_t fnmadd( const sse_float_t& a, const sse_float_t& b, const sse_float_t& c )
+{
+   return _mm256_fnmadd_ps( a.value, b.value, c.value );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t fnmadd( const sse_double_t&, const sse_double_t&, const sse_double_t& )
+// \brief Fused negated multiply-add of three vectors of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand of the multiplication.
+// \param b The right-hand side operand of the multiplication.
+// \param c The minuend.
+// \return The result of \f$ c-a*b \f$.
+*/
+#if BLAZE_FMA_MODE && ( BLAZE_MIC_MODE || BLAZE_AVX512F_MODE )
+BLAZE_ALWAYS_INLINE sse_double_t fnmadd( const sse_double_t& a, const sse_double_t& b, const sse_double_t& c )
+{
+   return _mm512_fnmadd_pd( a.value, b.value, c.value );
+}
+#elif BLAZE_FMA_MODE && BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_double_t fnmadd( const sse_double_t& a, const sse_double_t& b, const sse_double_t& c )
+{
+   return _mm256_fnmadd_pd( a.value, b.value, c.value );
+}
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -43,9 +43,14 @@
 #include <blaze/math/intrinsics/Abs.h>
 #include <blaze/math/intrinsics/Addition.h>
 #include <blaze/math/intrinsics/Division.h>
+#include <blaze/math/intrinsics/FMA.h>
+#include <blaze/math/intrinsics/Gather.h>
 #include <blaze/math/intrinsics/Load.h>
 #include <blaze/math/intrinsics/Loadu.h>
+#include <blaze/math/intrinsics/Maskload.h>
+#include <blaze/math/intrinsics/Maskstore.h>
 #include <blaze/math/intrinsics/Multiplication.h>
+#include <blaze/math/intrinsics/Prefetch.h>
 #include <blaze/math/intrinsics/Reduction.h>
 #include <blaze/math/intrinsics/Set.h>
 #include <blaze/math/intrinsics/Setzero.h>
@@ -0,0 +1,149 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Gather.h
+//  \brief Header file for the intrinsic gather functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_GATHER_H_
+#define _BLAZE_MATH_INTRINSICS_GATHER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC GATHER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param address The base address of the values to be gathered.
+// \param indices The indices of the values to be gathered.
+// \return The vector of gathered values.
+//
+// This function loads the values \a address[indices[0]], \a address[indices[1]], ... into a
+// single intrinsic vector. The function is only available in case the AVX2 mode is enabled.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_double_t gather( const double* address, const sse_int64_t& indices )
+{
+   return _mm512_i64gather_pd( indices.value, address, 8 );
+}
+#elif BLAZE_AVX2_MODE
+BLAZE_ALWAYS_INLINE sse_double_t gather( const double* address, const sse_int64_t& indices )
+{
+   return _mm256_i64gather_pd( address, indices.value, 8 );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of double precision floating point values via 32-bit indices.
+// \ingroup intrinsics
+//
+// \param address The base address of the values to be gathered.
+// \param indices Pointer to the first of the 32-bit indices of the values to be gathered.
+// \return The vector of gathered values.
+//
+// This function loads as many consecutive 32-bit indices as the intrinsic vector holds double
+// precision values and gathers the values \a address[indices[0]], \a address[indices[1]], ...
+// into a single intrinsic vector. The indices are not required to be properly aligned, but
+// since they are interpreted as signed integers, they must be smaller than \f$ 2^{31} \f$. The
+// function is only available in case the AVX2 mode is enabled.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_double_t gather( const double* address, const uint32_t* indices )
+{
+   const __m256i tmp( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices ) ) );
+   return _mm512_i32gather_pd( tmp, address, 8 );
+}
+#elif BLAZE_AVX2_MODE
+BLAZE_ALWAYS_INLINE sse_double_t gather( const double* address, const uint32_t* indices )
+{
+   const __m128i tmp( _mm_loadu_si128( reinterpret_cast<const __m128i*>( indices ) ) );
+   return _mm256_i32gather_pd( address, tmp, 8 );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loads a vector of interleaved double precision value/64-bit index pairs.
+// \ingroup intrinsics
+//
+// \param address The first value of the interleaved value/index pairs.
+// \param values The loaded values.
+// \param indices The loaded indices.
+// \return void
+//
+// This function loads as many consecutive 16-byte value/index pairs (a double precision value
+// followed by a 64-bit index, as for instance in the elements of a sparse matrix) as fit into
+// a single intrinsic vector and splits them into a vector of values and a vector of indices.
+// The values and indices are stored in the same, but not necessarily in the original order.
+// The given address is not required to be properly aligned. The function is only available
+// in case the AVX2 mode is enabled.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE void loadPairs( const double* address, sse_double_t& values, sse_int64_t& indices )
+{
+   const __m512d a( _mm512_loadu_pd( address       ) );
+   const __m512d b( _mm512_loadu_pd( address+8UL ) );
+   values.value  = _mm512_unpacklo_pd( a, b );
+   indices.value = _mm512_castpd_si512( _mm512_unpackhi_pd( a, b ) );
+}
+#elif BLAZE_AVX2_MODE
+BLAZE_ALWAYS_INLINE void loadPairs( const double* address, sse_double_t& values, sse_int64_t& indices )
+{
+   const __m256d a( _mm256_loadu_pd( address       ) );
+   const __m256d b( _mm256_loadu_pd( address+4UL ) );
+   values.value  = _mm256_unpacklo_pd( a, b );
+   indices.value = _mm256_castpd_si256( _mm256_unpackhi_pd( a, b ) );
+}
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
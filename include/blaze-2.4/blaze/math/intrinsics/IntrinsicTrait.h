@@ -76,7 +76,20 @@ struct IntrinsicTraitHelper;
 /*!\brief Specialization of the IntrinsicTraitHelper class template for 1-byte integral data types.
 // \ingroup intrinsics
 */
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+template<>
+struct IntrinsicTraitHelper<1UL>
+{
+   typedef sse_int8_t  Type;
+   enum { size           = 64,
+          addition       = 1,
+          subtraction    = 1,
+          multiplication = 0,
+          division       = 0,
+          absoluteValue  = 1,
+          masked         = 0 };
+};
+#elif BLAZE_AVX2_MODE
 template<>
 struct IntrinsicTraitHelper<1UL>
 {
@@ -86,7 +99,8 @@ struct IntrinsicTraitHelper<1UL>
           subtraction    = 1,
           multiplication = 0,
           division       = 0,
-          absoluteValue  = 1 };
+          absoluteValue  = 1,
+          masked         = 0 };
 };
 #else
 template<>
@@ -98,7 +112,8 @@ struct IntrinsicTraitHelper<1UL>
           subtraction    = BLAZE_SSE2_MODE,
           multiplication = 0,
           division       = 0,
-          absoluteValue  = BLAZE_SSSE3_MODE };
+          absoluteValue  = BLAZE_SSSE3_MODE,
+          masked         = 0 };
 };
 #endif
 /*! \endcond */
@@ -110,7 +125,20 @@ struct IntrinsicTraitHelper<1UL>
 /*!\brief Specialization of the IntrinsicTraitHelper class template for 2-byte integral data types.
 // \ingroup intrinsics
 */
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+template<>
+struct IntrinsicTraitHelper<2UL>
+{
+   typedef sse_int16_t  Type;
+   enum { size           = 32,
+          addition       = 1,
+          subtraction    = 1,
+          multiplication = 1,
+          division       = 0,
+          absoluteValue  = 1,
+          masked         = 1 };
+};
+#elif BLAZE_AVX2_MODE
 template<>
 struct IntrinsicTraitHelper<2UL>
 {
@@ -120,7 +148,8 @@ struct IntrinsicTraitHelper<2UL>
           subtraction    = 1,
           multiplication = 1,
           division       = 0,
-          absoluteValue  = 1 };
+          absoluteValue  = 1,
+          masked         = 0 };
 };
 #else
 template<>
@@ -132,7 +161,8 @@ struct IntrinsicTraitHelper<2UL>
           subtraction    = BLAZE_SSE2_MODE,
           multiplication = BLAZE_SSE2_MODE,
           division       = 0,
-          absoluteValue  = BLAZE_SSSE3_MODE };
+          absoluteValue  = BLAZE_SSSE3_MODE,
+          masked         = 0 };
 };
 #endif
 /*! \endcond */
@@ -154,7 +184,21 @@ struct IntrinsicTraitHelper<4UL>
           subtraction    = 1,
           multiplication = 1,
           division       = 1,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          masked         = 0 };
+};
+#elif BLAZE_AVX512F_MODE
+template<>
+struct IntrinsicTraitHelper<4UL>
+{
+   typedef sse_int32_t  Type;
+   enum { size           = 16,
+          addition       = 1,
+          subtraction    = 1,
+          multiplication = 1,
+          division       = 0,
+          absoluteValue  = 1,
+          masked         = 1 };
 };
 #elif BLAZE_AVX2_MODE
 template<>
@@ -166,7 +210,8 @@ struct IntrinsicTraitHelper<4UL>
           subtraction    = 1,
           multiplication = 1,
           division       = 0,
-          absoluteValue  = 1 };
+          absoluteValue  = 1,
+          masked         = 1 };
 };
 #else
 template<>
@@ -178,7 +223,8 @@ struct IntrinsicTraitHelper<4UL>
           subtraction    = BLAZE_SSE2_MODE,
           multiplication = BLAZE_SSE4_MODE,
           division       = 0,
-          absoluteValue  = BLAZE_SSSE3_MODE };
+          absoluteValue  = BLAZE_SSSE3_MODE,
+          masked         = 0 };
 };
 #endif
 /*! \endcond */
@@ -200,7 +246,21 @@ struct IntrinsicTraitHelper<8UL>
           subtraction    = 0,
           multiplication = 0,
           division       = 1,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          masked         = 0 };
+};
+#elif BLAZE_AVX512F_MODE
+template<>
+struct IntrinsicTraitHelper<8UL>
+{
+   typedef sse_int64_t  Type;
+   enum { size           = 8,
+          addition       = 1,
+          subtraction    = 1,
+          multiplication = BLAZE_AVX512DQ_MODE,
+          division       = 0,
+          absoluteValue  = 0,
+          masked         = 1 };
 };
 #elif BLAZE_AVX2_MODE
 template<>
@@ -212,7 +272,8 @@ struct IntrinsicTraitHelper<8UL>
           subtraction    = 1,
           multiplication = 0,
           division       = 0,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          masked         = 1 };
 };
 #else
 template<>
@@ -224,7 +285,8 @@ struct IntrinsicTraitHelper<8UL>
           subtraction    = BLAZE_SSE2_MODE,
           multiplication = 0,
           division       = 0,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          masked         = 0 };
 };
 #endif
 /*! \endcond */
@@ -254,7 +316,8 @@ struct IntrinsicTraitBase
           subtraction    = 0,
           multiplication = 0,
           division       = 0,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          masked         = 0 };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -279,7 +342,8 @@ struct IntrinsicTraitBase<char>
           subtraction    = Helper::subtraction,
           multiplication = Helper::multiplication,
           division       = Helper::division,
-          absoluteValue  = Helper::absoluteValue };
+          absoluteValue  = Helper::absoluteValue,
+          masked         = Helper::masked };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -304,7 +368,8 @@ struct IntrinsicTraitBase<signed char>
           subtraction    = Helper::subtraction,
           multiplication = Helper::multiplication,
           division       = Helper::division,
-          absoluteValue  = Helper::absoluteValue };
+          absoluteValue  = Helper::absoluteValue,
+          masked         = Helper::masked };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -329,7 +394,8 @@ struct IntrinsicTraitBase<unsigned char>
           subtraction    = Helper::subtraction,
           multiplication = Helper::multiplication,
           division       = Helper::division,
-          absoluteValue  = Helper::absoluteValue };
+          absoluteValue  = Helper::absoluteValue,
+          masked         = Helper::masked };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -354,7 +420,8 @@ struct IntrinsicTraitBase<wchar_t>
           subtraction    = Helper::subtraction,
           multiplication = Helper::multiplication,
           division       = Helper::division,
-          absoluteValue  = Helper::absoluteValue };
+          absoluteValue  = Helper::absoluteValue,
+          masked         = Helper::masked };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -379,7 +446,8 @@ struct IntrinsicTraitBase<short>
           subtraction    = Helper::subtraction,
           multiplication = Helper::multiplication,
           division       = Helper::division,
-          absoluteValue  = Helper::absoluteValue };
+          absoluteValue  = Helper::absoluteValue,
+          masked         = Helper::masked };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -404,7 +472,8 @@ struct IntrinsicTraitBase<unsigned short>
           subtraction    = Helper::subtraction,
           multiplication = Helper::multiplication,
           division       = Helper::division,
-          absoluteValue  = Helper::absoluteValue };
+          absoluteValue  = Helper::absoluteValue,
+          masked         = Helper::masked };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -429,7 +498,8 @@ struct IntrinsicTraitBase<int>
           subtraction    = Helper::subtraction,
           multiplication = Helper::multiplication,
           division       = Helper::division,
-          absoluteValue  = Helper::absoluteValue };
+          absoluteValue  = Helper::absoluteValue,
+          masked         = Helper::masked };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -454,7 +524,8 @@ struct IntrinsicTraitBase<unsigned int>
           subtraction    = Helper::subtraction,
           multiplication = Helper::multiplication,
           division       = Helper::division,
-          absoluteValue  = Helper::absoluteValue };
+          absoluteValue  = Helper::absoluteValue,
+          masked         = Helper::masked };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -479,7 +550,8 @@ struct IntrinsicTraitBase<long>
           subtraction    = Helper::subtraction,
           multiplication = Helper::multiplication,
           division       = Helper::division,
-          absoluteValue  = Helper::absoluteValue };
+          absoluteValue  = Helper::absoluteValue,
+          masked         = Helper::masked };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -504,7 +576,8 @@ struct IntrinsicTraitBase<unsigned long>
           subtraction    = Helper::subtraction,
           multiplication = Helper::multiplication,
           division       = Helper::division,
-          absoluteValue  = Helper::absoluteValue };
+          absoluteValue  = Helper::absoluteValue,
+          masked         = Helper::masked };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -516,6 +589,7 @@ struct IntrinsicTraitBase<unsigned long>
 // \ingroup intrinsics
 */
 #if BLAZE_MIC_MODE
+template<>
 struct IntrinsicTraitBase<float>
 {
    typedef sse_float_t  Type;
@@ -525,7 +599,22 @@ struct IntrinsicTraitBase<float>
           subtraction    = 1,
           multiplication = 1,
           division       = 1,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          masked         = 0 };
+};
+#elif BLAZE_AVX512F_MODE
+template<>
+struct IntrinsicTraitBase<float>
+{
+   typedef sse_float_t  Type;
+   enum { size           = ( 64UL / sizeof(float) ),
+          alignment      = AlignmentOf<float>::value,
+          addition       = 1,
+          subtraction    = 1,
+          multiplication = 1,
+          division       = 1,
+          absoluteValue  = 0,
+          masked         = 1 };
 };
 #elif BLAZE_AVX_MODE
 template<>
@@ -538,7 +627,8 @@ struct IntrinsicTraitBase<float>
           subtraction    = 1,
           multiplication = 1,
           division       = 1,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          masked         = 1 };
 };
 #else
 template<>
@@ -551,7 +641,8 @@ struct IntrinsicTraitBase<float>
           subtraction    = BLAZE_SSE_MODE,
           multiplication = BLAZE_SSE_MODE,
           division       = BLAZE_SSE_MODE,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          masked         = 0 };
 };
 #endif
 /*! \endcond */
@@ -574,7 +665,22 @@ struct IntrinsicTraitBase<double>
           subtraction    = 1,
           multiplication = 1,
           division       = 1,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          masked         = 0 };
+};
+#elif BLAZE_AVX512F_MODE
+template<>
+struct IntrinsicTraitBase<double>
+{
+   typedef sse_double_t  Type;
+   enum { size           = ( 64UL / sizeof(double) ),
+          alignment      = AlignmentOf<double>::value,
+          addition       = 1,
+          subtraction    = 1,
+          multiplication = 1,
+          division       = 1,
+          absoluteValue  = 0,
+          masked         = 1 };
 };
 #elif BLAZE_AVX_MODE
 template<>
@@ -587,7 +693,8 @@ struct IntrinsicTraitBase<double>
           subtraction    = 1,
           multiplication = 1,
           division       = 1,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          masked         = 1 };
 };
 #else
 template<>
@@ -600,7 +707,8 @@ struct IntrinsicTraitBase<double>
           subtraction    = BLAZE_SSE2_MODE,
           multiplication = BLAZE_SSE2_MODE,
           division       = BLAZE_SSE2_MODE,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          masked         = 0 };
 };
 #endif
 /*! \endcond */
@@ -623,7 +731,24 @@ struct IntrinsicTraitBase< complex<float> >
           subtraction    = 1,
           multiplication = 0,
           division       = 0,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          masked         = 0 };
+
+   BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
+};
+#elif BLAZE_AVX512F_MODE
+template<>
+struct IntrinsicTraitBase< complex<float> >
+{
+   typedef sse_cfloat_t  Type;
+   enum { size           = ( 64UL / sizeof(complex<float>) ),
+          alignment      = AlignmentOf< complex<float> >::value,
+          addition       = 1,
+          subtraction    = 1,
+          multiplication = 1,
+          division       = 0,
+          absoluteValue  = 0,
+          masked         = 1 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
 };
@@ -638,7 +763,8 @@ struct IntrinsicTraitBase< complex<float> >
           subtraction    = 1,
           multiplication = 1,
           division       = 0,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          masked         = 1 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
 };
@@ -653,7 +779,8 @@ struct IntrinsicTraitBase< complex<float> >
           subtraction    = BLAZE_SSE_MODE,
           multiplication = BLAZE_SSE3_MODE,
           division       = 0,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          masked         = 0 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
 };
@@ -678,7 +805,24 @@ struct IntrinsicTraitBase< complex<double> >
           subtraction    = 1,
           multiplication = 0,
           division       = 0,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          masked         = 0 };
+
+   BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
+};
+#elif BLAZE_AVX512F_MODE
+template<>
+struct IntrinsicTraitBase< complex<double> >
+{
+   typedef sse_cdouble_t  Type;
+   enum { size           = ( 64UL / sizeof(complex<double>) ),
+          alignment      = AlignmentOf< complex<double> >::value,
+          addition       = 1,
+          subtraction    = 1,
+          multiplication = 1,
+          division       = 0,
+          absoluteValue  = 0,
+          masked         = 1 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
 };
@@ -693,7 +837,8 @@ struct IntrinsicTraitBase< complex<double> >
           subtraction    = 1,
           multiplication = 1,
           division       = 0,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          masked         = 1 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
 };
@@ -708,7 +853,8 @@ struct IntrinsicTraitBase< complex<double> >
           subtraction    = BLAZE_SSE2_MODE,
           multiplication = BLAZE_SSE3_MODE,
           division       = 0,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          masked         = 0 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
 };
@@ -744,6 +890,9 @@ struct IntrinsicTraitBase< complex<double> >
 //    Else it is set to 0.
 //  - If the data type supports vectorized multiplications, the \a multiplication value is set to
 //    1. If it cannot be used in multiplications, it is set to 0.
+//  - In case partial intrinsic vectors of the data type can be loaded and stored via the masked
+//    maskload() and maskstore() functions, the \a masked value is set to 1. Otherwise it is
+//    set to 0.
 */
 template< typename T >
 class IntrinsicTrait : public IntrinsicTraitBase< typename RemoveCV<T>::Type >
@@ -75,7 +75,9 @@ template< typename T >  // Type of the integral value
 BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,2UL> >, sse_int16_t >::Type
    loadu( const T* address )
 {
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   return _mm512_loadu_si512( address );
+#elif BLAZE_AVX2_MODE
    return _mm256_loadu_si256( reinterpret_cast<const __m256i*>( address ) );
 #elif BLAZE_SSE2_MODE
    return _mm_loadu_si128( reinterpret_cast<const __m128i*>( address ) );
@@ -105,6 +107,8 @@ BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,4UL> >, sse
    v1 = _mm512_loadunpacklo_epi32( v1, address );
    v1 = _mm512_loadunpackhi_epi32( v1, address+16UL );
    return v1;
+#elif BLAZE_AVX512F_MODE
+   return _mm512_loadu_si512( address );
 #elif BLAZE_AVX2_MODE
    return _mm256_loadu_si256( reinterpret_cast<const __m256i*>( address ) );
 #elif BLAZE_SSE2_MODE
@@ -135,6 +139,8 @@ BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,8UL> >, sse
    v1 = _mm512_loadunpacklo_epi64( v1, address );
    v1 = _mm512_loadunpackhi_epi64( v1, address+8UL );
    return v1;
+#elif BLAZE_AVX512F_MODE
+   return _mm512_loadu_si512( address );
 #elif BLAZE_AVX2_MODE
    return _mm256_loadu_si256( reinterpret_cast<const __m256i*>( address ) );
 #elif BLAZE_SSE2_MODE
@@ -163,6 +169,8 @@ BLAZE_ALWAYS_INLINE sse_float_t loadu( const float* address )
    v1 = _mm512_loadunpacklo_ps( v1, address );
    v1 = _mm512_loadunpackhi_ps( v1, address+16UL );
    return v1;
+#elif BLAZE_AVX512F_MODE
+   return _mm512_loadu_ps( address );
 #elif BLAZE_AVX_MODE
    return _mm256_loadu_ps( address );
 #elif BLAZE_SSE_MODE
@@ -191,6 +199,8 @@ BLAZE_ALWAYS_INLINE sse_double_t loadu( const double* address )
    v1 = _mm512_loadunpacklo_pd( v1, address );
    v1 = _mm512_loadunpackhi_pd( v1, address+8UL );
    return v1;
+#elif BLAZE_AVX512F_MODE
+   return _mm512_loadu_pd( address );
 #elif BLAZE_AVX_MODE
    return _mm256_loadu_pd( address );
 #elif BLAZE_SSE2_MODE
@@ -221,6 +231,8 @@ BLAZE_ALWAYS_INLINE sse_cfloat_t loadu( const complex<float>* address )
    v1 = _mm512_loadunpacklo_ps( v1, reinterpret_cast<const float*>( address     ) );
    v1 = _mm512_loadunpackhi_ps( v1, reinterpret_cast<const float*>( address+8UL ) );
    return v1;
+#elif BLAZE_AVX512F_MODE
+   return _mm512_loadu_ps( reinterpret_cast<const float*>( address ) );
 #elif BLAZE_AVX_MODE
    return _mm256_loadu_ps( reinterpret_cast<const float*>( address ) );
 #elif BLAZE_SSE_MODE
@@ -251,6 +263,8 @@ BLAZE_ALWAYS_INLINE sse_cdouble_t loadu( const complex<double>* address )
    v1 = _mm512_loadunpacklo_pd( v1, reinterpret_cast<const double*>( address     ) );
    v1 = _mm512_loadunpackhi_pd( v1, reinterpret_cast<const double*>( address+4UL ) );
    return v1;
+#elif BLAZE_AVX512F_MODE
+   return _mm512_loadu_pd( reinterpret_cast<const double*>( address ) );
 #elif BLAZE_AVX_MODE
    return _mm256_loadu_pd( reinterpret_cast<const double*>( address ) );
 #elif BLAZE_SSE2_MODE
@@ -0,0 +1,159 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Mask.h
+//  \brief Header file for the intrinsic mask functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_INTRINSICS_MASK_H_
+#define _BLAZE_MATH_INTRINSICS_MASK_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC MASK FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates an AVX-512 mask selecting the first \a n of 8 vector elements.
+// \ingroup intrinsics
+//
+// \param n The number of selected elements \f$[0..8]\f$.
+// \return The resulting mask.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE __mmask8 mask8( size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( n <= 8UL, "Invalid number of mask elements" );
+   return static_cast<__mmask8>( ( 1U << n ) - 1U );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates an AVX-512 mask selecting the first \a n of 16 vector elements.
+// \ingroup intrinsics
+//
+// \param n The number of selected elements \f$[0..16]\f$.
+// \return The resulting mask.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE __mmask16 mask16( size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( n <= 16UL, "Invalid number of mask elements" );
+   return static_cast<__mmask16>( ( 1U << n ) - 1U );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates an AVX-512 mask selecting the first \a n of 32 vector elements.
+// \ingroup intrinsics
+//
+// \param n The number of selected elements \f$[0..32]\f$.
+// \return The resulting mask.
+*/
+#if BLAZE_AVX512BW_MODE
+BLAZE_ALWAYS_INLINE __mmask32 mask32( size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( n <= 32UL, "Invalid number of mask elements" );
+   return static_cast<__mmask32>( ( 1ULL << n ) - 1ULL );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates an AVX mask selecting the first \a n of 8 32-bit vector elements.
+// \ingroup intrinsics
+//
+// \param n The number of selected elements \f$[0..8]\f$.
+// \return The resulting mask.
+//
+// The mask is taken from a sliding window over a constant table, which avoids any dependency
+// on AVX2 integer instructions.
+*/
+#if BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE __m256i maskEpi32( size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( n <= 8UL, "Invalid number of mask elements" );
+   static const int32_t table[16] = { -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0 };
+   return _mm256_loadu_si256( reinterpret_cast<const __m256i*>( table + 8UL - n ) );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates an AVX mask selecting the first \a n of 4 64-bit vector elements.
+// \ingroup intrinsics
+//
+// \param n The number of selected elements \f$[0..4]\f$.
+// \return The resulting mask.
+*/
+#if BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE __m256i maskEpi64( size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( n <= 4UL, "Invalid number of mask elements" );
+   static const int64_t table[8] = { -1, -1, -1, -1, 0, 0, 0, 0 };
+   return _mm256_loadu_si256( reinterpret_cast<const __m256i*>( table + 4UL - n ) );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
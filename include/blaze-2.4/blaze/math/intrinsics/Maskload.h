@@ -0,0 +1,252 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Maskload.h
+//  \brief Header file for the intrinsic masked load functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_INTRINSICS_MASKLOAD_H_
+#define _BLAZE_MATH_INTRINSICS_MASKLOAD_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/math/intrinsics/Mask.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/HasSize.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC MASKLOAD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Masked load of a vector of 2-byte integral values.
+// \ingroup intrinsics
+//
+// \param address The first integral value to be loaded.
+// \param n The number of values to be loaded (at most the size of the intrinsic vector).
+// \return The loaded vector of integral values.
+//
+// This function loads the first \a n values of a vector of 2-byte integral values and sets
+// all remaining elements to zero. The memory beyond the first \a n values is not accessed, and
+// the given address is not required to be properly aligned.
+*/
+#if BLAZE_AVX512BW_MODE
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,2UL> >, sse_int16_t >::Type
+   maskload( const T* address, size_t n )
+{
+   return _mm512_maskz_loadu_epi16( mask32( n ), address );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked load of a vector of 4-byte integral values.
+// \ingroup intrinsics
+//
+// \param address The first integral value to be loaded.
+// \param n The number of values to be loaded (at most the size of the intrinsic vector).
+// \return The loaded vector of integral values.
+//
+// This function loads the first \a n values of a vector of 4-byte integral values and sets
+// all remaining elements to zero. The memory beyond the first \a n values is not accessed, and
+// the given address is not required to be properly aligned.
+*/
+#if BLAZE_AVX512F_MODE
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,4UL> >, sse_int32_t >::Type
+   maskload( const T* address, size_t n )
+{
+   return _mm512_maskz_loadu_epi32( mask16( n ), address );
+}
+#elif BLAZE_AVX2_MODE
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,4UL> >, sse_int32_t >::Type
+   maskload( const T* address, size_t n )
+{
+   return _mm256_maskload_epi32( reinterpret_cast<const int*>( address ), maskEpi32( n ) );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked load of a vector of 8-byte integral values.
+// \ingroup intrinsics
+//
+// \param address The first integral value to be loaded.
+// \param n The number of values to be loaded (at most the size of the intrinsic vector).
+// \return The loaded vector of integral values.
+//
+// This function loads the first \a n values of a vector of 8-byte integral values and sets
+// all remaining elements to zero. The memory beyond the first \a n values is not accessed, and
+// the given address is not required to be properly aligned.
+*/
+#if BLAZE_AVX512F_MODE
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,8UL> >, sse_int64_t >::Type
+   maskload( const T* address, size_t n )
+{
+   return _mm512_maskz_loadu_epi64( mask8( n ), address );
+}
+#elif BLAZE_AVX2_MODE
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,8UL> >, sse_int64_t >::Type
+   maskload( const T* address, size_t n )
+{
+   return _mm256_maskload_epi64( reinterpret_cast<const long long*>( address ), maskEpi64( n ) );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked load of a vector of 'float' values.
+// \ingroup intrinsics
+//
+// \param address The first 'float' value to be loaded.
+// \param n The number of values to be loaded (at most the size of the intrinsic vector).
+// \return The loaded vector of 'float' values.
+//
+// This function loads the first \a n values of a vector of 'float' values and sets all
+// remaining elements to zero. The memory beyond the first \a n values is not accessed, and
+// the given address is not required to be properly aligned.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_float_t maskload( const float* address, size_t n )
+{
+   return _mm512_maskz_loadu_ps( mask16( n ), address );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_float_t maskload( const float* address, size_t n )
+{
+   return _mm256_maskload_ps( address, maskEpi32( n ) );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked load of a vector of 'double' values.
+// \ingroup intrinsics
+//
+// \param address The first 'double' value to be loaded.
+// \param n The number of values to be loaded (at most the size of the intrinsic vector).
+// \return The loaded vector of 'double' values.
+//
+// This function loads the first \a n values of a vector of 'double' values and sets all
+// remaining elements to zero. The memory beyond the first \a n values is not accessed, and
+// the given address is not required to be properly aligned.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_double_t maskload( const double* address, size_t n )
+{
+   return _mm512_maskz_loadu_pd( mask8( n ), address );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_double_t maskload( const double* address, size_t n )
+{
+   return _mm256_maskload_pd( address, maskEpi64( n ) );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked load of a vector of 'complex<float>' values.
+// \ingroup intrinsics
+//
+// \param address The first 'complex<float>' value to be loaded.
+// \param n The number of values to be loaded \f$[0..{IntrinsicTrait<complex<float>>::size}]\f$.
+// \return The loaded vector of 'complex<float>' values.
+//
+// This function loads the first \a n values of a vector of 'complex<float>' values and sets all
+// remaining elements to zero. The memory beyond the first \a n values is not accessed, and
+// the given address is not required to be properly aligned.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_cfloat_t maskload( const complex<float>* address, size_t n )
+{
+   return _mm512_maskz_loadu_ps( mask16( 2UL*n ), reinterpret_cast<const float*>( address ) );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_cfloat_t maskload( const complex<float>* address, size_t n )
+{
+   return _mm256_maskload_ps( reinterpret_cast<const float*>( address ), maskEpi32( 2UL*n ) );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked load of a vector of 'complex<double>' values.
+// \ingroup intrinsics
+//
+// \param address The first 'complex<double>' value to be loaded.
+// \param n The number of values to be loaded \f$[0..{IntrinsicTrait<complex<double>>::size}]\f$.
+// \return The loaded vector of 'complex<double>' values.
+//
+// This function loads the first \a n values of a vector of 'complex<double>' values and sets all
+// remaining elements to zero. The memory beyond the first \a n values is not accessed, and
+// the given address is not required to be properly aligned.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE sse_cdouble_t maskload( const complex<double>* address, size_t n )
+{
+   return _mm512_maskz_loadu_pd( mask8( 2UL*n ), reinterpret_cast<const double*>( address ) );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_cdouble_t maskload( const complex<double>* address, size_t n )
+{
+   return _mm256_maskload_pd( reinterpret_cast<const double*>( address ), maskEpi64( 2UL*n ) );
+}
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,259 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Maskstore.h
+//  \brief Header file for the intrinsic masked store functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_INTRINSICS_MASKSTORE_H_
+#define _BLAZE_MATH_INTRINSICS_MASKSTORE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/math/intrinsics/Mask.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/HasSize.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC MASKSTORE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Masked store of a vector of 2-byte integral values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param value The 2-byte integral vector to be stored.
+// \param n The number of values to be stored (at most the size of the intrinsic vector).
+// \return void
+//
+// This function stores the first \a n values of a vector of 2-byte integral values. The
+// memory beyond the first \a n values is not accessed, and the given address is not required
+// to be properly aligned.
+*/
+#if BLAZE_AVX512BW_MODE
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,2UL> > >::Type
+   maskstore( T* address, const sse_int16_t& value, size_t n )
+{
+   _mm512_mask_storeu_epi16( address, mask32( n ), value.value );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked store of a vector of 4-byte integral values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param value The 4-byte integral vector to be stored.
+// \param n The number of values to be stored (at most the size of the intrinsic vector).
+// \return void
+//
+// This function stores the first \a n values of a vector of 4-byte integral values. The
+// memory beyond the first \a n values is not accessed, and the given address is not required
+// to be properly aligned.
+*/
+#if BLAZE_AVX512F_MODE
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,4UL> > >::Type
+   maskstore( T* address, const sse_int32_t& value, size_t n )
+{
+   _mm512_mask_storeu_epi32( address, mask16( n ), value.value );
+}
+#elif BLAZE_AVX2_MODE
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,4UL> > >::Type
+   maskstore( T* address, const sse_int32_t& value, size_t n )
+{
+   _mm256_maskstore_epi32( reinterpret_cast<int*>( address ), maskEpi32( n ), value.value );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked store of a vector of 8-byte integral values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param value The 8-byte integral vector to be stored.
+// \param n The number of values to be stored (at most the size of the intrinsic vector).
+// \return void
+//
+// This function stores the first \a n values of a vector of 8-byte integral values. The
+// memory beyond the first \a n values is not accessed, and the given address is not required
+// to be properly aligned.
+*/
+#if BLAZE_AVX512F_MODE
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,8UL> > >::Type
+   maskstore( T* address, const sse_int64_t& value, size_t n )
+{
+   _mm512_mask_storeu_epi64( address, mask8( n ), value.value );
+}
+#elif BLAZE_AVX2_MODE
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,8UL> > >::Type
+   maskstore( T* address, const sse_int64_t& value, size_t n )
+{
+   _mm256_maskstore_epi64( reinterpret_cast<long long*>( address ), maskEpi64( n ), value.value );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked store of a vector of 'float' values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param value The 'float' vector to be stored.
+// \param n The number of values to be stored (at most the size of the intrinsic vector).
+// \return void
+//
+// This function stores the first \a n values of a vector of 'float' values. The memory
+// beyond the first \a n values is not accessed, and the given address is not required to be
+// properly aligned.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE void maskstore( float* address, const sse_float_t& value, size_t n )
+{
+   _mm512_mask_storeu_ps( address, mask16( n ), value.value );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE void maskstore( float* address, const sse_float_t& value, size_t n )
+{
+   _mm256_maskstore_ps( address, maskEpi32( n ), value.value );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked store of a vector of 'double' values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param value The 'double' vector to be stored.
+// \param n The number of values to be stored (at most the size of the intrinsic vector).
+// \return void
+//
+// This function stores the first \a n values of a vector of 'double' values. The memory
+// beyond the first \a n values is not accessed, and the given address is not required to be
+// properly aligned.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE void maskstore( double* address, const sse_double_t& value, size_t n )
+{
+   _mm512_mask_storeu_pd( address, mask8( n ), value.value );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE void maskstore( double* address, const sse_double_t& value, size_t n )
+{
+   _mm256_maskstore_pd( address, maskEpi64( n ), value.value );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked store of a vector of 'complex<float>' values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param value The 'complex<float>' vector to be stored.
+// \param n The number of values to be stored \f$[0..{IntrinsicTrait<complex<float>>::size}]\f$.
+// \return void
+//
+// This function stores the first \a n values of a vector of 'complex<float>' values. The memory
+// beyond the first \a n values is not accessed, and the given address is not required to be
+// properly aligned.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE void maskstore( complex<float>* address, const sse_cfloat_t& value, size_t n )
+{
+   _mm512_mask_storeu_ps( reinterpret_cast<float*>( address ), mask16( 2UL*n ), value.value );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE void maskstore( complex<float>* address, const sse_cfloat_t& value, size_t n )
+{
+   _mm256_maskstore_ps( reinterpret_cast<float*>( address ), maskEpi32( 2UL*n ), value.value );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked store of a vector of 'complex<double>' values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param value The 'complex<double>' vector to be stored.
+// \param n The number of values to be stored \f$[0..{IntrinsicTrait<complex<double>>::size}]\f$.
+// \return void
+//
+// This function stores the first \a n values of a vector of 'complex<double>' values. The memory
+// beyond the first \a n values is not accessed, and the given address is not required to be
+// properly aligned.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE void maskstore( complex<double>* address, const sse_cdouble_t& value, size_t n )
+{
+   _mm512_mask_storeu_pd( reinterpret_cast<double*>( address ), mask8( 2UL*n ), value.value );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE void maskstore( complex<double>* address, const sse_cdouble_t& value, size_t n )
+{
+   _mm256_maskstore_pd( reinterpret_cast<double*>( address ), maskEpi64( 2UL*n ), value.value );
+}
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
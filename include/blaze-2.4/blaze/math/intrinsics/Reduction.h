@@ -62,7 +62,18 @@ namespace blaze {
 */
 BLAZE_ALWAYS_INLINE int16_t sum( const sse_int16_t& a )
 {
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   // The zero-masking forms are used since the unmasked ones trigger spurious
+   // 'maybe-uninitialized' warnings in GCC
+   const __m256i b = _mm256_add_epi16( _mm512_maskz_extracti64x4_epi64( 0xF, a.value, 1 )
+                                     , _mm512_maskz_extracti64x4_epi64( 0xF, a.value, 0 ) );
+   const __m256i c = _mm256_hadd_epi16( b, b );
+   const __m256i d = _mm256_hadd_epi16( c, c );
+   const __m256i e = _mm256_hadd_epi16( d, d );
+   const __m128i f = _mm_add_epi16( _mm256_extracti128_si256( e, 1 )
+                                  , _mm256_castsi256_si128( e ) );
+   return _mm_extract_epi16( f, 0 );
+#elif BLAZE_AVX2_MODE
    const sse_int16_t b( _mm256_hadd_epi16( a.value, a.value ) );
    const sse_int16_t c( _mm256_hadd_epi16( b.value, b.value ) );
    const sse_int16_t d( _mm256_hadd_epi16( c.value, c.value ) );
@@ -94,6 +105,14 @@ BLAZE_ALWAYS_INLINE int32_t sum( const sse_int32_t& a )
 {
 #if BLAZE_MIC_MODE
    return _mm512_reduce_add_epi32( a.value );
+#elif BLAZE_AVX512F_MODE
+   // The zero-masking forms are used since the unmasked ones trigger spurious
+   // 'maybe-uninitialized' warnings in GCC
+   const __m512i b = _mm512_add_epi32( a.value, _mm512_maskz_shuffle_i32x4( 0xFFFF, a.value, a.value, 0x4E ) );
+   const __m256i c = _mm512_maskz_extracti64x4_epi64( 0xF, b, 0 );
+   const __m256i d = _mm256_hadd_epi32( c, c );
+   const __m256i e = _mm256_hadd_epi32( d, d );
+   return _mm_cvtsi128_si32( _mm_add_epi32( _mm256_extracti128_si256( e, 1 ), _mm256_castsi256_si128( e ) ) );
 #elif BLAZE_AVX2_MODE
    const sse_int32_t b( _mm256_hadd_epi32( a.value, a.value ) );
    const sse_int32_t c( _mm256_hadd_epi32( b.value, b.value ) );
@@ -124,6 +143,13 @@ BLAZE_ALWAYS_INLINE int64_t sum( const sse_int64_t& a )
 {
 #if BLAZE_MIC_MODE
    return _mm512_reduce_add_epi64( a.value );
+#elif BLAZE_AVX512F_MODE
+   // The zero-masking forms are used since the unmasked ones trigger spurious
+   // 'maybe-uninitialized' warnings in GCC
+   const __m512i b = _mm512_add_epi64( a.value, _mm512_maskz_shuffle_i64x2( 0xFF, a.value, a.value, 0x4E ) );
+   const __m256i c = _mm512_maskz_extracti64x4_epi64( 0xF, b, 0 );
+   const __m256i d = _mm256_add_epi64( c, _mm256_permute4x64_epi64( c, 0x4E ) );
+   return _mm_cvtsi128_si64( _mm_add_epi64( _mm256_castsi256_si128( d ), _mm_unpackhi_epi64( _mm256_castsi256_si128( d ), _mm256_castsi256_si128( d ) ) ) );
 #elif BLAZE_AVX2_MODE
    return a[0] + a[1] + a[2] + a[3];
 #elif BLAZE_SSE2_MODE
@@ -146,6 +172,14 @@ BLAZE_ALWAYS_INLINE float sum( const sse_float_t& a )
 {
 #if BLAZE_MIC_MODE
    return _mm512_reduce_add_ps( a.value );
+#elif BLAZE_AVX512F_MODE
+   // The zero-masking forms are used since the unmasked ones trigger spurious
+   // 'maybe-uninitialized' warnings in GCC
+   const __m512 b = _mm512_add_ps( a.value, _mm512_maskz_shuffle_f32x4( 0xFFFF, a.value, a.value, 0x4E ) );
+   const __m256 c = _mm256_castpd_ps( _mm512_maskz_extractf64x4_pd( 0xF, _mm512_castps_pd( b ), 0 ) );
+   const __m256 d = _mm256_hadd_ps( c, c );
+   const __m256 e = _mm256_hadd_ps( d, d );
+   return _mm_cvtss_f32( _mm_add_ps( _mm256_extractf128_ps( e, 1 ), _mm256_castps256_ps128( e ) ) );
 #elif BLAZE_AVX_MODE
    const sse_float_t b( _mm256_hadd_ps( a.value, a.value ) );
    const sse_float_t c( _mm256_hadd_ps( b.value, b.value ) );
@@ -176,6 +210,13 @@ BLAZE_ALWAYS_INLINE double sum( const sse_double_t& a )
 {
 #if BLAZE_MIC_MODE
    return _mm512_reduce_add_pd( a.value );
+#elif BLAZE_AVX512F_MODE
+   // The zero-masking forms are used since the unmasked ones trigger spurious
+   // 'maybe-uninitialized' warnings in GCC
+   const __m512d b = _mm512_add_pd( a.value, _mm512_maskz_shuffle_f64x2( 0xFF, a.value, a.value, 0x4E ) );
+   const __m256d c = _mm512_maskz_extractf64x4_pd( 0xF, b, 0 );
+   const __m256d d = _mm256_hadd_pd( c, c );
+   return _mm_cvtsd_f64( _mm_add_pd( _mm256_extractf128_pd( d, 1 ), _mm256_castpd256_pd128( d ) ) );
 #elif BLAZE_AVX_MODE
    const sse_double_t b( _mm256_hadd_pd( a.value, a.value ) );
    const __m128d c = _mm_add_pd( _mm256_extractf128_pd( b.value, 1 )
@@ -202,7 +243,7 @@ BLAZE_ALWAYS_INLINE double sum( const sse_double_t& a )
 */
 BLAZE_ALWAYS_INLINE complex<float> sum( const sse_cfloat_t& a )
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_MIC_MODE || BLAZE_AVX512F_MODE
    return complex<float>( a[0] + a[1] + a[2] + a[3] + a[4] + a[5] + a[6] + a[7] );
 #elif BLAZE_AVX_MODE
    return complex<float>( a[0] + a[1] + a[2] + a[3] );
@@ -224,7 +265,7 @@ BLAZE_ALWAYS_INLINE complex<float> sum( const sse_cfloat_t& a )
 */
 BLAZE_ALWAYS_INLINE complex<double> sum( const sse_cdouble_t& a )
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_MIC_MODE || BLAZE_AVX512F_MODE
    return complex<double>( a[0] + a[1] + a[2] + a[3] );
 #elif BLAZE_AVX_MODE
    return complex<double>( a[0] + a[1] );
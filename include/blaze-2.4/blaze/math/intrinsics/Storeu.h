@@ -76,7 +76,9 @@ template< typename T >  // Type of the integral value
 BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,2UL> > >::Type
    storeu( T* address, const sse_int16_t& value )
 {
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512BW_MODE
+   _mm512_storeu_si512( address, value.value );
+#elif BLAZE_AVX2_MODE
    _mm256_storeu_si256( reinterpret_cast<__m256i*>( address ), value.value );
 #elif BLAZE_SSE2_MODE
    _mm_storeu_si128( reinterpret_cast<__m128i*>( address ), value.value );
@@ -105,6 +107,8 @@ BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,4UL> > >::T
 #if BLAZE_MIC_MODE
    _mm512_packstorelo_epi32( address, value.value );
    _mm512_packstorehi_epi32( address+16UL, value.value );
+#elif BLAZE_AVX512F_MODE
+   _mm512_storeu_si512( address, value.value );
 #elif BLAZE_AVX2_MODE
    _mm256_storeu_si256( reinterpret_cast<__m256i*>( address ), value.value );
 #elif BLAZE_SSE2_MODE
@@ -134,6 +138,8 @@ BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,8UL> > >::T
 #if BLAZE_MIC_MODE
    _mm512_packstorelo_epi64( address, value.value );
    _mm512_packstorehi_epi64( address+8UL, value.value );
+#elif BLAZE_AVX512F_MODE
+   _mm512_storeu_si512( address, value.value );
 #elif BLAZE_AVX2_MODE
    _mm256_storeu_si256( reinterpret_cast<__m256i*>( address ), value.value );
 #elif BLAZE_SSE2_MODE
@@ -161,6 +167,8 @@ BLAZE_ALWAYS_INLINE void storeu( float* address, const sse_float_t& value )
 #if BLAZE_MIC_MODE
    _mm512_packstorelo_ps( address     , value.value );
    _mm512_packstorehi_ps( address+16UL, value.value );
+#elif BLAZE_AVX512F_MODE
+   _mm512_storeu_ps( address, value.value );
 #elif BLAZE_AVX_MODE
    _mm256_storeu_ps( address, value.value );
 #elif BLAZE_SSE_MODE
@@ -188,6 +196,8 @@ BLAZE_ALWAYS_INLINE void storeu( double* address, const sse_double_t& value )
 #if BLAZE_MIC_MODE
    _mm512_packstorelo_pd( address    , value.value );
    _mm512_packstorehi_pd( address+8UL, value.value );
+#elif BLAZE_AVX512F_MODE
+   _mm512_storeu_pd( address, value.value );
 #elif BLAZE_AVX_MODE
    _mm256_storeu_pd( address, value.value );
 #elif BLAZE_SSE2_MODE
@@ -217,6 +227,8 @@ BLAZE_ALWAYS_INLINE void storeu( complex<float>* address, const sse_cfloat_t& va
 #if BLAZE_MIC_MODE
    _mm512_packstorelo_ps( reinterpret_cast<float*>( address     ), value.value );
    _mm512_packstorehi_ps( reinterpret_cast<float*>( address+8UL ), value.value );
+#elif BLAZE_AVX512F_MODE
+   _mm512_storeu_ps( reinterpret_cast<float*>( address ), value.value );
 #elif BLAZE_AVX_MODE
    _mm256_storeu_ps( reinterpret_cast<float*>( address ), value.value );
 #elif BLAZE_SSE_MODE
@@ -246,6 +258,8 @@ BLAZE_ALWAYS_INLINE void storeu( complex<double>* address, const sse_cdouble_t&
 #if BLAZE_MIC_MODE
    _mm512_packstorelo_pd( reinterpret_cast<double*>( address     ), value.value );
    _mm512_packstorehi_pd( reinterpret_cast<double*>( address+4UL ), value.value );
+#elif BLAZE_AVX512F_MODE
+   _mm512_storeu_pd( reinterpret_cast<double*>( address ), value.value );
 #elif BLAZE_AVX_MODE
    _mm256_storeu_pd( reinterpret_cast<double*>( address ), value.value );
 #elif BLAZE_SSE2_MODE
@@ -40,7 +40,14 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/system/SMP.h>
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+#  include <omp.h>
+#endif
+
 #include <stdexcept>
+#include <blaze/system/ThreadLocal.h>
 #include <blaze/util/Suffix.h>
 
 
@@ -89,10 +96,11 @@ class ParallelSection
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static bool active_;  //!< Activity flag for the parallel section.
-                         /*!< In case a parallel section is active (i.e. the currently executed
-                              code is inside a parallel section), the flag is set to \a true,
-                              otherwise it is \a false. */
+   static BLAZE_THREAD_LOCAL bool active_;  //!< Activity flag for the parallel section.
+                                            /*!< In case a parallel section is active (i.e. the
+                                                 code currently executed by the calling thread
+                                                 is inside a parallel section), the flag is set
+                                                 to \a true, otherwise it is \a false. */
    //@}
    //**********************************************************************************************
 
@@ -116,7 +124,7 @@ class ParallelSection
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename T >
-bool ParallelSection<T>::active_ = false;
+BLAZE_THREAD_LOCAL bool ParallelSection<T>::active_ = false;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -208,10 +216,18 @@ inline bool isParallelSectionActive();
 // \ingroup smp
 //
 // \return \a true if a parallel section is active, \a false if not.
+//
+// The activity of a parallel section is tracked separately for every thread. In case of the
+// OpenMP parallelization, the threads of an active OpenMP parallel region are considered to
+// be inside a parallel section as well.
 */
 inline bool isParallelSectionActive()
 {
+#if BLAZE_OPENMP_PARALLEL_MODE
+   return ParallelSection<int>::active_ || omp_in_parallel();
+#else
    return ParallelSection<int>::active_;
+#endif
 }
 //*************************************************************************************************
 
@@ -0,0 +1,866 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/Partition.h
+//  \brief Header file for the work partitioning of the shared-memory parallelization
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_PARTITION_H_
+#define _BLAZE_MATH_SMP_PARTITION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <vector>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/intrinsics/IntrinsicTrait.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Decomposition of an index range into the work chunks of a parallel assignment.
+// \ingroup smp
+//
+// The SMPPartition class splits the index range \f$ [0..n) \f$ of the rows, columns or elements
+// of a parallel assignment into consecutive chunks. Instead of a single chunk per thread the
+// range is over-decomposed into \a blaze::smpChunksPerThread chunks per thread (see the
+// <tt>./blaze/config/SMP.h</tt> configuration file), which are claimed dynamically by the
+// threads. All chunk boundaries except the end of the range are multiples of the given
+// granularity, which allows to align the chunks to SIMD vectors and cache lines.
+//
+// By default all chunks have the same size. Alternatively, the cost of each index can be
+// specified via a cost functor, in which case the chunks are chosen such that they contain
+// approximately the same total cost:
+
+   \code
+   struct RowCost {
+      size_t operator()( size_t i ) const { return i+1UL; }  // Cost of the i-th row
+   };
+
+   const SMPPartition partition( 1000UL, 4UL, 16UL, RowCost() );
+
+   for( size_t k=0UL; k<partition.size(); ++k ) {
+      // Processing the indices [ partition.begin(k) .. partition.end(k) )
+   }
+   \endcode
+*/
+class SMPPartition
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SMPPartition( size_t n, size_t threads, size_t granularity );
+
+   template< typename Cost >
+   explicit inline SMPPartition( size_t n, size_t threads, size_t granularity, const Cost& cost );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size () const;
+   inline size_t begin( size_t k ) const;
+   inline size_t end  ( size_t k ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline size_t chunks( size_t blocks, size_t threads );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::vector<size_t> bounds_;  //!< The boundaries of the chunks.
+                                 /*!< The k-th chunk covers the index range
+                                      \f$ [bounds_[k]..bounds_[k+1]) \f$. */
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for a partition into chunks of equal size.
+//
+// \param n The size of the index range.
+// \param threads The number of threads executing the chunks.
+// \param granularity The granularity of the chunk boundaries.
+*/
+inline SMPPartition::SMPPartition( size_t n, size_t threads, size_t granularity )
+   : bounds_()  // The boundaries of the chunks
+{
+   BLAZE_INTERNAL_ASSERT( threads     > 0UL, "Invalid number of threads" );
+   BLAZE_INTERNAL_ASSERT( granularity > 0UL, "Invalid granularity"       );
+
+   const size_t blocks( ( n + granularity - 1UL ) / granularity );
+   const size_t count ( chunks( blocks, threads ) );
+
+   bounds_.reserve( count+1UL );
+   bounds_.push_back( 0UL );
+
+   for( size_t k=1UL; k<=count; ++k ) {
+      bounds_.push_back( min( n, ( ( k*blocks ) / count ) * granularity ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a partition into chunks of equal cost.
+//
+// \param n The size of the index range.
+// \param threads The number of threads executing the chunks.
+// \param granularity The granularity of the chunk boundaries.
+// \param cost The cost functor, returning the (positive) cost of a single index.
+//
+// The chunks are chosen such that each chunk contains approximately the same share of the
+// total cost. The cost of every index is evaluated exactly once.
+*/
+template< typename Cost >  // Type of the cost functor
+inline SMPPartition::SMPPartition( size_t n, size_t threads, size_t granularity, const Cost& cost )
+   : bounds_()  // The boundaries of the chunks
+{
+   BLAZE_INTERNAL_ASSERT( threads     > 0UL, "Invalid number of threads" );
+   BLAZE_INTERNAL_ASSERT( granularity > 0UL, "Invalid granularity"       );
+
+   const size_t blocks( ( n + granularity - 1UL ) / granularity );
+   const size_t count ( chunks( blocks, threads ) );
+
+   bounds_.reserve( count+1UL );
+   bounds_.push_back( 0UL );
+
+   if( count > 1UL )
+   {
+      std::vector<size_t> costs( blocks+1UL, 0UL );
+
+      for( size_t b=0UL; b<blocks; ++b ) {
+         const size_t iend( min( n, (b+1UL)*granularity ) );
+         size_t sum( 0UL );
+         for( size_t i=b*granularity; i<iend; ++i )
+            sum += cost( i );
+         costs[b+1UL] = costs[b] + sum;
+      }
+
+      for( size_t k=1UL; k<count; ++k )
+      {
+         const size_t target( ( costs[blocks] / count ) * k + ( ( costs[blocks] % count ) * k ) / count );
+         size_t b( std::lower_bound( costs.begin(), costs.end(), target ) - costs.begin() );
+
+         if( b > 0UL && target - costs[b-1UL] < costs[b] - target )
+            --b;
+
+         const size_t bound( min( n, b*granularity ) );
+
+         if( bound > bounds_.back() && bound < n )
+            bounds_.push_back( bound );
+      }
+   }
+
+   if( n > 0UL )
+      bounds_.push_back( n );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of chunks of the partition.
+//
+// \return The number of chunks.
+*/
+inline size_t SMPPartition::size() const
+{
+   return bounds_.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the first index of the given chunk.
+//
+// \param k The index of the chunk.
+// \return The first index of the chunk.
+*/
+inline size_t SMPPartition::begin( size_t k ) const
+{
+   BLAZE_USER_ASSERT( k < size(), "Invalid chunk access index" );
+   return bounds_[k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index one past the last index of the given chunk.
+//
+// \param k The index of the chunk.
+// \return The index one past the last index of the chunk.
+*/
+inline size_t SMPPartition::end( size_t k ) const
+{
+   BLAZE_USER_ASSERT( k < size(), "Invalid chunk access index" );
+   return bounds_[k+1UL];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the number of chunks for the given number of blocks and threads.
+//
+// \param blocks The number of blocks of the size of the granularity.
+// \param threads The number of threads executing the chunks.
+// \return The number of chunks.
+//
+// A single thread does not profit from the over-decomposition and therefore processes the
+// complete range as a single chunk.
+*/
+inline size_t SMPPartition::chunks( size_t blocks, size_t threads )
+{
+   if( threads == 1UL )
+      return min( blocks, 1UL );
+   else return min( blocks, threads*smpChunksPerThread );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COST FUNCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cost functor for the rows of a lower and the columns of an upper triangular matrix.
+// \ingroup smp
+*/
+struct SMPAscendingCost
+{
+   inline size_t operator()( size_t i ) const {
+      return i+1UL;
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cost functor for the rows of an upper and the columns of a lower triangular matrix.
+// \ingroup smp
+*/
+struct SMPDescendingCost
+{
+   explicit inline SMPDescendingCost( size_t n )
+      : n_( n )  // The number of rows/columns of the matrix
+   {}
+
+   inline size_t operator()( size_t i ) const {
+      return n_ - i;
+   }
+
+   size_t n_;  //!< The number of rows/columns of the matrix.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cost functor for the rows/columns of a sparse matrix.
+// \ingroup smp
+//
+// The cost of a row (for row-major matrices) or column (for column-major matrices) is given by
+// its number of non-zero elements plus a constant for the traversal of the row/column.
+*/
+template< typename MT >  // Type of the sparse matrix
+struct SMPNonZerosCost
+{
+   explicit inline SMPNonZerosCost( const MT& sm )
+      : sm_( sm )  // The sparse matrix
+   {}
+
+   inline size_t operator()( size_t i ) const {
+      return sm_.nonZeros( i ) + 1UL;
+   }
+
+   const MT& sm_;  //!< The sparse matrix.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cost functor for the rows/columns of a sparse matrix/sparse matrix multiplication.
+// \ingroup smp
+//
+// The cost of a row of the product \f$ A*B \f$ of two row-major matrices is given by the number
+// of multiplications required for its computation, i.e. the total number of non-zero elements
+// in the rows of \a B selected by the non-zero elements of the corresponding row of \a A. For
+// two column-major matrices, the cost of a column is determined analogously with the roles of
+// the operands swapped (\a X = \a B, \a Y = \a A).
+*/
+template< typename MT1    // Type of the selecting sparse matrix
+        , typename MT2 >  // Type of the selected sparse matrix
+struct SMPProductCost
+{
+   typedef typename MT1::ConstIterator  ConstIterator;  //!< Iterator over the elements of \a X.
+
+   explicit inline SMPProductCost( const MT1& X, const MT2& Y )
+      : X_( X )  // The selecting sparse matrix
+      , Y_( Y )  // The selected sparse matrix
+   {}
+
+   inline size_t operator()( size_t i ) const {
+      size_t cost( 1UL );
+      for( ConstIterator element=X_.begin(i); element!=X_.end(i); ++element )
+         cost += Y_.nonZeros( element->index() );
+      return cost;
+   }
+
+   const MT1& X_;  //!< The selecting sparse matrix.
+   const MT2& Y_;  //!< The selected sparse matrix.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PARTITIONING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the granularity of the chunk boundaries of a dense target.
+// \ingroup smp
+//
+// \param vectorizable \a true in case the assignment is vectorized, \a false if not.
+// \param contiguous \a true in case consecutive indices are adjacent in memory, \a false if not.
+// \return The granularity of the chunk boundaries.
+//
+// The boundaries of vectorized assignments are aligned to the size of a SIMD vector, the
+// boundaries between elements that are adjacent in memory are in addition aligned to cache
+// lines, such that no two chunks write to the same cache line.
+*/
+template< typename Type >  // Element type of the target
+inline size_t smpGranularity( bool vectorizable, bool contiguous )
+{
+   const size_t simd( vectorizable ? static_cast<size_t>( IntrinsicTrait<Type>::size ) : 1UL );
+   const size_t line( contiguous ? max( cacheLineSize / sizeof( Type ), 1UL ) : 1UL );
+
+   return max( simd, line );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitioning of the rows/columns of a lower or upper triangular matrix.
+// \ingroup smp
+//
+// \param n The number of rows/columns.
+// \param threads The number of threads executing the chunks.
+// \param granularity The granularity of the chunk boundaries.
+// \param ascending \a true in case the cost increases with the index.
+// \param descending \a true in case the cost decreases with the index.
+// \return The partition of the rows/columns.
+*/
+inline SMPPartition smpTrianglePartition( size_t n, size_t threads, size_t granularity,
+                                          bool ascending, bool descending )
+{
+   if( ascending && !descending )
+      return SMPPartition( n, threads, granularity, SMPAscendingCost() );
+   else if( descending && !ascending )
+      return SMPPartition( n, threads, granularity, SMPDescendingCost( n ) );
+   else
+      return SMPPartition( n, threads, granularity );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitioning of the rows/columns of the product of two sparse matrices.
+// \ingroup smp
+//
+// \param n The number of rows/columns of the product.
+// \param X The sparse matrix operand whose rows/columns select the rows/columns of \a Y.
+// \param Y The sparse matrix operand whose rows/columns are selected.
+// \param threads The number of threads executing the chunks.
+// \param granularity The granularity of the chunk boundaries.
+// \return The partition of the rows/columns.
+*/
+template< typename MT1    // Type of the selecting sparse matrix
+        , typename MT2 >  // Type of the selected sparse matrix
+inline SMPPartition smpProductPartition( size_t n, const MT1& X, const MT2& Y, size_t threads, size_t granularity )
+{
+   return SMPPartition( n, threads, granularity, SMPProductCost<MT1,MT2>( X, Y ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitioning of the rows of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix.
+// \param threads The number of threads executing the chunks.
+// \param granularity The granularity of the chunk boundaries.
+// \return The partition of the rows.
+//
+// The rows of lower and upper triangular matrices are weighted by their number of elements
+// in the triangle, all other matrices are split into chunks of equal size.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline SMPPartition smpRowPartition( const DenseMatrix<MT,SO>& dm, size_t threads, size_t granularity )
+{
+   return smpTrianglePartition( (~dm).rows(), threads, granularity,
+                                IsLower<MT>::value, IsUpper<MT>::value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitioning of the columns of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix.
+// \param threads The number of threads executing the chunks.
+// \param granularity The granularity of the chunk boundaries.
+// \return The partition of the columns.
+//
+// The columns of lower and upper triangular matrices are weighted by their number of elements
+// in the triangle, all other matrices are split into chunks of equal size.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline SMPPartition smpColumnPartition( const DenseMatrix<MT,SO>& dm, size_t threads, size_t granularity )
+{
+   return smpTrianglePartition( (~dm).columns(), threads, granularity,
+                                IsUpper<MT>::value, IsLower<MT>::value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitioning of the rows of a row-major sparse matrix.
+// \ingroup smp
+//
+// \param sm The row-major sparse matrix.
+// \param threads The number of threads executing the chunks.
+// \param granularity The granularity of the chunk boundaries.
+// \return The partition of the rows.
+//
+// The rows are weighted by their number of non-zero elements.
+*/
+template< typename MT >  // Type of the sparse matrix
+inline SMPPartition smpRowPartition( const SparseMatrix<MT,rowMajor>& sm, size_t threads, size_t granularity )
+{
+   return SMPPartition( (~sm).rows(), threads, granularity, SMPNonZerosCost<MT>( ~sm ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitioning of the columns of a column-major sparse matrix.
+// \ingroup smp
+//
+// \param sm The column-major sparse matrix.
+// \param threads The number of threads executing the chunks.
+// \param granularity The granularity of the chunk boundaries.
+// \return The partition of the columns.
+//
+// The columns are weighted by their number of non-zero elements.
+*/
+template< typename MT >  // Type of the sparse matrix
+inline SMPPartition smpColumnPartition( const SparseMatrix<MT,columnMajor>& sm, size_t threads, size_t granularity )
+{
+   return SMPPartition( (~sm).columns(), threads, granularity, SMPNonZerosCost<MT>( ~sm ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitioning of the rows of a sparse matrix/sparse matrix multiplication.
+// \ingroup smp
+//
+// \param sm The sparse matrix/sparse matrix multiplication.
+// \param threads The number of threads executing the chunks.
+// \param granularity The granularity of the chunk boundaries.
+// \return The partition of the rows.
+//
+// The rows are weighted by the number of multiplications required for their computation.
+*/
+template< typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+inline SMPPartition smpRowPartition( const SMatSMatMultExpr<MT1,MT2>& sm, size_t threads, size_t granularity )
+{
+   return smpProductPartition( sm.rows(), sm.leftOperand(), sm.rightOperand(), threads, granularity );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitioning of the columns of a transpose sparse matrix/transpose sparse matrix
+//        multiplication.
+// \ingroup smp
+//
+// \param sm The transpose sparse matrix/transpose sparse matrix multiplication.
+// \param threads The number of threads executing the chunks.
+// \param granularity The granularity of the chunk boundaries.
+// \return The partition of the columns.
+//
+// The columns are weighted by the number of multiplications required for their computation.
+*/
+template< typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+inline SMPPartition smpColumnPartition( const TSMatTSMatMultExpr<MT1,MT2>& sm, size_t threads, size_t granularity )
+{
+   return smpProductPartition( sm.columns(), sm.rightOperand(), sm.leftOperand(), threads, granularity );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitioning of the rows of a row-major sparse matrix.
+// \ingroup smp
+//
+// \param sm The row-major sparse matrix.
+// \param threads The number of threads executing the chunks.
+// \param granularity The granularity of the chunk boundaries.
+// \return The partition of the rows.
+//
+// This function partitions a row-major sparse matrix along its storage order, i.e. the rows are
+// weighted by the cost used by the smpRowPartition() function.
+*/
+template< typename MT >  // Type of the sparse matrix
+inline SMPPartition smpPartition( const SparseMatrix<MT,rowMajor>& sm, size_t threads, size_t granularity )
+{
+   return smpRowPartition( ~sm, threads, granularity );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitioning of the columns of a column-major sparse matrix.
+// \ingroup smp
+//
+// \param sm The column-major sparse matrix.
+// \param threads The number of threads executing the chunks.
+// \param granularity The granularity of the chunk boundaries.
+// \return The partition of the columns.
+//
+// This function partitions a column-major sparse matrix along its storage order, i.e. the
+// columns are weighted by the cost used by the smpColumnPartition() function.
+*/
+template< typename MT >  // Type of the sparse matrix
+inline SMPPartition smpPartition( const SparseMatrix<MT,columnMajor>& sm, size_t threads, size_t granularity )
+{
+   return smpColumnPartition( ~sm, threads, granularity );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitioning of the elements of a vector.
+// \ingroup smp
+//
+// \param v The vector.
+// \param threads The number of threads executing the chunks.
+// \param granularity The granularity of the chunk boundaries.
+// \return The partition of the elements.
+//
+// The elements are split into chunks of equal size.
+*/
+template< typename VT  // Type of the vector
+        , bool TF >    // Transpose flag of the vector
+inline SMPPartition smpPartition( const Vector<VT,TF>& v, size_t threads, size_t granularity )
+{
+   return SMPPartition( (~v).size(), threads, granularity );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitioning of the elements of a row-major dense matrix/dense vector multiplication.
+// \ingroup smp
+//
+// \param v The dense matrix/dense vector multiplication.
+// \param threads The number of threads executing the chunks.
+// \param granularity The granularity of the chunk boundaries.
+// \return The partition of the elements.
+//
+// In case the matrix is lower or upper triangular, the elements are weighted by the number of
+// elements of the corresponding matrix row.
+*/
+template< typename MT    // Type of the left-hand side dense matrix
+        , typename VT >  // Type of the right-hand side dense vector
+inline SMPPartition smpPartition( const DMatDVecMultExpr<MT,VT>& v, size_t threads, size_t granularity )
+{
+   return smpTrianglePartition( v.size(), threads, granularity, IsLower<MT>::value, IsUpper<MT>::value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitioning of the elements of a column-major dense matrix/dense vector multiplication.
+// \ingroup smp
+//
+// \param v The dense matrix/dense vector multiplication.
+// \param threads The number of threads executing the chunks.
+// \param granularity The granularity of the chunk boundaries.
+// \return The partition of the elements.
+//
+// In case the matrix is lower or upper triangular, the elements are weighted by the number of
+// elements of the corresponding matrix row.
+*/
+template< typename MT    // Type of the left-hand side dense matrix
+        , typename VT >  // Type of the right-hand side dense vector
+inline SMPPartition smpPartition( const TDMatDVecMultExpr<MT,VT>& v, size_t threads, size_t granularity )
+{
+   return smpTrianglePartition( v.size(), threads, granularity, IsLower<MT>::value, IsUpper<MT>::value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitioning of the elements of a transpose dense vector/row-major dense matrix
+//        multiplication.
+// \ingroup smp
+//
+// \param v The transpose dense vector/dense matrix multiplication.
+// \param threads The number of threads executing the chunks.
+// \param granularity The granularity of the chunk boundaries.
+// \return The partition of the elements.
+//
+// In case the matrix is lower or upper triangular, the elements are weighted by the number of
+// elements of the corresponding matrix column.
+*/
+template< typename VT    // Type of the left-hand side dense vector
+        , typename MT >  // Type of the right-hand side dense matrix
+inline SMPPartition smpPartition( const TDVecDMatMultExpr<VT,MT>& v, size_t threads, size_t granularity )
+{
+   return smpTrianglePartition( v.size(), threads, granularity, IsUpper<MT>::value, IsLower<MT>::value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitioning of the elements of a transpose dense vector/column-major dense matrix
+//        multiplication.
+// \ingroup smp
+//
+// \param v The transpose dense vector/dense matrix multiplication.
+// \param threads The number of threads executing the chunks.
+// \param granularity The granularity of the chunk boundaries.
+// \return The partition of the elements.
+//
+// In case the matrix is lower or upper triangular, the elements are weighted by the number of
+// elements of the corresponding matrix column.
+*/
+template< typename VT    // Type of the left-hand side dense vector
+        , typename MT >  // Type of the right-hand side dense matrix
+inline SMPPartition smpPartition( const TDVecTDMatMultExpr<VT,MT>& v, size_t threads, size_t granularity )
+{
+   return smpTrianglePartition( v.size(), threads, granularity, IsUpper<MT>::value, IsLower<MT>::value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitioning of the elements of a row-major sparse matrix/dense vector multiplication.
+// \ingroup smp
+//
+// \param v The sparse matrix/dense vector multiplication.
+// \param threads The number of threads executing the chunks.
+// \param granularity The granularity of the chunk boundaries.
+// \return The partition of the elements.
+//
+// The elements are weighted by the number of non-zero elements of the corresponding matrix row.
+*/
+template< typename MT    // Type of the left-hand side sparse matrix
+        , typename VT >  // Type of the right-hand side dense vector
+inline SMPPartition smpPartition( const SMatDVecMultExpr<MT,VT>& v, size_t threads, size_t granularity )
+{
+   return SMPPartition( v.size(), threads, granularity, SMPNonZerosCost<MT>( v.leftOperand() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitioning of the elements of a sliced ELLPACK matrix/dense vector multiplication.
+// \ingroup smp
+//
+// \param v The sliced ELLPACK matrix/dense vector multiplication.
+// \param threads The number of threads executing the chunks.
+// \param granularity The granularity of the chunk boundaries.
+// \return The partition of the elements.
+//
+// Since the rows of a sliced ELLPACK matrix are only reordered within their sorting window, the
+// chunk boundaries are placed at multiples of both the given granularity and the sorting scope.
+// Thus every thread processes complete chunks of the matrix. The elements are weighted by the
+// number of non-zero elements of the corresponding matrix row.
+*/
+template< typename Type  // Data type of the sliced ELLPACK matrix
+        , size_t C       // Number of rows per chunk
+        , typename VT >  // Type of the right-hand side dense vector
+inline SMPPartition smpPartition( const SMatDVecMultExpr<SlicedEllpackMatrix<Type,C>,VT>& v,
+                                  size_t threads, size_t granularity )
+{
+   typedef SlicedEllpackMatrix<Type,C>  MT;
+
+   const size_t sigma( v.leftOperand().sigma() );
+
+   size_t a( granularity ), b( sigma );
+   while( b != 0UL ) {
+      const size_t r( a % b );
+      a = b;
+      b = r;
+   }
+
+   const size_t factor( granularity / a );
+   const size_t windows( ( sigma <= v.size() / factor )?( factor*sigma ):( max( v.size(), 1UL ) ) );
+
+   return SMPPartition( v.size(), threads, windows, SMPNonZerosCost<MT>( v.leftOperand() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitioning of the elements of a transpose dense vector/column-major sparse matrix
+//        multiplication.
+// \ingroup smp
+//
+// \param v The transpose dense vector/sparse matrix multiplication.
+// \param threads The number of threads executing the chunks.
+// \param granularity The granularity of the chunk boundaries.
+// \return The partition of the elements.
+//
+// The elements are weighted by the number of non-zero elements of the corresponding matrix
+// column.
+*/
+template< typename VT    // Type of the left-hand side dense vector
+        , typename MT >  // Type of the right-hand side sparse matrix
+inline SMPPartition smpPartition( const TDVecTSMatMultExpr<VT,MT>& v, size_t threads, size_t granularity )
+{
+   return SMPPartition( v.size(), threads, granularity, SMPNonZerosCost<MT>( v.rightOperand() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
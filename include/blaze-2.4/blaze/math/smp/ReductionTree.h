@@ -0,0 +1,319 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/ReductionTree.h
+//  \brief Header file for the deterministic block decomposition of reductions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_REDUCTIONTREE_H_
+#define _BLAZE_MATH_SMP_REDUCTIONTREE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/Functions.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Block decomposition and pairwise combination of the partial results of a reduction.
+// \ingroup smp
+//
+// The SMPReductionTree class splits the index range \f$ [0..n) \f$ of a reduction into blocks of
+// blaze::smpReductionBlockSize elements (see the <tt>./blaze/config/SMP.h</tt> configuration
+// file) and stores the partial result of every block. The partial results are combined by a
+// pairwise summation in a fixed order (see the result() function). Since neither the blocks nor
+// the order of the combination depend on the number of threads that compute the partial results,
+// the result of a reduction is deterministic. Additionally, the pairwise summation reduces the
+// accumulation of rounding errors in comparison to a sequential summation.
+*/
+template< typename T >  // Type of the partial results
+class SMPReductionTree
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline SMPReductionTree( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Access operators****************************************************************************
+   /*!\name Access operators */
+   //@{
+   inline T&       operator[]( size_t b );
+   inline const T& operator[]( size_t b ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t  blocks() const;
+   inline size_t  begin ( size_t b ) const;
+   inline size_t  end   ( size_t b ) const;
+   inline const T result() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   const T combine( size_t first, size_t last ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t         size_;      //!< The size of the index range.
+   std::vector<T> partials_;  //!< The partial results of the blocks.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SMPReductionTree class template.
+//
+// \param n The size of the index range \f$[1..\infty)\f$.
+*/
+template< typename T >  // Type of the partial results
+inline SMPReductionTree<T>::SMPReductionTree( size_t n )
+   : size_    ( n )                                                               // The size of the index range
+   , partials_( ( n + smpReductionBlockSize - 1UL ) / smpReductionBlockSize )  // The partial results of the blocks
+{
+   BLAZE_INTERNAL_ASSERT( n > 0UL, "Invalid size of the index range" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ACCESS OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access to the partial result of a block.
+//
+// \param b The index of the block.
+// \return Reference to the partial result of the block.
+*/
+template< typename T >  // Type of the partial results
+inline T& SMPReductionTree<T>::operator[]( size_t b )
+{
+   BLAZE_USER_ASSERT( b < blocks(), "Invalid block access index" );
+   return partials_[b];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to the partial result of a block.
+//
+// \param b The index of the block.
+// \return Reference to the partial result of the block.
+*/
+template< typename T >  // Type of the partial results
+inline const T& SMPReductionTree<T>::operator[]( size_t b ) const
+{
+   BLAZE_USER_ASSERT( b < blocks(), "Invalid block access index" );
+   return partials_[b];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of blocks.
+//
+// \return The number of blocks.
+*/
+template< typename T >  // Type of the partial results
+inline size_t SMPReductionTree<T>::blocks() const
+{
+   return partials_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the first index of the given block.
+//
+// \param b The index of the block.
+// \return The first index of the block.
+*/
+template< typename T >  // Type of the partial results
+inline size_t SMPReductionTree<T>::begin( size_t b ) const
+{
+   BLAZE_USER_ASSERT( b < blocks(), "Invalid block access index" );
+   return b * smpReductionBlockSize;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index one past the last index of the given block.
+//
+// \param b The index of the block.
+// \return The index one past the last index of the block.
+*/
+template< typename T >  // Type of the partial results
+inline size_t SMPReductionTree<T>::end( size_t b ) const
+{
+   BLAZE_USER_ASSERT( b < blocks(), "Invalid block access index" );
+   return min( size_, ( b+1UL ) * smpReductionBlockSize );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the combination of the partial results of all blocks.
+//
+// \return The result of the reduction.
+*/
+template< typename T >  // Type of the partial results
+inline const T SMPReductionTree<T>::result() const
+{
+   return combine( 0UL, blocks() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pairwise combination of the partial results of the given range of blocks.
+//
+// \param first The index of the first block.
+// \param last The index one past the last block.
+// \return The combined partial results.
+*/
+template< typename T >  // Type of the partial results
+const T SMPReductionTree<T>::combine( size_t first, size_t last ) const
+{
+   BLAZE_INTERNAL_ASSERT( first < last, "Invalid range of blocks" );
+
+   if( last - first == 1UL )
+      return partials_[first];
+
+   const size_t middle( first + ( last - first ) / 2UL );
+
+   return combine( first, middle ) + combine( middle, last );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial evaluation of a reduction.
+// \ingroup smp
+//
+// \param n The size of the index range \f$[1..\infty)\f$.
+// \param kernel The reduction kernel.
+// \return The result of the reduction.
+//
+// This function computes the reduction of the index range \f$ [0..n) \f$ by means of the given
+// kernel. The kernel must provide the nested type \a ResultType and a function call operator
+// that returns the partial result of a given non-empty index range \f$ [begin..end) \f$:
+
+   \code
+   ResultType operator()( size_t begin, size_t end ) const;
+   \endcode
+
+// The function evaluates the blocks of the reduction in serial and combines their partial
+// results in the same order as the parallel evaluation (see the smpReduce() functions).
+// Therefore the result is the same as in case of a parallel reduction.
+*/
+template< typename Kernel >  // Type of the reduction kernel
+inline const typename Kernel::ResultType reduce( size_t n, const Kernel& kernel )
+{
+   typedef typename Kernel::ResultType  RT;
+
+   BLAZE_INTERNAL_ASSERT( n > 0UL, "Invalid size of the index range" );
+
+   if( n <= smpReductionBlockSize )
+      return kernel( 0UL, n );
+
+   SMPReductionTree<RT> tree( n );
+
+   for( size_t b=0UL; b<tree.blocks(); ++b ) {
+      tree[b] = kernel( tree.begin( b ), tree.end( b ) );
+   }
+
+   return tree.result();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
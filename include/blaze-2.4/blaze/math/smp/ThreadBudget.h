@@ -0,0 +1,316 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/ThreadBudget.h
+//  \brief Header file for the ThreadBudget class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADBUDGET_H_
+#define _BLAZE_MATH_SMP_THREADBUDGET_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <boost/atomic.hpp>
+#include <blaze/system/ThreadLocal.h>
+#include <blaze/util/Suffix.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Section to restrict the number of threads used by parallel operations.
+// \ingroup smp
+//
+// The ThreadBudget class is an auxiliary helper class for the \a BLAZE_THREAD_BUDGET macro. It
+// restricts the number of threads that are used for the parallel operations executed by the
+// calling thread to the given budget. Budgets are nested: an inner budget can only reduce the
+// number of threads of an enclosing budget. Additionally, the threads of the backend system
+// are shared evenly among all threads with an active budget (see getThreadBudget()).
+*/
+template< typename T >
+class ThreadBudget
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   inline ThreadBudget( size_t threads );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~ThreadBudget();
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\name Conversion operator */
+   //@{
+   inline operator bool() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t previous_;  //!< The budget of the enclosing section (0 in case of no enclosing section).
+
+   static BLAZE_THREAD_LOCAL size_t budget_;  //!< The thread budget of the calling thread.
+                                              /*!< In case no thread budget is active for the
+                                                   calling thread, the budget is 0. */
+
+   static boost::atomic<size_t> sections_;  //!< The number of threads with an active budget.
+   //@}
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   friend bool isThreadBudgetActive();
+   friend size_t getThreadBudget( size_t threads );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+BLAZE_THREAD_LOCAL size_t ThreadBudget<T>::budget_ = 0UL;
+
+template< typename T >
+boost::atomic<size_t> ThreadBudget<T>::sections_( 0UL );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ThreadBudget class.
+//
+// \param threads The maximum number of threads \f$[1..\infty)\f$.
+// \exception std::invalid_argument Invalid thread budget.
+//
+// In case the calling thread is already inside a thread budget section, the budget of the
+// enclosing section is further restricted to the given number of threads.
+*/
+template< typename T >
+inline ThreadBudget<T>::ThreadBudget( size_t threads )
+   : previous_( budget_ )  // The budget of the enclosing section
+{
+   if( threads == 0UL )
+      throw std::invalid_argument( "Invalid thread budget" );
+
+   if( previous_ == 0UL ) {
+      budget_ = threads;
+      ++sections_;
+   }
+   else if( threads < previous_ ) {
+      budget_ = threads;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor of the ThreadBudget class.
+*/
+template< typename T >
+inline ThreadBudget<T>::~ThreadBudget()
+{
+   if( previous_ == 0UL )
+      --sections_;
+
+   budget_ = previous_;  // Restoring the budget of the enclosing section
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion operator to \a bool.
+//
+// The conversion operator returns \a true in case a thread budget is active for the calling
+// thread and \a false otherwise.
+*/
+template< typename T >
+inline ThreadBudget<T>::operator bool() const
+{
+   return budget_ != 0UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name ThreadBudget functions */
+//@{
+inline bool isThreadBudgetActive();
+inline size_t getThreadBudget( size_t threads );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether a thread budget is active for the calling thread or not.
+// \ingroup smp
+//
+// \return \a true if a thread budget is active, \a false if not.
+*/
+inline bool isThreadBudgetActive()
+{
+   return ThreadBudget<int>::budget_ != 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of threads available to the parallel operations of the calling thread.
+// \ingroup smp
+//
+// \param threads The total number of threads of the backend system.
+// \return The number of threads available to the calling thread \f$[1..threads]\f$.
+//
+// In case no thread budget is active for the calling thread, the function returns the given
+// total number of threads. Otherwise the total number of threads is divided evenly among all
+// threads with an active budget and the calling thread receives the smaller of its share and
+// its budget, but at least one thread.
+*/
+inline size_t getThreadBudget( size_t threads )
+{
+   const size_t budget( ThreadBudget<int>::budget_ );
+
+   if( budget == 0UL || threads < 2UL )
+      return threads;
+
+   const size_t sections( ThreadBudget<int>::sections_.load( boost::memory_order_relaxed ) );
+   const size_t share( sections > 1UL ? threads / sections : threads );
+
+   if( share < 2UL || budget < 2UL )
+      return 1UL;
+   else return ( budget < share )?( budget ):( share );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+
+
+
+
+//=================================================================================================
+//
+//  THREAD BUDGET MACRO
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Section to restrict the number of threads used by parallel operations.
+// \ingroup smp
+//
+// The BLAZE_THREAD_BUDGET macro restricts the number of threads that are used by the parallel
+// operations within its scope to the given number of threads:
+
+   \code
+   BLAZE_THREAD_BUDGET( 4 )
+   {
+      y = A * x;  // Uses at most 4 threads
+   }
+   \endcode
+
+// The thread budget only applies to the calling thread. Thus, in case several threads of an
+// application execute \b Blaze operations concurrently, each thread can be restricted to a
+// part of the available threads. Additionally, the threads of the \b Blaze backend system are
+// shared evenly among all threads with an active thread budget, which prevents an over-
+// subscription of the machine. In case thread budget sections are nested, the inner section
+// can only reduce the number of threads of the enclosing section. In case the given number
+// of threads is 0, a \a std::invalid_argument exception is thrown.
+*/
+#define BLAZE_THREAD_BUDGET( threads ) \
+   if( blaze::ThreadBudget<int> BLAZE_JOIN( threadBudget, __LINE__ ) = ( threads ) )
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
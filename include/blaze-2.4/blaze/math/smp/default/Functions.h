@@ -60,6 +60,8 @@ namespace blaze {
 //@{
 BLAZE_ALWAYS_INLINE size_t getNumThreads  ();
 BLAZE_ALWAYS_INLINE void   setNumThreads  ( size_t number );
+BLAZE_ALWAYS_INLINE size_t getSpinCount   ();
+BLAZE_ALWAYS_INLINE void   setSpinCount   ( size_t number );
 BLAZE_ALWAYS_INLINE void   shutDownThreads();
 //@}
 //*************************************************************************************************
@@ -101,6 +103,41 @@ BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Returns the number of spin iterations of idle threads.
+// \ingroup smp
+//
+// \return The number of iterations an idle thread spins before it goes to sleep.
+//
+// Via this function the number of iterations an idle thread actively polls for new work before
+// it goes to sleep can be queried. Note that in case no parallelization is active the function
+// will always return 0.
+*/
+BLAZE_ALWAYS_INLINE size_t getSpinCount()
+{
+   return 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the number of spin iterations of idle threads.
+// \ingroup smp
+//
+// \param number The given number of spin iterations (0 disables spinning).
+// \return void
+//
+// Via this function the number of iterations an idle thread actively polls for new work before
+// it goes to sleep can be specified. Note that in case no parallelization is active, the function
+// has no effect.
+*/
+BLAZE_ALWAYS_INLINE void setSpinCount( size_t number )
+{
+   UNUSED_PARAMETER( number );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
 // \ingroup smp
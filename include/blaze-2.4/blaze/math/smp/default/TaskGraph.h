@@ -0,0 +1,107 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/default/TaskGraph.h
+//  \brief Header file for the default concurrent SMP assignment of independent expressions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_DEFAULT_TASKGRAPH_H_
+#define _BLAZE_MATH_SMP_DEFAULT_TASKGRAPH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/smp/DenseMatrix.h>
+#include <blaze/util/logging/FunctionTrace.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SMP concurrent assignment functions */
+//@{
+template< typename MT1, bool SO1, typename MT2, bool SO2
+        , typename MT3, bool SO3, typename MT4, bool SO4 >
+inline void smpConcurrentAssign( DenseMatrix<MT1,SO1>& lhs1, const Matrix<MT2,SO2>& rhs1,
+                                 DenseMatrix<MT3,SO3>& lhs2, const Matrix<MT4,SO4>& rhs2 );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the SMP assignment of two independent matrices.
+// \ingroup smp
+//
+// \param lhs1 The first target left-hand side dense matrix.
+// \param rhs1 The right-hand side matrix to be assigned to the first target.
+// \param lhs2 The second target left-hand side dense matrix.
+// \param rhs2 The right-hand side matrix to be assigned to the second target.
+// \return void
+//
+// This function implements the default SMP assignment of two independent matrices to two dense
+// matrices. Since neither the OpenMP nor the serial backend support the concurrent evaluation
+// of independent expressions, the two assignments are performed one after the other.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename MT1  // Type of the first left-hand side dense matrix
+        , bool SO1      // Storage order of the first left-hand side dense matrix
+        , typename MT2  // Type of the first right-hand side matrix
+        , bool SO2      // Storage order of the first right-hand side matrix
+        , typename MT3  // Type of the second left-hand side dense matrix
+        , bool SO3      // Storage order of the second left-hand side dense matrix
+        , typename MT4  // Type of the second right-hand side matrix
+        , bool SO4 >    // Storage order of the second right-hand side matrix
+inline void smpConcurrentAssign( DenseMatrix<MT1,SO1>& lhs1, const Matrix<MT2,SO2>& rhs1,
+                                 DenseMatrix<MT3,SO3>& lhs2, const Matrix<MT4,SO4>& rhs2 )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   smpAssign( ~lhs1, ~rhs1 );
+   smpAssign( ~lhs2, ~rhs2 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
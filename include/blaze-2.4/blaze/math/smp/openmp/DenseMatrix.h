@@ -46,9 +46,10 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/Functions.h>
-#include <blaze/math/intrinsics/IntrinsicTrait.h>
 #include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/Partition.h>
 #include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/ThreadBudget.h>
 #include <blaze/math/SparseSubmatrix.h>
 #include <blaze/math/StorageOrder.h>
 #include <blaze/math/traits/SubmatrixExprTrait.h>
@@ -101,7 +102,6 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMajor
 
    typedef typename MT1::ElementType                         ET1;
    typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
    typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
@@ -109,21 +109,15 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMajor
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t granularity( smpGranularity<ET1>( vectorizable, SO == columnMajor ) );
+   const SMPPartition partition( smpRowPartition( ~rhs, omp_get_num_threads(), granularity ) );
+   const int chunks( static_cast<int>( partition.size() ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(static,1) nowait
+   for( int i=0; i<chunks; ++i )
    {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
-
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
+      const size_t row( partition.begin( i ) );
+      const size_t m  ( partition.end( i ) - row );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
@@ -174,7 +168,6 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,columnMa
 
    typedef typename MT1::ElementType                         ET1;
    typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
    typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
@@ -182,21 +175,15 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,columnMa
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t granularity( smpGranularity<ET1>( vectorizable, SO == rowMajor ) );
+   const SMPPartition partition( smpColumnPartition( ~rhs, omp_get_num_threads(), granularity ) );
+   const int chunks( static_cast<int>( partition.size() ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(static,1) nowait
+   for( int i=0; i<chunks; ++i )
    {
-      const size_t column( i*colsPerThread );
-
-      if( column >= (~lhs).columns() )
-         continue;
-
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+      const size_t column( partition.begin( i ) );
+      const size_t n     ( partition.end( i ) - column );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
@@ -249,19 +236,15 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowMajo
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~lhs).rows() / threads + addon );
+   const size_t granularity( smpGranularity<ET1>( false, SO == columnMajor ) );
+   const SMPPartition partition( smpRowPartition( ~rhs, omp_get_num_threads(), granularity ) );
+   const int chunks( static_cast<int>( partition.size() ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(static,1) nowait
+   for( int i=0; i<chunks; ++i )
    {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
-
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
+      const size_t row( partition.begin( i ) );
+      const size_t m  ( partition.end( i ) - row );
       UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
       assign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
    }
@@ -299,19 +282,15 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,columnM
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~lhs).columns() / threads + addon );
+   const size_t granularity( smpGranularity<ET1>( false, SO == rowMajor ) );
+   const SMPPartition partition( smpColumnPartition( ~rhs, omp_get_num_threads(), granularity ) );
+   const int chunks( static_cast<int>( partition.size() ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(static,1) nowait
+   for( int i=0; i<chunks; ++i )
    {
-      const size_t column( i*colsPerThread );
-
-      if( column >= (~lhs).columns() )
-         continue;
-
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+      const size_t column( partition.begin( i ) );
+      const size_t n     ( partition.end( i ) - column );
       UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
       assign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
    }
@@ -399,7 +378,7 @@ inline typename EnableIf< And< IsDenseMatrix<MT1>
          assign( ~lhs, ~rhs );
       }
       else {
-#pragma omp parallel shared( lhs, rhs )
+#pragma omp parallel shared( lhs, rhs ) num_threads( getThreadBudget( omp_get_max_threads() ) )
          smpAssign_backend( ~lhs, ~rhs );
       }
    }
@@ -444,7 +423,6 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMa
 
    typedef typename MT1::ElementType                         ET1;
    typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
    typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
@@ -452,21 +430,15 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMa
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t granularity( smpGranularity<ET1>( vectorizable, SO == columnMajor ) );
+   const SMPPartition partition( smpRowPartition( ~rhs, omp_get_num_threads(), granularity ) );
+   const int chunks( static_cast<int>( partition.size() ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(static,1) nowait
+   for( int i=0; i<chunks; ++i )
    {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
-
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
+      const size_t row( partition.begin( i ) );
+      const size_t m  ( partition.end( i ) - row );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
@@ -518,7 +490,6 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,colum
 
    typedef typename MT1::ElementType                         ET1;
    typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
    typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
@@ -526,21 +497,15 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,colum
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t granularity( smpGranularity<ET1>( vectorizable, SO == rowMajor ) );
+   const SMPPartition partition( smpColumnPartition( ~rhs, omp_get_num_threads(), granularity ) );
+   const int chunks( static_cast<int>( partition.size() ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(static,1) nowait
+   for( int i=0; i<chunks; ++i )
    {
-      const size_t column( i*colsPerThread );
-
-      if( column >= (~lhs).columns() )
-         continue;
-
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+      const size_t column( partition.begin( i ) );
+      const size_t n     ( partition.end( i ) - column );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
@@ -594,19 +559,15 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowM
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~lhs).rows() / threads + addon );
+   const size_t granularity( smpGranularity<ET1>( false, SO == columnMajor ) );
+   const SMPPartition partition( smpRowPartition( ~rhs, omp_get_num_threads(), granularity ) );
+   const int chunks( static_cast<int>( partition.size() ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(static,1) nowait
+   for( int i=0; i<chunks; ++i )
    {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
-
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
+      const size_t row( partition.begin( i ) );
+      const size_t m  ( partition.end( i ) - row );
       UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
       addAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
    }
@@ -645,19 +606,15 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,colu
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~lhs).columns() / threads + addon );
+   const size_t granularity( smpGranularity<ET1>( false, SO == rowMajor ) );
+   const SMPPartition partition( smpColumnPartition( ~rhs, omp_get_num_threads(), granularity ) );
+   const int chunks( static_cast<int>( partition.size() ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(static,1) nowait
+   for( int i=0; i<chunks; ++i )
    {
-      const size_t column( i*colsPerThread );
-
-      if( column >= (~lhs).columns() )
-         continue;
-
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+      const size_t column( partition.begin( i ) );
+      const size_t n     ( partition.end( i ) - column );
       UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
       addAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
    }
@@ -745,7 +702,7 @@ inline typename EnableIf< And< IsDenseMatrix<MT1>
          addAssign( ~lhs, ~rhs );
       }
       else {
-#pragma omp parallel shared( lhs, rhs )
+#pragma omp parallel shared( lhs, rhs ) num_threads( getThreadBudget( omp_get_max_threads() ) )
          smpAddAssign_backend( ~lhs, ~rhs );
       }
    }
@@ -790,7 +747,6 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMa
 
    typedef typename MT1::ElementType                         ET1;
    typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
    typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
@@ -798,21 +754,15 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMa
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t granularity( smpGranularity<ET1>( vectorizable, SO == columnMajor ) );
+   const SMPPartition partition( smpRowPartition( ~rhs, omp_get_num_threads(), granularity ) );
+   const int chunks( static_cast<int>( partition.size() ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(static,1) nowait
+   for( int i=0; i<chunks; ++i )
    {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
-
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
+      const size_t row( partition.begin( i ) );
+      const size_t m  ( partition.end( i ) - row );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
@@ -864,7 +814,6 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,colum
 
    typedef typename MT1::ElementType                         ET1;
    typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
    typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
@@ -872,21 +821,15 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,colum
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t granularity( smpGranularity<ET1>( vectorizable, SO == rowMajor ) );
+   const SMPPartition partition( smpColumnPartition( ~rhs, omp_get_num_threads(), granularity ) );
+   const int chunks( static_cast<int>( partition.size() ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(static,1) nowait
+   for( int i=0; i<chunks; ++i )
    {
-      const size_t column( i*colsPerThread );
-
-      if( column >= (~lhs).columns() )
-         continue;
-
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+      const size_t column( partition.begin( i ) );
+      const size_t n     ( partition.end( i ) - column );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
@@ -940,19 +883,15 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowM
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~lhs).rows() / threads + addon );
+   const size_t granularity( smpGranularity<ET1>( false, SO == columnMajor ) );
+   const SMPPartition partition( smpRowPartition( ~rhs, omp_get_num_threads(), granularity ) );
+   const int chunks( static_cast<int>( partition.size() ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(static,1) nowait
+   for( int i=0; i<chunks; ++i )
    {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
-
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
+      const size_t row( partition.begin( i ) );
+      const size_t m  ( partition.end( i ) - row );
       UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
       subAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
    }
@@ -991,19 +930,15 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,colu
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~lhs).columns() / threads + addon );
+   const size_t granularity( smpGranularity<ET1>( false, SO == rowMajor ) );
+   const SMPPartition partition( smpColumnPartition( ~rhs, omp_get_num_threads(), granularity ) );
+   const int chunks( static_cast<int>( partition.size() ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(static,1) nowait
+   for( int i=0; i<chunks; ++i )
    {
-      const size_t column( i*colsPerThread );
-
-      if( column >= (~lhs).columns() )
-         continue;
-
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+      const size_t column( partition.begin( i ) );
+      const size_t n     ( partition.end( i ) - column );
       UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
       subAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
    }
@@ -1091,7 +1026,7 @@ inline typename EnableIf< And< IsDenseMatrix<MT1>
          subAssign( ~lhs, ~rhs );
       }
       else {
-#pragma omp parallel shared( lhs, rhs )
+#pragma omp parallel shared( lhs, rhs ) num_threads( getThreadBudget( omp_get_max_threads() ) )
          smpSubAssign_backend( ~lhs, ~rhs );
       }
    }
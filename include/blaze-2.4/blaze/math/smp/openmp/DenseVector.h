@@ -46,9 +46,10 @@
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/Functions.h>
-#include <blaze/math/intrinsics/IntrinsicTrait.h>
 #include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/Partition.h>
 #include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/ThreadBudget.h>
 #include <blaze/math/SparseSubvector.h>
 #include <blaze/math/traits/SubvectorExprTrait.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
@@ -101,7 +102,6 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& r
 
    typedef typename VT1::ElementType                         ET1;
    typedef typename VT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename VT1::ElementType>         IT;
    typedef typename SubvectorExprTrait<VT1,aligned>::Type    AlignedTarget;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
@@ -109,21 +109,15 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& r
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t granularity( smpGranularity<ET1>( vectorizable, true ) );
+   const SMPPartition partition( smpPartition( ~rhs, omp_get_num_threads(), granularity ) );
+   const int chunks( static_cast<int>( partition.size() ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(static,1) nowait
+   for( int i=0; i<chunks; ++i )
    {
-      const size_t index( i*sizePerThread );
-
-      if( index >= (~lhs).size() )
-         continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t index( partition.begin( i ) );
+      const size_t size ( partition.end( i ) - index );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
@@ -177,19 +171,15 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>&
    typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
+   const size_t granularity( smpGranularity<ET1>( false, true ) );
+   const SMPPartition partition( smpPartition( ~rhs, omp_get_num_threads(), granularity ) );
+   const int chunks( static_cast<int>( partition.size() ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(static,1) nowait
+   for( int i=0; i<chunks; ++i )
    {
-      const size_t index( i*sizePerThread );
-
-      if( index >= (~lhs).size() )
-         continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t index( partition.begin( i ) );
+      const size_t size ( partition.end( i ) - index );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
       assign( target, subvector<unaligned>( ~rhs, index, size ) );
    }
@@ -275,7 +265,7 @@ inline typename EnableIf< And< IsDenseVector<VT1>
          assign( ~lhs, ~rhs );
       }
       else {
-#pragma omp parallel shared( lhs, rhs )
+#pragma omp parallel shared( lhs, rhs ) num_threads( getThreadBudget( omp_get_max_threads() ) )
          smpAssign_backend( ~lhs, ~rhs );
       }
    }
@@ -320,7 +310,6 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
 
    typedef typename VT1::ElementType                         ET1;
    typedef typename VT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename VT1::ElementType>         IT;
    typedef typename SubvectorExprTrait<VT1,aligned>::Type    AlignedTarget;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
@@ -328,21 +317,15 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t granularity( smpGranularity<ET1>( vectorizable, true ) );
+   const SMPPartition partition( smpPartition( ~rhs, omp_get_num_threads(), granularity ) );
+   const int chunks( static_cast<int>( partition.size() ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(static,1) nowait
+   for( int i=0; i<chunks; ++i )
    {
-      const size_t index( i*sizePerThread );
-
-      if( index >= (~lhs).size() )
-         continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t index( partition.begin( i ) );
+      const size_t size ( partition.end( i ) - index );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
@@ -396,19 +379,15 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
    typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
+   const size_t granularity( smpGranularity<ET1>( false, true ) );
+   const SMPPartition partition( smpPartition( ~rhs, omp_get_num_threads(), granularity ) );
+   const int chunks( static_cast<int>( partition.size() ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(static,1) nowait
+   for( int i=0; i<chunks; ++i )
    {
-      const size_t index( i*sizePerThread );
-
-      if( index >= (~lhs).size() )
-         continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t index( partition.begin( i ) );
+      const size_t size ( partition.end( i ) - index );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
       addAssign( target, subvector<unaligned>( ~rhs, index, size ) );
    }
@@ -494,7 +473,7 @@ inline typename EnableIf< And< IsDenseVector<VT1>
          addAssign( ~lhs, ~rhs );
       }
       else {
-#pragma omp parallel shared( lhs, rhs )
+#pragma omp parallel shared( lhs, rhs ) num_threads( getThreadBudget( omp_get_max_threads() ) )
          smpAddAssign_backend( ~lhs, ~rhs );
       }
    }
@@ -539,7 +518,6 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
 
    typedef typename VT1::ElementType                         ET1;
    typedef typename VT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename VT1::ElementType>         IT;
    typedef typename SubvectorExprTrait<VT1,aligned>::Type    AlignedTarget;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
@@ -547,21 +525,15 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t granularity( smpGranularity<ET1>( vectorizable, true ) );
+   const SMPPartition partition( smpPartition( ~rhs, omp_get_num_threads(), granularity ) );
+   const int chunks( static_cast<int>( partition.size() ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(static,1) nowait
+   for( int i=0; i<chunks; ++i )
    {
-      const size_t index( i*sizePerThread );
-
-      if( index >= (~lhs).size() )
-         continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t index( partition.begin( i ) );
+      const size_t size ( partition.end( i ) - index );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
@@ -615,19 +587,15 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
    typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
+   const size_t granularity( smpGranularity<ET1>( false, true ) );
+   const SMPPartition partition( smpPartition( ~rhs, omp_get_num_threads(), granularity ) );
+   const int chunks( static_cast<int>( partition.size() ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(static,1) nowait
+   for( int i=0; i<chunks; ++i )
    {
-      const size_t index( i*sizePerThread );
-
-      if( index >= (~lhs).size() )
-         continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t index( partition.begin( i ) );
+      const size_t size ( partition.end( i ) - index );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
       subAssign( target, subvector<unaligned>( ~rhs, index, size ) );
    }
@@ -713,7 +681,7 @@ inline typename EnableIf< And< IsDenseVector<VT1>
          subAssign( ~lhs, ~rhs );
       }
       else {
-#pragma omp parallel shared( lhs, rhs )
+#pragma omp parallel shared( lhs, rhs ) num_threads( getThreadBudget( omp_get_max_threads() ) )
          smpSubAssign_backend( ~lhs, ~rhs );
       }
    }
@@ -759,7 +727,6 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2
 
    typedef typename VT1::ElementType                         ET1;
    typedef typename VT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename VT1::ElementType>         IT;
    typedef typename SubvectorExprTrait<VT1,aligned>::Type    AlignedTarget;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
@@ -767,21 +734,15 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t granularity( smpGranularity<ET1>( vectorizable, true ) );
+   const SMPPartition partition( smpPartition( ~rhs, omp_get_num_threads(), granularity ) );
+   const int chunks( static_cast<int>( partition.size() ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(static,1) nowait
+   for( int i=0; i<chunks; ++i )
    {
-      const size_t index( i*sizePerThread );
-
-      if( index >= (~lhs).size() )
-         continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t index( partition.begin( i ) );
+      const size_t size ( partition.end( i ) - index );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
@@ -836,19 +797,15 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF
    typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
+   const size_t granularity( smpGranularity<ET1>( false, true ) );
+   const SMPPartition partition( smpPartition( ~rhs, omp_get_num_threads(), granularity ) );
+   const int chunks( static_cast<int>( partition.size() ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(static,1) nowait
+   for( int i=0; i<chunks; ++i )
    {
-      const size_t index( i*sizePerThread );
-
-      if( index >= (~lhs).size() )
-         continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t index( partition.begin( i ) );
+      const size_t size ( partition.end( i ) - index );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
       multAssign( target, subvector<unaligned>( ~rhs, index, size ) );
    }
@@ -934,7 +891,7 @@ inline typename EnableIf< And< IsDenseVector<VT1>
          multAssign( ~lhs, ~rhs );
       }
       else {
-#pragma omp parallel shared( lhs, rhs )
+#pragma omp parallel shared( lhs, rhs ) num_threads( getThreadBudget( omp_get_max_threads() ) )
          smpMultAssign_backend( ~lhs, ~rhs );
       }
    }
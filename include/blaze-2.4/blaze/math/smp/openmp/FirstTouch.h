@@ -0,0 +1,111 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/openmp/FirstTouch.h
+//  \brief Header file for the OpenMP-based first-touch initialization
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_OPENMP_FIRSTTOUCH_H_
+#define _BLAZE_MATH_SMP_OPENMP_FIRSTTOUCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <omp.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/Partition.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/ThreadBudget.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  FIRST-TOUCH INITIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief OpenMP-based implementation of the parallel first-touch initialization.
+// \ingroup math
+//
+// \param n The size of the index range to be initialized.
+// \param granularity The granularity of the chunks of the index range.
+// \param init The initializer for a range of indices.
+// \return void
+//
+// This function initializes the index range \f$ [0..n) \f$ in parallel. The range is split
+// into the same chunks that the smpAssign() functions use for a target of the same size, and
+// due to the static schedule the k-th chunk is initialized by the same thread as the k-th
+// chunk of these assignments. Thus on NUMA systems the memory pages of a newly allocated
+// vector or matrix are placed on the nodes of the threads that will later work on them (in
+// combination with \c OMP_PROC_BIND). Within a serial or parallel section the initializer is
+// called once for the entire range.\n
+// This function must \b NOT be called explicitly! It is used internally by the constructors of
+// the dense vector and matrix types.
+*/
+template< typename Initializer >  // Type of the range initializer
+void smpFirstTouch( size_t n, size_t granularity, const Initializer& init )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t threads( getThreadBudget( omp_get_max_threads() ) );
+
+   if( isParallelSectionActive() || isSerialSectionActive() || threads < 2UL ) {
+      init( 0UL, n );
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+#pragma omp parallel shared( init ) num_threads( threads )
+      {
+         const SMPPartition partition( n, omp_get_num_threads(), granularity );
+         const int chunks( static_cast<int>( partition.size() ) );
+
+#pragma omp for schedule(static,1) nowait
+         for( int i=0; i<chunks; ++i ) {
+            init( partition.begin( i ), partition.end( i ) );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -46,6 +46,7 @@
 #include <blaze/system/SMP.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
 
 
 namespace blaze {
@@ -88,7 +89,7 @@ BLAZE_ALWAYS_INLINE size_t getNumThreads()
 // Note that the given \a number must be in the range \f$[1..infty)\f$. In case an invalid
 // number of threads is specified, a \a std::invalid_argument exception is thrown.
 */
-BLAZE_ALWAYS_INLINE size_t setNumThreads( size_t number )
+BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 {
    if( number == 0UL )
       throw std::invalid_argument( "Invalid number of threads" );
@@ -99,6 +100,43 @@ BLAZE_ALWAYS_INLINE size_t setNumThreads( size_t number )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of spin iterations of idle threads.
+// \ingroup smp
+//
+// \return 0.
+//
+// The spinning of idle OpenMP threads is controlled by the OpenMP runtime (e.g. via the
+// \c OMP_WAIT_POLICY environment variable). Therefore this function always returns 0.
+*/
+BLAZE_ALWAYS_INLINE size_t getSpinCount()
+{
+   return 0UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sets the number of spin iterations of idle threads.
+// \ingroup smp
+//
+// \param number The given number of spin iterations.
+// \return void
+//
+// The spinning of idle OpenMP threads is controlled by the OpenMP runtime (e.g. via the
+// \c OMP_WAIT_POLICY environment variable). Therefore this function has no effect.
+*/
+BLAZE_ALWAYS_INLINE void setSpinCount( size_t number )
+{
+   UNUSED_PARAMETER( number );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
@@ -0,0 +1,247 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/openmp/MMM.h
+//  \brief Header file for the OpenMP-based parallel packed matrix multiplication
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_OPENMP_MMM_H_
+#define _BLAZE_MATH_SMP_OPENMP_MMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <omp.h>
+#include <blaze/math/dense/MMM.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DMatTransExpr.h>
+#include <blaze/math/expressions/DMatTransposer.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/ThreadBudget.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/policies/Deallocate.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/UniqueArray.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PARALLEL PACKED MATRIX MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based parallel packed matrix multiplication
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup math
+//
+// \param C The target row-major dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param Bp Pointer to the shared packing buffer for blocks of \a B.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based parallel packed matrix
+// multiplication. It is executed by all threads of the surrounding parallel region: Per
+// \a kc x \a nc block of \a B, all threads first pack a share of the micro-panels into the
+// shared buffer. After a barrier each thread multiplies its range of rows of \a A with its
+// range of micro-panels of the shared block (see the mmmPartition() function).
+*/
+template< typename MT1  // Type of the target dense matrix
+        , typename MT2  // Type of the left-hand side matrix operand
+        , typename MT3  // Type of the right-hand side matrix operand
+        , typename ET > // Type of the matrix elements
+void smpMmm_backend( MT1& C, const MT2& A, const MT3& B, ET* Bp, ET alpha, ET beta )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef MMMTrait<ET>  MMMT;
+
+   const size_t M( A.rows()    );
+   const size_t N( B.columns() );
+   const size_t K( A.columns() );
+
+   const size_t threads( omp_get_num_threads() );
+   const size_t index  ( omp_get_thread_num()  );
+
+   const size_t MR( MMMT::mr );
+   const size_t NR( MMMT::nr );
+
+   const size_t mc( min( MMMT::mc(), ( ( M + MR - 1UL ) / MR ) * MR ) );
+   const size_t kc( min( MMMT::kc(), K ) );
+   const size_t nc( min( MMMT::nc(), ( ( N + NR - 1UL ) / NR ) * NR ) );
+
+   UniqueArray<ET,Deallocate> Ap( allocate<ET>( mc*kc ) );
+
+   for( size_t jj=0UL; jj<N; jj+=nc )
+   {
+      const size_t nb( min( nc, N-jj ) );
+      const size_t panels( ( nb + NR - 1UL ) / NR );
+
+      size_t rows( 0UL ), columns( 0UL );
+      mmmPartition<ET>( threads, M, nb, rows, columns );
+
+      const size_t rowsPerThread  ( ( ( M + rows - 1UL ) / rows + MR - 1UL ) / MR * MR );
+      const size_t panelsPerThread( ( panels + columns - 1UL ) / columns );
+
+      const size_t ibegin( min( M , ( index / columns ) * rowsPerThread        ) );
+      const size_t iend  ( min( M , ibegin + rowsPerThread                     ) );
+      const size_t jbegin( min( nb, ( index % columns ) * panelsPerThread * NR ) );
+      const size_t jend  ( min( nb, jbegin + panelsPerThread*NR                ) );
+
+      const size_t pbegin( min( nb, ( ( index*panels ) / threads ) * NR ) );
+      const size_t pend  ( min( nb, ( ( (index+1UL)*panels ) / threads ) * NR ) );
+
+      for( size_t kk=0UL; kk<K; kk+=kc )
+      {
+         const size_t kb( min( kc, K-kk ) );
+         const ET factor( kk == 0UL ? beta : ET( 1 ) );
+
+         if( pbegin < pend )
+            packRightBlock( B, Bp+pbegin*kb, kk, kb, jj+pbegin, pend-pbegin );
+
+#pragma omp barrier
+
+         if( ibegin < iend && jbegin < jend )
+            mmmBlock( C, A, Ap.get(), Bp, ibegin, iend, jj, jbegin, jend, kk, kb, alpha, factor );
+
+#pragma omp barrier
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief OpenMP-based parallel packed matrix multiplication (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup math
+//
+// \param C The target row-major dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function implements the cooperative, OpenMP-based variant of the packed matrix
+// multiplication (see the mmm() function). In contrast to a partitioning of \a C into
+// independent stripes, all threads share a single packed \a kc x \a nc block of \a B, which
+// is thus read from memory once per multiplication instead of once per thread.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the target dense matrix
+        , typename MT2  // Type of the left-hand side matrix operand
+        , typename MT3  // Type of the right-hand side matrix operand
+        , typename ST > // Type of the scaling factors
+void smpMmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef typename MT1::ElementType  ET;
+   typedef MMMTrait<ET>               MMMT;
+
+   BLAZE_INTERNAL_ASSERT( (~C).rows()    == A.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~C).columns() == B.columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( A.columns()    == B.rows()   , "Invalid matrix sizes"      );
+
+   const size_t M( A.rows()    );
+   const size_t N( B.columns() );
+   const size_t K( A.columns() );
+
+   const size_t threads( getThreadBudget( omp_get_max_threads() ) );
+
+   if( threads == 1UL || M == 0UL || N == 0UL || K == 0UL ) {
+      mmm( ~C, A, B, alpha, beta );
+      return;
+   }
+
+   const size_t NR( MMMT::nr );
+
+   const size_t kc( min( MMMT::kc(), K ) );
+   const size_t nc( min( MMMT::nc(), ( ( N + NR - 1UL ) / NR ) * NR ) );
+
+   UniqueArray<ET,Deallocate> Bp( allocate<ET>( kc*nc ) );
+
+#pragma omp parallel shared( C, A, B, Bp, alpha, beta ) num_threads( threads )
+   smpMmm_backend( ~C, A, B, Bp.get(), ET( alpha ), ET( beta ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief OpenMP-based parallel packed matrix multiplication (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup math
+//
+// \param C The target column-major dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function computes the multiplication for a column-major target matrix as the transpose
+// multiplication \f$ C^T=\alpha*B^T*A^T+\beta*C^T \f$ into the row-major view on \a C.
+*/
+template< typename MT1  // Type of the target dense matrix
+        , typename MT2  // Type of the left-hand side matrix operand
+        , typename MT3  // Type of the right-hand side matrix operand
+        , typename ST > // Type of the scaling factors
+void smpMmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   DMatTransposer<MT1,false> tmp( ~C );
+   smpMmm( tmp, trans( B ), trans( A ), alpha, beta );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,112 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/openmp/Reduction.h
+//  \brief Header file for the OpenMP-based reductions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_OPENMP_REDUCTION_H_
+#define _BLAZE_MATH_SMP_OPENMP_REDUCTION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <omp.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/ReductionTree.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/ThreadBudget.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief OpenMP-based implementation of the parallel reduction.
+// \ingroup smp
+//
+// \param n The size of the index range \f$[1..\infty)\f$.
+// \param kernel The reduction kernel.
+// \return The result of the reduction.
+//
+// This function computes the reduction of the index range \f$ [0..n) \f$ by means of the given
+// kernel (see the reduce() function). The blocks of the reduction are distributed among the
+// OpenMP threads and their partial results are combined in a fixed order by the calling thread.
+// Therefore, in contrast to an OpenMP \c reduction clause, the result does not depend on the
+// number of threads. In case the range is smaller than the blaze::SMP_DVECREDUCTION_THRESHOLD
+// or consists of a single block and within a serial or parallel section, the reduction is
+// evaluated in serial.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reductions.
+*/
+template< typename Kernel >  // Type of the reduction kernel
+const typename Kernel::ResultType smpReduce( size_t n, const Kernel& kernel )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef typename Kernel::ResultType  RT;
+
+   const size_t threads( getThreadBudget( omp_get_max_threads() ) );
+
+   if( n < SMP_DVECREDUCTION_THRESHOLD || n <= smpReductionBlockSize ||
+       isParallelSectionActive() || isSerialSectionActive() || threads < 2UL ) {
+      return reduce( n, kernel );
+   }
+
+   SMPReductionTree<RT> tree( n );
+   const int blocks( static_cast<int>( tree.blocks() ) );
+
+   BLAZE_PARALLEL_SECTION
+   {
+#pragma omp parallel for schedule(dynamic) shared( kernel, tree ) num_threads( threads )
+      for( int b=0; b<blocks; ++b ) {
+         tree[b] = kernel( tree.begin( b ), tree.end( b ) );
+      }
+   }
+
+   return tree.result();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,908 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/AsyncAssign.h
+//  \brief Header file for the C++11/Boost thread-based asynchronous SMP assignment
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_ASYNCASSIGN_H_
+#define _BLAZE_MATH_SMP_THREADS_ASYNCASSIGN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <vector>
+#include <boost/function.hpp>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/Expression.h>
+#include <blaze/math/constraints/SMPAssignable.h>
+#include <blaze/math/constraints/View.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DMatSerialExpr.h>
+#include <blaze/math/expressions/DVecSerialExpr.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SMatSerialExpr.h>
+#include <blaze/math/expressions/SVecSerialExpr.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/DenseMatrix.h>
+#include <blaze/math/smp/threads/DenseVector.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/Not.h>
+#include <blaze/util/mpl/Or.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/threadpool/Task.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS SMPFUTURE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Handle to an asynchronous SMP assignment.
+// \ingroup smp
+//
+// The SMPFuture class represents the handle to an asynchronous assignment, which is returned
+// by the asyncAssign() functions. The handle allows to query whether the assignment has been
+// completed (see the isReady() function) and to wait for its completion (see the wait()
+// function):
+
+   \code
+   blaze::DynamicMatrix<double> A, B, C, D, E, T1, T2;
+   // ... Resizing and initialization
+
+   blaze::SMPFuture f1 = blaze::asyncAssign( T1, A + B );   // Does not block
+   blaze::SMPFuture f2 = blaze::asyncAssign( T2, C - D );   // Runs concurrently to the first assignment
+   blaze::SMPFuture f3 = blaze::asyncAssign( E, T1 * T2 );  // Starts after both assignments
+   f3.wait();
+   \endcode
+
+// A default constructed handle refers to a completed assignment. In case the coroutine-based
+// execution of the C++11 thread parallelization is activated (see the \c BLAZE_USE_COROUTINES
+// switch in <tt><blaze/config/SMP.h></tt>), the handle can also be awaited by a C++20 coroutine.
+// In contrast to the wait() function, \c co_await does not block the awaiting thread, but
+// suspends the coroutine until the assignment has been completed. The coroutine is resumed by
+// the thread that completes the assignment:
+
+   \code
+   Task compute( blaze::DynamicMatrix<double>& C,
+                 const blaze::DynamicMatrix<double>& A, const blaze::DynamicMatrix<double>& B )
+   {
+      co_await blaze::asyncAssign( C, A * B );  // Suspends the coroutine instead of blocking
+      // ... Continued by the thread that completed the assignment
+   }
+   \endcode
+*/
+class SMPFuture
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef TheThreadBackend::JobPointer  JobPointer;  //!< Shared handle to an asynchronous job.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SMPFuture();
+   explicit inline SMPFuture( const JobPointer& job );
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool isReady() const;
+   inline void wait   () const;
+   //@}
+   //**********************************************************************************************
+
+#if BLAZE_COROUTINES_PARALLEL_MODE
+   //**Coroutine functions*************************************************************************
+   /*!\name Coroutine functions */
+   //@{
+   inline bool await_ready  () const;
+   inline bool await_suspend( std::coroutine_handle<> handle ) const;
+   inline void await_resume () const;
+   //@}
+   //**********************************************************************************************
+#endif
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   JobPointer job_;  //!< The job performing the assignment.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The default constructor for SMPFuture.
+//
+// The default constructed handle refers to a completed assignment.
+*/
+inline SMPFuture::SMPFuture()
+   : job_()  // The job performing the assignment
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for a handle to the given asynchronous job.
+//
+// \param job The job performing the assignment.
+*/
+inline SMPFuture::SMPFuture( const JobPointer& job )
+   : job_( job )  // The job performing the assignment
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the assignment has been completed.
+//
+// \return \a true if the assignment has been completed, \a false if not.
+*/
+inline bool SMPFuture::isReady() const
+{
+   return !job_ || job_->isReady();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waits for the completion of the assignment.
+//
+// \return void
+// \exception ... The first exception thrown during the assignment.
+//
+// In case the assignment has failed, the first exception thrown by any of its tasks is rethrown
+// after all tasks have been completed.
+*/
+inline void SMPFuture::wait() const
+{
+   if( job_ ) {
+      job_->wait();
+      job_->rethrow();
+   }
+}
+//*************************************************************************************************
+
+
+#if BLAZE_COROUTINES_PARALLEL_MODE
+//*************************************************************************************************
+/*!\brief Returns whether the awaiting coroutine can continue without suspension.
+//
+// \return \a true if the assignment has been completed, \a false if not.
+*/
+inline bool SMPFuture::await_ready() const
+{
+   return isReady();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Suspends the awaiting coroutine until the completion of the assignment.
+//
+// \param handle The handle of the awaiting coroutine.
+// \return \a true if the coroutine remains suspended, \a false if the assignment is completed.
+//
+// The suspended coroutine is resumed by the thread that completes the assignment.
+*/
+inline bool SMPFuture::await_suspend( std::coroutine_handle<> handle ) const
+{
+   return job_ && job_->suspend( handle );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Completes the awaiting of the assignment.
+//
+// \return void
+// \exception ... The first exception thrown during the assignment.
+*/
+inline void SMPFuture::await_resume() const
+{
+   if( job_ )
+      job_->rethrow();
+}
+//*************************************************************************************************
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  CLASS ASYNCASSIGNER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the asynchronous assignment of a complete vector or matrix.
+// \ingroup smp
+//
+// The AsyncAssigner class template performs the assignment of the given source operand to the
+// given target in a single task. In case the source operand is aliased with the target, the
+// source operand is evaluated into a temporary before it is assigned to the target.
+*/
+template< typename Target    // Type of the target vector or matrix
+        , typename Source >  // Type of the source vector or matrix
+struct AsyncAssigner
+{
+   //**Type definitions****************************************************************************
+   //! Composite type of the source operand.
+   typedef typename SelectType< IsExpression<Source>::value, const Source, const Source& >::Type  Operand;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the AsyncAssigner class template.
+   //
+   // \param target The target vector or matrix to be assigned to.
+   // \param source The source vector or matrix to be assigned.
+   // \param aliased \a true in case the source is aliased with the target, \a false if not.
+   */
+   explicit inline AsyncAssigner( Target& target, const Source& source, bool aliased )
+      : target_ ( &target )  // The target vector or matrix
+      , source_ ( source  )  // The source vector or matrix
+      , aliased_( aliased )  // Aliasing flag of the source operand
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Performs the assignment.
+   //
+   // \return void
+   */
+   inline void operator()() const {
+      if( aliased_ ) {
+         const typename Source::ResultType tmp( serial( source_ ) );
+         assign( *target_, tmp );
+      }
+      else {
+         assign( *target_, source_ );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Target* target_;   //!< The target vector or matrix.
+   Operand source_;   //!< The source vector or matrix.
+   bool    aliased_;  //!< Aliasing flag of the source operand.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS ASYNCTRACKER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Bookkeeping of the pending asynchronous assignments.
+// \ingroup smp
+//
+// The AsyncTracker class template records the target and the source operand of all pending
+// asynchronous assignments in order to determine the dependencies of a new assignment. A new
+// assignment depends on a pending assignment in case it writes the same target (write after
+// write), in case its source operand reads the target of the pending assignment (read after
+// write), or in case its target is read by the source operand of the pending assignment (write
+// after read). Completed assignments are removed from the records. The records are shared by
+// all threads and are guarded by a mutex. Since the dependencies of a new assignment are
+// determined, its job is launched, and the job is recorded under a single lock (see the start()
+// function), several threads may start asynchronous assignments concurrently without missing
+// each other's jobs.\n
+// The template argument is only used to allow the definition of the static member variable in
+// the header file.
+*/
+template< typename T >  // Type of the tracker
+class AsyncTracker
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef TheThreadBackend::JobPointer  JobPointer;  //!< Shared handle to an asynchronous job.
+   //**********************************************************************************************
+
+   //**Class Reader********************************************************************************
+   /*!\brief Auxiliary functor for the aliasing test of a stored source operand.
+   */
+   template< typename Source >  // Type of the source operand
+   struct Reader
+   {
+      //**Type definitions*************************************************************************
+      //! Composite type of the source operand.
+      typedef typename SelectType< IsExpression<Source>::value, const Source, const Source& >::Type  Operand;
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Reader class template.
+      //
+      // \param source The source operand.
+      */
+      explicit inline Reader( const Source& source )
+         : source_( source )  // The source operand
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Returns whether the source operand is aliased with the given address.
+      //
+      // \param alias The address to be checked.
+      // \return \a true in case the source operand reads the given address, \a false if not.
+      */
+      inline bool operator()( const void* alias ) const {
+         return source_.isAliased( alias );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Operand source_;  //!< The source operand.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Class Record********************************************************************************
+   /*!\brief Record of a pending asynchronous assignment.
+   */
+   struct Record
+   {
+      const void*                          target_;  //!< The target of the assignment.
+      boost::function<bool( const void* )> reads_;   //!< Aliasing test of the source operand.
+      JobPointer                           job_;     //!< The job performing the assignment.
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Target, typename Source >
+   static void dependencies( const Target& target, const Source& source,
+                             std::vector<JobPointer>& jobs );
+
+   template< typename Target, typename Source >
+   static JobPointer start( const Target& target, const Source& source,
+                            std::vector<threadpool::Task>& tasks );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Target, typename Source >
+   static void collect( const Target& target, const Source& source, std::vector<JobPointer>& jobs );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   static std::vector<Record>       records_;  //!< The records of the pending assignments.
+   static TheThreadBackend::Mutex  mutex_;    //!< Synchronization mutex for the records.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+std::vector<typename AsyncTracker<T>::Record> AsyncTracker<T>::records_;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+TheThreadBackend::Mutex AsyncTracker<T>::mutex_;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determines the pending assignments a new assignment depends on.
+//
+// \param target The target of the new assignment.
+// \param source The source operand of the new assignment.
+// \param jobs The vector the jobs of the pending assignments are added to.
+// \return void
+//
+// This function is used for assignments that are performed immediately by the calling thread
+// and are therefore not recorded (see the asyncAssign() functions).
+*/
+template< typename T >         // Type of the tracker
+template< typename Target      // Type of the target vector or matrix
+        , typename Source >    // Type of the source vector or matrix
+void AsyncTracker<T>::dependencies( const Target& target, const Source& source,
+                                    std::vector<JobPointer>& jobs )
+{
+   TheThreadBackend::Lock lock( mutex_ );
+   collect( target, source, jobs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Starts and records a new asynchronous assignment.
+//
+// \param target The target of the new assignment.
+// \param source The source operand of the new assignment.
+// \param tasks The tasks of the new assignment (the given vector is emptied).
+// \return The job performing the assignment.
+//
+// This function determines the pending assignments the new assignment depends on, launches
+// the job of the new assignment with these predecessors (see the ThreadBackend::launch()
+// function), and records the job. All three steps are performed under a single lock, such that
+// an assignment started concurrently by another thread either depends on the new job or is a
+// predecessor of it.
+*/
+template< typename T >         // Type of the tracker
+template< typename Target      // Type of the target vector or matrix
+        , typename Source >    // Type of the source vector or matrix
+typename AsyncTracker<T>::JobPointer
+   AsyncTracker<T>::start( const Target& target, const Source& source,
+                           std::vector<threadpool::Task>& tasks )
+{
+   Record record;
+   record.target_ = &target;
+   record.reads_  = Reader<Source>( source );
+
+   TheThreadBackend::Lock lock( mutex_ );
+
+   std::vector<JobPointer> predecessors;
+   collect( target, source, predecessors );
+
+   record.job_ = TheThreadBackend::launch( tasks, predecessors );
+   records_.push_back( record );
+
+   return record.job_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Removes the completed assignments and collects the pending assignments a new assignment
+//        depends on.
+//
+// \param target The target of the new assignment.
+// \param source The source operand of the new assignment.
+// \param jobs The vector the jobs of the pending assignments are added to.
+// \return void
+//
+// This function must only be called while the records are locked.
+*/
+template< typename T >         // Type of the tracker
+template< typename Target      // Type of the target vector or matrix
+        , typename Source >    // Type of the source vector or matrix
+void AsyncTracker<T>::collect( const Target& target, const Source& source,
+                               std::vector<JobPointer>& jobs )
+{
+   size_t pending( 0UL );
+
+   for( size_t i=0UL; i<records_.size(); ++i )
+   {
+      if( records_[i].job_->isReady() )
+         continue;
+
+      if( pending != i )
+         records_[pending] = records_[i];
+      ++pending;
+   }
+
+   records_.resize( pending );
+
+   for( size_t i=0UL; i<records_.size(); ++i )
+   {
+      const Record& record( records_[i] );
+
+      if( record.target_ == &target || source.isAliased( record.target_ ) || record.reads_( &target ) )
+         jobs.push_back( record.job_ );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASYNCHRONOUS ASSIGNMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Asynchronous assignment functions */
+//@{
+template< typename VT1, bool TF, typename VT2 >
+inline SMPFuture asyncAssign( DenseVector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+inline SMPFuture asyncAssign( DenseMatrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates the tasks of an asynchronous assignment to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side vector to be assigned.
+// \param aliased \a true in case the right-hand side vector is aliased with the target.
+// \param tasks The vector the created tasks are added to.
+// \return void
+//
+// This function creates a single task for the assignment in case either of the two vectors
+// is not SMP-assignable.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline typename EnableIf< Or< Not< IsSMPAssignable<VT1> >
+                            , Not< IsSMPAssignable<VT2> > > >::Type
+   asyncAssign_backend( DenseVector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs,
+                        bool aliased, std::vector<threadpool::Task>& tasks )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   tasks.push_back( AsyncAssigner<VT1,VT2>( ~lhs, ~rhs, aliased ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates the tasks of an asynchronous assignment to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side vector to be assigned.
+// \param aliased \a true in case the right-hand side vector is aliased with the target.
+// \param tasks The vector the created tasks are added to.
+// \return void
+//
+// This function collects the tasks of the regular SMP assignment (see the smpAssign_backend()
+// functions) without executing them. In case the right-hand side vector is aliased with the
+// target or is too small for a parallel execution, a single task is created instead.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline typename EnableIf< And< IsSMPAssignable<VT1>
+                             , IsSMPAssignable<VT2> > >::Type
+   asyncAssign_backend( DenseVector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs,
+                        bool aliased, std::vector<threadpool::Task>& tasks )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename VT1::ElementType );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename VT2::ElementType );
+
+   if( aliased || !(~rhs).canSMPAssign() ) {
+      tasks.push_back( AsyncAssigner<VT1,VT2>( ~lhs, ~rhs, aliased ) );
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      TheThreadBackend::defer( &tasks );
+
+      try {
+         smpAssign_backend( ~lhs, ~rhs );
+      }
+      catch( ... ) {
+         TheThreadBackend::defer( NULL );
+         throw;
+      }
+
+      TheThreadBackend::defer( NULL );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a vector to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side vector to be assigned.
+// \return Handle to the asynchronous assignment.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function starts the assignment of the given vector to the given dense vector without
+// waiting for its completion. The tasks of the assignment are the same as for a regular SMP
+// assignment (see the \c BLAZE_PARALLEL_SECTION) and are executed by the threads of the thread
+// backend as soon as all pending asynchronous assignments the assignment depends on have been
+// completed. An assignment depends on a pending assignment in case it reads or writes the
+// target of the pending assignment or in case it writes a vector or matrix that is read by
+// the pending assignment. Independent assignments are executed concurrently. The returned
+// handle allows to wait for the completion of the assignment (see the SMPFuture class).\n
+// Note that the target and all operands of the right-hand side vector have to be kept alive
+// and must not be accessed in any other way than via subsequent asynchronous assignments
+// until the assignment has been completed. Asynchronous assignments may be started by several
+// threads concurrently. However, assignments involving the same vectors or matrices have to be
+// started by the same thread, since the order of assignments started by different threads is
+// not defined. In case the function is called within a serial section, the assignment is
+// performed immediately. In case the sizes of the two given vectors don't match, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , bool TF         // Transpose flag of the vectors
+        , typename VT2 >  // Type of the right-hand side vector
+inline SMPFuture asyncAssign( DenseVector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_EXPRESSION_TYPE( VT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VIEW_TYPE      ( VT1 );
+
+   typedef TheThreadBackend::JobPointer  JobPointer;
+
+   if( (~lhs).size() != (~rhs).size() )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   const bool aliased( (~rhs).canAlias( &~lhs ) );
+
+   if( isSerialSectionActive() || isParallelSectionActive() || TheThreadBackend::isWorkerThread() )
+   {
+      std::vector<JobPointer> predecessors;
+      AsyncTracker<int>::dependencies( ~lhs, ~rhs, predecessors );
+
+      for( size_t i=0UL; i<predecessors.size(); ++i ) {
+         predecessors[i]->wait();
+      }
+
+      AsyncAssigner<VT1,VT2>( ~lhs, ~rhs, aliased )();
+
+      return SMPFuture();
+   }
+
+   std::vector<threadpool::Task> tasks;
+   asyncAssign_backend( ~lhs, ~rhs, aliased, tasks );
+
+   return SMPFuture( AsyncTracker<int>::start( ~lhs, ~rhs, tasks ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates the tasks of an asynchronous assignment to a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \param aliased \a true in case the right-hand side matrix is aliased with the target.
+// \param tasks The vector the created tasks are added to.
+// \return void
+//
+// This function creates a single task for the assignment in case either of the two matrices
+// is not SMP-assignable.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline typename EnableIf< Or< Not< IsSMPAssignable<MT1> >
+                            , Not< IsSMPAssignable<MT2> > > >::Type
+   asyncAssign_backend( DenseMatrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs,
+                        bool aliased, std::vector<threadpool::Task>& tasks )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   tasks.push_back( AsyncAssigner<MT1,MT2>( ~lhs, ~rhs, aliased ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates the tasks of an asynchronous assignment to a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \param aliased \a true in case the right-hand side matrix is aliased with the target.
+// \param tasks The vector the created tasks are added to.
+// \return void
+//
+// This function collects the tasks of the regular SMP assignment (see the smpAssign_backend()
+// functions) without executing them. In case the right-hand side matrix is aliased with the
+// target or is too small for a parallel execution, a single task is created instead.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline typename EnableIf< And< IsSMPAssignable<MT1>
+                             , IsSMPAssignable<MT2> > >::Type
+   asyncAssign_backend( DenseMatrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs,
+                        bool aliased, std::vector<threadpool::Task>& tasks )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename MT1::ElementType );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename MT2::ElementType );
+
+   if( aliased || !(~rhs).canSMPAssign() ) {
+      tasks.push_back( AsyncAssigner<MT1,MT2>( ~lhs, ~rhs, aliased ) );
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      TheThreadBackend::defer( &tasks );
+
+      try {
+         smpAssign_backend( ~lhs, ~rhs );
+      }
+      catch( ... ) {
+         TheThreadBackend::defer( NULL );
+         throw;
+      }
+
+      TheThreadBackend::defer( NULL );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a matrix to a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return Handle to the asynchronous assignment.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function starts the assignment of the given matrix to the given dense matrix without
+// waiting for its completion. The tasks of the assignment are the same as for a regular SMP
+// assignment (see the \c BLAZE_PARALLEL_SECTION) and are executed by the threads of the thread
+// backend as soon as all pending asynchronous assignments the assignment depends on have been
+// completed. An assignment depends on a pending assignment in case it reads or writes the
+// target of the pending assignment or in case it writes a vector or matrix that is read by
+// the pending assignment. Independent assignments are executed concurrently:
+
+   \code
+   // Computing E = ( A + B ) * ( C - D ) with concurrently evaluated factors
+   blaze::SMPFuture f1 = blaze::asyncAssign( T1, A + B );
+   blaze::SMPFuture f2 = blaze::asyncAssign( T2, C - D );
+   blaze::SMPFuture f3 = blaze::asyncAssign( E, T1 * T2 );  // Depends on f1 and f2
+   f3.wait();
+   \endcode
+
+// Note that the target and all operands of the right-hand side matrix have to be kept alive
+// and must not be accessed in any other way than via subsequent asynchronous assignments
+// until the assignment has been completed. Asynchronous assignments may be started by several
+// threads concurrently. However, assignments involving the same vectors or matrices have to be
+// started by the same thread, since the order of assignments started by different threads is
+// not defined. Since each task evaluates its part of the right-hand side expression
+// independently, nested operations that require an evaluation (as for instance the factors
+// of a matrix multiplication) should be assigned to temporaries via separate asynchronous
+// assignments. In case the function is called within a serial section, the assignment is
+// performed immediately. In case the sizes of the two given matrices don't match, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline SMPFuture asyncAssign( DenseMatrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_EXPRESSION_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VIEW_TYPE      ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE   ( MT1 );
+
+   typedef TheThreadBackend::JobPointer  JobPointer;
+
+   if( (~lhs).rows() != (~rhs).rows() || (~lhs).columns() != (~rhs).columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   const bool aliased( (~rhs).canAlias( &~lhs ) );
+
+   if( isSerialSectionActive() || isParallelSectionActive() || TheThreadBackend::isWorkerThread() )
+   {
+      std::vector<JobPointer> predecessors;
+      AsyncTracker<int>::dependencies( ~lhs, ~rhs, predecessors );
+
+      for( size_t i=0UL; i<predecessors.size(); ++i ) {
+         predecessors[i]->wait();
+      }
+
+      AsyncAssigner<MT1,MT2>( ~lhs, ~rhs, aliased )();
+
+      return SMPFuture();
+   }
+
+   std::vector<threadpool::Task> tasks;
+   asyncAssign_backend( ~lhs, ~rhs, aliased, tasks );
+
+   return SMPFuture( AsyncTracker<int>::start( ~lhs, ~rhs, tasks ) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -45,8 +45,8 @@
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/Functions.h>
-#include <blaze/math/intrinsics/IntrinsicTrait.h>
 #include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/Partition.h>
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/smp/threads/ThreadBackend.h>
 #include <blaze/math/SparseSubvector.h>
@@ -101,7 +101,6 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& r
 
    typedef typename VT1::ElementType                         ET1;
    typedef typename VT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename VT1::ElementType>         IT;
    typedef typename SubvectorExprTrait<VT1,aligned>::Type    AlignedTarget;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
@@ -109,36 +108,29 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& r
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t granularity( smpGranularity<ET1>( vectorizable, true ) );
+   const SMPPartition partition( smpPartition( ~rhs, TheThreadBackend::concurrency(), granularity ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<partition.size(); ++i )
    {
-      const size_t index( i*sizePerThread );
-
-      if( index >= (~lhs).size() )
-         continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t index( partition.begin( i ) );
+      const size_t size ( partition.end( i ) - index );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleAssign( target, subvector<aligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleAssign( target, subvector<aligned>( ~rhs, index, size ), i );
       }
       else if( vectorizable && lhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleAssign( target, subvector<unaligned>( ~rhs, index, size ), i );
       }
       else if( vectorizable && rhsAligned ) {
          UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleAssign( target, subvector<aligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleAssign( target, subvector<aligned>( ~rhs, index, size ), i );
       }
       else {
          UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleAssign( target, subvector<unaligned>( ~rhs, index, size ), i );
       }
    }
 
@@ -179,20 +171,15 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>&
    typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
+   const size_t granularity( smpGranularity<ET1>( false, true ) );
+   const SMPPartition partition( smpPartition( ~rhs, TheThreadBackend::concurrency(), granularity ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<partition.size(); ++i )
    {
-      const size_t index( i*sizePerThread );
-
-      if( index >= (~lhs).size() )
-         continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t index( partition.begin( i ) );
+      const size_t size ( partition.end( i ) - index );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
-      TheThreadBackend::scheduleAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+      TheThreadBackend::scheduleAssign( target, subvector<unaligned>( ~rhs, index, size ), i );
    }
 
    TheThreadBackend::wait();
@@ -323,7 +310,6 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
 
    typedef typename VT1::ElementType                         ET1;
    typedef typename VT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename VT1::ElementType>         IT;
    typedef typename SubvectorExprTrait<VT1,aligned>::Type    AlignedTarget;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
@@ -331,36 +317,29 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t granularity( smpGranularity<ET1>( vectorizable, true ) );
+   const SMPPartition partition( smpPartition( ~rhs, TheThreadBackend::concurrency(), granularity ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<partition.size(); ++i )
    {
-      const size_t index( i*sizePerThread );
-
-      if( index >= (~lhs).size() )
-         continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t index( partition.begin( i ) );
+      const size_t size ( partition.end( i ) - index );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleAddAssign( target, subvector<aligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleAddAssign( target, subvector<aligned>( ~rhs, index, size ), i );
       }
       else if( vectorizable && lhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleAddAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleAddAssign( target, subvector<unaligned>( ~rhs, index, size ), i );
       }
       else if( vectorizable && rhsAligned ) {
          UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleAddAssign( target, subvector<aligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleAddAssign( target, subvector<aligned>( ~rhs, index, size ), i );
       }
       else {
          UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleAddAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleAddAssign( target, subvector<unaligned>( ~rhs, index, size ), i );
       }
    }
 
@@ -401,20 +380,15 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
    typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
+   const size_t granularity( smpGranularity<ET1>( false, true ) );
+   const SMPPartition partition( smpPartition( ~rhs, TheThreadBackend::concurrency(), granularity ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<partition.size(); ++i )
    {
-      const size_t index( i*sizePerThread );
-
-      if( index >= (~lhs).size() )
-         continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t index( partition.begin( i ) );
+      const size_t size ( partition.end( i ) - index );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
-      TheThreadBackend::scheduleAddAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+      TheThreadBackend::scheduleAddAssign( target, subvector<unaligned>( ~rhs, index, size ), i );
    }
 
    TheThreadBackend::wait();
@@ -546,7 +520,6 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
 
    typedef typename VT1::ElementType                         ET1;
    typedef typename VT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename VT1::ElementType>         IT;
    typedef typename SubvectorExprTrait<VT1,aligned>::Type    AlignedTarget;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
@@ -554,36 +527,29 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t granularity( smpGranularity<ET1>( vectorizable, true ) );
+   const SMPPartition partition( smpPartition( ~rhs, TheThreadBackend::concurrency(), granularity ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<partition.size(); ++i )
    {
-      const size_t index( i*sizePerThread );
-
-      if( index >= (~lhs).size() )
-         continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t index( partition.begin( i ) );
+      const size_t size ( partition.end( i ) - index );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleSubAssign( target, subvector<aligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleSubAssign( target, subvector<aligned>( ~rhs, index, size ), i );
       }
       else if( vectorizable && lhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleSubAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleSubAssign( target, subvector<unaligned>( ~rhs, index, size ), i );
       }
       else if( vectorizable && rhsAligned ) {
          UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleSubAssign( target, subvector<aligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleSubAssign( target, subvector<aligned>( ~rhs, index, size ), i );
       }
       else {
          UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleSubAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleSubAssign( target, subvector<unaligned>( ~rhs, index, size ), i );
       }
    }
 
@@ -624,20 +590,15 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
    typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
+   const size_t granularity( smpGranularity<ET1>( false, true ) );
+   const SMPPartition partition( smpPartition( ~rhs, TheThreadBackend::concurrency(), granularity ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<partition.size(); ++i )
    {
-      const size_t index( i*sizePerThread );
-
-      if( index >= (~lhs).size() )
-         continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t index( partition.begin( i ) );
+      const size_t size ( partition.end( i ) - index );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
-      TheThreadBackend::scheduleSubAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+      TheThreadBackend::scheduleSubAssign( target, subvector<unaligned>( ~rhs, index, size ), i );
    }
 
    TheThreadBackend::wait();
@@ -770,7 +731,6 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2
 
    typedef typename VT1::ElementType                         ET1;
    typedef typename VT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename VT1::ElementType>         IT;
    typedef typename SubvectorExprTrait<VT1,aligned>::Type    AlignedTarget;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
@@ -778,36 +738,29 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t granularity( smpGranularity<ET1>( vectorizable, true ) );
+   const SMPPartition partition( smpPartition( ~rhs, TheThreadBackend::concurrency(), granularity ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<partition.size(); ++i )
    {
-      const size_t index( i*sizePerThread );
-
-      if( index >= (~lhs).size() )
-         continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t index( partition.begin( i ) );
+      const size_t size ( partition.end( i ) - index );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleMultAssign( target, subvector<aligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleMultAssign( target, subvector<aligned>( ~rhs, index, size ), i );
       }
       else if( vectorizable && lhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleMultAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleMultAssign( target, subvector<unaligned>( ~rhs, index, size ), i );
       }
       else if( vectorizable && rhsAligned ) {
          UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleMultAssign( target, subvector<aligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleMultAssign( target, subvector<aligned>( ~rhs, index, size ), i );
       }
       else {
          UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleMultAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleMultAssign( target, subvector<unaligned>( ~rhs, index, size ), i );
       }
    }
 
@@ -848,20 +801,15 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF
    typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
+   const size_t granularity( smpGranularity<ET1>( false, true ) );
+   const SMPPartition partition( smpPartition( ~rhs, TheThreadBackend::concurrency(), granularity ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<partition.size(); ++i )
    {
-      const size_t index( i*sizePerThread );
-
-      if( index >= (~lhs).size() )
-         continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t index( partition.begin( i ) );
+      const size_t size ( partition.end( i ) - index );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
-      TheThreadBackend::scheduleMultAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+      TheThreadBackend::scheduleMultAssign( target, subvector<unaligned>( ~rhs, index, size ), i );
    }
 
    TheThreadBackend::wait();
@@ -0,0 +1,159 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/FirstTouch.h
+//  \brief Header file for the C++11/Boost thread-based first-touch initialization
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_FIRSTTOUCH_H_
+#define _BLAZE_MATH_SMP_THREADS_FIRSTTOUCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/Partition.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the threaded first-touch initialization of a chunk.
+// \ingroup math
+//
+// The FirstTouchTask functor calls the given range initializer for a single chunk of an
+// SMPPartition.
+*/
+template< typename Initializer >  // Type of the range initializer
+struct FirstTouchTask
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the FirstTouchTask functor.
+   //
+   // \param init The range initializer.
+   // \param begin The first index of the chunk.
+   // \param end The index one past the last index of the chunk.
+   */
+   explicit inline FirstTouchTask( const Initializer& init, size_t begin, size_t end )
+      : init_ ( init  )  // The range initializer
+      , begin_( begin )  // The first index of the chunk
+      , end_  ( end   )  // The index one past the last index of the chunk
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Initializes the chunk.
+   //
+   // \return void
+   */
+   inline void operator()() const {
+      init_( begin_, end_ );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Initializer init_;   //!< The range initializer.
+   size_t      begin_;  //!< The first index of the chunk.
+   size_t      end_;    //!< The index one past the last index of the chunk.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FIRST-TOUCH INITIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief C++11/Boost thread-based implementation of the parallel first-touch initialization.
+// \ingroup math
+//
+// \param n The size of the index range to be initialized.
+// \param granularity The granularity of the chunks of the index range.
+// \param init The initializer for a range of indices.
+// \return void
+//
+// This function initializes the index range \f$ [0..n) \f$ in parallel. The range is split
+// into the same chunks that the smpAssign() functions use for a target of the same size, and
+// the k-th chunk is scheduled on the same thread as the k-th chunk of these assignments. Thus
+// on NUMA systems the memory pages of a newly allocated vector or matrix are placed on the
+// nodes of the threads that will later work on them. Within a serial or parallel section and
+// on the threads of the backend system (e.g. while evaluating an asynchronous assignment) the
+// initializer is called once for the entire range.\n
+// This function must \b NOT be called explicitly! It is used internally by the constructors of
+// the dense vector and matrix types.
+*/
+template< typename Initializer >  // Type of the range initializer
+void smpFirstTouch( size_t n, size_t granularity, const Initializer& init )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( isParallelSectionActive() || isSerialSectionActive() ||
+       TheThreadBackend::concurrency() < 2UL || TheThreadBackend::isWorkerThread() ) {
+      init( 0UL, n );
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      const SMPPartition partition( n, TheThreadBackend::concurrency(), granularity );
+
+      for( size_t i=0UL; i<partition.size(); ++i ) {
+         TheThreadBackend::schedule( FirstTouchTask<Initializer>( init, partition.begin( i ), partition.end( i ) ), i );
+      }
+
+      TheThreadBackend::wait();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
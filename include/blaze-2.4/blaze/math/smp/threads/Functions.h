@@ -86,7 +86,7 @@ BLAZE_ALWAYS_INLINE size_t getNumThreads()
 // Note that the given \a number must be in the range \f$[1..\infty)\f$. In case an invalid
 // number of threads is specified, a \a std::invalid_argument exception is thrown.
 */
-BLAZE_ALWAYS_INLINE size_t setNumThreads( size_t number )
+BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 {
    if( number == 0UL )
       throw std::invalid_argument( "Invalid number of threads" );
@@ -97,6 +97,47 @@ BLAZE_ALWAYS_INLINE size_t setNumThreads( size_t number )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of spin iterations of idle threads.
+// \ingroup smp
+//
+// \return The number of iterations an idle thread spins before it goes to sleep.
+//
+// Via this function the number of iterations an idle thread of the thread parallelization
+// actively polls for new work before it goes to sleep can be queried (see the blaze::smpSpinCount
+// setting and the \c BLAZE_SPIN_COUNT environment variable).
+*/
+BLAZE_ALWAYS_INLINE size_t getSpinCount()
+{
+   return TheThreadBackend::spinCount();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sets the number of spin iterations of idle threads.
+// \ingroup smp
+//
+// \param number The given number of spin iterations (0 disables spinning).
+// \return void
+//
+// Via this function the number of iterations an idle thread of the thread parallelization
+// actively polls for new work before it goes to sleep can be specified. Spinning reduces the
+// latency of parallel operations on small and mid-sized vectors and matrices, but occupies the
+// cores of the spinning threads. Therefore it should only be enabled in case every thread runs
+// on a core of its own.
+*/
+BLAZE_ALWAYS_INLINE void setSpinCount( size_t number )
+{
+   TheThreadBackend::setSpinCount( number );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
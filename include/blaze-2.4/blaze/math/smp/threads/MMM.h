@@ -0,0 +1,364 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/MMM.h
+//  \brief Header file for the C++11/Boost thread-based parallel packed matrix multiplication
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_MMM_H_
+#define _BLAZE_MATH_SMP_THREADS_MMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dense/MMM.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DMatTransExpr.h>
+#include <blaze/math/expressions/DMatTransposer.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/policies/Deallocate.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/UniqueArray.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the threaded packing of a block of the right-hand side operand.
+// \ingroup math
+//
+// The PackRightTask functor packs a range of micro-panels of a \a kc x \a nc block of the
+// right-hand side operand of a matrix multiplication into the shared packing buffer.
+*/
+template< typename MT >  // Type of the right-hand side matrix operand
+struct PackRightTask
+{
+   //**Type definitions****************************************************************************
+   typedef typename MT::ElementType  ET;  //!< Element type of the right-hand side operand.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the PackRightTask class template.
+   //
+   // \param B The right-hand side multiplication operand.
+   // \param Bp Pointer to the first element of the shared packed block.
+   // \param kk The index of the first row of the block.
+   // \param kb The number of rows of the block.
+   // \param jj The index of the first column of the block.
+   // \param jbegin The first column to be packed, relative to \a jj (multiple of \a nr).
+   // \param jend The column one past the last column to be packed, relative to \a jj.
+   */
+   explicit inline PackRightTask( const MT& B, ET* Bp, size_t kk, size_t kb,
+                                  size_t jj, size_t jbegin, size_t jend )
+      : B_     ( &B     )  // The right-hand side multiplication operand
+      , Bp_    ( Bp     )  // The shared packed block
+      , kk_    ( kk     )  // The index of the first row of the block
+      , kb_    ( kb     )  // The number of rows of the block
+      , jj_    ( jj     )  // The index of the first column of the block
+      , jbegin_( jbegin )  // The first column to be packed
+      , jend_  ( jend   )  // The column one past the last column to be packed
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Packs the assigned range of micro-panels.
+   //
+   // \return void
+   */
+   inline void operator()() {
+      packRightBlock( *B_, Bp_+jbegin_*kb_, kk_, kb_, jj_+jbegin_, jend_-jbegin_ );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const MT* B_;       //!< The right-hand side multiplication operand.
+   ET*       Bp_;      //!< The shared packed block.
+   size_t    kk_;      //!< The index of the first row of the block.
+   size_t    kb_;      //!< The number of rows of the block.
+   size_t    jj_;      //!< The index of the first column of the block.
+   size_t    jbegin_;  //!< The first column to be packed.
+   size_t    jend_;    //!< The column one past the last column to be packed.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the threaded multiplication with a shared packed block.
+// \ingroup math
+//
+// The MMMBlockTask functor multiplies a range of rows of the left-hand side operand with a
+// range of micro-panels of the shared, packed block of the right-hand side operand (see the
+// mmmBlock() function). The blocks of the left-hand side operand are packed into the private
+// packing buffer of the task.
+*/
+template< typename MT1    // Type of the target dense matrix
+        , typename MT2 >  // Type of the left-hand side matrix operand
+struct MMMBlockTask
+{
+   //**Type definitions****************************************************************************
+   typedef typename MT1::ElementType  ET;  //!< Element type of the target matrix.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the MMMBlockTask class template.
+   //
+   // \param C The target row-major dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param Ap Pointer to the private packing buffer for blocks of \a A.
+   // \param Bp Pointer to the shared packed block of \a B.
+   // \param ibegin The index of the first row to be computed.
+   // \param iend The index one past the last row to be computed.
+   // \param jj The column index of the first column of the packed block of \a B.
+   // \param jbegin The first column to be computed, relative to \a jj (multiple of \a nr).
+   // \param jend The column one past the last column to be computed, relative to \a jj.
+   // \param kk The index of the first row of the packed block of \a B.
+   // \param kb The number of rows of the packed block of \a B.
+   // \param alpha The scaling factor for \f$ A*B \f$.
+   // \param beta The scaling factor for \f$ C \f$.
+   */
+   explicit inline MMMBlockTask( MT1& C, const MT2& A, ET* Ap, const ET* Bp,
+                                 size_t ibegin, size_t iend, size_t jj, size_t jbegin,
+                                 size_t jend, size_t kk, size_t kb, ET alpha, ET beta )
+      : C_     ( &C     )  // The target row-major dense matrix
+      , A_     ( &A     )  // The left-hand side multiplication operand
+      , Ap_    ( Ap     )  // The private packing buffer
+      , Bp_    ( Bp     )  // The shared packed block
+      , ibegin_( ibegin )  // The index of the first row to be computed
+      , iend_  ( iend   )  // The index one past the last row to be computed
+      , jj_    ( jj     )  // The column index of the first column of the packed block
+      , jbegin_( jbegin )  // The first column to be computed
+      , jend_  ( jend   )  // The column one past the last column to be computed
+      , kk_    ( kk     )  // The index of the first row of the packed block
+      , kb_    ( kb     )  // The number of rows of the packed block
+      , alpha_ ( alpha  )  // The scaling factor for A*B
+      , beta_  ( beta   )  // The scaling factor for C
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the assigned part of the target matrix.
+   //
+   // \return void
+   */
+   inline void operator()() {
+      mmmBlock( *C_, *A_, Ap_, Bp_, ibegin_, iend_, jj_, jbegin_, jend_, kk_, kb_, alpha_, beta_ );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   MT1*       C_;       //!< The target row-major dense matrix.
+   const MT2* A_;       //!< The left-hand side multiplication operand.
+   ET*        Ap_;      //!< The private packing buffer.
+   const ET*  Bp_;      //!< The shared packed block.
+   size_t     ibegin_;  //!< The index of the first row to be computed.
+   size_t     iend_;    //!< The index one past the last row to be computed.
+   size_t     jj_;      //!< The column index of the first column of the packed block.
+   size_t     jbegin_;  //!< The first column to be computed.
+   size_t     jend_;    //!< The column one past the last column to be computed.
+   size_t     kk_;      //!< The index of the first row of the packed block.
+   size_t     kb_;      //!< The number of rows of the packed block.
+   ET         alpha_;   //!< The scaling factor for A*B.
+   ET         beta_;    //!< The scaling factor for C.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PARALLEL PACKED MATRIX MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief C++11/Boost thread-based parallel packed matrix multiplication
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup math
+//
+// \param C The target row-major dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function implements the cooperative, thread-based variant of the packed matrix
+// multiplication (see the mmm() function). In contrast to a partitioning of \a C into
+// independent stripes, all threads share a single packed \a kc x \a nc block of \a B: The
+// micro-panels of the block are packed concurrently by all threads, afterwards the threads
+// are arranged in a 2D grid (see the mmmPartition() function) and each thread multiplies its
+// range of rows of \a A with its range of micro-panels of the shared block. Thus \a B is read
+// from memory once per multiplication instead of once per thread.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the target dense matrix
+        , typename MT2  // Type of the left-hand side matrix operand
+        , typename MT3  // Type of the right-hand side matrix operand
+        , typename ST > // Type of the scaling factors
+void smpMmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef typename MT1::ElementType  ET;
+   typedef MMMTrait<ET>               MMMT;
+
+   BLAZE_INTERNAL_ASSERT( (~C).rows()    == A.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~C).columns() == B.columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( A.columns()    == B.rows()   , "Invalid matrix sizes"      );
+
+   const size_t M( A.rows()    );
+   const size_t N( B.columns() );
+   const size_t K( A.columns() );
+
+   const size_t threads( TheThreadBackend::concurrency() );
+
+   if( threads == 1UL || M == 0UL || N == 0UL || K == 0UL ) {
+      mmm( ~C, A, B, alpha, beta );
+      return;
+   }
+
+   const size_t MR( MMMT::mr );
+   const size_t NR( MMMT::nr );
+
+   const size_t mc( min( MMMT::mc(), ( ( M + MR - 1UL ) / MR ) * MR ) );
+   const size_t kc( min( MMMT::kc(), K ) );
+   const size_t nc( min( MMMT::nc(), ( ( N + NR - 1UL ) / NR ) * NR ) );
+
+   UniqueArray<ET,Deallocate> Ap( allocate<ET>( threads*mc*kc ) );
+   UniqueArray<ET,Deallocate> Bp( allocate<ET>( kc*nc ) );
+
+   for( size_t jj=0UL; jj<N; jj+=nc )
+   {
+      const size_t nb( min( nc, N-jj ) );
+      const size_t panels( ( nb + NR - 1UL ) / NR );
+
+      size_t rows( 0UL ), columns( 0UL );
+      mmmPartition<ET>( threads, M, nb, rows, columns );
+
+      const size_t rowsPerThread  ( ( ( M + rows - 1UL ) / rows + MR - 1UL ) / MR * MR );
+      const size_t panelsPerThread( ( panels + columns - 1UL ) / columns );
+
+      for( size_t kk=0UL; kk<K; kk+=kc )
+      {
+         const size_t kb( min( kc, K-kk ) );
+         const ET factor( kk == 0UL ? ET( beta ) : ET( 1 ) );
+
+         for( size_t t=0UL; t<threads; ++t )
+         {
+            const size_t jbegin( min( nb, ( ( t*panels ) / threads ) * NR ) );
+            const size_t jend  ( min( nb, ( ( (t+1UL)*panels ) / threads ) * NR ) );
+
+            if( jbegin < jend )
+               TheThreadBackend::schedule( PackRightTask<MT3>( B, Bp.get(), kk, kb, jj, jbegin, jend ), t );
+         }
+
+         TheThreadBackend::wait();
+
+         for( size_t t=0UL; t<threads; ++t )
+         {
+            const size_t ibegin( ( t / columns ) * rowsPerThread );
+            const size_t jbegin( ( t % columns ) * panelsPerThread * NR );
+
+            if( ibegin >= M || jbegin >= nb )
+               continue;
+
+            const size_t iend( min( M , ibegin + rowsPerThread      ) );
+            const size_t jend( min( nb, jbegin + panelsPerThread*NR ) );
+
+            TheThreadBackend::schedule( MMMBlockTask<MT1,MT2>( ~C, A, Ap.get()+t*mc*kc, Bp.get(),
+                                                               ibegin, iend, jj, jbegin, jend,
+                                                               kk, kb, ET( alpha ), factor ), t );
+         }
+
+         TheThreadBackend::wait();
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief C++11/Boost thread-based parallel packed matrix multiplication
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup math
+//
+// \param C The target column-major dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function computes the multiplication for a column-major target matrix as the transpose
+// multiplication \f$ C^T=\alpha*B^T*A^T+\beta*C^T \f$ into the row-major view on \a C.
+*/
+template< typename MT1  // Type of the target dense matrix
+        , typename MT2  // Type of the left-hand side matrix operand
+        , typename MT3  // Type of the right-hand side matrix operand
+        , typename ST > // Type of the scaling factors
+void smpMmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   DMatTransposer<MT1,false> tmp( ~C );
+   smpMmm( tmp, trans( B ), trans( A ), alpha, beta );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
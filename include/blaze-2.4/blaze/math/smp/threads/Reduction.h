@@ -0,0 +1,176 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/Reduction.h
+//  \brief Header file for the C++11/Boost thread-based reductions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_REDUCTION_H_
+#define _BLAZE_MATH_SMP_THREADS_REDUCTION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/Partition.h>
+#include <blaze/math/smp/ReductionTree.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the threaded evaluation of a range of reduction blocks.
+// \ingroup smp
+//
+// The ReductionTask functor computes the partial results of a consecutive range of blocks of
+// an SMPReductionTree by means of the given reduction kernel.
+*/
+template< typename Kernel >  // Type of the reduction kernel
+struct ReductionTask
+{
+   //**Type definitions****************************************************************************
+   typedef typename Kernel::ResultType  ResultType;  //!< Result type of the reduction.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the ReductionTask functor.
+   //
+   // \param kernel The reduction kernel.
+   // \param tree The partial results of the reduction.
+   // \param first The index of the first block.
+   // \param last The index one past the last block.
+   */
+   explicit inline ReductionTask( const Kernel& kernel, SMPReductionTree<ResultType>& tree,
+                                  size_t first, size_t last )
+      : kernel_( &kernel )  // The reduction kernel
+      , tree_  ( &tree   )  // The partial results of the reduction
+      , first_ ( first   )  // The index of the first block
+      , last_  ( last    )  // The index one past the last block
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the partial results of the blocks.
+   //
+   // \return void
+   */
+   inline void operator()() const {
+      for( size_t b=first_; b<last_; ++b ) {
+         (*tree_)[b] = (*kernel_)( tree_->begin( b ), tree_->end( b ) );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const Kernel*                 kernel_;  //!< The reduction kernel.
+   SMPReductionTree<ResultType>* tree_;    //!< The partial results of the reduction.
+   size_t                        first_;   //!< The index of the first block.
+   size_t                        last_;    //!< The index one past the last block.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief C++11/Boost thread-based implementation of the parallel reduction.
+// \ingroup smp
+//
+// \param n The size of the index range \f$[1..\infty)\f$.
+// \param kernel The reduction kernel.
+// \return The result of the reduction.
+//
+// This function computes the reduction of the index range \f$ [0..n) \f$ by means of the given
+// kernel (see the reduce() function). The blocks of the reduction are distributed among the
+// threads of the backend system and their partial results are combined in a fixed order by the
+// calling thread. Therefore the result does not depend on the number of threads. In case the
+// range is smaller than the blaze::SMP_DVECREDUCTION_THRESHOLD or consists of a single block,
+// within a serial or parallel section, and on the threads of the backend system, the reduction
+// is evaluated in serial.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reductions.
+*/
+template< typename Kernel >  // Type of the reduction kernel
+const typename Kernel::ResultType smpReduce( size_t n, const Kernel& kernel )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef typename Kernel::ResultType  RT;
+
+   if( n < SMP_DVECREDUCTION_THRESHOLD || n <= smpReductionBlockSize ||
+       isParallelSectionActive() || isSerialSectionActive() ||
+       TheThreadBackend::concurrency() < 2UL || TheThreadBackend::isWorkerThread() ) {
+      return reduce( n, kernel );
+   }
+
+   SMPReductionTree<RT> tree( n );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      const SMPPartition partition( tree.blocks(), TheThreadBackend::concurrency(), 1UL );
+
+      for( size_t i=0UL; i<partition.size(); ++i ) {
+         TheThreadBackend::schedule( ReductionTask<Kernel>( kernel, tree, partition.begin( i ), partition.end( i ) ), i );
+      }
+
+      TheThreadBackend::wait();
+   }
+
+   return tree.result();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,480 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/SparseMatrix.h
+//  \brief Header file for the C++11/Boost thread-based sparse matrix SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_SPARSEMATRIX_H_
+#define _BLAZE_MATH_SMP_THREADS_SPARSEMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/constraints/SMPAssignable.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/Partition.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/SparseSubmatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/Not.h>
+#include <blaze/util/mpl/Or.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the threaded evaluation of a block of a sparse matrix.
+// \ingroup math
+//
+// The SparseEvaluateTask functor evaluates a range of rows (for row-major matrices) or columns
+// (for column-major matrices) of a sparse matrix into a separate, block-local sparse matrix.
+*/
+template< typename MT1    // Type of the block-local sparse matrix
+        , typename MT2 >  // Type of the sparse matrix to be evaluated
+struct SparseEvaluateTask
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SparseEvaluateTask class template.
+   //
+   // \param block The block-local sparse matrix.
+   // \param sm The sparse matrix to be evaluated.
+   // \param begin The index of the first row/column of the block.
+   // \param end The index one past the last row/column of the block.
+   */
+   explicit inline SparseEvaluateTask( MT1& block, const MT2& sm, size_t begin, size_t end )
+      : block_( &block )  // The block-local sparse matrix
+      , sm_   ( &sm    )  // The sparse matrix to be evaluated
+      , begin_( begin  )  // The index of the first row/column of the block
+      , end_  ( end    )  // The index one past the last row/column of the block
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Evaluates the assigned block.
+   //
+   // \return void
+   */
+   inline void operator()() {
+      if( IsRowMajorMatrix<MT1>::value )
+         evaluate( submatrix<unaligned>( *sm_, begin_, 0UL, end_-begin_, sm_->columns() ) );
+      else
+         evaluate( submatrix<unaligned>( *sm_, 0UL, begin_, sm_->rows(), end_-begin_ ) );
+   }
+   //**********************************************************************************************
+
+   //**Evaluate function***************************************************************************
+   /*!\brief Serial evaluation of the given block of the sparse matrix.
+   //
+   // \param sm The block of the sparse matrix.
+   // \return void
+   */
+   template< typename MT >  // Type of the block of the sparse matrix
+   inline void evaluate( const MT& sm ) {
+      block_->resize( sm.rows(), sm.columns(), false );
+      block_->reserve( sm.nonZeros() );
+      assign( *block_, sm );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   MT1*       block_;  //!< The block-local sparse matrix.
+   const MT2* sm_;     //!< The sparse matrix to be evaluated.
+   size_t     begin_;  //!< The index of the first row/column of the block.
+   size_t     end_;    //!< The index one past the last row/column of the block.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the threaded copy of a block into a compressed matrix.
+// \ingroup math
+//
+// The SparseAppendTask functor appends the elements of a block-local sparse matrix to the
+// corresponding rows (for row-major matrices) or columns (for column-major matrices) of the
+// target compressed matrix. The capacities of these rows/columns have to be reserved in advance
+// via the CompressedMatrix::reserve() function.
+*/
+template< typename MT >  // Type of the compressed matrix
+struct SparseAppendTask
+{
+   //**Type definitions****************************************************************************
+   typedef typename MT::ConstIterator  ConstIterator;  //!< Iterator over the elements of the block.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SparseAppendTask class template.
+   //
+   // \param lhs The target compressed matrix.
+   // \param block The block-local sparse matrix.
+   // \param begin The index of the first row/column of the block.
+   */
+   explicit inline SparseAppendTask( MT& lhs, const MT& block, size_t begin )
+      : lhs_  ( &lhs   )  // The target compressed matrix
+      , block_( &block )  // The block-local sparse matrix
+      , begin_( begin  )  // The index of the first row/column of the block
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Appends the elements of the assigned block.
+   //
+   // \return void
+   */
+   inline void operator()() {
+      const size_t n( ( IsRowMajorMatrix<MT>::value )?( block_->rows() ):( block_->columns() ) );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         const ConstIterator end( block_->end(i) );
+         for( ConstIterator element=block_->begin(i); element!=end; ++element ) {
+            if( IsRowMajorMatrix<MT>::value )
+               lhs_->append( begin_+i, element->index(), element->value() );
+            else
+               lhs_->append( element->index(), begin_+i, element->value() );
+         }
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   MT*       lhs_;    //!< The target compressed matrix.
+   const MT* block_;  //!< The block-local sparse matrix.
+   size_t    begin_;  //!< The index of the first row/column of the block.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PLAIN ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a matrix to a sparse matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function is the default backend of the C++11/Boost thread-based SMP assignment of a matrix to
+// a sparse matrix. Since the non-zero elements of an arbitrary sparse matrix cannot be set
+// concurrently, the assignment is performed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+void smpAssign_backend( SparseMatrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   assign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a sparse matrix to a compressed matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side compressed matrix.
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP assignment of a
+// sparse matrix with the same storage order to a compressed matrix. The assignment is performed
+// in two parallel phases: First, the chunks of rows (for row-major matrices) or columns (for
+// column-major matrices) are evaluated into chunk-local compressed matrices, which determines
+// the number of non-zero elements of each row/column of the result. Second, after reserving
+// the exact capacity of each row/column of the target matrix, the chunks are copied to their
+// final position.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the left-hand side compressed matrix
+        , bool SO        // Storage order of both matrices
+        , typename MT >  // Type of the right-hand side sparse matrix
+void smpAssign_backend( CompressedMatrix<Type,SO>& lhs, const SparseMatrix<MT,SO>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef CompressedMatrix<Type,SO>  Block;
+
+   const SMPPartition partition( smpPartition( ~rhs, TheThreadBackend::concurrency(), 1UL ) );
+
+   std::vector<Block> blocks( partition.size() );
+
+   for( size_t i=0UL; i<partition.size(); ++i ) {
+      TheThreadBackend::schedule( SparseEvaluateTask<Block,MT>( blocks[i], ~rhs, partition.begin( i ), partition.end( i ) ), i );
+   }
+
+   TheThreadBackend::wait();
+
+   std::vector<size_t> nonzeros( ( SO == rowMajor )?( lhs.rows() ):( lhs.columns() ) );
+
+   for( size_t i=0UL; i<partition.size(); ++i ) {
+      for( size_t j=partition.begin( i ); j<partition.end( i ); ++j )
+         nonzeros[j] = blocks[i].nonZeros( j-partition.begin( i ) );
+   }
+
+   lhs.reserve( nonzeros );
+
+   for( size_t i=0UL; i<partition.size(); ++i ) {
+      TheThreadBackend::schedule( SparseAppendTask<Block>( lhs, blocks[i], partition.begin( i ) ), i );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP assignment to a sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function implements the default C++11/Boost thread-based SMP assignment to a sparse matrix.
+// Due to the explicit application of the SFINAE principle, this function can only be selected
+// by the compiler in case either of the two operands is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline typename EnableIf< And< IsSparseMatrix<MT1>
+                             , Or< Not< IsSMPAssignable<MT1> >
+                                 , Not< IsSMPAssignable<MT2> > > > >::Type
+   smpAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   assign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP assignment to a sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function implements the C++11/Boost thread-based SMP assignment to a sparse matrix. Due to the
+// explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case both operands are SMP-assignable and the element types of both operands are
+// not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline typename EnableIf< And< IsSparseMatrix<MT1>
+                             , IsSMPAssignable<MT1>
+                             , IsSMPAssignable<MT2> > >::Type
+   smpAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename MT1::ElementType );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( typename MT2::ElementType );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         assign( ~lhs, ~rhs );
+      }
+      else {
+         smpAssign_backend( ~lhs, ~rhs );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDITION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP addition assignment to a sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be added.
+// \return void
+//
+// This function implements the C++11/Boost thread-based SMP addition assignment to a sparse matrix. Since the
+// addition of a matrix can change the sparsity pattern of any row or column of the target
+// matrix, the addition assignment is performed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline typename EnableIf< IsSparseMatrix<MT1> >::Type
+   smpAddAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   addAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRACTION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP subtraction assignment to a sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be subtracted.
+// \return void
+//
+// This function implements the C++11/Boost thread-based SMP subtraction assignment to a sparse matrix. Since the
+// subtraction of a matrix can change the sparsity pattern of any row or column of the target
+// matrix, the subtraction assignment is performed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline typename EnableIf< IsSparseMatrix<MT1> >::Type
+   smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   subAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,523 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/TaskGraph.h
+//  \brief Header file for the C++11/Boost thread-based task graph
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_TASKGRAPH_H_
+#define _BLAZE_MATH_SMP_THREADS_TASKGRAPH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <boost/shared_ptr.hpp>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/AsyncAssign.h>
+#include <blaze/math/smp/threads/DenseMatrix.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/math/typetraits/IsAdaptor.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/threadpool/Task.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveCV.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  TASK GRAPH TYPE TRAITS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the evaluation of a matrix operand within a task graph.
+// \ingroup smp
+//
+// In case the given matrix operand requires an intermediate evaluation and can be evaluated
+// into a resizable dense matrix, the nested \a value is set to 1, otherwise it is 0.
+*/
+template< typename MT >  // Type of the matrix operand
+struct IsTaskGraphTemporary
+{
+   //**********************************************************************************************
+   typedef typename MT::ResultType  RT;
+
+   enum { value = ( IsComputation<MT>::value || RequiresEvaluation<MT>::value ) &&
+                  IsDenseMatrix<RT>::value && IsResizable<RT>::value && !IsAdaptor<RT>::value };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the splitting of a matrix expression within a task graph.
+// \ingroup smp
+//
+// In case the given matrix expression is a dense matrix/dense matrix multiplication whose
+// operands either require an intermediate evaluation into a temporary or can be used directly,
+// and at least one of the operands is evaluated into a temporary, the nested \a value is set
+// to 1, otherwise it is 0.
+*/
+template< typename MT                             // Type of the matrix expression
+        , bool = IsMatMatMultExpr<MT>::value >  // Flag for matrix/matrix multiplications
+struct IsTaskGraphSplittable
+{
+   //**********************************************************************************************
+   enum { value = 0 };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IsTaskGraphSplittable class template for matrix/matrix
+//        multiplications.
+// \ingroup smp
+*/
+template< typename MT >  // Type of the matrix/matrix multiplication expression
+struct IsTaskGraphSplittable<MT,true>
+{
+   //**********************************************************************************************
+   typedef typename RemoveCV< typename RemoveReference< typename MT::LeftOperand  >::Type >::Type  MT1;
+   typedef typename RemoveCV< typename RemoveReference< typename MT::RightOperand >::Type >::Type  MT2;
+
+   enum { evaluateLeft  = IsTaskGraphTemporary<MT1>::value };
+   enum { evaluateRight = IsTaskGraphTemporary<MT2>::value };
+
+   enum { directLeft  = !IsComputation<MT1>::value && !RequiresEvaluation<MT1>::value };
+   enum { directRight = !IsComputation<MT2>::value && !RequiresEvaluation<MT2>::value };
+
+   enum { value = IsDenseMatrix<MT1>::value && IsDenseMatrix<MT2>::value &&
+                  ( evaluateLeft  || evaluateRight ) &&
+                  ( evaluateLeft  || directLeft    ) &&
+                  ( evaluateRight || directRight   ) };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Graph of jobs for the concurrent evaluation of independent subexpressions.
+// \ingroup smp
+//
+// The TaskGraph class lowers the assignment of dense matrix expressions into a graph of jobs
+// of the thread backend (see the ThreadBackend::launch() function). A dense matrix/dense matrix
+// multiplication whose operands require an intermediate evaluation is split into one job per
+// evaluated operand and a job for the multiplication, which only starts after the operand jobs
+// have been completed. All other assignments form a single job consisting of the tasks of the
+// regular SMP assignment. Therefore independent subexpressions are evaluated concurrently and
+// the calling thread only joins once, after all jobs have been completed (see the wait()
+// function). The intermediate results are owned by the task graph.\n
+// This class must \b NOT be used explicitly! It is reserved for internal use only.
+*/
+class TaskGraph : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef TheThreadBackend::JobPointer  JobPointer;  //!< Shared handle to an asynchronous job.
+   typedef boost::shared_ptr<void>       Temporary;   //!< Handle to an intermediate result.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline TaskGraph();
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~TaskGraph();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   inline void assign( DenseMatrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+
+   inline void wait();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Lowering functions**************************************************************************
+   /*!\name Lowering functions */
+   //@{
+   template< typename MT1, bool SO1, typename MT2 >
+   inline typename DisableIf< IsTaskGraphSplittable<MT2>, JobPointer >::Type
+      lower( DenseMatrix<MT1,SO1>& lhs, const MT2& rhs );
+
+   template< typename MT1, bool SO1, typename MT2 >
+   inline typename EnableIf< IsTaskGraphSplittable<MT2>, JobPointer >::Type
+      lower( DenseMatrix<MT1,SO1>& lhs, const MT2& rhs );
+
+   template< typename MT1, bool SO1, typename MT2 >
+   inline JobPointer launch( DenseMatrix<MT1,SO1>& lhs, const MT2& rhs,
+                             const std::vector<JobPointer>& predecessors );
+
+   template< typename MT >
+   inline typename EnableIf< IsTaskGraphTemporary<MT>, const typename MT::ResultType& >::Type
+      operand( const MT& dm, std::vector<JobPointer>& predecessors );
+
+   template< typename MT >
+   inline typename DisableIf< IsTaskGraphTemporary<MT>, const MT& >::Type
+      operand( const MT& dm, std::vector<JobPointer>& predecessors );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::vector<JobPointer> jobs_;         //!< The launched jobs.
+   std::vector<Temporary>  temporaries_;  //!< The intermediate results.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for TaskGraph.
+*/
+inline TaskGraph::TaskGraph()
+   : jobs_       ()  // The launched jobs
+   , temporaries_()  // The intermediate results
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for TaskGraph.
+//
+// The destructor waits for the completion of all launched jobs before the intermediate results
+// are destroyed.
+*/
+inline TaskGraph::~TaskGraph()
+{
+   wait();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Adds the assignment of a matrix to a dense matrix to the task graph.
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// The assignment is started immediately. The target and all operands of the right-hand side
+// matrix have to be kept alive until the completion of the assignment (see the wait() function).
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline void TaskGraph::assign( DenseMatrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   jobs_.push_back( lower( ~lhs, ~rhs ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waits for the completion of all assignments of the task graph.
+//
+// \return void
+*/
+inline void TaskGraph::wait()
+{
+   for( size_t i=0UL; i<jobs_.size(); ++i ) {
+      jobs_[i]->wait();
+   }
+
+   jobs_.clear();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOWERING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Lowers the assignment of a matrix into a single job.
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return The job performing the assignment.
+*/
+template< typename MT1    // Type of the left-hand side dense matrix
+        , bool SO1        // Storage order of the left-hand side dense matrix
+        , typename MT2 >  // Type of the right-hand side matrix
+inline typename DisableIf< IsTaskGraphSplittable<MT2>, TaskGraph::JobPointer >::Type
+   TaskGraph::lower( DenseMatrix<MT1,SO1>& lhs, const MT2& rhs )
+{
+   return launch( ~lhs, rhs, std::vector<JobPointer>() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Lowers the assignment of a dense matrix/dense matrix multiplication.
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side multiplication to be assigned.
+// \return The job performing the multiplication.
+//
+// The operands of the multiplication that require an intermediate evaluation are lowered into
+// separate jobs (see the operand() function), on which the job of the multiplication depends.
+*/
+template< typename MT1    // Type of the left-hand side dense matrix
+        , bool SO1        // Storage order of the left-hand side dense matrix
+        , typename MT2 >  // Type of the right-hand side multiplication
+inline typename EnableIf< IsTaskGraphSplittable<MT2>, TaskGraph::JobPointer >::Type
+   TaskGraph::lower( DenseMatrix<MT1,SO1>& lhs, const MT2& rhs )
+{
+   std::vector<JobPointer> predecessors;
+
+   return launch( ~lhs, operand( rhs.leftOperand() , predecessors ) *
+                        operand( rhs.rightOperand(), predecessors ), predecessors );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Launches the job for the assignment of a matrix.
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \param predecessors The jobs that have to be completed before the assignment.
+// \return The job performing the assignment.
+//
+// The job consists of the tasks of the regular SMP assignment (see the asyncAssign_backend()
+// functions).
+*/
+template< typename MT1    // Type of the left-hand side dense matrix
+        , bool SO1        // Storage order of the left-hand side dense matrix
+        , typename MT2 >  // Type of the right-hand side matrix
+inline TaskGraph::JobPointer
+   TaskGraph::launch( DenseMatrix<MT1,SO1>& lhs, const MT2& rhs,
+                      const std::vector<JobPointer>& predecessors )
+{
+   std::vector<threadpool::Task> tasks;
+   asyncAssign_backend( ~lhs, rhs, rhs.canAlias( &~lhs ), tasks );
+
+   return TheThreadBackend::launch( tasks, predecessors );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Lowers the evaluation of a matrix operand into a temporary.
+//
+// \param dm The matrix operand to be evaluated.
+// \param predecessors The vector the job of the evaluation is added to.
+// \return Reference to the temporary holding the evaluated operand.
+*/
+template< typename MT >  // Type of the matrix operand
+inline typename EnableIf< IsTaskGraphTemporary<MT>, const typename MT::ResultType& >::Type
+   TaskGraph::operand( const MT& dm, std::vector<JobPointer>& predecessors )
+{
+   typedef typename MT::ResultType  RT;
+
+   const boost::shared_ptr<RT> tmp( new RT( dm.rows(), dm.columns() ) );
+   temporaries_.push_back( tmp );
+
+   predecessors.push_back( lower( *tmp, dm ) );
+
+   return *tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a matrix operand that is used directly.
+//
+// \param dm The matrix operand.
+// \param predecessors The jobs the multiplication depends on (unused).
+// \return Reference to the given matrix operand.
+*/
+template< typename MT >  // Type of the matrix operand
+inline typename DisableIf< IsTaskGraphTemporary<MT>, const MT& >::Type
+   TaskGraph::operand( const MT& dm, std::vector<JobPointer>& predecessors )
+{
+   UNUSED_PARAMETER( predecessors );
+
+   return dm;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SMP concurrent assignment functions */
+//@{
+template< typename MT1, bool SO1, typename MT2, bool SO2
+        , typename MT3, bool SO3, typename MT4, bool SO4 >
+inline void smpConcurrentAssign( DenseMatrix<MT1,SO1>& lhs1, const Matrix<MT2,SO2>& rhs1,
+                                 DenseMatrix<MT3,SO3>& lhs2, const Matrix<MT4,SO4>& rhs2 );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP assignment of two independent
+//        matrices.
+// \ingroup smp
+//
+// \param lhs1 The first target left-hand side dense matrix.
+// \param rhs1 The right-hand side matrix to be assigned to the first target.
+// \param lhs2 The second target left-hand side dense matrix.
+// \param rhs2 The right-hand side matrix to be assigned to the second target.
+// \return void
+//
+// This function evaluates two independent assignments concurrently by means of a task graph
+// (see the TaskGraph class). Nested multiplications of the two right-hand side matrices are
+// split into separate jobs as well, such that all independent subexpressions are evaluated
+// concurrently, and the calling thread joins only once. In case the function is called within
+// a serial section, within a parallel section, or by a thread of the backend system, the two
+// assignments are performed one after the other.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename MT1  // Type of the first left-hand side dense matrix
+        , bool SO1      // Storage order of the first left-hand side dense matrix
+        , typename MT2  // Type of the first right-hand side matrix
+        , bool SO2      // Storage order of the first right-hand side matrix
+        , typename MT3  // Type of the second left-hand side dense matrix
+        , bool SO3      // Storage order of the second left-hand side dense matrix
+        , typename MT4  // Type of the second right-hand side matrix
+        , bool SO4 >    // Storage order of the second right-hand side matrix
+inline void smpConcurrentAssign( DenseMatrix<MT1,SO1>& lhs1, const Matrix<MT2,SO2>& rhs1,
+                                 DenseMatrix<MT3,SO3>& lhs2, const Matrix<MT4,SO4>& rhs2 )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs1).rows()    == (~rhs1).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs1).columns() == (~rhs1).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( (~lhs2).rows()    == (~rhs2).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs2).columns() == (~rhs2).columns(), "Invalid number of columns" );
+
+   if( isSerialSectionActive() || isParallelSectionActive() || TheThreadBackend::isWorkerThread() ) {
+      smpAssign( ~lhs1, ~rhs1 );
+      smpAssign( ~lhs2, ~rhs2 );
+      return;
+   }
+
+   TaskGraph graph;
+   graph.assign( ~lhs1, ~rhs1 );
+   graph.assign( ~lhs2, ~rhs2 );
+   graph.wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
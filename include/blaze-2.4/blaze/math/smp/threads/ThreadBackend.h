@@ -48,16 +48,34 @@
 #  include <boost/thread/condition.hpp>
 #  include <boost/thread/mutex.hpp>
 #  include <boost/thread/thread.hpp>
+#  include <boost/thread/tss.hpp>
+#endif
+
+#if BLAZE_COROUTINES_PARALLEL_MODE
+#  include <coroutine>
+#  include <exception>
+#  include <blaze/util/threadpool/Coroutine.h>
 #endif
 
 #include <cstdlib>
+#include <stdexcept>
+#include <vector>
+#include <boost/atomic.hpp>
+#include <boost/exception_ptr.hpp>
+#include <boost/shared_ptr.hpp>
 #include <blaze/math/constraints/Expression.h>
 #include <blaze/math/Functions.h>
+#include <blaze/math/smp/ThreadBudget.h>
 #include <blaze/system/SMP.h>
+#include <blaze/system/ThreadLocal.h>
 #include <blaze/util/constraints/Const.h>
+#include <blaze/util/NonCopyable.h>
 #include <blaze/util/StaticAssert.h>
-#include <blaze/util/ThreadPool.h>
+#include <blaze/util/threadpool/Backoff.h>
+#include <blaze/util/threadpool/Task.h>
+#include <blaze/util/ThreadAffinity.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/WorkStealingPool.h>
 
 
 namespace blaze {
@@ -75,7 +93,22 @@ namespace blaze {
 //
 // The ThreadBackend class template represents the backend system for the C++11 and Boost
 // thread-based parallelization. It provides the functionality to manage a pool of active
-// threads and to schedule (compound) assignment tasks for execution.\n
+// threads and to schedule (compound) assignment tasks for execution. The tasks are executed
+// by a work-stealing thread pool (see the WorkStealingPool class template). Tasks that are
+// scheduled for a particular thread are collected until the next call of the wait() function
+// and are then executed as a single fork/join job of the thread pool (see the run() function
+// of the WorkStealingPool class template), which avoids the scheduling overhead per task.
+// Additionally, groups of tasks can be executed asynchronously as jobs (see the launch()
+// function), whose tasks are only scheduled after all predecessor jobs have been completed.
+// The collected tasks are managed separately for every calling thread. Therefore several
+// threads of an application can use the backend system concurrently. In case the number of
+// threads of a calling thread is restricted (see the ThreadBudget class), its tasks are not
+// executed as fork/join job of the thread pool, but as a job of their own, such that the
+// threads of the pool are shared among all calling threads (see the concurrency() function).
+// In case the coroutine-based execution is activated (see the \c BLAZE_USE_COROUTINES switch
+// in <tt><blaze/config/SMP.h></tt>), the tasks collected for a fork/join job are stored in the
+// frames of suspended coroutines, which are recycled by the calling thread, and coroutines can
+// await the completion of jobs without blocking their thread (see the Job class).\n
 // This class must \b NOT be used explicitly! It is reserved for internal use only. Using
 // this class explicitly might result in erroneous results and/or in undefined behavior.
 */
@@ -86,12 +119,163 @@ template< typename TT    // Type of the encapsulated thread
 class ThreadBackend
 {
  public:
+   //**Type definitions****************************************************************************
+   typedef MT  Mutex;  //!< Type of a synchronization mutex.
+   typedef LT  Lock;   //!< Type of a locking object.
+   //**********************************************************************************************
+
+   //**Class Job***********************************************************************************
+   /*!\brief Group of tasks that is executed asynchronously by the thread backend system.
+   //
+   // A job represents a group of tasks that is executed asynchronously by the threads of the
+   // backend system (see the launch() function). The completion of all tasks of a job can be
+   // queried via the isReady() function and awaited via the wait() function. In case of the
+   // coroutine-based execution, a coroutine can additionally be suspended until the completion
+   // of the job via the suspend() function. The first exception thrown by any of the tasks is
+   // stored and rethrown by the rethrow() function after the completion of the job.
+   */
+   class Job : private NonCopyable
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef boost::shared_ptr<Job>  Pointer;  //!< Shared handle to a job.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Job class.
+      //
+      // \param tasks The tasks of the job (the given vector is emptied).
+      */
+      explicit inline Job( std::vector<threadpool::Task>& tasks )
+         : tasks_       ()              // The tasks of the job
+         , remaining_   ( tasks.size() )  // The number of uncompleted tasks
+         , predecessors_( 1UL )         // The number of uncompleted predecessor jobs
+         , done_        ( false )       // Completion flag of the job
+         , error_       ()              // The first exception thrown by any of the tasks
+         , successors_  ()              // The jobs waiting for the completion of this job
+#if BLAZE_COROUTINES_PARALLEL_MODE
+         , suspended_   ()              // The coroutines waiting for the completion of this job
+#endif
+         , mutex_       ()              // Synchronization mutex
+         , completion_  ()              // Wait condition for the completion of the job
+      {
+         tasks_.swap( tasks );
+      }
+      //*******************************************************************************************
+
+      //**Get functions****************************************************************************
+      /*!\brief Returns whether all tasks of the job have been completed.
+      //
+      // \return \a true if the job has been completed, \a false if not.
+      */
+      inline bool isReady() const {
+         return done_.load( boost::memory_order_acquire );
+      }
+      //*******************************************************************************************
+
+      //**Utility functions************************************************************************
+      /*!\brief Waits for the completion of all tasks of the job.
+      //
+      // \return void
+      //
+      // The calling thread spins for the configured number of iterations (see setSpinCount())
+      // before it goes to sleep.
+      */
+      inline void wait() {
+         const size_t spin( spinCount() );
+
+         for( size_t i=0UL; i<spin; ++i ) {
+            if( isReady() ) return;
+            threadpool::backoff( i );
+         }
+
+         Lock lock( mutex_ );
+         while( !isReady() ) {
+            completion_.wait( lock );
+         }
+      }
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Rethrows the first exception thrown by any of the tasks of the completed job.
+      //
+      // \return void
+      // \exception ... The first exception thrown by any of the tasks.
+      //
+      // This function must only be called after the completion of the job (see the isReady()
+      // and wait() functions). In case none of the tasks has thrown, the function returns.
+      */
+      inline void rethrow() const {
+         if( error_ )
+            boost::rethrow_exception( error_ );
+      }
+      //*******************************************************************************************
+
+#if BLAZE_COROUTINES_PARALLEL_MODE
+      //*******************************************************************************************
+      /*!\brief Suspends the given coroutine until the completion of all tasks of the job.
+      //
+      // \param handle The handle of the coroutine to be suspended.
+      // \return \a true if the coroutine remains suspended, \a false if the job is already completed.
+      //
+      // The coroutine is resumed by the thread completing the last task of the job.
+      */
+      inline bool suspend( std::coroutine_handle<> handle ) {
+         Lock lock( mutex_ );
+         if( isReady() ) return false;
+         suspended_.push_back( handle );
+         return true;
+      }
+      //*******************************************************************************************
+#endif
+
+    private:
+      //**Member variables*************************************************************************
+      std::vector<threadpool::Task> tasks_;         //!< The tasks of the job.
+      boost::atomic<size_t>         remaining_;     //!< The number of uncompleted tasks.
+      boost::atomic<size_t>         predecessors_;  //!< The number of uncompleted predecessor jobs.
+                                                    /*!< The count is increased by one while the
+                                                         job is being set up. */
+      boost::atomic<bool>           done_;          //!< Completion flag of the job.
+      boost::exception_ptr          error_;         //!< The first exception thrown by any of the tasks.
+      std::vector<Pointer>          successors_;    //!< The jobs waiting for the completion of this job.
+#if BLAZE_COROUTINES_PARALLEL_MODE
+      std::vector< std::coroutine_handle<> > suspended_;  //!< The coroutines waiting for the completion of this job.
+#endif
+      MT                            mutex_;         //!< Synchronization mutex.
+      CT                            completion_;    //!< Wait condition for the completion of the job.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      friend class ThreadBackend;
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef typename Job::Pointer  JobPointer;  //!< Shared handle to an asynchronously executed job.
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
-   static inline size_t size  ();
-   static inline void   resize( size_t n, bool block=false );
-   static inline void   wait  ();
+   static inline size_t size          ();
+   static inline size_t concurrency   ();
+   static inline void   resize        ( size_t n, bool block=false );
+   static inline size_t spinCount     ();
+   static inline void   setSpinCount  ( size_t n );
+   static inline bool   isWorkerThread();
+   static inline void   wait          ();
+   //@}
+   //**********************************************************************************************
+
+   //**Asynchronous execution functions************************************************************
+   /*!\name Asynchronous execution functions */
+   //@{
+   static inline void defer( std::vector<threadpool::Task>* tasks );
+
+   static JobPointer launch( std::vector<threadpool::Task>& tasks,
+                             const std::vector<JobPointer>& predecessors );
    //@}
    //**********************************************************************************************
 
@@ -99,16 +283,22 @@ class ThreadBackend
    /*!\name Thread execution functions */
    //@{
    template< typename Target, typename Source >
-   static inline void scheduleAssign( Target& target, const Source& source );
+   static inline void scheduleAssign( Target& target, const Source& source, size_t index );
 
    template< typename Target, typename Source >
-   static inline void scheduleAddAssign( Target& target, const Source& source );
+   static inline void scheduleAddAssign( Target& target, const Source& source, size_t index );
 
    template< typename Target, typename Source >
-   static inline void scheduleSubAssign( Target& target, const Source& source );
+   static inline void scheduleSubAssign( Target& target, const Source& source, size_t index );
 
    template< typename Target, typename Source >
-   static inline void scheduleMultAssign( Target& target, const Source& source );
+   static inline void scheduleMultAssign( Target& target, const Source& source, size_t index );
+
+   template< typename Callable >
+   static inline void schedule( Callable func );
+
+   template< typename Callable >
+   static inline void schedule( Callable func, size_t index );
    //@}
    //**********************************************************************************************
 
@@ -277,22 +467,129 @@ class ThreadBackend
    };
    //**********************************************************************************************
 
+   //**Private class BatchExecutor*****************************************************************
+   /*!\brief Auxiliary functor for the execution of the collected tasks as fork/join job.
+   */
+   struct BatchExecutor
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the BatchExecutor functor.
+      //
+      // \param batch The collected tasks.
+      */
+      explicit inline BatchExecutor( const std::vector<threadpool::Task>& batch )
+         : batch_( &batch )  // The collected tasks
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Executes the task with the given index.
+      //
+      // \param index The index of the task.
+      // \return void
+      */
+      inline void operator()( size_t index ) const {
+         if( (*batch_)[index] )
+            (*batch_)[index]();
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      const std::vector<threadpool::Task>* batch_;  //!< The collected tasks.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private class JobExecutor*******************************************************************
+   /*!\brief Auxiliary functor for the execution of a single task of an asynchronous job.
+   */
+   struct JobExecutor
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the JobExecutor functor.
+      //
+      // \param job The job the task belongs to.
+      // \param index The index of the task within the job.
+      */
+      explicit inline JobExecutor( const JobPointer& job, size_t index )
+         : job_  ( job   )  // The job the task belongs to
+         , index_( index )  // The index of the task within the job
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Executes the task.
+      //
+      // \return void
+      */
+      inline void operator()() const {
+         execute( job_, index_ );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      JobPointer job_;    //!< The job the task belongs to.
+      size_t     index_;  //!< The index of the task within the job.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Scheduling functions************************************************************************
+   /*!\name Scheduling functions */
+   //@{
+   template< typename Callable >
+   static inline void collect( Callable func, size_t index );
+
+   static inline std::vector<threadpool::Task>& batch();
+   static void share( std::vector<threadpool::Task>& batch );
+
+#if BLAZE_COROUTINES_PARALLEL_MODE
+   static inline std::vector<threadpool::Coroutine>& frames();
+   static void finish();
+#endif
+   //@}
+   //**********************************************************************************************
+
+   //**Job functions*******************************************************************************
+   /*!\name Job functions */
+   //@{
+   static void start   ( const JobPointer& job );
+   static void execute ( const JobPointer& job, size_t index );
+   static void complete( const JobPointer& job );
+   static void release ( const JobPointer& job );
+   //@}
+   //**********************************************************************************************
+
    //**Initialization functions********************************************************************
    /*!\name Initialization functions */
    //@{
-   static inline size_t initPool();
+   static inline size_t              initPool();
+   static inline std::vector<size_t> initAffinity();
+   static inline size_t              initSpin();
    //@}
    //**********************************************************************************************
 
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static ThreadPool<TT,MT,LT,CT> threadpool_;  //!< The pool of active threads of the backend system.
-                                                /*!< It is initialized with the number of threads
-                                                     specified via the environment variable
-                                                     \c BLAZE_NUM_THREADS. However, it can be
-                                                     explicitly resized to arbitrary numbers of
-                                                     threads. */
+   static WorkStealingPool<TT,MT,LT,CT> threadpool_;  //!< The pool of active threads of the backend system.
+                                                      /*!< It is initialized with the number of threads
+                                                           specified via the environment variable
+                                                           \c BLAZE_NUM_THREADS. However, it can be
+                                                           explicitly resized to arbitrary numbers of
+                                                           threads. The tasks are distributed to the
+                                                           threads via work stealing. The threads are
+                                                           bound to the CPUs selected by the environment
+                                                           variable \c BLAZE_THREAD_AFFINITY. */
+
+   static BLAZE_THREAD_LOCAL std::vector<threadpool::Task>* deferred_;  //!< The tasks collected for an asynchronous job.
+                                                                       /*!< In case the pointer is not \c NULL,
+                                                                            all tasks scheduled by the calling
+                                                                            thread are added to the given vector
+                                                                            instead of being executed (see the
+                                                                            defer() function). */
+
+   static BLAZE_THREAD_LOCAL bool scheduled_;  //!< Flag for tasks scheduled outside of the fork/join job.
    //@}
    //**********************************************************************************************
 };
@@ -311,7 +608,23 @@ class ThreadBackend
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename TT, typename MT, typename LT, typename CT >
-ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
+WorkStealingPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool(), initAffinity(), initSpin() );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename TT, typename MT, typename LT, typename CT >
+BLAZE_THREAD_LOCAL std::vector<threadpool::Task>* ThreadBackend<TT,MT,LT,CT>::deferred_ = NULL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename TT, typename MT, typename LT, typename CT >
+BLAZE_THREAD_LOCAL bool ThreadBackend<TT,MT,LT,CT>::scheduled_ = false;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -342,6 +655,28 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::size()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of threads available to the calling thread.
+//
+// \return The number of threads available to the calling thread.
+//
+// This function returns the number of threads the parallel operations of the calling thread
+// should be split into. In case no thread budget is active for the calling thread (see the
+// ThreadBudget class), it corresponds to the total number of threads of the backend system.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t ThreadBackend<TT,MT,LT,CT>::concurrency()
+{
+   return getThreadBudget( threadpool_.size() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Changes the total number of threads managed by the thread backend system.
@@ -370,13 +705,79 @@ inline void ThreadBackend<TT,MT,LT,CT>::resize( size_t n, bool block )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of spin iterations of idle threads.
+//
+// \return The number of spin iterations before an idle thread goes to sleep.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t ThreadBackend<TT,MT,LT,CT>::spinCount()
+{
+   return threadpool_.spinCount();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Changes the number of spin iterations of idle threads.
+//
+// \param n The new number of spin iterations (0 disables spinning).
+// \return void
+//
+// This function changes the number of iterations an idle thread of the thread backend system
+// actively polls for new work before it goes to sleep (see the blaze::smpSpinCount setting).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadBackend<TT,MT,LT,CT>::setSpinCount( size_t n )
+{
+   threadpool_.setSpinCount( n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the calling thread is a thread of the thread backend system.
+//
+// \return \a true if the calling thread belongs to the backend system, \a false if not.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline bool ThreadBackend<TT,MT,LT,CT>::isWorkerThread()
+{
+   return threadpool_.isWorker();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Waiting for all scheduled tasks to be completed.
 //
 // \return void
 //
-// This function blocks until all scheduled tasks have been completed.
+// This function blocks until all scheduled tasks have been completed. The tasks that have been
+// scheduled for particular threads since the last call are executed as a single fork/join job
+// (see the WorkStealingPool::run() function), in which the calling thread participates. In
+// case the number of threads of the calling thread is restricted, the tasks are executed as a
+// separate job instead (see the share() function). Jobs that are executed asynchronously (see
+// the launch() function) are only waited for in case tasks have been scheduled outside of the
+// fork/join job. In case the scheduled tasks are deferred (see the defer() function), the
+// function returns immediately. In case of the coroutine-based execution, the first exception
+// thrown by any of the tasks is rethrown after all tasks have been completed.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -384,7 +785,27 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline void ThreadBackend<TT,MT,LT,CT>::wait()
 {
-   threadpool_.wait();
+   if( deferred_ != NULL )
+      return;
+
+   std::vector<threadpool::Task>& tasks( batch() );
+
+   if( !tasks.empty() ) {
+      if( concurrency() < threadpool_.size() )
+         share( tasks );
+      else
+         threadpool_.run( tasks.size(), BatchExecutor( tasks ) );
+      tasks.clear();
+   }
+
+   if( scheduled_ ) {
+      threadpool_.wait();
+      scheduled_ = false;
+   }
+
+#if BLAZE_COROUTINES_PARALLEL_MODE
+   finish();
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -404,9 +825,12 @@ inline void ThreadBackend<TT,MT,LT,CT>::wait()
 //
 // \param target The target operand to be assigned to.
 // \param source The target operand to be assigned to the target.
+// \param index The index of the preferred thread (taken modulo the number of threads).
 // \return void
 //
-// This function schedules a plain assignment of the two given operands for execution.
+// This function schedules a plain assignment of the two given operands for execution by the thread
+// with the given index. The assignment is executed by the next call of the wait() function,
+// preferably by this thread, but might be taken over by another thread in order to balance the load.
 */
 template< typename TT        // Type of the encapsulated thread
         , typename MT        // Type of the synchronization mutex
@@ -414,10 +838,10 @@ template< typename TT        // Type of the encapsulated thread
         , typename CT >      // Type of the condition variable
 template< typename Target    // Type of the target operand
         , typename Source >  // Type of the source operand
-inline void ThreadBackend<TT,MT,LT,CT>::scheduleAssign( Target& target, const Source& source )
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleAssign( Target& target, const Source& source, size_t index )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( Assigner<Target,Source>( target, source ) );
+   collect( Assigner<Target,Source>( target, source ), index );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -429,9 +853,12 @@ inline void ThreadBackend<TT,MT,LT,CT>::scheduleAssign( Target& target, const So
 //
 // \param target The target operand to be assigned to.
 // \param source The target operand to be added to the target.
+// \param index The index of the preferred thread (taken modulo the number of threads).
 // \return void
 //
-// This function schedules an addition assignment of the two given operands for execution.
+// This function schedules an addition assignment of the two given operands for execution by the thread
+// with the given index. The addition assignment is executed by the next call of the wait() function,
+// preferably by this thread, but might be taken over by another thread in order to balance the load.
 */
 template< typename TT        // Type of the encapsulated thread
         , typename MT        // Type of the synchronization mutex
@@ -439,10 +866,10 @@ template< typename TT        // Type of the encapsulated thread
         , typename CT >      // Type of the condition variable
 template< typename Target    // Type of the target operand
         , typename Source >  // Type of the source operand
-inline void ThreadBackend<TT,MT,LT,CT>::scheduleAddAssign( Target& target, const Source& source )
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleAddAssign( Target& target, const Source& source, size_t index )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( AddAssigner<Target,Source>( target, source ) );
+   collect( AddAssigner<Target,Source>( target, source ), index );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -454,9 +881,12 @@ inline void ThreadBackend<TT,MT,LT,CT>::scheduleAddAssign( Target& target, const
 //
 // \param target The target operand to be assigned to.
 // \param source The target operand to be subtracted from the target.
+// \param index The index of the preferred thread (taken modulo the number of threads).
 // \return void
 //
-// This function schedules a subtraction assignment of the two given operands for execution.
+// This function schedules a subtraction assignment of the two given operands for execution by the thread
+// with the given index. The subtraction assignment is executed by the next call of the wait() function,
+// preferably by this thread, but might be taken over by another thread in order to balance the load.
 */
 template< typename TT        // Type of the encapsulated thread
         , typename MT        // Type of the synchronization mutex
@@ -464,10 +894,10 @@ template< typename TT        // Type of the encapsulated thread
         , typename CT >      // Type of the condition variable
 template< typename Target    // Type of the target operand
         , typename Source >  // Type of the source operand
-inline void ThreadBackend<TT,MT,LT,CT>::scheduleSubAssign( Target& target, const Source& source )
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleSubAssign( Target& target, const Source& source, size_t index )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( SubAssigner<Target,Source>( target, source ) );
+   collect( SubAssigner<Target,Source>( target, source ), index );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -479,9 +909,12 @@ inline void ThreadBackend<TT,MT,LT,CT>::scheduleSubAssign( Target& target, const
 //
 // \param target The target operand to be assigned to.
 // \param source The target operand to be multiplied with the target.
+// \param index The index of the preferred thread (taken modulo the number of threads).
 // \return void
 //
-// This function schedules a multiplication assignment of the two given operands for execution.
+// This function schedules a multiplication assignment of the two given operands for execution by the thread
+// with the given index. The multiplication assignment is executed by the next call of the wait() function,
+// preferably by this thread, but might be taken over by another thread in order to balance the load.
 */
 template< typename TT        // Type of the encapsulated thread
         , typename MT        // Type of the synchronization mutex
@@ -489,10 +922,459 @@ template< typename TT        // Type of the encapsulated thread
         , typename CT >      // Type of the condition variable
 template< typename Target    // Type of the target operand
         , typename Source >  // Type of the source operand
-inline void ThreadBackend<TT,MT,LT,CT>::scheduleMultAssign( Target& target, const Source& source )
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleMultAssign( Target& target, const Source& source, size_t index )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( MultAssigner<Target,Source>( target, source ) );
+   collect( MultAssigner<Target,Source>( target, source ), index );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling the given function/functor for execution.
+//
+// \param func The given function/functor.
+// \return void
+//
+// This function schedules the given function/functor for execution. The given function/functor
+// must be copyable, must be callable without arguments and must return void. It is used by
+// computational kernels that coordinate several threads themselves (as for instance the parallel
+// packed matrix multiplication).
+*/
+template< typename TT          // Type of the encapsulated thread
+        , typename MT          // Type of the synchronization mutex
+        , typename LT          // Type of the mutex lock
+        , typename CT >        // Type of the condition variable
+template< typename Callable >  // Type of the function/functor
+inline void ThreadBackend<TT,MT,LT,CT>::schedule( Callable func )
+{
+   if( deferred_ != NULL ) {
+      deferred_->push_back( func );
+   }
+   else {
+      threadpool_.schedule( func );
+      scheduled_ = true;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling the given function/functor for execution by a particular thread.
+//
+// \param func The given function/functor.
+// \param index The index of the preferred thread (taken modulo the number of threads).
+// \return void
+//
+// This function schedules the given function/functor for execution by the thread with the
+// given index. The given function/functor must be copyable, must be callable without arguments
+// and must return void. It is executed by the next call of the wait() function.
+*/
+template< typename TT          // Type of the encapsulated thread
+        , typename MT          // Type of the synchronization mutex
+        , typename LT          // Type of the mutex lock
+        , typename CT >        // Type of the condition variable
+template< typename Callable >  // Type of the function/functor
+inline void ThreadBackend<TT,MT,LT,CT>::schedule( Callable func, size_t index )
+{
+   collect( func, index );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Collects the given function/functor for the next fork/join job.
+//
+// \param func The given function/functor.
+// \param index The index of the preferred thread.
+// \return void
+//
+// This function stores the given function/functor at the given index of the fork/join job that
+// is executed by the next call of the wait() function. In case another task has already been
+// collected for the given index, the function/functor is scheduled for the according thread
+// of the thread pool instead. In case the scheduled tasks are deferred (see the defer()
+// function), the function/functor is added to the tasks of the asynchronous job. In case of
+// the coroutine-based execution, the function/functor is stored in the frame of a suspended
+// coroutine (see the frames() function) and the task only resumes the coroutine.
+*/
+template< typename TT          // Type of the encapsulated thread
+        , typename MT          // Type of the synchronization mutex
+        , typename LT          // Type of the mutex lock
+        , typename CT >        // Type of the condition variable
+template< typename Callable >  // Type of the function/functor
+inline void ThreadBackend<TT,MT,LT,CT>::collect( Callable func, size_t index )
+{
+   if( deferred_ != NULL ) {
+      deferred_->push_back( func );
+      return;
+   }
+
+#if BLAZE_COROUTINES_PARALLEL_MODE
+   std::vector<threadpool::Coroutine>& chunks( frames() );
+   chunks.push_back( threadpool::spawn( func ) );
+   const threadpool::Resumer task( chunks.back().resumer() );
+#else
+   const Callable& task( func );
+#endif
+
+   std::vector<threadpool::Task>& tasks( batch() );
+
+   if( tasks.size() <= index )
+      tasks.resize( index+1UL );
+
+   if( tasks[index] ) {
+      threadpool_.scheduleOn( index, task );
+      scheduled_ = true;
+   }
+   else tasks[index] = task;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the tasks collected by the calling thread for the next fork/join job.
+//
+// \return Reference to the collected tasks of the calling thread.
+//
+// The task scheduled for the thread with index \a i is stored at position \a i.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline std::vector<threadpool::Task>& ThreadBackend<TT,MT,LT,CT>::batch()
+{
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+   static thread_local std::vector<threadpool::Task> tasks;
+   return tasks;
+#else
+   static boost::thread_specific_ptr< std::vector<threadpool::Task> > tasks;
+   if( tasks.get() == NULL )
+      tasks.reset( new std::vector<threadpool::Task>() );
+   return *tasks;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the collected tasks of a calling thread with a restricted number of threads.
+//
+// \param batch The collected tasks.
+// \return void
+//
+// In contrast to a fork/join job of the thread pool, which is executed by all threads of the
+// pool and which blocks all other calling threads until its completion, this function executes
+// the given tasks as a separate job (see the launch() function). Therefore the threads of the
+// pool are shared among all calling threads with a restricted number of threads. The calling
+// thread executes the first task itself and afterwards waits for the completion of the job.
+// The first exception thrown by any of the tasks is rethrown after the completion of the job.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadBackend<TT,MT,LT,CT>::share( std::vector<threadpool::Task>& batch )
+{
+   const BatchExecutor executor( batch );
+
+   std::vector<threadpool::Task> tasks;
+   tasks.reserve( batch.size() );
+
+   for( size_t i=1UL; i<batch.size(); ++i ) {
+      if( batch[i] ) tasks.push_back( batch[i] );
+   }
+
+   if( tasks.empty() ) {
+      executor( 0UL );
+      return;
+   }
+
+   const JobPointer job( launch( tasks, std::vector<JobPointer>() ) );
+
+   try {
+      executor( 0UL );
+   }
+   catch( ... ) {
+      job->wait();
+      throw;
+   }
+
+   job->wait();
+   job->rethrow();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+#if BLAZE_COROUTINES_PARALLEL_MODE
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the coroutines created by the calling thread for the next fork/join job.
+//
+// \return Reference to the coroutines of the calling thread.
+//
+// The coroutines are destroyed by the calling thread after the completion of the fork/join job
+// (see the finish() function), such that their frames can be recycled for the next job.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline std::vector<threadpool::Coroutine>& ThreadBackend<TT,MT,LT,CT>::frames()
+{
+   static thread_local std::vector<threadpool::Coroutine> coroutines;
+   return coroutines;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Destroys the completed coroutines of the calling thread.
+//
+// \return void
+// \exception ... The first exception thrown by any of the tasks.
+//
+// This function destroys all coroutines of the last fork/join job of the calling thread. In
+// case any of their tasks has thrown an exception, the first exception is rethrown.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadBackend<TT,MT,LT,CT>::finish()
+{
+   std::vector<threadpool::Coroutine>& chunks( frames() );
+   std::exception_ptr exception;
+
+   for( size_t i=0UL; i<chunks.size() && !exception; ++i ) {
+      exception = chunks[i].exception();
+   }
+
+   chunks.clear();
+
+   if( exception )
+      std::rethrow_exception( exception );
+}
+/*! \endcond */
+//*************************************************************************************************
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  ASYNCHRONOUS EXECUTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Deferring the execution of all subsequently scheduled tasks.
+//
+// \param tasks The vector collecting the scheduled tasks (\c NULL to stop the deferral).
+// \return void
+//
+// This function redirects all subsequently scheduled tasks to the given vector instead of
+// executing them. Additionally, the wait() function returns immediately. This allows to form
+// an asynchronous job (see the launch() function) from the tasks of a regular SMP assignment.
+// Passing \c NULL restores the regular execution of tasks.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadBackend<TT,MT,LT,CT>::defer( std::vector<threadpool::Task>* tasks )
+{
+   deferred_ = tasks;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Launching an asynchronous job.
+//
+// \param tasks The tasks of the job (the given vector is emptied).
+// \param predecessors The jobs that have to be completed before the tasks are executed.
+// \return Handle to the launched job.
+//
+// This function creates a job from the given tasks and executes it asynchronously. The tasks
+// are scheduled as soon as all given predecessor jobs have been completed, either immediately
+// or by the thread completing the last predecessor job. The calling thread does not block.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+typename ThreadBackend<TT,MT,LT,CT>::JobPointer
+   ThreadBackend<TT,MT,LT,CT>::launch( std::vector<threadpool::Task>& tasks,
+                                       const std::vector<JobPointer>& predecessors )
+{
+   const JobPointer job( new Job( tasks ) );
+
+   for( size_t i=0UL; i<predecessors.size(); ++i )
+   {
+      Job& predecessor( *predecessors[i] );
+      Lock lock( predecessor.mutex_ );
+
+      if( !predecessor.isReady() ) {
+         ++job->predecessors_;
+         predecessor.successors_.push_back( job );
+      }
+   }
+
+   release( job );
+
+   return job;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling all tasks of the given job.
+//
+// \param job The job to be started.
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadBackend<TT,MT,LT,CT>::start( const JobPointer& job )
+{
+   const size_t n( job->tasks_.size() );
+
+   if( n == 0UL ) {
+      complete( job );
+      return;
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      threadpool_.scheduleOn( i, JobExecutor( job, i ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executing a single task of the given job.
+//
+// \param job The job the task belongs to.
+// \param index The index of the task within the job.
+// \return void
+//
+// The thread completing the last task of the job completes the job. In case the task throws
+// an exception, the first exception of the job is stored and the task is nevertheless counted
+// as completed, such that the job is completed and its exception can be rethrown by the thread
+// waiting for the job (see the Job::rethrow() function).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadBackend<TT,MT,LT,CT>::execute( const JobPointer& job, size_t index )
+{
+   try {
+      job->tasks_[index]();
+   }
+   catch( ... ) {
+      Lock lock( job->mutex_ );
+      if( !job->error_ )
+         job->error_ = boost::current_exception();
+   }
+
+   if( --job->remaining_ == 0UL ) {
+      complete( job );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Completing the given job.
+//
+// \param job The completed job.
+// \return void
+//
+// This function marks the given job as completed, wakes up all threads waiting for the job,
+// and releases all jobs waiting for the completion of the job. In case of the coroutine-based
+// execution, the coroutines waiting for the job are resumed by the calling thread afterwards.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadBackend<TT,MT,LT,CT>::complete( const JobPointer& job )
+{
+   std::vector<JobPointer> successors;
+#if BLAZE_COROUTINES_PARALLEL_MODE
+   std::vector< std::coroutine_handle<> > suspended;
+#endif
+
+   {
+      Lock lock( job->mutex_ );
+      job->tasks_.clear();
+      job->done_.store( true, boost::memory_order_release );
+      successors.swap( job->successors_ );
+#if BLAZE_COROUTINES_PARALLEL_MODE
+      suspended.swap( job->suspended_ );
+#endif
+      job->completion_.notify_all();
+   }
+
+   for( size_t i=0UL; i<successors.size(); ++i ) {
+      release( successors[i] );
+   }
+
+#if BLAZE_COROUTINES_PARALLEL_MODE
+   for( size_t i=0UL; i<suspended.size(); ++i ) {
+      suspended[i].resume();
+   }
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Releasing one predecessor of the given job.
+//
+// \param job The job whose predecessor has been completed.
+// \return void
+//
+// In case the last predecessor of the given job has been completed, the job is started.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadBackend<TT,MT,LT,CT>::release( const JobPointer& job )
+{
+   if( --job->predecessors_ == 0UL ) {
+      start( job );
+   }
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -539,6 +1421,85 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::initPool()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the CPUs the threads of the thread pool are bound to.
+//
+// \return The CPU of each thread, or an empty vector in case the threads are not bound.
+//
+// This function determines the binding of the threads based on the \c BLAZE_THREAD_AFFINITY
+// environment variable, which is interpreted by the threadAffinity() function: \c "compact"
+// places the threads on as few NUMA nodes as possible, \c "scatter" distributes them evenly
+// over all NUMA nodes, and an explicit list of CPUs (e.g. \c "0,8,1,9") binds the \a i-th
+// thread to the \a i-th CPU of the list. In case the environment variable is not defined, set
+// to \c "none", or contains an invalid list of CPUs, the threads are not bound.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline std::vector<size_t> ThreadBackend<TT,MT,LT,CT>::initAffinity()
+{
+   const char* env = std::getenv( "BLAZE_THREAD_AFFINITY" );
+
+   if( env == NULL )
+      return std::vector<size_t>();
+
+   try {
+      return threadAffinity( env );
+   }
+   catch( std::invalid_argument& ) {
+      return std::vector<size_t>();
+   }
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the initial number of spin iterations of idle threads.
+//
+// \return The initial number of spin iterations.
+//
+// This function determines the number of iterations an idle thread spins before it goes to
+// sleep based on the \c BLAZE_SPIN_COUNT environment variable. In case the environment variable
+// is not defined, the function returns the blaze::smpSpinCount setting if the calling thread
+// and all threads of the thread pool can run on a hardware thread of their own, and 0 (i.e. no
+// spinning) otherwise.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t ThreadBackend<TT,MT,LT,CT>::initSpin()
+{
+   const char* env = std::getenv( "BLAZE_SPIN_COUNT" );
+
+   if( env != NULL )
+      return max( 0, atoi( env ) );
+   else if( initPool() < TT::hardware_concurrency() )
+      return smpSpinCount;
+   else return 0UL;
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -0,0 +1,2300 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/CompressedBlockMatrix.h
+//  \brief Implementation of a block compressed MxN matrix with dense BxB blocks
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_COMPRESSEDBLOCKMATRIX_H_
+#define _BLAZE_MATH_SPARSE_COMPRESSEDBLOCKMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/SoAIterator.h>
+#include <blaze/math/sparse/SparseElement.h>
+#include <blaze/math/traits/AddTrait.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/DivTrait.h>
+#include <blaze/math/traits/MathTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Limits.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup compressed_block_matrix CompressedBlockMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Block compressed row-major \f$ M \times N \f$ matrix with dense \f$ B \times B \f$ blocks.
+// \ingroup compressed_block_matrix
+//
+// The CompressedBlockMatrix class template is the block variant of the row-major CompressedMatrix
+// (BCSR format). Instead of single elements it stores dense \f$ B \times B \f$ blocks in the form
+// of StaticMatrix instances, each of which is addressed by a single 32-bit block column index:
+
+   \code
+   template< typename Type, size_t B >
+   class CompressedBlockMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. CompressedBlockMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type.
+//  - B   : specifies the number of rows and columns of the dense blocks.
+//
+// Matrices resulting from the discretization of systems of partial differential equations (as
+// for instance in finite element methods with three or six degrees of freedom per node) consist
+// of small dense blocks. For these matrices the block storage requires a single index per block
+// instead of one index per element and the sparse matrix/dense vector multiplication works on
+// contiguous segments of the dense vector by means of small fixed-size matrix/vector products.
+// In order to avoid partial blocks, the number of rows and columns of a CompressedBlockMatrix
+// have to be multiples of the block size \a B.
+//
+// In expressions, CompressedBlockMatrix can be used as a read-only row-major sparse matrix. It
+// provides access to the individual elements of the blocks via the function call operator and
+// via iterators over the rows of the matrix. Note that each element of a non-zero block counts
+// as a non-zero element, even if its value is zero. The blocks themselves are accessed via
+// the block iterators and set up via conversion from any other matrix or via the low-level
+// appendBlock() and finalize() functions:
+
+   \code
+   using blaze::CompressedBlockMatrix;
+   using blaze::CompressedMatrix;
+   using blaze::StaticMatrix;
+   using blaze::DynamicVector;
+
+   CompressedMatrix<double> A( 300UL, 300UL );
+   // ... Initialization of the matrix with a 3x3 block structure
+
+   CompressedBlockMatrix<double,3UL> B( A );  // Conversion into a block compressed matrix
+
+   CompressedBlockMatrix<double,3UL> C( 6UL, 6UL, 3UL );
+   StaticMatrix<double,3UL,3UL> block( 1.0 );
+   C.appendBlock( 0UL, 0UL, block );
+   C.appendBlock( 0UL, 1UL, block );
+   C.finalize( 0UL );
+   C.appendBlock( 1UL, 1UL, block );
+   C.finalize( 1UL );
+
+   DynamicVector<double> x( 300UL, 1.0 ), y;
+   y = B * x;  // Block compressed sparse matrix/dense vector multiplication
+   \endcode
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+class CompressedBlockMatrix : public SparseMatrix< CompressedBlockMatrix<Type,B>, false >
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef StaticMatrix<Type,B,B,rowMajor>  BlockType;  //!< Type of the dense blocks.
+   //**********************************************************************************************
+
+   //**Element class definition********************************************************************
+   /*!\brief Access proxy for a single element of a block compressed matrix.
+   */
+   class BlockElement : private SparseElement
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef Type         ValueType;       //!< The value type of the element.
+      typedef size_t       IndexType;       //!< The index type of the element.
+      typedef const Type&  Reference;       //!< Reference return type.
+      typedef const Type&  ConstReference;  //!< Reference-to-const return type.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the BlockElement class.
+      //
+      // \param value Pointer to the referenced value.
+      // \param index The column index of the referenced value.
+      */
+      inline BlockElement( const Type* value, size_t index )
+         : value_( value )  // Pointer to the referenced value
+         , index_( index )  // The column index of the referenced value
+      {}
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the referenced sparse element.
+      //
+      // \return Pointer to the referenced sparse element.
+      */
+      inline const BlockElement* operator->() const {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline Reference value() const {
+         return *value_;
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      inline IndexType index() const {
+         return index_;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const Type* value_;  //!< Pointer to the referenced value.
+      size_t index_;       //!< The column index of the referenced value.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Iterator class definition*******************************************************************
+   /*!\brief Iterator over the elements of a single row of a block compressed matrix.
+   //
+   // The BlockRowIterator traverses the according row of all non-zero blocks of a block row,
+   // i.e. it visits \a B consecutive elements per block.
+   */
+   class BlockRowIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef std::forward_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef BlockElement               ValueType;         //!< Type of the underlying elements.
+      typedef ValueType                  PointerType;       //!< Pointer return type.
+      typedef ValueType                  ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                  DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Default constructor**********************************************************************
+      /*!\brief Default constructor for the BlockRowIterator class.
+      */
+      inline BlockRowIterator()
+         : block_ ( NULL )  // Pointer to the current block
+         , index_ ( NULL )  // Pointer to the column index of the current block
+         , row_   ( 0UL  )  // The row within the blocks
+         , column_( 0UL  )  // The column within the current block
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the BlockRowIterator class.
+      //
+      // \param block Pointer to the current block.
+      // \param index Pointer to the column index of the current block.
+      // \param row The row within the blocks.
+      // \param column The column within the current block.
+      */
+      inline BlockRowIterator( const BlockType* block, const uint32_t* index, size_t row, size_t column )
+         : block_ ( block  )  // Pointer to the current block
+         , index_ ( index  )  // Pointer to the column index of the current block
+         , row_   ( row    )  // The row within the blocks
+         , column_( column )  // The column within the current block
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline BlockRowIterator& operator++() {
+         if( ++column_ == B ) {
+            column_ = 0UL;
+            ++block_;
+            ++index_;
+         }
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const BlockRowIterator operator++( int ) {
+         const BlockRowIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the current sparse matrix element.
+      //
+      // \return Reference to the current sparse matrix element.
+      */
+      inline ReferenceType operator*() const {
+         return ReferenceType( &(*block_)(row_,column_), (*index_)*B+column_ );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the current sparse matrix element.
+      //
+      // \return Pointer to the current sparse matrix element.
+      */
+      inline PointerType operator->() const {
+         return PointerType( &(*block_)(row_,column_), (*index_)*B+column_ );
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two BlockRowIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const BlockRowIterator& rhs ) const {
+         return ( block_ == rhs.block_ ) && ( column_ == rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two BlockRowIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const BlockRowIterator& rhs ) const {
+         return !( *this == rhs );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const BlockRowIterator& rhs ) const {
+         return ( block_ - rhs.block_ ) * DifferenceType( B ) +
+                ( DifferenceType( column_ ) - DifferenceType( rhs.column_ ) );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const BlockType* block_;  //!< Pointer to the current block.
+      const uint32_t* index_;   //!< Pointer to the column index of the current block.
+      size_t row_;              //!< The row within the blocks.
+      size_t column_;           //!< The column within the current block.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef CompressedBlockMatrix<Type,B>    This;                //!< Type of this CompressedBlockMatrix instance.
+   typedef This                             ResultType;          //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,true>      OppositeType;        //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,true>      TransposeType;       //!< Transpose type for expression template evaluations.
+   typedef Type                             ElementType;         //!< Type of the sparse matrix elements.
+   typedef const Type&                      ReturnType;          //!< Return type for expression template evaluations.
+   typedef const This&                      CompositeType;       //!< Data type for composite expression templates.
+   typedef const Type&                      Reference;           //!< Reference to a sparse matrix value.
+   typedef const Type&                      ConstReference;      //!< Reference to a constant sparse matrix value.
+   typedef BlockRowIterator                 Iterator;            //!< Iterator over non-constant elements.
+   typedef BlockRowIterator                 ConstIterator;       //!< Iterator over constant elements.
+   typedef SoAIterator<BlockType>           BlockIterator;       //!< Iterator over non-constant blocks.
+   typedef SoAIterator<const BlockType>     ConstBlockIterator;  //!< Iterator over constant blocks.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a CompressedBlockMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef CompressedBlockMatrix<ET,B>  Other;  //!< The type of the other CompressedBlockMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). Since the parallel evaluation would split the matrix at arbitrary rows
+       instead of at block rows, block compressed matrices are always evaluated serially. */
+   enum { smpAssignable = 0 };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+                            explicit inline CompressedBlockMatrix();
+                            explicit inline CompressedBlockMatrix( size_t m, size_t n );
+                            explicit inline CompressedBlockMatrix( size_t m, size_t n, size_t nonzeroBlocks );
+                                     inline CompressedBlockMatrix( const CompressedBlockMatrix& sm );
+   template< typename MT, bool SO2 > inline CompressedBlockMatrix( const DenseMatrix<MT,SO2>&  dm );
+   template< typename MT, bool SO2 > inline CompressedBlockMatrix( const SparseMatrix<MT,SO2>& sm );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~CompressedBlockMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference     operator()( size_t i, size_t j ) const;
+   inline ConstIterator      begin ( size_t i ) const;
+   inline ConstIterator      cbegin( size_t i ) const;
+   inline ConstIterator      end   ( size_t i ) const;
+   inline ConstIterator      cend  ( size_t i ) const;
+   inline BlockIterator      blockBegin ( size_t ib );
+   inline ConstBlockIterator blockBegin ( size_t ib ) const;
+   inline ConstBlockIterator cblockBegin( size_t ib ) const;
+   inline BlockIterator      blockEnd   ( size_t ib );
+   inline ConstBlockIterator blockEnd   ( size_t ib ) const;
+   inline ConstBlockIterator cblockEnd  ( size_t ib ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                                     inline CompressedBlockMatrix& operator= ( const CompressedBlockMatrix& rhs );
+   template< typename MT, bool SO2 > inline CompressedBlockMatrix& operator= ( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CompressedBlockMatrix& operator+=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CompressedBlockMatrix& operator-=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CompressedBlockMatrix& operator*=( const Matrix<MT,SO2>& rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, CompressedBlockMatrix >::Type&
+      operator*=( Other rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, CompressedBlockMatrix >::Type&
+      operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                              inline size_t                 rows() const;
+                              inline size_t                 columns() const;
+                              inline size_t                 blockRows() const;
+                              inline size_t                 blockColumns() const;
+                              inline size_t                 capacity() const;
+                              inline size_t                 nonZeros() const;
+                              inline size_t                 nonZeros( size_t i ) const;
+                              inline size_t                 nonZeroBlocks() const;
+                              inline size_t                 nonZeroBlocks( size_t ib ) const;
+                              inline void                   reset();
+                              inline void                   clear();
+                                     void                   reserveBlocks( size_t nonzeroBlocks );
+   template< typename Other > inline CompressedBlockMatrix& scale( const Other& scalar );
+                              inline void                   swap( CompressedBlockMatrix& sm ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator      find      ( size_t i, size_t j ) const;
+   inline ConstIterator      lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator      upperBound( size_t i, size_t j ) const;
+   inline BlockIterator      findBlock ( size_t ib, size_t jb );
+   inline ConstBlockIterator findBlock ( size_t ib, size_t jb ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   inline void appendBlock( size_t ib, size_t jb, const BlockType& block );
+   inline void finalize   ( size_t ib );
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool canSMPAssign() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >
+   inline typename DisableIf< IsExpression<MT> >::Type convert( const SparseMatrix<MT,false>& sm );
+
+   template< typename MT, bool SO2 >
+   inline void convert( const Matrix<MT,SO2>& m );
+
+   template< typename MT >
+   void build( const MT& A );
+
+   inline size_t lowerOffset( size_t ib, size_t jb ) const;
+
+   static inline size_t checkSize( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;           //!< The current number of rows of the sparse matrix.
+   size_t n_;           //!< The current number of columns of the sparse matrix.
+   size_t capacity_;    //!< The current capacity of the block arrays.
+   size_t* offsets_;    //!< Offsets of the first non-zero block of each block row.
+   BlockType* blocks_;  //!< The non-zero blocks.
+   uint32_t* indices_;  //!< The block column indices of the non-zero blocks.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_STATIC_ASSERT( B > 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, size_t B >
+const Type CompressedBlockMatrix<Type,B>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for CompressedBlockMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline CompressedBlockMatrix<Type,B>::CompressedBlockMatrix()
+   : m_       ( 0UL )            // The current number of rows of the sparse matrix
+   , n_       ( 0UL )            // The current number of columns of the sparse matrix
+   , capacity_( 0UL )            // The current capacity of the block arrays
+   , offsets_ ( new size_t[1] )  // Offsets of the first non-zero block of each block row
+   , blocks_  ( NULL )           // The non-zero blocks
+   , indices_ ( NULL )           // The block column indices of the non-zero blocks
+{
+   offsets_[0] = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Invalid matrix size.
+//
+// The matrix is initialized to the zero matrix and has no free capacity. In case the number of
+// rows or columns is not a multiple of the block size, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline CompressedBlockMatrix<Type,B>::CompressedBlockMatrix( size_t m, size_t n )
+   : m_       ( checkSize( m ) )           // The current number of rows of the sparse matrix
+   , n_       ( checkSize( n ) )           // The current number of columns of the sparse matrix
+   , capacity_( 0UL )                      // The current capacity of the block arrays
+   , offsets_ ( new size_t[m_/B+1UL] )     // Offsets of the first non-zero block of each block row
+   , blocks_  ( NULL )                     // The non-zero blocks
+   , indices_ ( NULL )                     // The block column indices of the non-zero blocks
+{
+   std::fill( offsets_, offsets_+m_/B+1UL, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeroBlocks The number of expected non-zero blocks.
+// \exception std::invalid_argument Invalid matrix size.
+//
+// The matrix is initialized to the zero matrix. In case the number of rows or columns is not
+// a multiple of the block size, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline CompressedBlockMatrix<Type,B>::CompressedBlockMatrix( size_t m, size_t n, size_t nonzeroBlocks )
+   : m_       ( checkSize( m ) )                      // The current number of rows of the sparse matrix
+   , n_       ( checkSize( n ) )                      // The current number of columns of the sparse matrix
+   , capacity_( nonzeroBlocks )                       // The current capacity of the block arrays
+   , offsets_ ( new size_t[m_/B+1UL] )                // Offsets of the first non-zero block of each block row
+   , blocks_  ( allocate<BlockType>( capacity_ ) )    // The non-zero blocks
+   , indices_ ( allocate<uint32_t>( capacity_ ) )     // The block column indices of the non-zero blocks
+{
+   std::fill( offsets_, offsets_+m_/B+1UL, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for CompressedBlockMatrix.
+//
+// \param sm Sparse matrix to be copied.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline CompressedBlockMatrix<Type,B>::CompressedBlockMatrix( const CompressedBlockMatrix& sm )
+   : m_       ( sm.m_ )                                  // The current number of rows of the sparse matrix
+   , n_       ( sm.n_ )                                  // The current number of columns of the sparse matrix
+   , capacity_( sm.nonZeroBlocks() )                     // The current capacity of the block arrays
+   , offsets_ ( new size_t[m_/B+1UL] )                   // Offsets of the first non-zero block of each block row
+   , blocks_  ( allocate<BlockType>( capacity_ ) )       // The non-zero blocks
+   , indices_ ( allocate<uint32_t>( capacity_ ) )        // The block column indices of the non-zero blocks
+{
+   std::copy( sm.offsets_, sm.offsets_+m_/B+1UL, offsets_ );
+   std::copy( sm.blocks_ , sm.blocks_ +capacity_, blocks_  );
+   std::copy( sm.indices_, sm.indices_+capacity_, indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from dense matrices.
+//
+// \param dm Dense matrix to be copied.
+// \exception std::invalid_argument Invalid matrix size.
+//
+// All blocks of the given dense matrix that contain at least one non-default element are stored
+// as non-zero blocks. In case the number of rows or columns of the given matrix is not a multiple
+// of the block size, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+template< typename MT    // Type of the foreign dense matrix
+        , bool SO2 >     // Storage order of the foreign dense matrix
+inline CompressedBlockMatrix<Type,B>::CompressedBlockMatrix( const DenseMatrix<MT,SO2>& dm )
+   : m_       ( checkSize( (~dm).rows()    ) )  // The current number of rows of the sparse matrix
+   , n_       ( checkSize( (~dm).columns() ) )  // The current number of columns of the sparse matrix
+   , capacity_( 0UL )                           // The current capacity of the block arrays
+   , offsets_ ( new size_t[m_/B+1UL] )          // Offsets of the first non-zero block of each block row
+   , blocks_  ( NULL )                          // The non-zero blocks
+   , indices_ ( NULL )                          // The block column indices of the non-zero blocks
+{
+   std::fill( offsets_, offsets_+m_/B+1UL, 0UL );
+   convert( ~dm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different sparse matrices.
+//
+// \param sm Sparse matrix to be copied.
+// \exception std::invalid_argument Invalid matrix size.
+//
+// All blocks of the given sparse matrix that contain at least one non-zero element are stored
+// as non-zero blocks. In case the number of rows or columns of the given matrix is not a multiple
+// of the block size, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+template< typename MT    // Type of the foreign sparse matrix
+        , bool SO2 >     // Storage order of the foreign sparse matrix
+inline CompressedBlockMatrix<Type,B>::CompressedBlockMatrix( const SparseMatrix<MT,SO2>& sm )
+   : m_       ( checkSize( (~sm).rows()    ) )  // The current number of rows of the sparse matrix
+   , n_       ( checkSize( (~sm).columns() ) )  // The current number of columns of the sparse matrix
+   , capacity_( 0UL )                           // The current capacity of the block arrays
+   , offsets_ ( new size_t[m_/B+1UL] )          // Offsets of the first non-zero block of each block row
+   , blocks_  ( NULL )                          // The non-zero blocks
+   , indices_ ( NULL )                          // The block column indices of the non-zero blocks
+{
+   std::fill( offsets_, offsets_+m_/B+1UL, 0UL );
+   convert( ~sm );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for CompressedBlockMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline CompressedBlockMatrix<Type,B>::~CompressedBlockMatrix()
+{
+   deallocate( blocks_  );
+   deallocate( indices_ );
+   delete [] offsets_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename CompressedBlockMatrix<Type,B>::ConstReference
+   CompressedBlockMatrix<Type,B>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+
+   const size_t pos( lowerOffset( i/B, j/B ) );
+
+   if( pos != offsets_[i/B+1UL] && indices_[pos] == j/B )
+      return blocks_[pos]( i%B, j%B );
+   else return zero_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename CompressedBlockMatrix<Type,B>::ConstIterator
+   CompressedBlockMatrix<Type,B>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   const size_t pos( offsets_[i/B] );
+   return ConstIterator( blocks_+pos, indices_+pos, i%B, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename CompressedBlockMatrix<Type,B>::ConstIterator
+   CompressedBlockMatrix<Type,B>::cbegin( size_t i ) const
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename CompressedBlockMatrix<Type,B>::ConstIterator
+   CompressedBlockMatrix<Type,B>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   const size_t pos( offsets_[i/B+1UL] );
+   return ConstIterator( blocks_+pos, indices_+pos, i%B, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename CompressedBlockMatrix<Type,B>::ConstIterator
+   CompressedBlockMatrix<Type,B>::cend( size_t i ) const
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero block of block row \a ib.
+//
+// \param ib The block row index.
+// \return Iterator to the first non-zero block of block row \a ib.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename CompressedBlockMatrix<Type,B>::BlockIterator
+   CompressedBlockMatrix<Type,B>::blockBegin( size_t ib )
+{
+   BLAZE_USER_ASSERT( ib < m_/B, "Invalid block row access index" );
+   return BlockIterator( blocks_+offsets_[ib], indices_+offsets_[ib] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero block of block row \a ib.
+//
+// \param ib The block row index.
+// \return Iterator to the first non-zero block of block row \a ib.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename CompressedBlockMatrix<Type,B>::ConstBlockIterator
+   CompressedBlockMatrix<Type,B>::blockBegin( size_t ib ) const
+{
+   BLAZE_USER_ASSERT( ib < m_/B, "Invalid block row access index" );
+   return ConstBlockIterator( blocks_+offsets_[ib], indices_+offsets_[ib] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero block of block row \a ib.
+//
+// \param ib The block row index.
+// \return Iterator to the first non-zero block of block row \a ib.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename CompressedBlockMatrix<Type,B>::ConstBlockIterator
+   CompressedBlockMatrix<Type,B>::cblockBegin( size_t ib ) const
+{
+   return blockBegin( ib );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero block of block row \a ib.
+//
+// \param ib The block row index.
+// \return Iterator just past the last non-zero block of block row \a ib.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename CompressedBlockMatrix<Type,B>::BlockIterator
+   CompressedBlockMatrix<Type,B>::blockEnd( size_t ib )
+{
+   BLAZE_USER_ASSERT( ib < m_/B, "Invalid block row access index" );
+   return BlockIterator( blocks_+offsets_[ib+1UL], indices_+offsets_[ib+1UL] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero block of block row \a ib.
+//
+// \param ib The block row index.
+// \return Iterator just past the last non-zero block of block row \a ib.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename CompressedBlockMatrix<Type,B>::ConstBlockIterator
+   CompressedBlockMatrix<Type,B>::blockEnd( size_t ib ) const
+{
+   BLAZE_USER_ASSERT( ib < m_/B, "Invalid block row access index" );
+   return ConstBlockIterator( blocks_+offsets_[ib+1UL], indices_+offsets_[ib+1UL] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero block of block row \a ib.
+//
+// \param ib The block row index.
+// \return Iterator just past the last non-zero block of block row \a ib.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename CompressedBlockMatrix<Type,B>::ConstBlockIterator
+   CompressedBlockMatrix<Type,B>::cblockEnd( size_t ib ) const
+{
+   return blockEnd( ib );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for CompressedBlockMatrix.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+//
+// The sparse matrix is resized according to the given sparse matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline CompressedBlockMatrix<Type,B>&
+   CompressedBlockMatrix<Type,B>::operator=( const CompressedBlockMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   CompressedBlockMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+// \exception std::invalid_argument Invalid matrix size.
+//
+// The sparse matrix is resized according to the given matrix and initialized as a copy of
+// this matrix. In case the number of rows or columns of the given matrix is not a multiple of
+// the block size, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CompressedBlockMatrix<Type,B>&
+   CompressedBlockMatrix<Type,B>::operator=( const Matrix<MT,SO2>& rhs )
+{
+   CompressedBlockMatrix tmp( ~rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CompressedBlockMatrix<Type,B>&
+   CompressedBlockMatrix<Type,B>::operator+=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   CompressedBlockMatrix tmp( *this + (~rhs) );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CompressedBlockMatrix<Type,B>&
+   CompressedBlockMatrix<Type,B>::operator-=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   CompressedBlockMatrix tmp( *this - (~rhs) );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a matrix (\f$ A*=B \f$).
+//
+// \param rhs The right-hand side matrix for the multiplication.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two given matrices don't match, a \a std::invalid_argument
+// is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CompressedBlockMatrix<Type,B>&
+   CompressedBlockMatrix<Type,B>::operator*=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   CompressedBlockMatrix tmp( *this * (~rhs) );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a sparse matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the sparse matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , size_t B >        // Number of rows and columns of the blocks
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, CompressedBlockMatrix<Type,B> >::Type&
+   CompressedBlockMatrix<Type,B>::operator*=( Other rhs )
+{
+   const size_t nonzeros( nonZeroBlocks() );
+   for( size_t k=0UL; k<nonzeros; ++k )
+      blocks_[k] *= rhs;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a sparse matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , size_t B >        // Number of rows and columns of the blocks
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, CompressedBlockMatrix<Type,B> >::Type&
+   CompressedBlockMatrix<Type,B>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   const size_t nonzeros( nonZeroBlocks() );
+   for( size_t k=0UL; k<nonzeros; ++k )
+      blocks_[k] /= rhs;
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline size_t CompressedBlockMatrix<Type,B>::rows() const
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline size_t CompressedBlockMatrix<Type,B>::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of block rows of the sparse matrix.
+//
+// \return The number of block rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline size_t CompressedBlockMatrix<Type,B>::blockRows() const
+{
+   return m_ / B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of block columns of the sparse matrix.
+//
+// \return The number of block columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline size_t CompressedBlockMatrix<Type,B>::blockColumns() const
+{
+   return n_ / B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the sparse matrix.
+//
+// \return The capacity of the sparse matrix in elements.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline size_t CompressedBlockMatrix<Type,B>::capacity() const
+{
+   return capacity_ * B * B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the sparse matrix.
+//
+// \return The number of non-zero elements in the sparse matrix.
+//
+// All elements of the non-zero blocks are counted as non-zero elements.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline size_t CompressedBlockMatrix<Type,B>::nonZeros() const
+{
+   return nonZeroBlocks() * B * B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline size_t CompressedBlockMatrix<Type,B>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+   return nonZeroBlocks( i/B ) * B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero blocks in the sparse matrix.
+//
+// \return The number of non-zero blocks in the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline size_t CompressedBlockMatrix<Type,B>::nonZeroBlocks() const
+{
+   return offsets_[m_/B];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero blocks in the specified block row.
+//
+// \param ib The index of the block row.
+// \return The number of non-zero blocks of block row \a ib.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline size_t CompressedBlockMatrix<Type,B>::nonZeroBlocks( size_t ib ) const
+{
+   BLAZE_USER_ASSERT( ib < m_/B, "Invalid block row access index" );
+   return offsets_[ib+1UL] - offsets_[ib];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function removes all non-zero blocks. Note that the capacity of the matrix remains
+// unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline void CompressedBlockMatrix<Type,B>::reset()
+{
+   std::fill( offsets_, offsets_+m_/B+1UL, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the sparse matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the sparse matrix is 0.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline void CompressedBlockMatrix<Type,B>::clear()
+{
+   offsets_[0UL] = 0UL;
+   m_ = 0UL;
+   n_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the sparse matrix.
+//
+// \param nonzeroBlocks The new minimum capacity of the sparse matrix in blocks.
+// \return void
+//
+// This function increases the capacity of the sparse matrix to at least \a nonzeroBlocks
+// blocks. The current values of the matrix elements are preserved.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+void CompressedBlockMatrix<Type,B>::reserveBlocks( size_t nonzeroBlocks )
+{
+   if( nonzeroBlocks <= capacity_ ) return;
+
+   BlockType* newBlocks ( allocate<BlockType>( nonzeroBlocks ) );
+   uint32_t*  newIndices( allocate<uint32_t>( nonzeroBlocks ) );
+
+   std::copy( blocks_ , blocks_ +capacity_, newBlocks  );
+   std::copy( indices_, indices_+capacity_, newIndices );
+
+   std::swap( newBlocks , blocks_  );
+   std::swap( newIndices, indices_ );
+   deallocate( newBlocks  );
+   deallocate( newIndices );
+   capacity_ = nonzeroBlocks;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the sparse matrix by the scalar value \a scalar (\f$ A=B*s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the sparse matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , size_t B >        // Number of rows and columns of the blocks
+template< typename Other >  // Data type of the scalar value
+inline CompressedBlockMatrix<Type,B>& CompressedBlockMatrix<Type,B>::scale( const Other& scalar )
+{
+   const size_t nonzeros( nonZeroBlocks() );
+   for( size_t k=0UL; k<nonzeros; ++k )
+      blocks_[k] *= scalar;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The sparse matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline void CompressedBlockMatrix<Type,B>::swap( CompressedBlockMatrix& sm ) /* throw() */
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   std::swap( capacity_, sm.capacity_ );
+   std::swap( offsets_, sm.offsets_ );
+   std::swap( blocks_ , sm.blocks_  );
+   std::swap( indices_, sm.indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion of a row-major sparse matrix with direct row access.
+//
+// \param sm The sparse matrix to be converted.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+template< typename MT >  // Type of the foreign sparse matrix
+inline typename DisableIf< IsExpression<MT> >::Type
+   CompressedBlockMatrix<Type,B>::convert( const SparseMatrix<MT,false>& sm )
+{
+   build( ~sm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion of an arbitrary matrix or matrix expression.
+//
+// \param m The matrix to be converted.
+// \return void
+//
+// The given matrix is evaluated into a temporary row-major compressed matrix, which is then
+// converted into the block layout.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+template< typename MT    // Type of the foreign matrix
+        , bool SO2 >     // Storage order of the foreign matrix
+inline void CompressedBlockMatrix<Type,B>::convert( const Matrix<MT,SO2>& m )
+{
+   const CompressedMatrix<Type,false> tmp( serial( ~m ) );
+   build( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting up the blocks of an empty matrix from a row-major sparse matrix.
+//
+// \param A The row-major sparse matrix to be converted.
+// \return void
+//
+// In a first pass, the number of non-zero blocks is determined. In a second pass, the sorted
+// block columns of each block row are collected and the according blocks are filled with the
+// elements of the \a B rows of the block row.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+template< typename MT >  // Type of the foreign sparse matrix
+void CompressedBlockMatrix<Type,B>::build( const MT& A )
+{
+   typedef typename MT::ConstIterator  SourceIterator;
+
+   BLAZE_INTERNAL_ASSERT( A.rows()    == m_, "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( A.columns() == n_, "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( nonZeroBlocks() == 0UL, "Invalid non-zero blocks detected" );
+
+   const size_t mb( m_/B );
+   const size_t nb( n_/B );
+
+   std::vector<size_t> marker( nb, mb );
+   std::vector<size_t> slots ( nb );
+   std::vector<size_t> columns;
+
+   size_t nonzeros( 0UL );
+
+   for( size_t ib=0UL; ib<mb; ++ib ) {
+      for( size_t i=ib*B; i<(ib+1UL)*B; ++i ) {
+         for( SourceIterator element=A.begin(i); element!=A.end(i); ++element ) {
+            const size_t jb( element->index() / B );
+            if( marker[jb] != ib ) {
+               marker[jb] = ib;
+               ++nonzeros;
+            }
+         }
+      }
+   }
+
+   reserveBlocks( nonzeros );
+   std::fill( marker.begin(), marker.end(), mb );
+
+   for( size_t ib=0UL; ib<mb; ++ib )
+   {
+      columns.clear();
+
+      for( size_t i=ib*B; i<(ib+1UL)*B; ++i ) {
+         for( SourceIterator element=A.begin(i); element!=A.end(i); ++element ) {
+            const size_t jb( element->index() / B );
+            if( marker[jb] != ib ) {
+               marker[jb] = ib;
+               columns.push_back( jb );
+            }
+         }
+      }
+
+      std::sort( columns.begin(), columns.end() );
+
+      for( size_t k=0UL; k<columns.size(); ++k ) {
+         const size_t pos( offsets_[ib+1UL]++ );
+         blocks_[pos].reset();
+         indices_[pos] = static_cast<uint32_t>( columns[k] );
+         slots[columns[k]] = pos;
+      }
+
+      for( size_t i=ib*B; i<(ib+1UL)*B; ++i ) {
+         for( SourceIterator element=A.begin(i); element!=A.end(i); ++element ) {
+            const size_t j( element->index() );
+            blocks_[slots[j/B]]( i%B, j%B ) = element->value();
+         }
+      }
+
+      finalize( ib );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the offset of the first block with a block column index not less than \a jb.
+//
+// \param ib The block row index.
+// \param jb The block column index.
+// \return The offset of the first block not less than \a jb.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline size_t CompressedBlockMatrix<Type,B>::lowerOffset( size_t ib, size_t jb ) const
+{
+   const uint32_t* const first( indices_+offsets_[ib] );
+   const uint32_t* const last ( indices_+offsets_[ib+1UL] );
+   return std::lower_bound( first, last, jb ) - indices_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks that the given number of rows or columns is valid for a block compressed matrix.
+//
+// \param n The number of rows or columns of the matrix.
+// \return The given size \a n.
+// \exception std::invalid_argument Invalid matrix size.
+//
+// The size has to be a multiple of the block size and the number of blocks has to be in the
+// range of the 32-bit block column indices.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline size_t CompressedBlockMatrix<Type,B>::checkSize( size_t n )
+{
+   if( n % B != 0UL )
+      throw std::invalid_argument( "Matrix size is not a multiple of the block size" );
+
+   if( n/B > static_cast<size_t>( Limits<uint32_t>::inf() ) + 1UL )
+      throw std::invalid_argument( "Matrix size exceeds the 32-bit index range" );
+
+   return n;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename CompressedBlockMatrix<Type,B>::ConstIterator
+   CompressedBlockMatrix<Type,B>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   if( pos != end( i ) && pos->index() == j )
+      return pos;
+   else return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename CompressedBlockMatrix<Type,B>::ConstIterator
+   CompressedBlockMatrix<Type,B>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+
+   const size_t pos( lowerOffset( i/B, j/B ) );
+
+   if( pos != offsets_[i/B+1UL] && indices_[pos] == j/B )
+      return ConstIterator( blocks_+pos, indices_+pos, i%B, j%B );
+   else return ConstIterator( blocks_+pos, indices_+pos, i%B, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename CompressedBlockMatrix<Type,B>::ConstIterator
+   CompressedBlockMatrix<Type,B>::upperBound( size_t i, size_t j ) const
+{
+   return lowerBound( i, j+1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific block.
+//
+// \param ib The block row index of the search block.
+// \param jb The block column index of the search block.
+// \return Iterator to the block in case it is found, blockEnd() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename CompressedBlockMatrix<Type,B>::BlockIterator
+   CompressedBlockMatrix<Type,B>::findBlock( size_t ib, size_t jb )
+{
+   BLAZE_USER_ASSERT( ib < m_/B, "Invalid block row access index" );
+
+   const size_t pos( lowerOffset( ib, jb ) );
+
+   if( pos != offsets_[ib+1UL] && indices_[pos] == jb )
+      return BlockIterator( blocks_+pos, indices_+pos );
+   else return blockEnd( ib );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific block.
+//
+// \param ib The block row index of the search block.
+// \param jb The block column index of the search block.
+// \return Iterator to the block in case it is found, blockEnd() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline typename CompressedBlockMatrix<Type,B>::ConstBlockIterator
+   CompressedBlockMatrix<Type,B>::findBlock( size_t ib, size_t jb ) const
+{
+   BLAZE_USER_ASSERT( ib < m_/B, "Invalid block row access index" );
+
+   const size_t pos( lowerOffset( ib, jb ) );
+
+   if( pos != offsets_[ib+1UL] && indices_[pos] == jb )
+      return ConstBlockIterator( blocks_+pos, indices_+pos );
+   else return blockEnd( ib );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Appending a block to the specified block row of the sparse matrix.
+//
+// \param ib The block row index of the new block. The index has to be in the range \f$[0..M/B-1]\f$.
+// \param jb The block column index of the new block. The index has to be in the range \f$[0..N/B-1]\f$.
+// \param block The new block.
+// \return void
+//
+// This function provides a very efficient way to fill a block compressed matrix with blocks.
+// It appends a new block to the end of the specified block row without any additional memory
+// allocation. Therefore it is strictly necessary to keep the following preconditions in mind:
+//
+//  - the block column index of the new block must be strictly larger than the largest block
+//    column index of the blocks in the specified block row
+//  - the current number of non-zero blocks in the matrix must be smaller than the capacity
+//    of the matrix
+//  - the block rows have to be filled in order and each block row has to be finalized via
+//    the finalize() function before the next block row is filled
+//
+// Ignoring these preconditions might result in undefined behavior!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline void CompressedBlockMatrix<Type,B>::appendBlock( size_t ib, size_t jb, const BlockType& block )
+{
+   BLAZE_USER_ASSERT( ib < m_/B, "Invalid block row access index" );
+   BLAZE_USER_ASSERT( jb < n_/B, "Invalid block column access index" );
+   BLAZE_USER_ASSERT( offsets_[ib+1UL] < capacity_, "Not enough reserved capacity left" );
+   BLAZE_USER_ASSERT( offsets_[ib] == offsets_[ib+1UL] || jb > indices_[offsets_[ib+1UL]-1UL],
+                      "Index is not strictly increasing" );
+
+   const size_t pos( offsets_[ib+1UL]++ );
+   blocks_ [pos] = block;
+   indices_[pos] = static_cast<uint32_t>( jb );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Finalizing the block insertion of a block row.
+//
+// \param ib The index of the block row to be finalized.
+// \return void
+//
+// This function is part of the low-level interface to efficiently fill a matrix with blocks.
+// After completion of block row \a ib via the appendBlock() function, this function has to be
+// called to finalize block row \a ib and prepare the next block row for the insertion process.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline void CompressedBlockMatrix<Type,B>::finalize( size_t ib )
+{
+   BLAZE_USER_ASSERT( ib < m_/B, "Invalid block row access index" );
+
+   if( ib+1UL < m_/B )
+      offsets_[ib+2UL] = offsets_[ib+1UL];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , size_t B >        // Number of rows and columns of the blocks
+template< typename Other >  // Data type of the foreign expression
+inline bool CompressedBlockMatrix<Type,B>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , size_t B >        // Number of rows and columns of the blocks
+template< typename Other >  // Data type of the foreign expression
+inline bool CompressedBlockMatrix<Type,B>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// The block compressed matrix is always assigned serially.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline bool CompressedBlockMatrix<Type,B>::canSMPAssign() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPRESSEDBLOCKMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CompressedBlockMatrix operators */
+//@{
+template< typename Type, size_t B >
+inline void reset( CompressedBlockMatrix<Type,B>& m );
+
+template< typename Type, size_t B >
+inline void clear( CompressedBlockMatrix<Type,B>& m );
+
+template< typename Type, size_t B >
+inline bool isDefault( const CompressedBlockMatrix<Type,B>& m );
+
+template< typename Type, size_t B >
+inline void swap( CompressedBlockMatrix<Type,B>& a, CompressedBlockMatrix<Type,B>& b ) /* throw() */;
+
+template< typename Type, size_t B >
+inline void move( CompressedBlockMatrix<Type,B>& dst, CompressedBlockMatrix<Type,B>& src ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given block compressed matrix.
+// \ingroup compressed_block_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline void reset( CompressedBlockMatrix<Type,B>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given block compressed matrix.
+// \ingroup compressed_block_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline void clear( CompressedBlockMatrix<Type,B>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given block compressed matrix is in default state.
+// \ingroup compressed_block_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+//
+// This function checks whether the block compressed matrix is in default (constructed) state, i.e. if
+// it's number of rows and columns is 0. In case it is in default state, the function returns
+// \a true, else it will return \a false. The following example demonstrates the use of the
+// \a isDefault() function:
+
+   \code
+   blaze::CompressedBlockMatrix<int,3UL> A;
+   // ... Resizing and initialization
+   if( isDefault( A ) ) { ... }
+   \endcode
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline bool isDefault( const CompressedBlockMatrix<Type,B>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two block compressed matrices.
+// \ingroup compressed_block_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline void swap( CompressedBlockMatrix<Type,B>& a, CompressedBlockMatrix<Type,B>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moving the contents of one block compressed matrix to another.
+// \ingroup compressed_block_matrix
+//
+// \param dst The destination matrix.
+// \param src The source matrix.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+inline void move( CompressedBlockMatrix<Type,B>& dst, CompressedBlockMatrix<Type,B>& src ) /* throw() */
+{
+   dst.swap( src );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t B, typename T2, size_t M, size_t N, bool SO >
+struct AddTrait< CompressedBlockMatrix<T1,B>, StaticMatrix<T2,M,N,SO> >
+{
+   typedef StaticMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, size_t B >
+struct AddTrait< StaticMatrix<T1,M,N,SO>, CompressedBlockMatrix<T2,B> >
+{
+   typedef StaticMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
+};
+
+template< typename T1, size_t B, typename T2, size_t M, size_t N, bool SO >
+struct AddTrait< CompressedBlockMatrix<T1,B>, HybridMatrix<T2,M,N,SO> >
+{
+   typedef HybridMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, size_t B >
+struct AddTrait< HybridMatrix<T1,M,N,SO>, CompressedBlockMatrix<T2,B> >
+{
+   typedef HybridMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
+};
+
+template< typename T1, size_t B, typename T2, bool SO >
+struct AddTrait< CompressedBlockMatrix<T1,B>, DynamicMatrix<T2,SO> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t B >
+struct AddTrait< DynamicMatrix<T1,SO>, CompressedBlockMatrix<T2,B> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, size_t B, typename T2 >
+struct AddTrait< CompressedBlockMatrix<T1,B>, CompressedBlockMatrix<T2,B> >
+{
+   typedef CompressedBlockMatrix< typename AddTrait<T1,T2>::Type, B >  Type;
+};
+
+template< typename T1, size_t B1, typename T2, size_t B2 >
+struct AddTrait< CompressedBlockMatrix<T1,B1>, CompressedBlockMatrix<T2,B2> >
+{
+   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t B, typename T2, bool SO >
+struct AddTrait< CompressedBlockMatrix<T1,B>, CompressedMatrix<T2,SO> >
+{
+   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t B >
+struct AddTrait< CompressedMatrix<T1,SO>, CompressedBlockMatrix<T2,B> >
+{
+   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, size_t B, typename T2, bool SO >
+struct AddTrait< CompressedBlockMatrix<T1,B>, CompressedSoAMatrix<T2,SO> >
+{
+   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t B >
+struct AddTrait< CompressedSoAMatrix<T1,SO>, CompressedBlockMatrix<T2,B> >
+{
+   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type, SO >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t B, typename T2, size_t M, size_t N, bool SO >
+struct SubTrait< CompressedBlockMatrix<T1,B>, StaticMatrix<T2,M,N,SO> >
+{
+   typedef StaticMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, size_t B >
+struct SubTrait< StaticMatrix<T1,M,N,SO>, CompressedBlockMatrix<T2,B> >
+{
+   typedef StaticMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
+};
+
+template< typename T1, size_t B, typename T2, size_t M, size_t N, bool SO >
+struct SubTrait< CompressedBlockMatrix<T1,B>, HybridMatrix<T2,M,N,SO> >
+{
+   typedef HybridMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, size_t B >
+struct SubTrait< HybridMatrix<T1,M,N,SO>, CompressedBlockMatrix<T2,B> >
+{
+   typedef HybridMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
+};
+
+template< typename T1, size_t B, typename T2, bool SO >
+struct SubTrait< CompressedBlockMatrix<T1,B>, DynamicMatrix<T2,SO> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t B >
+struct SubTrait< DynamicMatrix<T1,SO>, CompressedBlockMatrix<T2,B> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, size_t B, typename T2 >
+struct SubTrait< CompressedBlockMatrix<T1,B>, CompressedBlockMatrix<T2,B> >
+{
+   typedef CompressedBlockMatrix< typename SubTrait<T1,T2>::Type, B >  Type;
+};
+
+template< typename T1, size_t B1, typename T2, size_t B2 >
+struct SubTrait< CompressedBlockMatrix<T1,B1>, CompressedBlockMatrix<T2,B2> >
+{
+   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t B, typename T2, bool SO >
+struct SubTrait< CompressedBlockMatrix<T1,B>, CompressedMatrix<T2,SO> >
+{
+   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t B >
+struct SubTrait< CompressedMatrix<T1,SO>, CompressedBlockMatrix<T2,B> >
+{
+   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, size_t B, typename T2, bool SO >
+struct SubTrait< CompressedBlockMatrix<T1,B>, CompressedSoAMatrix<T2,SO> >
+{
+   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t B >
+struct SubTrait< CompressedSoAMatrix<T1,SO>, CompressedBlockMatrix<T2,B> >
+{
+   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type, SO >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t B, typename T2 >
+struct MultTrait< CompressedBlockMatrix<T1,B>, T2 >
+{
+   typedef CompressedBlockMatrix< typename MultTrait<T1,T2>::Type, B >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+
+template< typename T1, typename T2, size_t B >
+struct MultTrait< T1, CompressedBlockMatrix<T2,B> >
+{
+   typedef CompressedBlockMatrix< typename MultTrait<T1,T2>::Type, B >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T1 );
+};
+
+template< typename T1, size_t B, typename T2, size_t N >
+struct MultTrait< CompressedBlockMatrix<T1,B>, StaticVector<T2,N,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t N, typename T2, size_t B >
+struct MultTrait< StaticVector<T1,N,true>, CompressedBlockMatrix<T2,B> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, size_t B, typename T2, size_t N >
+struct MultTrait< CompressedBlockMatrix<T1,B>, HybridVector<T2,N,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t N, typename T2, size_t B >
+struct MultTrait< HybridVector<T1,N,true>, CompressedBlockMatrix<T2,B> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, size_t B, typename T2 >
+struct MultTrait< CompressedBlockMatrix<T1,B>, DynamicVector<T2,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename T2, size_t B >
+struct MultTrait< DynamicVector<T1,true>, CompressedBlockMatrix<T2,B> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, size_t B, typename T2 >
+struct MultTrait< CompressedBlockMatrix<T1,B>, CompressedVector<T2,false> >
+{
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename T2, size_t B >
+struct MultTrait< CompressedVector<T1,true>, CompressedBlockMatrix<T2,B> >
+{
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, size_t B, typename T2, size_t M, size_t N, bool SO >
+struct MultTrait< CompressedBlockMatrix<T1,B>, StaticMatrix<T2,M,N,SO> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, size_t B >
+struct MultTrait< StaticMatrix<T1,M,N,SO>, CompressedBlockMatrix<T2,B> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, size_t B, typename T2, size_t M, size_t N, bool SO >
+struct MultTrait< CompressedBlockMatrix<T1,B>, HybridMatrix<T2,M,N,SO> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, size_t B >
+struct MultTrait< HybridMatrix<T1,M,N,SO>, CompressedBlockMatrix<T2,B> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, size_t B, typename T2, bool SO >
+struct MultTrait< CompressedBlockMatrix<T1,B>, DynamicMatrix<T2,SO> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t B >
+struct MultTrait< DynamicMatrix<T1,SO>, CompressedBlockMatrix<T2,B> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, size_t B1, typename T2, size_t B2 >
+struct MultTrait< CompressedBlockMatrix<T1,B1>, CompressedBlockMatrix<T2,B2> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t B, typename T2, bool SO >
+struct MultTrait< CompressedBlockMatrix<T1,B>, CompressedMatrix<T2,SO> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t B >
+struct MultTrait< CompressedMatrix<T1,SO>, CompressedBlockMatrix<T2,B> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, size_t B, typename T2, bool SO >
+struct MultTrait< CompressedBlockMatrix<T1,B>, CompressedSoAMatrix<T2,SO> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t B >
+struct MultTrait< CompressedSoAMatrix<T1,SO>, CompressedBlockMatrix<T2,B> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DIVTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t B, typename T2 >
+struct DivTrait< CompressedBlockMatrix<T1,B>, T2 >
+{
+   typedef CompressedBlockMatrix< typename DivTrait<T1,T2>::Type, B >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATHTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t B, typename T2 >
+struct MathTrait< CompressedBlockMatrix<T1,B>, CompressedBlockMatrix<T2,B> >
+{
+   typedef CompressedBlockMatrix< typename MathTrait<T1,T2>::HighType, B >  HighType;
+   typedef CompressedBlockMatrix< typename MathTrait<T1,T2>::LowType , B >  LowType;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t B >
+struct SubmatrixTrait< CompressedBlockMatrix<T1,B> >
+{
+   typedef CompressedMatrix<T1,false>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t B >
+struct RowTrait< CompressedBlockMatrix<T1,B> >
+{
+   typedef CompressedVector<T1,true>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t B >
+struct ColumnTrait< CompressedBlockMatrix<T1,B> >
+{
+   typedef CompressedVector<T1,false>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -384,6 +384,7 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
    //@{
    inline void append  ( size_t i, size_t j, const Type& value, bool check=false );
    inline void finalize( size_t i );
+          void reserve ( const std::vector<size_t>& nonzeros );
    //@}
    //**********************************************************************************************
 
@@ -627,8 +628,6 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>&
    , begin_   ( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
    , end_     ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
 {
-   using blaze::assign;
-
    const size_t nonzeros( (~sm).nonZeros() );
 
    begin_[0UL] = allocate<Element>( nonzeros );
@@ -636,7 +635,7 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>&
       begin_[i+1UL] = end_[i] = begin_[0UL];
    end_[m_] = begin_[0UL]+nonzeros;
 
-   assign( *this, ~sm );
+   smpAssign( *this, ~sm );
 }
 //*************************************************************************************************
 
@@ -952,8 +951,6 @@ template< typename MT    // Type of the right-hand side sparse matrix
 inline CompressedMatrix<Type,SO>&
    CompressedMatrix<Type,SO>::operator=( const SparseMatrix<MT,SO2>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ||
        (~rhs).rows()     > capacity_ ||
        (~rhs).nonZeros() > capacity() ) {
@@ -963,7 +960,7 @@ inline CompressedMatrix<Type,SO>&
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
       reset();
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -2122,6 +2119,73 @@ inline void CompressedMatrix<Type,SO>::finalize( size_t i )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Setting the capacities of all rows/columns of an empty sparse matrix.
+//
+// \param nonzeros The capacities of the individual rows/columns.
+// \return void
+//
+// This function is part of the low-level interface to efficiently fill a matrix with elements.
+// It sets the capacity of each row/column \a i of the sparse matrix to exactly \a nonzeros[i]
+// elements. In contrast to the reserve() function for a single row/column, the storage is
+// rearranged only once. Since the beginning of each row/column is fixed afterwards, the rows/
+// columns can be filled via the append() function in any order and without calls to the
+// finalize() function:
+
+   \code
+   using blaze::rowMajor;
+
+   blaze::CompressedMatrix<double,rowMajor> A( 3, 4 );
+
+   std::vector<size_t> nonzeros( 3 );
+   nonzeros[0] = 2;
+   nonzeros[2] = 1;
+
+   A.reserve( nonzeros );  // Reserving 2 elements for row 0 and 1 element for row 2
+   A.append( 2, 3, 3.0 );  // Appending the value 3 in row 2 with column index 3
+   A.append( 0, 1, 1.0 );  // Appending the value 1 in row 0 with column index 1
+   A.append( 0, 2, 2.0 );  // Appending the value 2 in row 0 with column index 2
+   \endcode
+
+// Since append() only modifies the specified row/column, different rows/columns can be filled
+// concurrently. Note that the matrix must not contain any non-zero elements and that the number
+// of given capacities must match the number of rows (for row-major matrices) or columns (for
+// column-major matrices).
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+void CompressedMatrix<Type,SO>::reserve( const std::vector<size_t>& nonzeros )
+{
+   BLAZE_USER_ASSERT( nonzeros.size() == m_, "Invalid number of rows" );
+   BLAZE_USER_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
+
+   size_t total( 0UL );
+   for( size_t i=0UL; i<m_; ++i )
+      total += nonzeros[i];
+
+   if( total > capacity() )
+   {
+      Iterator* newBegin( new Iterator[2UL*m_+2UL] );
+      Iterator* newEnd  ( newBegin+m_+1UL );
+
+      newBegin[0UL] = allocate<Element>( total );
+      newEnd  [m_ ] = newBegin[0UL]+total;
+
+      std::swap( newBegin, begin_ );
+      deallocate( newBegin[0UL] );
+      delete [] newBegin;
+      end_ = newEnd;
+      capacity_ = m_;
+   }
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      end_  [i    ] = begin_[i];
+      begin_[i+1UL] = begin_[i] + nonzeros[i];
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -2628,6 +2692,7 @@ class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,t
    //@{
    inline void append  ( size_t i, size_t j, const Type& value, bool check=false );
    inline void finalize( size_t j );
+          void reserve ( const std::vector<size_t>& nonzeros );
    //@}
    //**********************************************************************************************
 
@@ -2877,8 +2942,6 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const SparseMatrix<MT,SO>&
    , begin_   ( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
    , end_     ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
 {
-   using blaze::assign;
-
    const size_t nonzeros( (~sm).nonZeros() );
 
    begin_[0UL] = allocate<Element>( nonzeros );
@@ -2886,7 +2949,7 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const SparseMatrix<MT,SO>&
       begin_[j+1UL] = end_[j] = begin_[0UL];
    end_[n_] = begin_[0UL]+nonzeros;
 
-   assign( *this, ~sm );
+   smpAssign( *this, ~sm );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3184,8 +3247,6 @@ template< typename MT      // Type of the right-hand side sparse matrix
 inline CompressedMatrix<Type,true>&
    CompressedMatrix<Type,true>::operator=( const SparseMatrix<MT,SO>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ||
        (~rhs).columns()  > capacity_ ||
        (~rhs).nonZeros() > capacity() ) {
@@ -3195,7 +3256,7 @@ inline CompressedMatrix<Type,true>&
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
       reset();
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -4359,6 +4420,53 @@ inline void CompressedMatrix<Type,true>::finalize( size_t j )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Setting the capacities of all columns of an empty sparse matrix.
+//
+// \param nonzeros The capacities of the individual columns.
+// \return void
+//
+// This function is part of the low-level interface to efficiently fill the matrix with elements.
+// It sets the capacity of each column \a j of the sparse matrix to exactly \a nonzeros[j]
+// elements. Afterwards the columns can be filled via the append() function in any order (and
+// concurrently) without calls to the finalize() function. Note that the matrix must not contain
+// any non-zero elements and that the number of given capacities must match the number of columns.
+*/
+template< typename Type >  // Data type of the sparse matrix
+void CompressedMatrix<Type,true>::reserve( const std::vector<size_t>& nonzeros )
+{
+   BLAZE_USER_ASSERT( nonzeros.size() == n_, "Invalid number of columns" );
+   BLAZE_USER_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
+
+   size_t total( 0UL );
+   for( size_t j=0UL; j<n_; ++j )
+      total += nonzeros[j];
+
+   if( total > capacity() )
+   {
+      Iterator* newBegin( new Iterator[2UL*n_+2UL] );
+      Iterator* newEnd  ( newBegin+n_+1UL );
+
+      newBegin[0UL] = allocate<Element>( total );
+      newEnd  [n_ ] = newBegin[0UL]+total;
+
+      std::swap( newBegin, begin_ );
+      deallocate( newBegin[0UL] );
+      delete [] newBegin;
+      end_ = newEnd;
+      capacity_ = n_;
+   }
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      end_  [j    ] = begin_[j];
+      begin_[j+1UL] = begin_[j] + nonzeros[j];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -0,0 +1,3078 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/CompressedSoAMatrix.h
+//  \brief Implementation of a compressed MxN matrix with structure-of-arrays storage
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_COMPRESSEDSOAMATRIX_H_
+#define _BLAZE_MATH_SPARSE_COMPRESSEDSOAMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/constraints/Symmetric.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/MatrixAccessProxy.h>
+#include <blaze/math/sparse/SoAIterator.h>
+#include <blaze/math/traits/AddTrait.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/DivTrait.h>
+#include <blaze/math/traits/MathTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsStrictlyLower.h>
+#include <blaze/math/typetraits/IsStrictlyUpper.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Limits.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup compressed_soa_matrix CompressedSoAMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Compressed \f$ M \times N \f$ matrix with structure-of-arrays storage.
+// \ingroup compressed_soa_matrix
+//
+// The CompressedSoAMatrix class template is a sibling of the CompressedMatrix class template
+// that stores the non-zero elements in the classic CSR/CSC layout: an offset array for the
+// rows (or columns) plus two separate arrays for the values and the 32-bit column (or row)
+// indices of the non-zero elements:
+
+   \code
+   template< typename Type, bool SO >
+   class CompressedSoAMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. CompressedSoAMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//
+// CompressedMatrix stores each non-zero element as a value-index-pair with a \a size_t index,
+// which for a \a double matrix amounts to 16 bytes per element. CompressedSoAMatrix only needs
+// 12 bytes per element, which reduces the memory traffic of bandwidth bound kernels (as for
+// instance the sparse matrix/dense vector multiplication) by roughly a quarter to a third and
+// enables vectorized gathers directly from the index array. The price is that the number of
+// columns of a row-major matrix (or the number of rows of a column-major matrix) is limited
+// to the range of a 32-bit unsigned integer.
+//
+// CompressedSoAMatrix offers the same interface as CompressedMatrix and can be used in all
+// sparse matrix expressions:
+
+   \code
+   using blaze::CompressedSoAMatrix;
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::rowMajor;
+
+   CompressedSoAMatrix<double,rowMajor> A( 4, 3 );
+   A(1,2) = 2.0;
+   A.set( 2, 0, -1.2 );
+   A.insert( 2, 1, 3.7 );
+
+   DynamicVector<double> x( 3UL, 1.0 ), y;
+   y = A * x;  // Sparse matrix/dense vector multiplication
+
+   CompressedMatrix<double,rowMajor> B( A );  // Conversion into a CompressedMatrix
+   CompressedSoAMatrix<double,rowMajor> C( A * trans( B ) );
+   \endcode
+*/
+template< typename Type                    // Data type of the sparse matrix
+        , bool SO = defaultStorageOrder >  // Storage order
+class CompressedSoAMatrix : public SparseMatrix< CompressedSoAMatrix<Type,SO>, SO >
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef CompressedSoAMatrix<Type,SO>   This;            //!< Type of this CompressedSoAMatrix instance.
+   typedef This                           ResultType;      //!< Result type for expression template evaluations.
+   typedef CompressedSoAMatrix<Type,!SO>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedSoAMatrix<Type,!SO>  TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                           ElementType;     //!< Type of the sparse matrix elements.
+   typedef const Type&                    ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                    CompositeType;   //!< Data type for composite expression templates.
+   typedef MatrixAccessProxy<This>        Reference;       //!< Reference to a sparse matrix value.
+   typedef const Type&                    ConstReference;  //!< Reference to a constant sparse matrix value.
+   typedef SoAIterator<Type>              Iterator;        //!< Iterator over non-constant elements.
+   typedef SoAIterator<const Type>        ConstIterator;   //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a CompressedSoAMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef CompressedSoAMatrix<ET,SO>  Other;  //!< The type of the other CompressedSoAMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum { smpAssignable = !IsSMPAssignable<Type>::value };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+                            explicit inline CompressedSoAMatrix();
+                            explicit inline CompressedSoAMatrix( size_t m, size_t n );
+                            explicit inline CompressedSoAMatrix( size_t m, size_t n, size_t nonzeros );
+                            explicit        CompressedSoAMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros );
+                                     inline CompressedSoAMatrix( const CompressedSoAMatrix& sm );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix( const DenseMatrix<MT,SO2>&  dm );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix( const SparseMatrix<MT,SO2>& sm );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~CompressedSoAMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j );
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline Iterator       begin ( size_t i );
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline Iterator       end   ( size_t i );
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                                     inline CompressedSoAMatrix& operator= ( const CompressedSoAMatrix& rhs );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator= ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator= ( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator+=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator-=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator*=( const Matrix<MT,SO2>& rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, CompressedSoAMatrix >::Type&
+      operator*=( Other rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, CompressedSoAMatrix >::Type&
+      operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                              inline size_t               rows() const;
+                              inline size_t               columns() const;
+                              inline size_t               capacity() const;
+                              inline size_t               capacity( size_t i ) const;
+                              inline size_t               nonZeros() const;
+                              inline size_t               nonZeros( size_t i ) const;
+                              inline void                 reset();
+                              inline void                 reset( size_t i );
+                              inline void                 clear();
+                              inline Iterator             set    ( size_t i, size_t j, const Type& value );
+                              inline Iterator             insert ( size_t i, size_t j, const Type& value );
+                              inline void                 erase  ( size_t i, size_t j );
+                              inline Iterator             erase  ( size_t i, Iterator pos );
+                              inline Iterator             erase  ( size_t i, Iterator first, Iterator last );
+                                     void                 resize ( size_t m, size_t n, bool preserve=true );
+                              inline void                 reserve( size_t nonzeros );
+                                     void                 reserve( size_t i, size_t nonzeros );
+                              inline void                 trim   ();
+                              inline void                 trim   ( size_t i );
+                              inline CompressedSoAMatrix& transpose();
+   template< typename Other > inline CompressedSoAMatrix& scale( const Other& scalar );
+   template< typename Other > inline CompressedSoAMatrix& scaleDiagonal( Other scalar );
+                              inline void                 swap( CompressedSoAMatrix& sm ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline Iterator      find      ( size_t i, size_t j );
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline Iterator      lowerBound( size_t i, size_t j );
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline Iterator      upperBound( size_t i, size_t j );
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   inline void append  ( size_t i, size_t j, const Type& value, bool check=false );
+   inline void finalize( size_t i );
+          void reserve ( const std::vector<size_t>& nonzeros );
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool canSMPAssign() const;
+
+   template< typename MT, bool SO2 > inline void assign   ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT >           inline void assign   ( const SparseMatrix<MT,SO>&  rhs );
+   template< typename MT >           inline void assign   ( const SparseMatrix<MT,!SO>& rhs );
+   template< typename MT, bool SO2 > inline void addAssign( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void addAssign( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void subAssign( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void subAssign( const SparseMatrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+          Iterator insert( Iterator pos, size_t i, size_t j, const Type& value );
+   inline size_t   lowerOffset( size_t i, size_t j ) const;
+   inline size_t   upperOffset( size_t i, size_t j ) const;
+   inline size_t   extendCapacity() const;
+          void     reserveElements( size_t nonzeros );
+
+   static inline size_t checkIndexRange( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;           //!< The current number of rows (row-major) or columns (column-major).
+   size_t n_;           //!< The current number of columns (row-major) or rows (column-major).
+   size_t capacity_;    //!< The current capacity of the offset array.
+   size_t* begin_;      //!< Offsets of the first non-zero element of each row/column.
+   size_t* end_;        //!< Offsets one past the last non-zero element of each row/column.
+   Type* values_;       //!< The values of the non-zero elements.
+   uint32_t* indices_;  //!< The column/row indices of the non-zero elements.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, bool SO >
+const Type CompressedSoAMatrix<Type,SO>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for CompressedSoAMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline CompressedSoAMatrix<Type,SO>::CompressedSoAMatrix()
+   : m_       ( 0UL )             // The current number of rows/columns of the sparse matrix
+   , n_       ( 0UL )             // The current number of columns/rows of the sparse matrix
+   , capacity_( 0UL )             // The current capacity of the offset array
+   , begin_   ( new size_t[2] )   // Offsets of the first non-zero element of each row/column
+   , end_     ( begin_+1 )        // Offsets one past the last non-zero element of each row/column
+   , values_  ( NULL )            // The values of the non-zero elements
+   , indices_ ( NULL )            // The indices of the non-zero elements
+{
+   begin_[0] = end_[0] = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Matrix size exceeds the 32-bit index range.
+//
+// The matrix is initialized to the zero matrix and has no free capacity.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline CompressedSoAMatrix<Type,SO>::CompressedSoAMatrix( size_t m, size_t n )
+   : m_       ( SO ? n : m )                    // The current number of rows/columns of the sparse matrix
+   , n_       ( checkIndexRange( SO ? m : n ) )  // The current number of columns/rows of the sparse matrix
+   , capacity_( m_ )                            // The current capacity of the offset array
+   , begin_   ( new size_t[2UL*m_+2UL] )        // Offsets of the first non-zero element of each row/column
+   , end_     ( begin_+(m_+1UL) )               // Offsets one past the last non-zero element of each row/column
+   , values_  ( NULL )                          // The values of the non-zero elements
+   , indices_ ( NULL )                          // The indices of the non-zero elements
+{
+   for( size_t i=0UL; i<2UL*m_+2UL; ++i )
+      begin_[i] = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The number of expected non-zero elements.
+// \exception std::invalid_argument Matrix size exceeds the 32-bit index range.
+//
+// The matrix is initialized to the zero matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline CompressedSoAMatrix<Type,SO>::CompressedSoAMatrix( size_t m, size_t n, size_t nonzeros )
+   : m_       ( SO ? n : m )                       // The current number of rows/columns of the sparse matrix
+   , n_       ( checkIndexRange( SO ? m : n ) )     // The current number of columns/rows of the sparse matrix
+   , capacity_( m_ )                               // The current capacity of the offset array
+   , begin_   ( new size_t[2UL*m_+2UL] )           // Offsets of the first non-zero element of each row/column
+   , end_     ( begin_+(m_+1UL) )                  // Offsets one past the last non-zero element of each row/column
+   , values_  ( allocate<Type>( nonzeros ) )       // The values of the non-zero elements
+   , indices_ ( allocate<uint32_t>( nonzeros ) )   // The indices of the non-zero elements
+{
+   for( size_t i=0UL; i<2UL*m_+1UL; ++i )
+      begin_[i] = 0UL;
+   end_[m_] = nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The expected number of non-zero elements in each row/column.
+// \exception std::invalid_argument Matrix size exceeds the 32-bit index range.
+//
+// The matrix is initialized to the zero matrix and will have the specified capacity in each
+// row/column. Note that in case of a row-major matrix the given vector must have at least
+// \a m elements, in case of a column-major matrix at least \a n elements.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+CompressedSoAMatrix<Type,SO>::CompressedSoAMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
+   : m_       ( SO ? n : m )                    // The current number of rows/columns of the sparse matrix
+   , n_       ( checkIndexRange( SO ? m : n ) )  // The current number of columns/rows of the sparse matrix
+   , capacity_( m_ )                            // The current capacity of the offset array
+   , begin_   ( new size_t[2UL*m_+2UL] )        // Offsets of the first non-zero element of each row/column
+   , end_     ( begin_+(m_+1UL) )               // Offsets one past the last non-zero element of each row/column
+   , values_  ( NULL )                          // The values of the non-zero elements
+   , indices_ ( NULL )                          // The indices of the non-zero elements
+{
+   BLAZE_USER_ASSERT( nonzeros.size() == m_, "Size of capacity vector and number of rows/columns don't match" );
+
+   size_t newCapacity( 0UL );
+   for( std::vector<size_t>::const_iterator it=nonzeros.begin(); it!=nonzeros.end(); ++it )
+      newCapacity += *it;
+
+   values_  = allocate<Type>( newCapacity );
+   indices_ = allocate<uint32_t>( newCapacity );
+
+   begin_[0UL] = end_[0UL] = 0UL;
+   for( size_t i=0UL; i<m_; ++i ) {
+      begin_[i+1UL] = end_[i+1UL] = begin_[i] + nonzeros[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for CompressedSoAMatrix.
+//
+// \param sm Sparse matrix to be copied.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline CompressedSoAMatrix<Type,SO>::CompressedSoAMatrix( const CompressedSoAMatrix& sm )
+   : m_       ( sm.m_ )                                  // The current number of rows/columns of the sparse matrix
+   , n_       ( sm.n_ )                                  // The current number of columns/rows of the sparse matrix
+   , capacity_( sm.m_ )                                  // The current capacity of the offset array
+   , begin_   ( new size_t[2UL*m_+2UL] )                 // Offsets of the first non-zero element of each row/column
+   , end_     ( begin_+(m_+1UL) )                        // Offsets one past the last non-zero element of each row/column
+   , values_  ( allocate<Type>( sm.nonZeros() ) )        // The values of the non-zero elements
+   , indices_ ( allocate<uint32_t>( sm.nonZeros() ) )    // The indices of the non-zero elements
+{
+   begin_[0UL] = 0UL;
+   for( size_t i=0UL; i<m_; ++i ) {
+      std::copy( sm.values_ +sm.begin_[i], sm.values_ +sm.end_[i], values_ +begin_[i] );
+      std::copy( sm.indices_+sm.begin_[i], sm.indices_+sm.end_[i], indices_+begin_[i] );
+      begin_[i+1UL] = end_[i] = begin_[i] + sm.nonZeros(i);
+   }
+   end_[m_] = begin_[m_];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from dense matrices.
+//
+// \param dm Dense matrix to be copied.
+// \exception std::invalid_argument Matrix size exceeds the 32-bit index range.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the foreign dense matrix
+        , bool SO2 >     // Storage order of the foreign dense matrix
+inline CompressedSoAMatrix<Type,SO>::CompressedSoAMatrix( const DenseMatrix<MT,SO2>& dm )
+   : m_       ( SO ? (~dm).columns() : (~dm).rows() )                    // The current number of rows/columns of the sparse matrix
+   , n_       ( checkIndexRange( SO ? (~dm).rows() : (~dm).columns() ) )  // The current number of columns/rows of the sparse matrix
+   , capacity_( m_ )                                                     // The current capacity of the offset array
+   , begin_   ( new size_t[2UL*m_+2UL] )                                 // Offsets of the first non-zero element of each row/column
+   , end_     ( begin_+(m_+1UL) )                                        // Offsets one past the last non-zero element of each row/column
+   , values_  ( NULL )                                                   // The values of the non-zero elements
+   , indices_ ( NULL )                                                   // The indices of the non-zero elements
+{
+   using blaze::assign;
+
+   for( size_t i=0UL; i<2UL*m_+2UL; ++i )
+      begin_[i] = 0UL;
+
+   assign( *this, ~dm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different sparse matrices.
+//
+// \param sm Sparse matrix to be copied.
+// \exception std::invalid_argument Matrix size exceeds the 32-bit index range.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the foreign sparse matrix
+        , bool SO2 >     // Storage order of the foreign sparse matrix
+inline CompressedSoAMatrix<Type,SO>::CompressedSoAMatrix( const SparseMatrix<MT,SO2>& sm )
+   : m_       ( SO ? (~sm).columns() : (~sm).rows() )                    // The current number of rows/columns of the sparse matrix
+   , n_       ( checkIndexRange( SO ? (~sm).rows() : (~sm).columns() ) )  // The current number of columns/rows of the sparse matrix
+   , capacity_( m_ )                                                     // The current capacity of the offset array
+   , begin_   ( new size_t[2UL*m_+2UL] )                                 // Offsets of the first non-zero element of each row/column
+   , end_     ( begin_+(m_+1UL) )                                        // Offsets one past the last non-zero element of each row/column
+   , values_  ( allocate<Type>( (~sm).nonZeros() ) )                     // The values of the non-zero elements
+   , indices_ ( allocate<uint32_t>( (~sm).nonZeros() ) )                 // The indices of the non-zero elements
+{
+   for( size_t i=0UL; i<2UL*m_+1UL; ++i )
+      begin_[i] = 0UL;
+   end_[m_] = (~sm).nonZeros();
+
+   smpAssign( *this, ~sm );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for CompressedSoAMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline CompressedSoAMatrix<Type,SO>::~CompressedSoAMatrix()
+{
+   deallocate( values_  );
+   deallocate( indices_ );
+   delete [] begin_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompressedSoAMatrix<Type,SO>::Reference
+   CompressedSoAMatrix<Type,SO>::operator()( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return Reference( *this, i, j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompressedSoAMatrix<Type,SO>::ConstReference
+   CompressedSoAMatrix<Type,SO>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+   const size_t pos( lowerOffset( k, l ) );
+
+   if( pos == end_[k] || indices_[pos] != l )
+      return zero_;
+   else
+      return values_[pos];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompressedSoAMatrix<Type,SO>::Iterator
+   CompressedSoAMatrix<Type,SO>::begin( size_t i )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row/column access index" );
+   return Iterator( values_+begin_[i], indices_+begin_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompressedSoAMatrix<Type,SO>::ConstIterator
+   CompressedSoAMatrix<Type,SO>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row/column access index" );
+   return ConstIterator( values_+begin_[i], indices_+begin_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompressedSoAMatrix<Type,SO>::ConstIterator
+   CompressedSoAMatrix<Type,SO>::cbegin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row/column access index" );
+   return ConstIterator( values_+begin_[i], indices_+begin_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor the
+// function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompressedSoAMatrix<Type,SO>::Iterator
+   CompressedSoAMatrix<Type,SO>::end( size_t i )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row/column access index" );
+   return Iterator( values_+end_[i], indices_+end_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor the
+// function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompressedSoAMatrix<Type,SO>::ConstIterator
+   CompressedSoAMatrix<Type,SO>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row/column access index" );
+   return ConstIterator( values_+end_[i], indices_+end_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor the
+// function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompressedSoAMatrix<Type,SO>::ConstIterator
+   CompressedSoAMatrix<Type,SO>::cend( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row/column access index" );
+   return ConstIterator( values_+end_[i], indices_+end_[i] );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for CompressedSoAMatrix.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+//
+// The sparse matrix is resized according to the given sparse matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline CompressedSoAMatrix<Type,SO>&
+   CompressedSoAMatrix<Type,SO>::operator=( const CompressedSoAMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   const size_t nonzeros( rhs.nonZeros() );
+
+   if( rhs.m_ > capacity_ || nonzeros > capacity() )
+   {
+      CompressedSoAMatrix tmp( rhs );
+      swap( tmp );
+   }
+   else {
+      for( size_t i=0UL; i<rhs.m_; ++i ) {
+         std::copy( rhs.values_ +rhs.begin_[i], rhs.values_ +rhs.end_[i], values_ +begin_[i] );
+         std::copy( rhs.indices_+rhs.begin_[i], rhs.indices_+rhs.end_[i], indices_+begin_[i] );
+         begin_[i+1UL] = end_[i] = begin_[i] + rhs.nonZeros(i);
+      }
+      if( rhs.m_ < m_ )
+         end_[rhs.m_] = end_[m_];
+
+      m_ = rhs.m_;
+      n_ = rhs.n_;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for dense matrices.
+//
+// \param rhs Dense matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Matrix size exceeds the 32-bit index range.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline CompressedSoAMatrix<Type,SO>&
+   CompressedSoAMatrix<Type,SO>::operator=( const DenseMatrix<MT,SO2>& rhs )
+{
+   using blaze::assign;
+
+   if( (~rhs).canAlias( this ) ) {
+      CompressedSoAMatrix tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      resize( (~rhs).rows(), (~rhs).columns(), false );
+      assign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different sparse matrices.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Matrix size exceeds the 32-bit index range.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline CompressedSoAMatrix<Type,SO>&
+   CompressedSoAMatrix<Type,SO>::operator=( const SparseMatrix<MT,SO2>& rhs )
+{
+   const size_t m( SO ? (~rhs).columns() : (~rhs).rows() );
+
+   if( (~rhs).canAlias( this ) ||
+       m > capacity_ ||
+       (~rhs).nonZeros() > capacity() ) {
+      CompressedSoAMatrix tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      resize( (~rhs).rows(), (~rhs).columns(), false );
+      reset();
+      smpAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CompressedSoAMatrix<Type,SO>&
+   CompressedSoAMatrix<Type,SO>::operator+=( const Matrix<MT,SO2>& rhs )
+{
+   using blaze::addAssign;
+
+   if( (~rhs).rows() != rows() || (~rhs).columns() != columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   addAssign( *this, ~rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CompressedSoAMatrix<Type,SO>&
+   CompressedSoAMatrix<Type,SO>::operator-=( const Matrix<MT,SO2>& rhs )
+{
+   using blaze::subAssign;
+
+   if( (~rhs).rows() != rows() || (~rhs).columns() != columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   subAssign( *this, ~rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a matrix (\f$ A*=B \f$).
+//
+// \param rhs The right-hand side matrix for the multiplication.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two given matrices don't match, a \a std::invalid_argument
+// is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CompressedSoAMatrix<Type,SO>&
+   CompressedSoAMatrix<Type,SO>::operator*=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   CompressedSoAMatrix tmp( *this * (~rhs) );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a sparse matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the sparse matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, CompressedSoAMatrix<Type,SO> >::Type&
+   CompressedSoAMatrix<Type,SO>::operator*=( Other rhs )
+{
+   for( size_t i=0UL; i<m_; ++i ) {
+      for( size_t k=begin_[i]; k<end_[i]; ++k )
+         values_[k] *= rhs;
+   }
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a sparse matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, CompressedSoAMatrix<Type,SO> >::Type&
+   CompressedSoAMatrix<Type,SO>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   typedef typename DivTrait<Type,Other>::Type  DT;
+   typedef typename If< IsNumeric<DT>, DT, Other >::Type  Tmp;
+
+   // Depending on the two involved data types, an integer division is applied or a
+   // floating point division is selected.
+   if( IsNumeric<DT>::value && IsFloatingPoint<DT>::value ) {
+      const Tmp tmp( Tmp(1)/static_cast<Tmp>( rhs ) );
+      for( size_t i=0UL; i<m_; ++i ) {
+         for( size_t k=begin_[i]; k<end_[i]; ++k )
+            values_[k] *= tmp;
+      }
+   }
+   else {
+      for( size_t i=0UL; i<m_; ++i ) {
+         for( size_t k=begin_[i]; k<end_[i]; ++k )
+            values_[k] /= rhs;
+      }
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t CompressedSoAMatrix<Type,SO>::rows() const
+{
+   return ( SO )?( n_ ):( m_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t CompressedSoAMatrix<Type,SO>::columns() const
+{
+   return ( SO )?( m_ ):( n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the sparse matrix.
+//
+// \return The capacity of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t CompressedSoAMatrix<Type,SO>::capacity() const
+{
+   return end_[m_] - begin_[0UL];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t CompressedSoAMatrix<Type,SO>::capacity( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row/column access index" );
+   return begin_[i+1UL] - begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the sparse matrix
+//
+// \return The number of non-zero elements in the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t CompressedSoAMatrix<Type,SO>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<m_; ++i )
+      nonzeros += nonZeros( i );
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t CompressedSoAMatrix<Type,SO>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row/column access index" );
+   return end_[i] - begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void CompressedSoAMatrix<Type,SO>::reset()
+{
+   for( size_t i=0UL; i<m_; ++i )
+      end_[i] = begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column to the default initial values.
+//
+// \param i The index of the row/column to be resetted.
+// \return void
+//
+// Note that the capacity of the row/column remains unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void CompressedSoAMatrix<Type,SO>::reset( size_t i )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row/column access index" );
+   end_[i] = begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the sparse matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the sparse matrix is 0.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void CompressedSoAMatrix<Type,SO>::clear()
+{
+   end_[0UL] = end_[m_];
+   m_ = 0UL;
+   n_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting an element of the compressed matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be set.
+// \return Iterator to the set element.
+//
+// This function sets the value of an element of the compressed matrix. In case the compressed
+// matrix already contains an element with row index \a i and column index \a j its value is
+// modified, else a new element with the given \a value is inserted.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompressedSoAMatrix<Type,SO>::Iterator
+   CompressedSoAMatrix<Type,SO>::set( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+   const size_t pos( lowerOffset( k, l ) );
+
+   if( pos != end_[k] && indices_[pos] == l ) {
+      values_[pos] = value;
+      return Iterator( values_+pos, indices_+pos );
+   }
+   else return insert( Iterator( values_+pos, indices_+pos ), k, l, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the compressed matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+// \exception std::invalid_argument Invalid compressed matrix access index.
+//
+// This function inserts a new element into the compressed matrix. However, duplicate elements
+// are not allowed. In case the sparse matrix already contains an element with row index \a i
+// and column index \a j, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompressedSoAMatrix<Type,SO>::Iterator
+   CompressedSoAMatrix<Type,SO>::insert( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+   const size_t pos( lowerOffset( k, l ) );
+
+   if( pos != end_[k] && indices_[pos] == l )
+      throw std::invalid_argument( "Bad access index" );
+
+   return insert( Iterator( values_+pos, indices_+pos ), k, l, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the compressed matrix.
+//
+// \param pos The position of the new element.
+// \param i The row/column index of the new element.
+// \param j The column/row index of the new element.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+typename CompressedSoAMatrix<Type,SO>::Iterator
+   CompressedSoAMatrix<Type,SO>::insert( Iterator pos, size_t i, size_t j, const Type& value )
+{
+   const size_t p( pos.base() - values_ );
+
+   if( begin_[i+1UL] - end_[i] != 0 ) {
+      std::copy_backward( values_ +p, values_ +end_[i], values_ +end_[i]+1UL );
+      std::copy_backward( indices_+p, indices_+end_[i], indices_+end_[i]+1UL );
+      values_ [p] = value;
+      indices_[p] = static_cast<uint32_t>( j );
+      ++end_[i];
+
+      return pos;
+   }
+   else if( end_[m_] - begin_[m_] != 0 ) {
+      std::copy_backward( values_ +p, values_ +end_[m_-1UL], values_ +end_[m_-1UL]+1UL );
+      std::copy_backward( indices_+p, indices_+end_[m_-1UL], indices_+end_[m_-1UL]+1UL );
+      values_ [p] = value;
+      indices_[p] = static_cast<uint32_t>( j );
+
+      for( size_t k=i+1UL; k<m_+1UL; ++k ) {
+         ++begin_[k];
+         ++end_[k-1UL];
+      }
+
+      return pos;
+   }
+   else {
+      size_t newCapacity( extendCapacity() );
+
+      size_t* newBegin = new size_t[2UL*capacity_+2UL];
+      size_t* newEnd   = newBegin+capacity_+1UL;
+
+      Type*     newValues ( allocate<Type>( newCapacity ) );
+      uint32_t* newIndices( allocate<uint32_t>( newCapacity ) );
+
+      newBegin[0UL] = 0UL;
+
+      for( size_t k=0UL; k<i; ++k ) {
+         const size_t nonzeros( end_[k] - begin_[k] );
+         const size_t total( begin_[k+1UL] - begin_[k] );
+         newEnd  [k]     = newBegin[k] + nonzeros;
+         newBegin[k+1UL] = newBegin[k] + total;
+      }
+      newEnd  [i]     = newBegin[i] + ( end_[i] - begin_[i] ) + 1UL;
+      newBegin[i+1UL] = newBegin[i] + ( begin_[i+1UL] - begin_[i] ) + 1UL;
+      for( size_t k=i+1UL; k<m_; ++k ) {
+         const size_t nonzeros( end_[k] - begin_[k] );
+         const size_t total( begin_[k+1UL] - begin_[k] );
+         newEnd  [k]     = newBegin[k] + nonzeros;
+         newBegin[k+1UL] = newBegin[k] + total;
+      }
+
+      newEnd[m_] = newEnd[capacity_] = newCapacity;
+
+      std::copy( values_ , values_ +p, newValues  );
+      std::copy( indices_, indices_+p, newIndices );
+      newValues [p] = value;
+      newIndices[p] = static_cast<uint32_t>( j );
+      std::copy( values_ +p, values_ +end_[m_-1UL], newValues +p+1UL );
+      std::copy( indices_+p, indices_+end_[m_-1UL], newIndices+p+1UL );
+
+      std::swap( newBegin  , begin_   );
+      std::swap( newValues , values_  );
+      std::swap( newIndices, indices_ );
+      end_ = newEnd;
+      deallocate( newValues  );
+      deallocate( newIndices );
+      delete [] newBegin;
+
+      return Iterator( values_+p, indices_+p );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the sparse matrix.
+//
+// \param i The row index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void CompressedSoAMatrix<Type,SO>::erase( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+   const size_t pos( lowerOffset( k, l ) );
+
+   if( pos != end_[k] && indices_[pos] == l ) {
+      std::copy( indices_+pos+1UL, indices_+end_[k], indices_+pos );
+      end_[k] = std::copy( values_+pos+1UL, values_+end_[k], values_+pos ) - values_;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the sparse matrix.
+//
+// \param i The row/column index of the element to be erased.
+// \param pos Iterator to the element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// In case the storage order is set to \a rowMajor the function erases an element from row \a i,
+// in case the storage flag is set to \a columnMajor the function erases an element from column
+// \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompressedSoAMatrix<Type,SO>::Iterator
+   CompressedSoAMatrix<Type,SO>::erase( size_t i, Iterator pos )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row/column access index" );
+   BLAZE_USER_ASSERT( pos >= begin(i) && pos <= end(i), "Invalid compressed matrix iterator" );
+
+   const size_t p( pos.base() - values_ );
+
+   if( p != end_[i] ) {
+      std::copy( indices_+p+1UL, indices_+end_[i], indices_+p );
+      end_[i] = std::copy( values_+p+1UL, values_+end_[i], values_+p ) - values_;
+   }
+
+   return pos;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing a range of elements from the sparse matrix.
+//
+// \param i The row/column index of the element to be erased.
+// \param first Iterator to first element to be erased.
+// \param last Iterator just past the last element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// In case the storage order is set to \a rowMajor the function erases a range of elements from
+// row \a i, in case the storage flag is set to \a columnMajor the function erases a range of
+// elements from column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompressedSoAMatrix<Type,SO>::Iterator
+   CompressedSoAMatrix<Type,SO>::erase( size_t i, Iterator first, Iterator last )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row/column access index" );
+   BLAZE_USER_ASSERT( first <= last, "Invalid iterator range"   );
+   BLAZE_USER_ASSERT( first >= begin(i) && first <= end(i), "Invalid compressed matrix iterator" );
+   BLAZE_USER_ASSERT( last  >= begin(i) && last  <= end(i), "Invalid compressed matrix iterator" );
+
+   const size_t pfirst( first.base() - values_ );
+   const size_t plast ( last.base()  - values_ );
+
+   if( pfirst != plast ) {
+      std::copy( indices_+plast, indices_+end_[i], indices_+pfirst );
+      end_[i] = std::copy( values_+plast, values_+end_[i], values_+pfirst ) - values_;
+   }
+
+   return first;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the sparse matrix.
+//
+// \param m The new number of rows of the sparse matrix.
+// \param n The new number of columns of the sparse matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+// \exception std::invalid_argument Matrix size exceeds the 32-bit index range.
+//
+// This function resizes the matrix using the given size to \f$ m \times n \f$. During this
+// operation, new dynamic memory may be allocated in case the capacity of the matrix is too
+// small. Note that this function may invalidate all existing views (submatrices, rows, columns,
+// ...) on the matrix if it is used to shrink the matrix. Additionally, the resize operation
+// potentially changes all matrix elements. In order to preserve the old matrix values, the
+// \a preserve flag can be set to \a true.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+void CompressedSoAMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
+{
+   BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
+   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+
+   const size_t mm( SO ? n : m );
+   const size_t nn( checkIndexRange( SO ? m : n ) );
+
+   if( mm == m_ && nn == n_ ) return;
+
+   if( mm > capacity_ )
+   {
+      size_t* newBegin( new size_t[2UL*mm+2UL] );
+      size_t* newEnd  ( newBegin+mm+1UL );
+
+      newBegin[0UL] = begin_[0UL];
+
+      if( preserve ) {
+         for( size_t i=0UL; i<m_; ++i ) {
+            newEnd  [i]     = end_  [i];
+            newBegin[i+1UL] = begin_[i+1UL];
+         }
+         for( size_t i=m_; i<mm; ++i ) {
+            newBegin[i+1UL] = newEnd[i] = begin_[m_];
+         }
+      }
+      else {
+         for( size_t i=0UL; i<mm; ++i ) {
+            newBegin[i+1UL] = newEnd[i] = begin_[0UL];
+         }
+      }
+
+      newEnd[mm] = end_[m_];
+
+      std::swap( newBegin, begin_ );
+      delete [] newBegin;
+
+      end_ = newEnd;
+      capacity_ = mm;
+   }
+   else if( mm > m_ )
+   {
+      end_[mm] = end_[m_];
+
+      if( !preserve ) {
+         for( size_t i=0UL; i<m_; ++i )
+            end_[i] = begin_[i];
+      }
+
+      for( size_t i=m_; i<mm; ++i )
+         begin_[i+1UL] = end_[i] = begin_[m_];
+   }
+   else
+   {
+      if( preserve ) {
+         for( size_t i=0UL; i<mm; ++i )
+            end_[i] = lowerOffset( i, nn );
+      }
+      else {
+         for( size_t i=0UL; i<mm; ++i )
+            end_[i] = begin_[i];
+      }
+
+      end_[mm] = end_[m_];
+   }
+
+   m_ = mm;
+   n_ = nn;
+
+   BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
+   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the sparse matrix.
+//
+// \param nonzeros The new minimum capacity of the sparse matrix.
+// \return void
+//
+// This function increases the capacity of the sparse matrix to at least \a nonzeros elements.
+// The current values of the matrix elements and the individual capacities of the matrix rows
+// are preserved.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void CompressedSoAMatrix<Type,SO>::reserve( size_t nonzeros )
+{
+   if( nonzeros > capacity() )
+      reserveElements( nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of a specific row/column of the sparse matrix.
+//
+// \param i The row/column index \f$[0..M-1]\f$ or \f$[0..N-1]\f$.
+// \param nonzeros The new minimum capacity of the specified row/column.
+// \return void
+//
+// This function increases the capacity of row/column \a i of the sparse matrix to at least
+// \a nonzeros elements. The current values of the sparse matrix and all other individual
+// row/column capacities are preserved. In case the storage order is set to \a rowMajor, the
+// function reserves capacity for row \a i and the index has to be in the range \f$[0..M-1]\f$.
+// In case the storage order is set to \a columnMajor, the function reserves capacity for column
+// \a i and the index has to be in the range \f$[0..N-1]\f$.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+void CompressedSoAMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row/column access index" );
+
+   BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
+   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+
+   const size_t current( capacity(i) );
+
+   if( current >= nonzeros ) return;
+
+   const size_t additional( nonzeros - current );
+
+   if( end_[m_] - begin_[m_] < additional )
+   {
+      const size_t newCapacity( begin_[m_] - begin_[0UL] + additional );
+      BLAZE_INTERNAL_ASSERT( newCapacity > capacity(), "Invalid capacity value" );
+
+      size_t* newBegin( new size_t[2UL*m_+2UL] );
+      size_t* newEnd  ( newBegin+m_+1UL );
+
+      Type*     newValues ( allocate<Type>( newCapacity ) );
+      uint32_t* newIndices( allocate<uint32_t>( newCapacity ) );
+
+      newBegin[0UL] = 0UL;
+      newEnd  [m_ ] = newCapacity;
+
+      for( size_t k=0UL; k<m_; ++k ) {
+         std::copy( values_ +begin_[k], values_ +end_[k], newValues +newBegin[k] );
+         std::copy( indices_+begin_[k], indices_+end_[k], newIndices+newBegin[k] );
+         newEnd  [k    ] = newBegin[k] + nonZeros(k);
+         newBegin[k+1UL] = newBegin[k] + ( ( k == i )?( nonzeros ):( capacity(k) ) );
+      }
+
+      BLAZE_INTERNAL_ASSERT( newBegin[m_] == newEnd[m_], "Invalid offset calculations" );
+
+      std::swap( newBegin  , begin_   );
+      std::swap( newValues , values_  );
+      std::swap( newIndices, indices_ );
+      deallocate( newValues  );
+      deallocate( newIndices );
+      delete [] newBegin;
+      end_ = newEnd;
+      capacity_ = m_;
+   }
+   else
+   {
+      begin_[m_] += additional;
+      for( size_t j=m_-1UL; j>i; --j ) {
+         std::copy_backward( indices_+begin_[j], indices_+end_[j], indices_+end_[j]+additional );
+         std::copy_backward( values_ +begin_[j], values_ +end_[j], values_ +end_[j]+additional );
+         begin_[j] += additional;
+         end_  [j] += additional;
+      }
+   }
+
+   BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
+   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity from all rows/columns.
+//
+// \return void
+//
+// The trim() function can be used to reverse the effect of all row/column-specific reserve()
+// calls. The function removes all excessive capacity from all rows/columns. Note that this
+// function does not remove the overall capacity but only reduces the capacity per row/column.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void CompressedSoAMatrix<Type,SO>::trim()
+{
+   for( size_t i=0UL; i<m_; ++i )
+      trim( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity of a specific row/column of the sparse matrix.
+//
+// \param i The index of the row/column to be trimmed.
+// \return void
+//
+// This function can be used to reverse the effect of a row/column-specific reserve() call.
+// It removes all excessive capacity from the specified row/column. The excessive capacity
+// is assigned to the subsequent row/column.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void CompressedSoAMatrix<Type,SO>::trim( size_t i )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row/column access index" );
+
+   if( i < ( m_ - 1UL ) ) {
+      std::copy( indices_+begin_[i+1UL], indices_+end_[i+1UL], indices_+end_[i] );
+      end_[i+1UL] = std::copy( values_+begin_[i+1UL], values_+end_[i+1UL], values_+end_[i] ) - values_;
+   }
+   begin_[i+1UL] = end_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Transposing the matrix.
+//
+// \return Reference to the transposed matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline CompressedSoAMatrix<Type,SO>& CompressedSoAMatrix<Type,SO>::transpose()
+{
+   CompressedSoAMatrix tmp( trans( *this ) );
+   swap( tmp );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the sparse matrix by the scalar value \a scalar (\f$ A=B*s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the sparse matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the scalar value
+inline CompressedSoAMatrix<Type,SO>& CompressedSoAMatrix<Type,SO>::scale( const Other& scalar )
+{
+   for( size_t i=0UL; i<m_; ++i )
+      for( size_t k=begin_[i]; k<end_[i]; ++k )
+         values_[k] *= scalar;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling the diagonal of the sparse matrix by the scalar value \a scalar.
+//
+// \param scalar The scalar value for the diagonal scaling.
+// \return Reference to the sparse matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the scalar value
+inline CompressedSoAMatrix<Type,SO>& CompressedSoAMatrix<Type,SO>::scaleDiagonal( Other scalar )
+{
+   const size_t size( blaze::min( m_, n_ ) );
+
+   for( size_t i=0UL; i<size; ++i ) {
+      const size_t pos( lowerOffset( i, i ) );
+      if( pos != end_[i] && indices_[pos] == i )
+         values_[pos] *= scalar;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The sparse matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void CompressedSoAMatrix<Type,SO>::swap( CompressedSoAMatrix& sm ) /* throw() */
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   std::swap( capacity_, sm.capacity_ );
+   std::swap( begin_  , sm.begin_   );
+   std::swap( end_    , sm.end_     );
+   std::swap( values_ , sm.values_  );
+   std::swap( indices_, sm.indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the offset of the first element of row/column \a i not less than index \a j.
+//
+// \param i The row/column index.
+// \param j The column/row index of the search element.
+// \return Offset of the first element not less than index \a j.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t CompressedSoAMatrix<Type,SO>::lowerOffset( size_t i, size_t j ) const
+{
+   return std::lower_bound( indices_+begin_[i], indices_+end_[i], j ) - indices_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the offset of the first element of row/column \a i greater than index \a j.
+//
+// \param i The row/column index.
+// \param j The column/row index of the search element.
+// \return Offset of the first element greater than index \a j.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t CompressedSoAMatrix<Type,SO>::upperOffset( size_t i, size_t j ) const
+{
+   return std::upper_bound( indices_+begin_[i], indices_+end_[i], j ) - indices_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating a new matrix capacity.
+//
+// \return The new compressed matrix capacity.
+//
+// This function calculates a new matrix capacity based on the current capacity of the sparse
+// matrix. Note that the new capacity is restricted to the interval \f$[7..M \cdot N]\f$.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t CompressedSoAMatrix<Type,SO>::extendCapacity() const
+{
+   size_t nonzeros( 2UL*capacity()+1UL );
+   nonzeros = blaze::max( nonzeros, 7UL );
+
+   BLAZE_INTERNAL_ASSERT( nonzeros > capacity(), "Invalid capacity value" );
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reserving the specified number of sparse matrix elements.
+//
+// \param nonzeros The number of matrix elements to be reserved.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+void CompressedSoAMatrix<Type,SO>::reserveElements( size_t nonzeros )
+{
+   size_t* newBegin = new size_t[2UL*capacity_+2UL];
+   size_t* newEnd   = newBegin+capacity_+1UL;
+
+   Type*     newValues ( allocate<Type>( nonzeros ) );
+   uint32_t* newIndices( allocate<uint32_t>( nonzeros ) );
+
+   newBegin[0UL] = 0UL;
+
+   for( size_t k=0UL; k<m_; ++k ) {
+      BLAZE_INTERNAL_ASSERT( begin_[k] <= end_[k], "Invalid row/column offsets" );
+      std::copy( values_ +begin_[k], values_ +end_[k], newValues +newBegin[k] );
+      std::copy( indices_+begin_[k], indices_+end_[k], newIndices+newBegin[k] );
+      newEnd  [k]     = newBegin[k] + nonZeros(k);
+      newBegin[k+1UL] = newBegin[k] + capacity(k);
+   }
+
+   newEnd[m_] = nonzeros;
+
+   std::swap( newBegin  , begin_   );
+   std::swap( newValues , values_  );
+   std::swap( newIndices, indices_ );
+   deallocate( newValues  );
+   deallocate( newIndices );
+   delete [] newBegin;
+   end_ = newEnd;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks that the given size can be represented by the 32-bit element indices.
+//
+// \param n The number of columns (row-major) or rows (column-major) of the matrix.
+// \return The given size \a n.
+// \exception std::invalid_argument Matrix size exceeds the 32-bit index range.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t CompressedSoAMatrix<Type,SO>::checkIndexRange( size_t n )
+{
+   if( n > static_cast<size_t>( Limits<uint32_t>::inf() ) + 1UL )
+      throw std::invalid_argument( "Matrix size exceeds the 32-bit index range" );
+
+   return n;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the element, in case
+// of a column-major matrix a column iterator. In case the element is not found, the function
+// returns the according end() iterator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompressedSoAMatrix<Type,SO>::Iterator
+   CompressedSoAMatrix<Type,SO>::find( size_t i, size_t j )
+{
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+   const size_t pos( lowerOffset( k, l ) );
+
+   if( pos != end_[k] && indices_[pos] == l )
+      return Iterator( values_+pos, indices_+pos );
+   else return end( k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the element, in case
+// of a column-major matrix a column iterator. In case the element is not found, the function
+// returns the according end() iterator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompressedSoAMatrix<Type,SO>::ConstIterator
+   CompressedSoAMatrix<Type,SO>::find( size_t i, size_t j ) const
+{
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+   const size_t pos( lowerOffset( k, l ) );
+
+   if( pos != end_[k] && indices_[pos] == l )
+      return ConstIterator( values_+pos, indices_+pos );
+   else return end( k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompressedSoAMatrix<Type,SO>::Iterator
+   CompressedSoAMatrix<Type,SO>::lowerBound( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( ( SO ? j : i ) < m_, "Invalid row/column access index" );
+   const size_t pos( lowerOffset( SO ? j : i, SO ? i : j ) );
+   return Iterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompressedSoAMatrix<Type,SO>::ConstIterator
+   CompressedSoAMatrix<Type,SO>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( ( SO ? j : i ) < m_, "Invalid row/column access index" );
+   const size_t pos( lowerOffset( SO ? j : i, SO ? i : j ) );
+   return ConstIterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompressedSoAMatrix<Type,SO>::Iterator
+   CompressedSoAMatrix<Type,SO>::upperBound( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( ( SO ? j : i ) < m_, "Invalid row/column access index" );
+   const size_t pos( upperOffset( SO ? j : i, SO ? i : j ) );
+   return Iterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename CompressedSoAMatrix<Type,SO>::ConstIterator
+   CompressedSoAMatrix<Type,SO>::upperBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( ( SO ? j : i ) < m_, "Invalid row/column access index" );
+   const size_t pos( upperOffset( SO ? j : i, SO ? i : j ) );
+   return ConstIterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Appending an element to the specified row/column of the sparse matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be appended.
+// \param check \a true if the new value should be checked for default values, \a false if not.
+// \return void
+//
+// This function provides a very efficient way to fill a compressed matrix with elements. It
+// appends a new element to the end of the specified row/column without any additional memory
+// allocation. Therefore it is strictly necessary to keep the following preconditions in mind:
+//
+//  - the index of the new element must be strictly larger than the largest index of non-zero
+//    elements in the specified row/column of the sparse matrix
+//  - the current number of non-zero elements in the matrix must be smaller than the capacity
+//    of the matrix
+//
+// Ignoring these preconditions might result in undefined behavior! The optional \a check
+// parameter specifies whether the new value should be tested for a default value. If the new
+// value is a default value (for instance 0 in case of an integral element type) the value is
+// not appended. Per default the values are not tested.
+//
+// \note Although append() does not allocate new memory, it still invalidates all iterators
+// returned by the end() functions!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void CompressedSoAMatrix<Type,SO>::append( size_t i, size_t j, const Type& value, bool check )
+{
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+
+   BLAZE_USER_ASSERT( k < m_, "Invalid row/column access index" );
+   BLAZE_USER_ASSERT( l < n_, "Invalid column/row access index" );
+   BLAZE_USER_ASSERT( end_[k] < end_[m_], "Not enough reserved capacity left" );
+   BLAZE_USER_ASSERT( begin_[k] == end_[k] || l > indices_[end_[k]-1UL], "Index is not strictly increasing" );
+
+   values_[end_[k]] = value;
+
+   if( !check || !isDefault( values_[end_[k]] ) ) {
+      indices_[end_[k]] = static_cast<uint32_t>( l );
+      ++end_[k];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Finalizing the element insertion of a row/column.
+//
+// \param i The index of the row/column to be finalized.
+// \return void
+//
+// This function is part of the low-level interface to efficiently fill a matrix with elements.
+// After completion of row/column \a i via the append() function, this function can be called to
+// finalize row/column \a i and prepare the next row/column for insertion process via append().
+//
+// \note Although finalize() does not allocate new memory, it still invalidates all iterators
+// returned by the end() functions!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void CompressedSoAMatrix<Type,SO>::finalize( size_t i )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row/column access index" );
+
+   begin_[i+1UL] = end_[i];
+   if( i != m_-1UL )
+      end_[i+1UL] = end_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the capacities of all rows/columns of an empty sparse matrix.
+//
+// \param nonzeros The number of non-zero elements to reserve for each row/column.
+// \return void
+//
+// This function sets the capacities of all rows (row-major) or columns (column-major) of an
+// empty sparse matrix at once. The matrix must not contain any non-zero elements and the given
+// vector must contain one capacity per row/column. Afterwards, the rows/columns can be filled
+// in arbitrary order via the append() function without any call to finalize().
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+void CompressedSoAMatrix<Type,SO>::reserve( const std::vector<size_t>& nonzeros )
+{
+   BLAZE_USER_ASSERT( nonzeros.size() == m_, "Invalid number of rows/columns" );
+   BLAZE_USER_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
+
+   size_t total( 0UL );
+   for( size_t i=0UL; i<m_; ++i )
+      total += nonzeros[i];
+
+   if( total > capacity() )
+   {
+      size_t* newBegin( new size_t[2UL*m_+2UL] );
+      size_t* newEnd  ( newBegin+m_+1UL );
+
+      Type*     newValues ( allocate<Type>( total ) );
+      uint32_t* newIndices( allocate<uint32_t>( total ) );
+
+      newBegin[0UL] = 0UL;
+      newEnd  [m_ ] = total;
+
+      std::swap( newBegin  , begin_   );
+      std::swap( newValues , values_  );
+      std::swap( newIndices, indices_ );
+      deallocate( newValues  );
+      deallocate( newIndices );
+      delete [] newBegin;
+      end_ = newEnd;
+      capacity_ = m_;
+   }
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      end_  [i    ] = begin_[i];
+      begin_[i+1UL] = begin_[i] + nonzeros[i];
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool CompressedSoAMatrix<Type,SO>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool CompressedSoAMatrix<Type,SO>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// As CompressedMatrix, the compressed SoA matrix is always assigned serially.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline bool CompressedSoAMatrix<Type,SO>::canSMPAssign() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void CompressedSoAMatrix<Type,SO>::assign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   // Bounds of the non-zero elements within a row (row-major) or column (column-major)
+   enum { lower       = ( SO && IsUpper<MT>::value         ) || ( !SO && IsLower<MT>::value         ) };
+   enum { upper       = ( SO && IsLower<MT>::value         ) || ( !SO && IsUpper<MT>::value         ) };
+   enum { strictLower = ( SO && IsStrictlyUpper<MT>::value ) || ( !SO && IsStrictlyLower<MT>::value ) };
+   enum { strictUpper = ( SO && IsStrictlyLower<MT>::value ) || ( !SO && IsStrictlyUpper<MT>::value ) };
+
+   size_t nonzeros( 0UL );
+
+   for( size_t i=1UL; i<=m_; ++i )
+      begin_[i] = end_[i] = end_[m_];
+
+   for( size_t i=0UL; i<m_; ++i )
+   {
+      begin_[i] = end_[i] = nonzeros;
+
+      const size_t jbegin( ( upper )?( strictUpper ? i+1UL : i ):( 0UL ) );
+      const size_t jend  ( ( lower )?( strictLower ? i : i+1UL ):( n_ ) );
+
+      for( size_t j=jbegin; j<jend; ++j )
+      {
+         if( nonzeros == capacity() ) {
+            reserveElements( extendCapacity() );
+            for( size_t k=i+1UL; k<=m_; ++k )
+               begin_[k] = end_[k] = end_[m_];
+         }
+
+         values_[end_[i]] = ( SO )?( (~rhs)(j,i) ):( (~rhs)(i,j) );
+
+         if( !isDefault( values_[end_[i]] ) ) {
+            indices_[end_[i]] = static_cast<uint32_t>( j );
+            ++end_[i];
+            ++nonzeros;
+         }
+      }
+   }
+
+   begin_[m_] = nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse matrix with the same storage order.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void CompressedSoAMatrix<Type,SO>::assign( const SparseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
+   BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
+
+   typedef typename MT::ConstIterator  RhsIterator;
+
+   if( m_ == 0UL || values_ == NULL )
+      return;
+
+   for( size_t i=0UL; i<m_; ++i )
+   {
+      size_t pos( begin_[i] );
+
+      for( RhsIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element, ++pos ) {
+         values_ [pos] = element->value();
+         indices_[pos] = static_cast<uint32_t>( element->index() );
+      }
+
+      begin_[i+1UL] = end_[i] = pos;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse matrix with opposite storage order.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void CompressedSoAMatrix<Type,SO>::assign( const SparseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
+   BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
+
+   typedef typename MT::ConstIterator  RhsIterator;
+
+   // Counting the number of elements per row/column
+   std::vector<size_t> lengths( m_, 0UL );
+   for( size_t j=0UL; j<n_; ++j ) {
+      for( RhsIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+         ++lengths[element->index()];
+   }
+
+   // Resizing the sparse matrix
+   for( size_t i=0UL; i<m_; ++i ) {
+      end_  [i    ] = begin_[i];
+      begin_[i+1UL] = begin_[i] + lengths[i];
+   }
+
+   // Appending the elements to the rows/columns of the sparse matrix
+   for( size_t j=0UL; j<n_; ++j ) {
+      for( RhsIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element ) {
+         const size_t i( element->index() );
+         values_ [end_[i]] = element->value();
+         indices_[end_[i]] = static_cast<uint32_t>( j );
+         ++end_[i];
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void CompressedSoAMatrix<Type,SO>::addAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   CompressedSoAMatrix tmp( serial( *this + (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void CompressedSoAMatrix<Type,SO>::addAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   CompressedSoAMatrix tmp( serial( *this + (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void CompressedSoAMatrix<Type,SO>::subAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   CompressedSoAMatrix tmp( serial( *this - (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand sparse matrix
+inline void CompressedSoAMatrix<Type,SO>::subAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   CompressedSoAMatrix tmp( serial( *this - (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+
+
+
+
+//=================================================================================================
+//
+//  COMPRESSEDSOAMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CompressedSoAMatrix operators */
+//@{
+template< typename Type, bool SO >
+inline void reset( CompressedSoAMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline void reset( CompressedSoAMatrix<Type,SO>& m, size_t i );
+
+template< typename Type, bool SO >
+inline void clear( CompressedSoAMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline bool isDefault( const CompressedSoAMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline void swap( CompressedSoAMatrix<Type,SO>& a, CompressedSoAMatrix<Type,SO>& b ) /* throw() */;
+
+template< typename Type, bool SO >
+inline void move( CompressedSoAMatrix<Type,SO>& dst, CompressedSoAMatrix<Type,SO>& src ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given compressed matrix.
+// \ingroup compressed_soa_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void reset( CompressedSoAMatrix<Type,SO>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column of the given compressed matrix.
+// \ingroup compressed_soa_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row/column to be resetted.
+// \return void
+//
+// This function resets the values in the specified row/column of the given compressed matrix to
+// their default value. In case the given matrix is a \a rowMajor matrix the function resets the
+// values in row \a i, if it is a \a columnMajor matrix the function resets the values in column
+// \a i. Note that the capacity of the row/column remains unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void reset( CompressedSoAMatrix<Type,SO>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given compressed matrix.
+// \ingroup compressed_soa_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void clear( CompressedSoAMatrix<Type,SO>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given compressed matrix is in default state.
+// \ingroup compressed_soa_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+//
+// This function checks whether the compressed matrix is in default (constructed) state, i.e. if
+// it's number of rows and columns is 0. In case it is in default state, the function returns
+// \a true, else it will return \a false. The following example demonstrates the use of the
+// \a isDefault() function:
+
+   \code
+   blaze::CompressedSoAMatrix<int> A;
+   // ... Resizing and initialization
+   if( isDefault( A ) ) { ... }
+   \endcode
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline bool isDefault( const CompressedSoAMatrix<Type,SO>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two compressed matrices.
+// \ingroup compressed_soa_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void swap( CompressedSoAMatrix<Type,SO>& a, CompressedSoAMatrix<Type,SO>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moving the contents of one compressed matrix to another.
+// \ingroup compressed_soa_matrix
+//
+// \param dst The destination matrix.
+// \param src The source matrix.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void move( CompressedSoAMatrix<Type,SO>& dst, CompressedSoAMatrix<Type,SO>& src ) /* throw() */
+{
+   dst.swap( src );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsResizable< CompressedSoAMatrix<T,SO> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2, size_t M, size_t N >
+struct AddTrait< CompressedSoAMatrix<T1,SO>, StaticMatrix<T2,M,N,SO> >
+{
+   typedef StaticMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct AddTrait< CompressedSoAMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+{
+   typedef StaticMatrix< typename AddTrait<T1,T2>::Type, M, N, SO2 >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2 >
+struct AddTrait< StaticMatrix<T1,M,N,SO>, CompressedSoAMatrix<T2,SO> >
+{
+   typedef StaticMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
+struct AddTrait< StaticMatrix<T1,M,N,SO1>, CompressedSoAMatrix<T2,SO2> >
+{
+   typedef StaticMatrix< typename AddTrait<T1,T2>::Type, M, N, SO1 >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t M, size_t N >
+struct AddTrait< CompressedSoAMatrix<T1,SO>, HybridMatrix<T2,M,N,SO> >
+{
+   typedef HybridMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct AddTrait< CompressedSoAMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+{
+   typedef HybridMatrix< typename AddTrait<T1,T2>::Type, M, N, SO2 >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2 >
+struct AddTrait< HybridMatrix<T1,M,N,SO>, CompressedSoAMatrix<T2,SO> >
+{
+   typedef HybridMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
+struct AddTrait< HybridMatrix<T1,M,N,SO1>, CompressedSoAMatrix<T2,SO2> >
+{
+   typedef HybridMatrix< typename AddTrait<T1,T2>::Type, M, N, SO1 >  Type;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct AddTrait< CompressedSoAMatrix<T1,SO>, DynamicMatrix<T2,SO> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type , SO >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct AddTrait< CompressedSoAMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type , SO2 >  Type;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct AddTrait< DynamicMatrix<T1,SO>, CompressedSoAMatrix<T2,SO> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type , SO >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct AddTrait< DynamicMatrix<T1,SO1>, CompressedSoAMatrix<T2,SO2> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type , SO1 >  Type;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct AddTrait< CompressedSoAMatrix<T1,SO>, CompressedSoAMatrix<T2,SO> >
+{
+   typedef CompressedSoAMatrix< typename AddTrait<T1,T2>::Type , SO >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct AddTrait< CompressedSoAMatrix<T1,SO1>, CompressedSoAMatrix<T2,SO2> >
+{
+   typedef CompressedSoAMatrix< typename AddTrait<T1,T2>::Type , false >  Type;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct AddTrait< CompressedSoAMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+{
+   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type , SO >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct AddTrait< CompressedSoAMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+{
+   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type , false >  Type;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct AddTrait< CompressedMatrix<T1,SO>, CompressedSoAMatrix<T2,SO> >
+{
+   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type , SO >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct AddTrait< CompressedMatrix<T1,SO1>, CompressedSoAMatrix<T2,SO2> >
+{
+   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type , false >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2, size_t M, size_t N >
+struct SubTrait< CompressedSoAMatrix<T1,SO>, StaticMatrix<T2,M,N,SO> >
+{
+   typedef StaticMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct SubTrait< CompressedSoAMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+{
+   typedef StaticMatrix< typename SubTrait<T1,T2>::Type, M, N, SO2 >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2 >
+struct SubTrait< StaticMatrix<T1,M,N,SO>, CompressedSoAMatrix<T2,SO> >
+{
+   typedef StaticMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
+struct SubTrait< StaticMatrix<T1,M,N,SO1>, CompressedSoAMatrix<T2,SO2> >
+{
+   typedef StaticMatrix< typename SubTrait<T1,T2>::Type, M, N, SO1 >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t M, size_t N >
+struct SubTrait< CompressedSoAMatrix<T1,SO>, HybridMatrix<T2,M,N,SO> >
+{
+   typedef HybridMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct SubTrait< CompressedSoAMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+{
+   typedef HybridMatrix< typename SubTrait<T1,T2>::Type, M, N, SO2 >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2 >
+struct SubTrait< HybridMatrix<T1,M,N,SO>, CompressedSoAMatrix<T2,SO> >
+{
+   typedef HybridMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
+struct SubTrait< HybridMatrix<T1,M,N,SO1>, CompressedSoAMatrix<T2,SO2> >
+{
+   typedef HybridMatrix< typename SubTrait<T1,T2>::Type, M, N, SO1 >  Type;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct SubTrait< CompressedSoAMatrix<T1,SO>, DynamicMatrix<T2,SO> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type , SO >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct SubTrait< CompressedSoAMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type , SO2 >  Type;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct SubTrait< DynamicMatrix<T1,SO>, CompressedSoAMatrix<T2,SO> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type , SO >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct SubTrait< DynamicMatrix<T1,SO1>, CompressedSoAMatrix<T2,SO2> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type , SO1 >  Type;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct SubTrait< CompressedSoAMatrix<T1,SO>, CompressedSoAMatrix<T2,SO> >
+{
+   typedef CompressedSoAMatrix< typename SubTrait<T1,T2>::Type , SO >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct SubTrait< CompressedSoAMatrix<T1,SO1>, CompressedSoAMatrix<T2,SO2> >
+{
+   typedef CompressedSoAMatrix< typename SubTrait<T1,T2>::Type , false >  Type;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct SubTrait< CompressedSoAMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+{
+   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type , SO >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct SubTrait< CompressedSoAMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+{
+   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type , false >  Type;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct SubTrait< CompressedMatrix<T1,SO>, CompressedSoAMatrix<T2,SO> >
+{
+   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type , SO >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct SubTrait< CompressedMatrix<T1,SO1>, CompressedSoAMatrix<T2,SO2> >
+{
+   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type , false >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2 >
+struct MultTrait< CompressedSoAMatrix<T1,SO>, T2 >
+{
+   typedef CompressedSoAMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+
+template< typename T1, typename T2, bool SO >
+struct MultTrait< T1, CompressedSoAMatrix<T2,SO> >
+{
+   typedef CompressedSoAMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T1 );
+};
+
+template< typename T1, bool SO, typename T2, size_t N >
+struct MultTrait< CompressedSoAMatrix<T1,SO>, StaticVector<T2,N,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t N, typename T2, bool SO >
+struct MultTrait< StaticVector<T1,N,true>, CompressedSoAMatrix<T2,SO> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t N >
+struct MultTrait< CompressedSoAMatrix<T1,SO>, HybridVector<T2,N,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t N, typename T2, bool SO >
+struct MultTrait< HybridVector<T1,N,true>, CompressedSoAMatrix<T2,SO> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct MultTrait< CompressedSoAMatrix<T1,SO>, DynamicVector<T2,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename T2, bool SO >
+struct MultTrait< DynamicVector<T1,true>, CompressedSoAMatrix<T2,SO> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct MultTrait< CompressedSoAMatrix<T1,SO>, CompressedVector<T2,false> >
+{
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename T2, bool SO >
+struct MultTrait< CompressedVector<T1,true>, CompressedSoAMatrix<T2,SO> >
+{
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct MultTrait< CompressedSoAMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
+struct MultTrait< StaticMatrix<T1,M,N,SO1>, CompressedSoAMatrix<T2,SO2> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct MultTrait< CompressedSoAMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
+struct MultTrait< HybridMatrix<T1,M,N,SO1>, CompressedSoAMatrix<T2,SO2> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct MultTrait< CompressedSoAMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct MultTrait< DynamicMatrix<T1,SO1>, CompressedSoAMatrix<T2,SO2> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct MultTrait< CompressedSoAMatrix<T1,SO1>, CompressedSoAMatrix<T2,SO2> >
+{
+   typedef CompressedSoAMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct MultTrait< CompressedSoAMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct MultTrait< CompressedMatrix<T1,SO1>, CompressedSoAMatrix<T2,SO2> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DIVTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2 >
+struct DivTrait< CompressedSoAMatrix<T1,SO>, T2 >
+{
+   typedef CompressedSoAMatrix< typename DivTrait<T1,T2>::Type, SO >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATHTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2 >
+struct MathTrait< CompressedSoAMatrix<T1,SO>, CompressedSoAMatrix<T2,SO> >
+{
+   typedef CompressedSoAMatrix< typename MathTrait<T1,T2>::HighType, SO >  HighType;
+   typedef CompressedSoAMatrix< typename MathTrait<T1,T2>::LowType , SO >  LowType;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct SubmatrixTrait< CompressedSoAMatrix<T1,SO> >
+{
+   typedef CompressedSoAMatrix<T1,SO>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct RowTrait< CompressedSoAMatrix<T1,SO> >
+{
+   typedef CompressedVector<T1,true>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct ColumnTrait< CompressedSoAMatrix<T1,SO> >
+{
+   typedef CompressedVector<T1,false>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
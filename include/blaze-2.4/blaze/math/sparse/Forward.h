@@ -36,6 +36,13 @@
 #define _BLAZE_MATH_SPARSE_FORWARD_H_
 
 
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Types.h>
+
+
 namespace blaze {
 
 //=================================================================================================
@@ -44,8 +51,11 @@ namespace blaze {
 //
 //=================================================================================================
 
+template< typename, size_t > class CompressedBlockMatrix;
 template< typename, bool > class CompressedMatrix;
+template< typename, bool > class CompressedSoAMatrix;
 template< typename, bool > class CompressedVector;
+template< typename, size_t > class SlicedEllpackMatrix;
 
 } // namespace blaze
 
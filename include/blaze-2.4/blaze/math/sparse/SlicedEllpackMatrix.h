@@ -0,0 +1,2269 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SlicedEllpackMatrix.h
+//  \brief Implementation of a sliced ELLPACK (SELL-C-sigma) MxN matrix
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SLICEDELLPACKMATRIX_H_
+#define _BLAZE_MATH_SPARSE_SLICEDELLPACKMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/SparseElement.h>
+#include <blaze/math/traits/AddTrait.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/DivTrait.h>
+#include <blaze/math/traits/MathTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Limits.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup sliced_ellpack_matrix SlicedEllpackMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Sliced ELLPACK (SELL-C-\f$ \sigma \f$) row-major \f$ M \times N \f$ matrix.
+// \ingroup sliced_ellpack_matrix
+//
+// The SlicedEllpackMatrix class template stores a row-major sparse matrix in the SELL-C-\f$ \sigma
+// \f$ format, which is tailored to the vectorized sparse matrix/dense vector multiplication:
+
+   \code
+   template< typename Type, size_t C >
+   class SlicedEllpackMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. SlicedEllpackMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - C   : specifies the chunk height, i.e. the number of rows that are processed simultaneously
+//          by the sparse matrix/dense vector multiplication. For double precision values the
+//          default of 8 corresponds to a single AVX-512 vector or two AVX vectors.
+//
+// The rows of the matrix are grouped into chunks of \a C consecutive rows. All rows of a chunk
+// are padded to the length of the longest row of the chunk and the elements of a chunk are stored
+// column by column, i.e. the k-th elements of the \a C rows are stored contiguously. Therefore
+// the multiplication with a dense vector processes a chunk by means of \a C independent
+// accumulators, which are updated by one vector of values and one gather of the dense vector per
+// column of the chunk, independent of the actual length of the rows. In order to reduce the
+// padding for matrices with strongly varying row lengths (as for instance the adjacency matrices
+// of power-law graphs), the rows are sorted by decreasing length within windows of \f$ \sigma \f$
+// rows before they are grouped into chunks. The sorting scope \f$ \sigma \f$ is specified at
+// construction time (see blaze::SLICEDELLPACK_SORTING_SCOPE for the default) and is rounded down
+// to a multiple of \a C. Since rows are never moved across windows, the parallel multiplication
+// splits the matrix at window boundaries.
+//
+// In expressions, SlicedEllpackMatrix can be used as a read-only row-major sparse matrix. It
+// provides access to the elements via the function call operator and via iterators over the rows
+// of the matrix in the original row order. The matrix is set up via conversion from any other
+// matrix:
+
+   \code
+   using blaze::SlicedEllpackMatrix;
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+
+   CompressedMatrix<double> A( 100000UL, 100000UL );
+   // ... Initialization of the matrix
+
+   SlicedEllpackMatrix<double> B( A );             // Conversion with the default sorting scope
+   SlicedEllpackMatrix<double,16UL> S( A, 64UL );  // Conversion with a sorting scope of 64 rows
+
+   DynamicVector<double,columnVector> x( 100000UL, 1.0 ), y;
+   DynamicVector<double,rowVector> z;
+
+   y = B * x;             // Sliced ELLPACK matrix/dense vector multiplication
+   z = trans( x ) * S;    // Transpose dense vector/sliced ELLPACK matrix multiplication
+
+   CompressedMatrix<double> D( B );  // Conversion back into the original row order
+   \endcode
+
+// Note that the padding elements are multiplied with a valid element of the dense vector. Thus
+// in case the dense vector contains infinite or NaN values, the result of the multiplication
+// may contain NaN values where the compressed formats would produce infinite values.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , size_t C = 8UL >  // Number of rows per chunk
+class SlicedEllpackMatrix : public SparseMatrix< SlicedEllpackMatrix<Type,C>, false >
+{
+ public:
+   //**Element class definition********************************************************************
+   /*!\brief Access proxy for a single element of a sliced ELLPACK matrix.
+   */
+   class SlicedElement : private SparseElement
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef Type         ValueType;       //!< The value type of the element.
+      typedef size_t       IndexType;       //!< The index type of the element.
+      typedef const Type&  Reference;       //!< Reference return type.
+      typedef const Type&  ConstReference;  //!< Reference-to-const return type.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the SlicedElement class.
+      //
+      // \param value Pointer to the referenced value.
+      // \param index The column index of the referenced value.
+      */
+      inline SlicedElement( const Type* value, size_t index )
+         : value_( value )  // Pointer to the referenced value
+         , index_( index )  // The column index of the referenced value
+      {}
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the referenced sparse element.
+      //
+      // \return Pointer to the referenced sparse element.
+      */
+      inline const SlicedElement* operator->() const {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline Reference value() const {
+         return *value_;
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      inline IndexType index() const {
+         return index_;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const Type* value_;  //!< Pointer to the referenced value.
+      size_t index_;       //!< The column index of the referenced value.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Iterator class definition*******************************************************************
+   /*!\brief Iterator over the elements of a single row of a sliced ELLPACK matrix.
+   //
+   // The SlicedRowIterator traverses the lane of a row within its chunk, i.e. it advances by
+   // \a C values and column indices per element.
+   */
+   class SlicedRowIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef std::forward_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef SlicedElement              ValueType;         //!< Type of the underlying elements.
+      typedef ValueType                  PointerType;       //!< Pointer return type.
+      typedef ValueType                  ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                  DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Default constructor**********************************************************************
+      /*!\brief Default constructor for the SlicedRowIterator class.
+      */
+      inline SlicedRowIterator()
+         : value_( NULL )  // Pointer to the current value
+         , index_( NULL )  // Pointer to the column index of the current value
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the SlicedRowIterator class.
+      //
+      // \param value Pointer to the current value.
+      // \param index Pointer to the column index of the current value.
+      */
+      inline SlicedRowIterator( const Type* value, const uint32_t* index )
+         : value_( value )  // Pointer to the current value
+         , index_( index )  // Pointer to the column index of the current value
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline SlicedRowIterator& operator++() {
+         value_ += C;
+         index_ += C;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const SlicedRowIterator operator++( int ) {
+         const SlicedRowIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the current sparse matrix element.
+      //
+      // \return Reference to the current sparse matrix element.
+      */
+      inline ReferenceType operator*() const {
+         return ReferenceType( value_, *index_ );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the current sparse matrix element.
+      //
+      // \return Pointer to the current sparse matrix element.
+      */
+      inline PointerType operator->() const {
+         return PointerType( value_, *index_ );
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two SlicedRowIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const SlicedRowIterator& rhs ) const {
+         return ( value_ == rhs.value_ );
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two SlicedRowIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const SlicedRowIterator& rhs ) const {
+         return !( *this == rhs );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const SlicedRowIterator& rhs ) const {
+         return ( value_ - rhs.value_ ) / DifferenceType( C );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const Type* value_;      //!< Pointer to the current value.
+      const uint32_t* index_;  //!< Pointer to the column index of the current value.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef SlicedEllpackMatrix<Type,C>  This;            //!< Type of this SlicedEllpackMatrix instance.
+   typedef This                         ResultType;      //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,true>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,true>  TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                         ElementType;     //!< Type of the sparse matrix elements.
+   typedef const Type&                  ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                  CompositeType;   //!< Data type for composite expression templates.
+   typedef const Type&                  Reference;       //!< Reference to a sparse matrix value.
+   typedef const Type&                  ConstReference;  //!< Reference to a constant sparse matrix value.
+   typedef SlicedRowIterator            Iterator;        //!< Iterator over non-constant elements.
+   typedef SlicedRowIterator            ConstIterator;   //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a SlicedEllpackMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef SlicedEllpackMatrix<ET,C>  Other;  //!< The type of the other SlicedEllpackMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum { smpAssignable = !IsSMPAssignable<Type>::value };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+                            explicit inline SlicedEllpackMatrix();
+                            explicit inline SlicedEllpackMatrix( size_t m, size_t n );
+                                     inline SlicedEllpackMatrix( const SlicedEllpackMatrix& sm );
+   template< typename MT, bool SO2 > inline SlicedEllpackMatrix( const DenseMatrix<MT,SO2>&  dm );
+   template< typename MT, bool SO2 > inline SlicedEllpackMatrix( const DenseMatrix<MT,SO2>&  dm, size_t sigma );
+   template< typename MT, bool SO2 > inline SlicedEllpackMatrix( const SparseMatrix<MT,SO2>& sm );
+   template< typename MT, bool SO2 > inline SlicedEllpackMatrix( const SparseMatrix<MT,SO2>& sm, size_t sigma );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~SlicedEllpackMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                                     inline SlicedEllpackMatrix& operator= ( const SlicedEllpackMatrix& rhs );
+   template< typename MT, bool SO2 > inline SlicedEllpackMatrix& operator= ( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline SlicedEllpackMatrix& operator+=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline SlicedEllpackMatrix& operator-=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline SlicedEllpackMatrix& operator*=( const Matrix<MT,SO2>& rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, SlicedEllpackMatrix >::Type&
+      operator*=( Other rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, SlicedEllpackMatrix >::Type&
+      operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                              inline size_t               rows() const;
+                              inline size_t               columns() const;
+                              inline size_t               sigma() const;
+                              inline size_t               capacity() const;
+                              inline size_t               nonZeros() const;
+                              inline size_t               nonZeros( size_t i ) const;
+                              inline void                 reset();
+                              inline void                 clear();
+   template< typename Other > inline SlicedEllpackMatrix& scale( const Other& scalar );
+                              inline void                 swap( SlicedEllpackMatrix& sm ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   inline size_t          chunks() const;
+   inline size_t          chunkWidth  ( size_t c ) const;
+   inline const Type*     chunkValues ( size_t c ) const;
+   inline const uint32_t* chunkIndices( size_t c ) const;
+   inline const uint32_t* chunkRows   ( size_t c ) const;
+   inline const uint32_t* chunkLengths( size_t c ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool canSMPAssign() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Comparison functor**************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Ordering of rows by decreasing number of non-zero elements.
+   */
+   struct LongerRow
+   {
+      explicit inline LongerRow( const std::vector<size_t>& nonzeros )
+         : nonzeros_( nonzeros )  // The number of non-zero elements of the rows
+      {}
+
+      inline bool operator()( uint32_t i, uint32_t j ) const {
+         return nonzeros_[i] > nonzeros_[j];
+      }
+
+      const std::vector<size_t>& nonzeros_;  //!< The number of non-zero elements of the rows.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >
+   inline typename DisableIf< IsExpression<MT> >::Type convert( const SparseMatrix<MT,false>& sm );
+
+   template< typename MT, bool SO2 >
+   inline void convert( const Matrix<MT,SO2>& m );
+
+   template< typename MT >
+   void build( const MT& A );
+
+   inline size_t lowerOffset( size_t i, size_t j ) const;
+
+   static inline size_t checkSize( size_t n );
+   static inline size_t checkSigma( size_t sigma );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;           //!< The current number of rows of the sparse matrix.
+   size_t n_;           //!< The current number of columns of the sparse matrix.
+   size_t sigma_;       //!< The sorting scope, i.e. the number of rows sorted by length.
+   size_t nonzeros_;    //!< The total number of non-zero elements.
+   size_t* offsets_;    //!< Offsets of the first value of each chunk.
+   Type* values_;       //!< The values of the non-zero and padding elements.
+   uint32_t* indices_;  //!< The column indices of the non-zero and padding elements.
+   uint32_t* rows_;     //!< The original row index of each lane (\a M for padding lanes).
+   uint32_t* lengths_;  //!< The number of non-zero elements of each lane.
+   uint32_t* slots_;    //!< The lane of each original row.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_STATIC_ASSERT( C > 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, size_t C >
+const Type SlicedEllpackMatrix<Type,C>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SlicedEllpackMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline SlicedEllpackMatrix<Type,C>::SlicedEllpackMatrix()
+   : m_       ( 0UL )                                             // The current number of rows of the sparse matrix
+   , n_       ( 0UL )                                             // The current number of columns of the sparse matrix
+   , sigma_   ( checkSigma( SLICEDELLPACK_SORTING_SCOPE ) )       // The sorting scope
+   , nonzeros_( 0UL )                                             // The total number of non-zero elements
+   , offsets_ ( new size_t[1] )                                   // Offsets of the first value of each chunk
+   , values_  ( NULL )                                            // The values of the non-zero and padding elements
+   , indices_ ( NULL )                                            // The column indices of the non-zero and padding elements
+   , rows_    ( NULL )                                            // The original row index of each lane
+   , lengths_ ( NULL )                                            // The number of non-zero elements of each lane
+   , slots_   ( NULL )                                            // The lane of each original row
+{
+   offsets_[0] = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Invalid matrix size.
+//
+// The matrix is initialized to the zero matrix. In case the number of rows or columns exceeds
+// the range of the 32-bit indices, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline SlicedEllpackMatrix<Type,C>::SlicedEllpackMatrix( size_t m, size_t n )
+   : m_       ( checkSize( m ) )                                  // The current number of rows of the sparse matrix
+   , n_       ( checkSize( n ) )                                  // The current number of columns of the sparse matrix
+   , sigma_   ( checkSigma( SLICEDELLPACK_SORTING_SCOPE ) )       // The sorting scope
+   , nonzeros_( 0UL )                                             // The total number of non-zero elements
+   , offsets_ ( new size_t[chunks()+1UL] )                        // Offsets of the first value of each chunk
+   , values_  ( NULL )                                            // The values of the non-zero and padding elements
+   , indices_ ( NULL )                                            // The column indices of the non-zero and padding elements
+   , rows_    ( allocate<uint32_t>( chunks()*C ) )                // The original row index of each lane
+   , lengths_ ( allocate<uint32_t>( chunks()*C ) )                // The number of non-zero elements of each lane
+   , slots_   ( allocate<uint32_t>( m_ ) )                        // The lane of each original row
+{
+   reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for SlicedEllpackMatrix.
+//
+// \param sm Sparse matrix to be copied.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline SlicedEllpackMatrix<Type,C>::SlicedEllpackMatrix( const SlicedEllpackMatrix& sm )
+   : m_       ( sm.m_ )                                 // The current number of rows of the sparse matrix
+   , n_       ( sm.n_ )                                 // The current number of columns of the sparse matrix
+   , sigma_   ( sm.sigma_ )                             // The sorting scope
+   , nonzeros_( sm.nonzeros_ )                          // The total number of non-zero elements
+   , offsets_ ( new size_t[chunks()+1UL] )              // Offsets of the first value of each chunk
+   , values_  ( allocate<Type>( sm.capacity() ) )       // The values of the non-zero and padding elements
+   , indices_ ( allocate<uint32_t>( sm.capacity() ) )   // The column indices of the non-zero and padding elements
+   , rows_    ( allocate<uint32_t>( chunks()*C ) )      // The original row index of each lane
+   , lengths_ ( allocate<uint32_t>( chunks()*C ) )      // The number of non-zero elements of each lane
+   , slots_   ( allocate<uint32_t>( m_ ) )              // The lane of each original row
+{
+   std::copy( sm.offsets_, sm.offsets_+chunks()+1UL, offsets_ );
+   std::copy( sm.values_ , sm.values_ +capacity()  , values_  );
+   std::copy( sm.indices_, sm.indices_+capacity()  , indices_ );
+   std::copy( sm.rows_   , sm.rows_   +chunks()*C  , rows_    );
+   std::copy( sm.lengths_, sm.lengths_+chunks()*C  , lengths_ );
+   std::copy( sm.slots_  , sm.slots_  +m_          , slots_   );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from dense matrices.
+//
+// \param dm Dense matrix to be copied.
+// \exception std::invalid_argument Invalid matrix size.
+//
+// All non-default elements of the given dense matrix are stored as non-zero elements. The rows
+// are sorted within the default sorting scope (see blaze::SLICEDELLPACK_SORTING_SCOPE). In case
+// the number of rows or columns exceeds the range of the 32-bit indices, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+template< typename MT    // Type of the foreign dense matrix
+        , bool SO2 >     // Storage order of the foreign dense matrix
+inline SlicedEllpackMatrix<Type,C>::SlicedEllpackMatrix( const DenseMatrix<MT,SO2>& dm )
+   : m_       ( checkSize( (~dm).rows()    ) )                    // The current number of rows of the sparse matrix
+   , n_       ( checkSize( (~dm).columns() ) )                    // The current number of columns of the sparse matrix
+   , sigma_   ( checkSigma( SLICEDELLPACK_SORTING_SCOPE ) )       // The sorting scope
+   , nonzeros_( 0UL )                                             // The total number of non-zero elements
+   , offsets_ ( new size_t[chunks()+1UL] )                        // Offsets of the first value of each chunk
+   , values_  ( NULL )                                            // The values of the non-zero and padding elements
+   , indices_ ( NULL )                                            // The column indices of the non-zero and padding elements
+   , rows_    ( allocate<uint32_t>( chunks()*C ) )                // The original row index of each lane
+   , lengths_ ( allocate<uint32_t>( chunks()*C ) )                // The number of non-zero elements of each lane
+   , slots_   ( allocate<uint32_t>( m_ ) )                        // The lane of each original row
+{
+   convert( ~dm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from dense matrices with a specific sorting scope.
+//
+// \param dm Dense matrix to be copied.
+// \param sigma The number of rows that are sorted by their number of non-zero elements.
+// \exception std::invalid_argument Invalid matrix size.
+//
+// All non-default elements of the given dense matrix are stored as non-zero elements. The rows
+// are sorted within windows of \a sigma rows, which is rounded down to a multiple of the chunk
+// height \a C. In case the number of rows or columns exceeds the range of the 32-bit indices, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+template< typename MT    // Type of the foreign dense matrix
+        , bool SO2 >     // Storage order of the foreign dense matrix
+inline SlicedEllpackMatrix<Type,C>::SlicedEllpackMatrix( const DenseMatrix<MT,SO2>& dm, size_t sigma )
+   : m_       ( checkSize( (~dm).rows()    ) )      // The current number of rows of the sparse matrix
+   , n_       ( checkSize( (~dm).columns() ) )      // The current number of columns of the sparse matrix
+   , sigma_   ( checkSigma( sigma ) )               // The sorting scope
+   , nonzeros_( 0UL )                               // The total number of non-zero elements
+   , offsets_ ( new size_t[chunks()+1UL] )          // Offsets of the first value of each chunk
+   , values_  ( NULL )                              // The values of the non-zero and padding elements
+   , indices_ ( NULL )                              // The column indices of the non-zero and padding elements
+   , rows_    ( allocate<uint32_t>( chunks()*C ) )  // The original row index of each lane
+   , lengths_ ( allocate<uint32_t>( chunks()*C ) )  // The number of non-zero elements of each lane
+   , slots_   ( allocate<uint32_t>( m_ ) )          // The lane of each original row
+{
+   convert( ~dm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different sparse matrices.
+//
+// \param sm Sparse matrix to be copied.
+// \exception std::invalid_argument Invalid matrix size.
+//
+// The rows are sorted within the default sorting scope (see blaze::SLICEDELLPACK_SORTING_SCOPE).
+// In case the number of rows or columns exceeds the range of the 32-bit indices, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+template< typename MT    // Type of the foreign sparse matrix
+        , bool SO2 >     // Storage order of the foreign sparse matrix
+inline SlicedEllpackMatrix<Type,C>::SlicedEllpackMatrix( const SparseMatrix<MT,SO2>& sm )
+   : m_       ( checkSize( (~sm).rows()    ) )                    // The current number of rows of the sparse matrix
+   , n_       ( checkSize( (~sm).columns() ) )                    // The current number of columns of the sparse matrix
+   , sigma_   ( checkSigma( SLICEDELLPACK_SORTING_SCOPE ) )       // The sorting scope
+   , nonzeros_( 0UL )                                             // The total number of non-zero elements
+   , offsets_ ( new size_t[chunks()+1UL] )                        // Offsets of the first value of each chunk
+   , values_  ( NULL )                                            // The values of the non-zero and padding elements
+   , indices_ ( NULL )                                            // The column indices of the non-zero and padding elements
+   , rows_    ( allocate<uint32_t>( chunks()*C ) )                // The original row index of each lane
+   , lengths_ ( allocate<uint32_t>( chunks()*C ) )                // The number of non-zero elements of each lane
+   , slots_   ( allocate<uint32_t>( m_ ) )                        // The lane of each original row
+{
+   convert( ~sm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different sparse matrices with a specific sorting scope.
+//
+// \param sm Sparse matrix to be copied.
+// \param sigma The number of rows that are sorted by their number of non-zero elements.
+// \exception std::invalid_argument Invalid matrix size.
+//
+// The rows are sorted within windows of \a sigma rows, which is rounded down to a multiple of
+// the chunk height \a C. In case the number of rows or columns exceeds the range of the 32-bit
+// indices, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+template< typename MT    // Type of the foreign sparse matrix
+        , bool SO2 >     // Storage order of the foreign sparse matrix
+inline SlicedEllpackMatrix<Type,C>::SlicedEllpackMatrix( const SparseMatrix<MT,SO2>& sm, size_t sigma )
+   : m_       ( checkSize( (~sm).rows()    ) )      // The current number of rows of the sparse matrix
+   , n_       ( checkSize( (~sm).columns() ) )      // The current number of columns of the sparse matrix
+   , sigma_   ( checkSigma( sigma ) )               // The sorting scope
+   , nonzeros_( 0UL )                               // The total number of non-zero elements
+   , offsets_ ( new size_t[chunks()+1UL] )          // Offsets of the first value of each chunk
+   , values_  ( NULL )                              // The values of the non-zero and padding elements
+   , indices_ ( NULL )                              // The column indices of the non-zero and padding elements
+   , rows_    ( allocate<uint32_t>( chunks()*C ) )  // The original row index of each lane
+   , lengths_ ( allocate<uint32_t>( chunks()*C ) )  // The number of non-zero elements of each lane
+   , slots_   ( allocate<uint32_t>( m_ ) )          // The lane of each original row
+{
+   convert( ~sm );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for SlicedEllpackMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline SlicedEllpackMatrix<Type,C>::~SlicedEllpackMatrix()
+{
+   deallocate( values_  );
+   deallocate( indices_ );
+   deallocate( rows_    );
+   deallocate( lengths_ );
+   deallocate( slots_   );
+   delete [] offsets_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline typename SlicedEllpackMatrix<Type,C>::ConstReference
+   SlicedEllpackMatrix<Type,C>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+
+   const ConstIterator pos( find( i, j ) );
+
+   if( pos != end( i ) )
+      return pos->value();
+   else return zero_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline typename SlicedEllpackMatrix<Type,C>::ConstIterator
+   SlicedEllpackMatrix<Type,C>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   const size_t pos( offsets_[slots_[i]/C] + slots_[i]%C );
+   return ConstIterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline typename SlicedEllpackMatrix<Type,C>::ConstIterator
+   SlicedEllpackMatrix<Type,C>::cbegin( size_t i ) const
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline typename SlicedEllpackMatrix<Type,C>::ConstIterator
+   SlicedEllpackMatrix<Type,C>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   const size_t pos( offsets_[slots_[i]/C] + slots_[i]%C + lengths_[slots_[i]]*C );
+   return ConstIterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline typename SlicedEllpackMatrix<Type,C>::ConstIterator
+   SlicedEllpackMatrix<Type,C>::cend( size_t i ) const
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for SlicedEllpackMatrix.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+//
+// The sparse matrix is resized according to the given sparse matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline SlicedEllpackMatrix<Type,C>&
+   SlicedEllpackMatrix<Type,C>::operator=( const SlicedEllpackMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   SlicedEllpackMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+// \exception std::invalid_argument Invalid matrix size.
+//
+// The sparse matrix is resized according to the given matrix and initialized as a copy of
+// this matrix. The current sorting scope is preserved. In case the number of rows or columns
+// of the given matrix exceeds the range of the 32-bit indices, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline SlicedEllpackMatrix<Type,C>&
+   SlicedEllpackMatrix<Type,C>::operator=( const Matrix<MT,SO2>& rhs )
+{
+   SlicedEllpackMatrix tmp( ~rhs, sigma_ );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline SlicedEllpackMatrix<Type,C>&
+   SlicedEllpackMatrix<Type,C>::operator+=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   SlicedEllpackMatrix tmp( *this + (~rhs), sigma_ );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline SlicedEllpackMatrix<Type,C>&
+   SlicedEllpackMatrix<Type,C>::operator-=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   SlicedEllpackMatrix tmp( *this - (~rhs), sigma_ );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a matrix (\f$ A*=B \f$).
+//
+// \param rhs The right-hand side matrix for the multiplication.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two given matrices don't match, a \a std::invalid_argument
+// is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline SlicedEllpackMatrix<Type,C>&
+   SlicedEllpackMatrix<Type,C>::operator*=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   SlicedEllpackMatrix tmp( *this * (~rhs), sigma_ );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a sparse matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the sparse matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , size_t C >        // Number of rows per chunk
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, SlicedEllpackMatrix<Type,C> >::Type&
+   SlicedEllpackMatrix<Type,C>::operator*=( Other rhs )
+{
+   return scale( rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a sparse matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+//
+// Only the non-zero elements are divided, i.e. the padding elements remain zero.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , size_t C >        // Number of rows per chunk
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, SlicedEllpackMatrix<Type,C> >::Type&
+   SlicedEllpackMatrix<Type,C>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   for( size_t s=0UL; s<m_; ++s ) {
+      Type* value( values_ + offsets_[s/C] + s%C );
+      for( size_t k=0UL; k<lengths_[s]; ++k, value+=C )
+         *value /= rhs;
+   }
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline size_t SlicedEllpackMatrix<Type,C>::rows() const
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline size_t SlicedEllpackMatrix<Type,C>::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the sorting scope of the sparse matrix.
+//
+// \return The number of rows that are sorted by their number of non-zero elements.
+//
+// The sorting scope is a multiple of the chunk height \a C. The rows are only reordered within
+// the windows \f$ [k \sigma..(k+1) \sigma) \f$.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline size_t SlicedEllpackMatrix<Type,C>::sigma() const
+{
+   return sigma_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the sparse matrix.
+//
+// \return The capacity of the sparse matrix.
+//
+// The capacity corresponds to the number of stored elements, i.e. the number of non-zero
+// elements plus the number of padding elements.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline size_t SlicedEllpackMatrix<Type,C>::capacity() const
+{
+   return offsets_[chunks()];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the sparse matrix.
+//
+// \return The number of non-zero elements in the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline size_t SlicedEllpackMatrix<Type,C>::nonZeros() const
+{
+   return nonzeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline size_t SlicedEllpackMatrix<Type,C>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+   return lengths_[slots_[i]];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function removes all non-zero elements and restores the original row order.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline void SlicedEllpackMatrix<Type,C>::reset()
+{
+   const size_t lanes( chunks()*C );
+
+   for( size_t s=0UL; s<lanes; ++s ) {
+      rows_   [s] = static_cast<uint32_t>( min( s, m_ ) );
+      lengths_[s] = 0U;
+   }
+   for( size_t i=0UL; i<m_; ++i ) {
+      slots_[i] = static_cast<uint32_t>( i );
+   }
+
+   std::fill( offsets_, offsets_+chunks()+1UL, 0UL );
+   nonzeros_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the sparse matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the sparse matrix is 0.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline void SlicedEllpackMatrix<Type,C>::clear()
+{
+   offsets_[0UL] = 0UL;
+   m_ = 0UL;
+   n_ = 0UL;
+   nonzeros_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the sparse matrix by the scalar value \a scalar (\f$ A=B*s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the sparse matrix.
+//
+// Only the non-zero elements are scaled, i.e. the padding elements remain zero.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , size_t C >        // Number of rows per chunk
+template< typename Other >  // Data type of the scalar value
+inline SlicedEllpackMatrix<Type,C>& SlicedEllpackMatrix<Type,C>::scale( const Other& scalar )
+{
+   for( size_t s=0UL; s<m_; ++s ) {
+      Type* value( values_ + offsets_[s/C] + s%C );
+      for( size_t k=0UL; k<lengths_[s]; ++k, value+=C )
+         *value *= scalar;
+   }
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The sparse matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline void SlicedEllpackMatrix<Type,C>::swap( SlicedEllpackMatrix& sm ) /* throw() */
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   std::swap( sigma_, sm.sigma_ );
+   std::swap( nonzeros_, sm.nonzeros_ );
+   std::swap( offsets_, sm.offsets_ );
+   std::swap( values_ , sm.values_  );
+   std::swap( indices_, sm.indices_ );
+   std::swap( rows_   , sm.rows_    );
+   std::swap( lengths_, sm.lengths_ );
+   std::swap( slots_  , sm.slots_   );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion of a row-major sparse matrix with direct row access.
+//
+// \param sm The sparse matrix to be converted.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+template< typename MT >  // Type of the foreign sparse matrix
+inline typename DisableIf< IsExpression<MT> >::Type
+   SlicedEllpackMatrix<Type,C>::convert( const SparseMatrix<MT,false>& sm )
+{
+   build( ~sm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion of an arbitrary matrix or matrix expression.
+//
+// \param m The matrix to be converted.
+// \return void
+//
+// The given matrix is evaluated into a temporary row-major compressed matrix, which is then
+// converted into the sliced layout.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+template< typename MT    // Type of the foreign matrix
+        , bool SO2 >     // Storage order of the foreign matrix
+inline void SlicedEllpackMatrix<Type,C>::convert( const Matrix<MT,SO2>& m )
+{
+   const CompressedMatrix<Type,false> tmp( serial( ~m ) );
+   build( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting up the chunks of an empty matrix from a row-major sparse matrix.
+//
+// \param A The row-major sparse matrix to be converted.
+// \return void
+//
+// In a first pass, the rows are sorted by decreasing number of non-zero elements within each
+// window of \f$ \sigma \f$ rows (using a stable sort, which preserves the original order of rows
+// of equal length) and the width of each chunk is determined. In a second pass, the elements of
+// each row are copied into the according lane of its chunk and the remaining slots of the lane
+// are padded with zero values. The padding elements refer to the last column index of the row
+// in order to avoid additional cache misses during the multiplication with a dense vector.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+template< typename MT >  // Type of the foreign sparse matrix
+void SlicedEllpackMatrix<Type,C>::build( const MT& A )
+{
+   typedef typename MT::ConstIterator  SourceIterator;
+
+   BLAZE_INTERNAL_ASSERT( A.rows()    == m_, "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( A.columns() == n_, "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( values_ == NULL && indices_ == NULL, "Invalid elements detected" );
+
+   const size_t nc( chunks() );
+
+   std::vector<size_t> nonzeros( m_ );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      nonzeros[i] = A.nonZeros( i );
+   }
+
+   reset();
+
+   if( sigma_ > C ) {
+      for( size_t first=0UL; first<m_; ) {
+         const size_t last( ( m_ - first > sigma_ )?( first + sigma_ ):( m_ ) );
+         std::stable_sort( rows_+first, rows_+last, LongerRow( nonzeros ) );
+         first = last;
+      }
+   }
+
+   for( size_t c=0UL; c<nc; ++c )
+   {
+      size_t width( 0UL );
+
+      for( size_t s=c*C; s<(c+1UL)*C && s<m_; ++s ) {
+         slots_  [rows_[s]] = static_cast<uint32_t>( s );
+         lengths_[s]        = static_cast<uint32_t>( nonzeros[rows_[s]] );
+         width = max( width, nonzeros[rows_[s]] );
+      }
+
+      offsets_[c+1UL] = offsets_[c] + width*C;
+   }
+
+   values_  = allocate<Type>( capacity() );
+   indices_ = allocate<uint32_t>( capacity() );
+
+   for( size_t s=0UL; s<nc*C; ++s )
+   {
+      const size_t end( offsets_[s/C+1UL] );
+      size_t pos  ( offsets_[s/C] + s%C );
+      size_t index( 0UL );
+
+      if( s < m_ ) {
+         const SourceIterator last( A.end( rows_[s] ) );
+         for( SourceIterator element=A.begin( rows_[s] ); element!=last; ++element, pos+=C ) {
+            values_ [pos] = element->value();
+            indices_[pos] = static_cast<uint32_t>( element->index() );
+            index = element->index();
+         }
+         nonzeros_ += lengths_[s];
+      }
+
+      for( ; pos<end; pos+=C ) {
+         values_ [pos] = Type();
+         indices_[pos] = static_cast<uint32_t>( index );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the position of the first element of row \a i with a column index not less
+//        than \a j.
+//
+// \param i The row index.
+// \param j The column index.
+// \return The position of the first element not less than \a j within row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline size_t SlicedEllpackMatrix<Type,C>::lowerOffset( size_t i, size_t j ) const
+{
+   const size_t s( slots_[i] );
+   const uint32_t* const index( indices_ + offsets_[s/C] + s%C );
+
+   size_t first( 0UL );
+   size_t count( lengths_[s] );
+
+   while( count > 0UL ) {
+      const size_t step( count / 2UL );
+      if( index[(first+step)*C] < j ) {
+         first += step + 1UL;
+         count -= step + 1UL;
+      }
+      else count = step;
+   }
+
+   return first;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks that the given number of rows or columns is valid for a sliced ELLPACK matrix.
+//
+// \param n The number of rows or columns of the matrix.
+// \return The given size \a n.
+// \exception std::invalid_argument Invalid matrix size.
+//
+// The size has to be in the range of the 32-bit row and column indices.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline size_t SlicedEllpackMatrix<Type,C>::checkSize( size_t n )
+{
+   if( n > static_cast<size_t>( Limits<uint32_t>::inf() ) )
+      throw std::invalid_argument( "Matrix size exceeds the 32-bit index range" );
+
+   return n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Rounds the given sorting scope down to a multiple of the chunk height.
+//
+// \param sigma The requested sorting scope.
+// \return The sorting scope as multiple of the chunk height, at least \a C.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline size_t SlicedEllpackMatrix<Type,C>::checkSigma( size_t sigma )
+{
+   return max( sigma - sigma%C, C );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline typename SlicedEllpackMatrix<Type,C>::ConstIterator
+   SlicedEllpackMatrix<Type,C>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   if( pos != end( i ) && pos->index() == j )
+      return pos;
+   else return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline typename SlicedEllpackMatrix<Type,C>::ConstIterator
+   SlicedEllpackMatrix<Type,C>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+
+   const size_t pos( offsets_[slots_[i]/C] + slots_[i]%C + lowerOffset( i, j )*C );
+   return ConstIterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline typename SlicedEllpackMatrix<Type,C>::ConstIterator
+   SlicedEllpackMatrix<Type,C>::upperBound( size_t i, size_t j ) const
+{
+   return lowerBound( i, j+1UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of chunks of the sparse matrix.
+//
+// \return The number of chunks, i.e. \f$ \lceil M/C \rceil \f$.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline size_t SlicedEllpackMatrix<Type,C>::chunks() const
+{
+   return ( m_ + C - 1UL ) / C;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the width of the specified chunk.
+//
+// \param c The index of the chunk.
+// \return The number of elements of the longest row of chunk \a c.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline size_t SlicedEllpackMatrix<Type,C>::chunkWidth( size_t c ) const
+{
+   BLAZE_USER_ASSERT( c < chunks(), "Invalid chunk access index" );
+   return ( offsets_[c+1UL] - offsets_[c] ) / C;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the values of the specified chunk.
+//
+// \param c The index of the chunk.
+// \return Pointer to the values of chunk \a c.
+//
+// The values of a chunk of width \a w are stored column by column, i.e. the k-th element of
+// lane \a l (\f$ k<w, l<C \f$) is stored at position \f$ k \cdot C + l \f$.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline const Type* SlicedEllpackMatrix<Type,C>::chunkValues( size_t c ) const
+{
+   BLAZE_USER_ASSERT( c < chunks(), "Invalid chunk access index" );
+   return values_ + offsets_[c];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the column indices of the specified chunk.
+//
+// \param c The index of the chunk.
+// \return Pointer to the column indices of chunk \a c.
+//
+// The column indices are stored in the same order as the values (see chunkValues()). The
+// padding elements refer to valid column indices.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline const uint32_t* SlicedEllpackMatrix<Type,C>::chunkIndices( size_t c ) const
+{
+   BLAZE_USER_ASSERT( c < chunks(), "Invalid chunk access index" );
+   return indices_ + offsets_[c];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the original row indices of the lanes of the specified chunk.
+//
+// \param c The index of the chunk.
+// \return Pointer to the \a C original row indices of the lanes of chunk \a c.
+//
+// The lanes beyond the last row of the matrix (i.e. the padding lanes of the last chunk) have
+// the row index \a M.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline const uint32_t* SlicedEllpackMatrix<Type,C>::chunkRows( size_t c ) const
+{
+   BLAZE_USER_ASSERT( c < chunks(), "Invalid chunk access index" );
+   return rows_ + c*C;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the number of non-zero elements of the lanes of the specified chunk.
+//
+// \param c The index of the chunk.
+// \return Pointer to the \a C numbers of non-zero elements of the lanes of chunk \a c.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline const uint32_t* SlicedEllpackMatrix<Type,C>::chunkLengths( size_t c ) const
+{
+   BLAZE_USER_ASSERT( c < chunks(), "Invalid chunk access index" );
+   return lengths_ + c*C;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , size_t C >        // Number of rows per chunk
+template< typename Other >  // Data type of the foreign expression
+inline bool SlicedEllpackMatrix<Type,C>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , size_t C >        // Number of rows per chunk
+template< typename Other >  // Data type of the foreign expression
+inline bool SlicedEllpackMatrix<Type,C>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// Since the matrix is read-only, it can never be the target of an SMP assignment. As operand
+// of an SMP assignment, it is split at the boundaries of the sorting windows.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline bool SlicedEllpackMatrix<Type,C>::canSMPAssign() const
+{
+   return false;
+}
+//*************************************************************************************************
+//=================================================================================================
+//
+//  SLICEDELLPACKMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SlicedEllpackMatrix operators */
+//@{
+template< typename Type, size_t C >
+inline void reset( SlicedEllpackMatrix<Type,C>& m );
+
+template< typename Type, size_t C >
+inline void clear( SlicedEllpackMatrix<Type,C>& m );
+
+template< typename Type, size_t C >
+inline bool isDefault( const SlicedEllpackMatrix<Type,C>& m );
+
+template< typename Type, size_t C >
+inline void swap( SlicedEllpackMatrix<Type,C>& a, SlicedEllpackMatrix<Type,C>& b ) /* throw() */;
+
+template< typename Type, size_t C >
+inline void move( SlicedEllpackMatrix<Type,C>& dst, SlicedEllpackMatrix<Type,C>& src ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given sliced ELLPACK matrix.
+// \ingroup sliced_ellpack_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline void reset( SlicedEllpackMatrix<Type,C>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given sliced ELLPACK matrix.
+// \ingroup sliced_ellpack_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline void clear( SlicedEllpackMatrix<Type,C>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given sliced ELLPACK matrix is in default state.
+// \ingroup sliced_ellpack_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+//
+// This function checks whether the sliced ELLPACK matrix is in default (constructed) state, i.e. if
+// it's number of rows and columns is 0. In case it is in default state, the function returns
+// \a true, else it will return \a false. The following example demonstrates the use of the
+// \a isDefault() function:
+
+   \code
+   blaze::SlicedEllpackMatrix<int,8UL> A;
+   // ... Resizing and initialization
+   if( isDefault( A ) ) { ... }
+   \endcode
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline bool isDefault( const SlicedEllpackMatrix<Type,C>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sliced ELLPACK matrices.
+// \ingroup sliced_ellpack_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline void swap( SlicedEllpackMatrix<Type,C>& a, SlicedEllpackMatrix<Type,C>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moving the contents of one sliced ELLPACK matrix to another.
+// \ingroup sliced_ellpack_matrix
+//
+// \param dst The destination matrix.
+// \param src The source matrix.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline void move( SlicedEllpackMatrix<Type,C>& dst, SlicedEllpackMatrix<Type,C>& src ) /* throw() */
+{
+   dst.swap( src );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t C, typename T2, size_t M, size_t N, bool SO >
+struct AddTrait< SlicedEllpackMatrix<T1,C>, StaticMatrix<T2,M,N,SO> >
+{
+   typedef StaticMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, size_t C >
+struct AddTrait< StaticMatrix<T1,M,N,SO>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef StaticMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
+};
+
+template< typename T1, size_t C, typename T2, size_t M, size_t N, bool SO >
+struct AddTrait< SlicedEllpackMatrix<T1,C>, HybridMatrix<T2,M,N,SO> >
+{
+   typedef HybridMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, size_t C >
+struct AddTrait< HybridMatrix<T1,M,N,SO>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef HybridMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
+};
+
+template< typename T1, size_t C, typename T2, bool SO >
+struct AddTrait< SlicedEllpackMatrix<T1,C>, DynamicMatrix<T2,SO> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t C >
+struct AddTrait< DynamicMatrix<T1,SO>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, size_t C, typename T2 >
+struct AddTrait< SlicedEllpackMatrix<T1,C>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef SlicedEllpackMatrix< typename AddTrait<T1,T2>::Type, C >  Type;
+};
+
+template< typename T1, size_t C1, typename T2, size_t C2 >
+struct AddTrait< SlicedEllpackMatrix<T1,C1>, SlicedEllpackMatrix<T2,C2> >
+{
+   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t C, typename T2, bool SO >
+struct AddTrait< SlicedEllpackMatrix<T1,C>, CompressedMatrix<T2,SO> >
+{
+   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t C >
+struct AddTrait< CompressedMatrix<T1,SO>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, size_t C, typename T2, bool SO >
+struct AddTrait< SlicedEllpackMatrix<T1,C>, CompressedSoAMatrix<T2,SO> >
+{
+   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t C >
+struct AddTrait< CompressedSoAMatrix<T1,SO>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, size_t C, typename T2, size_t B >
+struct AddTrait< SlicedEllpackMatrix<T1,C>, CompressedBlockMatrix<T2,B> >
+{
+   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t B, typename T2, size_t C >
+struct AddTrait< CompressedBlockMatrix<T1,B>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type, false >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t C, typename T2, size_t M, size_t N, bool SO >
+struct SubTrait< SlicedEllpackMatrix<T1,C>, StaticMatrix<T2,M,N,SO> >
+{
+   typedef StaticMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, size_t C >
+struct SubTrait< StaticMatrix<T1,M,N,SO>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef StaticMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
+};
+
+template< typename T1, size_t C, typename T2, size_t M, size_t N, bool SO >
+struct SubTrait< SlicedEllpackMatrix<T1,C>, HybridMatrix<T2,M,N,SO> >
+{
+   typedef HybridMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, size_t C >
+struct SubTrait< HybridMatrix<T1,M,N,SO>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef HybridMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
+};
+
+template< typename T1, size_t C, typename T2, bool SO >
+struct SubTrait< SlicedEllpackMatrix<T1,C>, DynamicMatrix<T2,SO> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t C >
+struct SubTrait< DynamicMatrix<T1,SO>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, size_t C, typename T2 >
+struct SubTrait< SlicedEllpackMatrix<T1,C>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef SlicedEllpackMatrix< typename SubTrait<T1,T2>::Type, C >  Type;
+};
+
+template< typename T1, size_t C1, typename T2, size_t C2 >
+struct SubTrait< SlicedEllpackMatrix<T1,C1>, SlicedEllpackMatrix<T2,C2> >
+{
+   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t C, typename T2, bool SO >
+struct SubTrait< SlicedEllpackMatrix<T1,C>, CompressedMatrix<T2,SO> >
+{
+   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t C >
+struct SubTrait< CompressedMatrix<T1,SO>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, size_t C, typename T2, bool SO >
+struct SubTrait< SlicedEllpackMatrix<T1,C>, CompressedSoAMatrix<T2,SO> >
+{
+   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t C >
+struct SubTrait< CompressedSoAMatrix<T1,SO>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, size_t C, typename T2, size_t B >
+struct SubTrait< SlicedEllpackMatrix<T1,C>, CompressedBlockMatrix<T2,B> >
+{
+   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t B, typename T2, size_t C >
+struct SubTrait< CompressedBlockMatrix<T1,B>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type, false >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t C, typename T2 >
+struct MultTrait< SlicedEllpackMatrix<T1,C>, T2 >
+{
+   typedef SlicedEllpackMatrix< typename MultTrait<T1,T2>::Type, C >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+
+template< typename T1, typename T2, size_t C >
+struct MultTrait< T1, SlicedEllpackMatrix<T2,C> >
+{
+   typedef SlicedEllpackMatrix< typename MultTrait<T1,T2>::Type, C >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T1 );
+};
+
+template< typename T1, size_t C, typename T2, size_t N >
+struct MultTrait< SlicedEllpackMatrix<T1,C>, StaticVector<T2,N,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t N, typename T2, size_t C >
+struct MultTrait< StaticVector<T1,N,true>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, size_t C, typename T2, size_t N >
+struct MultTrait< SlicedEllpackMatrix<T1,C>, HybridVector<T2,N,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t N, typename T2, size_t C >
+struct MultTrait< HybridVector<T1,N,true>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, size_t C, typename T2 >
+struct MultTrait< SlicedEllpackMatrix<T1,C>, DynamicVector<T2,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename T2, size_t C >
+struct MultTrait< DynamicVector<T1,true>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, size_t C, typename T2 >
+struct MultTrait< SlicedEllpackMatrix<T1,C>, CompressedVector<T2,false> >
+{
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename T2, size_t C >
+struct MultTrait< CompressedVector<T1,true>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, size_t C, typename T2, size_t M, size_t N, bool SO >
+struct MultTrait< SlicedEllpackMatrix<T1,C>, StaticMatrix<T2,M,N,SO> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, size_t C >
+struct MultTrait< StaticMatrix<T1,M,N,SO>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, size_t C, typename T2, size_t M, size_t N, bool SO >
+struct MultTrait< SlicedEllpackMatrix<T1,C>, HybridMatrix<T2,M,N,SO> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, size_t C >
+struct MultTrait< HybridMatrix<T1,M,N,SO>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, size_t C, typename T2, bool SO >
+struct MultTrait< SlicedEllpackMatrix<T1,C>, DynamicMatrix<T2,SO> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t C >
+struct MultTrait< DynamicMatrix<T1,SO>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, size_t C1, typename T2, size_t C2 >
+struct MultTrait< SlicedEllpackMatrix<T1,C1>, SlicedEllpackMatrix<T2,C2> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t C, typename T2, bool SO >
+struct MultTrait< SlicedEllpackMatrix<T1,C>, CompressedMatrix<T2,SO> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t C >
+struct MultTrait< CompressedMatrix<T1,SO>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, size_t C, typename T2, bool SO >
+struct MultTrait< SlicedEllpackMatrix<T1,C>, CompressedSoAMatrix<T2,SO> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t C >
+struct MultTrait< CompressedSoAMatrix<T1,SO>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, size_t C, typename T2, size_t B >
+struct MultTrait< SlicedEllpackMatrix<T1,C>, CompressedBlockMatrix<T2,B> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t B, typename T2, size_t C >
+struct MultTrait< CompressedBlockMatrix<T1,B>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DIVTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t C, typename T2 >
+struct DivTrait< SlicedEllpackMatrix<T1,C>, T2 >
+{
+   typedef SlicedEllpackMatrix< typename DivTrait<T1,T2>::Type, C >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATHTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t C, typename T2 >
+struct MathTrait< SlicedEllpackMatrix<T1,C>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef SlicedEllpackMatrix< typename MathTrait<T1,T2>::HighType, C >  HighType;
+   typedef SlicedEllpackMatrix< typename MathTrait<T1,T2>::LowType , C >  LowType;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t C >
+struct SubmatrixTrait< SlicedEllpackMatrix<T1,C> >
+{
+   typedef CompressedMatrix<T1,false>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t C >
+struct RowTrait< SlicedEllpackMatrix<T1,C> >
+{
+   typedef CompressedVector<T1,true>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t C >
+struct ColumnTrait< SlicedEllpackMatrix<T1,C> >
+{
+   typedef CompressedVector<T1,false>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,200 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SoAElement.h
+//  \brief Header file for the SoAElement class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SOAELEMENT_H_
+#define _BLAZE_MATH_SPARSE_SOAELEMENT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/sparse/SparseElement.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access proxy for a single element of a structure-of-arrays sparse storage.
+// \ingroup math
+//
+// The SoAElement class represents a single non-zero element of a sparse matrix that stores its
+// values and indices in two separate arrays (see CompressedSoAMatrix). In contrast to the
+// ValueIndexPair class it does not own the value and the index, but refers to the according
+// entries of the value and index arrays. In case the given \a Type is const qualified, the
+// element only provides read access to the referenced value.
+*/
+template< typename Type >  // Type of the value element
+class SoAElement : private SparseElement
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef typename RemoveConst<Type>::Type  ValueType;       //!< The value type of the element.
+   typedef size_t                            IndexType;       //!< The index type of the element.
+   typedef Type&                             Reference;       //!< Reference return type.
+   typedef const ValueType&                  ConstReference;  //!< Reference-to-const return type.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SoAElement class.
+   //
+   // \param value Pointer to the referenced value.
+   // \param index Pointer to the referenced index.
+   */
+   inline SoAElement( Type* value, const uint32_t* index )
+      : value_( value )  // Pointer to the referenced value
+      , index_( index )  // Pointer to the referenced index
+   {}
+   //**********************************************************************************************
+
+   //**Assignment operator*************************************************************************
+   /*!\brief Assignment to the referenced sparse element.
+   //
+   // \param v The new value of the sparse element.
+   // \return Reference to the sparse element.
+   */
+   template< typename T > inline SoAElement& operator=( const T& v ) {
+      *value_ = v;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Addition assignment operator****************************************************************
+   /*!\brief Addition assignment to the referenced sparse element.
+   //
+   // \param v The right-hand side value for the addition.
+   // \return Reference to the sparse element.
+   */
+   template< typename T > inline SoAElement& operator+=( const T& v ) {
+      *value_ += v;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Subtraction assignment operator*************************************************************
+   /*!\brief Subtraction assignment to the referenced sparse element.
+   //
+   // \param v The right-hand side value for the subtraction.
+   // \return Reference to the sparse element.
+   */
+   template< typename T > inline SoAElement& operator-=( const T& v ) {
+      *value_ -= v;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Multiplication assignment operator**********************************************************
+   /*!\brief Multiplication assignment to the referenced sparse element.
+   //
+   // \param v The right-hand side value for the multiplication.
+   // \return Reference to the sparse element.
+   */
+   template< typename T > inline SoAElement& operator*=( const T& v ) {
+      *value_ *= v;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Division assignment operator****************************************************************
+   /*!\brief Division assignment to the referenced sparse element.
+   //
+   // \param v The right-hand side value for the division.
+   // \return Reference to the sparse element.
+   */
+   template< typename T > inline SoAElement& operator/=( const T& v ) {
+      *value_ /= v;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Element access operator*********************************************************************
+   /*!\brief Direct access to the referenced sparse element.
+   //
+   // \return Pointer to the referenced sparse element.
+   */
+   inline const SoAElement* operator->() const {
+      return this;
+   }
+   //**********************************************************************************************
+
+   //**Value function******************************************************************************
+   /*!\brief Access to the current value of the sparse element.
+   //
+   // \return The current value of the sparse element.
+   */
+   inline Reference value() const {
+      return *value_;
+   }
+   //**********************************************************************************************
+
+   //**Index function******************************************************************************
+   /*!\brief Access to the current index of the sparse element.
+   //
+   // \return The current index of the sparse element.
+   */
+   inline IndexType index() const {
+      return *index_;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Type* value_;            //!< Pointer to the referenced value.
+   const uint32_t* index_;  //!< Pointer to the referenced index.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
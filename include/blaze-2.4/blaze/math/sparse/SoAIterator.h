@@ -0,0 +1,590 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SoAIterator.h
+//  \brief Header file for the SoAIterator class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SOAITERATOR_H_
+#define _BLAZE_MATH_SPARSE_SOAITERATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <blaze/math/sparse/SoAElement.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Implementation of an iterator for structure-of-arrays sparse storages.
+// \ingroup math
+//
+// The SoAIterator represents a random-access iterator over the non-zero elements of a sparse
+// matrix that stores its values and indices in two separate arrays (see CompressedSoAMatrix).
+// The iterator walks both arrays in lockstep; dereferencing it yields a SoAElement proxy that
+// provides the usual value() and index() access of sparse elements.
+*/
+template< typename Type >  // Type of the elements
+class SoAIterator
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef std::random_access_iterator_tag  IteratorCategory;  //!< The iterator category.
+   typedef SoAElement<Type>                 ValueType;         //!< Type of the underlying elements.
+   typedef ValueType                        PointerType;       //!< Pointer return type.
+   typedef ValueType                        ReferenceType;     //!< Reference return type.
+   typedef ptrdiff_t                        DifferenceType;    //!< Difference between two iterators.
+
+   // STL iterator requirements
+   typedef IteratorCategory  iterator_category;  //!< The iterator category.
+   typedef ValueType         value_type;         //!< Type of the underlying elements.
+   typedef PointerType       pointer;            //!< Pointer return type.
+   typedef ReferenceType     reference;          //!< Reference return type.
+   typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SoAIterator();
+   explicit inline SoAIterator( Type* value, const uint32_t* index );
+
+   template< typename Other >
+   inline SoAIterator( const SoAIterator<Other>& it );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   // No explicitly declared copy assignment operator.
+   inline SoAIterator& operator+=( ptrdiff_t inc );
+   inline SoAIterator& operator-=( ptrdiff_t inc );
+   //@}
+   //**********************************************************************************************
+
+   //**Increment/decrement operators***************************************************************
+   /*!\name Increment/decrement operators */
+   //@{
+   inline SoAIterator&      operator++();
+   inline const SoAIterator operator++( int );
+   inline SoAIterator&      operator--();
+   inline const SoAIterator operator--( int );
+   //@}
+   //**********************************************************************************************
+
+   //**Access operators****************************************************************************
+   /*!\name Access operators */
+   //@{
+   inline ReferenceType operator[]( size_t index ) const;
+   inline ReferenceType operator* () const;
+   inline PointerType   operator->() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline Type*           base() const;
+   inline const uint32_t* indexBase() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Type* value_;            //!< Pointer to the current value.
+   const uint32_t* index_;  //!< Pointer to the current index.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for the SoAIterator class.
+*/
+template< typename Type >  // Type of the elements
+inline SoAIterator<Type>::SoAIterator()
+   : value_( NULL )  // Pointer to the current value
+   , index_( NULL )  // Pointer to the current index
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the SoAIterator class.
+//
+// \param value Pointer to the initial value.
+// \param index Pointer to the initial index.
+*/
+template< typename Type >  // Type of the elements
+inline SoAIterator<Type>::SoAIterator( Type* value, const uint32_t* index )
+   : value_( value )  // Pointer to the current value
+   , index_( index )  // Pointer to the current index
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different SoAIterator instances.
+//
+// \param it The foreign SoAIterator instance to be copied.
+*/
+template< typename Type >   // Type of the elements
+template< typename Other >  // Type of the foreign elements
+inline SoAIterator<Type>::SoAIterator( const SoAIterator<Other>& it )
+   : value_( it.base()      )  // Pointer to the current value
+   , index_( it.indexBase() )  // Pointer to the current index
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator.
+//
+// \param inc The increment of the iterator.
+// \return The incremented iterator.
+*/
+template< typename Type >  // Type of the elements
+inline SoAIterator<Type>& SoAIterator<Type>::operator+=( ptrdiff_t inc )
+{
+   value_ += inc;
+   index_ += inc;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator.
+//
+// \param dec The decrement of the iterator.
+// \return The decremented iterator.
+*/
+template< typename Type >  // Type of the elements
+inline SoAIterator<Type>& SoAIterator<Type>::operator-=( ptrdiff_t dec )
+{
+   value_ -= dec;
+   index_ -= dec;
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INCREMENT/DECREMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Pre-increment operator.
+//
+// \return Reference to the incremented iterator.
+*/
+template< typename Type >  // Type of the elements
+inline SoAIterator<Type>& SoAIterator<Type>::operator++()
+{
+   ++value_;
+   ++index_;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Post-increment operator.
+//
+// \return The previous position of the iterator.
+*/
+template< typename Type >  // Type of the elements
+inline const SoAIterator<Type> SoAIterator<Type>::operator++( int )
+{
+   const SoAIterator tmp( *this );
+   ++(*this);
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pre-decrement operator.
+//
+// \return Reference to the decremented iterator.
+*/
+template< typename Type >  // Type of the elements
+inline SoAIterator<Type>& SoAIterator<Type>::operator--()
+{
+   --value_;
+   --index_;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Post-decrement operator.
+//
+// \return The previous position of the iterator.
+*/
+template< typename Type >  // Type of the elements
+inline const SoAIterator<Type> SoAIterator<Type>::operator--( int )
+{
+   const SoAIterator tmp( *this );
+   --(*this);
+   return tmp;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ACCESS OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Direct access to the sparse elements.
+//
+// \param index Access index.
+// \return Proxy for the accessed sparse element.
+*/
+template< typename Type >  // Type of the elements
+inline typename SoAIterator<Type>::ReferenceType
+   SoAIterator<Type>::operator[]( size_t index ) const
+{
+   return ReferenceType( value_+index, index_+index );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the sparse element at the current iterator position.
+//
+// \return Proxy for the current sparse element.
+*/
+template< typename Type >  // Type of the elements
+inline typename SoAIterator<Type>::ReferenceType
+   SoAIterator<Type>::operator*() const
+{
+   return ReferenceType( value_, index_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the sparse element at the current iterator position.
+//
+// \return Proxy for the current sparse element.
+*/
+template< typename Type >  // Type of the elements
+inline typename SoAIterator<Type>::PointerType
+   SoAIterator<Type>::operator->() const
+{
+   return PointerType( value_, index_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Low-level access to the value array of the iterator.
+//
+// \return Pointer to the current value.
+*/
+template< typename Type >  // Type of the elements
+inline Type* SoAIterator<Type>::base() const
+{
+   return value_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the index array of the iterator.
+//
+// \return Pointer to the current index.
+*/
+template< typename Type >  // Type of the elements
+inline const uint32_t* SoAIterator<Type>::indexBase() const
+{
+   return index_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SoAIterator operators */
+//@{
+template< typename T1, typename T2 >
+inline bool operator==( const SoAIterator<T1>& lhs, const SoAIterator<T2>& rhs );
+
+template< typename T1, typename T2 >
+inline bool operator!=( const SoAIterator<T1>& lhs, const SoAIterator<T2>& rhs );
+
+template< typename T1, typename T2 >
+inline bool operator<( const SoAIterator<T1>& lhs, const SoAIterator<T2>& rhs );
+
+template< typename T1, typename T2 >
+inline bool operator>( const SoAIterator<T1>& lhs, const SoAIterator<T2>& rhs );
+
+template< typename T1, typename T2 >
+inline bool operator<=( const SoAIterator<T1>& lhs, const SoAIterator<T2>& rhs );
+
+template< typename T1, typename T2 >
+inline bool operator>=( const SoAIterator<T1>& lhs, const SoAIterator<T2>& rhs );
+
+template< typename Type >
+inline const SoAIterator<Type> operator+( const SoAIterator<Type>& it, ptrdiff_t inc );
+
+template< typename Type >
+inline const SoAIterator<Type> operator+( ptrdiff_t inc, const SoAIterator<Type>& it );
+
+template< typename Type >
+inline const SoAIterator<Type> operator-( const SoAIterator<Type>& it, ptrdiff_t inc );
+
+template< typename T1, typename T2 >
+inline ptrdiff_t operator-( const SoAIterator<T1>& lhs, const SoAIterator<T2>& rhs );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between two SoAIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the iterators refer to the same element, \a false if not.
+*/
+template< typename T1    // Element type of the left-hand side iterator
+        , typename T2 >  // Element type of the right-hand side iterator
+inline bool operator==( const SoAIterator<T1>& lhs, const SoAIterator<T2>& rhs )
+{
+   return lhs.base() == rhs.base();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inequality comparison between two SoAIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the iterators don't refer to the same element, \a false if they do.
+*/
+template< typename T1    // Element type of the left-hand side iterator
+        , typename T2 >  // Element type of the right-hand side iterator
+inline bool operator!=( const SoAIterator<T1>& lhs, const SoAIterator<T2>& rhs )
+{
+   return lhs.base() != rhs.base();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-than comparison between two SoAIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the left-hand side iterator is smaller, \a false if not.
+*/
+template< typename T1    // Element type of the left-hand side iterator
+        , typename T2 >  // Element type of the right-hand side iterator
+inline bool operator<( const SoAIterator<T1>& lhs, const SoAIterator<T2>& rhs )
+{
+   return lhs.base() < rhs.base();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-than comparison between two SoAIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the left-hand side iterator is greater, \a false if not.
+*/
+template< typename T1    // Element type of the left-hand side iterator
+        , typename T2 >  // Element type of the right-hand side iterator
+inline bool operator>( const SoAIterator<T1>& lhs, const SoAIterator<T2>& rhs )
+{
+   return lhs.base() > rhs.base();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-or-equal-than comparison between two SoAIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the left-hand side iterator is less or equal, \a false if not.
+*/
+template< typename T1    // Element type of the left-hand side iterator
+        , typename T2 >  // Element type of the right-hand side iterator
+inline bool operator<=( const SoAIterator<T1>& lhs, const SoAIterator<T2>& rhs )
+{
+   return lhs.base() <= rhs.base();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-or-equal-than comparison between two SoAIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+*/
+template< typename T1    // Element type of the left-hand side iterator
+        , typename T2 >  // Element type of the right-hand side iterator
+inline bool operator>=( const SoAIterator<T1>& lhs, const SoAIterator<T2>& rhs )
+{
+   return lhs.base() >= rhs.base();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition between a SoAIterator and an integral value.
+//
+// \param it The iterator to be incremented.
+// \param inc The number of elements the iterator is incremented.
+// \return The incremented iterator.
+*/
+template< typename Type >  // Element type of the iterator
+inline const SoAIterator<Type> operator+( const SoAIterator<Type>& it, ptrdiff_t inc )
+{
+   return SoAIterator<Type>( it.base() + inc, it.indexBase() + inc );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition between an integral value and a SoAIterator.
+//
+// \param inc The number of elements the iterator is incremented.
+// \param it The iterator to be incremented.
+// \return The incremented iterator.
+*/
+template< typename Type >  // Element type of the iterator
+inline const SoAIterator<Type> operator+( ptrdiff_t inc, const SoAIterator<Type>& it )
+{
+   return SoAIterator<Type>( it.base() + inc, it.indexBase() + inc );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction between a SoAIterator and an integral value.
+//
+// \param it The iterator to be decremented.
+// \param dec The number of elements the iterator is decremented.
+// \return The decremented iterator.
+*/
+template< typename Type >  // Element type of the iterator
+inline const SoAIterator<Type> operator-( const SoAIterator<Type>& it, ptrdiff_t dec )
+{
+   return SoAIterator<Type>( it.base() - dec, it.indexBase() - dec );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating the number of elements between two SoAIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return The number of elements between the two iterators.
+*/
+template< typename T1    // Element type of the left-hand side iterator
+        , typename T2 >  // Element type of the right-hand side iterator
+inline ptrdiff_t operator-( const SoAIterator<T1>& lhs, const SoAIterator<T2>& rhs )
+{
+   return lhs.base() - rhs.base();
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,692 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SpGEMM.h
+//  \brief Header file for the sparse matrix/sparse matrix multiplication kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SPGEMM_H_
+#define _BLAZE_MATH_SPARSE_SPGEMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <vector>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Infinity.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Byte.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS SPGEMMMERGEACCUMULATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Heap-based row accumulator for sparse matrix/sparse matrix multiplications.
+// \ingroup sparse_matrix
+//
+// The SpGEMMMergeAccumulator class computes a single row of the product of two row-major sparse
+// matrices by merging the rows of the right-hand side matrix that are selected by the non-zero
+// elements of the according row of the left-hand side matrix. The rows are merged via a binary
+// heap ordered by the current column index of each row. Since the columns are visited in
+// ascending order, the resulting row is produced sorted and no scratch memory proportional to
+// the number of columns is required. The accumulator is the preferred choice for rows of the
+// left-hand side matrix with few non-zero elements (see blaze::SMATSMATMULT_MERGE_THRESHOLD).
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side sparse matrix
+        , typename ET > // Element type of the resulting matrix
+class SpGEMMMergeAccumulator
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef typename MT1::ConstIterator  LeftIterator;   //!< Iterator over the left-hand side elements.
+   typedef typename MT2::ConstIterator  RightIterator;  //!< Iterator over the right-hand side elements.
+   //**********************************************************************************************
+
+   //**Cursor struct*******************************************************************************
+   /*!\brief Position within a single row of the right-hand side sparse matrix.
+   */
+   struct Cursor {
+      inline Cursor( LeftIterator l, RightIterator p, RightIterator e )
+         : index( p->index() ), left( l ), pos( p ), end( e ) {}
+
+      size_t        index;  //!< The column index of the current element.
+      LeftIterator  left;   //!< The scaling element of the left-hand side matrix.
+      RightIterator pos;    //!< The current element of the right-hand side row.
+      RightIterator end;    //!< The end of the right-hand side row.
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Compute functions***************************************************************************
+   /*!\brief Computes row \a i of the product and appends it to the target matrix.
+   //
+   // \param C The target row-major sparse matrix.
+   // \param A The left-hand side sparse matrix.
+   // \param B The right-hand side sparse matrix.
+   // \param i The index of the row.
+   // \return void
+   */
+   template< typename MT >  // Type of the target sparse matrix
+   void compute( MT& C, const MT1& A, const MT2& B, size_t i )
+   {
+      init( A, B, i );
+
+      size_t current( inf );
+      ET value = ET();
+
+      while( heap_.size() > 1UL )
+      {
+         const Cursor& top( heap_.front() );
+
+         if( top.index != current ) {
+            if( current != size_t( inf ) && !isDefault( value ) )
+               C.append( i, current, value );
+            current = top.index;
+            value   = top.left->value() * top.pos->value();
+         }
+         else {
+            value += top.left->value() * top.pos->value();
+         }
+
+         advance();
+      }
+
+      // Streaming the remainder of the last row without heap operations
+      if( !heap_.empty() )
+      {
+         Cursor& last( heap_.front() );
+
+         if( last.index == current ) {
+            value += last.left->value() * last.pos->value();
+            ++last.pos;
+         }
+
+         if( current != size_t( inf ) && !isDefault( value ) )
+            C.append( i, current, value );
+
+         for( ; last.pos!=last.end; ++last.pos ) {
+            value = last.left->value() * last.pos->value();
+            if( !isDefault( value ) )
+               C.append( i, last.pos->index(), value );
+         }
+      }
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\brief Initializes the heap for row \a i of the product.
+   //
+   // \param A The left-hand side sparse matrix.
+   // \param B The right-hand side sparse matrix.
+   // \param i The index of the row.
+   // \return void
+   */
+   void init( const MT1& A, const MT2& B, size_t i )
+   {
+      heap_.clear();
+
+      const LeftIterator lend( A.end(i) );
+      for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem ) {
+         const RightIterator rbegin( B.begin( lelem->index() ) );
+         const RightIterator rend  ( B.end  ( lelem->index() ) );
+         if( rbegin != rend )
+            heap_.push_back( Cursor( lelem, rbegin, rend ) );
+      }
+
+      for( size_t k=heap_.size()/2UL; k-->0UL; )
+         sift( k );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Advances the cursor on top of the heap to the next element of its row.
+   //
+   // \return void
+   */
+   void advance()
+   {
+      Cursor& top( heap_.front() );
+
+      if( ++top.pos != top.end ) {
+         top.index = top.pos->index();
+      }
+      else {
+         top = heap_.back();
+         heap_.pop_back();
+      }
+
+      if( !heap_.empty() )
+         sift( 0UL );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Restores the heap property below the given heap position.
+   //
+   // \param k The heap position to be sifted down.
+   // \return void
+   */
+   void sift( size_t k )
+   {
+      const size_t size( heap_.size() );
+      const Cursor cursor( heap_[k] );
+
+      for( size_t child=2UL*k+1UL; child<size; child=2UL*k+1UL ) {
+         if( child+1UL < size && heap_[child+1UL].index < heap_[child].index )
+            ++child;
+         if( cursor.index <= heap_[child].index )
+            break;
+         heap_[k] = heap_[child];
+         k = child;
+      }
+
+      heap_[k] = cursor;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   std::vector<Cursor> heap_;  //!< Binary heap of the cursors (smallest column index on top).
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS SPGEMMHASHACCUMULATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Hash-based row accumulator for sparse matrix/sparse matrix multiplications.
+// \ingroup sparse_matrix
+//
+// The SpGEMMHashAccumulator class computes a single row of the product of two row-major sparse
+// matrices in an open addressing hash table with linear probing. The table is sized to twice the
+// number of scalar multiplications of the row (rounded up to a power of two). Therefore the
+// scratch memory is proportional to the number of non-zero elements of a row instead of the
+// number of columns, which keeps the accumulation within the cache for very sparse rows of very
+// wide matrices. The table grows to the size required by the largest row and is cleared element
+// by element after each row. The column indices of the occupied slots are sorted before the row
+// is appended to the target matrix.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side sparse matrix
+        , typename ET > // Element type of the resulting matrix
+class SpGEMMHashAccumulator
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef typename MT1::ConstIterator  LeftIterator;   //!< Iterator over the left-hand side elements.
+   typedef typename MT2::ConstIterator  RightIterator;  //!< Iterator over the right-hand side elements.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SpGEMMHashAccumulator class.
+   */
+   explicit inline SpGEMMHashAccumulator()
+      : keys_   ()       // The column indices of the occupied slots
+      , values_ ()       // The accumulated values of the occupied slots
+      , slots_  ()       // The occupied slots in the order of insertion
+      , mask_   ( 0UL )  // The bit mask of the current table size
+   {}
+   //**********************************************************************************************
+
+   //**Compute functions***************************************************************************
+   /*!\brief Computes the number of non-zero elements of row \a i of the product.
+   //
+   // \param A The left-hand side sparse matrix.
+   // \param B The right-hand side sparse matrix.
+   // \param i The index of the row.
+   // \param bound The number of scalar multiplications of row \a i.
+   // \return The number of structurally non-zero elements of row \a i.
+   */
+   size_t count( const MT1& A, const MT2& B, size_t i, size_t bound )
+   {
+      init( bound );
+
+      const LeftIterator lend( A.end(i) );
+      for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem ) {
+         const RightIterator rend( B.end( lelem->index() ) );
+         for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem ) {
+            const size_t slot( find( relem->index() ) );
+            if( keys_[slot] == size_t( inf ) ) {
+               keys_[slot] = relem->index();
+               slots_.push_back( slot );
+            }
+         }
+      }
+
+      const size_t nonzeros( slots_.size() );
+
+      for( size_t k=0UL; k<nonzeros; ++k )
+         keys_[slots_[k]] = inf;
+      slots_.clear();
+
+      return nonzeros;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Computes row \a i of the product and appends it to the target matrix.
+   //
+   // \param C The target row-major sparse matrix.
+   // \param A The left-hand side sparse matrix.
+   // \param B The right-hand side sparse matrix.
+   // \param i The index of the row.
+   // \param bound The number of scalar multiplications of row \a i.
+   // \return void
+   */
+   template< typename MT >  // Type of the target sparse matrix
+   void compute( MT& C, const MT1& A, const MT2& B, size_t i, size_t bound )
+   {
+      init( bound );
+
+      const LeftIterator lend( A.end(i) );
+      for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem ) {
+         const RightIterator rend( B.end( lelem->index() ) );
+         for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem ) {
+            const size_t slot( find( relem->index() ) );
+            if( keys_[slot] == size_t( inf ) ) {
+               keys_  [slot] = relem->index();
+               values_[slot] = lelem->value() * relem->value();
+               slots_.push_back( slot );
+            }
+            else {
+               values_[slot] += lelem->value() * relem->value();
+            }
+         }
+      }
+
+      const size_t nonzeros( slots_.size() );
+
+      for( size_t k=0UL; k<nonzeros; ++k )
+         slots_[k] = keys_[slots_[k]];
+
+      std::sort( slots_.begin(), slots_.end() );
+
+      for( size_t k=0UL; k<nonzeros; ++k ) {
+         const size_t slot( find( slots_[k] ) );
+         if( !isDefault( values_[slot] ) )
+            C.append( i, slots_[k], values_[slot] );
+         slots_[k] = slot;
+      }
+
+      for( size_t k=0UL; k<nonzeros; ++k )
+         keys_[slots_[k]] = inf;
+      slots_.clear();
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\brief Prepares the hash table for a row with the given number of scalar multiplications.
+   //
+   // \param bound The number of scalar multiplications of the row.
+   // \return void
+   */
+   void init( size_t bound )
+   {
+      size_t size( 16UL );
+      while( size < 2UL*bound )
+         size *= 2UL;
+
+      if( size > keys_.size() ) {
+         keys_.resize( size, inf );
+         values_.resize( size );
+      }
+
+      mask_ = size - 1UL;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the slot of the given column index.
+   //
+   // \param j The column index.
+   // \return The slot containing \a j or the first empty slot of the probe sequence.
+   */
+   inline size_t find( size_t j ) const
+   {
+      size_t h( j * 2654435769UL );
+      h ^= ( h >> 16 );
+
+      size_t slot( h & mask_ );
+      while( keys_[slot] != j && keys_[slot] != size_t( inf ) )
+         slot = ( slot + 1UL ) & mask_;
+
+      return slot;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   std::vector<size_t> keys_;    //!< The column indices of the occupied slots.
+   std::vector<ET>     values_;  //!< The accumulated values of the occupied slots.
+   std::vector<size_t> slots_;   //!< The occupied slots (or column indices) of the current row.
+   size_t              mask_;    //!< The bit mask of the current table size.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS SPGEMMDENSEACCUMULATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Dense row accumulator for sparse matrix/sparse matrix multiplications.
+// \ingroup sparse_matrix
+//
+// The SpGEMMDenseAccumulator class computes a single row of the product of two row-major sparse
+// matrices in a dense array of the size of a row (sparse accumulator). Only the touched elements
+// are reset after each row. The arrays are allocated on the first use. The accumulator is the
+// preferred choice for rows with a large number of scalar multiplications compared to the number
+// of columns (see blaze::SMATSMATMULT_DENSE_THRESHOLD).
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side sparse matrix
+        , typename ET > // Element type of the resulting matrix
+class SpGEMMDenseAccumulator
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef typename MT1::ConstIterator  LeftIterator;   //!< Iterator over the left-hand side elements.
+   typedef typename MT2::ConstIterator  RightIterator;  //!< Iterator over the right-hand side elements.
+   //**********************************************************************************************
+
+ public:
+   //**Compute functions***************************************************************************
+   /*!\brief Computes the number of non-zero elements of row \a i of the product.
+   //
+   // \param A The left-hand side sparse matrix.
+   // \param B The right-hand side sparse matrix.
+   // \param i The index of the row.
+   // \return The number of structurally non-zero elements of row \a i.
+   */
+   size_t count( const MT1& A, const MT2& B, size_t i )
+   {
+      init( B.columns() );
+
+      byte*   valid  ( &valid_[0]   );
+      size_t* indices( &indices_[0] );
+
+      size_t nonzeros( 0UL );
+
+      const LeftIterator lend( A.end(i) );
+      for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem ) {
+         const RightIterator rend( B.end( lelem->index() ) );
+         for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem ) {
+            if( !valid[relem->index()] ) {
+               valid[relem->index()] = 1;
+               indices[nonzeros] = relem->index();
+               ++nonzeros;
+            }
+         }
+      }
+
+      for( size_t k=0UL; k<nonzeros; ++k )
+         valid[indices[k]] = 0;
+
+      return nonzeros;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Computes row \a i of the product and appends it to the target matrix.
+   //
+   // \param C The target row-major sparse matrix.
+   // \param A The left-hand side sparse matrix.
+   // \param B The right-hand side sparse matrix.
+   // \param i The index of the row.
+   // \return void
+   */
+   template< typename MT >  // Type of the target sparse matrix
+   void compute( MT& C, const MT1& A, const MT2& B, size_t i )
+   {
+      init( B.columns() );
+
+      if( values_.empty() )
+         values_.resize( B.columns(), ET() );
+
+      ET*     values ( &values_[0]  );
+      byte*   valid  ( &valid_[0]   );
+      size_t* indices( &indices_[0] );
+
+      size_t nonzeros( 0UL );
+      size_t minIndex( inf ), maxIndex( 0UL );
+
+      const LeftIterator lend( A.end(i) );
+      for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem ) {
+         const RightIterator rend( B.end( lelem->index() ) );
+         for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem ) {
+            const size_t j( relem->index() );
+            if( !valid[j] ) {
+               values[j] = lelem->value() * relem->value();
+               valid [j] = 1;
+               indices[nonzeros] = j;
+               ++nonzeros;
+               if( j < minIndex ) minIndex = j;
+               if( j > maxIndex ) maxIndex = j;
+            }
+            else {
+               values[j] += lelem->value() * relem->value();
+            }
+         }
+      }
+
+      if( nonzeros == 0UL )
+         return;
+
+      BLAZE_INTERNAL_ASSERT( minIndex <= maxIndex, "Invalid index detected" );
+
+      if( ( nonzeros + nonzeros ) < ( maxIndex - minIndex ) )
+      {
+         std::sort( indices, indices + nonzeros );
+
+         for( size_t k=0UL; k<nonzeros; ++k ) {
+            const size_t j( indices[k] );
+            if( !isDefault( values[j] ) ) {
+               C.append( i, j, values[j] );
+               reset( values[j] );
+            }
+            valid[j] = 0;
+         }
+      }
+      else {
+         for( size_t j=minIndex; j<=maxIndex; ++j ) {
+            if( !isDefault( values[j] ) ) {
+               C.append( i, j, values[j] );
+               reset( values[j] );
+            }
+            valid[j] = 0;
+         }
+      }
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\brief Allocates the column flags on the first use.
+   //
+   // \param n The number of columns of the resulting matrix.
+   // \return void
+   */
+   void init( size_t n )
+   {
+      if( valid_.empty() ) {
+         valid_  .resize( n, 0   );
+         indices_.resize( n, 0UL );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   std::vector<ET>     values_;   //!< The accumulated values.
+   std::vector<byte>   valid_;    //!< Flags for the columns of the current row.
+   std::vector<size_t> indices_;  //!< The column indices of the current row.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SPARSE MATRIX/SPARSE MATRIX MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Row-major sparse matrix/row-major sparse matrix multiplication (\f$ C=A*B \f$).
+// \ingroup sparse_matrix
+//
+// \param C The target row-major sparse matrix.
+// \param A The left-hand side row-major sparse matrix operand.
+// \param B The right-hand side row-major sparse matrix operand.
+// \return void
+//
+// This function computes the product of two row-major sparse matrices in two passes. The first,
+// symbolic pass computes the number of non-zero elements of the product such that the target
+// matrix is allocated only once. The second, numeric pass computes the values and appends them
+// row by row. For every row of the product, the accumulator is selected based on the number of
+// non-zero elements \a k of the according row of \a A and the number of scalar multiplications
+// \a f of the row:
+//
+//  - rows with \f$ f \cdot \mbox{SMATSMATMULT\_DENSE\_THRESHOLD} \geq N \f$ are accumulated in
+//    a dense array of size \a N (see SpGEMMDenseAccumulator),
+//  - rows with \f$ k \leq \mbox{SMATSMATMULT\_MERGE\_THRESHOLD} \f$ are computed by merging the
+//    \a k rows of \a B via a heap (see SpGEMMMergeAccumulator),
+//  - all other rows are accumulated in a hash table (see SpGEMMHashAccumulator).
+//
+// The symbolic pass counts the exact number of non-zero elements of all sparse rows, via one flag
+// per column in case these flags fit into the L2 cache and via the hash table otherwise. For the
+// densely accumulated rows, counting would take as long as computing the row. Therefore these
+// rows reserve \f$ \min(f,N) \f$ elements, which exceeds the exact count by at most the length
+// of a row. The target matrix is expected to be empty and to have the according number of rows
+// and columns. Elements that evaluate to the default value (i.e. that cancel out) are not stored.
+*/
+template< typename ET     // Element type of the resulting matrix
+        , typename MT     // Type of the target sparse matrix
+        , typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+void spgemm( SparseMatrix<MT,false>& C, const MT1& A, const MT2& B )
+{
+   typedef typename MT1::ConstIterator  LeftIterator;
+
+   BLAZE_INTERNAL_ASSERT( (~C).rows()    == A.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~C).columns() == B.columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( A.columns()    == B.rows()   , "Invalid matrix sizes"      );
+
+   const size_t M( A.rows()    );
+   const size_t N( B.columns() );
+
+   SpGEMMMergeAccumulator<MT1,MT2,ET> merge;
+   SpGEMMHashAccumulator <MT1,MT2,ET> hash;
+   SpGEMMDenseAccumulator<MT1,MT2,ET> dense;
+
+   // Counting the number of scalar multiplications of each row
+   std::vector<size_t> bounds( M, 0UL );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      const LeftIterator lend( A.end(i) );
+      for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem ) {
+         bounds[i] += B.nonZeros( lelem->index() );
+      }
+   }
+
+   // Symbolic phase: Computing the number of non-zero elements
+   const bool cached( N <= getCacheSize( 2UL ) );
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<M; ++i )
+   {
+      if( bounds[i] <= 1UL || A.nonZeros(i) == 1UL )
+         nonzeros += bounds[i];
+      else if( bounds[i] * SMATSMATMULT_DENSE_THRESHOLD >= N )
+         nonzeros += ( bounds[i] < N )?( bounds[i] ):( N );
+      else if( cached )
+         nonzeros += dense.count( A, B, i );
+      else
+         nonzeros += hash.count( A, B, i, bounds[i] );
+   }
+
+   (~C).reserve( nonzeros );
+
+   // Numeric phase: Computing the values of the non-zero elements
+   for( size_t i=0UL; i<M; ++i )
+   {
+      if( bounds[i] == 0UL ) {}
+      else if( bounds[i] * SMATSMATMULT_DENSE_THRESHOLD >= N )
+         dense.compute( ~C, A, B, i );
+      else if( A.nonZeros(i) <= SMATSMATMULT_MERGE_THRESHOLD )
+         merge.compute( ~C, A, B, i );
+      else
+         hash.compute( ~C, A, B, i, bounds[i] );
+
+      (~C).finalize( i );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1116 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SpMV.h
+//  \brief Header file for the sparse matrix/dense vector multiplication kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SPMV_H_
+#define _BLAZE_MATH_SPARSE_SPMV_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dense/Forward.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/intrinsics/IntrinsicTrait.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/SoAIterator.h>
+#include <blaze/math/views/Forward.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS SPMVTRAIT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Low-level row access for the sparse matrix/dense vector multiplication kernels.
+// \ingroup sparse_matrix
+//
+// The SpMVTrait class template provides the sparse matrix/dense vector multiplication kernels
+// (see the spmv() function) with a direct access to the rows of a row-major sparse matrix in
+// the form of a pair of pointers to the contiguously stored non-zero elements. In case the given
+// matrix type provides this kind of access, the nested \a value is set to 1 and the according
+// access functions are provided. Otherwise \a value is set to 0.
+*/
+template< typename MT >  // Type of the sparse matrix
+struct SpMVTrait
+{
+   enum { value = 0 };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SpMVTrait class template for row-major compressed matrices.
+// \ingroup sparse_matrix
+*/
+template< typename Type >  // Data type of the sparse matrix
+struct SpMVTrait< CompressedMatrix<Type,false> >
+{
+   enum { value = 1 };
+
+   typedef CompressedMatrix<Type,false>    MatrixType;  //!< Type of the sparse matrix.
+   typedef typename MatrixType::ConstIterator  Pointer;     //!< Pointer to the non-zero elements.
+
+   static inline Pointer begin( const MatrixType& A, size_t i ) { return A.begin(i); }
+   static inline Pointer end  ( const MatrixType& A, size_t i ) { return A.end(i); }
+
+   static inline bool isDirect( const MatrixType& ) { return true; }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SpMVTrait class template for submatrices of row-major compressed
+//        matrices.
+// \ingroup sparse_matrix
+//
+// The elements of a submatrix are directly accessed within the underlying compressed matrix.
+// Since the pointers provide the column indices of the underlying matrix, the direct access is
+// only valid in case the submatrix starts in the first column of the matrix (as for instance
+// in case of the submatrices created by the parallel evaluation of a multiplication).
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool AF >      // Alignment flag
+struct SpMVTrait< SparseSubmatrix<CompressedMatrix<Type,false>,AF,false> >
+{
+   enum { value = 1 };
+
+   typedef SparseSubmatrix<CompressedMatrix<Type,false>,AF,false>  MatrixType;  //!< Type of the sparse matrix.
+   typedef typename CompressedMatrix<Type,false>::ConstIterator     Pointer;     //!< Pointer to the non-zero elements.
+
+   static inline Pointer begin( const MatrixType& A, size_t i ) { return A.begin(i).base(); }
+   static inline Pointer end  ( const MatrixType& A, size_t i ) { return A.end(i).base(); }
+
+   static inline bool isDirect( const MatrixType& A ) {
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         if( A.begin(i) != A.end(i) )
+            return A.begin(i)->index() == A.begin(i).base()->index();
+      }
+      return true;
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SpMVTrait class template for submatrices of constant row-major
+//        compressed matrices.
+// \ingroup sparse_matrix
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool AF >      // Alignment flag
+struct SpMVTrait< SparseSubmatrix<const CompressedMatrix<Type,false>,AF,false> >
+{
+   enum { value = 1 };
+
+   typedef SparseSubmatrix<const CompressedMatrix<Type,false>,AF,false>  MatrixType;  //!< Type of the sparse matrix.
+   typedef typename CompressedMatrix<Type,false>::ConstIterator           Pointer;     //!< Pointer to the non-zero elements.
+
+   static inline Pointer begin( const MatrixType& A, size_t i ) { return A.begin(i).base(); }
+   static inline Pointer end  ( const MatrixType& A, size_t i ) { return A.end(i).base(); }
+
+   static inline bool isDirect( const MatrixType& A ) {
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         if( A.begin(i) != A.end(i) )
+            return A.begin(i)->index() == A.begin(i).base()->index();
+      }
+      return true;
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SpMVTrait class template for row-major compressed SoA matrices.
+// \ingroup sparse_matrix
+//
+// The values and the 32-bit column indices of the non-zero elements are directly accessed via
+// the two separate arrays of the compressed SoA matrix. Since the vectorized kernels interpret
+// the column indices as signed integers, the direct access is only valid in case the matrix has
+// at most \f$ 2^{31} \f$ columns.
+*/
+template< typename Type >  // Data type of the sparse matrix
+struct SpMVTrait< CompressedSoAMatrix<Type,false> >
+{
+   enum { value = 1 };
+
+   typedef CompressedSoAMatrix<Type,false>     MatrixType;  //!< Type of the sparse matrix.
+   typedef typename MatrixType::ConstIterator  Pointer;     //!< Pointer to the non-zero elements.
+
+   static inline Pointer begin( const MatrixType& A, size_t i ) { return A.begin(i); }
+   static inline Pointer end  ( const MatrixType& A, size_t i ) { return A.end(i); }
+
+   static inline bool isDirect( const MatrixType& A ) { return A.columns() <= 0x80000000UL; }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SpMVTrait class template for submatrices of row-major compressed
+//        SoA matrices.
+// \ingroup sparse_matrix
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool AF >      // Alignment flag
+struct SpMVTrait< SparseSubmatrix<CompressedSoAMatrix<Type,false>,AF,false> >
+{
+   enum { value = 1 };
+
+   typedef SparseSubmatrix<CompressedSoAMatrix<Type,false>,AF,false>  MatrixType;  //!< Type of the sparse matrix.
+   typedef typename CompressedSoAMatrix<Type,false>::ConstIterator     Pointer;     //!< Pointer to the non-zero elements.
+
+   static inline Pointer begin( const MatrixType& A, size_t i ) { return A.begin(i).base(); }
+   static inline Pointer end  ( const MatrixType& A, size_t i ) { return A.end(i).base(); }
+
+   static inline bool isDirect( const MatrixType& A ) {
+      if( A.columns() > 0x80000000UL )
+         return false;
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         if( A.begin(i) != A.end(i) )
+            return A.begin(i)->index() == A.begin(i).base()->index();
+      }
+      return true;
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SpMVTrait class template for submatrices of constant row-major
+//        compressed SoA matrices.
+// \ingroup sparse_matrix
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool AF >      // Alignment flag
+struct SpMVTrait< SparseSubmatrix<const CompressedSoAMatrix<Type,false>,AF,false> >
+{
+   enum { value = 1 };
+
+   typedef SparseSubmatrix<const CompressedSoAMatrix<Type,false>,AF,false>  MatrixType;  //!< Type of the sparse matrix.
+   typedef typename CompressedSoAMatrix<Type,false>::ConstIterator           Pointer;     //!< Pointer to the non-zero elements.
+
+   static inline Pointer begin( const MatrixType& A, size_t i ) { return A.begin(i).base(); }
+   static inline Pointer end  ( const MatrixType& A, size_t i ) { return A.end(i).base(); }
+
+   static inline bool isDirect( const MatrixType& A ) {
+      if( A.columns() > 0x80000000UL )
+         return false;
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         if( A.begin(i) != A.end(i) )
+            return A.begin(i)->index() == A.begin(i).base()->index();
+      }
+      return true;
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SpMVTrait class template for block compressed matrices.
+// \ingroup sparse_matrix
+//
+// Block compressed matrices don't provide a direct access to their rows, but are processed
+// block row by block row by a dedicated overload of the spmv() function.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns of the blocks
+struct SpMVTrait< CompressedBlockMatrix<Type,B> >
+{
+   enum { value = 1 };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SpMVTrait class template for sliced ELLPACK matrices.
+// \ingroup sparse_matrix
+//
+// Sliced ELLPACK matrices don't provide a direct access to their rows, but are processed chunk
+// by chunk by a dedicated overload of the spmv() function.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+struct SpMVTrait< SlicedEllpackMatrix<Type,C> >
+{
+   enum { value = 1 };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SpMVTrait class template for submatrices of constant sliced
+//        ELLPACK matrices.
+// \ingroup sparse_matrix
+//
+// Submatrices of sliced ELLPACK matrices result from the SMP partitioning of a sparse matrix/
+// dense vector multiplication and are processed by a dedicated overload of the spmv() function.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C       // Number of rows per chunk
+        , bool AF >      // Alignment flag
+struct SpMVTrait< SparseSubmatrix<const SlicedEllpackMatrix<Type,C>,AF,false> >
+{
+   enum { value = 1 };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TSPMVTRAIT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Selection of the transpose dense vector/sparse matrix multiplication kernels.
+// \ingroup sparse_matrix
+//
+// The TSpMVTrait class template indicates whether a dedicated overload of the tspmv() function
+// is available for the multiplication of a transpose dense vector with a row-major sparse matrix
+// of type \a MT. In this case the nested \a value is set to 1, otherwise it is set to 0.
+*/
+template< typename MT >  // Type of the sparse matrix
+struct TSpMVTrait
+{
+   enum { value = 0 };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the TSpMVTrait class template for sliced ELLPACK matrices.
+// \ingroup sparse_matrix
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+struct TSpMVTrait< SlicedEllpackMatrix<Type,C> >
+{
+   enum { value = 1 };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SPMV ASSIGNMENT OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assignment of the result of a row to the according element of the target vector.
+// \ingroup sparse_matrix
+*/
+struct SpMVAssign
+{
+   template< typename T1, typename T2 >
+   inline void operator()( T1& y, const T2& value ) const { y = value; }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Addition assignment of the result of a row to the according element of the target vector.
+// \ingroup sparse_matrix
+*/
+struct SpMVAddAssign
+{
+   template< typename T1, typename T2 >
+   inline void operator()( T1& y, const T2& value ) const { y += value; }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Subtraction assignment of the result of a row to the according element of the target
+//        vector.
+// \ingroup sparse_matrix
+*/
+struct SpMVSubAssign
+{
+   template< typename T1, typename T2 >
+   inline void operator()( T1& y, const T2& value ) const { y -= value; }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS SPMVKERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Row kernels for the sparse matrix/dense vector multiplication.
+// \ingroup sparse_matrix
+//
+// The SpMVKernel class template computes the inner products of the rows of a row-major sparse
+// matrix with a dense vector. The rows are given in the form of pointers to the non-zero elements
+// (see SpMVTrait) and the dense vector in the form of a pointer to its first element. Long rows
+// are processed by means of two independent accumulators, short rows are processed in groups of
+// four rows in order to overlap the latencies of the indirect accesses to the dense vector.
+*/
+template< typename ET    // Element type of the resulting vector
+        , typename MET   // Element type of the sparse matrix
+        , typename VET   // Element type of the dense vector
+        , bool = BLAZE_AVX2_MODE && IsSame<ET,double>::value && IsSame<MET,double>::value &&
+                 IsSame<VET,double>::value >
+struct SpMVKernel
+{
+   //**Dot function********************************************************************************
+   /*!\brief Computes the inner product of a single row with the dense vector.
+   //
+   // \param element Pointer to the first non-zero element of the row.
+   // \param end Pointer one past the last non-zero element of the row.
+   // \param x Pointer to the first element of the dense vector.
+   // \return The resulting inner product.
+   */
+   template< typename Pointer >  // Type of the pointer to the non-zero elements
+   static inline ET dot( Pointer element, Pointer end, const VET* x )
+   {
+      const size_t n   ( end - element );
+      const size_t ipos( n & size_t(-2) );
+
+      ET tmp1 = ET();
+      ET tmp2 = ET();
+
+      for( size_t k=0UL; k<ipos; k+=2UL ) {
+         tmp1 += element[k    ].value() * x[element[k    ].index()];
+         tmp2 += element[k+1UL].value() * x[element[k+1UL].index()];
+      }
+      if( ipos < n ) {
+         tmp1 += element[ipos].value() * x[element[ipos].index()];
+      }
+
+      return tmp1 + tmp2;
+   }
+   //**********************************************************************************************
+
+   //**Dot function********************************************************************************
+   /*!\brief Computes the inner products of four short rows with the dense vector.
+   //
+   // \param begin Pointers to the first non-zero elements of the four rows.
+   // \param end Pointers one past the last non-zero elements of the four rows.
+   // \param x Pointer to the first element of the dense vector.
+   // \param y The four resulting inner products.
+   // \return void
+   */
+   template< typename Pointer >  // Type of the pointer to the non-zero elements
+   static inline void dot4( const Pointer* begin, const Pointer* end, const VET* x, ET* y )
+   {
+      const size_t n0( end[0] - begin[0] );
+      const size_t n1( end[1] - begin[1] );
+      const size_t n2( end[2] - begin[2] );
+      const size_t n3( end[3] - begin[3] );
+
+      const size_t kend( min( n0, n1, min( n2, n3 ) ) );
+
+      ET tmp0 = ET();
+      ET tmp1 = ET();
+      ET tmp2 = ET();
+      ET tmp3 = ET();
+
+      for( size_t k=0UL; k<kend; ++k ) {
+         tmp0 += begin[0][k].value() * x[begin[0][k].index()];
+         tmp1 += begin[1][k].value() * x[begin[1][k].index()];
+         tmp2 += begin[2][k].value() * x[begin[2][k].index()];
+         tmp3 += begin[3][k].value() * x[begin[3][k].index()];
+      }
+
+      for( size_t k=kend; k<n0; ++k ) tmp0 += begin[0][k].value() * x[begin[0][k].index()];
+      for( size_t k=kend; k<n1; ++k ) tmp1 += begin[1][k].value() * x[begin[1][k].index()];
+      for( size_t k=kend; k<n2; ++k ) tmp2 += begin[2][k].value() * x[begin[2][k].index()];
+      for( size_t k=kend; k<n3; ++k ) tmp3 += begin[3][k].value() * x[begin[3][k].index()];
+
+      y[0] = tmp0;
+      y[1] = tmp1;
+      y[2] = tmp2;
+      y[3] = tmp3;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SpMVKernel class template for double precision values.
+// \ingroup sparse_matrix
+//
+// This specialization computes the inner products of long rows by means of intrinsics. The
+// non-zero elements are loaded as value/index pairs and split into a vector of values and a
+// vector of indices, which is used to gather the according elements of the dense vector. Since
+// the elements of a sparse matrix are accessed only once, they can optionally be prefetched with
+// a non-temporal hint, which keeps the elements of the dense vector in the cache (see
+// blaze::SMATDVECMULT_PREFETCH_DISTANCE). The specialization requires the AVX2 mode to be active.
+*/
+#if BLAZE_AVX2_MODE
+template<>
+struct SpMVKernel<double,double,double,true> : public SpMVKernel<double,double,double,false>
+{
+   //**Type definitions****************************************************************************
+   typedef IntrinsicTrait<double>  IT;  //!< Intrinsic trait for the double precision values.
+   //**********************************************************************************************
+
+   //**Dot function********************************************************************************
+   /*!\brief Computes the inner product of a single row with the dense vector.
+   //
+   // \param element Pointer to the first non-zero element of the row.
+   // \param end Pointer one past the last non-zero element of the row.
+   // \param x Pointer to the first element of the dense vector.
+   // \return The resulting inner product.
+   */
+   template< typename Pointer >  // Type of the pointer to the non-zero elements
+   static BLAZE_ALWAYS_INLINE double dot( Pointer element, Pointer end, const double* x )
+   {
+      BLAZE_STATIC_ASSERT( sizeof( *element ) == 2UL*sizeof( double ) );
+
+      const size_t n   ( end - element );
+      const size_t ipos( n & size_t(-2*IT::size) );
+
+      const double* pairs( reinterpret_cast<const double*>( element ) );
+
+      sse_double_t xmm1, xmm2, values;
+      sse_int64_t indices;
+
+      for( size_t k=0UL; k<ipos; k+=2UL*IT::size ) {
+         if( SMATDVECMULT_PREFETCH_DISTANCE > 0UL ) {
+            for( size_t l=0UL; l<4UL*IT::size; l+=8UL )
+               prefetchNTA( pairs + 2UL*( k + SMATDVECMULT_PREFETCH_DISTANCE ) + l );
+         }
+         loadPairs( pairs + 2UL*k, values, indices );
+         xmm1 = fmadd( values, gather( x, indices ), xmm1 );
+         loadPairs( pairs + 2UL*(k+IT::size), values, indices );
+         xmm2 = fmadd( values, gather( x, indices ), xmm2 );
+      }
+
+      double tmp( sum( xmm1 + xmm2 ) );
+
+      for( size_t k=ipos; k<n; ++k ) {
+         tmp += element[k].value() * x[element[k].index()];
+      }
+
+      return tmp;
+   }
+   //**********************************************************************************************
+
+   //**Dot function********************************************************************************
+   /*!\brief Computes the inner product of a single row of a compressed SoA matrix with the dense
+   //        vector.
+   //
+   // \param element Iterator to the first non-zero element of the row.
+   // \param end Iterator one past the last non-zero element of the row.
+   // \param x Pointer to the first element of the dense vector.
+   // \return The resulting inner product.
+   //
+   // In contrast to the interleaved value/index pairs, the values and the 32-bit indices of a
+   // compressed SoA matrix are stored in two separate arrays. Therefore the values are directly
+   // loaded and the indices are directly used for gathering the elements of the dense vector.
+   */
+   static BLAZE_ALWAYS_INLINE double dot( SoAIterator<const double> element,
+                                          SoAIterator<const double> end, const double* x )
+   {
+      const size_t n   ( end - element );
+      const size_t ipos( n & size_t(-2*IT::size) );
+
+      const double*   values ( element.base() );
+      const uint32_t* indices( element.indexBase() );
+
+      sse_double_t xmm1, xmm2;
+
+      for( size_t k=0UL; k<ipos; k+=2UL*IT::size ) {
+         if( SMATDVECMULT_PREFETCH_DISTANCE > 0UL ) {
+            for( size_t l=0UL; l<2UL*IT::size; l+=8UL )
+               prefetchNTA( values + k + SMATDVECMULT_PREFETCH_DISTANCE + l );
+            prefetchNTA( indices + k + SMATDVECMULT_PREFETCH_DISTANCE );
+         }
+         xmm1 = fmadd( loadu( values+k ), gather( x, indices+k ), xmm1 );
+         xmm2 = fmadd( loadu( values+k+IT::size ), gather( x, indices+k+IT::size ), xmm2 );
+      }
+
+      double tmp( sum( xmm1 + xmm2 ) );
+
+      for( size_t k=ipos; k<n; ++k ) {
+         tmp += values[k] * x[indices[k]];
+      }
+
+      return tmp;
+   }
+   //**********************************************************************************************
+};
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Block kernel for the block compressed matrix/dense vector multiplication.
+// \ingroup sparse_matrix
+//
+// The SpMVBlockKernel class template computes the product of a single dense \f$ B \times B \f$
+// block with the according contiguous segment of the dense vector. Since the size of the block
+// is known at compile time, the loops are completely unrolled and vectorized by the compiler.
+*/
+template< typename ET    // Element type of the resulting vector
+        , typename MET   // Element type of the sparse matrix
+        , typename VET   // Element type of the dense vector
+        , size_t B >     // Number of rows and columns of the blocks
+struct SpMVBlockKernel
+{
+   //**Multiply function***************************************************************************
+   /*!\brief Adds the product of a single block and a segment of the dense vector to the result.
+   //
+   // \param block The dense block.
+   // \param x Pointer to the first element of the according segment of the dense vector.
+   // \param y The \a B resulting elements.
+   // \return void
+   */
+   static BLAZE_ALWAYS_INLINE void multiply( const StaticMatrix<MET,B,B,false>& block, const VET* x, ET* y )
+   {
+      for( size_t i=0UL; i<B; ++i ) {
+         for( size_t j=0UL; j<B; ++j ) {
+            y[i] += block(i,j) * x[j];
+         }
+      }
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Chunk kernel for the sliced ELLPACK matrix/dense vector multiplication.
+// \ingroup sparse_matrix
+//
+// The SpMVSellKernel class template computes the \a C inner products of the rows of a single
+// chunk of a sliced ELLPACK matrix with a dense vector. Since the k-th elements of the \a C rows
+// of a chunk are stored contiguously, the rows are processed simultaneously, one element per row
+// and step.
+*/
+template< typename ET    // Element type of the resulting vector
+        , typename MET   // Element type of the sparse matrix
+        , typename VET   // Element type of the dense vector
+        , size_t C       // Number of rows per chunk
+        , bool = BLAZE_AVX2_MODE && IsSame<ET,double>::value && IsSame<MET,double>::value &&
+                 IsSame<VET,double>::value && ( C % IntrinsicTrait<double>::size == 0UL ) >
+struct SpMVSellKernel
+{
+   //**Multiply function***************************************************************************
+   /*!\brief Computes the inner products of the rows of a single chunk with the dense vector.
+   //
+   // \param values Pointer to the values of the chunk.
+   // \param indices Pointer to the column indices of the chunk.
+   // \param width The width of the chunk.
+   // \param x Pointer to the first element of the dense vector.
+   // \param y The \a C resulting inner products.
+   // \return void
+   */
+   static BLAZE_ALWAYS_INLINE void multiply( const MET* values, const uint32_t* indices, size_t width,
+                                             const VET* x, ET* y )
+   {
+      for( size_t l=0UL; l<C; ++l ) {
+         y[l] = ET();
+      }
+
+      for( size_t k=0UL; k<width; ++k, values+=C, indices+=C ) {
+         for( size_t l=0UL; l<C; ++l ) {
+            y[l] += values[l] * x[indices[l]];
+         }
+      }
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SpMVSellKernel class template for double precision values.
+// \ingroup sparse_matrix
+//
+// This specialization processes the \a C rows of a chunk by means of \a C/IT::size intrinsic
+// accumulators. In each step the values are directly loaded and the column indices are used to
+// gather the according elements of the dense vector. The specialization requires the AVX2 mode
+// to be active and \a C to be a multiple of the number of values per intrinsic vector.
+*/
+#if BLAZE_AVX2_MODE
+template< size_t C >  // Number of rows per chunk
+struct SpMVSellKernel<double,double,double,C,true>
+{
+   //**Type definitions****************************************************************************
+   typedef IntrinsicTrait<double>  IT;  //!< Intrinsic trait for the double precision values.
+   //**********************************************************************************************
+
+   //**Multiply function***************************************************************************
+   /*!\brief Computes the inner products of the rows of a single chunk with the dense vector.
+   //
+   // \param values Pointer to the values of the chunk.
+   // \param indices Pointer to the column indices of the chunk.
+   // \param width The width of the chunk.
+   // \param x Pointer to the first element of the dense vector.
+   // \param y The \a C resulting inner products.
+   // \return void
+   */
+   static BLAZE_ALWAYS_INLINE void multiply( const double* values, const uint32_t* indices, size_t width,
+                                             const double* x, double* y )
+   {
+      sse_double_t xmm[C/IT::size];
+
+      for( size_t k=0UL; k<width; ++k, values+=C, indices+=C ) {
+         for( size_t l=0UL; l<C; l+=IT::size ) {
+            xmm[l/IT::size] = fmadd( loadu( values+l ), gather( x, indices+l ), xmm[l/IT::size] );
+         }
+      }
+
+      for( size_t l=0UL; l<C; l+=IT::size ) {
+         storeu( y+l, xmm[l/IT::size] );
+      }
+   }
+   //**********************************************************************************************
+};
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SPARSE MATRIX/DENSE VECTOR MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of a row-major sparse matrix and a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup sparse_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side row-major sparse matrix operand.
+// \param x Pointer to the first element of the right-hand side dense vector operand.
+// \param op The assignment operation (SpMVAssign, SpMVAddAssign, or SpMVSubAssign).
+// \return void
+//
+// This function computes the product of a row-major sparse matrix and a dense vector and combines
+// the result with the target vector by means of the given assignment operation. The rows of the
+// sparse matrix are directly accessed via SpMVTrait. In case four consecutive rows contain at most
+// blaze::SMATDVECMULT_SHORTROW_THRESHOLD non-zero elements, they are processed simultaneously.
+// All other rows are processed individually, which for double precision values in AVX2 mode
+// involves gathering the elements of the dense vector. In case the matrix does not provide the
+// direct access (see SpMVTrait::isDirect()), the rows are processed via iterators.
+*/
+template< typename ET     // Element type of the resulting vector
+        , typename VT     // Type of the target dense vector
+        , typename MT     // Type of the left-hand side sparse matrix
+        , typename VET    // Element type of the right-hand side dense vector
+        , typename OP >   // Type of the assignment operation
+void spmv( DenseVector<VT,false>& y, const MT& A, const VET* x, OP op )
+{
+   typedef SpMVTrait<MT>                Trait;
+   typedef typename Trait::Pointer      Pointer;
+   typedef typename MT::ConstIterator   ConstIterator;
+   typedef SpMVKernel< ET, typename MT::ElementType, VET >  Kernel;
+
+   BLAZE_INTERNAL_ASSERT( (~y).size() == A.rows(), "Invalid vector sizes" );
+
+   const size_t M( A.rows() );
+
+   // Processing the rows via iterators in case the direct access is not available
+   if( !Trait::isDirect( A ) )
+   {
+      for( size_t i=0UL; i<M; ++i ) {
+         ET tmp = ET();
+         const ConstIterator end( A.end(i) );
+         for( ConstIterator element=A.begin(i); element!=end; ++element )
+            tmp += element->value() * x[element->index()];
+         op( (~y)[i], tmp );
+      }
+      return;
+   }
+
+   size_t i( 0UL );
+
+   for( ; (i+4UL) <= M; i+=4UL )
+   {
+      const Pointer begin[4] = { Trait::begin( A, i     ), Trait::begin( A, i+1UL ),
+                                 Trait::begin( A, i+2UL ), Trait::begin( A, i+3UL ) };
+      const Pointer end  [4] = { Trait::end  ( A, i     ), Trait::end  ( A, i+1UL ),
+                                 Trait::end  ( A, i+2UL ), Trait::end  ( A, i+3UL ) };
+
+      if( size_t( end[0] - begin[0] ) <= SMATDVECMULT_SHORTROW_THRESHOLD &&
+          size_t( end[1] - begin[1] ) <= SMATDVECMULT_SHORTROW_THRESHOLD &&
+          size_t( end[2] - begin[2] ) <= SMATDVECMULT_SHORTROW_THRESHOLD &&
+          size_t( end[3] - begin[3] ) <= SMATDVECMULT_SHORTROW_THRESHOLD )
+      {
+         ET tmp[4];
+         Kernel::dot4( begin, end, x, tmp );
+         op( (~y)[i    ], tmp[0] );
+         op( (~y)[i+1UL], tmp[1] );
+         op( (~y)[i+2UL], tmp[2] );
+         op( (~y)[i+3UL], tmp[3] );
+      }
+      else {
+         op( (~y)[i    ], Kernel::dot( begin[0], end[0], x ) );
+         op( (~y)[i+1UL], Kernel::dot( begin[1], end[1], x ) );
+         op( (~y)[i+2UL], Kernel::dot( begin[2], end[2], x ) );
+         op( (~y)[i+3UL], Kernel::dot( begin[3], end[3], x ) );
+      }
+   }
+
+   for( ; i<M; ++i ) {
+      op( (~y)[i], Kernel::dot( Trait::begin( A, i ), Trait::end( A, i ), x ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of a block compressed matrix and a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup sparse_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side block compressed matrix operand.
+// \param x Pointer to the first element of the right-hand side dense vector operand.
+// \param op The assignment operation (SpMVAssign, SpMVAddAssign, or SpMVSubAssign).
+// \return void
+//
+// This function computes the product of a block compressed matrix and a dense vector and combines
+// the result with the target vector by means of the given assignment operation. The \a B results
+// of a block row are accumulated in local variables. Each block is multiplied with a contiguous
+// segment of the dense vector (see SpMVBlockKernel), which requires only a single index per block.
+*/
+template< typename ET     // Element type of the resulting vector
+        , typename VT     // Type of the target dense vector
+        , typename Type   // Data type of the block compressed matrix
+        , size_t B        // Number of rows and columns of the blocks
+        , typename VET    // Element type of the right-hand side dense vector
+        , typename OP >   // Type of the assignment operation
+void spmv( DenseVector<VT,false>& y, const CompressedBlockMatrix<Type,B>& A, const VET* x, OP op )
+{
+   typedef typename CompressedBlockMatrix<Type,B>::ConstBlockIterator  ConstBlockIterator;
+   typedef SpMVBlockKernel<ET,Type,VET,B>  Kernel;
+
+   BLAZE_INTERNAL_ASSERT( (~y).size() == A.rows(), "Invalid vector sizes" );
+
+   const size_t MB( A.blockRows() );
+
+   for( size_t ib=0UL; ib<MB; ++ib )
+   {
+      ET tmp[B];
+      for( size_t i=0UL; i<B; ++i )
+         tmp[i] = ET();
+
+      const ConstBlockIterator end( A.blockEnd( ib ) );
+      for( ConstBlockIterator block=A.blockBegin( ib ); block!=end; ++block )
+         Kernel::multiply( block->value(), x + block->index()*B, tmp );
+
+      for( size_t i=0UL; i<B; ++i )
+         op( (~y)[ib*B+i], tmp[i] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of a range of rows of a sliced ELLPACK matrix and a dense vector.
+// \ingroup sparse_matrix
+//
+// \param y The target dense vector for the rows \f$ [begin..end) \f$.
+// \param A The left-hand side sliced ELLPACK matrix operand.
+// \param begin The first row of the range.
+// \param end The row one past the last row of the range.
+// \param x Pointer to the first element of the right-hand side dense vector operand.
+// \param op The assignment operation (SpMVAssign, SpMVAddAssign, or SpMVSubAssign).
+// \return void
+//
+// This function computes the product of the rows \f$ [begin..end) \f$ of a sliced ELLPACK matrix
+// and a dense vector. Since the rows are only reordered within their sorting window, all chunks
+// of the windows overlapping the range are processed (see SpMVSellKernel) and the results of the
+// rows outside of the range are discarded. Since the vectorized kernel interprets the column
+// indices as signed integers, matrices with more than \f$ 2^{31} \f$ columns are processed by
+// the scalar kernel.
+*/
+template< typename ET     // Element type of the resulting vector
+        , typename VT     // Type of the target dense vector
+        , typename Type   // Data type of the sliced ELLPACK matrix
+        , size_t C        // Number of rows per chunk
+        , typename VET    // Element type of the right-hand side dense vector
+        , typename OP >   // Type of the assignment operation
+void spmvRows( DenseVector<VT,false>& y, const SlicedEllpackMatrix<Type,C>& A,
+               size_t begin, size_t end, const VET* x, OP op )
+{
+   typedef SpMVSellKernel<ET,Type,VET,C>        Kernel;
+   typedef SpMVSellKernel<ET,Type,VET,C,false>  ScalarKernel;
+
+   BLAZE_INTERNAL_ASSERT( begin <= end && end <= A.rows(), "Invalid row range"    );
+   BLAZE_INTERNAL_ASSERT( (~y).size() == end - begin     , "Invalid vector sizes" );
+
+   if( begin == end ) return;
+
+   const size_t sigma( A.sigma() );
+   const size_t first( ( begin / sigma ) * sigma / C );
+   const size_t last ( min( ( ( end - 1UL ) / sigma + 1UL ) * sigma / C, A.chunks() ) );
+   const bool   direct( A.columns() <= 0x80000000UL );
+
+   for( size_t c=first; c<last; ++c )
+   {
+      ET tmp[C];
+
+      if( direct )
+         Kernel::multiply( A.chunkValues(c), A.chunkIndices(c), A.chunkWidth(c), x, tmp );
+      else
+         ScalarKernel::multiply( A.chunkValues(c), A.chunkIndices(c), A.chunkWidth(c), x, tmp );
+
+      const uint32_t* const rows( A.chunkRows(c) );
+
+      for( size_t l=0UL; l<C; ++l ) {
+         const size_t i( size_t( rows[l] ) - begin );
+         if( i < end - begin )
+            op( (~y)[i], tmp[l] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of a sliced ELLPACK matrix and a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup sparse_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side sliced ELLPACK matrix operand.
+// \param x Pointer to the first element of the right-hand side dense vector operand.
+// \param op The assignment operation (SpMVAssign, SpMVAddAssign, or SpMVSubAssign).
+// \return void
+//
+// This function computes the product of a sliced ELLPACK matrix and a dense vector and combines
+// the result with the target vector by means of the given assignment operation. The \a C rows
+// of a chunk are processed simultaneously (see SpMVSellKernel), which for double precision values
+// in AVX2 mode involves gathering the elements of the dense vector.
+*/
+template< typename ET     // Element type of the resulting vector
+        , typename VT     // Type of the target dense vector
+        , typename Type   // Data type of the sliced ELLPACK matrix
+        , size_t C        // Number of rows per chunk
+        , typename VET    // Element type of the right-hand side dense vector
+        , typename OP >   // Type of the assignment operation
+void spmv( DenseVector<VT,false>& y, const SlicedEllpackMatrix<Type,C>& A, const VET* x, OP op )
+{
+   spmvRows<ET>( y, A, 0UL, A.rows(), x, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of a submatrix of a sliced ELLPACK matrix and a dense vector
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup sparse_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side submatrix operand.
+// \param x Pointer to the first element of the right-hand side dense vector operand.
+// \param op The assignment operation (SpMVAssign, SpMVAddAssign, or SpMVSubAssign).
+// \return void
+//
+// This function computes the product of a submatrix of a sliced ELLPACK matrix and a dense
+// vector. In case the submatrix comprises all columns of the sliced ELLPACK matrix (as for
+// instance in the SMP partitioning of a sparse matrix/dense vector multiplication), the rows
+// of the submatrix are processed chunk by chunk (see spmvRows()). Otherwise the rows are
+// processed via iterators.
+*/
+template< typename ET     // Element type of the resulting vector
+        , typename VT     // Type of the target dense vector
+        , typename Type   // Data type of the sliced ELLPACK matrix
+        , size_t C        // Number of rows per chunk
+        , bool AF         // Alignment flag
+        , typename VET    // Element type of the right-hand side dense vector
+        , typename OP >   // Type of the assignment operation
+void spmv( DenseVector<VT,false>& y, const SparseSubmatrix<const SlicedEllpackMatrix<Type,C>,AF,false>& A,
+           const VET* x, OP op )
+{
+   typedef typename SparseSubmatrix<const SlicedEllpackMatrix<Type,C>,AF,false>::ConstIterator  ConstIterator;
+
+   BLAZE_INTERNAL_ASSERT( (~y).size() == A.rows(), "Invalid vector sizes" );
+
+   if( A.column() == 0UL && A.columns() == A.operand().columns() ) {
+      spmvRows<ET>( y, A.operand(), A.row(), A.row()+A.rows(), x, op );
+      return;
+   }
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      ET tmp = ET();
+      const ConstIterator end( A.end(i) );
+      for( ConstIterator element=A.begin(i); element!=end; ++element )
+         tmp += element->value() * x[element->index()];
+      op( (~y)[i], tmp );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TRANSPOSE DENSE VECTOR/SPARSE MATRIX MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of a transpose dense vector and a sliced ELLPACK matrix
+//        (\f$ \vec{y}^T=\vec{x}^T*A \f$).
+// \ingroup sparse_matrix
+//
+// \param y The target transpose dense vector.
+// \param x Pointer to the first element of the left-hand side transpose dense vector operand.
+// \param A The right-hand side sliced ELLPACK matrix operand.
+// \param op The assignment operation (SpMVAddAssign or SpMVSubAssign).
+// \return void
+//
+// This function scatters the products of the rows of a sliced ELLPACK matrix and the according
+// elements of the dense vector into the target vector by means of the given assignment operation.
+// The lanes of a chunk are traversed one after another up to their number of non-zero elements,
+// i.e. in contrast to the sparse matrix/dense vector multiplication the padding elements are not
+// touched. This also prevents that an infinite element of the dense vector turns the target
+// vector into NaN.
+*/
+template< typename VT     // Type of the target dense vector
+        , typename VET    // Element type of the left-hand side dense vector
+        , typename Type   // Data type of the sliced ELLPACK matrix
+        , size_t C        // Number of rows per chunk
+        , typename OP >   // Type of the assignment operation
+void tspmv( DenseVector<VT,true>& y, const VET* x, const SlicedEllpackMatrix<Type,C>& A, OP op )
+{
+   BLAZE_INTERNAL_ASSERT( (~y).size() == A.columns(), "Invalid vector sizes" );
+
+   const size_t M ( A.rows() );
+   const size_t NC( A.chunks() );
+
+   for( size_t c=0UL; c<NC; ++c )
+   {
+      const Type*     values ( A.chunkValues(c)  );
+      const uint32_t* indices( A.chunkIndices(c) );
+      const uint32_t* rows   ( A.chunkRows(c)    );
+      const uint32_t* lengths( A.chunkLengths(c) );
+
+      for( size_t l=0UL; l<C && rows[l]<M; ++l )
+      {
+         const VET    xl  ( x[rows[l]] );
+         const size_t kend( l + lengths[l]*C );
+
+         for( size_t k=l; k<kend; k+=C ) {
+            op( (~y)[indices[k]], values[k] * xl );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -97,12 +97,14 @@
 #include <blaze/util/constraints/Vectorizable.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/FalseType.h>
 #include <blaze/util/logging/FunctionTrace.h>
 #include <blaze/util/mpl/And.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/mpl/Or.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Template.h>
+#include <blaze/util/TrueType.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsConst.h>
 #include <blaze/util/typetraits/IsFloatingPoint.h>
@@ -700,12 +702,7 @@ class DenseSubmatrix : public DenseMatrix< DenseSubmatrix<MT,AF,SO>, SO >
             return iterator_.loadu();
          }
          else {
-            AlignedArray<ElementType,IT::size> array;
-            for( size_t j=0UL; j<rest_; ++j )
-               array[j] = *(iterator_+j);
-            for( size_t j=rest_; j<IT::size; ++j )
-               array[j] = ElementType();
-            return blaze::load( array.data() );
+            return loadRest( typename IfTrue< maskedRest, TrueType, FalseType >::Type() );
          }
       }
       //*******************************************************************************************
@@ -864,6 +861,37 @@ class DenseSubmatrix : public DenseMatrix< DenseSubmatrix<MT,AF,SO>, SO >
       //*******************************************************************************************
 
     private:
+      //**Compilation flags************************************************************************
+      //! Compilation switch for the masked load of the final intrinsic element.
+      /*! In case the underlying iterator provides direct access to the matrix elements and the
+          element type supports masked intrinsic loads, the remaining elements beyond the final
+          iterator are loaded via a single masked load. */
+      enum { maskedRest = IT::masked && IsReference<ReferenceType>::value };
+      //*******************************************************************************************
+
+      //**LoadRest functions***********************************************************************
+      /*!\brief Masked load of the remaining elements beyond the final iterator.
+      //
+      // \return The loaded intrinsic element.
+      */
+      inline IntrinsicType loadRest( TrueType ) const {
+         return maskload( &(*iterator_), rest_ );
+      }
+
+      /*!\brief Element-wise load of the remaining elements beyond the final iterator.
+      //
+      // \return The loaded intrinsic element.
+      */
+      inline IntrinsicType loadRest( FalseType ) const {
+         AlignedArray<ElementType,IT::size> array;
+         for( size_t j=0UL; j<rest_; ++j )
+            array[j] = *(iterator_+j);
+         for( size_t j=rest_; j<IT::size; ++j )
+            array[j] = ElementType();
+         return blaze::load( array.data() );
+      }
+      //*******************************************************************************************
+
       //**Member variables*************************************************************************
       IteratorType iterator_;   //!< Iterator to the current submatrix element.
       IteratorType final_;      //!< The final iterator for intrinsic operations.
@@ -1008,6 +1036,17 @@ class DenseSubmatrix : public DenseMatrix< DenseSubmatrix<MT,AF,SO>, SO >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Compilation switch for the masked access to the final intrinsic element.
+   /*! In case the submatrix provides direct access to the elements of the underlying dense
+       matrix and the element type supports masked intrinsic operations, the remaining elements
+       beyond the final column of an unaligned submatrix are loaded and stored via a single
+       masked load and store, respectively. */
+   enum { maskedRest = IT::masked && IsReference<Reference>::value };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Expression template evaluation functions****************************************************
    /*!\name Expression template evaluation functions */
@@ -1073,6 +1112,17 @@ class DenseSubmatrix : public DenseMatrix< DenseSubmatrix<MT,AF,SO>, SO >
    //**********************************************************************************************
 
  private:
+   //**Intrinsic helper functions******************************************************************
+   /*!\name Intrinsic helper functions */
+   //@{
+   inline IntrinsicType loadRest( size_t i, size_t j, TrueType  ) const;
+   inline IntrinsicType loadRest( size_t i, size_t j, FalseType ) const;
+
+   inline void storeRest( size_t i, size_t j, const IntrinsicType& value, TrueType  );
+   inline void storeRest( size_t i, size_t j, const IntrinsicType& value, FalseType );
+   //@}
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
@@ -3163,8 +3213,6 @@ template< typename MT  // Type of the dense matrix
 inline typename DenseSubmatrix<MT,AF,SO>::IntrinsicType
    DenseSubmatrix<MT,AF,SO>::loadu( size_t i, size_t j ) const
 {
-   using blaze::load;
-
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
 
    BLAZE_INTERNAL_ASSERT( i < rows()         , "Invalid row access index"    );
@@ -3178,12 +3226,7 @@ inline typename DenseSubmatrix<MT,AF,SO>::IntrinsicType
       return matrix_.loadu( row_+i, column_+j );
    }
    else {
-      AlignedArray<ElementType,IT::size> array;
-      for( size_t k=0UL; k<rest_; ++k )
-         array[k] = matrix_(row_+i,column_+j+k);
-      for( size_t k=rest_; k<IT::size; ++k )
-         array[k] = ElementType();
-      return load( array.data() );
+      return loadRest( i, j, typename IfTrue< maskedRest, TrueType, FalseType >::Type() );
    }
 }
 //*************************************************************************************************
@@ -3236,8 +3279,6 @@ template< typename MT  // Type of the dense matrix
         , bool SO >    // Storage order
 inline void DenseSubmatrix<MT,AF,SO>::storeu( size_t i, size_t j, const IntrinsicType& value )
 {
-   using blaze::store;
-
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
 
    BLAZE_INTERNAL_ASSERT( i < rows()         , "Invalid row access index"    );
@@ -3251,10 +3292,7 @@ inline void DenseSubmatrix<MT,AF,SO>::storeu( size_t i, size_t j, const Intrinsi
       matrix_.storeu( row_+i, column_+j, value );
    }
    else {
-      AlignedArray<ElementType,IT::size> array;
-      store( array.data(), value );
-      for( size_t k=0UL; k<rest_; ++k )
-         matrix_(row_+i,column_+j+k) = array[k];
+      storeRest( i, j, value, typename IfTrue< maskedRest, TrueType, FalseType >::Type() );
    }
 }
 //*************************************************************************************************
@@ -3287,6 +3325,102 @@ inline void DenseSubmatrix<MT,AF,SO>::stream( size_t i, size_t j, const Intrinsi
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Masked load of the remaining elements beyond the final column of the submatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j The final column index of the submatrix.
+// \return The loaded intrinsic element.
+//
+// This function loads the remaining elements beyond the final column of an unaligned submatrix
+// via a single masked load. The memory beyond the end of the row is not accessed.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool AF      // Alignment flag
+        , bool SO >    // Storage order
+inline typename DenseSubmatrix<MT,AF,SO>::IntrinsicType
+   DenseSubmatrix<MT,AF,SO>::loadRest( size_t i, size_t j, TrueType ) const
+{
+   return maskload( &matrix_(row_+i,column_+j), rest_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise load of the remaining elements beyond the final column of the submatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j The final column index of the submatrix.
+// \return The loaded intrinsic element.
+//
+// This function loads the remaining elements beyond the final column of an unaligned submatrix
+// element by element into a zero-padded intrinsic element.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool AF      // Alignment flag
+        , bool SO >    // Storage order
+inline typename DenseSubmatrix<MT,AF,SO>::IntrinsicType
+   DenseSubmatrix<MT,AF,SO>::loadRest( size_t i, size_t j, FalseType ) const
+{
+   using blaze::load;
+
+   AlignedArray<ElementType,IT::size> array;
+   for( size_t k=0UL; k<rest_; ++k )
+      array[k] = matrix_(row_+i,column_+j+k);
+   for( size_t k=rest_; k<IT::size; ++k )
+      array[k] = ElementType();
+   return load( array.data() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked store of the remaining elements beyond the final column of the submatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j The final column index of the submatrix.
+// \param value The intrinsic element to be stored.
+// \return void
+//
+// This function stores the remaining elements beyond the final column of an unaligned submatrix
+// via a single masked store. The memory beyond the end of the row is not modified.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool AF      // Alignment flag
+        , bool SO >    // Storage order
+inline void DenseSubmatrix<MT,AF,SO>::storeRest( size_t i, size_t j, const IntrinsicType& value, TrueType )
+{
+   maskstore( &matrix_(row_+i,column_+j), value, rest_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise store of the remaining elements beyond the final column of the submatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j The final column index of the submatrix.
+// \param value The intrinsic element to be stored.
+// \return void
+//
+// This function stores the remaining elements beyond the final column of an unaligned submatrix
+// element by element.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool AF      // Alignment flag
+        , bool SO >    // Storage order
+inline void DenseSubmatrix<MT,AF,SO>::storeRest( size_t i, size_t j, const IntrinsicType& value, FalseType )
+{
+   using blaze::store;
+
+   AlignedArray<ElementType,IT::size> array;
+   store( array.data(), value );
+   for( size_t k=0UL; k<rest_; ++k )
+      matrix_(row_+i,column_+j+k) = array[k];
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the assignment of a row-major dense matrix.
 //
@@ -4091,12 +4225,7 @@ class DenseSubmatrix<MT,unaligned,true> : public DenseMatrix< DenseSubmatrix<MT,
             return iterator_.loadu();
          }
          else {
-            AlignedArray<ElementType,IT::size> array;
-            for( size_t i=0UL; i<rest_; ++i )
-               array[i] = *(iterator_+i);
-            for( size_t i=rest_; i<IT::size; ++i )
-               array[i] = ElementType();
-            return blaze::load( array.data() );
+            return loadRest( typename IfTrue< maskedRest, TrueType, FalseType >::Type() );
          }
       }
       //*******************************************************************************************
@@ -4255,6 +4384,37 @@ class DenseSubmatrix<MT,unaligned,true> : public DenseMatrix< DenseSubmatrix<MT,
       //*******************************************************************************************
 
     private:
+      //**Compilation flags************************************************************************
+      //! Compilation switch for the masked load of the final intrinsic element.
+      /*! In case the underlying iterator provides direct access to the matrix elements and the
+          element type supports masked intrinsic loads, the remaining elements beyond the final
+          iterator are loaded via a single masked load. */
+      enum { maskedRest = IT::masked && IsReference<ReferenceType>::value };
+      //*******************************************************************************************
+
+      //**LoadRest functions***********************************************************************
+      /*!\brief Masked load of the remaining elements beyond the final iterator.
+      //
+      // \return The loaded intrinsic element.
+      */
+      inline IntrinsicType loadRest( TrueType ) const {
+         return maskload( &(*iterator_), rest_ );
+      }
+
+      /*!\brief Element-wise load of the remaining elements beyond the final iterator.
+      //
+      // \return The loaded intrinsic element.
+      */
+      inline IntrinsicType loadRest( FalseType ) const {
+         AlignedArray<ElementType,IT::size> array;
+         for( size_t i=0UL; i<rest_; ++i )
+            array[i] = *(iterator_+i);
+         for( size_t i=rest_; i<IT::size; ++i )
+            array[i] = ElementType();
+         return blaze::load( array.data() );
+      }
+      //*******************************************************************************************
+
       //**Member variables*************************************************************************
       IteratorType iterator_;   //!< Iterator to the current submatrix element.
       IteratorType final_;      //!< The final iterator for intrinsic operations.
@@ -4393,6 +4553,15 @@ class DenseSubmatrix<MT,unaligned,true> : public DenseMatrix< DenseSubmatrix<MT,
    };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Compilation switch for the masked access to the final intrinsic element.
+   /*! In case the submatrix provides direct access to the elements of the underlying dense
+       matrix and the element type supports masked intrinsic operations, the remaining elements
+       beyond the final row of an unaligned submatrix are loaded and stored via a single
+       masked load and store, respectively. */
+   enum { maskedRest = IT::masked && IsReference<Reference>::value };
+   //**********************************************************************************************
+
  public:
    //**Expression template evaluation functions****************************************************
    /*!\name Expression template evaluation functions */
@@ -4458,6 +4627,17 @@ class DenseSubmatrix<MT,unaligned,true> : public DenseMatrix< DenseSubmatrix<MT,
    //**********************************************************************************************
 
  private:
+   //**Intrinsic helper functions******************************************************************
+   /*!\name Intrinsic helper functions */
+   //@{
+   inline IntrinsicType loadRest( size_t i, size_t j, TrueType  ) const;
+   inline IntrinsicType loadRest( size_t i, size_t j, FalseType ) const;
+
+   inline void storeRest( size_t i, size_t j, const IntrinsicType& value, TrueType  );
+   inline void storeRest( size_t i, size_t j, const IntrinsicType& value, FalseType );
+   //@}
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
@@ -6502,8 +6682,6 @@ template< typename MT >  // Type of the dense matrix
 inline typename DenseSubmatrix<MT,unaligned,true>::IntrinsicType
    DenseSubmatrix<MT,unaligned,true>::loadu( size_t i, size_t j ) const
 {
-   using blaze::load;
-
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
 
    BLAZE_INTERNAL_ASSERT( i < rows()         , "Invalid row access index"    );
@@ -6517,12 +6695,7 @@ inline typename DenseSubmatrix<MT,unaligned,true>::IntrinsicType
       return matrix_.loadu( row_+i, column_+j );
    }
    else {
-      AlignedArray<ElementType,IT::size> array;
-      for( size_t k=0UL; k<rest_; ++k )
-         array[k] = matrix_(row_+i+k,column_+j);
-      for( size_t k=rest_; k<IT::size; ++k )
-         array[k] = ElementType();
-      return load( array.data() );
+      return loadRest( i, j, typename IfTrue< maskedRest, TrueType, FalseType >::Type() );
    }
 }
 /*! \endcond */
@@ -6574,8 +6747,6 @@ inline void DenseSubmatrix<MT,unaligned,true>::store( size_t i, size_t j, const
 template< typename MT >  // Type of the dense matrix
 inline void DenseSubmatrix<MT,unaligned,true>::storeu( size_t i, size_t j, const IntrinsicType& value )
 {
-   using blaze::store;
-
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
 
    BLAZE_INTERNAL_ASSERT( i < rows()         , "Invalid row access index"    );
@@ -6589,10 +6760,7 @@ inline void DenseSubmatrix<MT,unaligned,true>::storeu( size_t i, size_t j, const
       matrix_.storeu( row_+i, column_+j, value );
    }
    else {
-      AlignedArray<ElementType,IT::size> array;
-      store( array.data(), value );
-      for( size_t k=0UL; k<rest_; ++k )
-         matrix_(row_+i+k,column_+j) = array[k];
+      storeRest( i, j, value, typename IfTrue< maskedRest, TrueType, FalseType >::Type() );
    }
 }
 /*! \endcond */
@@ -6625,6 +6793,102 @@ inline void DenseSubmatrix<MT,unaligned,true>::stream( size_t i, size_t j, const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Masked load of the remaining elements beyond the final row of the submatrix.
+//
+// \param i The final row index of the submatrix.
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded intrinsic element.
+//
+// This function loads the remaining elements beyond the final row of an unaligned submatrix
+// via a single masked load. The memory beyond the end of the column is not accessed.
+*/
+template< typename MT >  // Type of the dense matrix
+inline typename DenseSubmatrix<MT,unaligned,true>::IntrinsicType
+   DenseSubmatrix<MT,unaligned,true>::loadRest( size_t i, size_t j, TrueType ) const
+{
+   return maskload( &matrix_(row_+i,column_+j), rest_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Element-wise load of the remaining elements beyond the final row of the submatrix.
+//
+// \param i The final row index of the submatrix.
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded intrinsic element.
+//
+// This function loads the remaining elements beyond the final row of an unaligned submatrix
+// element by element into a zero-padded intrinsic element.
+*/
+template< typename MT >  // Type of the dense matrix
+inline typename DenseSubmatrix<MT,unaligned,true>::IntrinsicType
+   DenseSubmatrix<MT,unaligned,true>::loadRest( size_t i, size_t j, FalseType ) const
+{
+   using blaze::load;
+
+   AlignedArray<ElementType,IT::size> array;
+   for( size_t k=0UL; k<rest_; ++k )
+      array[k] = matrix_(row_+i+k,column_+j);
+   for( size_t k=rest_; k<IT::size; ++k )
+      array[k] = ElementType();
+   return load( array.data() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Masked store of the remaining elements beyond the final row of the submatrix.
+//
+// \param i The final row index of the submatrix.
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The intrinsic element to be stored.
+// \return void
+//
+// This function stores the remaining elements beyond the final row of an unaligned submatrix
+// via a single masked store. The memory beyond the end of the column is not modified.
+*/
+template< typename MT >  // Type of the dense matrix
+inline void DenseSubmatrix<MT,unaligned,true>::storeRest( size_t i, size_t j, const IntrinsicType& value, TrueType )
+{
+   maskstore( &matrix_(row_+i,column_+j), value, rest_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Element-wise store of the remaining elements beyond the final row of the submatrix.
+//
+// \param i The final row index of the submatrix.
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The intrinsic element to be stored.
+// \return void
+//
+// This function stores the remaining elements beyond the final row of an unaligned submatrix
+// element by element.
+*/
+template< typename MT >  // Type of the dense matrix
+inline void DenseSubmatrix<MT,unaligned,true>::storeRest( size_t i, size_t j, const IntrinsicType& value, FalseType )
+{
+   using blaze::store;
+
+   AlignedArray<ElementType,IT::size> array;
+   store( array.data(), value );
+   for( size_t k=0UL; k<rest_; ++k )
+      matrix_(row_+i+k,column_+j) = array[k];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a column-major dense matrix.
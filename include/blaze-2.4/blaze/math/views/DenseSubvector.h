@@ -76,13 +76,16 @@
 #include <blaze/util/constraints/Vectorizable.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/FalseType.h>
 #include <blaze/util/logging/FunctionTrace.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/mpl/Or.h>
 #include <blaze/util/Template.h>
+#include <blaze/util/TrueType.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsConst.h>
 #include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsReference.h>
 #include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
@@ -607,12 +610,7 @@ class DenseSubvector : public DenseVector< DenseSubvector<VT,AF,TF>, TF >
             return iterator_.loadu();
          }
          else {
-            AlignedArray<ElementType,IT::size> array;
-            for( size_t i=0UL; i<rest_; ++i )
-               array[i] = *(iterator_+i);
-            for( size_t i=rest_; i<IT::size; ++i )
-               array[i] = ElementType();
-            return blaze::load( array.data() );
+            return loadRest( typename IfTrue< maskedRest, TrueType, FalseType >::Type() );
          }
       }
       //*******************************************************************************************
@@ -771,6 +769,37 @@ class DenseSubvector : public DenseVector< DenseSubvector<VT,AF,TF>, TF >
       //*******************************************************************************************
 
     private:
+      //**Compilation flags************************************************************************
+      //! Compilation switch for the masked load of the final intrinsic element.
+      /*! In case the underlying iterator provides direct access to the vector elements and the
+          element type supports masked intrinsic loads, the remaining elements beyond the final
+          iterator are loaded via a single masked load. */
+      enum { maskedRest = IT::masked && IsReference<ReferenceType>::value };
+      //*******************************************************************************************
+
+      //**LoadRest functions***********************************************************************
+      /*!\brief Masked load of the remaining elements beyond the final iterator.
+      //
+      // \return The loaded intrinsic element.
+      */
+      inline IntrinsicType loadRest( TrueType ) const {
+         return maskload( &(*iterator_), rest_ );
+      }
+
+      /*!\brief Element-wise load of the remaining elements beyond the final iterator.
+      //
+      // \return The loaded intrinsic element.
+      */
+      inline IntrinsicType loadRest( FalseType ) const {
+         AlignedArray<ElementType,IT::size> array;
+         for( size_t i=0UL; i<rest_; ++i )
+            array[i] = *(iterator_+i);
+         for( size_t i=rest_; i<IT::size; ++i )
+            array[i] = ElementType();
+         return blaze::load( array.data() );
+      }
+      //*******************************************************************************************
+
       //**Member variables*************************************************************************
       IteratorType iterator_;   //!< Iterator to the current subvector element.
       IteratorType final_;      //!< The final iterator for intrinsic operations.
@@ -903,6 +932,17 @@ class DenseSubvector : public DenseVector< DenseSubvector<VT,AF,TF>, TF >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Compilation switch for the masked access to the final intrinsic element.
+   /*! In case the subvector provides direct access to the elements of the underlying dense
+       vector and the element type supports masked intrinsic operations, the remaining elements
+       beyond the final index of an unaligned subvector are loaded and stored via a single
+       masked load and store, respectively. */
+   enum { maskedRest = IT::masked && IsReference<Reference>::value };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Expression template evaluation functions****************************************************
    /*!\name Expression template evaluation functions */
@@ -972,6 +1012,17 @@ class DenseSubvector : public DenseVector< DenseSubvector<VT,AF,TF>, TF >
    //**********************************************************************************************
 
  private:
+   //**Intrinsic helper functions******************************************************************
+   /*!\name Intrinsic helper functions */
+   //@{
+   inline IntrinsicType loadRest( size_t index, TrueType  ) const;
+   inline IntrinsicType loadRest( size_t index, FalseType ) const;
+
+   inline void storeRest( size_t index, const IntrinsicType& value, TrueType  );
+   inline void storeRest( size_t index, const IntrinsicType& value, FalseType );
+   //@}
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
@@ -1793,8 +1844,6 @@ template< typename VT  // Type of the dense vector
 inline typename DenseSubvector<VT,AF,TF>::IntrinsicType
    DenseSubvector<VT,AF,TF>::loadu( size_t index ) const
 {
-   using blaze::load;
-
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
 
    BLAZE_INTERNAL_ASSERT( index < size()         , "Invalid subvector access index" );
@@ -1807,12 +1856,7 @@ inline typename DenseSubvector<VT,AF,TF>::IntrinsicType
       return vector_.loadu( offset_+index );
    }
    else {
-      AlignedArray<ElementType,IT::size> array;
-      for( size_t i=0UL; i<rest_; ++i )
-         array[i] = vector_[offset_+index+i];
-      for( size_t i=rest_; i<IT::size; ++i )
-         array[i] = ElementType();
-      return load( array.data() );
+      return loadRest( index, typename IfTrue< maskedRest, TrueType, FalseType >::Type() );
    }
 }
 //*************************************************************************************************
@@ -1861,8 +1905,6 @@ template< typename VT  // Type of the dense vector
         , bool TF >    // Transpose flag
 inline void DenseSubvector<VT,AF,TF>::storeu( size_t index, const IntrinsicType& value )
 {
-   using blaze::store;
-
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
 
    BLAZE_INTERNAL_ASSERT( index < size()         , "Invalid subvector access index" );
@@ -1875,10 +1917,7 @@ inline void DenseSubvector<VT,AF,TF>::storeu( size_t index, const IntrinsicType&
       vector_.storeu( offset_+index, value );
    }
    else {
-      AlignedArray<ElementType,IT::size> array;
-      store( array.data(), value );
-      for( size_t i=0UL; i<rest_; ++i )
-         vector_[offset_+index+i] = array[i];
+      storeRest( index, value, typename IfTrue< maskedRest, TrueType, FalseType >::Type() );
    }
 }
 //*************************************************************************************************
@@ -1908,6 +1947,100 @@ inline void DenseSubvector<VT,AF,TF>::stream( size_t index, const IntrinsicType&
 //*************************************************************************************************
 
 
+
+
+//*************************************************************************************************
+/*!\brief Masked load of the remaining elements beyond the final index of the subvector.
+//
+// \param index The final index of the subvector.
+// \return The loaded intrinsic element.
+//
+// This function loads the remaining elements beyond the final index of an unaligned subvector
+// via a single masked load. The memory beyond the end of the subvector is not accessed.
+*/
+template< typename VT  // Type of the dense vector
+        , bool AF      // Alignment flag
+        , bool TF >    // Transpose flag
+inline typename DenseSubvector<VT,AF,TF>::IntrinsicType
+   DenseSubvector<VT,AF,TF>::loadRest( size_t index, TrueType ) const
+{
+   return maskload( &vector_[offset_+index], rest_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise load of the remaining elements beyond the final index of the subvector.
+//
+// \param index The final index of the subvector.
+// \return The loaded intrinsic element.
+//
+// This function loads the remaining elements beyond the final index of an unaligned subvector
+// element by element into a zero-padded intrinsic element.
+*/
+template< typename VT  // Type of the dense vector
+        , bool AF      // Alignment flag
+        , bool TF >    // Transpose flag
+inline typename DenseSubvector<VT,AF,TF>::IntrinsicType
+   DenseSubvector<VT,AF,TF>::loadRest( size_t index, FalseType ) const
+{
+   using blaze::load;
+
+   AlignedArray<ElementType,IT::size> array;
+   for( size_t i=0UL; i<rest_; ++i )
+      array[i] = vector_[offset_+index+i];
+   for( size_t i=rest_; i<IT::size; ++i )
+      array[i] = ElementType();
+   return load( array.data() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked store of the remaining elements beyond the final index of the subvector.
+//
+// \param index The final index of the subvector.
+// \param value The intrinsic element to be stored.
+// \return void
+//
+// This function stores the remaining elements beyond the final index of an unaligned subvector
+// via a single masked store. The memory beyond the end of the subvector is not modified.
+*/
+template< typename VT  // Type of the dense vector
+        , bool AF      // Alignment flag
+        , bool TF >    // Transpose flag
+inline void DenseSubvector<VT,AF,TF>::storeRest( size_t index, const IntrinsicType& value, TrueType )
+{
+   maskstore( &vector_[offset_+index], value, rest_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise store of the remaining elements beyond the final index of the subvector.
+//
+// \param index The final index of the subvector.
+// \param value The intrinsic element to be stored.
+// \return void
+//
+// This function stores the remaining elements beyond the final index of an unaligned subvector
+// element by element.
+*/
+template< typename VT  // Type of the dense vector
+        , bool AF      // Alignment flag
+        , bool TF >    // Transpose flag
+inline void DenseSubvector<VT,AF,TF>::storeRest( size_t index, const IntrinsicType& value, FalseType )
+{
+   using blaze::store;
+
+   AlignedArray<ElementType,IT::size> array;
+   store( array.data(), value );
+   for( size_t i=0UL; i<rest_; ++i )
+      vector_[offset_+index+i] = array[i];
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the assignment of a dense vector.
 //
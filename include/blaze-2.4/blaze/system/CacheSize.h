@@ -40,8 +40,18 @@
 // Includes
 //*************************************************************************************************
 
+#include <cstdio>
+#include <fstream>
+#include <string>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+#if defined(_MSC_VER) && ( defined(_M_IX86) || defined(_M_X64) )
+#  include <intrin.h>
+#elif defined(__GNUC__) && ( defined(__i386__) || defined(__x86_64__) )
+#  include <cpuid.h>
+#endif
 
 
 
@@ -68,9 +78,222 @@
 namespace {
 
 BLAZE_STATIC_ASSERT( blaze::cacheSize > 100000UL && blaze::cacheSize < 100000000UL );
+BLAZE_STATIC_ASSERT( blaze::l1CacheSize == 0UL || blaze::l1CacheSize >= 1024UL );
+BLAZE_STATIC_ASSERT( blaze::l2CacheSize == 0UL || blaze::l2CacheSize >= 1024UL );
+BLAZE_STATIC_ASSERT( blaze::l3CacheSize == 0UL || blaze::l3CacheSize >= 1024UL );
+BLAZE_STATIC_ASSERT( blaze::cacheLineSize >= 8UL && ( blaze::cacheLineSize & ( blaze::cacheLineSize - 1UL ) ) == 0UL );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CACHE SIZE DETECTION
+//
+//=================================================================================================
+
+namespace blaze {
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads the size of a cache level from the sysfs file system.
+// \ingroup system
+//
+// \param level The cache level \f$[1..3]\f$.
+// \return The size of the cache in Byte, 0 in case the size could not be determined.
+//
+// This function queries the cache descriptions of the first CPU provided by the Linux sysfs
+// file system (/sys/devices/system/cpu/cpu0/cache/index*). Instruction caches are ignored.
+*/
+inline size_t readCacheSizeFromSysfs( size_t level )
+{
+   for( size_t index=0UL; index<16UL; ++index )
+   {
+      char path[64];
+      std::sprintf( path, "/sys/devices/system/cpu/cpu0/cache/index%lu/", static_cast<unsigned long>( index ) );
+
+      std::ifstream levelFile( ( std::string( path ) + "level" ).c_str() );
+      if( !levelFile ) break;
+
+      size_t cacheLevel( 0UL );
+      levelFile >> cacheLevel;
+      if( cacheLevel != level ) continue;
+
+      std::ifstream typeFile( ( std::string( path ) + "type" ).c_str() );
+      std::string type;
+      typeFile >> type;
+      if( type == "Instruction" ) continue;
+
+      std::ifstream sizeFile( ( std::string( path ) + "size" ).c_str() );
+      size_t size( 0UL );
+      char unit( '\0' );
+      if( !( sizeFile >> size ) ) continue;
+      sizeFile >> unit;
+
+      if     ( unit == 'K' ) size *= 1024UL;
+      else if( unit == 'M' ) size *= 1024UL*1024UL;
+      else if( unit == 'G' ) size *= 1024UL*1024UL*1024UL;
+
+      return size;
+   }
+
+   return 0UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Queries the size of a cache level via the CPUID instruction.
+// \ingroup system
+//
+// \param level The cache level \f$[1..3]\f$.
+// \return The size of the cache in Byte, 0 in case the size could not be determined.
+//
+// This function evaluates the deterministic cache parameters (leaf 4) of the CPUID instruction.
+// On non-x86 architectures and on processors that do not provide leaf 4 the function returns 0.
+*/
+inline size_t readCacheSizeFromCpuid( size_t level )
+{
+#if ( defined(_MSC_VER) && ( defined(_M_IX86) || defined(_M_X64) ) ) || \
+    ( defined(__GNUC__) && ( defined(__i386__) || defined(__x86_64__) ) )
+   unsigned int regs[4] = { 0U, 0U, 0U, 0U };
+
+#  if defined(_MSC_VER)
+   __cpuid( reinterpret_cast<int*>( regs ), 0 );
+#  else
+   __cpuid( 0, regs[0], regs[1], regs[2], regs[3] );
+#  endif
 
+   if( regs[0] < 4U )
+      return 0UL;
+
+   for( unsigned int index=0U; index<16U; ++index )
+   {
+#  if defined(_MSC_VER)
+      __cpuidex( reinterpret_cast<int*>( regs ), 4, index );
+#  else
+      __cpuid_count( 4, index, regs[0], regs[1], regs[2], regs[3] );
+#  endif
+
+      const unsigned int type( regs[0] & 0x1FU );
+
+      if( type == 0U ) break;
+      if( type == 2U || ( ( regs[0] >> 5 ) & 0x7U ) != level ) continue;
+
+      const size_t ways      ( ( ( regs[1] >> 22 ) & 0x3FFU ) + 1UL );
+      const size_t partitions( ( ( regs[1] >> 12 ) & 0x3FFU ) + 1UL );
+      const size_t lineSize  ( (   regs[1]         & 0xFFFU ) + 1UL );
+      const size_t sets      ( regs[2] + 1UL );
+
+      return ways * partitions * lineSize * sets;
+   }
+#else
+   UNUSED_PARAMETER( level );
+#endif
+
+   return 0UL;
 }
 /*! \endcond */
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Detection of the cache sizes of the target architecture.
+// \ingroup system
+//
+// The CacheSizes class determines the sizes of the L1 data cache, the L2 cache, and the L3
+// cache of the architecture the program is running on. Each level is taken from the according
+// configuration value (see blaze::l1CacheSize, blaze::l2CacheSize, and blaze::l3CacheSize) if
+// it is nonzero. Otherwise the size is read from sysfs or, if this is not possible, queried via
+// the CPUID instruction. In case both approaches fail, a 32 KiByte L1 cache, a 256 KiByte L2
+// cache, and an L3 cache of blaze::cacheSize are assumed.
+*/
+struct CacheSizes
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Detects the sizes of all cache levels.
+   */
+   CacheSizes()
+   {
+      l1 = detect( 1UL, l1CacheSize,   32768UL );
+      l2 = detect( 2UL, l2CacheSize,  262144UL );
+      l3 = detect( 3UL, l3CacheSize, cacheSize );
+
+      if( l2 < l1 ) l2 = l1;
+      if( l3 < l2 ) l3 = l2;
+   }
+   //**********************************************************************************************
+
+   //**Detect function*****************************************************************************
+   /*!\brief Determines the size of a single cache level.
+   //
+   // \param level The cache level \f$[1..3]\f$.
+   // \param config The configured size of the cache level (0 for runtime detection).
+   // \param fallback The size used in case the detection fails.
+   // \return The size of the cache level in Byte.
+   */
+   static size_t detect( size_t level, size_t config, size_t fallback )
+   {
+      if( config != 0UL ) return config;
+
+      size_t size( readCacheSizeFromSysfs( level ) );
+      if( size == 0UL ) size = readCacheSizeFromCpuid( level );
+      return ( size != 0UL )?( size ):( fallback );
+   }
+   //**********************************************************************************************
+
+   size_t l1;  //!< Size of the L1 data cache in Byte.
+   size_t l2;  //!< Size of the L2 cache in Byte.
+   size_t l3;  //!< Size of the L3 cache in Byte.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the given cache level of the target architecture.
+// \ingroup system
+//
+// \param level The cache level \f$[1..3]\f$.
+// \return The size of the cache level in Byte.
+//
+// This function returns the size of the L1 data cache, the L2 cache, or the L3 cache of the
+// target architecture. The sizes are detected once on the first call (which happens during
+// static initialization of every program that uses the Blaze library) and cached for all
+// subsequent calls. A nonzero configuration value (see blaze::l1CacheSize, blaze::l2CacheSize,
+// and blaze::l3CacheSize) overrides the detection of the according level. For any level
+// outside the range \f$[1..3]\f$ the size of the outermost cache level is returned.
+*/
+inline size_t getCacheSize( size_t level )
+{
+   static const CacheSizes sizes;
+
+   switch( level ) {
+      case 1UL: return sizes.l1;
+      case 2UL: return sizes.l2;
+      default : return sizes.l3;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+const size_t cacheSizeInitializer = getCacheSize( 1UL );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
 #endif
@@ -40,6 +40,18 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+
+
+//=================================================================================================
+//
+//  SMP CONFIGURATION
+//
+//=================================================================================================
+
 #include <blaze/config/SMP.h>
 
 
@@ -99,6 +111,31 @@
 
 
 
+//=================================================================================================
+//
+//  COROUTINE MODE CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the coroutine-based execution of the C++11 thread parallelization.
+// \ingroup system
+//
+// This compilation switch enables/disables the execution of the C++11 thread parallelization
+// via C++20 coroutines. It is only active in case the C++11 thread parallelization is active,
+// in case the \c BLAZE_USE_COROUTINES switch is set to 1 (see <tt><blaze/config/SMP.h></tt>),
+// and in case the compiler supports C++20 coroutines.
+*/
+#if BLAZE_CPP_THREADS_PARALLEL_MODE && BLAZE_USE_COROUTINES && defined(__cpp_impl_coroutine)
+#define BLAZE_COROUTINES_PARALLEL_MODE 1
+#else
+#define BLAZE_COROUTINES_PARALLEL_MODE 0
+#endif
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  BOOST THREAD PARALLEL MODE CONFIGURATION
@@ -123,4 +160,24 @@
 #endif
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( blaze::smpChunksPerThread >= 1UL );
+BLAZE_STATIC_ASSERT( blaze::smpReductionBlockSize > 0UL && blaze::smpReductionBlockSize % 64UL == 0UL );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
 #endif
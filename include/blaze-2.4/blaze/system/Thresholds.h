@@ -75,11 +75,20 @@ BLAZE_STATIC_ASSERT( blaze::DMATTDMATMULT_THRESHOLD  > 0UL );
 BLAZE_STATIC_ASSERT( blaze::TDMATDMATMULT_THRESHOLD  > 0UL );
 BLAZE_STATIC_ASSERT( blaze::TDMATTDMATMULT_THRESHOLD > 0UL );
 
+BLAZE_STATIC_ASSERT( blaze::DMATDMATMULT_STRASSEN_THRESHOLD == 0UL ||
+                     blaze::DMATDMATMULT_STRASSEN_THRESHOLD >= 2UL );
+
+BLAZE_STATIC_ASSERT( blaze::SMATSMATMULT_MERGE_THRESHOLD > 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMATSMATMULT_DENSE_THRESHOLD > 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMATDVECMULT_SHORTROW_THRESHOLD > 0UL );
+BLAZE_STATIC_ASSERT( blaze::SLICEDELLPACK_SORTING_SCOPE > 0UL );
+
 BLAZE_STATIC_ASSERT( blaze::SMP_DVECASSIGN_THRESHOLD     >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECADD_THRESHOLD    >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECSUB_THRESHOLD    >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECMULT_THRESHOLD   >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DVECSCALARMULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECREDUCTION_THRESHOLD  >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DMATDVECMULT_THRESHOLD   >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_TDMATDVECMULT_THRESHOLD  >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_TDVECDMATMULT_THRESHOLD  >= 0UL );
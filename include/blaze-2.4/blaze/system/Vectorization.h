@@ -110,7 +110,7 @@
 
 //=================================================================================================
 //
-//  SSE/AVX/MIC MODE CONFIGURATION
+//  SSE/AVX/AVX-512/MIC MODE CONFIGURATION
 //
 //=================================================================================================
 
@@ -233,6 +233,78 @@
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Compilation switch for the AVX-512F mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the AVX-512F mode. In case the AVX-512F mode is
+// enabled (i.e. in case the AVX-512 foundation instructions are available) the Blaze library
+// attempts to vectorize the linear algebra operations by 64-byte AVX-512 intrinsics for all
+// single and double precision floating point values, complex values, and 32-bit and 64-bit
+// integral values. In case the AVX-512F mode is disabled, the Blaze library falls back to
+// the AVX/AVX2 or SSE intrinsics. The AVX-512F mode has to be explicitly requested via the
+// BLAZE_USE_AVX512 compilation switch (see the <tt>./blaze/config/Vectorization.h</tt>
+// configuration file).
+*/
+#if BLAZE_USE_VECTORIZATION && BLAZE_USE_AVX512 && defined(__AVX512F__)
+#  define BLAZE_AVX512F_MODE 1
+#else
+#  define BLAZE_AVX512F_MODE 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the AVX-512BW mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the AVX-512BW mode. In case the AVX-512BW mode is
+// enabled (i.e. in case the AVX-512 byte and word instructions are available) the Blaze
+// library additionally vectorizes the operations on 8-bit and 16-bit integral values by
+// 64-byte AVX-512 intrinsics. Otherwise these data types are handled by AVX2 intrinsics.
+*/
+#if BLAZE_AVX512F_MODE && defined(__AVX512BW__)
+#  define BLAZE_AVX512BW_MODE 1
+#else
+#  define BLAZE_AVX512BW_MODE 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the AVX-512DQ mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the AVX-512DQ mode. In case the AVX-512DQ mode is
+// enabled (i.e. in case the AVX-512 doubleword and quadword instructions are available) the
+// Blaze library additionally vectorizes the multiplication of 64-bit integral values.
+*/
+#if BLAZE_AVX512F_MODE && defined(__AVX512DQ__)
+#  define BLAZE_AVX512DQ_MODE 1
+#else
+#  define BLAZE_AVX512DQ_MODE 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the AVX-512VL mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the AVX-512VL mode. In case the AVX-512VL mode is
+// enabled (i.e. in case the AVX-512 vector length extensions are available) the AVX-512 masked
+// instructions can also be applied to 16-byte and 32-byte vectors. Since the Blaze library uses
+// 64-byte vectors for all data types covered by the AVX-512F and AVX-512BW modes, this switch
+// only reflects the capabilities of the target platform.
+*/
+#if BLAZE_AVX512F_MODE && defined(__AVX512VL__)
+#  define BLAZE_AVX512VL_MODE 1
+#else
+#  define BLAZE_AVX512VL_MODE 0
+#endif
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Compilation switch for the MIC mode.
 // \ingroup system
@@ -250,6 +322,24 @@
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Compilation switch for the FMA mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the FMA mode. In case the FMA mode is enabled
+// (i.e. in case fused multiply-add instructions are available) the Blaze library computes
+// the multiply-add operations in the inner loops of the dense matrix and vector products
+// via a single fused instruction with a single rounding step. In case the FMA mode is
+// disabled, the Blaze library uses separate multiplication and addition instructions.
+*/
+#if BLAZE_USE_VECTORIZATION && ( defined(__FMA__) || defined(__MIC__) || BLAZE_AVX512F_MODE )
+#  define BLAZE_FMA_MODE 1
+#else
+#  define BLAZE_FMA_MODE 0
+#endif
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -262,12 +352,17 @@
 /*! \cond BLAZE_INTERNAL */
 namespace {
 
-BLAZE_STATIC_ASSERT( !BLAZE_SSE2_MODE  || BLAZE_SSE_MODE   );
-BLAZE_STATIC_ASSERT( !BLAZE_SSE3_MODE  || BLAZE_SSE2_MODE  );
-BLAZE_STATIC_ASSERT( !BLAZE_SSSE3_MODE || BLAZE_SSE3_MODE  );
-BLAZE_STATIC_ASSERT( !BLAZE_SSE4_MODE  || BLAZE_SSSE3_MODE );
-BLAZE_STATIC_ASSERT( !BLAZE_AVX_MODE   || BLAZE_SSE4_MODE  );
-BLAZE_STATIC_ASSERT( !BLAZE_AVX2_MODE  || BLAZE_AVX_MODE   );
+BLAZE_STATIC_ASSERT( !BLAZE_SSE2_MODE     || BLAZE_SSE_MODE     );
+BLAZE_STATIC_ASSERT( !BLAZE_SSE3_MODE     || BLAZE_SSE2_MODE    );
+BLAZE_STATIC_ASSERT( !BLAZE_SSSE3_MODE    || BLAZE_SSE3_MODE    );
+BLAZE_STATIC_ASSERT( !BLAZE_SSE4_MODE     || BLAZE_SSSE3_MODE   );
+BLAZE_STATIC_ASSERT( !BLAZE_AVX_MODE      || BLAZE_SSE4_MODE    );
+BLAZE_STATIC_ASSERT( !BLAZE_AVX2_MODE     || BLAZE_AVX_MODE     );
+BLAZE_STATIC_ASSERT( !BLAZE_AVX512F_MODE  || BLAZE_AVX2_MODE    );
+BLAZE_STATIC_ASSERT( !BLAZE_AVX512BW_MODE || BLAZE_AVX512F_MODE );
+BLAZE_STATIC_ASSERT( !BLAZE_AVX512DQ_MODE || BLAZE_AVX512F_MODE );
+BLAZE_STATIC_ASSERT( !BLAZE_AVX512VL_MODE || BLAZE_AVX512F_MODE );
+BLAZE_STATIC_ASSERT( !BLAZE_FMA_MODE      || BLAZE_AVX_MODE || BLAZE_MIC_MODE );
 
 }
 /*! \endcond */
@@ -278,11 +373,11 @@ BLAZE_STATIC_ASSERT( !BLAZE_AVX2_MODE  || BLAZE_AVX_MODE   );
 
 //=================================================================================================
 //
-//  SSE/AVX/MIC INCLUDE FILE CONFIGURATION
+//  SSE/AVX/AVX-512/MIC INCLUDE FILE CONFIGURATION
 //
 //=================================================================================================
 
-#if BLAZE_MIC_MODE || BLAZE_AVX_MODE || BLAZE_AVX2_MODE
+#if BLAZE_MIC_MODE || BLAZE_AVX512F_MODE || BLAZE_AVX_MODE || BLAZE_AVX2_MODE
 #  include <immintrin.h>
 #elif BLAZE_SSE4_MODE
 #  include <smmintrin.h>
@@ -0,0 +1,313 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/ThreadAffinity.h
+//  \brief Header file for the thread affinity functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADAFFINITY_H_
+#define _BLAZE_UTIL_THREADAFFINITY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(__linux__)
+#  include <pthread.h>
+#  include <sched.h>
+#endif
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  THREAD AFFINITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Thread affinity functions */
+//@{
+inline std::vector<size_t> parseCPUList( const std::string& list );
+inline std::vector< std::vector<size_t> > numaNodes();
+inline std::vector<size_t> threadAffinity( const std::string& policy );
+
+template< typename Handle >
+inline bool setThreadAffinity( Handle thread, size_t cpu );
+
+#if defined(__linux__)
+inline bool setThreadAffinity( pthread_t thread, size_t cpu );
+#endif
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Parsing a list of CPUs.
+// \ingroup threads
+//
+// \param list The comma-separated list of CPUs and CPU ranges (e.g. "0,2,4-7").
+// \return The CPUs of the list in the given order.
+// \exception std::invalid_argument Invalid CPU list.
+//
+// This function parses a list of CPUs in the format of the Linux \c cpulist files (see for
+// instance \c /sys/devices/system/node/node0/cpulist), which is also used by the \c taskset
+// utility. Whitespace is ignored. In case the list is malformed, a \a std::invalid_argument
+// exception is thrown.
+*/
+inline std::vector<size_t> parseCPUList( const std::string& list )
+{
+   std::vector<size_t> cpus;
+   std::string entry;
+   std::istringstream iss( list );
+
+   while( std::getline( iss, entry, ',' ) )
+   {
+      std::string digits;
+      for( size_t i=0UL; i<entry.size(); ++i ) {
+         if( !std::isspace( static_cast<unsigned char>( entry[i] ) ) )
+            digits += entry[i];
+      }
+
+      if( digits.empty() )
+         continue;
+
+      const size_t dash( digits.find( '-' ) );
+      const std::string first( digits.substr( 0UL, dash ) );
+      const std::string last ( ( dash != std::string::npos )?( digits.substr( dash+1UL ) ):( first ) );
+
+      if( first.empty() || last.empty() ||
+          first.find_first_not_of( "0123456789" ) != std::string::npos ||
+          last.find_first_not_of ( "0123456789" ) != std::string::npos )
+         throw std::invalid_argument( "Invalid CPU list" );
+
+      const size_t begin( std::strtoul( first.c_str(), NULL, 10 ) );
+      const size_t end  ( std::strtoul( last.c_str() , NULL, 10 ) );
+
+      if( begin > end )
+         throw std::invalid_argument( "Invalid CPU list" );
+
+      for( size_t cpu=begin; cpu<=end; ++cpu )
+         cpus.push_back( cpu );
+   }
+
+   return cpus;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the CPUs of all NUMA nodes available to the calling process.
+// \ingroup threads
+//
+// \return The CPUs of each NUMA node.
+//
+// This function determines the NUMA topology of the system. On Linux systems, the CPUs of each
+// NUMA node are read from \c /sys/devices/system/node, restricted to the CPUs the process is
+// allowed to run on. In case the topology cannot be determined, all CPUs of the process are
+// treated as a single node. On all other systems, the function returns an empty topology.
+*/
+inline std::vector< std::vector<size_t> > numaNodes()
+{
+   std::vector< std::vector<size_t> > nodes;
+
+#if defined(__linux__)
+   cpu_set_t allowed;
+   CPU_ZERO( &allowed );
+
+   if( sched_getaffinity( 0, sizeof( allowed ), &allowed ) != 0 )
+      return nodes;
+
+   std::string list;
+   std::ifstream online( "/sys/devices/system/node/online" );
+
+   if( online && std::getline( online, list ) )
+   {
+      try {
+         const std::vector<size_t> ids( parseCPUList( list ) );
+
+         for( size_t i=0UL; i<ids.size(); ++i )
+         {
+            std::ostringstream path;
+            path << "/sys/devices/system/node/node" << ids[i] << "/cpulist";
+
+            std::ifstream file( path.str().c_str() );
+            if( !file || !std::getline( file, list ) )
+               continue;
+
+            const std::vector<size_t> cpus( parseCPUList( list ) );
+            std::vector<size_t> node;
+
+            for( size_t j=0UL; j<cpus.size(); ++j ) {
+               if( cpus[j] < CPU_SETSIZE && CPU_ISSET( cpus[j], &allowed ) )
+                  node.push_back( cpus[j] );
+            }
+
+            if( !node.empty() )
+               nodes.push_back( node );
+         }
+      }
+      catch( std::invalid_argument& ) {
+         nodes.clear();
+      }
+   }
+
+   if( nodes.empty() )
+   {
+      std::vector<size_t> node;
+
+      for( size_t cpu=0UL; cpu<CPU_SETSIZE; ++cpu ) {
+         if( CPU_ISSET( cpu, &allowed ) )
+            node.push_back( cpu );
+      }
+
+      if( !node.empty() )
+         nodes.push_back( node );
+   }
+#endif
+
+   return nodes;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the CPUs selected by the given thread affinity policy.
+// \ingroup threads
+//
+// \param policy The thread affinity policy.
+// \return The CPU of each thread (the \a i-th thread is bound to the CPU at index \a i modulo
+//         the number of CPUs), or an empty vector in case the threads should not be bound.
+// \exception std::invalid_argument Invalid thread affinity policy.
+//
+// This function translates a thread affinity policy into a sequence of CPUs. The following
+// policies are available:
+//
+//  - \c "none" or an empty string: the threads are not bound to any CPU.
+//  - \c "compact": consecutive threads are bound to consecutive CPUs of the same NUMA node.
+//    Only when all CPUs of a node are used, the next node is filled.
+//  - \c "scatter": consecutive threads are distributed round-robin over the NUMA nodes, such
+//    that the memory bandwidth of all nodes is used even for a small number of threads.
+//  - An explicit list of CPUs in the format of the parseCPUList() function (e.g. "0,8,1,9").
+//
+// On systems for which no topology information is available, the \c "compact" and \c "scatter"
+// policies result in an empty sequence of CPUs.
+*/
+inline std::vector<size_t> threadAffinity( const std::string& policy )
+{
+   std::vector<size_t> cpus;
+
+   if( policy.empty() || policy == "none" )
+      return cpus;
+
+   if( policy != "compact" && policy != "scatter" )
+      return parseCPUList( policy );
+
+   const std::vector< std::vector<size_t> > nodes( numaNodes() );
+
+   if( policy == "compact" ) {
+      for( size_t i=0UL; i<nodes.size(); ++i )
+         cpus.insert( cpus.end(), nodes[i].begin(), nodes[i].end() );
+   }
+   else {
+      for( size_t j=0UL, remaining=1UL; remaining > 0UL; ++j ) {
+         remaining = 0UL;
+         for( size_t i=0UL; i<nodes.size(); ++i ) {
+            if( j < nodes[i].size() ) {
+               cpus.push_back( nodes[i][j] );
+               ++remaining;
+            }
+         }
+      }
+   }
+
+   return cpus;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Binding the given thread to the given CPU.
+// \ingroup threads
+//
+// \param thread The native handle of the thread.
+// \param cpu The CPU the thread is bound to.
+// \return \a true in case the thread has been bound, \a false if not.
+//
+// This function is the fallback for all systems that do not support binding threads to CPUs.
+// It leaves the given thread unchanged and returns \a false.
+*/
+template< typename Handle >  // Type of the native thread handle
+inline bool setThreadAffinity( Handle thread, size_t cpu )
+{
+   UNUSED_PARAMETER( thread, cpu );
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+#if defined(__linux__)
+/*!\brief Binding the given POSIX thread to the given CPU.
+// \ingroup threads
+//
+// \param thread The native handle of the thread.
+// \param cpu The CPU the thread is bound to.
+// \return \a true in case the thread has been bound, \a false if not.
+*/
+inline bool setThreadAffinity( pthread_t thread, size_t cpu )
+{
+   if( cpu >= CPU_SETSIZE )
+      return false;
+
+   cpu_set_t set;
+   CPU_ZERO( &set );
+   CPU_SET( cpu, &set );
+
+   return pthread_setaffinity_np( thread, sizeof( set ), &set ) == 0;
+}
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
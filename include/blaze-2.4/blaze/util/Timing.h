@@ -42,6 +42,8 @@
 
 #include <blaze/util/timing/CpuPolicy.h>
 #include <blaze/util/timing/CpuTimer.h>
+#include <blaze/util/timing/PerfPolicy.h>
+#include <blaze/util/timing/PerfTimer.h>
 #include <blaze/util/timing/Timer.h>
 #include <blaze/util/timing/WcPolicy.h>
 #include <blaze/util/timing/WcTimer.h>
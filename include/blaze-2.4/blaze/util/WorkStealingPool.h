@@ -0,0 +1,1610 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/WorkStealingPool.h
+//  \brief Header file of the WorkStealingPool class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_UTIL_WORKSTEALINGPOOL_H_
+#define _BLAZE_UTIL_WORKSTEALINGPOOL_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <vector>
+#include <boost/atomic.hpp>
+#include <boost/bind.hpp>
+#include <boost/function.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <blaze/system/ThreadLocal.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/PtrVector.h>
+#include <blaze/util/threadpool/Backoff.h>
+#include <blaze/util/threadpool/Task.h>
+#include <blaze/util/threadpool/WorkStealingDeque.h>
+#include <blaze/util/ThreadAffinity.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/UniqueArray.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Implementation of a work-stealing thread pool.
+// \ingroup threads
+//
+// \section workstealingpool_general General
+//
+// The WorkStealingPool class template represents a thread pool with the same interface as the
+// ThreadPool class template, but with a distributed task management: instead of a single task
+// queue that is guarded by a mutex, every worker thread owns a lock-free deque of tasks (see
+// the threadpool::WorkStealingDeque class). Tasks that are scheduled by a worker thread (for
+// instance by a task that spawns further tasks) are added to the deque of this worker and are
+// executed in LIFO order by the worker itself. Tasks that are scheduled by any other thread are
+// added to a separate deque for external tasks. Idle workers steal the oldest tasks of the
+// external deque and of the other workers. Therefore the acquisition of a task never requires
+// a lock, and fine-grained tasks no longer serialize on a shared queue. Locks are only used to
+// put idle workers to sleep and to wake them up again.
+//
+// In contrast to the ThreadPool class template, the threads calling the wait() function do not
+// block as long as there are tasks to be executed, but participate in their execution.
+//
+// In order to keep the data of a task close to the thread executing it, a task can be scheduled
+// for a particular worker via the scheduleOn() function. Such a task is added to the inbox of
+// the worker, which takes its own tasks first. Other workers steal from an inbox only after all
+// other deques are empty, and threads in the wait() function never do, so the placement is
+// preserved as long as the load is balanced. Additionally, the worker threads can be bound to
+// specific CPUs via the setAffinity() function (see also the threadAffinity() function).
+//
+// For a series of short parallel operations, the latency of waking up sleeping threads quickly
+// dominates the execution time. Therefore idle workers and threads in the wait() function can
+// spin for a configurable number of iterations before they go to sleep (see the setSpinCount()
+// function). Additionally, the run() function provides a fork/join fast path for operations
+// that consist of a fixed number of chunks: the chunks are published to all workers at once,
+// each worker claims its own chunks first and then helps with the remaining ones, and the
+// calling thread participates until the last chunk is completed.
+//
+//
+// \section workstealingpool_definition Class Definition
+//
+// Just as the ThreadPool class template, the WorkStealingPool class template can be configured
+// as either a C++11 thread pool or a Boost thread pool via its four template parameters:
+
+   \code
+   template< typename TT, typename MT, typename LT, typename CT >
+   class WorkStealingPool;
+   \endcode
+
+//  - TT: specifies the type of the encapsulated thread. This can either be \c std::thread,
+//        \c boost::thread, or any other standard conforming thread type.
+//  - MT: specifies the type of the used synchronization mutex. This can for instance be
+//        \c std::mutex, \c boost::mutex, or any other standard conforming mutex type.
+//  - LT: specifies the type of lock used in combination with the given mutex type. This
+//        can be any standard conforming lock type, as for instance \c std::unique_lock,
+//        \c boost::unique_lock.
+//  - CT: specifies the type of the used condition variable. This can for instance be
+//        \c std::condition_variable, \c boost::condition_variable, or any other standard
+//        conforming condition variable type.
+//
+// The following example demonstrates the use of the WorkStealingPool class template:
+
+   \code
+   typedef blaze::WorkStealingPool< std::thread
+                                  , std::mutex
+                                  , std::unique_lock<std::mutex>
+                                  , std::condition_variable >  StdWorkStealingPool;
+
+   int main()
+   {
+      // Creating a thread pool with initially two working threads
+      StdWorkStealingPool threadpool( 2 );
+
+      // Scheduling two concurrent tasks
+      threadpool.schedule( function0 );
+      threadpool.schedule( Functor2(), 4, 6 );
+
+      // Waiting for the thread pool to complete both tasks
+      threadpool.wait();
+   }
+   \endcode
+
+// Please note that the resize() function of the WorkStealingPool class template waits for all
+// scheduled tasks to be completed before the number of threads is adapted. Therefore it must
+// neither be called from within a task nor concurrently to the scheduling of tasks. For the
+// handling of exceptions thrown during the execution of a task, see the ThreadPool class
+// description.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+class WorkStealingPool : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef TT                              ThreadType;    //!< Type of the encapsulated thread.
+   typedef boost::scoped_ptr<ThreadType>   ThreadHandle;  //!< Handle for a single thread.
+   typedef threadpool::Task                Task;          //!< Type of a single task.
+   typedef threadpool::WorkStealingDeque   Deque;         //!< Type of the task deques.
+   typedef MT                              Mutex;         //!< Type of the mutex.
+   typedef LT                              Lock;          //!< Type of a locking object.
+   typedef CT                              Condition;     //!< Condition variable type.
+   //**********************************************************************************************
+
+   //**Worker class definition*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief A single worker thread of the work-stealing pool.
+   */
+   struct Worker : private NonCopyable
+   {
+    public:
+      //**Constructor******************************************************************************
+      explicit inline Worker( WorkStealingPool* pool, size_t index )
+         : pool_      ( pool  )     // Handle to the managing thread pool
+         , index_     ( index )     // Index of the worker within the thread pool
+         , seed_      ( index+1UL ) // Seed for the selection of steal victims
+         , job_       ( 0UL )       // Identifier of the last joined fork/join job
+         , deque_     ()            // The tasks scheduled by the worker
+         , inbox_     ()            // The tasks scheduled for the worker
+         , inboxMutex_()            // Synchronization mutex for the inbox
+         , thread_    ()            // Handle to the thread of execution
+      {}
+      //*******************************************************************************************
+
+      //**Victim function**************************************************************************
+      /*!\brief Returns the index of the next worker to steal from (xorshift generator).
+      */
+      inline size_t victim( size_t n ) {
+         seed_ ^= seed_ << 13;
+         seed_ ^= seed_ >> 7;
+         seed_ ^= seed_ << 17;
+         return seed_ % n;
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      WorkStealingPool* pool_;        //!< Handle to the managing thread pool.
+      size_t            index_;       //!< Index of the worker within the thread pool.
+      size_t            seed_;        //!< Seed for the selection of steal victims.
+      size_t            job_;         //!< Identifier of the last joined fork/join job.
+      Deque             deque_;       //!< The tasks scheduled by the worker.
+      Deque             inbox_;       //!< The tasks scheduled for the worker.
+                                      /*!< Tasks are pushed under the inbox mutex and are only
+                                           ever stolen, i.e. taken in FIFO order. */
+      Mutex             inboxMutex_;  //!< Synchronization mutex for the inbox.
+      ThreadHandle      thread_;      //!< Handle to the thread of execution.
+      //*******************************************************************************************
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Job class definition************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief The state of a fork/join job of the work-stealing pool.
+   */
+   struct Job : private NonCopyable
+   {
+    public:
+      //**Constructor******************************************************************************
+      explicit inline Job()
+         : func_     ()       // The function executed for every chunk
+         , size_     ( 0UL )  // The number of chunks
+         , capacity_ ( 0UL )  // The capacity of the array of claim flags
+         , claimed_  ()       // The claim flags of the chunks
+         , remaining_( 0UL )  // The number of not yet completed chunks
+      {}
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      boost::function<void(size_t)>      func_;       //!< The function executed for every chunk.
+      size_t                             size_;       //!< The number of chunks.
+      size_t                             capacity_;   //!< The capacity of the array of claim flags.
+      UniqueArray< boost::atomic<bool> > claimed_;    //!< The claim flags of the chunks.
+      boost::atomic<size_t>              remaining_;  //!< The number of not yet completed chunks.
+      //*******************************************************************************************
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef PtrVector<Worker>  Workers;  //!< Type of the worker container.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit WorkStealingPool( size_t n, const std::vector<size_t>& cpus=std::vector<size_t>(),
+                              size_t spin=0UL );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~WorkStealingPool();
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline bool   isEmpty()   const;
+   inline bool   isWorker()  const;
+   inline size_t size()      const;
+   inline size_t active()    const;
+   inline size_t ready()     const;
+   inline size_t spinCount() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Scheduling functions************************************************************************
+   /*!\name Scheduling functions */
+   //@{
+   template< typename Callable >
+   void schedule( Callable func );
+
+   template< typename Callable, typename A1 >
+   void schedule( Callable func, A1 a1 );
+
+   template< typename Callable, typename A1, typename A2 >
+   void schedule( Callable func, A1 a1, A2 a2 );
+
+   template< typename Callable, typename A1, typename A2, typename A3 >
+   void schedule( Callable func, A1 a1, A2 a2, A3 a3 );
+
+   template< typename Callable, typename A1, typename A2, typename A3, typename A4 >
+   void schedule( Callable func, A1 a1, A2 a2, A3 a3, A4 a4 );
+
+   template< typename Callable, typename A1, typename A2, typename A3, typename A4, typename A5 >
+   void schedule( Callable func, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5 );
+
+   template< typename Callable >
+   void scheduleOn( size_t index, Callable func );
+
+   template< typename Callable >
+   void run( size_t n, Callable func );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void resize      ( size_t n, bool block=false );
+   void setAffinity ( const std::vector<size_t>& cpus );
+   void setSpinCount( size_t n );
+   void wait        ();
+   void clear       ();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Thread functions****************************************************************************
+   /*!\name Thread functions */
+   //@{
+   void         start  ( size_t n );
+   void         stop   ();
+   void         work   ( Worker* worker );
+   void         push   ( Task* task );
+   void         push   ( Task* task, size_t index );
+   inline Task* acquire( Worker* worker );
+   inline void  execute( Task* task );
+   inline void  finish ();
+   inline void  wake   ();
+   inline void  wakeAll();
+   inline bool  hasTasks( bool inboxes=true ) const;
+   inline bool  isJoinable( const Worker* worker ) const;
+   void         join   ( Worker* worker );
+   inline void  executeChunk( size_t index );
+   inline Worker* self();
+
+   static inline Worker*& current();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Workers workers_;                  //!< The worker threads contained in the thread pool.
+   std::vector<size_t> affinity_;     //!< The CPUs the worker threads are bound to.
+   Deque external_;                   //!< Deque for the tasks scheduled by external threads.
+   Mutex externalMutex_;              //!< Synchronization mutex for the external deque.
+                                      /*!< The mutex orders the push and pop operations of
+                                           different external threads; stealing from the
+                                           external deque is lock-free. */
+   boost::atomic<size_t> pending_;    //!< Number of scheduled, but not yet completed tasks.
+   boost::atomic<size_t> active_;     //!< Number of currently active/busy worker threads.
+   boost::atomic<size_t> searching_;  //!< Number of worker threads searching for a task.
+   boost::atomic<size_t> idle_;       //!< Number of sleeping worker threads.
+   boost::atomic<size_t> waiting_;    //!< Number of threads sleeping in the wait() function.
+   boost::atomic<size_t> spin_;       //!< Number of spin iterations before a thread sleeps.
+   Job job_;                          //!< The current fork/join job.
+   boost::atomic<size_t> jobId_;      //!< Identifier of the active fork/join job (0 if none).
+   boost::atomic<size_t> users_;      //!< Number of workers accessing the fork/join job.
+   size_t jobs_;                      //!< Number of started fork/join jobs.
+   Mutex jobMutex_;                   //!< Synchronization mutex for the run() function.
+   size_t wakeups_;                   //!< Number of pending wake-ups for idle worker threads.
+   size_t epoch_;                     //!< Counter for the notifications of waiting threads.
+   bool stop_;                        //!< Termination flag for the worker threads.
+   mutable Mutex mutex_;              //!< Synchronization mutex for sleeping threads.
+   Condition waitForTask_;            //!< Wait condition for idle worker threads.
+   Condition waitForCompletion_;      //!< Wait condition for the wait() function.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the WorkStealingPool class.
+//
+// \param n Initial number of threads \f$[1..\infty)\f$.
+// \param cpus The CPUs the threads are bound to (see the setAffinity() function).
+// \param spin The number of spin iterations before a thread sleeps (see setSpinCount()).
+// \exception std::invalid_argument Invalid number of threads.
+//
+// This constructor creates a thread pool with initially \a n new threads. All threads are
+// initially idle until a task is scheduled.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+WorkStealingPool<TT,MT,LT,CT>::WorkStealingPool( size_t n, const std::vector<size_t>& cpus, size_t spin )
+   : workers_           ()         // The worker threads contained in the thread pool
+   , affinity_          ( cpus )   // The CPUs the worker threads are bound to
+   , external_          ()         // Deque for the tasks scheduled by external threads
+   , externalMutex_     ()         // Synchronization mutex for the external deque
+   , pending_           ( 0UL )    // Number of scheduled, but not yet completed tasks
+   , active_            ( 0UL )    // Number of currently active/busy worker threads
+   , searching_         ( 0UL )    // Number of worker threads searching for a task
+   , idle_              ( 0UL )    // Number of sleeping worker threads
+   , waiting_           ( 0UL )    // Number of threads sleeping in the wait() function
+   , spin_              ( spin )   // Number of spin iterations before a thread sleeps
+   , job_               ()         // The current fork/join job
+   , jobId_             ( 0UL )    // Identifier of the active fork/join job
+   , users_             ( 0UL )    // Number of workers accessing the fork/join job
+   , jobs_              ( 0UL )    // Number of started fork/join jobs
+   , jobMutex_          ()         // Synchronization mutex for the run() function
+   , wakeups_           ( 0UL )    // Number of pending wake-ups for idle worker threads
+   , epoch_             ( 0UL )    // Counter for the notifications of waiting threads
+   , stop_              ( false )  // Termination flag for the worker threads
+   , mutex_             ()         // Synchronization mutex for sleeping threads
+   , waitForTask_       ()         // Wait condition for idle worker threads
+   , waitForCompletion_ ()         // Wait condition for the wait() function
+{
+   resize( n );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the WorkStealingPool class.
+//
+// The destructor removes all remaining tasks from the thread pool and waits for the currently
+// active threads to complete their tasks.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+WorkStealingPool<TT,MT,LT,CT>::~WorkStealingPool()
+{
+   clear();
+   wait();
+   stop();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether any tasks are scheduled for execution.
+//
+// \return \a true in case task are scheduled, \a false otherwise.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline bool WorkStealingPool<TT,MT,LT,CT>::isEmpty() const
+{
+   return !hasTasks();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current size of the thread pool.
+//
+// \return The total number of threads in the thread pool.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t WorkStealingPool<TT,MT,LT,CT>::size() const
+{
+   return workers_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of currently active/busy threads.
+//
+// \return The number of currently active threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t WorkStealingPool<TT,MT,LT,CT>::active() const
+{
+   return active_.load( boost::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of currently ready/inactive threads.
+//
+// \return The number of currently ready threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t WorkStealingPool<TT,MT,LT,CT>::ready() const
+{
+   return size() - active();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the calling thread is a worker thread of the thread pool.
+//
+// \return \a true if the calling thread is a worker thread of the pool, \a false if not.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline bool WorkStealingPool<TT,MT,LT,CT>::isWorker() const
+{
+   const Worker* worker( current() );
+   return worker != NULL && worker->pool_ == this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of spin iterations before an idle thread goes to sleep.
+//
+// \return The number of spin iterations.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t WorkStealingPool<TT,MT,LT,CT>::spinCount() const
+{
+   return spin_.load( boost::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SCHEDULING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scheduling the given zero argument function/functor for execution.
+//
+// \param func The given function/functor.
+// \return void
+//
+// This function schedules the given function/functor for execution. The given function/functor
+// must be copyable, must be callable without arguments and must return void.
+*/
+template< typename TT          // Type of the encapsulated thread
+        , typename MT          // Type of the synchronization mutex
+        , typename LT          // Type of the mutex lock
+        , typename CT >        // Type of the condition variable
+template< typename Callable >  // Type of the function/functor
+void WorkStealingPool<TT,MT,LT,CT>::schedule( Callable func )
+{
+   push( new Task( func ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scheduling the given unary function/functor for execution.
+//
+// \param func The given function/functor.
+// \param a1 The first argument.
+// \return void
+//
+// This function schedules the given function/functor for execution. The given function/functor
+// must be copyable, must be callable with one argument and must return void.
+*/
+template< typename TT        // Type of the encapsulated thread
+        , typename MT        // Type of the synchronization mutex
+        , typename LT        // Type of the mutex lock
+        , typename CT >      // Type of the condition variable
+template< typename Callable  // Type of the function/functor
+        , typename A1 >      // Type of the first argument
+void WorkStealingPool<TT,MT,LT,CT>::schedule( Callable func, A1 a1 )
+{
+   push( new Task( boost::bind<void>( func, a1 ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scheduling the given binary function/functor for execution.
+//
+// \param func The given function/functor.
+// \param a1 The first argument.
+// \param a2 The second argument.
+// \return void
+//
+// This function schedules the given function/functor for execution. The given function/functor
+// must be copyable, must be callable with two arguments and must return void.
+*/
+template< typename TT        // Type of the encapsulated thread
+        , typename MT        // Type of the synchronization mutex
+        , typename LT        // Type of the mutex lock
+        , typename CT >      // Type of the condition variable
+template< typename Callable  // Type of the function/functor
+        , typename A1        // Type of the first argument
+        , typename A2 >      // Type of the second argument
+void WorkStealingPool<TT,MT,LT,CT>::schedule( Callable func, A1 a1, A2 a2 )
+{
+   push( new Task( boost::bind<void>( func, a1, a2 ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scheduling the given ternary function/functor for execution.
+//
+// \param func The given function/functor.
+// \param a1 The first argument.
+// \param a2 The second argument.
+// \param a3 The third argument.
+// \return void
+//
+// This function schedules the given function/functor for execution. The given function/functor
+// must be copyable, must be callable with three arguments and must return void.
+*/
+template< typename TT        // Type of the encapsulated thread
+        , typename MT        // Type of the synchronization mutex
+        , typename LT        // Type of the mutex lock
+        , typename CT >      // Type of the condition variable
+template< typename Callable  // Type of the function/functor
+        , typename A1        // Type of the first argument
+        , typename A2        // Type of the second argument
+        , typename A3 >      // Type of the third argument
+void WorkStealingPool<TT,MT,LT,CT>::schedule( Callable func, A1 a1, A2 a2, A3 a3 )
+{
+   push( new Task( boost::bind<void>( func, a1, a2, a3 ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scheduling the given four argument function/functor for execution.
+//
+// \param func The given function/functor.
+// \param a1 The first argument.
+// \param a2 The second argument.
+// \param a3 The third argument.
+// \param a4 The fourth argument.
+// \return void
+//
+// This function schedules the given function/functor for execution. The given function/functor
+// must be copyable, must be callable with four arguments and must return void.
+*/
+template< typename TT        // Type of the encapsulated thread
+        , typename MT        // Type of the synchronization mutex
+        , typename LT        // Type of the mutex lock
+        , typename CT >      // Type of the condition variable
+template< typename Callable  // Type of the function/functor
+        , typename A1        // Type of the first argument
+        , typename A2        // Type of the second argument
+        , typename A3        // Type of the third argument
+        , typename A4 >      // Type of the fourth argument
+void WorkStealingPool<TT,MT,LT,CT>::schedule( Callable func, A1 a1, A2 a2, A3 a3, A4 a4 )
+{
+   push( new Task( boost::bind<void>( func, a1, a2, a3, a4 ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scheduling the given five argument function/functor for execution.
+//
+// \param func The given function/functor.
+// \param a1 The first argument.
+// \param a2 The second argument.
+// \param a3 The third argument.
+// \param a4 The fourth argument.
+// \param a5 The fifth argument.
+// \return void
+//
+// This function schedules the given function/functor for execution. The given function/functor
+// must be copyable, must be callable with five arguments and must return void.
+*/
+template< typename TT        // Type of the encapsulated thread
+        , typename MT        // Type of the synchronization mutex
+        , typename LT        // Type of the mutex lock
+        , typename CT >      // Type of the condition variable
+template< typename Callable  // Type of the function/functor
+        , typename A1        // Type of the first argument
+        , typename A2        // Type of the second argument
+        , typename A3        // Type of the third argument
+        , typename A4        // Type of the fourth argument
+        , typename A5 >      // Type of the fifth argument
+void WorkStealingPool<TT,MT,LT,CT>::schedule( Callable func, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5 )
+{
+   push( new Task( boost::bind<void>( func, a1, a2, a3, a4, a5 ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scheduling the given zero argument function/functor for execution by a particular worker.
+//
+// \param index The index of the preferred worker thread (taken modulo the size of the pool).
+// \param func The given function/functor.
+// \return void
+//
+// This function schedules the given function/functor for execution by the worker thread with
+// the given index. The task is preferably executed by this worker, but might still be stolen
+// by another worker in order to balance the load. Scheduling related tasks for the same worker
+// keeps the data they access close to the same CPU (for instance in the same NUMA node). The
+// given function/functor must be copyable, must be callable without arguments and must return
+// void.
+*/
+template< typename TT          // Type of the encapsulated thread
+        , typename MT          // Type of the synchronization mutex
+        , typename LT          // Type of the mutex lock
+        , typename CT >        // Type of the condition variable
+template< typename Callable >  // Type of the function/functor
+void WorkStealingPool<TT,MT,LT,CT>::scheduleOn( size_t index, Callable func )
+{
+   push( new Task( func ), index );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executing the given function/functor for all chunks \f$ [0..n) \f$ (fork/join).
+//
+// \param n The number of chunks.
+// \param func The given function/functor.
+// \return void
+//
+// This function calls \a func(i) for every chunk index \f$ i \in [0..n) \f$ and returns as soon
+// as all chunks have been completed. In contrast to scheduling a separate task per chunk, the
+// job is published to all workers at once: the chunk \a i is preferably executed by the worker
+// \a i % size() (see also the scheduleOn() function), workers that are done with their own chunks
+// help with the remaining ones, and the calling thread executes chunks from the end of the range
+// until all chunks are claimed. Afterwards the calling thread spins (see setSpinCount()) and
+// finally sleeps until the last chunk is completed. Thus the latency of a fork/join operation is
+// determined by the wake-up of the workers only in case they are already sleeping.
+//
+// The given function/functor must be copyable, must be callable with a single \a size_t argument
+// and must return void. Only one fork/join job is executed at a time. Therefore the function must
+// not be called from within a chunk of a fork/join job.
+*/
+template< typename TT          // Type of the encapsulated thread
+        , typename MT          // Type of the synchronization mutex
+        , typename LT          // Type of the mutex lock
+        , typename CT >        // Type of the condition variable
+template< typename Callable >  // Type of the function/functor
+void WorkStealingPool<TT,MT,LT,CT>::run( size_t n, Callable func )
+{
+   if( n == 0UL )
+      return;
+
+   Lock jobLock( jobMutex_ );
+
+   // Waiting for the workers that are still scanning the claim flags of the previous job
+   for( size_t i=0UL; users_.load() > 0UL; ++i ) {
+      threadpool::backoff( i );
+   }
+
+   // Initializing the job
+   if( job_.capacity_ < n ) {
+      job_.claimed_.reset( new boost::atomic<bool>[n] );
+      job_.capacity_ = n;
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      job_.claimed_[i].store( false, boost::memory_order_relaxed );
+   }
+
+   job_.func_ = func;
+   job_.size_ = n;
+   job_.remaining_.store( n, boost::memory_order_relaxed );
+
+   // Publishing the job and waking up the sleeping workers
+   jobId_.store( ++jobs_ );
+   wakeAll();
+
+   // Participating in the execution of the chunks
+   for( size_t i=n; i>0UL; --i ) {
+      executeChunk( i-1UL );
+   }
+
+   // Waiting for the completion of the last chunk
+   const size_t spin( spin_.load( boost::memory_order_relaxed ) );
+
+   for( size_t i=0UL; i<spin && job_.remaining_.load() > 0UL; ++i ) {
+      threadpool::backoff( i );
+   }
+
+   if( job_.remaining_.load() > 0UL )
+   {
+      Lock lock( mutex_ );
+
+      ++waiting_;
+      boost::atomic_thread_fence( boost::memory_order_seq_cst );
+
+      while( job_.remaining_.load() > 0UL ) {
+         waitForCompletion_.wait( lock );
+      }
+
+      --waiting_;
+   }
+
+   jobId_.store( 0UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Changes the total number of threads in the thread pool.
+//
+// \param n The new number of threads \f$[1..\infty)\f$.
+// \param block Ignored; the function always blocks.
+// \return void
+// \exception std::invalid_argument Invalid number of threads.
+//
+// This function changes the size of the thread pool, i.e. changes the total number of threads
+// contained in the pool. Since the deques of the worker threads are accessed by all threads
+// without synchronization, the function first waits for all scheduled tasks to be completed
+// and terminates all threads before the new threads are created. Therefore the function must
+// neither be called from within a task nor concurrently to the scheduling of tasks. The \a block
+// flag is only provided for compatibility with the ThreadPool class template. As in case of the
+// ThreadPool class template, for Visual Studio compilers only, it is possible to resize the
+// thread pool to 0 threads in order to destroy all threads before the end of the \c main()
+// function.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::resize( size_t n, bool block )
+{
+   UNUSED_PARAMETER( block );
+
+   // Checking the given number of threads
+#if !(defined _MSC_VER)
+   if( n == 0 )
+      throw std::invalid_argument( "Invalid number of threads" );
+#endif
+
+   if( n == workers_.size() )
+      return;
+
+   wait();
+   stop();
+   start( n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Binding the worker threads to the given CPUs.
+//
+// \param cpus The CPUs the worker threads are bound to.
+// \return void
+//
+// This function binds the \a i-th worker thread to the CPU \a cpus[i % cpus.size()]. The binding
+// also applies to all worker threads created by subsequent calls to the resize() function. An
+// empty sequence of CPUs leaves the current binding of the threads unchanged, but prevents the
+// binding of new threads. On systems that do not support binding threads to CPUs, the function
+// has no effect. Just as the resize() function, the function must neither be called from within
+// a task nor concurrently to the scheduling of tasks.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::setAffinity( const std::vector<size_t>& cpus )
+{
+   affinity_ = cpus;
+
+   if( affinity_.empty() )
+      return;
+
+   for( size_t i=0UL; i<workers_.size(); ++i )
+      setThreadAffinity( workers_[i]->thread_->native_handle(), affinity_[i%affinity_.size()] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the number of spin iterations before an idle thread goes to sleep.
+//
+// \param n The number of spin iterations.
+// \return void
+//
+// This function sets the number of iterations an idle worker, a thread in the wait() function,
+// or a thread waiting for the completion of a fork/join job (see the run() function) actively
+// polls for new work before it goes to sleep. Spinning avoids the latency of putting a thread
+// to sleep and waking it up again, which is in the order of tens of microseconds, at the cost
+// of occupying the CPU while polling. Every iteration takes in the order of 10 to 100 processor
+// cycles. Spinning is therefore only recommended in case every thread has a core of its own. A
+// value of 0 (the default) disables spinning.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::setSpinCount( size_t n )
+{
+   spin_.store( n, boost::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waiting for all scheduled tasks to be completed.
+//
+// \return void
+//
+// This function blocks until all scheduled tasks have been completed. As long as there are
+// tasks waiting for execution, the calling thread executes tasks itself instead of blocking.
+// Note that the function must not be called from within a task, since the calling task itself
+// is one of the tasks to be completed.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::wait()
+{
+   Worker* worker( self() );
+
+   while( pending_.load() > 0UL )
+   {
+      // Participating in the execution of the remaining tasks
+      if( Task* task = acquire( worker ) ) {
+         execute( task );
+         continue;
+      }
+
+      // Spinning for a while, since the remaining tasks usually complete soon
+      const size_t spin( spin_.load( boost::memory_order_relaxed ) );
+      size_t i( 0UL );
+
+      for( ; i<spin && pending_.load() > 0UL && !hasTasks( worker != NULL ); ++i ) {
+         threadpool::backoff( i );
+      }
+
+      if( i < spin )
+         continue;
+
+      // Sleeping until the tasks are completed or a new task is scheduled
+      Lock lock( mutex_ );
+      const size_t epoch( epoch_ );
+
+      ++waiting_;
+      boost::atomic_thread_fence( boost::memory_order_seq_cst );
+
+      if( !hasTasks( worker != NULL ) ) {
+         while( pending_.load() > 0UL && epoch == epoch_ ) {
+            waitForCompletion_.wait( lock );
+         }
+      }
+
+      --waiting_;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all scheduled tasks from the thread pool.
+//
+// \return void
+//
+// This function removes all currently scheduled tasks from the thread pool. The total number
+// of threads remains unchanged and all active threads continue completing their tasks.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::clear()
+{
+   {
+      Lock lock( externalMutex_ );
+      while( Task* task = external_.pop() ) {
+         delete task;
+         finish();
+      }
+   }
+
+   for( size_t i=0UL; i<workers_.size(); ++i ) {
+      Deque& deque( workers_[i]->deque_ );
+      while( !deque.isEmpty() ) {
+         if( Task* task = deque.steal() ) {
+            delete task;
+            finish();
+         }
+      }
+
+      Deque& inbox( workers_[i]->inbox_ );
+      while( !inbox.isEmpty() ) {
+         if( Task* task = inbox.steal() ) {
+            delete task;
+            finish();
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREAD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creating the given number of worker threads.
+//
+// \param n The number of worker threads.
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::start( size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( workers_.isEmpty(), "Active worker threads detected" );
+
+   stop_ = false;
+
+   // All workers start in the searching state
+   searching_ = n;
+   idle_      = 0UL;
+   wakeups_   = 0UL;
+
+   // Creating all workers before the first thread is started, since every worker accesses
+   // the deques of all other workers
+   for( size_t i=0UL; i<n; ++i )
+      workers_.pushBack( new Worker( this, i ) );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      workers_[i]->thread_.reset( new ThreadType( boost::bind( &WorkStealingPool::work, this, workers_[i] ) ) );
+      if( !affinity_.empty() )
+         setThreadAffinity( workers_[i]->thread_->native_handle(), affinity_[i%affinity_.size()] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Terminating and destroying all worker threads.
+//
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::stop()
+{
+   {
+      Lock lock( mutex_ );
+      stop_ = true;
+      waitForTask_.notify_all();
+   }
+
+   for( size_t i=0UL; i<workers_.size(); ++i )
+      workers_[i]->thread_->join();
+
+   workers_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The execution loop of a single worker thread.
+//
+// \param worker The worker executing the loop.
+// \return void
+//
+// Every worker repeatedly joins the active fork/join job, executes the tasks of its own deque,
+// and steals tasks from the other deques. In case there is no work available, the worker spins
+// for the configured number of iterations and afterwards sleeps until it is woken up by the
+// wake() or wakeAll() function. The worker terminates as soon as the termination flag is set
+// and no task is left.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::work( Worker* worker )
+{
+   current() = worker;
+
+   bool searching( true );
+
+   while( true )
+   {
+      // Joining the active fork/join job
+      if( isJoinable( worker ) ) {
+         if( searching ) {
+            searching = false;
+            if( --searching_ == 0UL && hasTasks() )
+               wake();
+         }
+         join( worker );
+         continue;
+      }
+
+      Task* task( worker->deque_.pop() );
+
+      // Searching for a task to steal
+      if( task == NULL ) {
+         if( !searching ) {
+            searching = true;
+            ++searching_;
+         }
+         task = acquire( worker );
+      }
+
+      // Executing the task. In case the last searching worker found a task, another idle
+      // worker is woken up to search for the remaining tasks.
+      if( task != NULL ) {
+         if( searching ) {
+            searching = false;
+            if( --searching_ == 0UL && hasTasks() )
+               wake();
+         }
+         ++active_;
+         execute( task );
+         --active_;
+         continue;
+      }
+
+      // Spinning for a while before going to sleep, since in a series of parallel operations
+      // the next task or job usually follows shortly
+      const size_t spin( spin_.load( boost::memory_order_relaxed ) );
+      size_t i( 0UL );
+
+      for( ; i<spin && !hasTasks() && !isJoinable( worker ); ++i ) {
+         threadpool::backoff( i );
+      }
+
+      if( i < spin )
+         continue;
+
+      Lock lock( mutex_ );
+
+      if( stop_ ) break;
+
+      // Announcing the sleep before the final check for new tasks. The matching fence in the
+      // wake() function guarantees that either a newly scheduled task is detected or that the
+      // scheduling thread wakes up a worker.
+      --searching_;
+      ++idle_;
+      boost::atomic_thread_fence( boost::memory_order_seq_cst );
+
+      if( hasTasks() || isJoinable( worker ) ) {
+         --idle_;
+         ++searching_;
+         continue;
+      }
+
+      while( wakeups_ == 0UL && !stop_ ) {
+         waitForTask_.wait( lock );
+      }
+
+      // The waking thread has already moved the worker from the idle to the searching state
+      if( wakeups_ > 0UL ) {
+         --wakeups_;
+      }
+      else {
+         --idle_;
+         ++searching_;
+      }
+   }
+
+   current() = NULL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adding a task to the thread pool.
+//
+// \param task The dynamically allocated task.
+// \return void
+//
+// A task scheduled by a worker thread of this thread pool is added to the deque of the worker,
+// any other task is added to the external deque.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::push( Task* task )
+{
+   ++pending_;
+
+   if( Worker* worker = self() ) {
+      worker->deque_.push( task );
+   }
+   else {
+      Lock lock( externalMutex_ );
+      external_.push( task );
+   }
+
+   wake();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adding a task for a particular worker to the thread pool.
+//
+// \param task The dynamically allocated task.
+// \param index The index of the preferred worker thread (taken modulo the size of the pool).
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::push( Task* task, size_t index )
+{
+   ++pending_;
+
+   Worker* worker( workers_[index%workers_.size()] );
+
+   {
+      Lock lock( worker->inboxMutex_ );
+      worker->inbox_.push( task );
+   }
+
+   wake();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Acquiring a task for execution.
+//
+// \param worker The calling worker, or \c NULL in case of an external thread.
+// \return The acquired task, or \c NULL in case no task is available.
+//
+// A worker first takes the most recent task from its own deque and the oldest task from its
+// inbox, an external thread the most recent task from the external deque. Afterwards the oldest
+// task of the external deque and of the other workers, starting at a randomly selected worker,
+// are stolen. The inboxes of the other workers are only considered by workers and only in case
+// no other task is available.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline threadpool::Task* WorkStealingPool<TT,MT,LT,CT>::acquire( Worker* worker )
+{
+   Task* task( NULL );
+
+   if( worker != NULL ) {
+      task = worker->deque_.pop();
+      if( task == NULL )
+         task = worker->inbox_.steal();
+      if( task == NULL )
+         task = external_.steal();
+   }
+   else if( !external_.isEmpty() ) {
+      Lock lock( externalMutex_ );
+      task = external_.pop();
+   }
+
+   const size_t n( workers_.size() );
+   const size_t first( ( worker != NULL && n > 1UL )?( worker->victim( n ) ):( 0UL ) );
+
+   for( size_t i=0UL; task == NULL && i<n; ++i ) {
+      Worker* victim( workers_[(first+i)%n] );
+      if( victim != worker )
+         task = victim->deque_.steal();
+   }
+
+   for( size_t i=0UL; task == NULL && worker != NULL && i<n; ++i ) {
+      Worker* victim( workers_[(first+i)%n] );
+      if( victim != worker )
+         task = victim->inbox_.steal();
+   }
+
+   return task;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executing and destroying the given task.
+//
+// \param task The task to be executed.
+// \return void
+//
+// In case the task throws an exception, the task is nevertheless destroyed and marked as
+// completed before the exception is propagated. Otherwise the number of pending tasks would
+// never drop to zero and all subsequent calls of the wait() function would block forever.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void WorkStealingPool<TT,MT,LT,CT>::execute( Task* task )
+{
+   try {
+      (*task)();
+   }
+   catch( ... ) {
+      delete task;
+      finish();
+      throw;
+   }
+
+   delete task;
+   finish();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Marking a task as completed.
+//
+// \return void
+//
+// In case the last pending task has been completed, all threads in the wait() function are
+// woken up.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void WorkStealingPool<TT,MT,LT,CT>::finish()
+{
+   if( --pending_ > 0UL )
+      return;
+
+   boost::atomic_thread_fence( boost::memory_order_seq_cst );
+
+   if( waiting_.load( boost::memory_order_relaxed ) == 0UL )
+      return;
+
+   Lock lock( mutex_ );
+   waitForCompletion_.notify_all();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waking up sleeping threads after a new task has been added.
+//
+// \return void
+//
+// In case no worker is currently searching for a task, one idle worker is woken up. Since the
+// woken worker immediately counts as searching worker, a series of scheduled tasks only wakes
+// a single worker, which in turn wakes up the next worker as soon as it found a task. All
+// threads sleeping in the wait() function are woken up in order to participate in the execution
+// of the new task.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void WorkStealingPool<TT,MT,LT,CT>::wake()
+{
+   boost::atomic_thread_fence( boost::memory_order_seq_cst );
+
+   const bool worker( searching_.load( boost::memory_order_relaxed ) == 0UL &&
+                      idle_.load( boost::memory_order_relaxed ) > 0UL );
+   const bool waiting( waiting_.load( boost::memory_order_relaxed ) > 0UL );
+
+   if( !worker && !waiting )
+      return;
+
+   Lock lock( mutex_ );
+
+   if( worker && idle_.load() > 0UL ) {
+      --idle_;
+      ++searching_;
+      ++wakeups_;
+      waitForTask_.notify_one();
+   }
+
+   if( waiting ) {
+      ++epoch_;
+      waitForCompletion_.notify_all();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waking up all sleeping worker threads after a fork/join job has been published.
+//
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void WorkStealingPool<TT,MT,LT,CT>::wakeAll()
+{
+   boost::atomic_thread_fence( boost::memory_order_seq_cst );
+
+   if( idle_.load( boost::memory_order_relaxed ) == 0UL )
+      return;
+
+   Lock lock( mutex_ );
+
+   const size_t idle( idle_.load() );
+   idle_      -= idle;
+   searching_ += idle;
+   wakeups_   += idle;
+   waitForTask_.notify_all();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether any deque of the thread pool contains a task.
+//
+// \param inboxes \a true if the inboxes of the workers are considered, \a false if not.
+// \return \a true in case a task is available, \a false if not.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline bool WorkStealingPool<TT,MT,LT,CT>::hasTasks( bool inboxes ) const
+{
+   if( !external_.isEmpty() )
+      return true;
+
+   for( size_t i=0UL; i<workers_.size(); ++i ) {
+      if( !workers_[i]->deque_.isEmpty() || ( inboxes && !workers_[i]->inbox_.isEmpty() ) )
+         return true;
+   }
+
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given worker can join the active fork/join job.
+//
+// \param worker The worker to be checked.
+// \return \a true in case there is a job the worker has not joined yet, \a false if not.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline bool WorkStealingPool<TT,MT,LT,CT>::isJoinable( const Worker* worker ) const
+{
+   const size_t id( jobId_.load( boost::memory_order_relaxed ) );
+   return id != 0UL && id != worker->job_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Participating in the execution of the active fork/join job.
+//
+// \param worker The joining worker.
+// \return void
+//
+// The worker first executes the chunks it is responsible for (i.e. all chunks \a i with
+// \a i % size() equal to its index) and afterwards helps with all chunks not yet claimed by
+// another thread. While accessing the job, the worker is registered as user of the job, such
+// that the next job is not initialized before the worker has left.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::join( Worker* worker )
+{
+   ++users_;
+
+   const size_t id( jobId_.load() );
+
+   if( id != 0UL && id != worker->job_ )
+   {
+      worker->job_ = id;
+
+      const size_t n     ( job_.size_ );
+      const size_t stride( workers_.size() );
+
+      for( size_t i=worker->index_; i<n; i+=stride ) {
+         executeChunk( i );
+      }
+
+      for( size_t i=0UL; i<n; ++i ) {
+         executeChunk( i );
+      }
+   }
+
+   --users_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executing a single chunk of the active fork/join job.
+//
+// \param index The index of the chunk.
+// \return void
+//
+// The chunk is only executed in case it has not been claimed by another thread yet. The thread
+// completing the last chunk wakes up the thread waiting in the run() function.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void WorkStealingPool<TT,MT,LT,CT>::executeChunk( size_t index )
+{
+   if( job_.claimed_[index].load( boost::memory_order_relaxed ) ||
+       job_.claimed_[index].exchange( true ) )
+      return;
+
+   job_.func_( index );
+
+   if( --job_.remaining_ > 0UL )
+      return;
+
+   boost::atomic_thread_fence( boost::memory_order_seq_cst );
+
+   if( waiting_.load( boost::memory_order_relaxed ) == 0UL )
+      return;
+
+   Lock lock( mutex_ );
+   waitForCompletion_.notify_all();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the worker of this thread pool executing the calling thread.
+//
+// \return The calling worker, or \c NULL in case the calling thread is an external thread.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline typename WorkStealingPool<TT,MT,LT,CT>::Worker* WorkStealingPool<TT,MT,LT,CT>::self()
+{
+   Worker* worker( current() );
+   return ( worker != NULL && worker->pool_ == this )?( worker ):( NULL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the worker executing the calling thread.
+//
+// \return Reference to the thread-local handle of the worker.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline typename WorkStealingPool<TT,MT,LT,CT>::Worker*& WorkStealingPool<TT,MT,LT,CT>::current()
+{
+   static BLAZE_THREAD_LOCAL Worker* worker = 0;
+   return worker;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
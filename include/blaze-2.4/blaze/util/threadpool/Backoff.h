@@ -0,0 +1,92 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/Backoff.h
+//  \brief Backoff strategy for spin-wait loops
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADPOOL_BACKOFF_H_
+#define _BLAZE_UTIL_THREADPOOL_BACKOFF_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if (defined __unix__) || (defined __APPLE__)
+#  include <sched.h>
+#endif
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  BACKOFF FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Backoff for the given iteration of a spin-wait loop.
+// \ingroup threads
+//
+// \param iteration The number of the current iteration of the spin-wait loop.
+// \return void
+//
+// This function is called once per iteration of a loop that actively waits for a condition.
+// It hints the processor that the calling thread is spinning, which reduces the power drain
+// and frees resources for the other hyperthread of the core. Every 64th iteration the calling
+// thread additionally yields its time slice, such that a spinning thread does not starve the
+// thread it is waiting for in case there are more threads than cores.
+*/
+inline void backoff( size_t iteration )
+{
+#if (defined __GNUC__) && ( (defined __i386__) || (defined __x86_64__) )
+   __builtin_ia32_pause();
+#endif
+
+#if (defined __unix__) || (defined __APPLE__)
+   if( iteration % 64UL == 63UL )
+      sched_yield();
+#else
+   UNUSED_PARAMETER( iteration );
+#endif
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,526 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/Coroutine.h
+//  \brief Header file for the coroutine-based tasks of the thread pools
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADPOOL_COROUTINE_H_
+#define _BLAZE_UTIL_THREADPOOL_COROUTINE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <coroutine>
+#include <exception>
+#include <new>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS FRAMECACHE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Per-thread cache for the frames of coroutine-based tasks.
+// \ingroup threads
+//
+// The FrameCache class manages the memory of the frames of coroutine-based tasks (see the
+// Coroutine class). Released frames are kept in a free list of the calling thread and are
+// reused by the next task of similar size, such that the repeated creation of tasks does not
+// require any dynamic memory allocation. Frames must be released by the thread that allocated
+// them. Frames larger than the largest cached size are directly allocated and released via the
+// global \c operator \c new and \c operator \c delete.
+*/
+class FrameCache
+{
+ public:
+   //**Allocation functions************************************************************************
+   /*!\name Allocation functions */
+   //@{
+   static inline void* allocate  ( size_t size );
+   static inline void  deallocate( void* frame, size_t size ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Constants***********************************************************************************
+   /*!\name Constants */
+   //@{
+   static const size_t granularity = 64UL;  //!< Granularity of the cached frame sizes in bytes.
+   static const size_t classes     = 32UL;  //!< Number of cached frame sizes.
+   //@}
+   //**********************************************************************************************
+
+   //**Private class Block*************************************************************************
+   /*!\brief Released frame within a free list.
+   */
+   struct Block
+   {
+      Block* next_;  //!< The next released frame of the same size.
+   };
+   //**********************************************************************************************
+
+   //**Private class FreeLists*********************************************************************
+   /*!\brief The free lists of a single thread.
+   */
+   struct FreeLists
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Default constructor for the FreeLists class.
+      */
+      inline FreeLists()
+         : heads_()  // The first released frame of every size
+      {}
+      //*******************************************************************************************
+
+      //**Destructor*******************************************************************************
+      /*!\brief Destructor for the FreeLists class.
+      //
+      // The destructor releases all cached frames.
+      */
+      inline ~FreeLists() {
+         for( size_t i=0UL; i<classes; ++i ) {
+            while( heads_[i] != nullptr ) {
+               Block* const block( heads_[i] );
+               heads_[i] = block->next_;
+               ::operator delete( block );
+            }
+         }
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Block* heads_[classes];  //!< The first released frame of every size.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline FreeLists& lists();
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Allocates a frame of the given size.
+//
+// \param size The size of the frame in bytes.
+// \return Pointer to the allocated frame.
+// \exception std::bad_alloc Allocation failed.
+*/
+inline void* FrameCache::allocate( size_t size )
+{
+   const size_t index( ( size + granularity - 1UL ) / granularity );
+
+   if( index >= classes )
+      return ::operator new( size );
+
+   Block*& head( lists().heads_[index] );
+
+   if( head == nullptr )
+      return ::operator new( index * granularity );
+
+   Block* const block( head );
+   head = block->next_;
+   return block;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Releases the given frame.
+//
+// \param frame The frame to be released.
+// \param size The size of the frame in bytes.
+// \return void
+*/
+inline void FrameCache::deallocate( void* frame, size_t size ) noexcept
+{
+   const size_t index( ( size + granularity - 1UL ) / granularity );
+
+   if( index >= classes ) {
+      ::operator delete( frame );
+      return;
+   }
+
+   Block*& head( lists().heads_[index] );
+   Block* const block( static_cast<Block*>( frame ) );
+   block->next_ = head;
+   head = block;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the free lists of the calling thread.
+//
+// \return Reference to the free lists of the calling thread.
+*/
+inline FrameCache::FreeLists& FrameCache::lists()
+{
+   static thread_local FreeLists lists;
+   return lists;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS RESUMER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Functor for the resumption of a suspended coroutine.
+// \ingroup threads
+//
+// The Resumer class resumes the given coroutine when it is called. Since it only stores the
+// handle of the coroutine, it can be stored in a Task without dynamic memory allocation.
+*/
+struct Resumer
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the Resumer class.
+   //
+   // \param handle The handle of the suspended coroutine.
+   */
+   explicit inline Resumer( std::coroutine_handle<> handle )
+      : handle_( handle )  // The handle of the suspended coroutine
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Resumes the coroutine.
+   //
+   // \return void
+   */
+   inline void operator()() const {
+      handle_.resume();
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   std::coroutine_handle<> handle_;  //!< The handle of the suspended coroutine.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS COROUTINE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Coroutine-based task of a thread pool.
+// \ingroup threads
+//
+// The Coroutine class represents the owning handle to a coroutine that executes a single task
+// (see the spawn() function). The coroutine is created in suspended state and is executed by
+// resuming it once (see the resumer() function), for instance by a thread of a thread pool.
+// Afterwards it remains suspended at its final suspension point until the handle is destroyed.
+// An exception thrown by the task is stored and can be queried by the owner of the handle via
+// the exception() function. The frames of the coroutines are managed by the FrameCache class and
+// therefore have to be destroyed by the thread that created them.
+*/
+class Coroutine
+{
+ public:
+   //**Class promise_type**************************************************************************
+   /*!\brief The promise type of the coroutine.
+   */
+   struct promise_type
+   {
+      //**Coroutine functions**********************************************************************
+      /*!\brief Returns the handle to the coroutine.
+      //
+      // \return The handle to the coroutine.
+      */
+      inline Coroutine get_return_object() {
+         return Coroutine( std::coroutine_handle<promise_type>::from_promise( *this ) );
+      }
+
+      /*!\brief The coroutine is suspended before the execution of the task.
+      //
+      // \return Awaitable that suspends the coroutine.
+      */
+      inline std::suspend_always initial_suspend() const noexcept {
+         return std::suspend_always();
+      }
+
+      /*!\brief The coroutine is suspended after the execution of the task.
+      //
+      // \return Awaitable that suspends the coroutine.
+      */
+      inline std::suspend_always final_suspend() const noexcept {
+         return std::suspend_always();
+      }
+
+      /*!\brief Completion of the task.
+      //
+      // \return void
+      */
+      inline void return_void() const noexcept {}
+
+      /*!\brief Stores the exception thrown by the task.
+      //
+      // \return void
+      */
+      inline void unhandled_exception() noexcept {
+         exception_ = std::current_exception();
+      }
+      //*******************************************************************************************
+
+      //**Allocation functions*********************************************************************
+      /*!\brief Allocates the frame of the coroutine.
+      //
+      // \param size The size of the frame in bytes.
+      // \return Pointer to the allocated frame.
+      */
+      static inline void* operator new( size_t size ) {
+         return FrameCache::allocate( size );
+      }
+
+      /*!\brief Releases the frame of the coroutine.
+      //
+      // \param frame The frame of the coroutine.
+      // \param size The size of the frame in bytes.
+      // \return void
+      */
+      static inline void operator delete( void* frame, size_t size ) noexcept {
+         FrameCache::deallocate( frame, size );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      std::exception_ptr exception_;  //!< The exception thrown by the task.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef std::coroutine_handle<promise_type>  Handle;  //!< Handle to the coroutine.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline Coroutine( Coroutine&& coroutine ) noexcept;
+   Coroutine( const Coroutine& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~Coroutine();
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline Coroutine& operator=( Coroutine&& coroutine ) noexcept;
+   Coroutine& operator=( const Coroutine& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool               isDone   () const;
+   inline Resumer            resumer  () const;
+   inline std::exception_ptr exception() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline Coroutine( Handle handle );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Handle handle_;  //!< The handle to the coroutine.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the Coroutine class.
+//
+// \param handle The handle to the coroutine.
+*/
+inline Coroutine::Coroutine( Handle handle )
+   : handle_( handle )  // The handle to the coroutine
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for the Coroutine class.
+//
+// \param coroutine The coroutine to be moved into this instance.
+*/
+inline Coroutine::Coroutine( Coroutine&& coroutine ) noexcept
+   : handle_( coroutine.handle_ )  // The handle to the coroutine
+{
+   coroutine.handle_ = nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The destructor for the Coroutine class.
+//
+// The destructor destroys the frame of the coroutine.
+*/
+inline Coroutine::~Coroutine()
+{
+   if( handle_ )
+      handle_.destroy();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for the Coroutine class.
+//
+// \param coroutine The coroutine to be moved into this instance.
+// \return Reference to the assigned coroutine.
+*/
+inline Coroutine& Coroutine::operator=( Coroutine&& coroutine ) noexcept
+{
+   if( this != &coroutine ) {
+      if( handle_ )
+         handle_.destroy();
+      handle_ = coroutine.handle_;
+      coroutine.handle_ = nullptr;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the task has been executed.
+//
+// \return \a true in case the task has been executed, \a false if not.
+*/
+inline bool Coroutine::isDone() const
+{
+   return handle_.done();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a functor that executes the task.
+//
+// \return Functor for the execution of the task.
+//
+// The returned functor must be called exactly once.
+*/
+inline Resumer Coroutine::resumer() const
+{
+   return Resumer( handle_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the exception thrown by the task.
+//
+// \return The exception thrown by the task, or a null pointer in case no exception was thrown.
+*/
+inline std::exception_ptr Coroutine::exception() const
+{
+   return handle_.promise().exception_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COROUTINE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a coroutine-based task executing the given function/functor.
+// \ingroup threads
+//
+// \param func The given function/functor.
+// \return The suspended coroutine executing the function/functor.
+//
+// This function stores a copy of the given function/functor in the frame of a new coroutine,
+// which is executed as soon as the coroutine is resumed (see the Coroutine class). The given
+// function/functor must be copyable, must be callable without arguments and must return void.
+*/
+template< typename Callable >  // Type of the function/functor
+Coroutine spawn( Callable func )
+{
+   func();
+   co_return;
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
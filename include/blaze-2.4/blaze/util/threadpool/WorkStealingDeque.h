@@ -0,0 +1,388 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/WorkStealingDeque.h
+//  \brief Lock-free work-stealing deque for the work-stealing thread pool
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_UTIL_THREADPOOL_WORKSTEALINGDEQUE_H_
+#define _BLAZE_UTIL_THREADPOOL_WORKSTEALINGDEQUE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstddef>
+#include <vector>
+#include <boost/atomic.hpp>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/threadpool/Task.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Lock-free work-stealing deque for the work-stealing thread pool.
+// \ingroup threads
+//
+// The WorkStealingDeque class represents the task container of a single worker of a work-stealing
+// thread pool. It implements the dynamic circular deque by Chase and Lev with the memory orderings
+// given by Le, Pop, Cohen, and Zappa Nardelli ("Correct and Efficient Work-Stealing for Weak
+// Memory Models", PPoPP 2013). The owner of the deque pushes and pops tasks at the bottom end
+// (LIFO), whereas any other thread can concurrently steal tasks from the top end (FIFO). Neither
+// operation requires a lock: the owner only synchronizes with the thieves when the deque holds
+// a single task, and thieves compete for a task via a single compare-and-swap operation.
+//
+// Only a single thread at a time is allowed to call the push() and pop() functions; calls by
+// different threads have to be ordered by other means (e.g. a mutex). The steal() function can
+// be called by any number of threads at any time. The deque stores pointers to dynamically
+// allocated tasks and takes ownership of them until they are popped or stolen. If necessary,
+// the capacity of the deque is doubled by push(); the replaced buffers are kept until the deque
+// is destroyed since thieves might still be reading from them.
+*/
+class WorkStealingDeque : private NonCopyable
+{
+ private:
+   //**Buffer class definition*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Circular buffer of task pointers.
+   */
+   struct Buffer : private NonCopyable
+   {
+    public:
+      //**Constructor******************************************************************************
+      explicit inline Buffer( size_t capacity )
+         : mask_ ( capacity - 1UL )                      // Bit mask for the buffer index
+         , tasks_( new boost::atomic<Task*>[capacity] )  // The circular array of tasks
+      {
+         BLAZE_INTERNAL_ASSERT( ( capacity & mask_ ) == 0UL, "Invalid buffer capacity detected" );
+      }
+      //*******************************************************************************************
+
+      //**Destructor*******************************************************************************
+      inline ~Buffer() {
+         delete [] tasks_;
+      }
+      //*******************************************************************************************
+
+      //**Capacity function************************************************************************
+      inline ptrdiff_t capacity() const {
+         return static_cast<ptrdiff_t>( mask_ + 1UL );
+      }
+      //*******************************************************************************************
+
+      //**Get function*****************************************************************************
+      inline Task* get( ptrdiff_t index ) const {
+         return tasks_[index & mask_].load( boost::memory_order_relaxed );
+      }
+      //*******************************************************************************************
+
+      //**Put function*****************************************************************************
+      inline void put( ptrdiff_t index, Task* task ) {
+         tasks_[index & mask_].store( task, boost::memory_order_relaxed );
+      }
+      //*******************************************************************************************
+
+      //**Grow function****************************************************************************
+      inline Buffer* grow( ptrdiff_t top, ptrdiff_t bottom ) const {
+         Buffer* buffer( new Buffer( 2UL*( mask_ + 1UL ) ) );
+         for( ptrdiff_t i=top; i<bottom; ++i )
+            buffer->put( i, get( i ) );
+         return buffer;
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      const size_t mask_;            //!< Bit mask for the buffer index.
+      boost::atomic<Task*>* tasks_;  //!< The circular array of tasks.
+      //*******************************************************************************************
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef std::vector<Buffer*>  Buffers;  //!< Container for the replaced buffers.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline WorkStealingDeque( size_t capacity=64UL );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~WorkStealingDeque();
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline size_t size()    const;
+   inline bool   isEmpty() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Element functions***************************************************************************
+   /*!\name Element functions */
+   //@{
+   inline void  push ( Task* task );
+   inline Task* pop  ();
+   inline Task* steal();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   boost::atomic<ptrdiff_t> top_;      //!< Index of the top end of the deque.
+                                       /*!< The top end is modified by the thieves and by
+                                            the owner in case of a single remaining task. */
+   char padding_[64];                  //!< Padding to place the ends in separate cache lines.
+   boost::atomic<ptrdiff_t> bottom_;   //!< Index of the bottom end of the deque.
+                                       /*!< The bottom end is modified by the owner only. */
+   boost::atomic<Buffer*>   buffer_;   //!< The current circular buffer.
+   Buffers                  retired_;  //!< The buffers replaced by a larger buffer.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for WorkStealingDeque.
+//
+// \param capacity The initial capacity of the deque; must be a power of two.
+*/
+inline WorkStealingDeque::WorkStealingDeque( size_t capacity )
+   : top_    ( 0 )                       // Index of the top end of the deque
+   , padding_()                          // Padding to place the ends in separate cache lines
+   , bottom_ ( 0 )                       // Index of the bottom end of the deque
+   , buffer_ ( new Buffer( capacity ) )  // The current circular buffer
+   , retired_()                          // The buffers replaced by a larger buffer
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the WorkStealingDeque class.
+//
+// The destructor destroys any remaining task in the deque.
+*/
+inline WorkStealingDeque::~WorkStealingDeque()
+{
+   while( Task* task = pop() )
+      delete task;
+
+   delete buffer_.load( boost::memory_order_relaxed );
+
+   for( Buffers::iterator buffer=retired_.begin(); buffer!=retired_.end(); ++buffer )
+      delete *buffer;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of tasks in the deque.
+//
+// \return The number of tasks in the deque.
+//
+// In case the deque is concurrently modified by other threads, the returned value is only a
+// snapshot of the deque's size.
+*/
+inline size_t WorkStealingDeque::size() const
+{
+   const ptrdiff_t bottom( bottom_.load( boost::memory_order_acquire ) );
+   const ptrdiff_t top   ( top_.load( boost::memory_order_acquire ) );
+   return ( bottom > top )?( static_cast<size_t>( bottom - top ) ):( 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the deque is empty.
+//
+// \return \a true in case the deque is empty, \a false if not.
+*/
+inline bool WorkStealingDeque::isEmpty() const
+{
+   return size() == 0UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ELEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Adding a task to the bottom end of the deque.
+//
+// \param task The dynamically allocated task to be added.
+// \return void
+//
+// This function must only be called by the owner of the deque.
+*/
+inline void WorkStealingDeque::push( Task* task )
+{
+   BLAZE_INTERNAL_ASSERT( task != NULL, "Invalid task detected" );
+
+   const ptrdiff_t bottom( bottom_.load( boost::memory_order_relaxed ) );
+   const ptrdiff_t top   ( top_.load( boost::memory_order_acquire ) );
+   Buffer* buffer( buffer_.load( boost::memory_order_relaxed ) );
+
+   if( bottom - top > buffer->capacity() - 1 ) {
+      retired_.push_back( buffer );
+      buffer = buffer->grow( top, bottom );
+      buffer_.store( buffer, boost::memory_order_release );
+   }
+
+   buffer->put( bottom, task );
+   boost::atomic_thread_fence( boost::memory_order_release );
+   bottom_.store( bottom+1, boost::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing the task at the bottom end of the deque.
+//
+// \return The most recently added task, or \c NULL in case the deque is empty.
+//
+// This function must only be called by the owner of the deque. The ownership of the returned
+// task is transferred to the caller.
+*/
+inline Task* WorkStealingDeque::pop()
+{
+   const ptrdiff_t bottom( bottom_.load( boost::memory_order_relaxed ) - 1 );
+   Buffer* buffer( buffer_.load( boost::memory_order_relaxed ) );
+   bottom_.store( bottom, boost::memory_order_relaxed );
+   boost::atomic_thread_fence( boost::memory_order_seq_cst );
+   ptrdiff_t top( top_.load( boost::memory_order_relaxed ) );
+
+   if( top > bottom ) {
+      bottom_.store( bottom+1, boost::memory_order_relaxed );
+      return NULL;
+   }
+
+   Task* task( buffer->get( bottom ) );
+
+   if( top == bottom ) {
+      if( !top_.compare_exchange_strong( top, top+1, boost::memory_order_seq_cst
+                                                   , boost::memory_order_relaxed ) )
+         task = NULL;
+      bottom_.store( bottom+1, boost::memory_order_relaxed );
+   }
+
+   return task;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing the task at the top end of the deque.
+//
+// \return The least recently added task, or \c NULL in case no task could be stolen.
+//
+// This function can be called by any thread. It returns \c NULL in case the deque is empty or
+// in case the task at the top end was concurrently removed by another thread. The ownership of
+// the returned task is transferred to the caller.
+*/
+inline Task* WorkStealingDeque::steal()
+{
+   ptrdiff_t top( top_.load( boost::memory_order_acquire ) );
+   boost::atomic_thread_fence( boost::memory_order_seq_cst );
+   const ptrdiff_t bottom( bottom_.load( boost::memory_order_acquire ) );
+
+   if( top >= bottom )
+      return NULL;
+
+   const Buffer* buffer( buffer_.load( boost::memory_order_acquire ) );
+   Task* task( buffer->get( top ) );
+
+   if( !top_.compare_exchange_strong( top, top+1, boost::memory_order_seq_cst
+                                                , boost::memory_order_relaxed ) )
+      return NULL;
+
+   return task;
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
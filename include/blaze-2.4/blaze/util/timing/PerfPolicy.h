@@ -0,0 +1,414 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/timing/PerfPolicy.h
+//  \brief Hardware performance counter timing policy for the Timer class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_TIMING_PERFPOLICY_H_
+#define _BLAZE_UTIL_TIMING_PERFPOLICY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(__linux__)
+#  include <cstring>
+#  include <linux/perf_event.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#  if defined(__i386__) || defined(__x86_64__)
+#    include <cpuid.h>
+#  endif
+#endif
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Time.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+namespace timing {
+
+//=================================================================================================
+//
+//  PERFORMANCE EVENTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Hardware events counted by the PerfPolicy.
+// \ingroup timing
+*/
+enum PerfEvent
+{
+   perfCycles       = 0,  //!< Elapsed CPU cycles.
+   perfInstructions = 1,  //!< Retired instructions.
+   perfL1dLoads     = 2,  //!< Loads from the level 1 data cache.
+   perfL1dMisses    = 3,  //!< Loads missing the level 1 data cache.
+   perfLlcRefs      = 4,  //!< References to the last level cache.
+   perfLlcMisses    = 5,  //!< References missing the last level cache.
+   perfFlops        = 6,  //!< Retired floating point operations.
+   perfEvents       = 7   //!< Total number of performance events.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Timing policy for the measurement of hardware performance counters.
+// \ingroup timing
+//
+// The PerfPolicy class represents the timing policy for hardware performance counter measurements.
+// Its timestamps are wall clock timestamps, such that it can be used in combination with the
+// Timer class template, but it additionally provides access to the counters of the events listed
+// in the PerfEvent enumeration. The combination of both is realized with the PerfTimer class.
+//
+// The counters are read via the Linux \c perf_event_open() system call. They are opened on first
+// use and count the user space events of the calling thread and of all threads it creates
+// afterwards (i.e. the threads of an SMP backend are only included if they are started after
+// the first use). The number of floating point operations is only available on Intel CPUs since
+// the Broadwell architecture, where it is computed from the FP_ARITH_INST_RETIRED events. In
+// case the operating system, the CPU, or the \c perf_event_paranoid setting does not permit
+// counting an event, isAvailable() returns \a false for the event and its count is zero.
+*/
+struct PerfPolicy
+{
+ public:
+   //**Timing functions****************************************************************************
+   /*!\name Timing functions */
+   //@{
+   static inline double getTimestamp();
+   //@}
+   //**********************************************************************************************
+
+   //**Counter functions***************************************************************************
+   /*!\name Counter functions */
+   //@{
+   static inline bool isAvailable( PerfEvent event );
+   static inline void getCounts( double* counts );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Counters class definition*******************************************************************
+   /*!\brief File descriptors of the performance counters of the process.
+   */
+   class Counters : private NonCopyable
+   {
+    public:
+      //**Constructor******************************************************************************
+      explicit inline Counters();
+      //*******************************************************************************************
+
+      //**Destructor*******************************************************************************
+      inline ~Counters();
+      //*******************************************************************************************
+
+      //**Utility functions************************************************************************
+      inline bool isAvailable( PerfEvent event ) const;
+      inline void read( double* counts ) const;
+      //*******************************************************************************************
+
+    private:
+      //**Utility functions************************************************************************
+      static inline int    open( uint32_t type, uint64_t config );
+      static inline double read( int fd );
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      enum { flopEvents = 5 };
+
+      int fd_[perfFlops];        //!< The counters of all events except perfFlops.
+      int flops_[flopEvents];    //!< The counters of the floating point operation events.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   static inline const Counters& counters();
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TIMING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns a timestamp of the current wall clock time in seconds.
+//
+// \return Wall clock timestamp in seconds.
+*/
+inline double PerfPolicy::getTimestamp()
+{
+   return getWcTime();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COUNTER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the given event can be counted.
+//
+// \param event The performance event.
+// \return \a true if the event can be counted, \a false if not.
+*/
+inline bool PerfPolicy::isAvailable( PerfEvent event )
+{
+   return counters().isAvailable( event );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current counts of all performance events.
+//
+// \param counts Array of size \a perfEvents for the counts, indexed by the PerfEvent values.
+// \return void
+//
+// The counts are extrapolated in case the kernel multiplexes the counters, i.e. in case more
+// events are counted than the CPU has counter registers. Unavailable events are set to zero.
+*/
+inline void PerfPolicy::getCounts( double* counts )
+{
+   counters().read( counts );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the performance counters of the process.
+//
+// \return Reference to the performance counters.
+*/
+inline const PerfPolicy::Counters& PerfPolicy::counters()
+{
+   static const Counters instance;
+   return instance;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COUNTERS CLASS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Opens the counters of all performance events.
+*/
+inline PerfPolicy::Counters::Counters()
+{
+   for( int i=0; i<perfFlops; ++i )
+      fd_[i] = -1;
+   for( int i=0; i<flopEvents; ++i )
+      flops_[i] = -1;
+
+#if defined(__linux__)
+   const uint64_t l1dRead( PERF_COUNT_HW_CACHE_L1D | ( PERF_COUNT_HW_CACHE_OP_READ << 8 ) );
+
+   fd_[perfCycles      ] = open( PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES );
+   fd_[perfInstructions] = open( PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS );
+   fd_[perfL1dLoads    ] = open( PERF_TYPE_HW_CACHE, l1dRead | ( PERF_COUNT_HW_CACHE_RESULT_ACCESS << 16 ) );
+   fd_[perfL1dMisses   ] = open( PERF_TYPE_HW_CACHE, l1dRead | ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16 ) );
+   fd_[perfLlcRefs     ] = open( PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES );
+   fd_[perfLlcMisses   ] = open( PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES );
+
+#  if defined(__i386__) || defined(__x86_64__)
+   unsigned int eax( 0U ), ebx( 0U ), ecx( 0U ), edx( 0U );
+   const bool intel( __get_cpuid( 0U, &eax, &ebx, &ecx, &edx ) &&
+                     ebx == 0x756e6547U && edx == 0x49656e69U && ecx == 0x6c65746eU );
+
+   if( intel )
+   {
+      // FP_ARITH_INST_RETIRED (event 0xC7), grouped by the number of operations per instruction:
+      // scalar (1), 128-bit double (2), 128-bit single and 256-bit double (4), 256-bit single
+      // and 512-bit double (8), and 512-bit single precision (16)
+      const uint64_t umasks[flopEvents] = { 0x03, 0x04, 0x18, 0x60, 0x80 };
+
+      for( int i=0; i<flopEvents; ++i ) {
+         flops_[i] = open( PERF_TYPE_RAW, ( umasks[i] << 8 ) | 0xC7 );
+      }
+   }
+#  endif
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Closes the counters of all performance events.
+*/
+inline PerfPolicy::Counters::~Counters()
+{
+#if defined(__linux__)
+   for( int i=0; i<perfFlops; ++i )
+      if( fd_[i] != -1 ) close( fd_[i] );
+   for( int i=0; i<flopEvents; ++i )
+      if( flops_[i] != -1 ) close( flops_[i] );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the given event can be counted.
+//
+// \param event The performance event.
+// \return \a true if the event can be counted, \a false if not.
+*/
+inline bool PerfPolicy::Counters::isAvailable( PerfEvent event ) const
+{
+   if( event == perfFlops ) {
+      for( int i=0; i<flopEvents; ++i )
+         if( flops_[i] == -1 ) return false;
+      return true;
+   }
+
+   return event >= 0 && event < perfFlops && fd_[event] != -1;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads the current counts of all performance events.
+//
+// \param counts Array of size \a perfEvents for the counts.
+// \return void
+*/
+inline void PerfPolicy::Counters::read( double* counts ) const
+{
+   for( int i=0; i<perfFlops; ++i )
+      counts[i] = read( fd_[i] );
+
+   counts[perfFlops] = 0.0;
+
+   if( isAvailable( perfFlops ) ) {
+      for( int i=0; i<flopEvents; ++i )
+         counts[perfFlops] += double( 1 << i ) * read( flops_[i] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Opens a counter for the given event.
+//
+// \param type The type of the event (PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE or PERF_TYPE_RAW).
+// \param config The type specific configuration of the event.
+// \return The file descriptor of the counter, or -1 if the event cannot be counted.
+*/
+inline int PerfPolicy::Counters::open( uint32_t type, uint64_t config )
+{
+#if defined(__linux__)
+   perf_event_attr attr;
+   std::memset( &attr, 0, sizeof( attr ) );
+
+   attr.size           = sizeof( attr );
+   attr.type           = type;
+   attr.config         = config;
+   attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+   attr.inherit        = 1;
+   attr.exclude_kernel = 1;
+   attr.exclude_hv     = 1;
+
+   return static_cast<int>( syscall( __NR_perf_event_open, &attr, 0, -1, -1, 0UL ) );
+#else
+   UNUSED_PARAMETER( type, config );
+   return -1;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads the count of the given counter.
+//
+// \param fd The file descriptor of the counter.
+// \return The count, extrapolated to the total time the counter was enabled.
+*/
+inline double PerfPolicy::Counters::read( int fd )
+{
+#if defined(__linux__)
+   uint64_t values[3];  // Count, time enabled, and time running
+
+   if( fd == -1 || ::read( fd, values, sizeof( values ) ) != sizeof( values ) || values[2] == 0 )
+      return 0.0;
+
+   return double( values[0] ) * ( double( values[1] ) / double( values[2] ) );
+#else
+   UNUSED_PARAMETER( fd );
+   return 0.0;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // timing
+
+} // blaze
+
+#endif
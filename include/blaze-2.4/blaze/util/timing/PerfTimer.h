@@ -0,0 +1,480 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/timing/PerfTimer.h
+//  \brief Progress timer for hardware performance counter measurements
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_TIMING_PERFTIMER_H_
+#define _BLAZE_UTIL_TIMING_PERFTIMER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/timing/PerfPolicy.h>
+#include <blaze/util/timing/Timer.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+namespace timing {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Progress timer for hardware performance counter measurements.
+// \ingroup timing
+//
+// The PerfTimer class combines the Timer class template with the PerfPolicy timing policy. In
+// addition to the wall clock time it accumulates the hardware performance counters of all time
+// measurements (see the PerfEvent enumeration), which allows to judge whether a code fragment is
+// bound by the memory or by the floating point throughput:
+
+   \code
+   PerfTimer timer;
+
+   for( unsigned int i=0; i<10; ++i ) {
+      timer.start();
+      ...  // Programm or code fragment to be measured
+      timer.end();
+   }
+
+   if( timer.isAvailable( perfFlops ) )
+      std::cout << timer.flops() / 1E9 << " GFlop/s at an IPC of " << timer.ipc() << "\n";
+   \endcode
+
+// In case the counting is disabled via the constructor, the PerfTimer does not access the
+// performance counters at all and behaves like a WcTimer.
+*/
+class PerfTimer
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef PerfPolicy  TimingPolicy;  //!< Timing policy of the PerfTimer.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline PerfTimer( bool count = true );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Timing functions****************************************************************************
+   /*!\name Timing functions */
+   //@{
+   inline void start();
+   inline void end  ();
+   inline void reset();
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline size_t getCounter () const;
+   inline bool   isCounting () const;
+   inline bool   isAvailable( PerfEvent event ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Time evaluation functions*******************************************************************
+   /*!\name Time evaluation functions */
+   //@{
+   inline double total()   const;
+   inline double average() const;
+   inline double min()     const;
+   inline double max()     const;
+   inline double last()    const;
+   //@}
+   //**********************************************************************************************
+
+   //**Counter evaluation functions****************************************************************
+   /*!\name Counter evaluation functions */
+   //@{
+   inline double total      ( PerfEvent event ) const;
+   inline double average    ( PerfEvent event ) const;
+   inline double last       ( PerfEvent event ) const;
+   inline double ipc        () const;
+   inline double l1dMissRate() const;
+   inline double llcMissRate() const;
+   inline double flops      () const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   inline double ratio( PerfEvent num, PerfEvent den ) const;
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Timer<PerfPolicy> timer_;  //!< The wall clock timer.
+   bool count_;               //!< Flag for the measurement of the performance counters.
+   double start_[perfEvents]; //!< Counts at the start of the current measurement.
+   double total_[perfEvents]; //!< Total counts of all measurements.
+   double last_ [perfEvents]; //!< Counts of the last measurement.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor of the PerfTimer class.
+//
+// \param count \a true to measure the performance counters, \a false to only measure the time.
+//
+// The creation of a new timer immediately starts a new measurement.
+*/
+inline PerfTimer::PerfTimer( bool count )
+   : timer_()         // The wall clock timer
+   , count_( count )  // Flag for the measurement of the performance counters
+{
+   reset();
+   start();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TIMING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Starting a single measurement.
+//
+// \return void
+*/
+inline void PerfTimer::start()
+{
+   if( count_ )
+      PerfPolicy::getCounts( start_ );
+
+   timer_.start();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Ending a single measurement.
+//
+// \return void
+//
+// This function ends the currently running measurement and accumulates the elapsed time and
+// the counts of all performance events.
+*/
+inline void PerfTimer::end()
+{
+   timer_.end();
+
+   if( count_ ) {
+      double counts[perfEvents];
+      PerfPolicy::getCounts( counts );
+
+      for( int i=0; i<perfEvents; ++i ) {
+         last_ [i]  = counts[i] - start_[i];
+         total_[i] += last_[i];
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the timer.
+//
+// \return void
+//
+// This function completely resets the timer and all information on the performed measurements.
+// In order to start a new measurement, the start() function has to be used.
+*/
+inline void PerfTimer::reset()
+{
+   timer_.reset();
+
+   for( int i=0; i<perfEvents; ++i ) {
+      start_[i] = 0.0;
+      total_[i] = 0.0;
+      last_ [i] = 0.0;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the total number of measurements performed by this timer.
+//
+// \return The number of performed measurements.
+*/
+inline size_t PerfTimer::getCounter() const
+{
+   return timer_.getCounter();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the timer measures the performance counters.
+//
+// \return \a true if the performance counters are measured, \a false if not.
+*/
+inline bool PerfTimer::isCounting() const
+{
+   return count_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given event is measured by this timer.
+//
+// \param event The performance event.
+// \return \a true if the event is measured, \a false if not.
+*/
+inline bool PerfTimer::isAvailable( PerfEvent event ) const
+{
+   return count_ && PerfPolicy::isAvailable( event );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TIME EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the total elapsed time of all performed measurements.
+//
+// \return The total elapsed time of all measurements.
+*/
+inline double PerfTimer::total() const
+{
+   return timer_.total();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the average time of all performed measurements.
+//
+// \return The average time.
+*/
+inline double PerfTimer::average() const
+{
+   return timer_.average();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the minimal time of all performed measurements.
+//
+// \return The minimal time.
+*/
+inline double PerfTimer::min() const
+{
+   return timer_.min();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximal time of all performed measurements.
+//
+// \return The maximal time.
+*/
+inline double PerfTimer::max() const
+{
+   return timer_.max();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the last measured time.
+//
+// \return The last measured time.
+*/
+inline double PerfTimer::last() const
+{
+   return timer_.last();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COUNTER EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the total count of the given event over all performed measurements.
+//
+// \param event The performance event.
+// \return The total count of the event.
+*/
+inline double PerfTimer::total( PerfEvent event ) const
+{
+   return total_[event];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the average count of the given event over all performed measurements.
+//
+// \param event The performance event.
+// \return The average count of the event.
+*/
+inline double PerfTimer::average( PerfEvent event ) const
+{
+   return getCounter() > 0UL ? total_[event] / getCounter() : 0.0;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the count of the given event in the last measurement.
+//
+// \param event The performance event.
+// \return The count of the event in the last measurement.
+*/
+inline double PerfTimer::last( PerfEvent event ) const
+{
+   return last_[event];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of instructions per cycle of all performed measurements.
+//
+// \return The number of instructions per cycle.
+*/
+inline double PerfTimer::ipc() const
+{
+   return ratio( perfInstructions, perfCycles );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the fraction of loads missing the level 1 data cache.
+//
+// \return The level 1 data cache miss rate in the range \f$ [0..1] \f$.
+*/
+inline double PerfTimer::l1dMissRate() const
+{
+   return ratio( perfL1dMisses, perfL1dLoads );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the fraction of last level cache references missing the cache.
+//
+// \return The last level cache miss rate in the range \f$ [0..1] \f$.
+*/
+inline double PerfTimer::llcMissRate() const
+{
+   return ratio( perfLlcMisses, perfLlcRefs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the achieved floating point operations per second of all measurements.
+//
+// \return The number of floating point operations per second.
+*/
+inline double PerfTimer::flops() const
+{
+   return total() > 0.0 ? total_[perfFlops] / total() : 0.0;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the ratio of the total counts of two events.
+//
+// \param num The event in the numerator.
+// \param den The event in the denominator.
+// \return The ratio of the counts, or 0 if the denominator is zero.
+*/
+inline double PerfTimer::ratio( PerfEvent num, PerfEvent den ) const
+{
+   return total_[den] > 0.0 ? total_[num] / total_[den] : 0.0;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // timing
+
+} // blaze
+
+#endif
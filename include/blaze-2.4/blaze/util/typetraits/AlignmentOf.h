@@ -59,18 +59,20 @@ namespace blaze {
 // \ingroup type_traits
 //
 // The AlignmentOf type trait template evaluates the required alignment for the given data type.
-// For instance, for fundamental data types that can be vectorized via SSE or AVX instructions,
-// the proper alignment is 16 or 32 bytes, respectively. For all other data types, a multiple
-// of the alignment chosen by the compiler is returned. The evaluated alignment can be queried
-// via the nested \a value member.
+// For instance, for fundamental data types that can be vectorized via SSE, AVX, or AVX-512
+// instructions, the proper alignment is 16, 32, or 64 bytes, respectively. For all other data
+// types, a multiple of the alignment chosen by the compiler is returned. The evaluated alignment
+// can be queried via the nested \a value member.
 
    \code
-   AlignmentOf<unsigned int>::value  // Evaluates to 32 if AVX2 is available, to 16 if only
-                                     // SSE2 is available, and a multiple of the alignment
-                                     // chosen by the compiler otherwise.
-   AlignmentOf<double>::value        // Evaluates to 32 if AVX is available, to 16 if only
-                                     // SSE is available, and a multiple of the alignment
-                                     // chosen by the compiler otherwise.
+   AlignmentOf<unsigned int>::value  // Evaluates to 64 if AVX-512F is available, to 32 if
+                                     // AVX2 is available, to 16 if only SSE2 is available,
+                                     // and a multiple of the alignment chosen by the compiler
+                                     // otherwise.
+   AlignmentOf<double>::value        // Evaluates to 64 if AVX-512F is available, to 32 if
+                                     // AVX is available, to 16 if only SSE is available, and
+                                     // a multiple of the alignment chosen by the compiler
+                                     // otherwise.
    \endcode
 */
 template< typename T >
@@ -79,7 +81,7 @@ struct AlignmentOf
  public:
    //**Member enumerations*************************************************************************
    /*! \cond BLAZE_INTERNAL */
-#if BLAZE_MIC_MODE
+#if BLAZE_MIC_MODE || BLAZE_AVX512F_MODE
    enum { value = ( IsVectorizable<T>::value )?( 64UL ):( boost::alignment_of<T>::value ) };
 #elif BLAZE_AVX2_MODE
    enum { value = ( IsVectorizable<T>::value )?( 32UL ):( boost::alignment_of<T>::value ) };
@@ -104,7 +106,7 @@ struct AlignmentOf<float>
 {
  public:
    //**Member enumerations*************************************************************************
-#if BLAZE_MIC_MODE
+#if BLAZE_MIC_MODE || BLAZE_AVX512F_MODE
    enum { value = 64UL };
 #elif BLAZE_AVX_MODE
    enum { value = 32UL };
@@ -129,7 +131,7 @@ struct AlignmentOf<double>
 {
  public:
    //**Member enumerations*************************************************************************
-#if BLAZE_MIC_MODE
+#if BLAZE_MIC_MODE || BLAZE_AVX512F_MODE
    enum { value = 64UL };
 #elif BLAZE_AVX_MODE
    enum { value = 32UL };
@@ -154,7 +156,7 @@ struct AlignmentOf< complex<float> >
 {
  public:
    //**Member enumerations*************************************************************************
-#if BLAZE_MIC_MODE
+#if BLAZE_MIC_MODE || BLAZE_AVX512F_MODE
    enum { value = 64UL };
 #elif BLAZE_AVX_MODE
    enum { value = 32UL };
@@ -179,7 +181,7 @@ struct AlignmentOf< complex<double> >
 {
  public:
    //**Member enumerations*************************************************************************
-#if BLAZE_MIC_MODE
+#if BLAZE_MIC_MODE || BLAZE_AVX512F_MODE
    enum { value = 64UL };
 #elif BLAZE_AVX_MODE
    enum { value = 32UL };
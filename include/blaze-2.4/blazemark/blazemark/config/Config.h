@@ -66,6 +66,19 @@ const double deviation( 5.0 );  //!< Maximum allowed deviation of the average be
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Output of hardware performance counters.
+//
+// This flag value specifies whether the Blaze kernels measure and print the hardware performance
+// counters of their measurements, i.e. the instructions per cycle, the L1 data cache and last
+// level cache miss rates, and the achieved floating point throughput. The output can also be
+// activated via the \a -counters command line option. The counters are read via the Linux
+// \c perf_event_open() system call; unavailable counters are printed as "n/a".
+*/
+const bool counters( false );
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Element type for all benchmarks.
 //
@@ -44,6 +44,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Counters.h>
 
 
 namespace blazemark {
@@ -223,6 +224,8 @@ inline Benchmarks::Benchmarks()
 //   - \a -eigen: Activates the Eigen kernels.
 //   - \a -no-eigen: Deactivates the Eigen kernels.
 //   - \a -only-eigen: Activates the Eigen kernels and deactivates all other.
+//   - \a -counters: Activates the output of hardware performance counters (see useCounters()).
+//   - \a -no-counters: Deactivates the output of hardware performance counters.
 //
 // In case an unknown command line option is encountered, a \a std::invalid_argument exception
 // is thrown.
@@ -440,6 +443,12 @@ inline void parseCommandLineArguments( int argc, char** argv, Benchmarks& benchm
          benchmarks.runMTL       = false;
          benchmarks.runEigen     = true;
       }
+      else if( std::strcmp( argv[i], "-counters" ) == 0 ) {
+         useCounters() = true;
+      }
+      else if( std::strcmp( argv[i], "-no-counters" ) == 0 ) {
+         useCounters() = false;
+      }
       else {
          std::ostringstream oss;
          oss << " Unknown command line argument: '" << argv[i] << "'";
@@ -0,0 +1,125 @@
+//=================================================================================================
+/*!
+//  \file blazemark/util/Counters.h
+//  \brief Header file for the output of hardware performance counters
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZEMARK_UTIL_COUNTERS_H_
+#define _BLAZEMARK_UTIL_COUNTERS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iomanip>
+#include <iostream>
+#include <blaze/util/timing/PerfTimer.h>
+#include <blazemark/system/Config.h>
+
+
+namespace blazemark {
+
+//=================================================================================================
+//
+//  HARDWARE PERFORMANCE COUNTER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the flag for the output of hardware performance counters.
+//
+// \return Reference to the flag.
+//
+// The flag is initialized with the \a counters configuration value and can be changed via the
+// \a -counters and \a -no-counters command line options. In case the flag is set to \a true,
+// the Blaze kernels measure the hardware performance counters and print them via the
+// printCounters() function.
+*/
+inline bool& useCounters()
+{
+   static bool flag( counters );
+   return flag;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Prints the hardware performance counters of the measurements of a benchmark kernel.
+//
+// \param timer The timer of the benchmark kernel.
+// \return void
+//
+// This function prints the instructions per cycle, the L1 data cache and the last level cache
+// miss rates and the achieved floating point throughput of all measurements of the given timer.
+// Events that could not be counted are printed as "n/a". In case the timer does not measure the
+// performance counters, the function has no effect.
+*/
+inline void printCounters( const ::blaze::timing::PerfTimer& timer )
+{
+   using namespace ::blaze::timing;
+
+   if( !timer.isCounting() )
+      return;
+
+   const std::ios::fmtflags flags( std::cout.flags() );
+   const std::streamsize precision( std::cout.precision() );
+
+   std::cout << std::fixed << std::setprecision(2) << "       IPC: ";
+   if( timer.isAvailable( perfInstructions ) && timer.isAvailable( perfCycles ) )
+      std::cout << timer.ipc();
+   else std::cout << "n/a";
+
+   std::cout << std::setprecision(1) << ", L1D miss: ";
+   if( timer.isAvailable( perfL1dMisses ) && timer.isAvailable( perfL1dLoads ) )
+      std::cout << 100.0 * timer.l1dMissRate() << "%";
+   else std::cout << "n/a";
+
+   std::cout << ", LLC miss: ";
+   if( timer.isAvailable( perfLlcMisses ) && timer.isAvailable( perfLlcRefs ) )
+      std::cout << 100.0 * timer.llcMissRate() << "%";
+   else std::cout << "n/a";
+
+   std::cout << ", MFlop/s: ";
+   if( timer.isAvailable( perfFlops ) )
+      std::cout << timer.flops() / 1E6;
+   else std::cout << "n/a";
+
+   std::cout << "\n";
+
+   std::cout.flags( flags );
+   std::cout.precision( precision );
+}
+//*************************************************************************************************
+
+} // namespace blazemark
+
+#endif
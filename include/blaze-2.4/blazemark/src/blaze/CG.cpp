@@ -45,6 +45,7 @@
 #include <blazemark/blaze/CG.h>
 #include <blazemark/blaze/init/DynamicVector.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Counters.h>
 
 
 namespace blazemark {
@@ -89,7 +90,7 @@ double cg( size_t N, size_t steps, size_t iterations )
    ::blaze::CompressedMatrix<element_t,rowMajor> A( NN, NN, nnz );
    ::blaze::DynamicVector<element_t,columnVector> x( NN ), b( NN ), r( NN ), d( NN ), h( NN ), start( NN );
    element_t alpha, beta, delta;
-   ::blaze::timing::WcTimer timer;
+   ::blaze::timing::PerfTimer timer( useCounters() );
 
    for( size_t i=0UL; i<N; ++i ) {
       for( size_t j=0UL; j<N; ++j ) {
@@ -140,6 +141,8 @@ double cg( size_t N, size_t steps, size_t iterations )
    if( minTime * ( 1.0 + deviation*0.01 ) < avgTime )
       std::cerr << " Blaze kernel 'cg': Time deviation too large!!!\n";
 
+   printCounters( timer );
+
    return minTime;
 }
 //*************************************************************************************************
@@ -45,6 +45,7 @@
 #include <blazemark/blaze/init/DynamicMatrix.h>
 #include <blazemark/blaze/init/DynamicVector.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Counters.h>
 
 
 namespace blazemark {
@@ -77,7 +78,7 @@ double complex4( size_t N, size_t steps )
 
    ::blaze::DynamicMatrix<element_t,columnMajor> A( N, N );
    ::blaze::DynamicVector<element_t,columnVector> a( N ), b( N );
-   ::blaze::timing::WcTimer timer;
+   ::blaze::timing::PerfTimer timer( useCounters() );
 
    init( A );
    init( a );
@@ -105,6 +106,8 @@ double complex4( size_t N, size_t steps )
    if( minTime * ( 1.0 + deviation*0.01 ) < avgTime )
       std::cerr << " Blaze kernel 'complex4': Time deviation too large!!!\n";
 
+   printCounters( timer );
+
    return minTime;
 }
 //*************************************************************************************************
@@ -43,6 +43,7 @@
 #include <blazemark/blaze/DVecNorm.h>
 #include <blazemark/blaze/init/DynamicVector.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Counters.h>
 
 
 namespace blazemark {
@@ -73,7 +74,7 @@ double dvecnorm( size_t N, size_t steps )
 
    ::blaze::DynamicVector<element_t,columnVector> a( N );
    element_t scalar( 0 );
-   ::blaze::timing::WcTimer timer;
+   ::blaze::timing::PerfTimer timer( useCounters() );
 
    init( a );
 
@@ -98,6 +99,8 @@ double dvecnorm( size_t N, size_t steps )
    if( minTime * ( 1.0 + deviation*0.01 ) < avgTime )
       std::cerr << " Blaze kernel 'dvecnorm': Time deviation too large!!!\n";
 
+   printCounters( timer );
+
    return minTime;
 }
 //*************************************************************************************************
@@ -45,6 +45,7 @@
 #include <blazemark/blaze/init/CompressedVector.h>
 #include <blazemark/blaze/init/DynamicVector.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Counters.h>
 
 
 namespace blazemark {
@@ -77,7 +78,7 @@ double dvecsvecadd( size_t N, size_t F, size_t steps )
 
    ::blaze::DynamicVector<element_t,columnVector> a( N ), c( N );
    ::blaze::CompressedVector<element_t,columnVector> b( N );
-   ::blaze::timing::WcTimer timer;
+   ::blaze::timing::PerfTimer timer( useCounters() );
 
    init( a );
    init( b, F );
@@ -105,6 +106,8 @@ double dvecsvecadd( size_t N, size_t F, size_t steps )
    if( minTime * ( 1.0 + deviation*0.01 ) < avgTime )
       std::cerr << " Blaze kernel 'dvecsvecadd': Time deviation too large!!!\n";
 
+   printCounters( timer );
+
    return minTime;
 }
 //*************************************************************************************************
@@ -47,6 +47,7 @@
 #include <blazemark/blaze/init/CompressedVector.h>
 #include <blazemark/blaze/init/StaticVector.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Counters.h>
 
 
 namespace blazemark {
@@ -82,7 +83,7 @@ double dvecsveccross( size_t N, size_t F, size_t steps )
 
    ::std::vector< VectorType, AllocatorType > a( N ), c( N );
    ::std::vector< ::blaze::CompressedVector<element_t,columnVector> > b( N );
-   ::blaze::timing::WcTimer timer;
+   ::blaze::timing::PerfTimer timer( useCounters() );
 
    for( size_t i=0UL; i<N; ++i ) {
       b[i].resize( 3UL );
@@ -117,6 +118,8 @@ double dvecsveccross( size_t N, size_t F, size_t steps )
    if( minTime * ( 1.0 + deviation*0.01 ) < avgTime )
       std::cerr << " Blaze kernel 'dvecsveccross': Time deviation too large!!!\n";
 
+   printCounters( timer );
+
    return minTime;
 }
 //*************************************************************************************************
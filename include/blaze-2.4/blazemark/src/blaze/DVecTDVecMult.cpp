@@ -44,6 +44,7 @@
 #include <blazemark/blaze/DVecTDVecMult.h>
 #include <blazemark/blaze/init/DynamicVector.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Counters.h>
 
 
 namespace blazemark {
@@ -78,7 +79,7 @@ double dvectdvecmult( size_t N, size_t steps )
    ::blaze::DynamicVector<element_t,columnVector> a( N );
    ::blaze::DynamicVector<element_t,rowVector> b( N );
    ::blaze::DynamicMatrix<element_t,rowMajor> A( N, N );
-   ::blaze::timing::WcTimer timer;
+   ::blaze::timing::PerfTimer timer( useCounters() );
 
    init( a );
    init( b );
@@ -106,6 +107,8 @@ double dvectdvecmult( size_t N, size_t steps )
    if( minTime * ( 1.0 + deviation*0.01 ) < avgTime )
       std::cerr << " Blaze kernel 'dvectdvecmult': Time deviation too large!!!\n";
 
+   printCounters( timer );
+
    return minTime;
 }
 //*************************************************************************************************
@@ -45,6 +45,7 @@
 #include <blazemark/blaze/init/StaticMatrix.h>
 #include <blazemark/blaze/Mat3TMat3Mult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Counters.h>
 
 
 namespace blazemark {
@@ -82,7 +83,7 @@ double mat3tmat3mult( size_t N, size_t steps )
 
    ::std::vector< RowMajorMatrixType, RowMajorAllocatorType > A( N ), C( N );
    ::std::vector< ColumnMajorMatrixType, ColumnMajorAllocatorType > B( N );
-   ::blaze::timing::WcTimer timer;
+   ::blaze::timing::PerfTimer timer( useCounters() );
 
    for( size_t i=0UL; i<N; ++i ) {
       init( A[i] );
@@ -116,6 +117,8 @@ double mat3tmat3mult( size_t N, size_t steps )
    if( minTime * ( 1.0 + deviation*0.01 ) < avgTime )
       std::cerr << " Blaze kernel 'mat3tmat3mult': Time deviation too large!!!\n";
 
+   printCounters( timer );
+
    return minTime;
 }
 //*************************************************************************************************
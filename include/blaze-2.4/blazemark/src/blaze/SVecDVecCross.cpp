@@ -47,6 +47,7 @@
 #include <blazemark/blaze/init/CompressedVector.h>
 #include <blazemark/blaze/init/StaticVector.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Counters.h>
 
 
 namespace blazemark {
@@ -82,7 +83,7 @@ double svecdveccross( size_t N, size_t F, size_t steps )
 
    ::std::vector< ::blaze::CompressedVector<element_t,columnVector> > a( N );
    ::std::vector< VectorType, AllocatorType > b( N ), c( N );
-   ::blaze::timing::WcTimer timer;
+   ::blaze::timing::PerfTimer timer( useCounters() );
 
    for( size_t i=0UL; i<N; ++i ) {
       a[i].resize( 3UL );
@@ -117,6 +118,8 @@ double svecdveccross( size_t N, size_t F, size_t steps )
    if( minTime * ( 1.0 + deviation*0.01 ) < avgTime )
       std::cerr << " Blaze kernel 'svecdveccross': Time deviation too large!!!\n";
 
+   printCounters( timer );
+
    return minTime;
 }
 //*************************************************************************************************
@@ -43,6 +43,7 @@
 #include <blazemark/blaze/init/DynamicVector.h>
 #include <blazemark/blaze/TDVecDVecMult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Counters.h>
 
 
 namespace blazemark {
@@ -76,7 +77,7 @@ double tdvecdvecmult( size_t N, size_t steps )
    ::blaze::DynamicVector<element_t,rowVector> a( N );
    ::blaze::DynamicVector<element_t,columnVector> b( N );
    element_t scalar( 0 );
-   ::blaze::timing::WcTimer timer;
+   ::blaze::timing::PerfTimer timer( useCounters() );
 
    init( a );
    init( b );
@@ -102,6 +103,8 @@ double tdvecdvecmult( size_t N, size_t steps )
    if( minTime * ( 1.0 + deviation*0.01 ) < avgTime )
       std::cerr << " Blaze kernel 'tdvecdvecmult': Time deviation too large!!!\n";
 
+   printCounters( timer );
+
    return minTime;
 }
 //*************************************************************************************************
@@ -46,6 +46,7 @@
 #include <blaze/math/constraints/DenseMatrix.h>
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DenseSubmatrix.h>
+#include <blaze/math/intrinsics/IntrinsicTrait.h>
 #include <blazetest/system/Types.h>
 
 
@@ -134,6 +135,17 @@ class AlignedTest
    typedef blaze::DenseSubmatrix<OMT,blaze::unaligned>  UOSMT;  //!< Unaligned dense submatrix type for column-major matrices.
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Granularity of the aligned submatrices of the test.
+   /*! The first column of an aligned row-major submatrix (or the first row of an aligned
+       column-major submatrix) and its number of columns (rows) have to be multiples of the
+       number of integers per intrinsic vector. The test uses blocks of 8 integers, or of a
+       complete intrinsic vector in case it holds more than 8 integers (as for instance for
+       AVX-512). */
+   static const size_t block = ( static_cast<size_t>( blaze::IntrinsicTrait<int>::size ) > 8UL )
+                               ?( static_cast<size_t>( blaze::IntrinsicTrait<int>::size ) ):( 8UL );
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
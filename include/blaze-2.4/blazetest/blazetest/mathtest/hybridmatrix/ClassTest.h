@@ -48,6 +48,7 @@
 #include <blaze/math/constraints/DenseMatrix.h>
 #include <blaze/math/HybridMatrix.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/util/AlignedAllocator.h>
 #include <blaze/util/constraints/SameType.h>
 #include <blaze/util/typetraits/AlignmentOf.h>
 #include <blazetest/system/Types.h>
@@ -292,7 +293,7 @@ void ClassTest::testAlignment( const std::string& type )
    //=====================================================================================
 
    {
-      const boost::container::vector<RowMajorMatrixType> mats( 7UL );
+      const boost::container::vector< RowMajorMatrixType, blaze::AlignedAllocator<RowMajorMatrixType> > mats( 7UL );
 
       for( size_t i=0UL; i<mats.size(); ++i ) {
          for( size_t j=0UL; j<mats[i].rows(); ++j )
@@ -314,7 +315,7 @@ void ClassTest::testAlignment( const std::string& type )
    }
 
    {
-      const boost::container::vector<ColumnMajorMatrixType> mats( 7UL );
+      const boost::container::vector< ColumnMajorMatrixType, blaze::AlignedAllocator<ColumnMajorMatrixType> > mats( 7UL );
 
       for( size_t i=0UL; i<mats.size(); ++i ) {
          for( size_t j=0UL; j<mats[i].columns(); ++j )
@@ -47,6 +47,7 @@
 #include <boost/container/vector.hpp>
 #include <blaze/math/constraints/DenseVector.h>
 #include <blaze/math/HybridVector.h>
+#include <blaze/util/AlignedAllocator.h>
 #include <blaze/util/constraints/SameType.h>
 #include <blaze/util/typetraits/AlignmentOf.h>
 #include <blazetest/system/Types.h>
@@ -229,7 +230,7 @@ void ClassTest::testAlignment( const std::string& type )
 
    {
       const VectorType init( 7UL );
-      const boost::container::vector<VectorType> vecs( 7UL, init );
+      const boost::container::vector< VectorType, blaze::AlignedAllocator<VectorType> > vecs( 7UL, init );
 
       for( size_t i=0; i<vecs.size(); ++i )
       {
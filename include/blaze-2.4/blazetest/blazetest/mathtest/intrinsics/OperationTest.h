@@ -47,10 +47,13 @@
 #include <blaze/math/Intrinsics.h>
 #include <blaze/math/shims/Equal.h>
 #include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/FalseType.h>
 #include <blaze/util/Memory.h>
 #include <blaze/util/NonCopyable.h>
 #include <blaze/util/policies/Deallocate.h>
 #include <blaze/util/Random.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/TrueType.h>
 #include <blaze/util/UniqueArray.h>
 
 
@@ -104,6 +107,8 @@ class OperationTest : private blaze::NonCopyable
    void testStore    ();
    void testStream   ();
    void testStoreu   ( size_t offset );
+   void testMaskstore( size_t offset, blaze::TrueType  );
+   void testMaskstore( size_t offset, blaze::FalseType );
    void testReduction();
    //@}
    //**********************************************************************************************
@@ -167,6 +172,12 @@ OperationTest<T>::OperationTest()
       testStoreu( offset );
    }
 
+   typedef typename blaze::SelectType< IT::masked, blaze::TrueType, blaze::FalseType >::Type  Masked;
+
+   for( size_t offset=0UL; offset<IT::size; ++offset ) {
+      testMaskstore( offset, Masked() );
+   }
+
    testReduction();
 }
 //*************************************************************************************************
@@ -265,6 +276,69 @@ void OperationTest<T>::testStoreu( size_t offset )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Testing the masked store operation.
+//
+// \return void
+// \exception std::runtime_error Load/store error detected.
+//
+// This function tests the masked store operation by copying the first \a n elements of each
+// intrinsic vector of one array to another via masked load and store for all possible values
+// of \a n. The remaining elements of the target array must not be touched. In case any error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Data type of the intrinsic test
+void OperationTest<T>::testMaskstore( size_t offset, blaze::TrueType )
+{
+   using namespace blaze;  // The masked functions are only declared for supported data types
+
+   test_  = "maskstore() operation";
+
+   for( size_t n=0UL; n<=IT::size; ++n )
+   {
+      initialize();
+
+      for( size_t i=0UL; i<N; i+=IT::size )
+      {
+         T backup[IT::size];
+         for( size_t j=0UL; j<IT::size; ++j )
+            backup[j] = b_[offset+i+j];
+
+         const IntrinsicType value( maskload( a_+offset+i, n ) );
+         maskstore( b_+offset+i, value, n );
+
+         for( size_t j=n; j<IT::size; ++j )
+         {
+            if( value[j] != T() || b_[offset+i+j] != backup[j] ) {
+               std::ostringstream oss;
+               oss << " Test : " << test_ << "\n"
+                   << " Error: Masked element accessed at index " << offset+i+j << "\n"
+                   << " Details:\n"
+                   << "   Number of active elements = " << n << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+
+            b_[offset+i+j] = a_[offset+i+j];
+         }
+      }
+
+      compare( a_+offset, b_+offset );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Skipping the masked store operation for data types without masked load/store support.
+//
+// \return void
+*/
+template< typename T >  // Data type of the intrinsic test
+void OperationTest<T>::testMaskstore( size_t /*offset*/, blaze::FalseType )
+{}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Testing the reduction operation.
 //
@@ -47,6 +47,7 @@
 #include <boost/container/vector.hpp>
 #include <blaze/math/constraints/DenseVector.h>
 #include <blaze/math/StaticVector.h>
+#include <blaze/util/AlignedAllocator.h>
 #include <blaze/util/constraints/SameType.h>
 #include <blaze/util/typetraits/AlignmentOf.h>
 #include <blazetest/system/Types.h>
@@ -225,7 +226,7 @@ void ClassTest::testAlignment( const std::string& type )
    //=====================================================================================
 
    {
-      const boost::container::vector<VectorType> vecs( 7UL );
+      const boost::container::vector< VectorType, blaze::AlignedAllocator<VectorType> > vecs( 7UL );
 
       for( size_t i=0; i<vecs.size(); ++i )
       {
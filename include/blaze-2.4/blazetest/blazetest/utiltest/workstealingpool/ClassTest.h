@@ -0,0 +1,175 @@
+//=================================================================================================
+/*!
+//  \file blazetest/utiltest/workstealingpool/ClassTest.h
+//  \brief Header file for the WorkStealingPool test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_UTILTEST_WORKSTEALINGPOOL_CLASSTEST_H_
+#define _BLAZETEST_UTILTEST_WORKSTEALINGPOOL_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <boost/atomic.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+#include <blaze/util/ThreadAffinity.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/WorkStealingPool.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace workstealingpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the test of the WorkStealingPool class template.
+//
+// This class represents the collection of tests for the WorkStealingPool class template.
+*/
+class ClassTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! Type of the tested thread pool.
+   typedef blaze::WorkStealingPool< boost::thread
+                                  , boost::mutex
+                                  , boost::unique_lock<boost::mutex>
+                                  , boost::condition_variable >  Pool;
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testSchedule();
+   void testScheduleOn();
+   void testArguments();
+   void testNestedTasks();
+   void testResize();
+   void testClear();
+   void testAffinity();
+   void testRun();
+   void testSpinning();
+   void testException();
+   //@}
+   //**********************************************************************************************
+
+   //**Task functions******************************************************************************
+   /*!\name Task functions */
+   //@{
+   static void increment();
+   static void addIndex( size_t index );
+   static void add( size_t a1, size_t a2, size_t a3, size_t a4, size_t a5 );
+   static void spawn( Pool* pool, size_t depth );
+   static void block();
+   static void fail();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   static boost::atomic<size_t> counter_;  //!< Counter for the executed tasks.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the WorkStealingPool class template.
+//
+// \return void
+*/
+inline void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the WorkStealingPool class test.
+*/
+#define RUN_WORKSTEALINGPOOL_CLASS_TEST \
+   blazetest::utiltest::workstealingpool::runTest();
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace workstealingpool
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,904 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/compressedblockmatrix/ClassTest.cpp
+//  \brief Source file for the CompressedBlockMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SparseRow.h>
+#include <blaze/math/SparseSubmatrix.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/compressedblockmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace compressedblockmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CompressedBlockMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testAddAssign();
+   testSubAssign();
+   testScaling();
+   testFunctionCall();
+   testIterator();
+   testBlockIterator();
+   testAppend();
+   testReserve();
+   testFind();
+   testMultiplication();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedBlockMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the CompressedBlockMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   // Default constructor
+   {
+      test_ = "CompressedBlockMatrix default constructor";
+
+      blaze::CompressedBlockMatrix<int,3UL> mat;
+
+      checkRows         ( mat, 0UL );
+      checkColumns      ( mat, 0UL );
+      checkNonZeros     ( mat, 0UL );
+      checkNonZeroBlocks( mat, 0UL );
+   }
+
+   // Size constructor
+   {
+      test_ = "CompressedBlockMatrix size constructor";
+
+      blaze::CompressedBlockMatrix<int,3UL> mat( 6UL, 9UL, 4UL );
+
+      checkRows         ( mat, 6UL );
+      checkColumns      ( mat, 9UL );
+      checkCapacity     ( mat, 36UL );
+      checkNonZeros     ( mat, 0UL );
+      checkNonZeroBlocks( mat, 0UL );
+   }
+
+   // Size constructor with invalid size
+   {
+      test_ = "CompressedBlockMatrix size constructor with invalid size";
+
+      try {
+         blaze::CompressedBlockMatrix<int,3UL> mat( 4UL, 3UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction of a matrix with invalid size succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   // Copy constructor
+   {
+      test_ = "CompressedBlockMatrix copy constructor";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref( 6UL, 9UL );
+      ref(0,0) = 1;
+      ref(1,2) = 2;
+      ref(2,7) = 3;
+      ref(4,4) = 4;
+
+      const blaze::CompressedBlockMatrix<int,3UL> mat1( ref );
+      const blaze::CompressedBlockMatrix<int,3UL> mat2( mat1 );
+
+      checkRows         ( mat2, 6UL );
+      checkColumns      ( mat2, 9UL );
+      checkNonZeros     ( mat2, 27UL );
+      checkNonZeroBlocks( mat2, 3UL );
+
+      if( mat2 != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Conversion constructors
+   {
+      test_ = "CompressedBlockMatrix conversion constructors";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref( 6UL, 9UL );
+      ref(0,0) = 1;
+      ref(1,2) = 2;
+      ref(2,7) = 3;
+      ref(4,4) = 4;
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> dense( ref );
+      const blaze::CompressedMatrix<int,blaze::columnMajor> sparse( ref );
+
+      const blaze::CompressedBlockMatrix<int,3UL> mat1( ref );
+      const blaze::CompressedBlockMatrix<int,3UL> mat2( dense );
+      const blaze::CompressedBlockMatrix<int,3UL> mat3( sparse );
+
+      checkNonZeroBlocks( mat1, 3UL );
+      checkNonZeroBlocks( mat2, 3UL );
+      checkNonZeroBlocks( mat3, 3UL );
+      checkNonZeros     ( mat1, 1UL, 6UL );
+      checkNonZeros     ( mat1, 4UL, 3UL );
+
+      if( mat1 != ref || mat2 != ref || mat3 != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n" << mat2 << "\n" << mat3 << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedBlockMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the CompressedBlockMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   test_ = "CompressedBlockMatrix assignment";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> ref( 6UL, 6UL );
+   ref(0,5) =  1;
+   ref(4,0) = -2;
+   ref(4,3) =  3;
+
+   const blaze::DynamicMatrix<int,blaze::rowMajor> dense( ref );
+   const blaze::CompressedMatrix<int,blaze::columnMajor> sparse( ref );
+
+   blaze::CompressedBlockMatrix<int,3UL> mat1( 9UL, 3UL, 2UL );
+   blaze::CompressedBlockMatrix<int,3UL> mat2, mat3, mat4;
+
+   mat1 = ref;
+   mat2 = dense;
+   mat3 = sparse;
+   mat4 = mat1;
+   mat1 = mat1;
+
+   checkRows         ( mat1, 6UL );
+   checkColumns      ( mat1, 6UL );
+   checkNonZeroBlocks( mat1, 3UL );
+   checkNonZeros     ( mat4, 27UL );
+   checkNonZeros     ( mat4, 4UL, 6UL );
+
+   if( mat1 != ref || mat2 != ref || mat3 != ref || mat4 != ref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Assignment failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat1 << "\n" << mat2 << "\n" << mat3 << "\n" << mat4 << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedBlockMatrix addition assignment operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the addition assignment operator of the CompressedBlockMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAddAssign()
+{
+   test_ = "CompressedBlockMatrix addition assignment";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> ref( 6UL, 9UL );
+   ref(0,0) =  1;
+   ref(1,5) = -2;
+   ref(5,8) =  3;
+
+   const blaze::DynamicMatrix<int,blaze::rowMajor> dense( ref );
+   const blaze::CompressedBlockMatrix<int,3UL> block( ref );
+
+   blaze::CompressedBlockMatrix<int,3UL> mat( ref );
+   mat += block;
+   mat += dense;
+   mat += ref;
+
+   checkNonZeroBlocks( mat, 3UL );
+
+   if( mat != 4*ref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Addition assignment failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n" << 4*ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedBlockMatrix subtraction assignment operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the subtraction assignment operator of the CompressedBlockMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSubAssign()
+{
+   test_ = "CompressedBlockMatrix subtraction assignment";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> ref( 6UL, 9UL );
+   ref(0,0) =  1;
+   ref(1,5) = -2;
+   ref(5,8) =  3;
+
+   const blaze::DynamicMatrix<int,blaze::rowMajor> dense( ref );
+   const blaze::CompressedBlockMatrix<int,3UL> block( ref );
+
+   blaze::CompressedBlockMatrix<int,3UL> mat( ref );
+   mat -= block;
+   mat -= dense;
+   mat -= ref;
+
+   if( mat != -2*ref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Subtraction assignment failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n" << -2*ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of all CompressedBlockMatrix (self-)scaling operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all available ways to scale an instance of the
+// CompressedBlockMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testScaling()
+{
+   test_ = "CompressedBlockMatrix self-scaling";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> ref( 3UL, 6UL );
+   ref(0,0) =  1;
+   ref(1,1) = -2;
+   ref(2,4) =  3;
+
+   blaze::CompressedBlockMatrix<int,3UL> mat( ref );
+
+   mat *= 6;
+   mat /= 2;
+   mat.scale( -2 );
+
+   checkNonZeroBlocks( mat, 2UL );
+
+   if( mat(0,0) != -6 || mat(1,1) != 12 || mat(2,4) != -18 || mat(0,1) != 0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Failed self-scaling operation\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n( -6 0 0 0 0 0 )\n( 0 12 0 0 0 0 )\n( 0 0 0 0 -18 0 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedBlockMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of accessing elements via the function call operator of the
+// CompressedBlockMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   test_ = "CompressedBlockMatrix::operator()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> ref( 6UL, 6UL );
+   ref(0,1) = 3;
+   ref(2,2) = 5;
+   ref(4,5) = 2;
+
+   const blaze::CompressedBlockMatrix<int,3UL> mat( ref );
+
+   checkNonZeroBlocks( mat, 2UL );
+   checkNonZeros     ( mat, 0UL, 3UL );
+   checkNonZeros     ( mat, 4UL, 3UL );
+
+   if( mat(0,1) != 3 || mat(2,2) != 5 || mat(4,5) != 2 || mat(1,1) != 0 || mat(0,4) != 0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Function call operator failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedBlockMatrix element iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the element iterator implementation of the
+// CompressedBlockMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   typedef blaze::CompressedBlockMatrix<int,3UL>  MatrixType;
+   typedef MatrixType::ConstIterator              ConstIterator;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> ref( 6UL, 9UL );
+   ref(0,0) = 1;
+   ref(1,2) = 2;
+   ref(2,7) = 3;
+   ref(4,4) = 4;
+
+   const MatrixType mat( ref );
+
+   // Counting the number of elements in 1st row
+   {
+      test_ = "Iterator subtraction";
+
+      const size_t number( mat.end(1) - mat.begin(1) );
+
+      if( number != 6UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of elements detected\n"
+             << " Details:\n"
+             << "   Number of elements         : " << number << "\n"
+             << "   Expected number of elements: 6\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing read-only access via ConstIterator
+   {
+      test_ = "Read-only access via ConstIterator";
+
+      const size_t indices[6] = { 0UL, 1UL, 2UL, 6UL, 7UL, 8UL };
+      const int    values [6] = { 0  , 0  , 2  , 0  , 0  , 0   };
+
+      ConstIterator it( mat.cbegin(1) );
+      const ConstIterator end( mat.cend(1) );
+
+      for( size_t k=0UL; k<6UL; ++k, ++it )
+      {
+         if( it == end || it->index() != indices[k] || it->value() != values[k] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid element " << k << " in row 1\n"
+                << " Details:\n"
+                << "   Expected index: " << indices[k] << "\n"
+                << "   Expected value: " << values[k] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( it != end ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iterator not at end of row 1\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedBlockMatrix block iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the block iterator implementation of the CompressedBlockMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testBlockIterator()
+{
+   typedef blaze::CompressedBlockMatrix<int,3UL>  MatrixType;
+   typedef MatrixType::BlockIterator              BlockIterator;
+   typedef MatrixType::ConstBlockIterator         ConstBlockIterator;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> ref( 6UL, 9UL );
+   ref(0,0) = 1;
+   ref(1,2) = 2;
+   ref(2,7) = 3;
+   ref(4,4) = 4;
+
+   MatrixType mat( ref );
+
+   // Counting the number of blocks in 0th block row
+   {
+      test_ = "Block iterator subtraction";
+
+      const size_t number( mat.cblockEnd(0) - mat.cblockBegin(0) );
+
+      if( number != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of blocks detected\n"
+             << " Details:\n"
+             << "   Number of blocks         : " << number << "\n"
+             << "   Expected number of blocks: 2\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing read-only access via ConstBlockIterator
+   {
+      test_ = "Read-only access via ConstBlockIterator";
+
+      ConstBlockIterator it( mat.cblockBegin(0) );
+
+      if( it->index() != 0UL || it->value()(0,0) != 1 || it->value()(1,2) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid first block in block row 0\n"
+             << " Details:\n"
+             << "   Index: " << it->index() << "\n"
+             << "   Block:\n" << it->value() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      ++it;
+
+      if( it->index() != 2UL || it->value()(2,1) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid second block in block row 0\n"
+             << " Details:\n"
+             << "   Index: " << it->index() << "\n"
+             << "   Block:\n" << it->value() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing assignment via BlockIterator
+   {
+      test_ = "Assignment via BlockIterator";
+
+      BlockIterator it( mat.blockBegin(1) );
+      it->value()(0,2) = 5;
+      it->value()(1,1) *= 2;
+
+      if( mat(3,5) != 5 || mat(4,4) != 8 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment via block iterator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c appendBlock() member function of the CompressedBlockMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c appendBlock() and \c finalize() member functions of
+// the CompressedBlockMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testAppend()
+{
+   test_ = "CompressedBlockMatrix::appendBlock()";
+
+   typedef blaze::StaticMatrix<int,3UL,3UL,blaze::rowMajor>  BlockType;
+
+   BlockType block;
+   block(0,0) = 1;
+   block(1,1) = 2;
+   block(2,0) = 3;
+
+   blaze::CompressedBlockMatrix<int,3UL> mat( 9UL, 6UL, 3UL );
+   mat.appendBlock( 0UL, 1UL, block );
+   mat.finalize( 0UL );
+   mat.finalize( 1UL );
+   mat.appendBlock( 2UL, 0UL, block );
+   mat.appendBlock( 2UL, 1UL, 2*block );
+   mat.finalize( 2UL );
+
+   checkNonZeroBlocks( mat, 3UL );
+   checkNonZeros     ( mat, 27UL );
+   checkNonZeros     ( mat, 4UL, 0UL );
+   checkNonZeros     ( mat, 7UL, 6UL );
+
+   if( mat(0,3) != 1 || mat(2,3) != 3 || mat(7,1) != 2 || mat(7,4) != 4 || mat(8,3) != 6 ||
+       mat.nonZeroBlocks( 1UL ) != 0UL || mat.nonZeroBlocks( 2UL ) != 2UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Append operation failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reserveBlocks() member function of the CompressedBlockMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reserveBlocks() member function of the
+// CompressedBlockMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testReserve()
+{
+   test_ = "CompressedBlockMatrix::reserveBlocks()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> ref( 6UL, 6UL );
+   ref(0,0) = 1;
+   ref(5,5) = 2;
+
+   blaze::CompressedBlockMatrix<int,3UL> mat( ref );
+
+   mat.reserveBlocks( 4UL );
+
+   checkCapacity     ( mat, 36UL );
+   checkNonZeroBlocks( mat, 2UL );
+
+   mat.reserveBlocks( 1UL );
+
+   checkCapacity     ( mat, 36UL );
+   checkNonZeroBlocks( mat, 2UL );
+
+   if( mat != ref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reserve operation failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the lookup member functions of the CompressedBlockMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c find(), \c lowerBound(), \c upperBound(), and
+// \c findBlock() member functions of the CompressedBlockMatrix class template. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFind()
+{
+   typedef blaze::CompressedBlockMatrix<int,3UL>  MatrixType;
+   typedef MatrixType::ConstIterator              ConstIterator;
+   typedef MatrixType::ConstBlockIterator         ConstBlockIterator;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> ref( 6UL, 9UL );
+   ref(0,0) = 1;
+   ref(1,2) = 2;
+   ref(2,7) = 3;
+   ref(4,4) = 4;
+
+   const MatrixType mat( ref );
+
+   {
+      test_ = "CompressedBlockMatrix::find()";
+
+      const ConstIterator pos1( mat.find( 1UL, 2UL ) );
+      const ConstIterator pos2( mat.find( 1UL, 1UL ) );
+      const ConstIterator pos3( mat.find( 4UL, 0UL ) );
+
+      if( pos1 == mat.end(1) || pos1->index() != 2UL || pos1->value() != 2 ||
+          pos2 == mat.end(1) || pos2->index() != 1UL || pos2->value() != 0 ||
+          pos3 != mat.end(4) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Element lookup failed\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CompressedBlockMatrix::lowerBound() and CompressedBlockMatrix::upperBound()";
+
+      const ConstIterator pos1( mat.lowerBound( 4UL, 0UL ) );
+      const ConstIterator pos2( mat.upperBound( 1UL, 2UL ) );
+      const ConstIterator pos3( mat.upperBound( 1UL, 8UL ) );
+
+      if( pos1 == mat.end(4) || pos1->index() != 3UL ||
+          pos2 == mat.end(1) || pos2->index() != 6UL ||
+          pos3 != mat.end(1) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Bound lookup failed\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CompressedBlockMatrix::findBlock()";
+
+      const ConstBlockIterator pos1( mat.findBlock( 0UL, 2UL ) );
+      const ConstBlockIterator pos2( mat.findBlock( 1UL, 0UL ) );
+
+      if( pos1 == mat.blockEnd(0) || pos1->index() != 2UL || pos1->value()(2,1) != 3 ||
+          pos2 != mat.blockEnd(1) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Block lookup failed\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedBlockMatrix multiplication kernels.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication of a CompressedBlockMatrix with dense
+// vectors and dense matrices. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   const size_t M( 60UL );
+   const size_t N( 96UL );
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> ref( M, N );
+   for( size_t i=0UL; i<M; ++i ) {
+      const size_t nonzeros( ( i % 7UL == 0UL )?( N/2UL ):( i % 5UL ) );
+      for( size_t j=0UL; j<nonzeros; ++j ) {
+         ref( i, ( 11UL*j + i ) % N ) = blaze::rand<int>( -9, 9 );
+      }
+   }
+
+   blaze::DynamicVector<double,blaze::columnVector> x( N );
+   for( size_t j=0UL; j<N; ++j ) {
+      x[j] = blaze::rand<int>( -9, 9 );
+   }
+
+   {
+      test_ = "CompressedBlockMatrix/dense vector multiplication (3x3 blocks)";
+
+      const blaze::CompressedBlockMatrix<double,3UL> mat( ref );
+
+      const blaze::DynamicVector<double,blaze::columnVector> expected( ref * x );
+      blaze::DynamicVector<double,blaze::columnVector> y1( mat * x );
+      blaze::DynamicVector<double,blaze::columnVector> y2( M, 0.0 );
+      y2 += mat * x;
+      y2 += mat * x;
+      y2 -= mat * x;
+
+      if( y1 != expected || y2 != expected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y1 << "\n" << y2 << "\n"
+             << "   Expected result:\n" << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CompressedBlockMatrix/dense vector multiplication (6x6 blocks)";
+
+      const blaze::CompressedBlockMatrix<double,6UL> mat( ref );
+
+      const blaze::DynamicVector<double,blaze::columnVector> expected( ref * x );
+      const blaze::DynamicVector<double,blaze::columnVector> y( mat * x );
+
+      if( y != expected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n" << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CompressedBlockMatrix submatrix/dense vector multiplication";
+
+      const blaze::CompressedBlockMatrix<double,3UL> mat( ref );
+
+      const blaze::DynamicVector<double,blaze::columnVector> expected( submatrix( ref, 3UL, 0UL, 40UL, N ) * x );
+      const blaze::DynamicVector<double,blaze::columnVector> y( submatrix( mat, 3UL, 0UL, 40UL, N ) * x );
+
+      if( y != expected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n" << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CompressedBlockMatrix/dense matrix multiplication";
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> X( N, 5UL );
+      for( size_t i=0UL; i<N; ++i ) {
+         for( size_t j=0UL; j<5UL; ++j ) {
+            X(i,j) = blaze::rand<int>( -9, 9 );
+         }
+      }
+
+      const blaze::CompressedBlockMatrix<double,3UL> mat( ref );
+
+      const blaze::DynamicMatrix<double,blaze::rowMajor> expected( ref * X );
+      const blaze::DynamicMatrix<double,blaze::rowMajor> result( mat * X );
+
+      if( result != expected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << result << "\n"
+             << "   Expected result:\n" << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace compressedblockmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CompressedBlockMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_COMPRESSEDBLOCKMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CompressedBlockMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
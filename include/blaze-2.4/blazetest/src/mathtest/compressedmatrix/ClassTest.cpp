@@ -8346,6 +8346,51 @@ void ClassTest::testReserve()
       checkCapacity( mat,  2UL, 10UL );
    }
 
+   {
+      test_ = "Row-major CompressedMatrix::reserve( const std::vector<size_t>& )";
+
+      // Initialization check
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat( 3UL, 4UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+
+      // Reserving the capacities of all rows
+      std::vector<size_t> nonzeros( 3UL, 0UL );
+      nonzeros[0] = 2UL;
+      nonzeros[2] = 1UL;
+      mat.reserve( nonzeros );
+
+      checkCapacity( mat, 3UL );
+      checkCapacity( mat, 0UL, 2UL );
+      checkCapacity( mat, 1UL, 0UL );
+      checkCapacity( mat, 2UL, 1UL );
+      checkNonZeros( mat, 0UL );
+
+      // Appending the non-zero elements in arbitrary row order
+      mat.append( 2UL, 3UL, 3 );
+      mat.append( 0UL, 1UL, 1 );
+      mat.append( 0UL, 2UL, 2 );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 1UL );
+
+      if( mat(0,1) != 1 || mat(0,2) != 2 || mat(2,3) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reserve operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 1 2 0 )\n( 0 0 0 0 )\n( 0 0 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
 
    //=====================================================================================
    // Column-major matrix tests
@@ -8418,6 +8463,51 @@ void ClassTest::testReserve()
       checkCapacity( mat,  1UL, 15UL );
       checkCapacity( mat,  2UL, 10UL );
    }
+
+   {
+      test_ = "Column-major CompressedMatrix::reserve( const std::vector<size_t>& )";
+
+      // Initialization check
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat( 4UL, 3UL );
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 0UL );
+
+      // Reserving the capacities of all columns
+      std::vector<size_t> nonzeros( 3UL, 0UL );
+      nonzeros[0] = 2UL;
+      nonzeros[2] = 1UL;
+      mat.reserve( nonzeros );
+
+      checkCapacity( mat, 3UL );
+      checkCapacity( mat, 0UL, 2UL );
+      checkCapacity( mat, 1UL, 0UL );
+      checkCapacity( mat, 2UL, 1UL );
+      checkNonZeros( mat, 0UL );
+
+      // Appending the non-zero elements in arbitrary column order
+      mat.append( 3UL, 2UL, 3 );
+      mat.append( 1UL, 0UL, 1 );
+      mat.append( 2UL, 0UL, 2 );
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 1UL );
+
+      if( mat(1,0) != 1 || mat(2,0) != 2 || mat(3,2) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reserve operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 )\n( 1 0 0 )\n( 2 0 0 )\n( 0 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
 }
 //*************************************************************************************************
 
@@ -0,0 +1,1338 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/compressedsoamatrix/ClassTest.cpp
+//  \brief Source file for the CompressedSoAMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/LowerMatrix.h>
+#include <blaze/math/SparseColumn.h>
+#include <blaze/math/SparseRow.h>
+#include <blaze/math/SparseSubmatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/compressedsoamatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace compressedsoamatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CompressedSoAMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testAddAssign();
+   testSubAssign();
+   testScaling();
+   testFunctionCall();
+   testIterator();
+   testInsert();
+   testAppend();
+   testErase();
+   testResize();
+   testReserve();
+   testTrim();
+   testMultiplication();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedSoAMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the CompressedSoAMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Row-major constructors
+   //=====================================================================================
+
+   // Default constructor
+   {
+      test_ = "Row-major CompressedSoAMatrix default constructor";
+
+      blaze::CompressedSoAMatrix<int,blaze::rowMajor> mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   // Size constructor
+   {
+      test_ = "Row-major CompressedSoAMatrix size constructor";
+
+      blaze::CompressedSoAMatrix<int,blaze::rowMajor> mat( 2UL, 3UL, 4UL );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   // Size constructor with row capacities
+   {
+      test_ = "Row-major CompressedSoAMatrix size constructor with row capacities";
+
+      std::vector<size_t> nonzeros( 3UL );
+      nonzeros[0] = 2UL;
+      nonzeros[1] = 0UL;
+      nonzeros[2] = 3UL;
+
+      blaze::CompressedSoAMatrix<int,blaze::rowMajor> mat( 3UL, 4UL, nonzeros );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkCapacity( mat, 5UL );
+      checkCapacity( mat, 0UL, 2UL );
+      checkCapacity( mat, 2UL, 3UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   // Size constructor exceeding the 32-bit index range
+   {
+      test_ = "Row-major CompressedSoAMatrix size constructor exceeding the index range";
+
+      try {
+         blaze::CompressedSoAMatrix<int,blaze::rowMajor> mat( 2UL, 5000000000UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction of a matrix with too many columns succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   // Conversion constructors
+   {
+      test_ = "Row-major CompressedSoAMatrix conversion constructors";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref( 3UL, 4UL );
+      ref(0,1) =  1;
+      ref(1,0) = -2;
+      ref(1,3) =  3;
+      ref(2,2) =  4;
+
+      const blaze::DynamicMatrix<int,blaze::columnMajor> dense( ref );
+      const blaze::CompressedMatrix<int,blaze::columnMajor> sparse( ref );
+
+      blaze::CompressedSoAMatrix<int,blaze::rowMajor> mat1( ref );
+      blaze::CompressedSoAMatrix<int,blaze::rowMajor> mat2( dense );
+      blaze::CompressedSoAMatrix<int,blaze::rowMajor> mat3( sparse );
+      blaze::CompressedSoAMatrix<int,blaze::rowMajor> mat4( mat3 );
+
+      checkRows    ( mat4, 3UL );
+      checkColumns ( mat4, 4UL );
+      checkNonZeros( mat4, 4UL );
+      checkNonZeros( mat4, 1UL, 2UL );
+
+      if( mat1 != ref || mat2 != ref || mat3 != ref || mat4 != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n" << mat2 << "\n" << mat3 << "\n" << mat4 << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major constructors
+   //=====================================================================================
+
+   // Default constructor
+   {
+      test_ = "Column-major CompressedSoAMatrix default constructor";
+
+      blaze::CompressedSoAMatrix<int,blaze::columnMajor> mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   // Size constructor
+   {
+      test_ = "Column-major CompressedSoAMatrix size constructor";
+
+      blaze::CompressedSoAMatrix<int,blaze::columnMajor> mat( 2UL, 3UL, 4UL );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   // Size constructor exceeding the 32-bit index range
+   {
+      test_ = "Column-major CompressedSoAMatrix size constructor exceeding the index range";
+
+      try {
+         blaze::CompressedSoAMatrix<int,blaze::columnMajor> mat( 5000000000UL, 2UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction of a matrix with too many rows succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   // Conversion constructors
+   {
+      test_ = "Column-major CompressedSoAMatrix conversion constructors";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> ref( 3UL, 4UL );
+      ref(0,1) =  1;
+      ref(1,0) = -2;
+      ref(1,3) =  3;
+      ref(2,2) =  4;
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> dense( ref );
+      const blaze::CompressedMatrix<int,blaze::rowMajor> sparse( ref );
+      const blaze::LowerMatrix< blaze::DynamicMatrix<int,blaze::rowMajor> > lower( 3UL );
+
+      blaze::CompressedSoAMatrix<int,blaze::columnMajor> mat1( ref );
+      blaze::CompressedSoAMatrix<int,blaze::columnMajor> mat2( dense );
+      blaze::CompressedSoAMatrix<int,blaze::columnMajor> mat3( sparse );
+      blaze::CompressedSoAMatrix<int,blaze::columnMajor> mat4( mat3 );
+      blaze::CompressedSoAMatrix<int,blaze::columnMajor> mat5( lower );
+
+      checkRows    ( mat4, 3UL );
+      checkColumns ( mat4, 4UL );
+      checkNonZeros( mat4, 4UL );
+      checkNonZeros( mat4, 0UL, 1UL );
+      checkNonZeros( mat5, 0UL );
+
+      if( mat1 != ref || mat2 != ref || mat3 != ref || mat4 != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n" << mat2 << "\n" << mat3 << "\n" << mat4 << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedSoAMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the CompressedSoAMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   //=====================================================================================
+   // Row-major assignment
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompressedSoAMatrix assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref( 3UL, 5UL );
+      ref(0,4) =  1;
+      ref(2,0) = -2;
+      ref(2,3) =  3;
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> dense( ref );
+      const blaze::CompressedSoAMatrix<int,blaze::columnMajor> sparse( ref );
+
+      blaze::CompressedSoAMatrix<int,blaze::rowMajor> mat1( 7UL, 2UL, 20UL );
+      blaze::CompressedSoAMatrix<int,blaze::rowMajor> mat2, mat3, mat4;
+
+      mat1 = ref;
+      mat2 = dense;
+      mat3 = sparse;
+      mat4 = mat1;
+      mat1 = mat1;
+
+      checkRows    ( mat1, 3UL );
+      checkColumns ( mat1, 5UL );
+      checkNonZeros( mat1, 3UL );
+      checkNonZeros( mat4, 2UL, 2UL );
+
+      if( mat1 != ref || mat2 != ref || mat3 != ref || mat4 != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n" << mat2 << "\n" << mat3 << "\n" << mat4 << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major assignment
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CompressedSoAMatrix assignment";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> ref( 3UL, 5UL );
+      ref(0,4) =  1;
+      ref(2,0) = -2;
+      ref(2,3) =  3;
+
+      const blaze::DynamicMatrix<int,blaze::columnMajor> dense( ref );
+      const blaze::CompressedSoAMatrix<int,blaze::rowMajor> sparse( ref );
+
+      blaze::CompressedSoAMatrix<int,blaze::columnMajor> mat1( 2UL, 7UL, 20UL );
+      blaze::CompressedSoAMatrix<int,blaze::columnMajor> mat2, mat3, mat4;
+
+      mat1 = ref;
+      mat2 = dense;
+      mat3 = sparse;
+      mat4 = mat1;
+
+      checkRows    ( mat1, 3UL );
+      checkColumns ( mat1, 5UL );
+      checkNonZeros( mat1, 3UL );
+      checkNonZeros( mat4, 0UL, 1UL );
+
+      if( mat1 != ref || mat2 != ref || mat3 != ref || mat4 != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n" << mat2 << "\n" << mat3 << "\n" << mat4 << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedSoAMatrix addition assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the addition assignment operators of the CompressedSoAMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAddAssign()
+{
+   {
+      test_ = "Row-major CompressedSoAMatrix addition assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref( 3UL, 4UL );
+      ref(0,0) =  1;
+      ref(1,2) = -2;
+      ref(2,3) =  3;
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> dense( ref );
+      const blaze::CompressedSoAMatrix<int,blaze::columnMajor> sparse( ref );
+
+      blaze::CompressedSoAMatrix<int,blaze::rowMajor> mat( ref );
+      mat += sparse;
+      mat += dense;
+      mat += ref;
+
+      checkNonZeros( mat, 3UL );
+
+      if( mat != 4*ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << 4*ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompressedSoAMatrix addition assignment";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> ref( 3UL, 4UL );
+      ref(0,0) =  1;
+      ref(1,2) = -2;
+      ref(2,3) =  3;
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> dense( ref );
+      const blaze::CompressedSoAMatrix<int,blaze::rowMajor> sparse( ref );
+
+      blaze::CompressedSoAMatrix<int,blaze::columnMajor> mat( ref );
+      mat += sparse;
+      mat += dense;
+      mat += ref;
+
+      checkNonZeros( mat, 3UL );
+
+      if( mat != 4*ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << 4*ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedSoAMatrix subtraction assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the subtraction assignment operators of the CompressedSoAMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSubAssign()
+{
+   {
+      test_ = "Row-major CompressedSoAMatrix subtraction assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref( 3UL, 4UL );
+      ref(0,0) =  1;
+      ref(1,2) = -2;
+      ref(2,3) =  3;
+
+      const blaze::CompressedSoAMatrix<int,blaze::columnMajor> sparse( ref );
+
+      blaze::CompressedSoAMatrix<int,blaze::rowMajor> mat( 3UL, 4UL );
+      mat(0,1) = 5;
+      mat -= sparse;
+      mat -= ref;
+
+      checkNonZeros( mat, 4UL );
+
+      if( mat(0,1) != 5 || mat(0,0) != -2 || mat(1,2) != 4 || mat(2,3) != -6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( -2 5 0 0 )\n( 0 0 4 0 )\n( 0 0 0 -6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompressedSoAMatrix subtraction assignment";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> ref( 3UL, 4UL );
+      ref(0,0) =  1;
+      ref(1,2) = -2;
+      ref(2,3) =  3;
+
+      const blaze::CompressedSoAMatrix<int,blaze::rowMajor> sparse( ref );
+
+      blaze::CompressedSoAMatrix<int,blaze::columnMajor> mat( 3UL, 4UL );
+      mat(0,1) = 5;
+      mat -= sparse;
+      mat -= ref;
+
+      checkNonZeros( mat, 4UL );
+
+      if( mat(0,1) != 5 || mat(0,0) != -2 || mat(1,2) != 4 || mat(2,3) != -6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( -2 5 0 0 )\n( 0 0 4 0 )\n( 0 0 0 -6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of all CompressedSoAMatrix (self-)scaling operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all available ways to scale an instance of the
+// CompressedSoAMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testScaling()
+{
+   {
+      test_ = "Row-major CompressedSoAMatrix self-scaling";
+
+      blaze::CompressedSoAMatrix<int,blaze::rowMajor> mat( 3UL, 3UL );
+      mat(0,0) =  1;
+      mat(1,1) = -2;
+      mat(2,0) =  3;
+
+      mat *= 6;
+      mat /= 2;
+      mat.scale( 2 );
+      mat.scaleDiagonal( -1 );
+
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,0) != -6 || mat(1,1) != 12 || mat(2,0) != 18 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( -6 0 0 )\n( 0 12 0 )\n( 18 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompressedSoAMatrix self-scaling";
+
+      blaze::CompressedSoAMatrix<int,blaze::columnMajor> mat( 3UL, 3UL );
+      mat(0,0) =  1;
+      mat(1,1) = -2;
+      mat(2,0) =  3;
+
+      mat *= 6;
+      mat /= 2;
+      mat.scale( 2 );
+      mat.scaleDiagonal( -1 );
+
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,0) != -6 || mat(1,1) != 12 || mat(2,0) != 18 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( -6 0 0 )\n( 0 12 0 )\n( 18 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedSoAMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of adding and accessing elements via the function call operator
+// of the CompressedSoAMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   {
+      test_ = "Row-major CompressedSoAMatrix::operator()";
+
+      blaze::CompressedSoAMatrix<int,blaze::rowMajor> mat( 3UL, 5UL );
+
+      mat(2,2) = 1;
+      mat(0,4) = 2;
+      mat(0,1) = 3;
+      mat(2,2) += 4;
+      mat(1,3) = 5;
+      mat(1,3) -= 5;
+
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 2UL );
+
+      if( mat(0,1) != 3 || mat(0,4) != 2 || mat(1,3) != 0 || mat(2,2) != 5 || mat(2,0) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Function call operator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 3 0 0 2 )\n( 0 0 0 0 0 )\n( 0 0 5 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompressedSoAMatrix::operator()";
+
+      blaze::CompressedSoAMatrix<int,blaze::columnMajor> mat( 3UL, 5UL );
+
+      mat(2,2) = 1;
+      mat(0,4) = 2;
+      mat(0,1) = 3;
+      mat(2,2) += 4;
+      mat(1,3) = 5;
+      mat(1,3) -= 5;
+
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 2UL, 1UL );
+
+      if( mat(0,1) != 3 || mat(0,4) != 2 || mat(1,3) != 0 || mat(2,2) != 5 || mat(2,0) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Function call operator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 3 0 0 2 )\n( 0 0 0 0 0 )\n( 0 0 5 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedSoAMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the CompressedSoAMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   typedef blaze::CompressedSoAMatrix<int,blaze::rowMajor>  MatrixType;
+   typedef MatrixType::Iterator                             Iterator;
+   typedef MatrixType::ConstIterator                        ConstIterator;
+
+   MatrixType mat( 3UL, 4UL );
+   mat(0,1) =  1;
+   mat(1,0) = -2;
+   mat(1,2) = -3;
+   mat(2,1) =  4;
+   mat(2,3) =  5;
+
+   // Counting the number of elements in 1st row
+   {
+      test_ = "Iterator subtraction";
+
+      const size_t number( mat.end(1) - mat.begin(1) );
+
+      if( number != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of elements detected\n"
+             << " Details:\n"
+             << "   Number of elements         : " << number << "\n"
+             << "   Expected number of elements: 2\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing read-only access via ConstIterator
+   {
+      test_ = "Read-only access via ConstIterator";
+
+      ConstIterator it ( mat.cbegin(2) );
+      ConstIterator end( mat.cend(2) );
+
+      if( it == end || it->value() != 4 || it->index() != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid initial iterator detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      ++it;
+
+      if( it == end || (*it).value() != 5 || (*it).index() != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iterator pre-increment failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      it++;
+
+      if( it != end ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iterator post-increment failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing assignment via Iterator
+   {
+      test_ = "Assignment via Iterator";
+
+      int value = 7;
+
+      for( Iterator it=mat.begin(1); it!=mat.end(1); ++it ) {
+         *it = value++;
+      }
+      mat.begin(2)->value() += 3;
+      mat.begin(0)->value() *= 2;
+
+      if( mat(0,1) != 2 || mat(1,0) != 7 || mat(1,2) != 8 || mat(2,1) != 7 || mat(2,3) != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment via iterator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 2 0 0 )\n( 7 0 8 0 )\n( 0 7 0 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the insert() member function of the CompressedSoAMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the insert() member function of the CompressedSoAMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testInsert()
+{
+   {
+      test_ = "Row-major CompressedSoAMatrix::insert()";
+
+      blaze::CompressedSoAMatrix<int,blaze::rowMajor> mat( 4UL, 5UL );
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref( 4UL, 5UL );
+
+      for( size_t i=0UL; i<20UL; ++i ) {
+         const size_t row( ( 7UL*i ) % 4UL );
+         const size_t col( ( 3UL*i ) % 5UL );
+         if( ref.find( row, col ) == ref.end( row ) ) {
+            mat.insert( row, col, int(i)+1 );
+            ref.insert( row, col, int(i)+1 );
+         }
+      }
+      mat.set( 0UL, 0UL, -1 );
+      ref.set( 0UL, 0UL, -1 );
+
+      checkNonZeros( mat, ref.nonZeros() );
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inserting elements failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         mat.insert( 0UL, 0UL, 2 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inserting an existing element succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Column-major CompressedSoAMatrix::insert()";
+
+      blaze::CompressedSoAMatrix<int,blaze::columnMajor> mat( 4UL, 5UL );
+      blaze::CompressedMatrix<int,blaze::columnMajor> ref( 4UL, 5UL );
+
+      for( size_t i=0UL; i<20UL; ++i ) {
+         const size_t row( ( 7UL*i ) % 4UL );
+         const size_t col( ( 3UL*i ) % 5UL );
+         if( ref.find( row, col ) == ref.end( col ) ) {
+            mat.insert( row, col, int(i)+1 );
+            ref.insert( row, col, int(i)+1 );
+         }
+      }
+      mat.set( 0UL, 0UL, -1 );
+      ref.set( 0UL, 0UL, -1 );
+
+      checkNonZeros( mat, ref.nonZeros() );
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inserting elements failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the append() member function of the CompressedSoAMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the append() member function of the CompressedSoAMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAppend()
+{
+   {
+      test_ = "Row-major CompressedSoAMatrix::append()";
+
+      blaze::CompressedSoAMatrix<int,blaze::rowMajor> mat( 3UL, 4UL, 5UL );
+      mat.append( 0UL, 1UL, 1 );
+      mat.append( 0UL, 3UL, 2 );
+      mat.finalize( 0UL );
+      mat.finalize( 1UL );
+      mat.append( 2UL, 0UL, 3 );
+      mat.append( 2UL, 2UL, 0, true );
+      mat.append( 2UL, 3UL, 4 );
+      mat.finalize( 2UL );
+
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat(0,1) != 1 || mat(0,3) != 2 || mat(2,0) != 3 || mat(2,3) != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Append operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 1 0 2 )\n( 0 0 0 0 )\n( 3 0 0 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompressedSoAMatrix::append()";
+
+      std::vector<size_t> nonzeros( 4UL, 1UL );
+      nonzeros[3] = 2UL;
+
+      blaze::CompressedSoAMatrix<int,blaze::columnMajor> mat( 3UL, 4UL );
+      mat.reserve( nonzeros );
+      mat.append( 0UL, 3UL, 2 );
+      mat.append( 2UL, 3UL, 4 );
+      mat.append( 2UL, 0UL, 3 );
+      mat.append( 0UL, 1UL, 1 );
+
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 2UL, 0UL );
+      checkNonZeros( mat, 3UL, 2UL );
+
+      if( mat(0,1) != 1 || mat(0,3) != 2 || mat(2,0) != 3 || mat(2,3) != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Append operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 1 0 2 )\n( 0 0 0 0 )\n( 3 0 0 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the erase() member functions of the CompressedSoAMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the erase() member functions of the CompressedSoAMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testErase()
+{
+   {
+      test_ = "Row-major CompressedSoAMatrix::erase()";
+
+      blaze::CompressedSoAMatrix<int,blaze::rowMajor> mat( 3UL, 5UL );
+      mat(0,0) = 1;
+      mat(0,2) = 2;
+      mat(0,4) = 3;
+      mat(1,1) = 4;
+      mat(2,0) = 5;
+      mat(2,3) = 6;
+
+      mat.erase( 0UL, 2UL );
+      mat.erase( 1UL, 0UL );
+
+      blaze::CompressedSoAMatrix<int,blaze::rowMajor>::Iterator pos( mat.erase( 2UL, mat.begin(2UL) ) );
+      mat.erase( 0UL, mat.begin(0UL), mat.begin(0UL)+1UL );
+
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 2UL, 1UL );
+
+      if( pos->value() != 6 || pos->index() != 3UL ||
+          mat(0,4) != 3 || mat(1,1) != 4 || mat(2,3) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Erasing elements failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 0 3 )\n( 0 4 0 0 0 )\n( 0 0 0 6 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompressedSoAMatrix::erase()";
+
+      blaze::CompressedSoAMatrix<int,blaze::columnMajor> mat( 5UL, 3UL );
+      mat(0,0) = 1;
+      mat(2,0) = 2;
+      mat(4,0) = 3;
+      mat(1,1) = 4;
+      mat(0,2) = 5;
+      mat(3,2) = 6;
+
+      mat.erase( 2UL, 0UL );
+      mat.erase( 0UL, 1UL );
+      mat.erase( 2UL, mat.begin(2UL) );
+      mat.erase( 0UL, mat.begin(0UL), mat.begin(0UL)+1UL );
+
+      checkNonZeros( mat, 3UL );
+
+      if( mat(4,0) != 3 || mat(1,1) != 4 || mat(3,2) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Erasing elements failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 )\n( 0 4 0 )\n( 0 0 0 )\n( 0 0 6 )\n( 3 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resize() member function of the CompressedSoAMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the resize() member function of the CompressedSoAMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   {
+      test_ = "Row-major CompressedSoAMatrix::resize()";
+
+      blaze::CompressedSoAMatrix<int,blaze::rowMajor> mat( 2UL, 3UL );
+      mat(0,0) = 1;
+      mat(0,2) = 2;
+      mat(1,1) = 3;
+
+      mat.resize( 4UL, 5UL );
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 5UL );
+      checkNonZeros( mat, 3UL );
+
+      mat(3,4) = 4;
+      mat.resize( 3UL, 2UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 2UL );
+      checkNonZeros( mat, 2UL );
+
+      if( mat(0,0) != 1 || mat(1,1) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing the matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 )\n( 0 3 )\n( 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      mat.resize( 0UL, 0UL );
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "Column-major CompressedSoAMatrix::resize()";
+
+      blaze::CompressedSoAMatrix<int,blaze::columnMajor> mat( 3UL, 2UL );
+      mat(0,0) = 1;
+      mat(2,0) = 2;
+      mat(1,1) = 3;
+
+      mat.resize( 5UL, 4UL );
+
+      checkRows    ( mat, 5UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 3UL );
+
+      mat(4,3) = 4;
+      mat.resize( 2UL, 3UL );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 2UL );
+
+      if( mat(0,0) != 1 || mat(1,1) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing the matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 0 3 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reserve() member functions of the CompressedSoAMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the reserve() member functions of the CompressedSoAMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReserve()
+{
+   {
+      test_ = "Row-major CompressedSoAMatrix::reserve()";
+
+      blaze::CompressedSoAMatrix<int,blaze::rowMajor> mat( 3UL, 4UL );
+      mat(0,1) = 1;
+      mat(2,2) = 2;
+
+      mat.reserve( 10UL );
+
+      checkCapacity( mat, 10UL );
+      checkNonZeros( mat, 2UL );
+
+      mat.reserve( 1UL, 3UL );
+      mat.reserve( 0UL, 4UL );
+      mat.reserve( 2UL, 12UL );
+
+      checkCapacity( mat, 0UL, 4UL );
+      checkCapacity( mat, 1UL, 3UL );
+      checkCapacity( mat, 2UL, 12UL );
+      checkNonZeros( mat, 2UL );
+
+      if( mat(0,1) != 1 || mat(2,2) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reserving capacity failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 1 0 0 )\n( 0 0 0 0 )\n( 0 0 2 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompressedSoAMatrix::reserve()";
+
+      blaze::CompressedSoAMatrix<int,blaze::columnMajor> mat( 4UL, 3UL );
+      mat(1,0) = 1;
+      mat(2,2) = 2;
+
+      mat.reserve( 10UL );
+      mat.reserve( 1UL, 3UL );
+      mat.reserve( 0UL, 4UL );
+      mat.reserve( 2UL, 12UL );
+
+      checkCapacity( mat, 0UL, 4UL );
+      checkCapacity( mat, 1UL, 3UL );
+      checkCapacity( mat, 2UL, 12UL );
+      checkNonZeros( mat, 2UL );
+
+      if( mat(1,0) != 1 || mat(2,2) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reserving capacity failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 )\n( 1 0 0 )\n( 0 0 2 )\n( 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the trim() member functions of the CompressedSoAMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the trim() member functions of the CompressedSoAMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testTrim()
+{
+   {
+      test_ = "Row-major CompressedSoAMatrix::trim()";
+
+      blaze::CompressedSoAMatrix<int,blaze::rowMajor> mat( 3UL, 3UL );
+      mat.reserve( 0UL, 10UL );
+      mat.reserve( 1UL, 15UL );
+      mat.reserve( 2UL, 20UL );
+      mat(0,0) = 1;
+      mat(1,2) = 2;
+
+      mat.trim( 0UL );
+
+      checkCapacity( mat, 0UL,  1UL );
+      checkCapacity( mat, 1UL, 24UL );
+      checkCapacity( mat, 2UL, 20UL );
+
+      mat.trim();
+
+      checkCapacity( mat, 0UL, 1UL );
+      checkCapacity( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL );
+
+      if( mat(0,0) != 1 || mat(1,2) != 2 || capacity( mat, 1UL ) != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Trimming the matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 0 0 2 )\n( 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication kernels for the CompressedSoAMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the sparse matrix/dense vector and the sparse matrix/sparse matrix
+// multiplications with compressed SoA matrices against the according multiplications with
+// compressed matrices. The rows are filled with different numbers of non-zero elements in
+// order to cover both the short row and the long row paths of the multiplication kernels.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   const size_t M( 61UL );
+   const size_t N( 97UL );
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> ref( M, N );
+   for( size_t i=0UL; i<M; ++i ) {
+      const size_t nonzeros( ( i % 7UL == 0UL )?( N/2UL ):( i % 5UL ) );
+      for( size_t j=0UL; j<nonzeros; ++j ) {
+         ref( i, ( 11UL*j + i ) % N ) = blaze::rand<int>( -9, 9 );
+      }
+   }
+
+   blaze::DynamicVector<double,blaze::columnVector> x( N );
+   for( size_t j=0UL; j<N; ++j ) {
+      x[j] = blaze::rand<int>( -9, 9 );
+   }
+
+   {
+      test_ = "Row-major CompressedSoAMatrix/dense vector multiplication";
+
+      const blaze::CompressedSoAMatrix<double,blaze::rowMajor> mat( ref );
+
+      const blaze::DynamicVector<double,blaze::columnVector> expected( ref * x );
+      blaze::DynamicVector<double,blaze::columnVector> y1( mat * x );
+      blaze::DynamicVector<double,blaze::columnVector> y2( M, 0.0 );
+      y2 += mat * x;
+      y2 += mat * x;
+      y2 -= mat * x;
+
+      if( y1 != expected || y2 != expected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y1 << "\n" << y2 << "\n"
+             << "   Expected result:\n" << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CompressedSoAMatrix submatrix/dense vector multiplication";
+
+      const blaze::CompressedSoAMatrix<double,blaze::rowMajor> mat( ref );
+
+      const blaze::DynamicVector<double,blaze::columnVector> expected( submatrix( ref, 3UL, 0UL, 40UL, N ) * x );
+      const blaze::DynamicVector<double,blaze::columnVector> y( submatrix( mat, 3UL, 0UL, 40UL, N ) * x );
+
+      if( y != expected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n" << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompressedSoAMatrix/dense vector multiplication";
+
+      const blaze::CompressedSoAMatrix<double,blaze::columnMajor> mat( ref );
+
+      const blaze::DynamicVector<double,blaze::columnVector> expected( ref * x );
+      const blaze::DynamicVector<double,blaze::columnVector> y( mat * x );
+
+      if( y != expected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n" << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CompressedSoAMatrix/CompressedSoAMatrix multiplication";
+
+      const blaze::CompressedMatrix<double,blaze::columnMajor> tref( ref );
+      const blaze::CompressedSoAMatrix<double,blaze::rowMajor> lhs( ref );
+      const blaze::CompressedSoAMatrix<double,blaze::columnMajor> rhs( ref );
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> expected( ref * trans( tref ) );
+      const blaze::CompressedSoAMatrix<double,blaze::rowMajor> result( lhs * trans( rhs ) );
+
+      if( result != expected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << result << "\n"
+             << "   Expected result:\n" << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace compressedsoamatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CompressedSoAMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_COMPRESSEDSOAMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CompressedSoAMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
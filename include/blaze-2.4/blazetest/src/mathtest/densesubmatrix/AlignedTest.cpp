@@ -403,15 +403,15 @@ void AlignedTest::testAssignment()
 
       // Assigning to a 16x8 submatrix
       {
-         ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, 8UL, 16UL, 8UL );
-         USMT sm2 = submatrix<unaligned>( mat2_, 16UL, 8UL, 16UL, 8UL );
+         ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, block, 16UL, block );
+         USMT sm2 = submatrix<unaligned>( mat2_, 16UL, block, 16UL, block );
          sm1 = 15;
          sm2 = 15;
 
          checkRows   ( sm1, 16UL );
-         checkColumns( sm1,  8UL );
+         checkColumns( sm1, block );
          checkRows   ( sm2, 16UL );
-         checkColumns( sm2,  8UL );
+         checkColumns( sm2, block );
 
          if( sm1 != sm2 || mat1_ != mat2_ ) {
             std::ostringstream oss;
@@ -468,8 +468,8 @@ void AlignedTest::testAssignment()
 
       ASMT sm1 = submatrix<aligned>  ( mat1_, 8UL, 16UL, 8UL, 16UL );
       USMT sm2 = submatrix<unaligned>( mat2_, 8UL, 16UL, 8UL, 16UL );
-      sm1 = submatrix<aligned>  ( mat1_, 24UL, 24UL, 8UL, 16UL );
-      sm2 = submatrix<unaligned>( mat2_, 24UL, 24UL, 8UL, 16UL );
+      sm1 = submatrix<aligned>  ( mat1_, 24UL, 3UL*block, 8UL, 16UL );
+      sm2 = submatrix<unaligned>( mat2_, 24UL, 3UL*block, 8UL, 16UL );
 
       checkRows   ( sm1,  8UL );
       checkColumns( sm1, 16UL );
@@ -629,14 +629,14 @@ void AlignedTest::testAssignment()
 
       // Assigning to a 8x16 submatrix
       {
-         AOSMT sm1 = submatrix<aligned>  ( tmat1_, 8UL, 16UL, 8UL, 16UL );
-         UOSMT sm2 = submatrix<unaligned>( tmat2_, 8UL, 16UL, 8UL, 16UL );
+         AOSMT sm1 = submatrix<aligned>  ( tmat1_, block, 16UL, block, 16UL );
+         UOSMT sm2 = submatrix<unaligned>( tmat2_, block, 16UL, block, 16UL );
          sm1 = 12;
          sm2 = 12;
 
-         checkRows   ( sm1,  8UL );
+         checkRows   ( sm1, block );
          checkColumns( sm1, 16UL );
-         checkRows   ( sm2,  8UL );
+         checkRows   ( sm2, block );
          checkColumns( sm2, 16UL );
 
          if( sm1 != sm2 || mat1_ != mat2_ ) {
@@ -717,8 +717,8 @@ void AlignedTest::testAssignment()
 
       AOSMT sm1 = submatrix<aligned>  ( tmat1_, 16UL, 8UL, 16UL, 8UL );
       UOSMT sm2 = submatrix<unaligned>( tmat2_, 16UL, 8UL, 16UL, 8UL );
-      sm1 = submatrix<aligned>  ( tmat1_, 24UL, 24UL, 16UL, 8UL );
-      sm2 = submatrix<unaligned>( tmat2_, 24UL, 24UL, 16UL, 8UL );
+      sm1 = submatrix<aligned>  ( tmat1_, 3UL*block, 24UL, 16UL, 8UL );
+      sm2 = submatrix<unaligned>( tmat2_, 3UL*block, 24UL, 16UL, 8UL );
 
       checkRows   ( sm1, 16UL );
       checkColumns( sm1,  8UL );
@@ -927,8 +927,8 @@ void AlignedTest::testAddAssign()
 
       ASMT sm1 = submatrix<aligned>  ( mat1_, 8UL, 16UL, 8UL, 16UL );
       USMT sm2 = submatrix<unaligned>( mat2_, 8UL, 16UL, 8UL, 16UL );
-      sm1 += submatrix<aligned>  ( mat1_, 24UL, 24UL, 8UL, 16UL );
-      sm2 += submatrix<unaligned>( mat2_, 24UL, 24UL, 8UL, 16UL );
+      sm1 += submatrix<aligned>  ( mat1_, 24UL, 3UL*block, 8UL, 16UL );
+      sm2 += submatrix<unaligned>( mat2_, 24UL, 3UL*block, 8UL, 16UL );
 
       checkRows   ( sm1,  8UL );
       checkColumns( sm1, 16UL );
@@ -1119,8 +1119,8 @@ void AlignedTest::testAddAssign()
 
       AOSMT sm1 = submatrix<aligned>  ( tmat1_, 16UL, 8UL, 16UL, 8UL );
       UOSMT sm2 = submatrix<unaligned>( tmat2_, 16UL, 8UL, 16UL, 8UL );
-      sm1 += submatrix<aligned>  ( tmat1_, 24UL, 24UL, 16UL, 8UL );
-      sm2 += submatrix<unaligned>( tmat2_, 24UL, 24UL, 16UL, 8UL );
+      sm1 += submatrix<aligned>  ( tmat1_, 3UL*block, 24UL, 16UL, 8UL );
+      sm2 += submatrix<unaligned>( tmat2_, 3UL*block, 24UL, 16UL, 8UL );
 
       checkRows   ( sm1, 16UL );
       checkColumns( sm1,  8UL );
@@ -1329,8 +1329,8 @@ void AlignedTest::testSubAssign()
 
       ASMT sm1 = submatrix<aligned>  ( mat1_, 8UL, 16UL, 8UL, 16UL );
       USMT sm2 = submatrix<unaligned>( mat2_, 8UL, 16UL, 8UL, 16UL );
-      sm1 -= submatrix<aligned>  ( mat1_, 24UL, 24UL, 8UL, 16UL );
-      sm2 -= submatrix<unaligned>( mat2_, 24UL, 24UL, 8UL, 16UL );
+      sm1 -= submatrix<aligned>  ( mat1_, 24UL, 3UL*block, 8UL, 16UL );
+      sm2 -= submatrix<unaligned>( mat2_, 24UL, 3UL*block, 8UL, 16UL );
 
       checkRows   ( sm1,  8UL );
       checkColumns( sm1, 16UL );
@@ -1521,8 +1521,8 @@ void AlignedTest::testSubAssign()
 
       AOSMT sm1 = submatrix<aligned>  ( tmat1_, 16UL, 8UL, 16UL, 8UL );
       UOSMT sm2 = submatrix<unaligned>( tmat2_, 16UL, 8UL, 16UL, 8UL );
-      sm1 -= submatrix<aligned>  ( tmat1_, 24UL, 24UL, 16UL, 8UL );
-      sm2 -= submatrix<unaligned>( tmat2_, 24UL, 24UL, 16UL, 8UL );
+      sm1 -= submatrix<aligned>  ( tmat1_, 3UL*block, 24UL, 16UL, 8UL );
+      sm2 -= submatrix<unaligned>( tmat2_, 3UL*block, 24UL, 16UL, 8UL );
 
       checkRows   ( sm1, 16UL );
       checkColumns( sm1,  8UL );
@@ -1703,15 +1703,15 @@ void AlignedTest::testMultAssign()
       randomize( mat1, int(randmin), int(randmax) );
       mat2 = mat1;
 
-      ASMT sm1 = submatrix<aligned>  ( mat1, 16UL, 16UL, 8UL, 8UL );
-      USMT sm2 = submatrix<unaligned>( mat2, 16UL, 16UL, 8UL, 8UL );
-      sm1 *= submatrix<aligned>  ( mat1_, 16UL, 16UL, 8UL, 8UL );
-      sm2 *= submatrix<unaligned>( mat2_, 16UL, 16UL, 8UL, 8UL );
+      ASMT sm1 = submatrix<aligned>  ( mat1, 16UL, 16UL, block, block );
+      USMT sm2 = submatrix<unaligned>( mat2, 16UL, 16UL, block, block );
+      sm1 *= submatrix<aligned>  ( mat1_, 16UL, 16UL, block, block );
+      sm2 *= submatrix<unaligned>( mat2_, 16UL, 16UL, block, block );
 
-      checkRows   ( sm1, 8UL );
-      checkColumns( sm1, 8UL );
-      checkRows   ( sm2, 8UL );
-      checkColumns( sm2, 8UL );
+      checkRows   ( sm1, block );
+      checkColumns( sm1, block );
+      checkRows   ( sm2, block );
+      checkColumns( sm2, block );
 
       if( sm1 != sm2 || mat1_ != mat2_ ) {
          std::ostringstream oss;
@@ -1729,15 +1729,15 @@ void AlignedTest::testMultAssign()
 
       initialize();
 
-      ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, 16UL, 8UL, 8UL );
-      USMT sm2 = submatrix<unaligned>( mat2_, 16UL, 16UL, 8UL, 8UL );
-      sm1 *= submatrix<aligned>  ( mat1_, 24UL, 24UL, 8UL, 8UL );
-      sm2 *= submatrix<unaligned>( mat2_, 24UL, 24UL, 8UL, 8UL );
+      ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, 16UL, block, block );
+      USMT sm2 = submatrix<unaligned>( mat2_, 16UL, 16UL, block, block );
+      sm1 *= submatrix<aligned>  ( mat1_, 24UL, 3UL*block, block, block );
+      sm2 *= submatrix<unaligned>( mat2_, 24UL, 3UL*block, block, block );
 
-      checkRows   ( sm1, 8UL );
-      checkColumns( sm1, 8UL );
-      checkRows   ( sm2, 8UL );
-      checkColumns( sm2, 8UL );
+      checkRows   ( sm1, block );
+      checkColumns( sm1, block );
+      checkRows   ( sm2, block );
+      checkColumns( sm2, block );
 
       if( sm1 != sm2 || mat1_ != mat2_ ) {
          std::ostringstream oss;
@@ -1760,19 +1760,19 @@ void AlignedTest::testMultAssign()
 
       initialize();
 
-      ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, 16UL, 8UL, 8UL );
-      USMT sm2 = submatrix<unaligned>( mat2_, 16UL, 16UL, 8UL, 8UL );
+      ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, 16UL, block, block );
+      USMT sm2 = submatrix<unaligned>( mat2_, 16UL, 16UL, block, block );
 
-      blaze::DynamicMatrix<int,blaze::rowMajor> mat( 8UL, 8UL );
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat( block, block );
       randomize( mat, int(randmin), int(randmax) );
 
       sm1 *= mat;
       sm2 *= mat;
 
-      checkRows   ( sm1, 8UL );
-      checkColumns( sm1, 8UL );
-      checkRows   ( sm2, 8UL );
-      checkColumns( sm2, 8UL );
+      checkRows   ( sm1, block );
+      checkColumns( sm1, block );
+      checkRows   ( sm2, block );
+      checkColumns( sm2, block );
 
       if( sm1 != sm2 || mat1_ != mat2_ ) {
          std::ostringstream oss;
@@ -1790,19 +1790,19 @@ void AlignedTest::testMultAssign()
 
       initialize();
 
-      ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, 16UL, 8UL, 8UL );
-      USMT sm2 = submatrix<unaligned>( mat2_, 16UL, 16UL, 8UL, 8UL );
+      ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, 16UL, block, block );
+      USMT sm2 = submatrix<unaligned>( mat2_, 16UL, 16UL, block, block );
 
-      blaze::DynamicMatrix<int,blaze::columnMajor> mat( 8UL, 8UL );
+      blaze::DynamicMatrix<int,blaze::columnMajor> mat( block, block );
       randomize( mat, int(randmin), int(randmax) );
 
       sm1 *= mat;
       sm2 *= mat;
 
-      checkRows   ( sm1, 8UL );
-      checkColumns( sm1, 8UL );
-      checkRows   ( sm2, 8UL );
-      checkColumns( sm2, 8UL );
+      checkRows   ( sm1, block );
+      checkColumns( sm1, block );
+      checkRows   ( sm2, block );
+      checkColumns( sm2, block );
 
       if( sm1 != sm2 || mat1_ != mat2_ ) {
          std::ostringstream oss;
@@ -1825,19 +1825,19 @@ void AlignedTest::testMultAssign()
 
       initialize();
 
-      ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, 16UL, 8UL, 8UL );
-      USMT sm2 = submatrix<unaligned>( mat2_, 16UL, 16UL, 8UL, 8UL );
+      ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, 16UL, block, block );
+      USMT sm2 = submatrix<unaligned>( mat2_, 16UL, 16UL, block, block );
 
-      blaze::CompressedMatrix<int,blaze::rowMajor> mat( 8UL, 8UL );
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat( block, block );
       randomize( mat, 30UL, int(randmin), int(randmax) );
 
       sm1 *= mat;
       sm2 *= mat;
 
-      checkRows   ( sm1, 8UL );
-      checkColumns( sm1, 8UL );
-      checkRows   ( sm2, 8UL );
-      checkColumns( sm2, 8UL );
+      checkRows   ( sm1, block );
+      checkColumns( sm1, block );
+      checkRows   ( sm2, block );
+      checkColumns( sm2, block );
 
       if( sm1 != sm2 || mat1_ != mat2_ ) {
          std::ostringstream oss;
@@ -1855,19 +1855,19 @@ void AlignedTest::testMultAssign()
 
       initialize();
 
-      ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, 16UL, 8UL, 8UL );
-      USMT sm2 = submatrix<unaligned>( mat2_, 16UL, 16UL, 8UL, 8UL );
+      ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, 16UL, block, block );
+      USMT sm2 = submatrix<unaligned>( mat2_, 16UL, 16UL, block, block );
 
-      blaze::CompressedMatrix<int,blaze::columnMajor> mat( 8UL, 8UL );
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat( block, block );
       randomize( mat, 30UL, int(randmin), int(randmax) );
 
       sm1 *= mat;
       sm2 *= mat;
 
-      checkRows   ( sm1, 8UL );
-      checkColumns( sm1, 8UL );
-      checkRows   ( sm2, 8UL );
-      checkColumns( sm2, 8UL );
+      checkRows   ( sm1, block );
+      checkColumns( sm1, block );
+      checkRows   ( sm2, block );
+      checkColumns( sm2, block );
 
       if( sm1 != sm2 || mat1_ != mat2_ ) {
          std::ostringstream oss;
@@ -1895,15 +1895,15 @@ void AlignedTest::testMultAssign()
       randomize( mat1, int(randmin), int(randmax) );
       mat2 = mat1;
 
-      AOSMT sm1 = submatrix<aligned>  ( mat1, 16UL, 16UL, 8UL, 8UL );
-      UOSMT sm2 = submatrix<unaligned>( mat2, 16UL, 16UL, 8UL, 8UL );
-      sm1 *= submatrix<aligned>  ( tmat1_, 16UL, 16UL, 8UL, 8UL );
-      sm2 *= submatrix<unaligned>( tmat2_, 16UL, 16UL, 8UL, 8UL );
+      AOSMT sm1 = submatrix<aligned>  ( mat1, 16UL, 16UL, block, block );
+      UOSMT sm2 = submatrix<unaligned>( mat2, 16UL, 16UL, block, block );
+      sm1 *= submatrix<aligned>  ( tmat1_, 16UL, 16UL, block, block );
+      sm2 *= submatrix<unaligned>( tmat2_, 16UL, 16UL, block, block );
 
-      checkRows   ( sm1, 8UL );
-      checkColumns( sm1, 8UL );
-      checkRows   ( sm2, 8UL );
-      checkColumns( sm2, 8UL );
+      checkRows   ( sm1, block );
+      checkColumns( sm1, block );
+      checkRows   ( sm2, block );
+      checkColumns( sm2, block );
 
       if( sm1 != sm2 || mat1_ != mat2_ ) {
          std::ostringstream oss;
@@ -1921,15 +1921,15 @@ void AlignedTest::testMultAssign()
 
       initialize();
 
-      AOSMT sm1 = submatrix<aligned>  ( tmat1_, 16UL, 16UL, 8UL, 8UL );
-      UOSMT sm2 = submatrix<unaligned>( tmat2_, 16UL, 16UL, 8UL, 8UL );
-      sm1 *= submatrix<aligned>  ( tmat1_, 24UL, 24UL, 8UL, 8UL );
-      sm2 *= submatrix<unaligned>( tmat2_, 24UL, 24UL, 8UL, 8UL );
+      AOSMT sm1 = submatrix<aligned>  ( tmat1_, 16UL, 16UL, block, block );
+      UOSMT sm2 = submatrix<unaligned>( tmat2_, 16UL, 16UL, block, block );
+      sm1 *= submatrix<aligned>  ( tmat1_, 3UL*block, 24UL, block, block );
+      sm2 *= submatrix<unaligned>( tmat2_, 3UL*block, 24UL, block, block );
 
-      checkRows   ( sm1, 8UL );
-      checkColumns( sm1, 8UL );
-      checkRows   ( sm2, 8UL );
-      checkColumns( sm2, 8UL );
+      checkRows   ( sm1, block );
+      checkColumns( sm1, block );
+      checkRows   ( sm2, block );
+      checkColumns( sm2, block );
 
       if( sm1 != sm2 || mat1_ != mat2_ ) {
          std::ostringstream oss;
@@ -1952,19 +1952,19 @@ void AlignedTest::testMultAssign()
 
       initialize();
 
-      AOSMT sm1 = submatrix<aligned>  ( tmat1_, 16UL, 16UL, 8UL, 8UL );
-      UOSMT sm2 = submatrix<unaligned>( tmat2_, 16UL, 16UL, 8UL, 8UL );
+      AOSMT sm1 = submatrix<aligned>  ( tmat1_, 16UL, 16UL, block, block );
+      UOSMT sm2 = submatrix<unaligned>( tmat2_, 16UL, 16UL, block, block );
 
-      blaze::DynamicMatrix<int,blaze::rowMajor> mat( 8UL, 8UL );
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat( block, block );
       randomize( mat, int(randmin), int(randmax) );
 
       sm1 *= mat;
       sm2 *= mat;
 
-      checkRows   ( sm1, 8UL );
-      checkColumns( sm1, 8UL );
-      checkRows   ( sm2, 8UL );
-      checkColumns( sm2, 8UL );
+      checkRows   ( sm1, block );
+      checkColumns( sm1, block );
+      checkRows   ( sm2, block );
+      checkColumns( sm2, block );
 
       if( sm1 != sm2 || mat1_ != mat2_ ) {
          std::ostringstream oss;
@@ -1982,19 +1982,19 @@ void AlignedTest::testMultAssign()
 
       initialize();
 
-      AOSMT sm1 = submatrix<aligned>  ( tmat1_, 16UL, 16UL, 8UL, 8UL );
-      UOSMT sm2 = submatrix<unaligned>( tmat2_, 16UL, 16UL, 8UL, 8UL );
+      AOSMT sm1 = submatrix<aligned>  ( tmat1_, 16UL, 16UL, block, block );
+      UOSMT sm2 = submatrix<unaligned>( tmat2_, 16UL, 16UL, block, block );
 
-      blaze::DynamicMatrix<int,blaze::columnMajor> mat( 8UL, 8UL );
+      blaze::DynamicMatrix<int,blaze::columnMajor> mat( block, block );
       randomize( mat, int(randmin), int(randmax) );
 
       sm1 *= mat;
       sm2 *= mat;
 
-      checkRows   ( sm1, 8UL );
-      checkColumns( sm1, 8UL );
-      checkRows   ( sm2, 8UL );
-      checkColumns( sm2, 8UL );
+      checkRows   ( sm1, block );
+      checkColumns( sm1, block );
+      checkRows   ( sm2, block );
+      checkColumns( sm2, block );
 
       if( sm1 != sm2 || mat1_ != mat2_ ) {
          std::ostringstream oss;
@@ -2017,19 +2017,19 @@ void AlignedTest::testMultAssign()
 
       initialize();
 
-      AOSMT sm1 = submatrix<aligned>  ( tmat1_, 16UL, 16UL, 8UL, 8UL );
-      UOSMT sm2 = submatrix<unaligned>( tmat2_, 16UL, 16UL, 8UL, 8UL );
+      AOSMT sm1 = submatrix<aligned>  ( tmat1_, 16UL, 16UL, block, block );
+      UOSMT sm2 = submatrix<unaligned>( tmat2_, 16UL, 16UL, block, block );
 
-      blaze::CompressedMatrix<int,blaze::rowMajor> mat( 8UL, 8UL );
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat( block, block );
       randomize( mat, 30UL, int(randmin), int(randmax) );
 
       sm1 *= mat;
       sm2 *= mat;
 
-      checkRows   ( sm1, 8UL );
-      checkColumns( sm1, 8UL );
-      checkRows   ( sm2, 8UL );
-      checkColumns( sm2, 8UL );
+      checkRows   ( sm1, block );
+      checkColumns( sm1, block );
+      checkRows   ( sm2, block );
+      checkColumns( sm2, block );
 
       if( sm1 != sm2 || mat1_ != mat2_ ) {
          std::ostringstream oss;
@@ -2047,19 +2047,19 @@ void AlignedTest::testMultAssign()
 
       initialize();
 
-      AOSMT sm1 = submatrix<aligned>  ( tmat1_, 16UL, 16UL, 8UL, 8UL );
-      UOSMT sm2 = submatrix<unaligned>( tmat2_, 16UL, 16UL, 8UL, 8UL );
+      AOSMT sm1 = submatrix<aligned>  ( tmat1_, 16UL, 16UL, block, block );
+      UOSMT sm2 = submatrix<unaligned>( tmat2_, 16UL, 16UL, block, block );
 
-      blaze::CompressedMatrix<int,blaze::columnMajor> mat( 8UL, 8UL );
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat( block, block );
       randomize( mat, 30UL, int(randmin), int(randmax) );
 
       sm1 *= mat;
       sm2 *= mat;
 
-      checkRows   ( sm1, 8UL );
-      checkColumns( sm1, 8UL );
-      checkRows   ( sm2, 8UL );
-      checkColumns( sm2, 8UL );
+      checkRows   ( sm1, block );
+      checkColumns( sm1, block );
+      checkRows   ( sm2, block );
+      checkColumns( sm2, block );
 
       if( sm1 != sm2 || mat1_ != mat2_ ) {
          std::ostringstream oss;
@@ -2127,16 +2127,16 @@ void AlignedTest::testScaling()
 
       initialize();
 
-      ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, 8UL, 16UL, 8UL );
-      USMT sm2 = submatrix<unaligned>( mat2_, 16UL, 8UL, 16UL, 8UL );
+      ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, block, 16UL, block );
+      USMT sm2 = submatrix<unaligned>( mat2_, 16UL, block, 16UL, block );
 
       sm1 *= 3;
       sm2 *= 3;
 
       checkRows   ( sm1, 16UL );
-      checkColumns( sm1,  8UL );
+      checkColumns( sm1, block );
       checkRows   ( sm2, 16UL );
-      checkColumns( sm2,  8UL );
+      checkColumns( sm2, block );
 
       if( sm1 != sm2 || mat1_ != mat2_ ) {
          std::ostringstream oss;
@@ -2186,16 +2186,16 @@ void AlignedTest::testScaling()
 
       initialize();
 
-      ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, 8UL, 16UL, 8UL );
-      USMT sm2 = submatrix<unaligned>( mat2_, 16UL, 8UL, 16UL, 8UL );
+      ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, block, 16UL, block );
+      USMT sm2 = submatrix<unaligned>( mat2_, 16UL, block, 16UL, block );
 
       sm1 = sm1 * 3;
       sm2 = sm2 * 3;
 
       checkRows   ( sm1, 16UL );
-      checkColumns( sm1,  8UL );
+      checkColumns( sm1, block );
       checkRows   ( sm2, 16UL );
-      checkColumns( sm2,  8UL );
+      checkColumns( sm2, block );
 
       if( sm1 != sm2 || mat1_ != mat2_ ) {
          std::ostringstream oss;
@@ -2245,16 +2245,16 @@ void AlignedTest::testScaling()
 
       initialize();
 
-      ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, 8UL, 16UL, 8UL );
-      USMT sm2 = submatrix<unaligned>( mat2_, 16UL, 8UL, 16UL, 8UL );
+      ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, block, 16UL, block );
+      USMT sm2 = submatrix<unaligned>( mat2_, 16UL, block, 16UL, block );
 
       sm1 = 3 * sm1;
       sm2 = 3 * sm2;
 
       checkRows   ( sm1, 16UL );
-      checkColumns( sm1,  8UL );
+      checkColumns( sm1, block );
       checkRows   ( sm2, 16UL );
-      checkColumns( sm2,  8UL );
+      checkColumns( sm2, block );
 
       if( sm1 != sm2 || mat1_ != mat2_ ) {
          std::ostringstream oss;
@@ -2304,16 +2304,16 @@ void AlignedTest::testScaling()
 
       initialize();
 
-      ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, 8UL, 16UL, 8UL );
-      USMT sm2 = submatrix<unaligned>( mat2_, 16UL, 8UL, 16UL, 8UL );
+      ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, block, 16UL, block );
+      USMT sm2 = submatrix<unaligned>( mat2_, 16UL, block, 16UL, block );
 
       sm1 /= 0.5;
       sm2 /= 0.5;
 
       checkRows   ( sm1, 16UL );
-      checkColumns( sm1,  8UL );
+      checkColumns( sm1, block );
       checkRows   ( sm2, 16UL );
-      checkColumns( sm2,  8UL );
+      checkColumns( sm2, block );
 
       if( sm1 != sm2 || mat1_ != mat2_ ) {
          std::ostringstream oss;
@@ -2363,16 +2363,16 @@ void AlignedTest::testScaling()
 
       initialize();
 
-      ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, 8UL, 16UL, 8UL );
-      USMT sm2 = submatrix<unaligned>( mat2_, 16UL, 8UL, 16UL, 8UL );
+      ASMT sm1 = submatrix<aligned>  ( mat1_, 16UL, block, 16UL, block );
+      USMT sm2 = submatrix<unaligned>( mat2_, 16UL, block, 16UL, block );
 
       sm1 = sm1 / 0.5;
       sm2 = sm2 / 0.5;
 
       checkRows   ( sm1, 16UL );
-      checkColumns( sm1,  8UL );
+      checkColumns( sm1, block );
       checkRows   ( sm2, 16UL );
-      checkColumns( sm2,  8UL );
+      checkColumns( sm2, block );
 
       if( sm1 != sm2 || mat1_ != mat2_ ) {
          std::ostringstream oss;
@@ -2453,15 +2453,15 @@ void AlignedTest::testScaling()
 
       initialize();
 
-      AOSMT sm1 = submatrix<aligned>  ( tmat1_, 8UL, 16UL, 8UL, 16UL );
-      UOSMT sm2 = submatrix<unaligned>( tmat2_, 8UL, 16UL, 8UL, 16UL );
+      AOSMT sm1 = submatrix<aligned>  ( tmat1_, block, 16UL, block, 16UL );
+      UOSMT sm2 = submatrix<unaligned>( tmat2_, block, 16UL, block, 16UL );
 
       sm1 *= 3;
       sm2 *= 3;
 
-      checkRows   ( sm1,  8UL );
+      checkRows   ( sm1, block );
       checkColumns( sm1, 16UL );
-      checkRows   ( sm2,  8UL );
+      checkRows   ( sm2, block );
       checkColumns( sm2, 16UL );
 
       if( sm1 != sm2 || mat1_ != mat2_ ) {
@@ -2512,15 +2512,15 @@ void AlignedTest::testScaling()
 
       initialize();
 
-      AOSMT sm1 = submatrix<aligned>  ( tmat1_, 8UL, 16UL, 8UL, 16UL );
-      UOSMT sm2 = submatrix<unaligned>( tmat2_, 8UL, 16UL, 8UL, 16UL );
+      AOSMT sm1 = submatrix<aligned>  ( tmat1_, block, 16UL, block, 16UL );
+      UOSMT sm2 = submatrix<unaligned>( tmat2_, block, 16UL, block, 16UL );
 
       sm1 = sm1 * 3;
       sm2 = sm2 * 3;
 
-      checkRows   ( sm1,  8UL );
+      checkRows   ( sm1, block );
       checkColumns( sm1, 16UL );
-      checkRows   ( sm2,  8UL );
+      checkRows   ( sm2, block );
       checkColumns( sm2, 16UL );
 
       if( sm1 != sm2 || mat1_ != mat2_ ) {
@@ -2571,15 +2571,15 @@ void AlignedTest::testScaling()
 
       initialize();
 
-      AOSMT sm1 = submatrix<aligned>  ( tmat1_, 8UL, 16UL, 8UL, 16UL );
-      UOSMT sm2 = submatrix<unaligned>( tmat2_, 8UL, 16UL, 8UL, 16UL );
+      AOSMT sm1 = submatrix<aligned>  ( tmat1_, block, 16UL, block, 16UL );
+      UOSMT sm2 = submatrix<unaligned>( tmat2_, block, 16UL, block, 16UL );
 
       sm1 = 3 * sm1;
       sm2 = 3 * sm2;
 
-      checkRows   ( sm1,  8UL );
+      checkRows   ( sm1, block );
       checkColumns( sm1, 16UL );
-      checkRows   ( sm2,  8UL );
+      checkRows   ( sm2, block );
       checkColumns( sm2, 16UL );
 
       if( sm1 != sm2 || mat1_ != mat2_ ) {
@@ -2630,15 +2630,15 @@ void AlignedTest::testScaling()
 
       initialize();
 
-      AOSMT sm1 = submatrix<aligned>  ( tmat1_, 8UL, 16UL, 8UL, 16UL );
-      UOSMT sm2 = submatrix<unaligned>( tmat2_, 8UL, 16UL, 8UL, 16UL );
+      AOSMT sm1 = submatrix<aligned>  ( tmat1_, block, 16UL, block, 16UL );
+      UOSMT sm2 = submatrix<unaligned>( tmat2_, block, 16UL, block, 16UL );
 
       sm1 /= 0.5;
       sm2 /= 0.5;
 
-      checkRows   ( sm1,  8UL );
+      checkRows   ( sm1, block );
       checkColumns( sm1, 16UL );
-      checkRows   ( sm2,  8UL );
+      checkRows   ( sm2, block );
       checkColumns( sm2, 16UL );
 
       if( sm1 != sm2 || mat1_ != mat2_ ) {
@@ -2689,15 +2689,15 @@ void AlignedTest::testScaling()
 
       initialize();
 
-      AOSMT sm1 = submatrix<aligned>  ( tmat1_, 8UL, 16UL, 8UL, 16UL );
-      UOSMT sm2 = submatrix<unaligned>( tmat2_, 8UL, 16UL, 8UL, 16UL );
+      AOSMT sm1 = submatrix<aligned>  ( tmat1_, block, 16UL, block, 16UL );
+      UOSMT sm2 = submatrix<unaligned>( tmat2_, block, 16UL, block, 16UL );
 
       sm1 = sm1 / 0.5;
       sm2 = sm2 / 0.5;
 
-      checkRows   ( sm1,  8UL );
+      checkRows   ( sm1, block );
       checkColumns( sm1, 16UL );
-      checkRows   ( sm2,  8UL );
+      checkRows   ( sm2, block );
       checkColumns( sm2, 16UL );
 
       if( sm1 != sm2 || mat1_ != mat2_ ) {
@@ -3200,16 +3200,16 @@ void AlignedTest::testIterator()
       {
          test_ = "Row-major ConstIterator subtraction";
 
-         ASMT sm = submatrix<aligned>( mat1_, 16UL, 8UL, 16UL, 8UL );
+         ASMT sm = submatrix<aligned>( mat1_, 16UL, block, 16UL, block );
          const size_t number( cend( sm, 15UL ) - cbegin( sm, 15UL ) );
 
-         if( number != 8UL ) {
+         if( number != block ) {
             std::ostringstream oss;
             oss << " Test: " << test_ << "\n"
                 << " Error: Invalid number of elements detected\n"
                 << " Details:\n"
                 << "   Number of elements         : " << number << "\n"
-                << "   Expected number of elements: 8\n";
+                << "   Expected number of elements: " << block << "\n";
             throw std::runtime_error( oss.str() );
          }
       }
@@ -3462,7 +3462,7 @@ void AlignedTest::testIterator()
       {
          test_ = "Column-major Iterator/ConstIterator conversion";
 
-         AOSMT sm = submatrix<aligned>( tmat1_, 8UL, 16UL, 8UL, 16UL );
+         AOSMT sm = submatrix<aligned>( tmat1_, block, 16UL, block, 16UL );
          AOSMT::ConstIterator it( begin( sm, 2UL ) );
 
          if( it == end( sm, 2UL ) || *it != sm(0,2) ) {
@@ -3495,16 +3495,16 @@ void AlignedTest::testIterator()
       {
          test_ = "Column-major ConstIterator subtraction";
 
-         AOSMT sm = submatrix<aligned>( tmat1_, 8UL, 16UL, 8UL, 16UL );
+         AOSMT sm = submatrix<aligned>( tmat1_, block, 16UL, block, 16UL );
          const size_t number( cend( sm, 15UL ) - cbegin( sm, 15UL ) );
 
-         if( number != 8UL ) {
+         if( number != block ) {
             std::ostringstream oss;
             oss << " Test: " << test_ << "\n"
                 << " Error: Invalid number of elements detected\n"
                 << " Details:\n"
                 << "   Number of elements         : " << number << "\n"
-                << "   Expected number of elements: 8\n";
+                << "   Expected number of elements: " << block << "\n";
             throw std::runtime_error( oss.str() );
          }
       }
@@ -4174,16 +4174,16 @@ void AlignedTest::testTranspose()
 
       initialize();
 
-      ASMT sm1 = submatrix<aligned>  ( mat1_, 8UL, 16UL, 8UL, 8UL );
-      USMT sm2 = submatrix<unaligned>( mat2_, 8UL, 16UL, 8UL, 8UL );
+      ASMT sm1 = submatrix<aligned>  ( mat1_, 8UL, 16UL, block, block );
+      USMT sm2 = submatrix<unaligned>( mat2_, 8UL, 16UL, block, block );
 
       sm1.transpose();
       sm2.transpose();
 
-      checkRows   ( sm1, 8UL );
-      checkColumns( sm1, 8UL );
-      checkRows   ( sm2, 8UL );
-      checkColumns( sm2, 8UL );
+      checkRows   ( sm1, block );
+      checkColumns( sm1, block );
+      checkRows   ( sm2, block );
+      checkColumns( sm2, block );
 
       if( sm1 != sm2 || mat1_ != mat2_ ) {
          std::ostringstream oss;
@@ -4201,16 +4201,16 @@ void AlignedTest::testTranspose()
 
       initialize();
 
-      ASMT sm1 = submatrix<aligned>  ( mat1_, 8UL, 16UL, 8UL, 8UL );
-      USMT sm2 = submatrix<unaligned>( mat2_, 8UL, 16UL, 8UL, 8UL );
+      ASMT sm1 = submatrix<aligned>  ( mat1_, 8UL, 16UL, block, block );
+      USMT sm2 = submatrix<unaligned>( mat2_, 8UL, 16UL, block, block );
 
       sm1 = trans( sm1 );
       sm2 = trans( sm2 );
 
-      checkRows   ( sm1, 8UL );
-      checkColumns( sm1, 8UL );
-      checkRows   ( sm2, 8UL );
-      checkColumns( sm2, 8UL );
+      checkRows   ( sm1, block );
+      checkColumns( sm1, block );
+      checkRows   ( sm2, block );
+      checkColumns( sm2, block );
 
       if( sm1 != sm2 || mat1_ != mat2_ ) {
          std::ostringstream oss;
@@ -4233,16 +4233,16 @@ void AlignedTest::testTranspose()
 
       initialize();
 
-      AOSMT sm1 = submatrix<aligned>  ( tmat1_, 16UL, 8UL, 8UL, 8UL );
-      UOSMT sm2 = submatrix<unaligned>( tmat2_, 16UL, 8UL, 8UL, 8UL );
+      AOSMT sm1 = submatrix<aligned>  ( tmat1_, 16UL, 8UL, block, block );
+      UOSMT sm2 = submatrix<unaligned>( tmat2_, 16UL, 8UL, block, block );
 
       sm1.transpose();
       sm2.transpose();
 
-      checkRows   ( sm1, 8UL );
-      checkColumns( sm1, 8UL );
-      checkRows   ( sm2, 8UL );
-      checkColumns( sm2, 8UL );
+      checkRows   ( sm1, block );
+      checkColumns( sm1, block );
+      checkRows   ( sm2, block );
+      checkColumns( sm2, block );
 
       if( sm1 != sm2 || mat1_ != mat2_ ) {
          std::ostringstream oss;
@@ -4260,16 +4260,16 @@ void AlignedTest::testTranspose()
 
       initialize();
 
-      AOSMT sm1 = submatrix<aligned>  ( tmat1_, 16UL, 8UL, 8UL, 8UL );
-      UOSMT sm2 = submatrix<unaligned>( tmat2_, 16UL, 8UL, 8UL, 8UL );
+      AOSMT sm1 = submatrix<aligned>  ( tmat1_, 16UL, 8UL, block, block );
+      UOSMT sm2 = submatrix<unaligned>( tmat2_, 16UL, 8UL, block, block );
 
       sm1 = trans( sm1 );
       sm2 = trans( sm2 );
 
-      checkRows   ( sm1, 8UL );
-      checkColumns( sm1, 8UL );
-      checkRows   ( sm2, 8UL );
-      checkColumns( sm2, 8UL );
+      checkRows   ( sm1, block );
+      checkColumns( sm1, block );
+      checkRows   ( sm2, block );
+      checkColumns( sm2, block );
 
       if( sm1 != sm2 || mat1_ != mat2_ ) {
          std::ostringstream oss;
@@ -4872,10 +4872,10 @@ void AlignedTest::testSubmatrix()
       initialize();
 
       {
-         ASMT sm1 = submatrix<aligned>  ( mat1_, 8UL, 8UL, 16UL, 32UL );
-         ASMT sm2 = submatrix<aligned>  ( sm1  , 8UL, 8UL,  8UL, 16UL );
-         USMT sm3 = submatrix<unaligned>( mat2_, 8UL, 8UL, 16UL, 32UL );
-         USMT sm4 = submatrix<unaligned>( sm3  , 8UL, 8UL,  8UL, 16UL );
+         ASMT sm1 = submatrix<aligned>  ( mat1_, 8UL, block, 16UL, 32UL );
+         ASMT sm2 = submatrix<aligned>  ( sm1  , 8UL, block,  8UL, 16UL );
+         USMT sm3 = submatrix<unaligned>( mat2_, 8UL, block, 16UL, 32UL );
+         USMT sm4 = submatrix<unaligned>( sm3  , 8UL, block,  8UL, 16UL );
 
          if( sm2 != sm4 || mat1_ != mat2_ ) {
             std::ostringstream oss;
@@ -4909,7 +4909,7 @@ void AlignedTest::testSubmatrix()
       }
 
       try {
-         ASMT sm1 = submatrix<aligned>( mat1_,  8UL, 8UL, 16UL, 32UL );
+         ASMT sm1 = submatrix<aligned>( mat1_,  8UL, block, 16UL, 32UL );
          ASMT sm2 = submatrix<aligned>( sm1  , 16UL, 8UL,  8UL,  8UL );
 
          std::ostringstream oss;
@@ -4922,7 +4922,7 @@ void AlignedTest::testSubmatrix()
       catch( std::invalid_argument& ) {}
 
       try {
-         ASMT sm1 = submatrix<aligned>( mat1_, 8UL,  8UL, 16UL, 32UL );
+         ASMT sm1 = submatrix<aligned>( mat1_, 8UL, block, 16UL, 32UL );
          ASMT sm2 = submatrix<aligned>( sm1  , 8UL, 32UL,  8UL,  8UL );
 
          std::ostringstream oss;
@@ -4935,7 +4935,7 @@ void AlignedTest::testSubmatrix()
       catch( std::invalid_argument& ) {}
 
       try {
-         ASMT sm1 = submatrix<aligned>( mat1_, 8UL, 8UL, 16UL, 32UL );
+         ASMT sm1 = submatrix<aligned>( mat1_, 8UL, block, 16UL, 32UL );
          ASMT sm2 = submatrix<aligned>( sm1  , 8UL, 8UL, 16UL, 24UL );
 
          std::ostringstream oss;
@@ -4948,7 +4948,7 @@ void AlignedTest::testSubmatrix()
       catch( std::invalid_argument& ) {}
 
       try {
-         ASMT sm1 = submatrix<aligned>( mat1_, 8UL, 8UL, 16UL, 32UL );
+         ASMT sm1 = submatrix<aligned>( mat1_, 8UL, block, 16UL, 32UL );
          ASMT sm2 = submatrix<aligned>( sm1  , 8UL, 8UL,  8UL, 32UL );
 
          std::ostringstream oss;
@@ -4972,10 +4972,10 @@ void AlignedTest::testSubmatrix()
       initialize();
 
       {
-         AOSMT sm1 = submatrix<aligned>  ( tmat1_, 8UL, 8UL, 32UL, 16UL );
-         AOSMT sm2 = submatrix<aligned>  ( sm1   , 8UL, 8UL, 16UL,  8UL );
-         UOSMT sm3 = submatrix<unaligned>( tmat2_, 8UL, 8UL, 32UL, 16UL );
-         UOSMT sm4 = submatrix<unaligned>( sm3   , 8UL, 8UL, 16UL,  8UL );
+         AOSMT sm1 = submatrix<aligned>  ( tmat1_, block, 8UL, 32UL, 16UL );
+         AOSMT sm2 = submatrix<aligned>  ( sm1   , block, 8UL, 16UL,  8UL );
+         UOSMT sm3 = submatrix<unaligned>( tmat2_, block, 8UL, 32UL, 16UL );
+         UOSMT sm4 = submatrix<unaligned>( sm3   , block, 8UL, 16UL,  8UL );
 
          if( sm2 != sm4 || mat1_ != mat2_ ) {
             std::ostringstream oss;
@@ -5009,7 +5009,7 @@ void AlignedTest::testSubmatrix()
       }
 
       try {
-         ASMT sm1 = submatrix<aligned>( mat1_,  8UL, 8UL, 32UL, 16UL );
+         ASMT sm1 = submatrix<aligned>( mat1_,  8UL, block, 32UL, 16UL );
          ASMT sm2 = submatrix<aligned>( sm1  , 32UL, 8UL,  8UL,  8UL );
 
          std::ostringstream oss;
@@ -5022,7 +5022,7 @@ void AlignedTest::testSubmatrix()
       catch( std::invalid_argument& ) {}
 
       try {
-         ASMT sm1 = submatrix<aligned>( mat1_, 8UL,  8UL, 32UL, 16UL );
+         ASMT sm1 = submatrix<aligned>( mat1_, 8UL, block, 32UL, 16UL );
          ASMT sm2 = submatrix<aligned>( sm1  , 8UL, 16UL,  8UL,  8UL );
 
          std::ostringstream oss;
@@ -5035,7 +5035,7 @@ void AlignedTest::testSubmatrix()
       catch( std::invalid_argument& ) {}
 
       try {
-         ASMT sm1 = submatrix<aligned>( mat1_, 8UL, 8UL, 32UL, 16UL );
+         ASMT sm1 = submatrix<aligned>( mat1_, 8UL, block, 32UL, 16UL );
          ASMT sm2 = submatrix<aligned>( sm1  , 8UL, 8UL, 32UL,  8UL );
 
          std::ostringstream oss;
@@ -5048,7 +5048,7 @@ void AlignedTest::testSubmatrix()
       catch( std::invalid_argument& ) {}
 
       try {
-         ASMT sm1 = submatrix<aligned>( mat1_, 8UL, 8UL, 32UL, 16UL );
+         ASMT sm1 = submatrix<aligned>( mat1_, 8UL, block, 32UL, 16UL );
          ASMT sm2 = submatrix<aligned>( sm1  , 8UL, 8UL, 24UL, 16UL );
 
          std::ostringstream oss;
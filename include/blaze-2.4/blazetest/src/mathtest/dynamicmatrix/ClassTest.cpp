@@ -42,6 +42,7 @@
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/DiagonalMatrix.h>
 #include <blaze/math/LowerMatrix.h>
+#include <blaze/math/smp/AsyncAssign.h>
 #include <blaze/math/StaticMatrix.h>
 #include <blaze/math/UpperMatrix.h>
 #include <blaze/util/Complex.h>
@@ -1947,6 +1948,91 @@ void ClassTest::testAssignment()
          throw std::runtime_error( oss.str() );
       }
    }
+
+
+   //=====================================================================================
+   // Asynchronous assignment
+   //=====================================================================================
+
+   {
+      test_ = "Row-major DynamicMatrix asynchronous assignment";
+
+      typedef blaze::DynamicMatrix<int,blaze::rowMajor>  RandomMatrixType;
+
+      const int min( randmin );
+      const int max( randmax );
+
+      for( size_t i=0UL; i<10UL; ++i )
+      {
+         const size_t n( blaze::rand<size_t>( 0UL, 100UL ) );
+         const RandomMatrixType A( blaze::rand<RandomMatrixType>( n, n, min, max ) );
+         const RandomMatrixType B( blaze::rand<RandomMatrixType>( n, n, min, max ) );
+         const RandomMatrixType C( blaze::rand<RandomMatrixType>( n, n, min, max ) );
+         const RandomMatrixType D( blaze::rand<RandomMatrixType>( n, n, min, max ) );
+
+         blaze::DynamicMatrix<int,blaze::rowMajor> mat1( n, n ), mat2( n, n ), mat3( n, n );
+
+         blaze::SMPFuture future1( blaze::asyncAssign( mat1, A + B ) );
+         blaze::SMPFuture future2( blaze::asyncAssign( mat2, C - D ) );
+         blaze::SMPFuture future3( blaze::asyncAssign( mat3, mat1 * mat2 ) );
+         blaze::SMPFuture future4( blaze::asyncAssign( mat1, trans( mat1 ) ) );
+
+         future3.wait();
+         future4.wait();
+
+         const RandomMatrixType ref( ( A + B ) * ( C - D ) );
+
+         if( !future1.isReady() || !future2.isReady() || mat3 != ref || mat1 != trans( A + B ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assignment failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat3 << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "Column-major DynamicMatrix asynchronous assignment";
+
+      typedef blaze::DynamicMatrix<int,blaze::columnMajor>  RandomMatrixType;
+
+      const int min( randmin );
+      const int max( randmax );
+
+      for( size_t i=0UL; i<10UL; ++i )
+      {
+         const size_t n( blaze::rand<size_t>( 0UL, 100UL ) );
+         const RandomMatrixType A( blaze::rand<RandomMatrixType>( n, n, min, max ) );
+         const RandomMatrixType B( blaze::rand<RandomMatrixType>( n, n, min, max ) );
+         const RandomMatrixType C( blaze::rand<RandomMatrixType>( n, n, min, max ) );
+         const RandomMatrixType D( blaze::rand<RandomMatrixType>( n, n, min, max ) );
+
+         blaze::DynamicMatrix<int,blaze::columnMajor> mat1( n, n ), mat2( n, n ), mat3( n, n );
+
+         blaze::SMPFuture future1( blaze::asyncAssign( mat1, A + B ) );
+         blaze::SMPFuture future2( blaze::asyncAssign( mat2, C - D ) );
+         blaze::SMPFuture future3( blaze::asyncAssign( mat3, mat1 * mat2 ) );
+         blaze::SMPFuture future4( blaze::asyncAssign( mat1, trans( mat1 ) ) );
+
+         future3.wait();
+         future4.wait();
+
+         const RandomMatrixType ref( ( A + B ) * ( C - D ) );
+
+         if( !future1.isReady() || !future2.isReady() || mat3 != ref || mat1 != trans( A + B ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assignment failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat3 << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
 }
 //*************************************************************************************************
 
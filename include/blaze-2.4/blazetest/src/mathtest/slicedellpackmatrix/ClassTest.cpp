@@ -0,0 +1,871 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/slicedellpackmatrix/ClassTest.cpp
+//  \brief Source file for the SlicedEllpackMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/DenseSubvector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SparseSubmatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/slicedellpackmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace slicedellpackmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SlicedEllpackMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testAddAssign();
+   testSubAssign();
+   testScaling();
+   testFunctionCall();
+   testIterator();
+   testFind();
+   testChunks();
+   testMultiplication();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SlicedEllpackMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the SlicedEllpackMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   // Default constructor
+   {
+      test_ = "SlicedEllpackMatrix default constructor";
+
+      blaze::SlicedEllpackMatrix<int,4UL> mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   // Size constructor
+   {
+      test_ = "SlicedEllpackMatrix size constructor";
+
+      blaze::SlicedEllpackMatrix<int,4UL> mat( 6UL, 9UL );
+
+      checkRows    ( mat, 6UL );
+      checkColumns ( mat, 9UL );
+      checkNonZeros( mat, 0UL );
+      checkNonZeros( mat, 5UL, 0UL );
+
+      if( mat.chunks() != 2UL || mat.chunkWidth( 0UL ) != 0UL || mat.chunkWidth( 1UL ) != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid chunks detected\n"
+             << " Details:\n"
+             << "   Number of chunks         : " << mat.chunks() << "\n"
+             << "   Expected number of chunks: 2\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Size constructor with invalid size
+   {
+      test_ = "SlicedEllpackMatrix size constructor with invalid size";
+
+      try {
+         blaze::SlicedEllpackMatrix<int,4UL> mat( 4UL, 0x100000000UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction of a matrix with invalid size succeeded\n"
+             << " Details:\n"
+             << "   Number of columns: " << mat.columns() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   // Copy constructor
+   {
+      test_ = "SlicedEllpackMatrix copy constructor";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref( 6UL, 9UL );
+      ref(0,0) = 1;
+      ref(1,2) = 2;
+      ref(1,7) = 3;
+      ref(4,4) = 4;
+
+      const blaze::SlicedEllpackMatrix<int,4UL> mat1( ref, 8UL );
+      const blaze::SlicedEllpackMatrix<int,4UL> mat2( mat1 );
+
+      checkRows    ( mat2, 6UL );
+      checkColumns ( mat2, 9UL );
+      checkNonZeros( mat2, 4UL );
+      checkNonZeros( mat2, 1UL, 2UL );
+
+      if( mat2 != ref || mat2.sigma() != 8UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Sorting scope: " << mat2.sigma() << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Conversion constructors
+   {
+      test_ = "SlicedEllpackMatrix conversion constructors";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref( 6UL, 9UL );
+      ref(0,0) = 1;
+      ref(1,2) = 2;
+      ref(1,7) = 3;
+      ref(4,4) = 4;
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> dense( ref );
+      const blaze::CompressedMatrix<int,blaze::columnMajor> sparse( ref );
+
+      const blaze::SlicedEllpackMatrix<int,4UL> mat1( ref );
+      const blaze::SlicedEllpackMatrix<int,4UL> mat2( dense );
+      const blaze::SlicedEllpackMatrix<int,4UL> mat3( sparse );
+      const blaze::CompressedMatrix<int,blaze::rowMajor> mat4( mat1 );
+
+      checkNonZeros( mat1, 4UL );
+      checkNonZeros( mat2, 4UL );
+      checkNonZeros( mat3, 4UL );
+      checkNonZeros( mat1, 1UL, 2UL );
+      checkNonZeros( mat1, 4UL, 1UL );
+
+      if( mat1 != ref || mat2 != ref || mat3 != ref || mat4 != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n" << mat2 << "\n" << mat3 << "\n" << mat4 << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Sorting scope
+   {
+      test_ = "SlicedEllpackMatrix sorting scope";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref( 6UL, 9UL );
+
+      const blaze::SlicedEllpackMatrix<int,4UL> mat1( ref );
+      const blaze::SlicedEllpackMatrix<int,4UL> mat2( ref, 10UL );
+      const blaze::SlicedEllpackMatrix<int,4UL> mat3( ref, 2UL );
+
+      if( mat1.sigma() != blaze::SLICEDELLPACK_SORTING_SCOPE - blaze::SLICEDELLPACK_SORTING_SCOPE % 4UL ||
+          mat2.sigma() != 8UL || mat3.sigma() != 4UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid sorting scope detected\n"
+             << " Details:\n"
+             << "   Sorting scopes         : " << mat1.sigma() << " " << mat2.sigma() << " " << mat3.sigma() << "\n"
+             << "   Expected sorting scopes: " << blaze::SLICEDELLPACK_SORTING_SCOPE << " 8 4\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SlicedEllpackMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the SlicedEllpackMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   test_ = "SlicedEllpackMatrix assignment";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> ref( 6UL, 6UL );
+   ref(0,5) =  1;
+   ref(4,0) = -2;
+   ref(4,3) =  3;
+
+   const blaze::DynamicMatrix<int,blaze::rowMajor> dense( ref );
+   const blaze::CompressedMatrix<int,blaze::columnMajor> sparse( ref );
+
+   blaze::SlicedEllpackMatrix<int,4UL> mat1( 9UL, 3UL );
+   blaze::SlicedEllpackMatrix<int,4UL> mat2( blaze::CompressedMatrix<int,blaze::rowMajor>( 2UL, 2UL ), 8UL );
+   blaze::SlicedEllpackMatrix<int,4UL> mat3, mat4;
+
+   mat1 = ref;
+   mat2 = dense;
+   mat3 = sparse;
+   mat4 = mat1;
+   mat1 = mat1;
+
+   checkRows    ( mat1, 6UL );
+   checkColumns ( mat1, 6UL );
+   checkNonZeros( mat4, 3UL );
+   checkNonZeros( mat4, 4UL, 2UL );
+
+   if( mat1 != ref || mat2 != ref || mat3 != ref || mat4 != ref || mat2.sigma() != 8UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Assignment failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat1 << "\n" << mat2 << "\n" << mat3 << "\n" << mat4 << "\n"
+          << "   Sorting scope: " << mat2.sigma() << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SlicedEllpackMatrix addition assignment operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the addition assignment operator of the SlicedEllpackMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAddAssign()
+{
+   test_ = "SlicedEllpackMatrix addition assignment";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> ref( 6UL, 9UL );
+   ref(0,0) =  1;
+   ref(1,5) = -2;
+   ref(5,8) =  3;
+
+   const blaze::DynamicMatrix<int,blaze::rowMajor> dense( ref );
+   const blaze::SlicedEllpackMatrix<int,4UL> sliced( ref );
+
+   blaze::SlicedEllpackMatrix<int,4UL> mat( ref );
+   mat += sliced;
+   mat += dense;
+   mat += ref;
+
+   checkNonZeros( mat, 3UL );
+
+   if( mat != 4*ref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Addition assignment failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n" << 4*ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SlicedEllpackMatrix subtraction assignment operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the subtraction assignment operator of the SlicedEllpackMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSubAssign()
+{
+   test_ = "SlicedEllpackMatrix subtraction assignment";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> ref( 6UL, 9UL );
+   ref(0,0) =  1;
+   ref(1,5) = -2;
+   ref(5,8) =  3;
+
+   const blaze::DynamicMatrix<int,blaze::rowMajor> dense( ref );
+   const blaze::SlicedEllpackMatrix<int,4UL> sliced( ref );
+
+   blaze::SlicedEllpackMatrix<int,4UL> mat( ref );
+   mat -= sliced;
+   mat -= dense;
+   mat -= ref;
+
+   if( mat != -2*ref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Subtraction assignment failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n" << -2*ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of all SlicedEllpackMatrix (self-)scaling operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all available ways to scale an instance of the
+// SlicedEllpackMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testScaling()
+{
+   test_ = "SlicedEllpackMatrix self-scaling";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> ref( 3UL, 6UL );
+   ref(0,0) =  1;
+   ref(1,1) = -2;
+   ref(1,3) =  4;
+   ref(2,4) =  3;
+
+   blaze::SlicedEllpackMatrix<int,4UL> mat( ref );
+
+   mat *= 6;
+   mat /= 2;
+   mat.scale( -2 );
+
+   checkNonZeros( mat, 4UL );
+
+   if( mat(0,0) != -6 || mat(1,1) != 12 || mat(1,3) != -24 || mat(2,4) != -18 || mat(0,1) != 0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Failed self-scaling operation\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n( -6 0 0 0 0 0 )\n( 0 12 0 -24 0 0 )\n( 0 0 0 0 -18 0 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SlicedEllpackMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of accessing elements via the function call operator of the
+// SlicedEllpackMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   test_ = "SlicedEllpackMatrix::operator()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> ref( 6UL, 6UL );
+   ref(0,1) = 3;
+   ref(2,2) = 5;
+   ref(4,0) = 1;
+   ref(4,5) = 2;
+
+   const blaze::SlicedEllpackMatrix<int,4UL> mat( ref );
+
+   checkNonZeros( mat, 4UL );
+   checkNonZeros( mat, 0UL, 1UL );
+   checkNonZeros( mat, 4UL, 2UL );
+
+   if( mat(0,1) != 3 || mat(2,2) != 5 || mat(4,0) != 1 || mat(4,5) != 2 ||
+       mat(1,1) != 0 || mat(4,4) != 0 || mat(5,0) != 0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Function call operator failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SlicedEllpackMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the SlicedEllpackMatrix class
+// template. In particular, it checks that the padding elements of a chunk are not visible via
+// the row iterators. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   typedef blaze::SlicedEllpackMatrix<int,4UL>  MatrixType;
+   typedef MatrixType::ConstIterator            ConstIterator;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> ref( 6UL, 9UL );
+   ref(0,0) = 1;
+   ref(1,2) = 2;
+   ref(1,7) = 3;
+   ref(2,1) = 4;
+   ref(2,4) = 5;
+   ref(2,5) = 6;
+   ref(2,8) = 7;
+
+   const MatrixType mat( ref );
+
+   // Counting the number of elements in 1st row
+   {
+      test_ = "Iterator subtraction";
+
+      const size_t number( mat.end(1) - mat.begin(1) );
+
+      if( number != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of elements detected\n"
+             << " Details:\n"
+             << "   Number of elements         : " << number << "\n"
+             << "   Expected number of elements: 2\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing read-only access via ConstIterator
+   {
+      test_ = "Read-only access via ConstIterator";
+
+      const size_t indices[2] = { 2UL, 7UL };
+      const int    values [2] = { 2  , 3   };
+
+      ConstIterator it( mat.cbegin(1) );
+      const ConstIterator end( mat.cend(1) );
+
+      for( size_t k=0UL; k<2UL; ++k, ++it )
+      {
+         if( it == end || it->index() != indices[k] || it->value() != values[k] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid element " << k << " in row 1\n"
+                << " Details:\n"
+                << "   Expected index: " << indices[k] << "\n"
+                << "   Expected value: " << values[k] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( it != end ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iterator not at end of row 1\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing an empty row
+   {
+      test_ = "Iteration over an empty row";
+
+      if( mat.cbegin(5) != mat.cend(5) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Non-empty iteration range in row 5\n"
+             << " Details:\n"
+             << "   Number of elements: " << ( mat.cend(5) - mat.cbegin(5) ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SlicedEllpackMatrix lookup functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c find(), \c lowerBound() and \c upperBound() member
+// functions of the SlicedEllpackMatrix class template. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFind()
+{
+   typedef blaze::SlicedEllpackMatrix<int,4UL>  MatrixType;
+   typedef MatrixType::ConstIterator            ConstIterator;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> ref( 6UL, 9UL );
+   ref(0,0) = 1;
+   ref(1,2) = 2;
+   ref(1,6) = 3;
+   ref(2,7) = 4;
+   ref(4,4) = 5;
+
+   const MatrixType mat( ref );
+
+   {
+      test_ = "SlicedEllpackMatrix::find()";
+
+      const ConstIterator pos1( mat.find( 1UL, 6UL ) );
+      const ConstIterator pos2( mat.find( 1UL, 7UL ) );
+      const ConstIterator pos3( mat.find( 3UL, 0UL ) );
+
+      if( pos1 == mat.end(1) || pos1->index() != 6UL || pos1->value() != 3 ||
+          pos2 != mat.end(1) || pos3 != mat.end(3) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Element lookup failed\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SlicedEllpackMatrix::lowerBound() and SlicedEllpackMatrix::upperBound()";
+
+      const ConstIterator pos1( mat.lowerBound( 1UL, 3UL ) );
+      const ConstIterator pos2( mat.upperBound( 1UL, 2UL ) );
+      const ConstIterator pos3( mat.upperBound( 1UL, 6UL ) );
+      const ConstIterator pos4( mat.lowerBound( 4UL, 0UL ) );
+
+      if( pos1 == mat.end(1) || pos1->index() != 6UL ||
+          pos2 == mat.end(1) || pos2->index() != 6UL ||
+          pos3 != mat.end(1) ||
+          pos4 == mat.end(4) || pos4->index() != 4UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Bound lookup failed\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SlicedEllpackMatrix chunk layout.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the chunk layout of the SlicedEllpackMatrix class template,
+// i.e. the sorting of the rows within the sorting scope and the padding of the chunks. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testChunks()
+{
+   typedef blaze::SlicedEllpackMatrix<int,4UL>  MatrixType;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> ref( 6UL, 8UL );
+   ref(0,2) =  1;
+   ref(1,0) =  2;
+   ref(1,3) =  3;
+   ref(1,7) =  4;
+   ref(3,1) =  5;
+   ref(3,5) =  6;
+   ref(4,0) =  7;
+   ref(4,2) =  8;
+   ref(4,4) =  9;
+   ref(4,6) = 10;
+   ref(5,7) = 11;
+
+   // Sorting within a single scope
+   {
+      test_ = "SlicedEllpackMatrix chunks (sorted)";
+
+      const MatrixType mat( ref, 8UL );
+
+      const uint32_t rows   [8]  = { 4U, 1U, 3U, 0U, 5U, 2U, 6U, 6U };
+      const uint32_t lengths[8]  = { 4U, 3U, 2U, 1U, 1U, 0U, 0U, 0U };
+      const int      values [20] = {  7, 2, 5, 1,  8, 3, 6, 0,  9, 4, 0, 0,  10, 0, 0, 0,
+                                     11, 0, 0, 0 };
+      const uint32_t indices[20] = { 0U, 0U, 1U, 2U,  2U, 3U, 5U, 2U,  4U, 7U, 5U, 2U,  6U, 7U, 5U, 2U,
+                                     7U, 0U, 0U, 0U };
+
+      checkNonZeros( mat, 11UL );
+      checkCapacity( mat, 20UL );
+
+      if( mat != ref || mat.chunks() != 2UL || mat.chunkWidth( 0UL ) != 4UL || mat.chunkWidth( 1UL ) != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid chunks detected\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Chunk widths: " << mat.chunkWidth( 0UL ) << " " << mat.chunkWidth( 1UL ) << "\n"
+             << "   Expected chunk widths: 4 1\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t s=0UL; s<8UL; ++s )
+      {
+         if( mat.chunkRows( s/4UL )[s%4UL] != rows[s] || mat.chunkLengths( s/4UL )[s%4UL] != lengths[s] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid lane " << s << " detected\n"
+                << " Details:\n"
+                << "   Row   : " << mat.chunkRows( s/4UL )[s%4UL] << " (expected " << rows[s] << ")\n"
+                << "   Length: " << mat.chunkLengths( s/4UL )[s%4UL] << " (expected " << lengths[s] << ")\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      for( size_t k=0UL; k<20UL; ++k )
+      {
+         const size_t c( k/16UL );
+         const size_t l( k%16UL );
+
+         if( mat.chunkValues( c )[l] != values[k] || mat.chunkIndices( c )[l] != indices[k] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid element " << l << " in chunk " << c << " detected\n"
+                << " Details:\n"
+                << "   Value: " << mat.chunkValues( c )[l] << " (expected " << values[k] << ")\n"
+                << "   Index: " << mat.chunkIndices( c )[l] << " (expected " << indices[k] << ")\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   // No sorting for a sorting scope equal to the chunk height
+   {
+      test_ = "SlicedEllpackMatrix chunks (unsorted)";
+
+      const MatrixType mat( ref, 4UL );
+
+      checkNonZeros( mat, 11UL );
+      checkCapacity( mat, 28UL );
+
+      if( mat != ref || mat.chunkWidth( 0UL ) != 3UL || mat.chunkWidth( 1UL ) != 4UL ||
+          mat.chunkRows( 0UL )[1] != 1U || mat.chunkRows( 1UL )[0] != 4U || mat.chunkRows( 1UL )[3] != 6U ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid chunks detected\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Chunk widths: " << mat.chunkWidth( 0UL ) << " " << mat.chunkWidth( 1UL ) << "\n"
+             << "   Expected chunk widths: 3 4\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SlicedEllpackMatrix multiplication kernels.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication of a SlicedEllpackMatrix with dense
+// vectors from the right and from the left. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   const size_t M( 61UL );
+   const size_t N( 96UL );
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> ref( M, N );
+   for( size_t i=0UL; i<M; ++i ) {
+      const size_t nonzeros( ( i % 7UL == 0UL )?( N/2UL ):( i % 5UL ) );
+      for( size_t j=0UL; j<nonzeros; ++j ) {
+         ref( i, ( 11UL*j + i ) % N ) = blaze::rand<int>( -9, 9 );
+      }
+   }
+
+   blaze::DynamicVector<double,blaze::columnVector> x( N );
+   for( size_t j=0UL; j<N; ++j ) {
+      x[j] = blaze::rand<int>( -9, 9 );
+   }
+
+   blaze::DynamicVector<double,blaze::rowVector> z( M );
+   for( size_t i=0UL; i<M; ++i ) {
+      z[i] = blaze::rand<int>( -9, 9 );
+   }
+
+   {
+      test_ = "SlicedEllpackMatrix/dense vector multiplication (C=4)";
+
+      const blaze::SlicedEllpackMatrix<double,4UL> mat( ref, 16UL );
+
+      const blaze::DynamicVector<double,blaze::columnVector> expected( ref * x );
+      blaze::DynamicVector<double,blaze::columnVector> y1( mat * x );
+      blaze::DynamicVector<double,blaze::columnVector> y2( M, 0.0 );
+      y2 += mat * x;
+      y2 += mat * x;
+      y2 -= mat * x;
+
+      if( y1 != expected || y2 != expected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y1 << "\n" << y2 << "\n"
+             << "   Expected result:\n" << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SlicedEllpackMatrix/dense vector multiplication (C=3)";
+
+      const blaze::SlicedEllpackMatrix<double,3UL> mat( ref );
+
+      const blaze::DynamicVector<double,blaze::columnVector> expected( ref * x );
+      const blaze::DynamicVector<double,blaze::columnVector> y( mat * x );
+
+      if( y != expected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n" << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SlicedEllpackMatrix submatrix/dense vector multiplication";
+
+      const blaze::SlicedEllpackMatrix<double,8UL> mat( ref, 16UL );
+
+      const blaze::DynamicVector<double,blaze::columnVector> expected1( submatrix( ref, 3UL, 0UL, 40UL, N ) * x );
+      const blaze::DynamicVector<double,blaze::columnVector> expected2( submatrix( ref, 3UL, 5UL, 40UL, 50UL ) * subvector( x, 5UL, 50UL ) );
+      const blaze::DynamicVector<double,blaze::columnVector> y1( submatrix( mat, 3UL, 0UL, 40UL, N ) * x );
+      const blaze::DynamicVector<double,blaze::columnVector> y2( submatrix( mat, 3UL, 5UL, 40UL, 50UL ) * subvector( x, 5UL, 50UL ) );
+
+      if( y1 != expected1 || y2 != expected2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y1 << "\n" << y2 << "\n"
+             << "   Expected result:\n" << expected1 << "\n" << expected2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Dense vector/SlicedEllpackMatrix multiplication";
+
+      const blaze::SlicedEllpackMatrix<double,4UL> mat( ref, 16UL );
+
+      const blaze::DynamicVector<double,blaze::rowVector> expected( z * ref );
+      blaze::DynamicVector<double,blaze::rowVector> y1( z * mat );
+      blaze::DynamicVector<double,blaze::rowVector> y2( N, 0.0 );
+      y2 += z * mat;
+      y2 += z * mat;
+      y2 -= z * mat;
+
+      if( y1 != expected || y2 != expected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y1 << "\n" << y2 << "\n"
+             << "   Expected result:\n" << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace slicedellpackmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SlicedEllpackMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_SLICEDELLPACKMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SlicedEllpackMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,672 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/workstealingpool/ClassTest.cpp
+//  \brief Source file for the WorkStealingPool class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <blazetest/utiltest/workstealingpool/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace workstealingpool {
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+boost::atomic<size_t> ClassTest::counter_( 0UL );
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the WorkStealingPool class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testSchedule();
+   testScheduleOn();
+   testArguments();
+   testNestedTasks();
+   testResize();
+   testClear();
+   testAffinity();
+   testRun();
+   testSpinning();
+   testException();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the scheduling of tasks by an external thread.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function repeatedly schedules a large number of fine-grained tasks and checks that all
+// of them have been executed after the wait() function returns. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSchedule()
+{
+   Pool pool( 4UL );
+
+   for( size_t rep=1UL; rep<=100UL; ++rep )
+   {
+      for( size_t i=0UL; i<1000UL; ++i ) {
+         pool.schedule( &ClassTest::increment );
+      }
+
+      pool.wait();
+
+      if( counter_ != 1000UL*rep || !pool.isEmpty() ) {
+         std::ostringstream oss;
+         oss << " Test: Scheduling of tasks\n"
+             << " Error: Invalid number of executed tasks\n"
+             << " Details:\n"
+             << "   Repetition      = " << rep << "\n"
+             << "   Executed tasks  = " << counter_ << "\n"
+             << "   Expected tasks  = " << 1000UL*rep << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   counter_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the scheduling of tasks for particular worker threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function repeatedly schedules tasks for all worker threads via the scheduleOn() function
+// and checks that all of them have been executed after the wait() function returns. Since the
+// external thread does not execute the tasks of the inboxes, the workers have to be woken up
+// for every repetition. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testScheduleOn()
+{
+   Pool pool( 4UL );
+
+   for( size_t rep=1UL; rep<=100UL; ++rep )
+   {
+      for( size_t i=0UL; i<16UL; ++i ) {
+         pool.scheduleOn( i, &ClassTest::increment );
+      }
+
+      pool.wait();
+
+      if( counter_ != 16UL*rep || !pool.isEmpty() ) {
+         std::ostringstream oss;
+         oss << " Test: Scheduling of tasks for particular workers\n"
+             << " Error: Invalid number of executed tasks\n"
+             << " Details:\n"
+             << "   Repetition      = " << rep << "\n"
+             << "   Executed tasks  = " << counter_ << "\n"
+             << "   Expected tasks  = " << 16UL*rep << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   counter_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the scheduling of functions with arguments.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function schedules functions with one to five arguments and checks their results. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testArguments()
+{
+   Pool pool( 3UL );
+
+   pool.schedule( &ClassTest::add, 1UL, 0UL, 0UL, 0UL, 0UL );
+   pool.schedule( boost::bind( &ClassTest::add, _1, 2UL, 0UL, 0UL, 0UL ), 10UL );
+   pool.schedule( boost::bind( &ClassTest::add, _1, _2, 0UL, 0UL, 0UL ), 100UL, 200UL );
+   pool.schedule( boost::bind( &ClassTest::add, _1, _2, _3, 0UL, 0UL ), 1000UL, 2000UL, 3000UL );
+   pool.schedule( boost::bind( &ClassTest::add, _1, _2, _3, _4, 0UL ), 1UL, 1UL, 1UL, 1UL );
+   pool.wait();
+
+   if( counter_ != 6317UL ) {
+      std::ostringstream oss;
+      oss << " Test: Scheduling of functions with arguments\n"
+          << " Error: Invalid result\n"
+          << " Details:\n"
+          << "   Result          = " << counter_ << "\n"
+          << "   Expected result = 6317\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   counter_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the scheduling of tasks by the worker threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function schedules a task that recursively spawns two new tasks until the given depth
+// is reached. The spawned tasks are added to the deques of the worker threads and distributed
+// via work stealing. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNestedTasks()
+{
+   Pool pool( 4UL );
+
+   for( size_t rep=0UL; rep<10UL; ++rep )
+   {
+      pool.schedule( &ClassTest::spawn, &pool, 12UL );
+      pool.wait();
+
+      if( counter_ != 8191UL*( rep+1UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: Scheduling of nested tasks\n"
+             << " Error: Invalid number of executed tasks\n"
+             << " Details:\n"
+             << "   Repetition      = " << rep << "\n"
+             << "   Executed tasks  = " << counter_ << "\n"
+             << "   Expected tasks  = " << 8191UL*( rep+1UL ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   counter_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resize() function of the WorkStealingPool class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function increases and decreases the number of threads of a thread pool with scheduled
+// tasks. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   Pool pool( 2UL );
+
+   const size_t sizes[] = { 5UL, 1UL, 3UL };
+
+   for( size_t i=0UL; i<3UL; ++i )
+   {
+      for( size_t j=0UL; j<100UL; ++j ) {
+         pool.schedule( &ClassTest::increment );
+      }
+
+      pool.resize( sizes[i] );
+
+      if( pool.size() != sizes[i] || counter_ != 100UL*( i+1UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: Resizing the thread pool\n"
+             << " Error: Resizing failed\n"
+             << " Details:\n"
+             << "   Size            = " << pool.size() << "\n"
+             << "   Expected size   = " << sizes[i] << "\n"
+             << "   Executed tasks  = " << counter_ << "\n"
+             << "   Expected tasks  = " << 100UL*( i+1UL ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   counter_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the clear() function of the WorkStealingPool class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function removes scheduled tasks from a thread pool and checks that the pool is empty
+// afterwards. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   Pool pool( 2UL );
+
+   for( size_t i=0UL; i<10000UL; ++i ) {
+      pool.schedule( &ClassTest::increment );
+   }
+
+   pool.clear();
+   pool.wait();
+
+   if( !pool.isEmpty() || counter_ > 10000UL ) {
+      std::ostringstream oss;
+      oss << " Test: Clearing the thread pool\n"
+          << " Error: Clearing failed\n"
+          << " Details:\n"
+          << "   Executed tasks  = " << counter_ << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   counter_ = 0UL;
+}
+//*************************************************************************************************
+
+
+
+//*************************************************************************************************
+/*!\brief Test of the binding of the worker threads to CPUs.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parsing of CPU lists and binds the worker threads of a thread pool
+// to the CPUs selected by the compact and the scatter policy. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAffinity()
+{
+   {
+      const std::vector<size_t> cpus( blaze::parseCPUList( "0,2,4-6" ) );
+
+      if( cpus.size() != 5UL || cpus[0] != 0UL || cpus[1] != 2UL || cpus[4] != 6UL ) {
+         std::ostringstream oss;
+         oss << " Test: Parsing a CPU list\n"
+             << " Error: Invalid list of CPUs\n"
+             << " Details:\n"
+             << "   Number of CPUs  = " << cpus.size() << "\n"
+             << "   Expected number = 5\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      bool failed( true );
+
+      try {
+         blaze::parseCPUList( "4-2" );
+      }
+      catch( std::invalid_argument& ) {
+         failed = false;
+      }
+
+      if( failed ) {
+         std::ostringstream oss;
+         oss << " Test: Parsing an invalid CPU list\n"
+             << " Error: No exception thrown\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      Pool pool( 3UL, blaze::threadAffinity( "compact" ) );
+      pool.setAffinity( blaze::threadAffinity( "scatter" ) );
+      pool.resize( 5UL );
+
+      for( size_t i=0UL; i<100UL; ++i ) {
+         pool.scheduleOn( i, &ClassTest::increment );
+      }
+
+      pool.wait();
+
+      if( counter_ != 100UL ) {
+         std::ostringstream oss;
+         oss << " Test: Binding the worker threads to CPUs\n"
+             << " Error: Invalid number of executed tasks\n"
+             << " Details:\n"
+             << "   Executed tasks  = " << counter_ << "\n"
+             << "   Expected tasks  = 100\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   counter_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the fork/join execution of chunked jobs.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function repeatedly executes jobs of different sizes via the run() function, partially
+// interleaved with regular tasks, and checks that every chunk has been executed exactly once.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testRun()
+{
+   Pool pool( 4UL );
+
+   for( size_t rep=0UL; rep<200UL; ++rep )
+   {
+      const size_t n( rep % 37UL );
+
+      if( rep % 3UL == 0UL ) {
+         pool.scheduleOn( rep, &ClassTest::increment );
+         pool.wait();
+         --counter_;
+      }
+
+      pool.run( n, &ClassTest::addIndex );
+
+      if( counter_ != n*(n+1UL)/2UL ) {
+         std::ostringstream oss;
+         oss << " Test: Fork/join execution of a job\n"
+             << " Error: Invalid execution of the chunks\n"
+             << " Details:\n"
+             << "   Repetition      = " << rep << "\n"
+             << "   Chunks          = " << n << "\n"
+             << "   Result          = " << counter_ << "\n"
+             << "   Expected result = " << n*(n+1UL)/2UL << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      counter_ = 0UL;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the spinning of idle worker threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function executes regular tasks and fork/join jobs by a thread pool with spinning worker
+// threads and changes the number of spin iterations in between. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSpinning()
+{
+   Pool pool( 2UL, std::vector<size_t>(), 1000UL );
+
+   if( pool.spinCount() != 1000UL ) {
+      std::ostringstream oss;
+      oss << " Test: Spinning of idle worker threads\n"
+          << " Error: Invalid number of spin iterations\n"
+          << " Details:\n"
+          << "   Spin iterations = " << pool.spinCount() << "\n"
+          << "   Expected        = 1000\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t rep=1UL; rep<=100UL; ++rep )
+   {
+      if( rep == 50UL ) {
+         pool.setSpinCount( 0UL );
+      }
+
+      for( size_t i=0UL; i<4UL; ++i ) {
+         pool.scheduleOn( i, &ClassTest::increment );
+      }
+
+      pool.wait();
+      pool.run( 4UL, &ClassTest::addIndex );
+
+      if( counter_ != 14UL*rep ) {
+         std::ostringstream oss;
+         oss << " Test: Spinning of idle worker threads\n"
+             << " Error: Invalid number of executed tasks\n"
+             << " Details:\n"
+             << "   Repetition      = " << rep << "\n"
+             << "   Result          = " << counter_ << "\n"
+             << "   Expected result = " << 14UL*rep << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   counter_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the handling of exceptions thrown by a task.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function blocks the only worker thread of a thread pool and schedules a task throwing
+// an exception, which is therefore executed by the thread calling the wait() function. It is
+// checked that the exception is propagated to the calling thread and that the failed task is
+// nevertheless marked as completed, such that a subsequent call of the wait() function returns.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testException()
+{
+   Pool pool( 1UL );
+
+   pool.schedule( &ClassTest::block );
+
+   while( counter_ == 0UL ) {
+      boost::this_thread::yield();
+   }
+
+   pool.schedule( &ClassTest::fail );
+
+   bool caught( false );
+
+   try {
+      pool.wait();
+   }
+   catch( std::logic_error& ) {
+      caught = true;
+   }
+
+   ++counter_;
+   pool.wait();
+
+   if( !caught || !pool.isEmpty() || counter_ != 2UL ) {
+      std::ostringstream oss;
+      oss << " Test: Exception thrown by a task\n"
+          << " Error: Invalid exception handling\n"
+          << " Details:\n"
+          << "   Exception caught = " << caught << "\n"
+          << "   Pool empty       = " << pool.isEmpty() << "\n"
+          << "   Counter          = " << counter_ << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   counter_ = 0UL;
+}
+//*************************************************************************************************
+//*************************************************************************************************
+
+
+
+//=================================================================================================
+//
+//  TASK FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Task incrementing the task counter.
+//
+// \return void
+*/
+void ClassTest::increment()
+{
+   ++counter_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Chunk adding its index plus one to the task counter.
+//
+// \param index The index of the chunk.
+// \return void
+*/
+void ClassTest::addIndex( size_t index )
+{
+   counter_ += index + 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Task adding the given arguments to the task counter.
+//
+// \return void
+*/
+void ClassTest::add( size_t a1, size_t a2, size_t a3, size_t a4, size_t a5 )
+{
+   counter_ += a1 + a2 + a3 + a4 + a5;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Task recursively spawning two new tasks.
+//
+// \param pool The thread pool executing the task.
+// \param depth The remaining recursion depth.
+// \return void
+*/
+void ClassTest::spawn( Pool* pool, size_t depth )
+{
+   ++counter_;
+
+   if( depth > 0UL ) {
+      pool->schedule( &ClassTest::spawn, pool, depth-1UL );
+      pool->schedule( &ClassTest::spawn, pool, depth-1UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Task blocking its thread until the task counter has been incremented by another thread.
+//
+// \return void
+*/
+void ClassTest::block()
+{
+   ++counter_;
+
+   while( counter_ < 2UL ) {
+      boost::this_thread::yield();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Task throwing an exception.
+//
+// \return void
+// \exception std::logic_error Task failure.
+*/
+void ClassTest::fail()
+{
+   throw std::logic_error( "Task failure" );
+}
+//*************************************************************************************************
+
+} // namespace workstealingpool
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running WorkStealingPool class test..." << std::endl;
+
+   try
+   {
+      RUN_WORKSTEALINGPOOL_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during WorkStealingPool class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -10,28 +10,361 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <cstddef>
+#include <cstdlib>
+#include <iomanip>
 #include <iostream>
+#include <limits>
 #include <memory>
+#include <string>
+#include <vector>
 #include <blaze/Math.h>
+#include <blaze/util/Timing.h>
 
-template <class F>
-static void profile(const char* name, const F f, const unsigned n = 5)
+/*
+** Optimization barriers. `do_not_optimize` forces `x` to be materialized in
+** memory, so that the computation producing it cannot be removed or moved
+** out of a timed region. `clobber_memory` forces all pending writes to
+** memory to be completed before the barrier.
+*/
+
+template <class T>
+inline void do_not_optimize(const T& x)
+{
+	asm volatile("" : : "g"(&x) : "memory");
+}
+
+inline void clobber_memory()
+{
+	asm volatile("" : : : "memory");
+}
+
+/*
+** Summary of the execution times (in seconds) of a series of measurements.
+*/
+struct statistics
+{
+	double min;
+	double median;
+	double mean;
+	double stddev;
+};
+
+static statistics summarize(std::vector<double> s)
+{
+	auto r = statistics{0, 0, 0, 0};
+	if (s.empty()) {
+		return r;
+	}
+
+	std::sort(s.begin(), s.end());
+	auto n = s.size();
+	r.min = s.front();
+	r.median = n % 2 == 1 ? s[n / 2] : (s[n / 2 - 1] + s[n / 2]) / 2;
+
+	for (auto x : s) {
+		r.mean += x;
+	}
+	r.mean /= n;
+
+	for (auto x : s) {
+		r.stddev += (x - r.mean) * (x - r.mean);
+	}
+	r.stddev = n > 1 ? std::sqrt(r.stddev / (n - 1)) : 0;
+	return r;
+}
+
+/*
+** Runs `f` `warmup` times without timing it, and then `reps` times with
+** timing. `setup` is invoked before each run of `f` (e.g. to reset the
+** output of a kernel that accumulates into it), and is not part of the
+** measurement. A memory barrier after each run keeps the results of `f`
+** from being sunk past the end of the timed region. If `perf` is given, it
+** additionally accumulates the hardware performance counters of the timed
+** runs.
+*/
+template <class Setup, class F>
+static statistics measure(const Setup setup, const F f, const unsigned warmup,
+	const unsigned reps, blaze::timing::PerfTimer* perf = nullptr)
 {
 	using namespace std::chrono;
 	using value_type = double;
-	value_type s{0};
+	auto s = std::vector<value_type>{};
+	s.reserve(reps);
+
+	for (auto i = 0u; i != warmup; ++i) {
+		setup();
+		f();
+	}
 
-	for (auto i = 0u; i != n; ++i) {
+	if (perf) {
+		perf->reset();
+	}
+	for (auto i = 0u; i != reps; ++i) {
+		setup();
+		if (perf) {
+			perf->start();
+		}
 		auto t1 = high_resolution_clock::now();
 		f();
+		clobber_memory();
 		auto t2 = high_resolution_clock::now();
-		s += duration_cast<duration<value_type>>(t2 - t1).count();
+		if (perf) {
+			perf->end();
+		}
+		s.push_back(duration_cast<duration<value_type>>(t2 - t1).count());
 	}
+	return summarize(std::move(s));
+}
 
-	s /= n;
+template <class F>
+static void profile(const char* name, const F f, const unsigned n = 5)
+{
+	auto s = measure([] {}, f, 0, n);
 	std::cout << "Average execution time for kernel " << name <<
-		" using " << n << " measurements: " << s << "." << std::endl;
+		" using " << n << " measurements: " << s.mean << " (min " <<
+		s.min << ", median " << s.median << ", stddev " << s.stddev <<
+		")." << std::endl;
+}
+
+/*
+** Helpers for the command-line options shared by the benchmarks.
+*/
+
+static std::vector<std::string> split(const std::string& s, const char sep)
+{
+	auto r = std::vector<std::string>{};
+	auto b = 0ul;
+	while (b <= s.size()) {
+		auto e = s.find(sep, b);
+		if (e == std::string::npos) {
+			e = s.size();
+		}
+		if (e != b) {
+			r.push_back(s.substr(b, e - b));
+		}
+		b = e + 1;
+	}
+	return r;
+}
+
+static unsigned to_unsigned(const std::string& s)
+{
+	char* end;
+	auto r = std::strtoul(s.c_str(), &end, 10);
+	if (s.empty() || *end != '\0' || r == 0) {
+		std::cerr << "Invalid positive integer \"" << s << "\"." << std::endl;
+		std::exit(EXIT_FAILURE);
+	}
+	return r;
+}
+
+/*
+** Appends the sizes described by `B:E:S` (from B to E inclusive in steps of
+** S) or `B:E:xF` (multiplying by F) to `sizes`.
+*/
+static void parse_sweep(const std::string& s, std::vector<unsigned>& sizes)
+{
+	auto p = split(s, ':');
+	if (p.size() != 3) {
+		std::cerr << "Invalid sweep \"" << s << "\"." << std::endl;
+		std::exit(EXIT_FAILURE);
+	}
+
+	const auto b = to_unsigned(p[0]);
+	const auto e = to_unsigned(p[1]);
+	const auto mul = p[2][0] == 'x';
+	const auto step = to_unsigned(mul ? p[2].substr(1) : p[2]);
+
+	if (mul && step == 1) {
+		std::cerr << "Invalid sweep factor \"" << p[2] << "\"." << std::endl;
+		std::exit(EXIT_FAILURE);
+	}
+	for (auto n = b; n <= e; n = mul ? n * step : n + step) {
+		sizes.push_back(n);
+	}
+}
+
+/*
+** Estimates the peak floating-point throughput of a single core for the
+** instruction set Blaze was configured with, using independent chains of
+** (fused) multiply-add operations on full SIMD registers.
+*/
+
+template <class T>
+static double peak_gflops()
+{
+	using it = blaze::IntrinsicTrait<T>;
+	static constexpr auto chains = 12u;
+	static constexpr auto iters = 20000000u;
+
+	const auto x = blaze::set(T(0.999999));
+	const auto y = blaze::set(T(0.000001));
+	auto a0 = blaze::set(T(0)), a1 = a0, a2 = a0, a3 = a0, a4 = a0, a5 = a0;
+	auto a6 = a0, a7 = a0, a8 = a0, a9 = a0, a10 = a0, a11 = a0;
+
+	auto t1 = std::chrono::high_resolution_clock::now();
+	for (auto i = 0u; i != iters; ++i) {
+		a0 = blaze::fmadd(a0, x, y);
+		a1 = blaze::fmadd(a1, x, y);
+		a2 = blaze::fmadd(a2, x, y);
+		a3 = blaze::fmadd(a3, x, y);
+		a4 = blaze::fmadd(a4, x, y);
+		a5 = blaze::fmadd(a5, x, y);
+		a6 = blaze::fmadd(a6, x, y);
+		a7 = blaze::fmadd(a7, x, y);
+		a8 = blaze::fmadd(a8, x, y);
+		a9 = blaze::fmadd(a9, x, y);
+		a10 = blaze::fmadd(a10, x, y);
+		a11 = blaze::fmadd(a11, x, y);
+	}
+	auto t2 = std::chrono::high_resolution_clock::now();
+
+	const auto sum = a0 + a1 + a2 + a3 + a4 + a5 + a6 + a7 + a8 + a9 +
+		a10 + a11;
+	do_not_optimize(sum);
+
+	const auto secs = std::chrono::duration<double>(t2 - t1).count();
+	return 2.0 * it::size * chains * iters / secs * 1e-9;
+}
+
+/*
+** Reference result and error bound for the product of the row-major n x n
+** matrices `a` and `b`. The reference is accumulated in double precision.
+** For any order of summation, the rounding error of an element of the
+** product is bounded by n * eps * (|a| * |b|), which `bound` holds.
+*/
+
+template <class T>
+struct reference
+{
+	unsigned n;
+	std::vector<double> c;
+	std::vector<double> bound;
+
+	reference(const T* a, const T* b, const unsigned n) :
+	n{n}, c(n * n, 0), bound(n * n, 0)
+	{
+		const auto eps = std::numeric_limits<T>::epsilon();
+
+		for (auto i = 0u; i != n; ++i) {
+		for (auto k = 0u; k != n; ++k) {
+			const auto x = double(a[n * i + k]);
+			for (auto j = 0u; j != n; ++j) {
+				const auto y = double(b[n * k + j]);
+				c[n * i + j] += x * y;
+				bound[n * i + j] += std::abs(x * y);
+			}
+		}}
+
+		for (auto& x : bound) {
+			x *= n * eps;
+		}
+	}
+
+	/*
+	** Returns the largest error of the result `at(i, j)` relative to the
+	** bound; the result is correct if this is at most one.
+	*/
+	template <class F>
+	double error(const F at) const
+	{
+		auto r = 0.0;
+		for (auto i = 0u; i != n; ++i) {
+		for (auto j = 0u; j != n; ++j) {
+			const auto k = n * i + j;
+			const auto e = std::abs(double(at(i, j)) - c[k]);
+			r = std::max(r, bound[k] > 0 ? e / bound[k] : e);
+		}}
+		return r;
+	}
+};
+
+/*
+** Result tables. The benchmarks print the same columns so that their output
+** can be compared side by side. With `counters`, the table additionally
+** holds the instructions per cycle, the L1D and LLC miss rates, and the
+** floating-point throughput counted by the CPU.
+*/
+
+static void print_header(const char* type, const double peak,
+	const bool measured, const unsigned warmup, const unsigned reps,
+	const bool counters = false)
+{
+	std::cout << "\n# " << type << ", peak " << std::fixed <<
+		std::setprecision(1) << peak << " GFLOP/s" <<
+		(measured ? " (measured)" : "") << ", " << warmup <<
+		" warm-up and " << reps << " timed runs\n";
+	std::cout << std::left << std::setw(20) << "variant" << std::right <<
+		std::setw(7) << "n" << std::setw(12) << "min [s]" <<
+		std::setw(12) << "median [s]" << std::setw(12) << "stddev [s]" <<
+		std::setw(10) << "GFLOP/s" << std::setw(8) << "% peak" <<
+		std::setw(10) << "check";
+	if (counters) {
+		std::cout << std::setw(7) << "IPC" << std::setw(10) << "L1D miss" <<
+			std::setw(10) << "LLC miss" << std::setw(12) << "HW GFLOP/s";
+	}
+	std::cout << std::endl;
+}
+
+/*
+** Prints the row for an n x n by n x n product; `check` is empty if the
+** result was not checked, and `perf` is null if no counters were measured.
+*/
+static void print_row(const std::string& name, const unsigned n,
+	const statistics& s, const double peak, const char* check,
+	const blaze::timing::PerfTimer* perf = nullptr)
+{
+	using namespace blaze::timing;
+
+	const auto gflops = 2.0 * n * n * n / s.median * 1e-9;
+	std::cout << std::left << std::setw(20) << name <<
+		std::right << std::setw(7) << n <<
+		std::setprecision(5) << std::setw(12) << s.min <<
+		std::setw(12) << s.median << std::setw(12) << s.stddev <<
+		std::setprecision(2) << std::setw(10) << gflops <<
+		std::setprecision(1) << std::setw(8) << 100 * gflops / peak <<
+		std::setw(10) << check;
+
+	if (perf) {
+		const auto avail = [&](PerfEvent a, PerfEvent b) {
+			return perf->isAvailable(a) && perf->isAvailable(b);
+		};
+
+		std::cout << std::setprecision(2) << std::setw(7);
+		if (avail(perfInstructions, perfCycles)) {
+			std::cout << perf->ipc();
+		}
+		else {
+			std::cout << "n/a";
+		}
+
+		std::cout << std::setprecision(1) << std::setw(9);
+		if (avail(perfL1dMisses, perfL1dLoads)) {
+			std::cout << 100 * perf->l1dMissRate() << "%";
+		}
+		else {
+			std::cout << "n/a" << " ";
+		}
+
+		std::cout << std::setw(9);
+		if (avail(perfLlcMisses, perfLlcRefs)) {
+			std::cout << 100 * perf->llcMissRate() << "%";
+		}
+		else {
+			std::cout << "n/a" << " ";
+		}
+
+		std::cout << std::setprecision(2) << std::setw(12);
+		if (perf->isAvailable(perfFlops)) {
+			std::cout << perf->flops() * 1e-9;
+		}
+		else {
+			std::cout << "n/a";
+		}
+	}
+	std::cout << std::endl;
 }
 
 #endif
@@ -3,19 +3,48 @@
 ** Author:	Aditya Ramesh
 ** Date:	05/05/2013
 ** Contact:	_@adityaramesh.com
+**
+** Benchmark suite for hand-written variants of the matrix multiplication
+** `c = a * b` of square, row-major matrices, compared against Blaze's
+** kernel on the same data. Run with `--help` for the available options.
 */
 
 #include <common.hpp>
-	
-using value_type = float;
-using darray     = std::unique_ptr<value_type[]>;
-static constexpr auto n = 1024u;
+#include <random>
 
-static void mm_ijk()
+/*
+** Operands of a single benchmark run. `bt` holds the transpose of `b` for
+** the variants that assume a column-major right-hand side operand.
+*/
+template <class T>
+struct workspace
 {
-	auto a = darray{new value_type[n * n]};
-	auto b = darray{new value_type[n * n]};
-	auto c = darray{new value_type[n * n]};
+	using darray = std::unique_ptr<T[]>;
+
+	unsigned n;
+	darray a;
+	darray b;
+	darray bt;
+	darray c;
+
+	explicit workspace(const unsigned n) : n{n},
+	a{new T[n * n]}, b{new T[n * n]}, bt{new T[n * n]}, c{new T[n * n]} {}
+};
+
+template <class T>
+using kernel = void (*)(workspace<T>&);
+
+/*
+** Loop order variants.
+*/
+
+template <class T>
+static void mm_ijk(workspace<T>& w)
+{
+	const auto n = w.n;
+	const auto a = w.a.get();
+	const auto b = w.b.get();
+	const auto c = w.c.get();
 
 	for (auto i = 0u; i != n; ++i) {
 	for (auto j = 0u; j != n; ++j) {
@@ -24,11 +53,13 @@ static void mm_ijk()
 	}}}
 }
 
-static void mm_ikj()
+template <class T>
+static void mm_ikj(workspace<T>& w)
 {
-	auto a = darray{new value_type[n * n]};
-	auto b = darray{new value_type[n * n]};
-	auto c = darray{new value_type[n * n]};
+	const auto n = w.n;
+	const auto a = w.a.get();
+	const auto b = w.b.get();
+	const auto c = w.c.get();
 
 	for (auto i = 0u; i != n; ++i) {
 	for (auto k = 0u; k != n; ++k) {
@@ -37,11 +68,13 @@ static void mm_ikj()
 	}}}
 }
 
-static void mm_jik()
+template <class T>
+static void mm_jik(workspace<T>& w)
 {
-	auto a = darray{new value_type[n * n]};
-	auto b = darray{new value_type[n * n]};
-	auto c = darray{new value_type[n * n]};
+	const auto n = w.n;
+	const auto a = w.a.get();
+	const auto b = w.b.get();
+	const auto c = w.c.get();
 
 	for (auto j = 0u; j != n; ++j) {
 	for (auto i = 0u; i != n; ++i) {
@@ -50,11 +83,13 @@ static void mm_jik()
 	}}}
 }
 
-static void mm_jki()
+template <class T>
+static void mm_jki(workspace<T>& w)
 {
-	auto a = darray{new value_type[n * n]};
-	auto b = darray{new value_type[n * n]};
-	auto c = darray{new value_type[n * n]};
+	const auto n = w.n;
+	const auto a = w.a.get();
+	const auto b = w.b.get();
+	const auto c = w.c.get();
 
 	for (auto j = 0u; j != n; ++j) {
 	for (auto k = 0u; k != n; ++k) {
@@ -63,11 +98,13 @@ static void mm_jki()
 	}}}
 }
 
-static void mm_kij()
+template <class T>
+static void mm_kij(workspace<T>& w)
 {
-	auto a = darray{new value_type[n * n]};
-	auto b = darray{new value_type[n * n]};
-	auto c = darray{new value_type[n * n]};
+	const auto n = w.n;
+	const auto a = w.a.get();
+	const auto b = w.b.get();
+	const auto c = w.c.get();
 
 	for (auto k = 0u; k != n; ++k) {
 	for (auto i = 0u; i != n; ++i) {
@@ -76,11 +113,13 @@ static void mm_kij()
 	}}}
 }
 
-static void mm_kji()
+template <class T>
+static void mm_kji(workspace<T>& w)
 {
-	auto a = darray{new value_type[n * n]};
-	auto b = darray{new value_type[n * n]};
-	auto c = darray{new value_type[n * n]};
+	const auto n = w.n;
+	const auto a = w.a.get();
+	const auto b = w.b.get();
+	const auto c = w.c.get();
 
 	for (auto k = 0u; k != n; ++k) {
 	for (auto j = 0u; j != n; ++j) {
@@ -89,89 +128,45 @@ static void mm_kji()
 	}}}
 }
 
-static void mm_u2()
-{
-	auto a = darray{new value_type[n * n]};
-	auto b = darray{new value_type[n * n]};
-	auto c = darray{new value_type[n * n]};
-
-	for (auto i = 0u; i != n; ++i) {
-	for (auto k = 0u; k != n; ++k) {
-	for (auto j = 0u; j != n; j += 2) {
-		c[n * i + j + 0] += a[n * i + k] * b[n * k + j + 0];
-		c[n * i + j + 1] += a[n * i + k] * b[n * k + j + 1];
-	}}}
-}
-
-static void mm_u4()
-{
-	auto a = darray{new value_type[n * n]};
-	auto b = darray{new value_type[n * n]};
-	auto c = darray{new value_type[n * n]};
-
-	for (auto i = 0u; i != n; ++i) {
-	for (auto k = 0u; k != n; ++k) {
-	for (auto j = 0u; j != n; j += 4) {
-		c[n * i + j + 0] += a[n * i + k] * b[n * k + j + 0];
-		c[n * i + j + 1] += a[n * i + k] * b[n * k + j + 1];
-		c[n * i + j + 2] += a[n * i + k] * b[n * k + j + 2];
-		c[n * i + j + 3] += a[n * i + k] * b[n * k + j + 3];
-	}}}
-}
+/*
+** Unrolling of the innermost loop of the <i,k,j> order by a factor of `m`.
+*/
 
-static void mm_u8()
+template <unsigned m, class T>
+static void mm_unroll(workspace<T>& w)
 {
-	auto a = darray{new value_type[n * n]};
-	auto b = darray{new value_type[n * n]};
-	auto c = darray{new value_type[n * n]};
+	const auto n = w.n;
+	const auto a = w.a.get();
+	const auto b = w.b.get();
+	const auto c = w.c.get();
+	const auto r = n - n % m;
 
 	for (auto i = 0u; i != n; ++i) {
 	for (auto k = 0u; k != n; ++k) {
-	for (auto j = 0u; j != n; j += 8) {
-		c[n * i + j + 0] += a[n * i + k] * b[n * k + j + 0];
-		c[n * i + j + 1] += a[n * i + k] * b[n * k + j + 1];
-		c[n * i + j + 2] += a[n * i + k] * b[n * k + j + 2];
-		c[n * i + j + 3] += a[n * i + k] * b[n * k + j + 3];
-		c[n * i + j + 4] += a[n * i + k] * b[n * k + j + 4];
-		c[n * i + j + 5] += a[n * i + k] * b[n * k + j + 5];
-		c[n * i + j + 6] += a[n * i + k] * b[n * k + j + 6];
-		c[n * i + j + 7] += a[n * i + k] * b[n * k + j + 7];
-	}}}
+		const auto x = a[n * i + k];
+		auto j = 0u;
+		for (; j != r; j += m) {
+			for (auto j2 = j; j2 != j + m; ++j2) {
+				c[n * i + j2] += x * b[n * k + j2];
+			}
+		}
+		for (; j != n; ++j) {
+			c[n * i + j] += x * b[n * k + j];
+		}
+	}}
 }
 
-static void mm_u16()
-{
-	auto a = darray{new value_type[n * n]};
-	auto b = darray{new value_type[n * n]};
-	auto c = darray{new value_type[n * n]};
-
-	for (auto i = 0u; i != n; ++i) {
-	for (auto k = 0u; k != n; ++k) {
-	for (auto j = 0u; j != n; j += 16) {
-		c[n * i + j + 0] += a[n * i + k] * b[n * k + j + 0];
-		c[n * i + j + 1] += a[n * i + k] * b[n * k + j + 1];
-		c[n * i + j + 2] += a[n * i + k] * b[n * k + j + 2];
-		c[n * i + j + 3] += a[n * i + k] * b[n * k + j + 3];
-		c[n * i + j + 4] += a[n * i + k] * b[n * k + j + 4];
-		c[n * i + j + 5] += a[n * i + k] * b[n * k + j + 5];
-		c[n * i + j + 6] += a[n * i + k] * b[n * k + j + 6];
-		c[n * i + j + 7] += a[n * i + k] * b[n * k + j + 7];
-		c[n * i + j + 8] += a[n * i + k] * b[n * k + j + 8];
-		c[n * i + j + 9] += a[n * i + k] * b[n * k + j + 9];
-		c[n * i + j + 10] += a[n * i + k] * b[n * k + j + 10];
-		c[n * i + j + 11] += a[n * i + k] * b[n * k + j + 11];
-		c[n * i + j + 12] += a[n * i + k] * b[n * k + j + 12];
-		c[n * i + j + 13] += a[n * i + k] * b[n * k + j + 13];
-		c[n * i + j + 14] += a[n * i + k] * b[n * k + j + 14];
-		c[n * i + j + 15] += a[n * i + k] * b[n * k + j + 15];
-	}}}
-}
+/*
+** The <i,j,k> order with a column-major right-hand side operand.
+*/
 
-static void mm_t()
+template <class T>
+static void mm_t(workspace<T>& w)
 {
-	auto a = darray{new value_type[n * n]};
-	auto b = darray{new value_type[n * n]};
-	auto c = darray{new value_type[n * n]};
+	const auto n = w.n;
+	const auto a = w.a.get();
+	const auto b = w.bt.get();
+	const auto c = w.c.get();
 
 	for (auto i = 0u; i != n; ++i) {
 	for (auto j = 0u; j != n; ++j) {
@@ -180,115 +175,35 @@ static void mm_t()
 	}}}
 }
 
-static void mm_tile2()
-{
-	auto a = darray{new value_type[n * n]};
-	auto b = darray{new value_type[n * n]};
-	auto c = darray{new value_type[n * n]};
-	static constexpr auto m = 2u;
-
-	for (auto i = 0u; i != n; i += m) {
-	for (auto k = 0u; k != n; k += m) {
-	for (auto j = 0u; j != n; j += m) {
-		for (auto i2 = i; i2 != i + m; ++i2) {
-		for (auto k2 = k; k2 != k + m; ++k2) {
-		for (auto j2 = j; j2 != j + m; ++j2) {
-			c[n * i2 + j2] += a[n * i2 + k2] * b[n * k2 + j2];
-		}}}
-	}}}
-}
-
-static void mm_tile4()
-{
-	auto a = darray{new value_type[n * n]};
-	auto b = darray{new value_type[n * n]};
-	auto c = darray{new value_type[n * n]};
-	static constexpr auto m = 4u;
-
-	for (auto i = 0u; i != n; i += m) {
-	for (auto k = 0u; k != n; k += m) {
-	for (auto j = 0u; j != n; j += m) {
-		for (auto i2 = i; i2 != i + m; ++i2) {
-		for (auto k2 = k; k2 != k + m; ++k2) {
-		for (auto j2 = j; j2 != j + m; ++j2) {
-			c[n * i2 + j2] += a[n * i2 + k2] * b[n * k2 + j2];
-		}}}
-	}}}
-}
-
-static void mm_tile8()
-{
-	auto a = darray{new value_type[n * n]};
-	auto b = darray{new value_type[n * n]};
-	auto c = darray{new value_type[n * n]};
-	static constexpr auto m = 8u;
-
-	for (auto i = 0u; i != n; i += m) {
-	for (auto k = 0u; k != n; k += m) {
-	for (auto j = 0u; j != n; j += m) {
-		for (auto i2 = i; i2 != i + m; ++i2) {
-		for (auto k2 = k; k2 != k + m; ++k2) {
-		for (auto j2 = j; j2 != j + m; ++j2) {
-			c[n * i2 + j2] += a[n * i2 + k2] * b[n * k2 + j2];
-		}}}
-	}}}
-}
-
-static void mm_tile16()
-{
-	auto a = darray{new value_type[n * n]};
-	auto b = darray{new value_type[n * n]};
-	auto c = darray{new value_type[n * n]};
-	static constexpr auto m = 16u;
-
-	for (auto i = 0u; i != n; i += m) {
-	for (auto k = 0u; k != n; k += m) {
-	for (auto j = 0u; j != n; j += m) {
-		for (auto i2 = i; i2 != i + m; ++i2) {
-		for (auto k2 = k; k2 != k + m; ++k2) {
-		for (auto j2 = j; j2 != j + m; ++j2) {
-			c[n * i2 + j2] += a[n * i2 + k2] * b[n * k2 + j2];
-		}}}
-	}}}
-}
-
-static void mm_tile32()
-{
-	auto a = darray{new value_type[n * n]};
-	auto b = darray{new value_type[n * n]};
-	auto c = darray{new value_type[n * n]};
-	static constexpr auto m = 32u;
-
-	for (auto i = 0u; i != n / m; ++i) {
-	for (auto k = 0u; k != n / m; ++k) {
-	for (auto j = 0u; j != n / m; ++j) {
-		for (auto i2 = i; i2 != i + m; ++i2) {
-		for (auto k2 = k; k2 != k + m; ++k2) {
-		for (auto j2 = j; j2 != j + m; ++j2) {
-			c[n * i2 + j2] += a[n * i2 + k2] * b[n * k2 + j2];
-		}}}
-	}}}
-}
+/*
+** Tiling of all three loops of the <i,k,j> order by `m`.
+*/
 
-static void mm_tile64()
+template <unsigned m, class T>
+static void mm_tile(workspace<T>& w)
 {
-	auto a = darray{new value_type[n * n]};
-	auto b = darray{new value_type[n * n]};
-	auto c = darray{new value_type[n * n]};
-	static constexpr auto m = 64u;
-
-	for (auto i = 0u; i != n / m; ++i) {
-	for (auto k = 0u; k != n / m; ++k) {
-	for (auto j = 0u; j != n / m; ++j) {
-		for (auto i2 = i; i2 != i + m; ++i2) {
-		for (auto k2 = k; k2 != k + m; ++k2) {
-		for (auto j2 = j; j2 != j + m; ++j2) {
+	const auto n = w.n;
+	const auto a = w.a.get();
+	const auto b = w.b.get();
+	const auto c = w.c.get();
+
+	for (auto i = 0u; i < n; i += m) {
+	for (auto k = 0u; k < n; k += m) {
+	for (auto j = 0u; j < n; j += m) {
+		const auto i3 = std::min(i + m, n);
+		const auto k3 = std::min(k + m, n);
+		const auto j3 = std::min(j + m, n);
+
+		for (auto i2 = i; i2 != i3; ++i2) {
+		for (auto k2 = k; k2 != k3; ++k2) {
+		for (auto j2 = j; j2 != j3; ++j2) {
 			c[n * i2 + j2] += a[n * i2 + k2] * b[n * k2 + j2];
 		}}}
 	}}}
 }
 
-static void mm_super_1()
+template <class T>
+static void mm_super_1(workspace<T>& w)
 {
 	/*
 	** Optimizations performed:
@@ -297,109 +212,62 @@ static void mm_super_1()
 	** 3. Unrolling of the innermost loop.
 	** 4. Reordering to exploit instruction-level parallelism.
 	*/
-	auto a = darray{new value_type[n * n]};
-	auto b = darray{new value_type[n * n]};
-	auto c = darray{new value_type[n * n]};
+	const auto n = w.n;
+	const auto a = w.a.get();
+	const auto b = w.b.get();
+	const auto c = w.c.get();
 
-	static constexpr auto m1 = 1u;
 	static constexpr auto m2 = 4u;
 	static constexpr auto m3 = 8u;
+	const auto r2 = n - n % m2;
+	const auto r3 = n - n % m3;
 
-	for (auto i = 0u; i != n; i += m1) {
-	for (auto k = 0u; k != n; k += m3) {
-	for (auto j = 0u; j != n; j += m2) {
-		//for (auto i2 = i; i2 != i + m1; ++i2) {
-		//for (auto k2 = k; k2 != k + m2; ++k2) {
-		//for (auto j2 = j; j2 != j + m3; ++j2) {
-			c[n * i + (j + 0)] += a[n * i + k] * b[n * k + j + 0]
-			              + a[n * i + (k + 1)] * b[n * (k + 1) + j + 0]
-			              + a[n * i + (k + 2)] * b[n * (k + 2) + j + 0]
-			              + a[n * i + (k + 3)] * b[n * (k + 3) + j + 0]
-			              + a[n * i + (k + 4)] * b[n * (k + 4) + j + 0]
-			              + a[n * i + (k + 5)] * b[n * (k + 5) + j + 0]
-			              + a[n * i + (k + 6)] * b[n * (k + 6) + j + 0]
-			              + a[n * i + (k + 7)] * b[n * (k + 7) + j + 0];
-
-			c[n * i + (j + 1)] += a[n * i + k] * b[n * k + j + 1]
-			              + a[n * i + (k + 1)] * b[n * (k + 1) + j + 1]
-			              + a[n * i + (k + 2)] * b[n * (k + 2) + j + 1]
-			              + a[n * i + (k + 3)] * b[n * (k + 3) + j + 1]
-			              + a[n * i + (k + 4)] * b[n * (k + 4) + j + 1]
-			              + a[n * i + (k + 5)] * b[n * (k + 5) + j + 1]
-			              + a[n * i + (k + 6)] * b[n * (k + 6) + j + 1]
-			              + a[n * i + (k + 7)] * b[n * (k + 7) + j + 1];
-
-			c[n * i + (j + 2)] += a[n * i + k] * b[n * k + j + 2]
-			              + a[n * i + (k + 1)] * b[n * (k + 1) + j + 2]
-			              + a[n * i + (k + 2)] * b[n * (k + 2) + j + 2]
-			              + a[n * i + (k + 3)] * b[n * (k + 3) + j + 2]
-			              + a[n * i + (k + 4)] * b[n * (k + 4) + j + 2]
-			              + a[n * i + (k + 5)] * b[n * (k + 5) + j + 2]
-			              + a[n * i + (k + 6)] * b[n * (k + 6) + j + 2]
-			              + a[n * i + (k + 7)] * b[n * (k + 7) + j + 2];
-
-			c[n * i + (j + 3)] += a[n * i + k] * b[n * k + j + 3]
-			              + a[n * i + (k + 1)] * b[n * (k + 1) + j + 3]
-			              + a[n * i + (k + 2)] * b[n * (k + 2) + j + 3]
-			              + a[n * i + (k + 3)] * b[n * (k + 3) + j + 3]
-			              + a[n * i + (k + 4)] * b[n * (k + 4) + j + 3]
-			              + a[n * i + (k + 5)] * b[n * (k + 5) + j + 3]
-			              + a[n * i + (k + 6)] * b[n * (k + 6) + j + 3]
-			              + a[n * i + (k + 7)] * b[n * (k + 7) + j + 3];
-
-			//c[n * i + (j + 4)] += a[n * i + k] * b[n * k + j + 4]
-			//              + a[n * i + (k + 1)] * b[n * (k + 1) + j + 4]
-			//              + a[n * i + (k + 2)] * b[n * (k + 2) + j + 4]
-			//              + a[n * i + (k + 3)] * b[n * (k + 3) + j + 4]
-			//              + a[n * i + (k + 4)] * b[n * (k + 4) + j + 4]
-			//              + a[n * i + (k + 5)] * b[n * (k + 5) + j + 4]
-			//              + a[n * i + (k + 6)] * b[n * (k + 6) + j + 4]
-			//              + a[n * i + (k + 7)] * b[n * (k + 7) + j + 4];
-
-			//c[n * i + (j + 5)] += a[n * i + k] * b[n * k + j + 5]
-			//              + a[n * i + (k + 1)] * b[n * (k + 1) + j + 5]
-			//              + a[n * i + (k + 2)] * b[n * (k + 2) + j + 5]
-			//              + a[n * i + (k + 3)] * b[n * (k + 3) + j + 5]
-			//              + a[n * i + (k + 4)] * b[n * (k + 4) + j + 5]
-			//              + a[n * i + (k + 5)] * b[n * (k + 5) + j + 5]
-			//              + a[n * i + (k + 6)] * b[n * (k + 6) + j + 5]
-			//              + a[n * i + (k + 7)] * b[n * (k + 7) + j + 5];
-
-			//c[n * i + (j + 6)] += a[n * i + k] * b[n * k + j + 6]
-			//              + a[n * i + (k + 1)] * b[n * (k + 1) + j + 6]
-			//              + a[n * i + (k + 2)] * b[n * (k + 2) + j + 6]
-			//              + a[n * i + (k + 3)] * b[n * (k + 3) + j + 6]
-			//              + a[n * i + (k + 4)] * b[n * (k + 4) + j + 6]
-			//              + a[n * i + (k + 5)] * b[n * (k + 5) + j + 6]
-			//              + a[n * i + (k + 6)] * b[n * (k + 6) + j + 6]
-			//              + a[n * i + (k + 7)] * b[n * (k + 7) + j + 6];
-
-			//c[n * i + (j + 7)] += a[n * i + k] * b[n * k + j + 7]
-			//              + a[n * i + (k + 1)] * b[n * (k + 1) + j + 7]
-			//              + a[n * i + (k + 2)] * b[n * (k + 2) + j + 7]
-			//              + a[n * i + (k + 3)] * b[n * (k + 3) + j + 7]
-			//              + a[n * i + (k + 4)] * b[n * (k + 4) + j + 7]
-			//              + a[n * i + (k + 5)] * b[n * (k + 5) + j + 7]
-			//              + a[n * i + (k + 6)] * b[n * (k + 6) + j + 7]
-			//              + a[n * i + (k + 7)] * b[n * (k + 7) + j + 7];
-		//}}}
-	}}}
+	for (auto i = 0u; i != n; ++i) {
+		auto k = 0u;
+		for (; k != r3; k += m3) {
+			const T x[m3] = {
+				a[n * i + k + 0], a[n * i + k + 1],
+				a[n * i + k + 2], a[n * i + k + 3],
+				a[n * i + k + 4], a[n * i + k + 5],
+				a[n * i + k + 6], a[n * i + k + 7]
+			};
+
+			auto j = 0u;
+			for (; j != r2; j += m2) {
+			for (auto j2 = j; j2 != j + m2; ++j2) {
+				c[n * i + j2] += x[0] * b[n * (k + 0) + j2]
+				               + x[1] * b[n * (k + 1) + j2]
+				               + x[2] * b[n * (k + 2) + j2]
+				               + x[3] * b[n * (k + 3) + j2]
+				               + x[4] * b[n * (k + 4) + j2]
+				               + x[5] * b[n * (k + 5) + j2]
+				               + x[6] * b[n * (k + 6) + j2]
+				               + x[7] * b[n * (k + 7) + j2];
+			}}
+			for (; j != n; ++j) {
+			for (auto k2 = 0u; k2 != m3; ++k2) {
+				c[n * i + j] += x[k2] * b[n * (k + k2) + j];
+			}}
+		}
+		for (; k != n; ++k) {
+		for (auto j = 0u; j != n; ++j) {
+			c[n * i + j] += a[n * i + k] * b[n * k + j];
+		}}
+	}
 }
 
-static void mm_super_2()
+template <class T>
+static void mm_super_2(workspace<T>& w)
 {
-	auto a = darray{new value_type[n * n]};
-	auto b = darray{new value_type[n * n]};
-	auto c = darray{new value_type[n * n]};
+	const auto n = w.n;
+	const auto a = w.a.get();
+	const auto b = w.b.get();
+	const auto c = w.c.get();
 
 	static constexpr auto m1 = 1u;
 	static constexpr auto m2 = 4u;
 	static constexpr auto m3 = 8u;
-	static constexpr auto r1 = n % m1;
-	static constexpr auto r2 = n % m2;
-	static constexpr auto r3 = n % m3;
 
-	// Main Loop
 	for (auto i = 0u; i < n; i += m1) {
 	for (auto k = 0u; k < n; k += m3) {
 	for (auto j = 0u; j < n; j += m2) {
@@ -411,36 +279,299 @@ static void mm_super_2()
 	}}}
 }
 
-int main()
+/*
+** Blaze's kernel for `DynamicMatrix`. The operands are copied into Blaze
+** matrices once per size, and the result is copied back for the check; only
+** the multiplication itself is timed.
+*/
+
+template <class T>
+struct blaze_operands
+{
+	using matrix = blaze::DynamicMatrix<T, blaze::rowMajor>;
+
+	matrix a;
+	matrix b;
+	matrix c;
+
+	static blaze_operands& get()
+	{
+		static blaze_operands r;
+		return r;
+	}
+
+	void load(const workspace<T>& w)
+	{
+		a.resize(w.n, w.n, false);
+		b.resize(w.n, w.n, false);
+		c.resize(w.n, w.n, false);
+
+		for (auto i = 0u; i != w.n; ++i) {
+		for (auto j = 0u; j != w.n; ++j) {
+			a(i, j) = w.a[w.n * i + j];
+			b(i, j) = w.b[w.n * i + j];
+		}}
+	}
+
+	void store(workspace<T>& w) const
+	{
+		for (auto i = 0u; i != w.n; ++i) {
+		for (auto j = 0u; j != w.n; ++j) {
+			w.c[w.n * i + j] = c(i, j);
+		}}
+	}
+};
+
+template <class T>
+static void mm_blaze(workspace<T>&)
+{
+	auto& m = blaze_operands<T>::get();
+	m.c = m.a * m.b;
+}
+
+/*
+** Registry of all variants. The group is used to select related variants
+** on the command line.
+*/
+
+template <class T>
+struct variant
+{
+	const char* name;
+	const char* group;
+	kernel<T> f;
+};
+
+template <class T>
+static const std::vector<variant<T>>& variants()
+{
+	static const auto r = std::vector<variant<T>>{
+		{"ijk",     "order",  mm_ijk<T>},
+		{"ikj",     "order",  mm_ikj<T>},
+		{"jik",     "order",  mm_jik<T>},
+		{"jki",     "order",  mm_jki<T>},
+		{"kij",     "order",  mm_kij<T>},
+		{"kji",     "order",  mm_kji<T>},
+		{"u2",      "unroll", mm_unroll<2, T>},
+		{"u4",      "unroll", mm_unroll<4, T>},
+		{"u8",      "unroll", mm_unroll<8, T>},
+		{"u16",     "unroll", mm_unroll<16, T>},
+		{"t",       "order",  mm_t<T>},
+		{"tile2",   "tile",   mm_tile<2, T>},
+		{"tile4",   "tile",   mm_tile<4, T>},
+		{"tile8",   "tile",   mm_tile<8, T>},
+		{"tile16",  "tile",   mm_tile<16, T>},
+		{"tile32",  "tile",   mm_tile<32, T>},
+		{"tile64",  "tile",   mm_tile<64, T>},
+		{"super_1", "super",  mm_super_1<T>},
+		{"super_2", "super",  mm_super_2<T>},
+		{"blaze",   "blaze",  mm_blaze<T>}
+	};
+	return r;
+}
+
+/*
+** Command-line options.
+*/
+
+struct options
+{
+	std::vector<std::string> variants;
+	std::vector<unsigned> sizes;
+	bool single = true;
+	bool dbl = false;
+	unsigned warmup = 1;
+	unsigned reps = 5;
+	double peak = 0;
+	bool check = true;
+	bool counters = false;
+};
+
+static void usage(const char* prog)
+{
+	std::cout <<
+	"Usage: " << prog << " [options]\n"
+	"  --variants LIST  Comma-separated variants or groups (default: all).\n"
+	"                   Variants: ijk ikj jik jki kij kji u2 u4 u8 u16 t tile2\n"
+	"                   tile4 tile8 tile16 tile32 tile64 super_1 super_2 blaze.\n"
+	"                   Groups: order unroll tile super blaze all.\n"
+	"  --sizes LIST     Comma-separated matrix sizes (default: 512).\n"
+	"  --sweep B:E:S    Sizes from B to E (inclusive) in steps of S; a step\n"
+	"                   of the form xF multiplies the size by F instead.\n"
+	"  --type TYPE      float, double or both (default: float).\n"
+	"  --warmup N       Untimed runs before the measurements (default: 1).\n"
+	"  --reps N         Timed runs per variant and size (default: 5).\n"
+	"  --peak GFLOPS    Peak throughput of one core used for the percentage\n"
+	"                   of peak (default: measured with an FMA loop).\n"
+	"  --no-check       Skip the comparison with the reference result.\n"
+	"  --counters       Print the instructions per cycle, the L1D and LLC miss\n"
+	"                   rates and the floating-point throughput measured by\n"
+	"                   the hardware performance counters (Linux only).\n";
+}
+
+static options parse(const int argc, char** argv)
+{
+	auto o = options{};
+
+	for (auto i = 1; i < argc; ++i) {
+		const auto arg = std::string{argv[i]};
+		const auto has_value = i + 1 < argc;
+
+		if (arg == "--help" || arg == "-h") {
+			usage(argv[0]);
+			std::exit(EXIT_SUCCESS);
+		}
+		else if (arg == "--no-check") {
+			o.check = false;
+		}
+		else if (arg == "--counters") {
+			o.counters = true;
+		}
+		else if (!has_value) {
+			std::cerr << "Missing value for \"" << arg << "\"." << std::endl;
+			usage(argv[0]);
+			std::exit(EXIT_FAILURE);
+		}
+		else if (arg == "--variants") {
+			for (auto& v : split(argv[++i], ',')) {
+				o.variants.push_back(v);
+			}
+		}
+		else if (arg == "--sizes") {
+			for (auto& v : split(argv[++i], ',')) {
+				o.sizes.push_back(to_unsigned(v));
+			}
+		}
+		else if (arg == "--sweep") {
+			parse_sweep(argv[++i], o.sizes);
+		}
+		else if (arg == "--type") {
+			const auto t = std::string{argv[++i]};
+			if (t != "float" && t != "double" && t != "both") {
+				std::cerr << "Invalid type \"" << t << "\"." << std::endl;
+				std::exit(EXIT_FAILURE);
+			}
+			o.single = t != "double";
+			o.dbl = t != "float";
+		}
+		else if (arg == "--warmup") {
+			const auto v = std::string{argv[++i]};
+			o.warmup = v == "0" ? 0 : to_unsigned(v);
+		}
+		else if (arg == "--reps") {
+			o.reps = to_unsigned(argv[++i]);
+		}
+		else if (arg == "--peak") {
+			o.peak = std::atof(argv[++i]);
+		}
+		else {
+			std::cerr << "Unknown option \"" << arg << "\"." << std::endl;
+			usage(argv[0]);
+			std::exit(EXIT_FAILURE);
+		}
+	}
+
+	if (o.variants.empty()) {
+		o.variants.push_back("all");
+	}
+	if (o.sizes.empty()) {
+		o.sizes.push_back(512);
+	}
+	return o;
+}
+
+template <class T>
+static std::vector<variant<T>> select_variants(const std::vector<std::string>& names)
+{
+	auto r = std::vector<variant<T>>{};
+
+	for (auto& name : names) {
+		auto found = false;
+		for (auto& v : variants<T>()) {
+			if (name == "all" || name == v.name || name == v.group) {
+				found = true;
+				auto dup = std::find_if(r.begin(), r.end(),
+					[&](const variant<T>& x) { return x.f == v.f; });
+				if (dup == r.end()) {
+					r.push_back(v);
+				}
+			}
+		}
+		if (!found) {
+			std::cerr << "Unknown variant \"" << name << "\"." << std::endl;
+			std::exit(EXIT_FAILURE);
+		}
+	}
+	return r;
+}
+
+template <class T>
+static bool run(const char* type, const options& o)
+{
+	const auto vs = select_variants<T>(o.variants);
+	const auto peak = o.peak > 0 ? o.peak : peak_gflops<T>();
+	auto ok = true;
+
+	print_header(type, peak, o.peak <= 0, o.warmup, o.reps, o.counters);
+
+	auto gen = std::mt19937{42};
+	auto dist = std::uniform_real_distribution<T>{-1, 1};
+
+	for (auto n : o.sizes) {
+		auto w = workspace<T>{n};
+		for (auto i = 0u; i != n * n; ++i) {
+			w.a[i] = dist(gen);
+			w.b[i] = dist(gen);
+		}
+		for (auto i = 0u; i != n; ++i) {
+		for (auto j = 0u; j != n; ++j) {
+			w.bt[n * j + i] = w.b[n * i + j];
+		}}
+
+		auto ref = std::unique_ptr<reference<T>>{};
+		if (o.check) {
+			ref.reset(new reference<T>{w.a.get(), w.b.get(), n});
+		}
+		blaze_operands<T>::get().load(w);
+
+		for (auto& v : vs) {
+			const auto f = v.f;
+			const auto clear = [&] {
+				std::fill(w.c.get(), w.c.get() + n * n, T(0));
+			};
+			auto perf = blaze::timing::PerfTimer{o.counters};
+			const auto s = measure(clear, [&] { f(w); }, o.warmup, o.reps,
+				&perf);
+
+			if (f == kernel<T>(mm_blaze<T>)) {
+				blaze_operands<T>::get().store(w);
+			}
+
+			auto check = "";
+			if (ref) {
+				const auto e = ref->error([&](unsigned i, unsigned j) {
+					return w.c[n * i + j];
+				});
+				ok = ok && e <= 1;
+				check = e <= 1 ? "ok" : "FAILED";
+			}
+			print_row(v.name, n, s, peak, check,
+				o.counters ? &perf : nullptr);
+		}
+	}
+	return ok;
+}
+
+int main(int argc, char** argv)
 {
-	// Tests index order.
-	//profile("mm_ijk", mm_ijk, 1);
-	//profile("mm_ikj", mm_ikj, 1);
-	//profile("mm_jik", mm_jik, 1);
-	//profile("mm_jki", mm_jki, 1);
-	//profile("mm_kij", mm_kij, 1);
-	//profile("mm_kji", mm_kji, 1);
-	
-	// Tests unrolling.
-	//profile("mm_ikj", mm_ikj, 1);
-	//profile("mm_u2", mm_u2, 1);
-	//profile("mm_u4", mm_u4, 1);
-	//profile("mm_u8", mm_u8, 1);
-	//profile("mm_u16", mm_u16, 1);
-
-	// Tests transpose.
-	//profile("mm_ikj", mm_ikj, 1);
-	//profile("mm_t", mm_t, 1);
-
-	// Tests hierarchial unrolling.
-	//profile("mm_u4", mm_u4, 1);
-	//profile("mm_tile2", mm_tile2, 1);
-	//profile("mm_tile4", mm_tile4, 1);
-	//profile("mm_tile16", mm_tile16, 1);
-	//profile("mm_tile32", mm_tile32, 1);
-	//profile("mm_tile64", mm_tile64, 1);
-
-	// Tests a combination of optimizations.
-	profile("mm_super_1", mm_super_1);
-	profile("mm_super_2", mm_super_2);
+	const auto o = parse(argc, argv);
+	auto ok = true;
+
+	if (o.single) {
+		ok = run<float>("float", o) && ok;
+	}
+	if (o.dbl) {
+		ok = run<double>("double", o) && ok;
+	}
+	return ok ? EXIT_SUCCESS : EXIT_FAILURE;
 }
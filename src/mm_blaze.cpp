@@ -1,21 +1,384 @@
 /*
-** File Name:	eigen_mm.cpp
+** File Name:	mm_blaze.cpp
 ** Author:	Aditya Ramesh
 ** Date:	05/05/2013
 ** Contact:	_@adityaramesh.com
+**
+** Benchmark of Blaze's matrix multiplication `c = a * b` of square matrices
+** for each combination of the matrix type (`DynamicMatrix` or
+** `StaticMatrix`), the storage orders of the operands, and SMP enabled or
+** disabled. The input data and the output format are the same as those of
+** `mm.cpp`, so that the results of the two can be compared side by side.
+** Run with `--help` for the available options.
 */
 
 #include <common.hpp>
+#include <random>
 
-static void mm_blaze()
+/*
+** Sizes for which the `StaticMatrix` configurations are instantiated. Other
+** sizes only run the `DynamicMatrix` configurations.
+*/
+
+template <size_t... Ns>
+struct size_list {};
+
+using static_sizes = size_list<64, 128, 256, 512, 1024>;
+
+/*
+** Command-line options.
+*/
+
+struct options
 {
-	using namespace blaze;
-	using matrix = DynamicMatrix<float>;
+	std::vector<std::string> configs;
+	std::vector<unsigned> sizes;
+	bool single = true;
+	bool dbl = false;
+	unsigned warmup = 1;
+	unsigned reps = 5;
+	double peak = 0;
+	bool check = true;
+	bool counters = false;
+};
 
-	matrix a(1024, 1024);
-	matrix b(1024, 1024);
-	matrix c(1024, 1024);
-	c = a * b;
+static void usage(const char* prog)
+{
+	std::cout <<
+	"Usage: " << prog << " [options]\n"
+	"  --configs LIST   Comma-separated configurations (default: all). A\n"
+	"                   configuration is named TYPE-ORDER-MODE, where TYPE is\n"
+	"                   dynamic or static, ORDER is the storage order of a and\n"
+	"                   b (rr, rc, cr or cc; c has the order of a), and MODE\n"
+	"                   is smp or serial. An entry selects the configurations\n"
+	"                   containing all of its dash-separated parts, e.g.\n"
+	"                   \"static\" or \"dynamic-rr\". StaticMatrix is never\n"
+	"                   assigned in parallel, so it only has serial\n"
+	"                   configurations.\n"
+	"  --sizes LIST     Comma-separated matrix sizes (default: 512). Static\n"
+	"                   configurations are available for 64, 128, 256, 512\n"
+	"                   and 1024.\n"
+	"  --sweep B:E:S    Sizes from B to E (inclusive) in steps of S; a step\n"
+	"                   of the form xF multiplies the size by F instead.\n"
+	"  --type TYPE      float, double or both (default: float).\n"
+	"  --warmup N       Untimed runs before the measurements (default: 1).\n"
+	"  --reps N         Timed runs per configuration and size (default: 5).\n"
+	"  --peak GFLOPS    Peak throughput of one core used for the percentage\n"
+	"                   of peak (default: measured with an FMA loop).\n"
+	"  --no-check       Skip the comparison with the reference result.\n"
+	"  --counters       Print the instructions per cycle, the L1D and LLC miss\n"
+	"                   rates and the floating-point throughput measured by\n"
+	"                   the hardware performance counters (Linux only).\n";
+}
+
+static options parse(const int argc, char** argv)
+{
+	auto o = options{};
+
+	for (auto i = 1; i < argc; ++i) {
+		const auto arg = std::string{argv[i]};
+		const auto has_value = i + 1 < argc;
+
+		if (arg == "--help" || arg == "-h") {
+			usage(argv[0]);
+			std::exit(EXIT_SUCCESS);
+		}
+		else if (arg == "--no-check") {
+			o.check = false;
+		}
+		else if (arg == "--counters") {
+			o.counters = true;
+		}
+		else if (!has_value) {
+			std::cerr << "Missing value for \"" << arg << "\"." << std::endl;
+			usage(argv[0]);
+			std::exit(EXIT_FAILURE);
+		}
+		else if (arg == "--configs") {
+			for (auto& v : split(argv[++i], ',')) {
+				o.configs.push_back(v);
+			}
+		}
+		else if (arg == "--sizes") {
+			for (auto& v : split(argv[++i], ',')) {
+				o.sizes.push_back(to_unsigned(v));
+			}
+		}
+		else if (arg == "--sweep") {
+			parse_sweep(argv[++i], o.sizes);
+		}
+		else if (arg == "--type") {
+			const auto t = std::string{argv[++i]};
+			if (t != "float" && t != "double" && t != "both") {
+				std::cerr << "Invalid type \"" << t << "\"." << std::endl;
+				std::exit(EXIT_FAILURE);
+			}
+			o.single = t != "double";
+			o.dbl = t != "float";
+		}
+		else if (arg == "--warmup") {
+			const auto v = std::string{argv[++i]};
+			o.warmup = v == "0" ? 0 : to_unsigned(v);
+		}
+		else if (arg == "--reps") {
+			o.reps = to_unsigned(argv[++i]);
+		}
+		else if (arg == "--peak") {
+			o.peak = std::atof(argv[++i]);
+		}
+		else {
+			std::cerr << "Unknown option \"" << arg << "\"." << std::endl;
+			usage(argv[0]);
+			std::exit(EXIT_FAILURE);
+		}
+	}
+
+	if (o.configs.empty()) {
+		o.configs.push_back("all");
+	}
+	if (o.sizes.empty()) {
+		o.sizes.push_back(512);
+	}
+	return o;
+}
+
+/*
+** Returns whether the configuration `name` is selected by any of the
+** entries of `--configs`.
+*/
+static bool selected(const options& o, const std::string& name)
+{
+	const auto parts = split(name, '-');
+
+	for (auto& c : o.configs) {
+		if (c == "all") {
+			return true;
+		}
+
+		auto match = true;
+		for (auto& p : split(c, '-')) {
+			if (std::find(parts.begin(), parts.end(), p) == parts.end()) {
+				match = false;
+			}
+		}
+		if (match) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static void check_configs(const options& o)
+{
+	static const char* parts[] = {"all", "dynamic", "static", "rr", "rc",
+		"cr", "cc", "smp", "serial"};
+
+	for (auto& c : o.configs) {
+		for (auto& p : split(c, '-')) {
+			if (std::find(std::begin(parts), std::end(parts), p) ==
+				std::end(parts)) {
+				std::cerr << "Unknown configuration \"" << c << "\"." <<
+					std::endl;
+				std::exit(EXIT_FAILURE);
+			}
+		}
+	}
+}
+
+/*
+** State shared by the configurations run for one size: the row-major input
+** data (generated the same way as in `mm.cpp`), the reference result, and
+** the outcome of the checks.
+*/
+
+template <class T>
+struct context
+{
+	const options& o;
+	double peak;
+	unsigned n;
+	std::vector<T> a;
+	std::vector<T> b;
+	std::unique_ptr<reference<T>> ref;
+	bool ok;
+};
+
+static const char* order_name(const bool soa, const bool sob)
+{
+	return soa ? (sob ? "cc" : "cr") : (sob ? "rc" : "rr");
+}
+
+template <class MT, class T>
+static void load(MT& m, const std::vector<T>& v, const unsigned n)
+{
+	for (auto i = 0u; i != n; ++i) {
+	for (auto j = 0u; j != n; ++j) {
+		m(i, j) = v[n * i + j];
+	}}
 }
 
-int main() { profile("blaze_mm", blaze_mm); }
+/*
+** Times `c = a * b`, either with the default SMP settings or inside a
+** serial section, and prints the result.
+*/
+template <class MT1, class MT2, class MT3, class T>
+static void bench(const std::string& name, MT1& c, const MT2& a,
+	const MT3& b, const bool smp, context<T>& ctx)
+{
+	auto perf = blaze::timing::PerfTimer{ctx.o.counters};
+	auto s = statistics{};
+
+	if (smp) {
+		s = measure([] {}, [&] {
+			c = a * b;
+			do_not_optimize(c);
+		}, ctx.o.warmup, ctx.o.reps, &perf);
+	}
+	else {
+		s = measure([] {}, [&] {
+			BLAZE_SERIAL_SECTION {
+				c = a * b;
+			}
+			do_not_optimize(c);
+		}, ctx.o.warmup, ctx.o.reps, &perf);
+	}
+
+	auto check = "";
+	if (ctx.ref) {
+		const auto e = ctx.ref->error([&](unsigned i, unsigned j) {
+			return c(i, j);
+		});
+		ctx.ok = ctx.ok && e <= 1;
+		check = e <= 1 ? "ok" : "FAILED";
+	}
+	print_row(name, ctx.n, s, ctx.peak, check,
+		ctx.o.counters ? &perf : nullptr);
+}
+
+template <bool SOA, bool SOB, class T>
+static void run_dynamic(context<T>& ctx)
+{
+	const auto prefix = std::string{"dynamic-"} + order_name(SOA, SOB);
+	const auto smp = prefix + "-smp";
+	const auto serial = prefix + "-serial";
+	if (!selected(ctx.o, smp) && !selected(ctx.o, serial)) {
+		return;
+	}
+
+	const auto n = ctx.n;
+	auto a = blaze::DynamicMatrix<T, SOA>(n, n);
+	auto b = blaze::DynamicMatrix<T, SOB>(n, n);
+	auto c = blaze::DynamicMatrix<T, SOA>(n, n);
+	load(a, ctx.a, n);
+	load(b, ctx.b, n);
+
+	if (selected(ctx.o, smp)) {
+		bench(smp, c, a, b, true, ctx);
+	}
+	if (selected(ctx.o, serial)) {
+		bench(serial, c, a, b, false, ctx);
+	}
+}
+
+/*
+** The static operands are allocated on the heap, since they are too large
+** for the stack; `StaticMatrix` provides an aligned `operator new`.
+*/
+template <size_t N, bool SOA, bool SOB, class T>
+static void run_static(context<T>& ctx)
+{
+	const auto name = std::string{"static-"} + order_name(SOA, SOB) +
+		"-serial";
+	if (!selected(ctx.o, name)) {
+		return;
+	}
+
+	using lhs = blaze::StaticMatrix<T, N, N, SOA>;
+	using rhs = blaze::StaticMatrix<T, N, N, SOB>;
+	auto a = std::unique_ptr<lhs>{new lhs};
+	auto b = std::unique_ptr<rhs>{new rhs};
+	auto c = std::unique_ptr<lhs>{new lhs};
+	load(*a, ctx.a, N);
+	load(*b, ctx.b, N);
+
+	bench(name, *c, *a, *b, false, ctx);
+}
+
+template <class T>
+static void run_static(context<T>&, size_list<>) {}
+
+template <class T, size_t N, size_t... Ns>
+static void run_static(context<T>& ctx, size_list<N, Ns...>)
+{
+	if (ctx.n != N) {
+		run_static(ctx, size_list<Ns...>{});
+		return;
+	}
+
+	run_static<N, false, false>(ctx);
+	run_static<N, false, true>(ctx);
+	run_static<N, true, false>(ctx);
+	run_static<N, true, true>(ctx);
+}
+
+static void print_smp_mode()
+{
+	std::cout << "# SMP: ";
+#if BLAZE_OPENMP_PARALLEL_MODE
+	std::cout << "OpenMP, " << blaze::getNumThreads() << " threads\n";
+#elif BLAZE_CPP_THREADS_PARALLEL_MODE
+	std::cout << "C++11 threads, " << blaze::getNumThreads() << " threads\n";
+#elif BLAZE_BOOST_THREADS_PARALLEL_MODE
+	std::cout << "Boost threads, " << blaze::getNumThreads() << " threads\n";
+#else
+	std::cout << "disabled (compile with -fopenmp or "
+		"-DBLAZE_USE_CPP_THREADS to enable it)\n";
+#endif
+}
+
+template <class T>
+static bool run(const char* type, const options& o)
+{
+	const auto peak = o.peak > 0 ? o.peak : peak_gflops<T>();
+	print_header(type, peak, o.peak <= 0, o.warmup, o.reps, o.counters);
+
+	auto gen = std::mt19937{42};
+	auto dist = std::uniform_real_distribution<T>{-1, 1};
+	auto ok = true;
+
+	for (auto n : o.sizes) {
+		auto ctx = context<T>{o, peak, n, std::vector<T>(n * n),
+			std::vector<T>(n * n), nullptr, true};
+		for (auto i = 0u; i != n * n; ++i) {
+			ctx.a[i] = dist(gen);
+			ctx.b[i] = dist(gen);
+		}
+		if (o.check) {
+			ctx.ref.reset(new reference<T>{ctx.a.data(), ctx.b.data(), n});
+		}
+
+		run_dynamic<false, false>(ctx);
+		run_dynamic<false, true>(ctx);
+		run_dynamic<true, false>(ctx);
+		run_dynamic<true, true>(ctx);
+		run_static(ctx, static_sizes{});
+		ok = ok && ctx.ok;
+	}
+	return ok;
+}
+
+int main(int argc, char** argv)
+{
+	const auto o = parse(argc, argv);
+	check_configs(o);
+	print_smp_mode();
+	auto ok = true;
+
+	if (o.single) {
+		ok = run<float>("float", o) && ok;
+	}
+	if (o.dbl) {
+		ok = run<double>("double", o) && ok;
+	}
+	return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}